@@ -0,0 +1,53 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef LTE_SPECTRUM_SIGNAL_CODEC_H
+#define LTE_SPECTRUM_SIGNAL_CODEC_H
+
+#include <ns3/distributed-spectrum-signal-codec.h>
+
+namespace ns3 {
+
+/**
+ * \ingroup lte
+ *
+ * Codec of the LTE signals sent by a DistributedSpectrumChannel to the
+ * receivers of other systems.  It is added to the channel when the lte
+ * module is loaded.
+ *
+ * The sidelink frames (LteSpectrumSignalParametersSlFrame and its
+ * subclasses), the uplink SRS frames and LteSpectrumSignalParameters are
+ * sent whole, with the packet tags and byte tags of their packets.  The
+ * data frames and the downlink control frames are sent without their
+ * LteControlMessage list: the other cells receive them as interference,
+ * and measure the RSRP of the PSS, but cannot decode the DCIs, the MIB
+ * or the SIB1 of a cell of another system.  A UE must therefore be in
+ * the system of its serving eNB, and be attached to it (e.g. with
+ * LteHelper::Attach (ue, enb)) rather than select it by itself; handover
+ * to a cell of another system is not supported.
+ */
+class LteSpectrumSignalCodec : public DistributedSpectrumSignalCodec
+{
+public:
+  // inherited from DistributedSpectrumSignalCodec
+  virtual bool CanEncode (Ptr<const SpectrumSignalParameters> params) const;
+  virtual Ptr<Packet> Encode (Ptr<const SpectrumSignalParameters> params) const;
+  virtual Ptr<SpectrumSignalParameters> Decode (Ptr<Packet> p) const;
+};
+
+} // namespace ns3
+
+#endif /* LTE_SPECTRUM_SIGNAL_CODEC_H */
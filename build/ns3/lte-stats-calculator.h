@@ -0,0 +1,338 @@
+/* -*-  Mode: C++; c-file-style: "gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2011 Centre Tecnologic de Telecomunicacions de Catalunya (CTTC)
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ * Author: Jaume Nin <jnin@cttc.es>
+ * Modified by: NIST // Contributions may not be subject to US copyright.
+ */
+
+#ifndef LTE_STATS_CALCULATOR_H_
+#define LTE_STATS_CALCULATOR_H_
+
+#include "ns3/object.h"
+#include "ns3/string.h"
+#include "ns3/config.h"
+#include "ns3/lte-stats-output-file.h"
+#include <map>
+
+namespace ns3 {
+
+/**
+ * \ingroup lte
+ *
+ * Base class for ***StatsCalculator classes. Provides
+ * basic functionality to parse and store IMSI and CellId.
+ * Also stores names of output files, and keeps the output files open
+ * across the records, see GetOutputStream ().
+ */
+
+class LteStatsCalculator : public Object
+{
+public:
+  /**
+   * Constructor
+   */
+  LteStatsCalculator ();
+
+  /**
+   * Destructor
+   */
+  virtual ~LteStatsCalculator ();
+
+  /**
+   *  Register this type.
+   *  \return The object TypeId.
+   */
+  static TypeId GetTypeId (void);
+
+  /**
+   * Write the pending records and close all the output files of the
+   * stats calculators. Called when the simulator is destroyed; a later
+   * record is appended to its reopened file.
+   */
+  static void CloseOutputFiles (void);
+
+  /**
+   * Set the name of the file where the uplink statistics will be stored.
+   *
+   * \param outputFilename string with the name of the file
+   */
+  void SetUlOutputFilename (std::string outputFilename);
+
+  /**
+   * Get the name of the file where the uplink statistics will be stored.
+   * @return the name of the file where the uplink statistics will be stored
+   */
+  std::string GetUlOutputFilename (void);
+
+  /**
+   * Set the name of the file where the downlink statistics will be stored.
+   *
+   * @param outputFilename string with the name of the file
+   */
+  void SetDlOutputFilename (std::string outputFilename);
+
+  /**
+   * Get the name of the file where the downlink statistics will be stored.
+   * @return the name of the file where the downlink statistics will be stored
+   */
+  std::string GetDlOutputFilename (void);
+
+  /**
+   * Set the name of the file where the Sidelink statistics will be stored.
+   *
+   * \param outputFilename string with the name of the file
+   */
+  void SetSlOutputFilename (std::string outputFilename);
+
+  /**
+   * Get the name of the file where the Sidelink statistics will be stored.
+   * @return the name of the file where the Sidelink statistics will be stored
+   */
+  std::string GetSlOutputFilename (void);
+
+  /**
+   * Set the name of the file where the Sidelink PSCCH statistics will be stored.
+   *
+   * \param outputFilename string with the name of the file
+   */
+  void SetSlPscchOutputFilename (std::string outputFilename);
+
+  /**
+   * Get the name of the file where the Sidelink PSCCH statistics will be stored.
+   * @return the name of the file where the Sidelink PSCCH statistics will be stored
+   */
+  std::string GetSlPscchOutputFilename (void);
+
+  /**
+   * Set the name of the file where the Sidelink PSDCH statistics will be stored.
+   *
+   * \param outputFilename string with the name of the file
+   */
+  void SetSlPsdchOutputFilename (std::string outputFilename);
+
+  /**
+   * Get the name of the file where the Sidelink PSDCH statistics will be stored.
+   * @return the name of the file where the Sidelink PSDCH statistics will be stored
+   */
+  std::string GetSlPsdchOutputFilename (void);
+
+  /**
+   * Checks if there is an already stored IMSI for the given path
+   * @param path Path in the attribute system to check
+   * @return true if the path exists, false otherwise
+   */
+  bool ExistsImsiPath (std::string path);
+
+  /**
+   * Stores the (path, imsi) pairs in a map
+   * @param path Path in the attribute system to store
+   * @param imsi IMSI value to store
+   */
+  void SetImsiPath (std::string path, uint64_t imsi);
+
+  /**
+   * Retrieves the imsi information for the given path
+   * @param path Path in the attribute system to get
+   * @return the IMSI associated with the given path
+   */
+  uint64_t GetImsiPath (std::string path);
+
+  /**
+   * Checks if there is an already stored cell id for the given path
+   * @param path Path in the attribute system to check
+   * @return true if the path exists, false otherwise
+   */
+  bool ExistsCellIdPath (std::string path);
+
+  /**
+   * Stores the (path, cellId) pairs in a map
+   * @param path Path in the attribute system to store
+   * @param cellId cell id value to store
+   */
+  void SetCellIdPath (std::string path, uint16_t cellId);
+
+  /**
+   * Retrieves the cell id information for the given path
+   * @param path Path in the attribute system to get
+   * @return the cell ID associated with the given path
+   */
+  uint16_t GetCellIdPath (std::string path);
+
+protected:
+
+  /**
+   * Get the stream of an output file, opening the file if it is not
+   * open yet. The files are shared by all the stats calculators, and
+   * stay open until CloseOutputFiles () is called, so that the records
+   * are written in large blocks.
+   *
+   * @param filename the name of the file
+   * @param truncate true to truncate the file, i.e., for the first record
+   * @return the stream, in a failed state if the file could not be opened
+   */
+  std::ostream& GetOutputStream (const std::string &filename, bool truncate);
+
+  /**
+   * Retrieves IMSI from Enb RLC path in the attribute system
+   * @param path Path in the attribute system to get
+   * @return the IMSI associated with the given path
+   */
+  static uint64_t FindImsiFromEnbRlcPath (std::string path);
+
+  /**
+   * Retrieves IMSI from Ue PHY path in the attribute system
+   * @param path Path in the attribute system to get
+   * @return the IMSI associated with the given path
+   */
+  static uint64_t FindImsiFromUePhy (std::string path);
+
+  /**
+   * Retrieves IMSI from LteNetDevice path in the attribute system
+   * @param path Path in the attribute system to get
+   * @return the IMSI associated with the given path
+   */
+  static uint64_t FindImsiFromLteNetDevice (std::string path);
+
+  /**
+   * Retrieves CellId from Enb RLC path in the attribute system
+   * @param path Path in the attribute system to get
+   * @return the CellId associated with the given path
+   */
+  static uint16_t FindCellIdFromEnbRlcPath (std::string path);
+
+  /**
+   * Retrieves IMSI from Enb MAC path in the attribute system
+   * @param path Path in the attribute system to get
+   * @param rnti RNTI of UE for which IMSI is needed
+   * @return the IMSI associated with the given path and RNTI
+   */
+  static uint64_t FindImsiFromEnbMac (std::string path, uint16_t rnti);
+
+  /**
+   * Retrieves CellId from Enb MAC path in the attribute system
+   * @param path Path in the attribute system to get
+   * @param rnti RNTI of UE for which CellId is needed
+   * @return the CellId associated with the given path and RNTI
+   */
+  static uint16_t FindCellIdFromEnbMac (std::string path, uint16_t rnti);
+
+  /**
+   * Retrieves IMSI from path for Enb in the attribute system
+   * @param path Path in the attribute system to get
+   * @param rnti RNTI of UE for which IMSI is needed
+   * @return the IMSI associated with the given path and RNTI
+   */
+  static uint64_t FindImsiForEnb (std::string path, uint16_t rnti);
+
+  /**
+   * Retrieves IMSI from path for Ue in the attribute system
+   * @param path Path in the attribute system to get
+   * @param rnti RNTI of UE for which IMSI is needed
+   * @return the IMSI associated with the given path and RNTI
+   */
+  static uint64_t FindImsiForUe (std::string path, uint16_t rnti);
+
+  /**
+   * Retrieves the IMSI of the LteUeNetDevice holding a trace source
+   * @param context Context of a trace source connected with
+   *        Config::ConnectWithTraceContext, whose path starts with
+   *        /NodeList/#NodeId/DeviceList/#DeviceId
+   * @return the IMSI of the UE
+   */
+  static uint64_t FindImsiFromUeDevice (Ptr<const Config::TraceContext> context);
+
+  /**
+   * Retrieves the CellId of the LteEnbNetDevice holding a trace source
+   * @param context Context of a trace source connected with
+   *        Config::ConnectWithTraceContext, whose path starts with
+   *        /NodeList/#NodeId/DeviceList/#DeviceId
+   * @return the CellId of the eNB
+   */
+  static uint16_t FindCellIdFromEnbDevice (Ptr<const Config::TraceContext> context);
+
+  /**
+   * Retrieves the IMSI of a UE served by the LteEnbNetDevice holding a
+   * trace source. The IMSI is stored the first time it is retrieved.
+   * @param context Context of a trace source connected with
+   *        Config::ConnectWithTraceContext, whose path starts with
+   *        /NodeList/#NodeId/DeviceList/#DeviceId
+   * @param rnti RNTI of UE for which IMSI is needed
+   * @return the IMSI associated with the eNB device and RNTI
+   */
+  uint64_t GetImsiFromEnbDevice (Ptr<const Config::TraceContext> context, uint16_t rnti);
+
+private:
+  /**
+   * The open output files, by name
+   */
+  static std::map<std::string, Ptr<LteStatsOutputFile> > s_outputFiles;
+
+  /**
+   * Size in bytes of the buffer of the output files
+   */
+  uint32_t m_outputBufferSize;
+
+  /**
+   * Whether the output files are written by a background thread
+   */
+  bool m_backgroundWriter;
+
+  /**
+   * List of IMSI by path in the attribute system
+   */
+  std::map<std::string, uint64_t> m_pathImsiMap;
+
+  /**
+   * List of CellId by path in the attribute system
+   */
+  std::map<std::string, uint16_t> m_pathCellIdMap;
+
+  /**
+   * List of IMSI by eNB node index, eNB device index and RNTI
+   */
+  std::map<uint64_t, uint64_t> m_enbRntiImsiMap;
+
+  /**
+   * Name of the file where the downlink results will be saved
+   */
+  std::string m_dlOutputFilename;
+
+  /**
+   * Name of the file where the uplink results will be saved
+   */
+  std::string m_ulOutputFilename;
+
+  /**
+   * Name of the file where the Sidelink results will be saved
+   */
+  std::string m_slOutputFilename;
+
+  /**
+   * Name of the file where the Sidlink PSCCH results will be saved
+   */
+  std::string m_slPscchOutputFilename;
+
+  /**
+   * Name of the file where the Sidlink PSDCH results will be saved
+   */
+  std::string m_slPsdchOutputFilename;
+
+};
+
+} // namespace ns3
+
+#endif /* LTE_STATS_CALCULATOR_H_ */
@@ -0,0 +1,258 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2009 CTTC
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ * Author: Nicola Baldo <nbaldo@cttc.es>
+ */
+
+
+#ifndef MULTI_MODEL_SPECTRUM_CHANNEL_H
+#define MULTI_MODEL_SPECTRUM_CHANNEL_H
+
+#include <ns3/spectrum-value.h>
+#include <ns3/spectrum-converter.h>
+#include <ns3/spectrum-channel.h>
+#include <ns3/spectrum-propagation-loss-model.h>
+#include <ns3/propagation-delay-model.h>
+#include <ns3/spectrum-phy-grid-index.h>
+#include <ns3/spectrum-path-loss-cache.h>
+#include <map>
+#include <set>
+
+namespace ns3 {
+
+
+/**
+ * \ingroup spectrum
+ * Container: SpectrumModelUid_t, SpectrumConverter
+ */
+typedef std::map<SpectrumModelUid_t, SpectrumConverter> SpectrumConverterMap_t;
+
+/**
+ * \ingroup spectrum
+ * The Tx spectrum model information. This class is used to convert
+ * one spectrum model into another one.
+ */
+class TxSpectrumModelInfo
+{
+public:
+  /**
+   * Constructor.
+   * \param txSpectrumModel the Tx Spectrum model.
+   */
+  TxSpectrumModelInfo (Ptr<const SpectrumModel> txSpectrumModel);
+
+  Ptr<const SpectrumModel> m_txSpectrumModel;     //!< Tx Spectrum model.
+  SpectrumConverterMap_t m_spectrumConverterMap;  //!< Spectrum converter.
+};
+
+
+/**
+ * \ingroup spectrum
+ * Container: SpectrumModelUid_t, TxSpectrumModelInfo
+ */
+typedef std::map<SpectrumModelUid_t, TxSpectrumModelInfo> TxSpectrumModelInfoMap_t;
+
+
+/**
+ * \ingroup spectrum
+ * The Rx spectrum model information. This class is used to convert
+ * one spectrum model into another one.
+ */
+class RxSpectrumModelInfo
+{
+public:
+  /**
+   * Constructor.
+   * \param rxSpectrumModel the Rx Spectrum model.
+   */
+  RxSpectrumModelInfo (Ptr<const SpectrumModel> rxSpectrumModel);
+
+  Ptr<const SpectrumModel> m_rxSpectrumModel;  //!< Rx Spectrum model.
+  std::vector<Ptr<SpectrumPhy> > m_rxPhys;     //!< Container of the Rx Spectrum phy objects.
+  Ptr<SpectrumPhyGridIndex> m_rxPhyIndex;      //!< Spatial index of m_rxPhys, only built if MaxRange is set.
+};
+
+/**
+ * \ingroup spectrum
+ * Container: SpectrumModelUid_t, RxSpectrumModelInfo
+ */
+typedef std::map<SpectrumModelUid_t, RxSpectrumModelInfo> RxSpectrumModelInfoMap_t;
+
+
+/**
+ * \ingroup spectrum
+ *
+ * This SpectrumChannel implementation can handle the presence of
+ * SpectrumPhy instances which can use
+ * different spectrum models, i.e.,  different SpectrumModel. 
+ *
+ * \note It is allowed for a receiving SpectrumPhy to switch to a
+ * different SpectrumModel during the simulation. The requirement
+ * for this to work is that, after the SpectrumPhy switched its
+ * SpectrumModel,  MultiModelSpectrumChannel::AddRx () is
+ * called again passing the pointer to that SpectrumPhy.
+ *
+ * \note If the MaxRange attribute is set, the receivers are kept in a
+ * SpectrumPhyGridIndex and a transmission is only delivered to the
+ * receivers within MaxRange of the transmitter, which are the only ones
+ * for which the PathLoss and Gain traces are fired. Receivers without a
+ * MobilityModel are always considered to be in range.
+ *
+ * \note If the PathLossCache attribute is set, the gain computed by the
+ * PropagationLossModel for a pair of stationary phys is kept in a
+ * SpectrumPathLossCache, and only computed again after one of them has
+ * notified a course change. The antenna gains and the
+ * SpectrumPropagationLossModel are evaluated at every transmission.
+ */
+class MultiModelSpectrumChannel : public SpectrumChannel
+{
+
+public:
+  MultiModelSpectrumChannel ();
+
+  /**
+   * \brief Get the type ID.
+   * \return the object TypeId
+   */
+  static TypeId GetTypeId (void);
+
+  // inherited from SpectrumChannel
+  virtual void AddRx (Ptr<SpectrumPhy> phy);
+  virtual void StartTx (Ptr<SpectrumSignalParameters> params);
+
+
+  // inherited from Channel
+  virtual std::size_t GetNDevices (void) const;
+  virtual Ptr<NetDevice> GetDevice (std::size_t i) const;
+
+  /**
+   * \return the number of propagation gains found in the path loss cache
+   */
+  uint64_t GetPathLossCacheHits (void) const;
+
+  /**
+   * \return the number of propagation gains not found in the path loss
+   * cache while it is enabled
+   */
+  uint64_t GetPathLossCacheMisses (void) const;
+
+
+protected:
+  void DoDispose ();
+
+  /**
+   * Deliver a signal to the receivers, as StartTx does once it has fired
+   * the TxSigParams trace.
+   *
+   * \param txParams The signal parameters.
+   * \param elapsed The time elapsed since the start of the transmission,
+   *   subtracted from the propagation delay to each receiver.
+   */
+  void DoStartTx (Ptr<SpectrumSignalParameters> txParams, Time elapsed);
+
+  /**
+   * \return the maximum distance [m] between a transmitter and a receiver,
+   * or a non-positive value if the receivers are not culled by distance
+   */
+  double GetMaxRange (void) const;
+
+private:
+  /**
+   * This method checks if m_rxSpectrumModelInfoMap contains an entry
+   * for the given TX SpectrumModel. If such entry exists, it returns
+   * an iterator pointing to it. If not, it creates a new entry in
+   * m_txSpectrumMpodelInfoMap, and returns an iterator to it.
+   *
+   * \param txSpectrumModel The TX SpectrumModel  being considered
+   *
+   * \return An iterator pointing to the corresponding entry in m_txSpectrumModelInfoMap
+   */
+  TxSpectrumModelInfoMap_t::const_iterator FindAndEventuallyAddTxSpectrumModel (Ptr<const SpectrumModel> txSpectrumModel);
+
+  /**
+   * Used internally to reschedule transmission after the propagation delay.
+   *
+   * \param params The signal parameters.
+   * \param receiver A pointer to the receiver SpectrumPhy.
+   */
+  virtual void StartRx (Ptr<SpectrumSignalParameters> params, Ptr<SpectrumPhy> receiver);
+
+  /**
+   * Compute the loss between the transmitter and one receiver, and
+   * schedule the reception of the signal if the receiver is in range.
+   *
+   * \param txParams The signal parameters.
+   * \param txPowerSpectrum The transmitted PSD, converted to the receiver SpectrumModel.
+   * \param txMobility The mobility model of the transmitter, if any.
+   * \param receiver A pointer to the receiver SpectrumPhy.
+   * \param elapsed The time elapsed since the start of the transmission.
+   */
+  void StartTxToReceiver (Ptr<SpectrumSignalParameters> txParams, Ptr<const SpectrumValue> txPowerSpectrum,
+                          Ptr<MobilityModel> txMobility, Ptr<SpectrumPhy> receiver, Time elapsed);
+
+  /**
+   * Data structure holding, for each TX SpectrumModel,  all the
+   * converters to any RX SpectrumModel, and all the corresponding
+   * SpectrumPhy instances.
+   *
+   */
+  TxSpectrumModelInfoMap_t m_txSpectrumModelInfoMap;
+
+
+  /**
+   * Data structure holding, for each RX spectrum model, all the
+   * corresponding SpectrumPhy instances.
+   */
+  RxSpectrumModelInfoMap_t m_rxSpectrumModelInfoMap;
+
+  /**
+   * Number of devices connected to the channel.
+   */
+  std::size_t m_numDevices;
+
+  /**
+   * Maximum distance [m] between a transmitter and a receiver for the
+   * signal to be propagated. A non-positive value disables the
+   * spatial culling of the receivers.
+   */
+  double m_maxRange;
+
+  /**
+   * Buffer of the receivers in range of the current transmission,
+   * kept to avoid allocating it at each StartTx call.
+   */
+  std::vector<Ptr<SpectrumPhy> > m_rxPhysInRange;
+
+  /**
+   * True if the propagation gains of the stationary phys are cached.
+   */
+  bool m_pathLossCacheEnabled;
+
+  /**
+   * Cache of the propagation gains, only created if m_pathLossCacheEnabled.
+   */
+  Ptr<SpectrumPathLossCache> m_pathLossCache;
+
+};
+
+
+
+}
+
+
+
+#endif /* MULTI_MODEL_SPECTRUM_CHANNEL_H */
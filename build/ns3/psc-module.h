@@ -0,0 +1,58 @@
+
+#ifdef NS3_MODULE_COMPILATION
+# error "Do not include ns3 module aggregator headers from other modules; these are meant only for end user scripts."
+#endif
+
+#ifndef NS3_MODULE_PSC
+    
+
+// Module headers:
+#include "intel-http-client.h"
+#include "intel-http-header.h"
+#include "intel-http-helper.h"
+#include "intel-http-server.h"
+#include "mcptt-call-machine-grp-basic-state.h"
+#include "mcptt-call-machine-grp-basic.h"
+#include "mcptt-call-machine-grp-broadcast-state.h"
+#include "mcptt-call-machine-grp-broadcast.h"
+#include "mcptt-call-machine-private-state.h"
+#include "mcptt-call-machine-private.h"
+#include "mcptt-call-machine.h"
+#include "mcptt-call-msg-field.h"
+#include "mcptt-call-msg.h"
+#include "mcptt-call-type-machine-grp-basic.h"
+#include "mcptt-call-type-machine-private-state.h"
+#include "mcptt-call-type-machine-private.h"
+#include "mcptt-call-type-machine.h"
+#include "mcptt-call.h"
+#include "mcptt-chan.h"
+#include "mcptt-counter.h"
+#include "mcptt-emerg-alert-machine-basic.h"
+#include "mcptt-emerg-alert-machine.h"
+#include "mcptt-entity-id.h"
+#include "mcptt-floor-machine-basic-state.h"
+#include "mcptt-floor-machine-basic.h"
+#include "mcptt-floor-machine.h"
+#include "mcptt-floor-msg-field.h"
+#include "mcptt-floor-msg.h"
+#include "mcptt-floor-queue.h"
+#include "mcptt-helper.h"
+#include "mcptt-media-msg.h"
+#include "mcptt-media-sink.h"
+#include "mcptt-media-src.h"
+#include "mcptt-msg-dispatcher.h"
+#include "mcptt-msg-stats.h"
+#include "mcptt-msg.h"
+#include "mcptt-ptt-app.h"
+#include "mcptt-pushable.h"
+#include "mcptt-pusher.h"
+#include "mcptt-queued-user-info.h"
+#include "mcptt-rtp-header.h"
+#include "mcptt-state-machine-stats.h"
+#include "mcptt-timer.h"
+#include "mcptt-trace-writer.h"
+#include "uav-mobility-energy-model-helper.h"
+#include "uav-mobility-energy-model.h"
+#include "udp-group-echo-helper.h"
+#include "udp-group-echo-server.h"
+#endif
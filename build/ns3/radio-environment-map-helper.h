@@ -0,0 +1,289 @@
+/* -*-  Mode: C++; c-file-style: "gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2012 Centre Tecnologic de Telecomunicacions de Catalunya (CTTC)
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ * Author: Nicola Baldo <nbaldo@cttc.es>
+ */
+
+
+#ifndef RADIO_ENVIRONMENT_MAP_HELPER_H
+#define RADIO_ENVIRONMENT_MAP_HELPER_H
+
+
+#include <ns3/object.h>
+#include <fstream>
+#include <vector>
+
+
+namespace ns3 {
+
+class RemSpectrumPhy;
+class Node;
+class NetDevice;
+class SpectrumChannel;
+//class BuildingsMobilityModel;
+class MobilityModel;
+class AntennaModel;
+class SpectrumValue;
+class LteSpectrumPhy;
+class PropagationLossModel;
+class SpectrumPropagationLossModel;
+
+/** 
+ * \ingroup lte
+ *
+ * Generates a 2D map of the SINR from the strongest transmitter in the
+ * downlink of an LTE FDD system. For instructions on usage, please refer to
+ * the User Documentation.
+ *
+ * If the `Offline` attribute is true, the map is computed directly from the
+ * transmitters attached to the channel and the loss models of the channel,
+ * instead of simulating a listener for each point. The points are then
+ * evaluated by a pool of threads, a tile of columns at a time, and the tiles
+ * are written in order as they are completed, either as text or as a binary
+ * raster (see ConvertBinaryToText).
+ */
+class RadioEnvironmentMapHelper : public Object
+{
+public:  
+
+  RadioEnvironmentMapHelper ();
+  virtual ~RadioEnvironmentMapHelper ();
+  
+  // inherited from Object
+  virtual void DoDispose (void);
+  /**
+   *  Register this type.
+   *  \return The object TypeId.
+   */
+  static TypeId GetTypeId (void);
+
+  /** 
+   * \return the bandwidth (in num of RBs) over which SINR is calculated
+   */
+  uint8_t GetBandwidth () const;
+
+  /** 
+   *
+   * \param bw  the bandwidth (in num of RBs) over which SINR is calculated
+   */
+  void SetBandwidth (uint8_t bw);
+
+  /** 
+   * Deploy the RemSpectrumPhy objects that generate the map according to the specified settings.
+   * 
+   */
+  void Install ();
+
+  /**
+   * Convert a map written by the offline engine as a binary raster (see the
+   * `BinaryOutput` attribute) to the text format of the offline engine,
+   * i.e., one line per point with the x, y and z coordinates, the SINR in
+   * linear units and the RSRP of the strongest transmitter in dBm. The
+   * binary file must have been written on a host with the same byte order.
+   *
+   * \param binaryFilename the name of the binary file to read
+   * \param textFilename the name of the text file to write
+   */
+  static void ConvertBinaryToText (std::string binaryFilename, std::string textFilename);
+
+private:
+
+  /**
+   * Scheduled by Install() to perform the actual generation of map.
+   *
+   * If control channel is used for SINR calculation (the default), the delay
+   * is 2.6 milliseconds from the start of simulation. Otherwise, if data
+   * channel is used, the delay is 500.1 milliseconds from the start of
+   * simulation.
+   *
+   * The method will divide the whole map into parts (each contains at most a
+   * certain number of SINR listening points), and then call RunOneIteration()
+   * on each part, one by one.
+   */
+  void DelayedInstall ();
+
+  /**
+   * Mobilize all the listeners to a specified area. Afterwards, schedule a
+   * call to PrintAndReset() in 0.5 milliseconds.
+   *
+   * \param xMin X coordinate of the first SINR listening point to deploy.
+   * \param xMax X coordinate of the last SINR listening point to deploy.
+   * \param yMin Y coordinate of the first SINR listening point to deploy.
+   * \param yMax Y coordinate of the last SINR listening point to deploy.
+   */
+  void RunOneIteration (double xMin, double xMax, double yMin, double yMax);
+
+  /// Go through every listener, write the computed SINR, and then reset it.
+  void PrintAndReset ();
+
+  /// Called when the map generation procedure has been completed.
+  void Finalize ();
+
+  /// A transmitter evaluated by the offline engine.
+  struct OfflineTransmitter
+  {
+    /// Position of the transmitter.
+    Ptr<MobilityModel> mobility;
+    /// Antenna of the transmitter, or 0 for an isotropic antenna.
+    Ptr<AntennaModel> antenna;
+    /// Transmitted PSD, converted to the spectrum model of the map.
+    Ptr<SpectrumValue> psd;
+    /// Power of the PSD, in W, as computed by the RemSpectrumPhy.
+    double power;
+    /// Power of the PSD per resource element, in W, for the RSRP.
+    double rsrp;
+  };
+
+  /**
+   * The models used by a thread of the offline engine. The thread is the
+   * only user of the objects of its context, except of the models of the
+   * channel and of the mobility models of the transmitters, which are only
+   * used when the map is evaluated by the calling thread alone.
+   */
+  struct OfflineContext
+  {
+    /// Single-frequency loss model of the channel, or a copy of it.
+    Ptr<PropagationLossModel> propagationLoss;
+    /// Frequency-dependent loss model of the channel.
+    Ptr<SpectrumPropagationLossModel> spectrumPropagationLoss;
+    /// Mobility models of the transmitters, or copies of them.
+    std::vector<Ptr<MobilityModel> > txMobility;
+    /// Position of the point being evaluated.
+    Ptr<MobilityModel> rxMobility;
+    /// True if the building info of the point is updated at each point.
+    bool makeConsistent;
+  };
+
+  /**
+   * Scheduled by Install() when the `Offline` attribute is true, to compute
+   * the whole map directly from the transmitters and the loss models of the
+   * channel, then call Finalize().
+   */
+  void RunOffline ();
+
+  /**
+   * Collect in m_offlineTransmitters the eNBs and/or the Sidelink UEs that
+   * transmit on the channel of the map, according to the `IncludeEnbs` and
+   * `IncludeSidelinkUes` attributes.
+   */
+  void FindOfflineTransmitters ();
+
+  /**
+   * Add a transmitter to m_offlineTransmitters if it is attached to the
+   * channel of the map.
+   *
+   * \param phy the spectrum phy of the transmitter
+   * \param psd the PSD transmitted
+   */
+  void AddOfflineTransmitter (Ptr<LteSpectrumPhy> phy, Ptr<SpectrumValue> psd);
+
+  /**
+   * Create the contexts of the threads of the offline engine. When the
+   * models cannot be evaluated concurrently, e.g., the scenario has
+   * buildings or the channel has a frequency-dependent loss model, a
+   * single context using the models of the channel is created.
+   *
+   * \param nThreads the number of threads requested
+   * \return the contexts, one per thread
+   */
+  std::vector<OfflineContext> CreateOfflineContexts (uint32_t nThreads);
+
+  /**
+   * Compute the SINR and the RSRP of a tile of columns of the map. This
+   * function may be called concurrently by several threads, each with its
+   * own context, hence it does not log.
+   *
+   * \param context the models used by the calling thread
+   * \param firstColumn the index of the first column of the tile
+   * \param lastColumn the index following the last column of the tile
+   * \param values the SINR and RSRP of each point, column by column
+   */
+  void ComputeOfflineColumns (const OfflineContext &context, uint32_t firstColumn,
+                              uint32_t lastColumn, std::vector<float> &values) const;
+
+  /**
+   * Write a tile of columns of the map to the output file.
+   *
+   * \param firstColumn the index of the first column of the tile
+   * \param lastColumn the index following the last column of the tile
+   * \param values the SINR and RSRP of each point, column by column
+   */
+  void WriteOfflineColumns (uint32_t firstColumn, uint32_t lastColumn,
+                            const std::vector<float> &values);
+
+  /// A complete Radio Environment Map is composed of many of this structure.
+  struct RemPoint 
+  {
+    /// Simplified listener which compute SINR over the DL channel.
+    Ptr<RemSpectrumPhy> phy;
+    /// Position of the listener in the environment.
+    Ptr<MobilityModel> bmm;
+  };
+
+  /// List of listeners in the environment.
+  std::list<RemPoint> m_rem;
+
+  double m_xMin;   ///< The `XMin` attribute.
+  double m_xMax;   ///< The `XMax` attribute.
+  uint16_t m_xRes; ///< The `XRes` attribute.
+  double m_xStep;  ///< Distance along X axis between adjacent listening points.
+
+  double m_yMin;   ///< The `YMin` attribute.
+  double m_yMax;   ///< The `YMax` attribute.
+  uint16_t m_yRes; ///< The `YRes` attribute.
+  double m_yStep;  ///< Distance along Y axis between adjacent listening points.
+
+  uint32_t m_maxPointsPerIteration;  ///< The `MaxPointsPerIteration` attribute.
+
+  uint16_t m_earfcn;     ///< The `Earfcn` attribute.
+  uint16_t m_bandwidth;  ///< The `Bandwidth` attribute.
+ 
+  double m_z;  ///< The `Z` attribute.
+
+  std::string m_channelPath;  ///< The `ChannelPath` attribute.
+  std::string m_outputFile;   ///< The `OutputFile` attribute.
+
+  bool m_stopWhenDone;   ///< The `StopWhenDone` attribute.
+  
+  /// The channel object taken from the `ChannelPath` attribute.
+  Ptr<SpectrumChannel> m_channel;
+
+  double m_noisePower;  ///< The `NoisePower` attribute.
+
+  std::ofstream m_outFile;  ///< Stream the output to a file.
+
+  bool m_useDataChannel;  ///< The `UseDataChannel` attribute.
+  int32_t m_rbId;         ///< The `RbId` attribute.
+
+  bool m_offline;                 ///< The `Offline` attribute.
+  uint32_t m_numThreads;          ///< The `NumThreads` attribute.
+  uint32_t m_tileColumns;         ///< The `TileColumns` attribute.
+  bool m_binaryOutput;            ///< The `BinaryOutput` attribute.
+  bool m_includeEnbs;             ///< The `IncludeEnbs` attribute.
+  bool m_includeSidelinkUes;      ///< The `IncludeSidelinkUes` attribute.
+
+  /// The maximum loss of the channel, above which a signal is not received.
+  double m_maxLossDb;
+  /// The transmitters evaluated by the offline engine.
+  std::vector<OfflineTransmitter> m_offlineTransmitters;
+
+}; // end of `class RadioEnvironmentMapHelper`
+
+
+} // end of `namespace ns3`
+
+#endif /* RADIO_ENVIRONMENT_MAP_HELPER_H */
@@ -0,0 +1,363 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2008 University of Washington
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef REALTIME_SIMULATOR_IMPL_H
+#define REALTIME_SIMULATOR_IMPL_H
+
+#include "simulator-impl.h"
+#include "system-thread.h"
+
+#include "scheduler.h"
+#include "synchronizer.h"
+#include "event-impl.h"
+
+#include "ptr.h"
+#include "assert.h"
+#include "log.h"
+#include "system-mutex.h"
+#include "nstime.h"
+#include "traced-callback.h"
+
+#include <atomic>
+#include <list>
+#include <vector>
+
+/**
+ * \file
+ * \ingroup realtime
+ * ns3::RealtimeSimulatorImpl declaration.
+ */
+
+namespace ns3 {
+
+/**
+ * \ingroup simulator
+ * \defgroup realtime Realtime Simulator
+ *
+ * Realtime simulator implementation.
+ */
+  
+/**
+ * \ingroup realtime
+ *
+ * Realtime version of SimulatorImpl.
+ *
+ * The events scheduled by threads other than the main one, such as the
+ * FdReader threads of the emulation devices, with ScheduleWithContext,
+ * ScheduleRealtimeWithContext or ScheduleRealtimeNowWithContext are pushed
+ * on a lock-free inbound queue.  The main thread moves them to the event
+ * list in batches, before looking for the next event to execute.  The
+ * other threads only signal the synchronizer when the main thread is
+ * parked in it; with the InboundSpinTime attribute, the main thread polls
+ * the inbound queue for a while before parking.
+ */
+class RealtimeSimulatorImpl : public SimulatorImpl
+{
+public:
+  /**
+   * Get the registered TypeId for this class.
+   * \returns The TypeId.
+   */
+  static TypeId GetTypeId (void);
+
+  /**
+   * What to do when we can't maintain real time synchrony.
+   */
+  enum SynchronizationMode {
+    /**
+     * Make a best effort to keep synced to real-time.
+     *
+     * If we fall behind, keep going.
+     */
+    SYNC_BEST_EFFORT, 
+    /**
+     * Keep to real time within the hard limit tolerance configured
+     * with SetHardLimit, or die trying.
+     *
+     * Falling behind by more than the hard limit tolerance triggers
+     * a fatal error.
+     * \see SetHardLimit
+     */
+    SYNC_HARD_LIMIT,  
+  };
+
+  /** Constructor. */
+  RealtimeSimulatorImpl ();
+  /** Destructor. */
+  ~RealtimeSimulatorImpl ();
+
+  // Inherited from SimulatorImpl
+  virtual void Destroy ();
+  virtual bool IsFinished (void) const;
+  virtual void Stop (void);
+  virtual void Stop (const Time &delay);
+  virtual EventId Schedule (const Time &delay, EventImpl *event);
+  virtual void ScheduleWithContext (uint32_t context, const Time &delay, EventImpl *event);
+  virtual EventId ScheduleNow (EventImpl *event);
+  virtual EventId ScheduleDestroy (EventImpl *event);
+  virtual void Remove (const EventId &ev);
+  virtual void Cancel (const EventId &ev);
+  virtual bool IsExpired (const EventId &ev) const;
+  virtual void Run (void);
+  virtual Time Now (void) const;
+  virtual Time GetDelayLeft (const EventId &id) const;
+  virtual Time GetMaximumSimulationTime (void) const;
+  virtual void SetScheduler (ObjectFactory schedulerFactory);
+  virtual uint32_t GetSystemId (void) const;
+  virtual uint32_t GetContext (void) const;
+  virtual uint64_t GetEventCount (void) const;
+
+  /** \copydoc ScheduleWithContext(uint32_t,const Time&,EventImpl*) */
+  void ScheduleRealtimeWithContext (uint32_t context, const Time &delay, EventImpl *event);
+  /** \copydoc Schedule(const Time&,EventImpl*) */
+  void ScheduleRealtime (const Time &delay, EventImpl *event);
+  /**
+   * \copybrief ScheduleNow(EventImpl*)
+   *
+   * \param [in] context Event context.
+   * \param [in] event The event to schedule.
+   */
+  void ScheduleRealtimeNowWithContext (uint32_t context, EventImpl *event);
+  /** \copydoc ScheduleNow(EventImpl*) */
+  void ScheduleRealtimeNow (EventImpl *event);
+  /**
+   * Get the current real time from the synchronizer.
+   * \returns The current real time.
+   */
+  Time RealtimeNow (void) const;
+
+  /**
+   * Set the SynchronizationMode.
+   *
+   * \param [in] mode The new SynchronizationMode.
+   */
+  void SetSynchronizationMode (RealtimeSimulatorImpl::SynchronizationMode mode);
+  /**
+   * Get the SynchronizationMode.
+   * \returns The current SynchronizationMode.
+   */
+  RealtimeSimulatorImpl::SynchronizationMode GetSynchronizationMode (void) const;
+
+  /**
+   * Set the fatal error threshold for SynchronizationMode SYNC_HARD_LIMIT.
+   *
+   * \param [in] limit The maximum amount of real time we are allowed to fall
+   *     behind before we trigger a fatal error.
+   */
+  void SetHardLimit (Time limit);
+  /**
+   * Get the current fatal error threshold for SynchronizationMode
+   * SYNC_HARD_LIMIT.
+   *
+   * \returns The hard limit threshold.
+   */
+  Time GetHardLimit (void) const;
+
+  /**
+   * Get the histogram of the lag of the event executions behind real
+   * time, that is the wall-clock time at the start of each event minus
+   * its timestamp.
+   *
+   * Bin 0 counts the lags of zero; bin \c i > 0 counts the lags in
+   * [2<sup>i-1</sup>, 2<sup>i</sup>) time steps.  Trailing empty bins are
+   * not returned.
+   *
+   * \returns The event lag histogram.
+   */
+  std::vector<uint64_t> GetEventLagHistogram (void) const;
+  /**
+   * Get the histogram of the wall-clock time spent by the events
+   * scheduled by other threads in the inbound queue, before the
+   * simulator thread inserts them in the event list.
+   *
+   * The bins are the same as those of GetEventLagHistogram().
+   *
+   * \returns The inbound lag histogram.
+   */
+  std::vector<uint64_t> GetInboundLagHistogram (void) const;
+  /** Reset the event lag and inbound lag histograms. */
+  void ResetLagHistograms (void);
+
+  /**
+   * TracedCallback signature for the lag trace sources.
+   *
+   * \param [in] lag The wall-clock lag.
+   */
+  typedef void (* LagTracedCallback)(Time lag);
+
+private:
+  /**
+   * Is the simulator running?
+   * \returns \c true if we are running.
+   */
+  bool Running (void) const;
+  /**
+   * Check that the Synchronizer is locked to the real time clock.
+   * \return \c true if the Synchronizer is locked.
+   */
+  bool Realtime (void) const;
+  /**
+   * Get the timestep of the next event.
+   * \returns The timestep of the next event.
+   */
+  uint64_t NextTs (void) const;
+  /** Process the next event. */
+  void ProcessOneEvent (void);
+  /** Destructor implementation. */
+  virtual void DoDispose (void);
+
+  /** An event scheduled by another thread, waiting in the inbound queue. */
+  struct InboundEvent
+  {
+    EventImpl *impl;       /**< The event implementation. */
+    uint64_t ts;           /**< The event timestamp. */
+    uint64_t realtime;     /**< The real time when the event was pushed. */
+    uint32_t context;      /**< The event context. */
+    InboundEvent *next;    /**< The event pushed before this one. */
+  };
+
+  /**
+   * Push an event scheduled by a thread other than the main one on the
+   * inbound queue, without taking #m_mutex, and wake up the main thread
+   * if it is parked in the synchronizer.
+   *
+   * \param [in] context The event context.
+   * \param [in] ts The event timestamp.
+   * \param [in] realtime The current real time.
+   * \param [in] impl The event implementation.
+   */
+  void PushInbound (uint32_t context, uint64_t ts, uint64_t realtime, EventImpl *impl);
+  /**
+   * Move all the events of the inbound queue to the event list, in the
+   * order they were pushed.  Must be called by the main thread with
+   * #m_mutex held.
+   *
+   * \returns The drained events, to be passed to ReleaseInbound.
+   */
+  InboundEvent * DrainInbound (void);
+  /**
+   * Record the inbound lags of drained events and delete them.  Must be
+   * called by the main thread without #m_mutex held, since the trace
+   * sinks may schedule events.
+   *
+   * \param [in] drained The events returned by DrainInbound.
+   */
+  void ReleaseInbound (InboundEvent *drained);
+  /**
+   * Poll the inbound queue until an event is pushed, the simulation is
+   * stopped, or the real time reaches a limit.
+   *
+   * \param [in] tsUntil The real time to poll until.
+   * \returns \c true if the inbound queue is not empty.
+   */
+  bool SpinInbound (uint64_t tsUntil) const;
+  /**
+   * Wait in the synchronizer, after making sure it will be signaled by
+   * PushInbound.  The condition of the synchronizer must have been reset
+   * before calling this method.
+   *
+   * \param [in] tsNow The current real time.
+   * \param [in] tsDelay The time to wait.
+   * \returns The value returned by Synchronizer::Synchronize, or \c false
+   *   if the inbound queue was not empty.
+   */
+  bool Park (uint64_t tsNow, uint64_t tsDelay);
+  /**
+   * Add a lag to a histogram.
+   *
+   * \param [in,out] histogram The histogram.
+   * \param [in] lag The lag, in time steps.
+   */
+  static void AddToHistogram (std::vector<uint64_t> &histogram, uint64_t lag);
+
+  /** Container type for events to be run at destroy time. */
+  typedef std::list<EventId> DestroyEvents;
+  /** Container for events to be run at destroy time. */
+  DestroyEvents m_destroyEvents;
+  /** Has the stopping condition been reached? */
+  bool m_stop;
+  /**
+   * Is the simulator currently running.
+   *
+   * Atomic since the threads which push on the inbound queue read it
+   * without #m_mutex.
+   */
+  std::atomic<bool> m_running;
+
+  /**
+   * \name Mutex-protected variables.
+   *
+   * These variables are protected by #m_mutex.
+   */
+  /**@{*/
+  /** The event list. */
+  Ptr<Scheduler> m_events;
+  /**< Number of events in the event list. */
+  int m_unscheduledEvents;
+  /**< Unique id for the next event to be scheduled. */
+  uint32_t m_uid;
+  /**< Unique id of the current event. */
+  uint32_t m_currentUid;
+  /**
+   * Timestep of the current event.
+   *
+   * Written with #m_mutex held, but atomic since the threads which push
+   * on the inbound queue read it without #m_mutex.
+   */
+  std::atomic<uint64_t> m_currentTs;
+  /**< Execution context. */
+  uint32_t m_currentContext;  
+  /** The event count. */
+  uint64_t m_eventCount;
+  /**@}*/
+
+  /** Mutex to control access to key state. */  
+  mutable SystemMutex m_mutex;  
+
+  /** The synchronizer in use to track real time. */
+  Ptr<Synchronizer> m_synchronizer;
+
+  /** SynchronizationMode policy. */
+  SynchronizationMode m_synchronizationMode;
+
+  /** The maximum allowable drift from real-time in SYNC_HARD_LIMIT mode. */
+  Time m_hardLimit;
+
+  /** Main SystemThread. */
+  SystemThread::ThreadId m_main;
+
+  /** The last event pushed on the inbound queue, or 0 if it is empty. */
+  std::atomic<InboundEvent *> m_inbound;
+  /** Is the main thread parked in the synchronizer, waiting for a signal? */
+  std::atomic<bool> m_parked;
+  /** Wall-clock time to poll the inbound queue before parking. */
+  Time m_inboundSpinTime;
+
+  /** The event lag histogram, updated by the main thread. */
+  std::vector<uint64_t> m_eventLagHistogram;
+  /** The inbound lag histogram, updated by the main thread. */
+  std::vector<uint64_t> m_inboundLagHistogram;
+  /** Trace of the lag of each event execution behind real time. */
+  TracedCallback<Time> m_eventLagTrace;
+  /** Trace of the time spent by each event in the inbound queue. */
+  TracedCallback<Time> m_inboundLagTrace;
+};
+
+} // namespace ns3
+
+#endif /* REALTIME_SIMULATOR_IMPL_H */
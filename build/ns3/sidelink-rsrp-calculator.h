@@ -0,0 +1,362 @@
+/* -*-  Mode: C++; c-file-style: "gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * NIST-developed software is provided by NIST as a public
+ * service. You may use, copy and distribute copies of the software in
+ * any medium, provided that you keep intact this entire notice. You
+ * may improve, modify and create derivative works of the software or
+ * any portion of the software, and you may copy and distribute such
+ * modifications or works. Modified works should carry a notice
+ * stating that you changed the software and should note the date and
+ * nature of any such change. Please explicitly acknowledge the
+ * National Institute of Standards and Technology as the source of the
+ * software.
+ *
+ * NIST-developed software is expressly provided "AS IS." NIST MAKES
+ * NO WARRANTY OF ANY KIND, EXPRESS, IMPLIED, IN FACT OR ARISING BY
+ * OPERATION OF LAW, INCLUDING, WITHOUT LIMITATION, THE IMPLIED
+ * WARRANTY OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE,
+ * NON-INFRINGEMENT AND DATA ACCURACY. NIST NEITHER REPRESENTS NOR
+ * WARRANTS THAT THE OPERATION OF THE SOFTWARE WILL BE UNINTERRUPTED
+ * OR ERROR-FREE, OR THAT ANY DEFECTS WILL BE CORRECTED. NIST DOES NOT
+ * WARRANT OR MAKE ANY REPRESENTATIONS REGARDING THE USE OF THE
+ * SOFTWARE OR THE RESULTS THEREOF, INCLUDING BUT NOT LIMITED TO THE
+ * CORRECTNESS, ACCURACY, RELIABILITY, OR USEFULNESS OF THE SOFTWARE.
+ *
+ * You are solely responsible for determining the appropriateness of
+ * using and distributing the software and you assume all risks
+ * associated with its use, including but not limited to the risks and
+ * costs of program errors, compliance with applicable laws, damage to
+ * or loss of data, programs or equipment, and the unavailability or
+ * interruption of operation. This software is not intended to be used
+ * in any situation where a failure could cause risk of injury or
+ * damage to property. The software developed by NIST employees is not
+ * subject to copyright protection within the United States.
+ */
+
+#ifndef SIDELINK_RSRP_CALCULATOR_H
+#define SIDELINK_RSRP_CALCULATOR_H
+
+#include <ns3/propagation-loss-model.h>
+#include <ns3/lte-spectrum-phy.h>
+#include <ns3/lte-spectrum-value-helper.h>
+#include <ns3/double.h>
+#include <ns3/pointer.h>
+#include <ns3/random-variable-stream.h>
+
+#include <functional>
+#include <vector>
+
+
+namespace ns3 {
+
+/**
+ * A dense matrix of S-RSRP values, in dBm, from a set of transmitter UEs to
+ * a set of receiver UEs. The values are stored in single precision, receiver
+ * by receiver, to keep large matrices compact.
+ */
+class SidelinkRsrpMatrix
+{
+public:
+  /**
+   * Create an empty matrix
+   */
+  SidelinkRsrpMatrix ();
+  /**
+   * Create a matrix
+   * \param nTx The number of transmitters
+   * \param nRx The number of receivers
+   */
+  SidelinkRsrpMatrix (uint32_t nTx, uint32_t nRx);
+
+  /**
+   * \return The number of transmitters
+   */
+  uint32_t GetNTx (void) const;
+  /**
+   * \return The number of receivers
+   */
+  uint32_t GetNRx (void) const;
+  /**
+   * Get the S-RSRP from a transmitter at a receiver
+   * \param tx The index of the transmitter
+   * \param rx The index of the receiver
+   * \return The S-RSRP in dBm
+   */
+  double Get (uint32_t tx, uint32_t rx) const;
+  /**
+   * Set the S-RSRP from a transmitter at a receiver
+   * \param tx The index of the transmitter
+   * \param rx The index of the receiver
+   * \param rsrp The S-RSRP in dBm
+   */
+  void Set (uint32_t tx, uint32_t rx, double rsrp);
+
+private:
+  uint32_t m_nTx; ///< The number of transmitters
+  uint32_t m_nRx; ///< The number of receivers
+  std::vector<float> m_values; ///< The S-RSRP values, receiver by receiver
+};
+
+/**
+ * An entry of a Sidelink neighbor table
+ */
+struct SidelinkRsrpNeighbor
+{
+  uint32_t index; ///< The index of the neighbor UE
+  double rsrp; ///< The S-RSRP of the neighbor UE, in dBm
+};
+
+/**
+ * The neighbors of each UE, see CalcSlRsrpPsbchNeighbors and CalcSlRsrpPsbchGraph
+ */
+typedef std::vector<std::vector<SidelinkRsrpNeighbor> > SidelinkRsrpNeighborTable;
+
+/**
+ * This class allows to compute Sidelink RSRP used to associate Sidelink UEs. This class implements
+ * both the methods defined in 3GPP TR 36.843 and TS 36.214.
+ */
+
+class SidelinkRsrpCalculator : public Object
+{
+public:
+  /**
+   * Constructor
+   */
+  SidelinkRsrpCalculator ();
+
+  /**
+   * Destructor
+   */
+  virtual ~SidelinkRsrpCalculator ();
+
+  // inherited from Object
+  /**
+   *  Register this type.
+   *  \return The object TypeId.
+   */
+  static TypeId GetTypeId (void);
+  virtual void DoDispose ();
+
+  /**
+   * Computes the S-RSRP between 2 UEs as defined in TS 36.214. Information about the uplink frequency and bandwidth is necessary to
+   * be able to call the function before the simulation starts.
+   * \param lossModel The loss model to use in the calculation
+   * \param txPower Transmit power for the reference signal
+   * \param ulEarfcn Uplink frequency
+   * \param ulBandwidth Uplink bandwidth
+   * \param txPhy The transmitter
+   * \param rxPhy The receiver
+   *
+   * \return RSRP value in dBm
+   */
+  static double CalcSlRsrpPsbch (Ptr<PropagationLossModel> lossModel, double txPower, double ulEarfcn, double ulBandwidth, Ptr<SpectrumPhy> txPhy, Ptr<SpectrumPhy> rxPhy);
+  /**
+   * Computes the S-RSRP between a transmitter UE and a receiver UE as defined in TR 36.843.
+   * \param lossModel The loss model to use in the calculation
+   * \param txPower Transmit power for the reference signal
+   * \param txPhy The transmitter
+   * \param rxPhy The receiver
+   *
+   * \return RSRP value in dBm
+   */
+  static double CalcSlRsrpTxPw (Ptr<PropagationLossModel> lossModel, double txPower, Ptr<SpectrumPhy> txPhy, Ptr<SpectrumPhy> rxPhy);
+
+  /**
+   * Computes the S-RSRP as defined in TS 36.214 (see CalcSlRsrpPsbch) from each transmitter to each receiver.
+   *
+   * When the loss model is a single FriisPropagationLossModel or LogDistancePropagationLossModel and the
+   * UEs have no antenna or an IsotropicAntennaModel, the path loss is evaluated in closed form with
+   * vectorized kernels, by several threads. Otherwise, the pairs are evaluated one by one through the
+   * loss model, by the calling thread only, as the loss models are not thread safe.
+   *
+   * \param lossModel The loss model to use in the calculation
+   * \param txPower Transmit power for the reference signal
+   * \param ulEarfcn Uplink frequency
+   * \param ulBandwidth Uplink bandwidth
+   * \param txPhys The transmitters
+   * \param rxPhys The receivers
+   * \param nThreads The maximum number of threads, or 0 to use all the hardware threads
+   *
+   * \return The matrix of the RSRP values in dBm
+   */
+  static SidelinkRsrpMatrix CalcSlRsrpPsbchMatrix (Ptr<PropagationLossModel> lossModel, double txPower, double ulEarfcn, double ulBandwidth,
+                                                   const std::vector<Ptr<SpectrumPhy> >& txPhys, const std::vector<Ptr<SpectrumPhy> >& rxPhys,
+                                                   uint32_t nThreads = 0);
+  /**
+   * Computes the S-RSRP as defined in TR 36.843 (see CalcSlRsrpTxPw) from each transmitter to each receiver.
+   * See CalcSlRsrpPsbchMatrix for the evaluation strategy.
+   *
+   * \param lossModel The loss model to use in the calculation
+   * \param txPower Transmit power for the reference signal
+   * \param txPhys The transmitters
+   * \param rxPhys The receivers
+   * \param nThreads The maximum number of threads, or 0 to use all the hardware threads
+   *
+   * \return The matrix of the RSRP values in dBm
+   */
+  static SidelinkRsrpMatrix CalcSlRsrpTxPwMatrix (Ptr<PropagationLossModel> lossModel, double txPower,
+                                                  const std::vector<Ptr<SpectrumPhy> >& txPhys, const std::vector<Ptr<SpectrumPhy> >& rxPhys,
+                                                  uint32_t nThreads = 0);
+  /**
+   * Computes, for each UE, the k other UEs received with the highest S-RSRP as defined in TS 36.214
+   * (see CalcSlRsrpPsbch), without storing the S-RSRP of all the pairs.
+   * See CalcSlRsrpPsbchMatrix for the evaluation strategy.
+   *
+   * \param lossModel The loss model to use in the calculation
+   * \param txPower Transmit power for the reference signal
+   * \param ulEarfcn Uplink frequency
+   * \param ulBandwidth Uplink bandwidth
+   * \param phys The UEs
+   * \param k The maximum number of neighbors of a UE
+   * \param nThreads The maximum number of threads, or 0 to use all the hardware threads
+   *
+   * \return The neighbors of each UE, indexed as the UEs
+   */
+  static SidelinkRsrpNeighborTable CalcSlRsrpPsbchNeighbors (Ptr<PropagationLossModel> lossModel, double txPower, double ulEarfcn, double ulBandwidth,
+                                                             const std::vector<Ptr<SpectrumPhy> >& phys, uint32_t k, uint32_t nThreads = 0);
+  /**
+   * Computes, for each UE, the k other UEs received with the highest S-RSRP as defined in TR 36.843
+   * (see CalcSlRsrpTxPw), without storing the S-RSRP of all the pairs.
+   * See CalcSlRsrpPsbchMatrix for the evaluation strategy.
+   *
+   * \param lossModel The loss model to use in the calculation
+   * \param txPower Transmit power for the reference signal
+   * \param phys The UEs
+   * \param k The maximum number of neighbors of a UE
+   * \param nThreads The maximum number of threads, or 0 to use all the hardware threads
+   *
+   * \return The neighbors of each UE, indexed as the UEs
+   */
+  static SidelinkRsrpNeighborTable CalcSlRsrpTxPwNeighbors (Ptr<PropagationLossModel> lossModel, double txPower,
+                                                            const std::vector<Ptr<SpectrumPhy> >& phys, uint32_t k, uint32_t nThreads = 0);
+
+  /**
+   * Computes the graph of the Sidelink links, i.e., for each transmitter, the receivers with an S-RSRP
+   * as defined in TS 36.214 (see CalcSlRsrpPsbch) greater than or equal to a threshold, without storing
+   * the S-RSRP of all the pairs. A transmitter is never linked to itself, i.e., when the same SpectrumPhy
+   * is in both sets. See CalcSlRsrpPsbchMatrix for the evaluation strategy.
+   *
+   * \param lossModel The loss model to use in the calculation
+   * \param txPower Transmit power for the reference signal
+   * \param ulEarfcn Uplink frequency
+   * \param ulBandwidth Uplink bandwidth
+   * \param txPhys The transmitters
+   * \param rxPhys The receivers
+   * \param rsrpThreshold The minimum S-RSRP of a link in dBm
+   * \param nThreads The maximum number of threads, or 0 to use all the hardware threads
+   *
+   * \return The receivers linked to each transmitter, indexed as the transmitters, by increasing receiver index
+   */
+  static SidelinkRsrpNeighborTable CalcSlRsrpPsbchGraph (Ptr<PropagationLossModel> lossModel, double txPower, double ulEarfcn, double ulBandwidth,
+                                                         const std::vector<Ptr<SpectrumPhy> >& txPhys, const std::vector<Ptr<SpectrumPhy> >& rxPhys,
+                                                         double rsrpThreshold, uint32_t nThreads = 0);
+  /**
+   * Computes the graph of the Sidelink links with the S-RSRP as defined in TR 36.843 (see CalcSlRsrpTxPw).
+   * See CalcSlRsrpPsbchGraph.
+   *
+   * \param lossModel The loss model to use in the calculation
+   * \param txPower Transmit power for the reference signal
+   * \param txPhys The transmitters
+   * \param rxPhys The receivers
+   * \param rsrpThreshold The minimum S-RSRP of a link in dBm
+   * \param nThreads The maximum number of threads, or 0 to use all the hardware threads
+   *
+   * \return The receivers linked to each transmitter, indexed as the transmitters, by increasing receiver index
+   */
+  static SidelinkRsrpNeighborTable CalcSlRsrpTxPwGraph (Ptr<PropagationLossModel> lossModel, double txPower,
+                                                        const std::vector<Ptr<SpectrumPhy> >& txPhys, const std::vector<Ptr<SpectrumPhy> >& rxPhys,
+                                                        double rsrpThreshold, uint32_t nThreads = 0);
+
+private:
+  /**
+   * Callback receiving the S-RSRP values of a receiver
+   * \param rx The index of the receiver
+   * \param rsrp The S-RSRP values in dBm, indexed as the transmitters
+   */
+  typedef std::function<void (uint32_t rx, const double *rsrp)> RsrpRowCallback;
+
+  /**
+   * Compute the reference signal power of the central RBs, used by CalcSlRsrpPsbch, i.e.,
+   * the S-RSRP in dBm without path loss
+   * \param txPower Transmit power for the reference signal
+   * \param ulEarfcn Uplink frequency
+   * \param ulBandwidth Uplink bandwidth
+   *
+   * \return The RSRP in dBm
+   */
+  static double CalcPsbchReferencePower (double txPower, double ulEarfcn, double ulBandwidth);
+
+  /**
+   * Compute the RSRP from all the transmitters at each receiver, the same way as the DoCalcRsrp
+   * function with a transmit power
+   * \param propagationLoss The loss model
+   * \param txPower The transmit power
+   * \param txPhys The transmitters
+   * \param rxPhys The receivers
+   * \param nThreads The maximum number of threads, or 0 to use all the hardware threads
+   * \param callback The callback receiving the RSRP values of each receiver, possibly from several threads
+   *        at the same time
+   */
+  static void DoCalcRsrpRows (Ptr<PropagationLossModel> propagationLoss, double txPower,
+                              const std::vector<Ptr<SpectrumPhy> >& txPhys, const std::vector<Ptr<SpectrumPhy> >& rxPhys,
+                              uint32_t nThreads, const RsrpRowCallback &callback);
+
+  /**
+   * Compute the neighbor table of a set of UEs
+   * \param propagationLoss The loss model
+   * \param txPower The transmit power
+   * \param phys The UEs
+   * \param k The maximum number of neighbors of a UE
+   * \param nThreads The maximum number of threads, or 0 to use all the hardware threads
+   *
+   * \return The neighbors of each UE
+   */
+  static SidelinkRsrpNeighborTable DoCalcNeighbors (Ptr<PropagationLossModel> propagationLoss, double txPower,
+                                                    const std::vector<Ptr<SpectrumPhy> >& phys, uint32_t k, uint32_t nThreads);
+
+  /**
+   * Compute the graph of the links of a set of transmitters and receivers
+   * \param propagationLoss The loss model
+   * \param txPower The transmit power
+   * \param txPhys The transmitters
+   * \param rxPhys The receivers
+   * \param rsrpThreshold The minimum RSRP of a link
+   * \param nThreads The maximum number of threads, or 0 to use all the hardware threads
+   *
+   * \return The receivers linked to each transmitter
+   */
+  static SidelinkRsrpNeighborTable DoCalcGraph (Ptr<PropagationLossModel> propagationLoss, double txPower,
+                                                const std::vector<Ptr<SpectrumPhy> >& txPhys, const std::vector<Ptr<SpectrumPhy> >& rxPhys,
+                                                double rsrpThreshold, uint32_t nThreads);
+
+  /**
+   * Compute the RSRP between the given nodes for the given propagation loss model (used by CalcSidelinkRsrp function)
+   * This code is derived from the multi-model-spectrum-channel class. It can be used for both uplink and downlink
+   * \param propagationLoss The loss model
+   * \param psd The power spectral density of the transmitter
+   * \param txPhy The transmitter
+   * \param rxPhy The receiver
+   *
+   * \return The RSRP in dBm
+   */
+  static double DoCalcRsrp (Ptr<PropagationLossModel> propagationLoss, Ptr<SpectrumValue> psd, Ptr<SpectrumPhy> txPhy, Ptr<SpectrumPhy> rxPhy);
+
+  /**
+   * Compute the RSRP between the given nodes for the given propagation loss model (used by CalcSidelinkRsrpEval function)
+   * This code is derived from the multi-model-spectrum-channel class. It can be used for both uplink and downlink
+   * \param propagationLoss The loss model
+   * \param txPower The transmit power
+   * \param txPhy The transmitter
+   * \param rxPhy The receiver
+   *
+   * \return The RSRP in dBm
+   */
+  static double DoCalcRsrp (Ptr<PropagationLossModel> propagationLoss, double txPower, Ptr<SpectrumPhy> txPhy, Ptr<SpectrumPhy> rxPhy);
+
+};
+
+
+} // namespace ns3
+
+
+#endif // SIDELINK_RSRP_CALCULATOR_H
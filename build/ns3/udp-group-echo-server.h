@@ -0,0 +1,201 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright 2007 University of Washington
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ * Modified by: NIST // Contributions may not be subject to US copyright.
+ *
+ * This application, authored by Fernando J. Cintron <fernando.cintron@nist.gov>
+ * is derived from udp-echo-server.h originally authored by University of Washington.
+ */
+
+#ifndef UDP_GROUP_ECHO_SERVER_H
+#define UDP_GROUP_ECHO_SERVER_H
+
+#include "ns3/application.h"
+#include "ns3/ptr.h"
+#include "ns3/address.h"
+#include "ns3/nstime.h"
+#include "ns3/traced-callback.h"
+#include <list>
+#include <string>
+#include <unordered_map>
+
+namespace ns3 {
+
+class Socket;
+class Packet;
+
+namespace psc {
+
+/**
+ * Structure to store information about the client
+ */
+struct UdpGroupEchoClient
+{
+  Address m_address; //!< The remote address of the client
+  Address m_echo_address; //!< The address where to send a response
+  Time m_timestamp; //!< Last time the server heard from the client
+};
+
+/**
+ * Key of a client of the UdpGroupEchoServer, i.e., its IP address and port
+ * packed in integers
+ */
+struct UdpGroupEchoClientKey
+{
+  uint64_t m_high; //!< The first 8 bytes of an IPv6 address, or 0
+  uint64_t m_low; //!< The last 8 bytes of an IPv6 address, or an IPv4 address
+  uint32_t m_port; //!< The port, with bit 16 set for an IPv6 address
+
+  /**
+   * Create the key of a client
+   * \param address The address of the client, an InetSocketAddress or an Inet6SocketAddress
+   * \return The key
+   */
+  static UdpGroupEchoClientKey FromAddress (const Address& address);
+  /**
+   * \param other The other key
+   * \return True if both keys are equal
+   */
+  bool operator== (const UdpGroupEchoClientKey& other) const;
+};
+
+/**
+ * Hash function of the UdpGroupEchoClientKey
+ */
+struct UdpGroupEchoClientKeyHash
+{
+  /**
+   * \param key The key
+   * \return The hash of the key
+   */
+  std::size_t operator() (const UdpGroupEchoClientKey& key) const;
+};
+
+/**
+ * \defgroup psc Public Safety Communications
+ */
+
+/**
+ * \ingroup psc
+ * \brief A Udp Group Echo server
+ *
+ * Every packet received is sent back to active group members.
+ *
+ * The clients are looked up in a hash table keyed by their address and
+ * port, and kept in a list ordered by the last time the server heard from
+ * them, so that the expired clients are removed from the front of the list
+ * when a packet is received, without checking every client.
+ */
+class UdpGroupEchoServer : public Application
+{
+public:
+  /**
+   * \brief Get the type ID.
+   * \return the object TypeId
+   */
+  static TypeId GetTypeId (void);
+
+  /**
+   * \brief Mode of echo operation
+   */
+  typedef enum
+  {
+    INF_SESSION,       /**<  Group echo with no session expiration time */
+    NO_GROUP_SESSION,  /**<  Server echoes single client only           */
+    TIMEOUT_LIMITED    /**<  Server forwards to group within timeout    */
+  } Mode_t;
+
+  UdpGroupEchoServer ();
+  virtual ~UdpGroupEchoServer ();
+  /**
+   * Adds a new client to the list of clients to echo messages
+   * \param client The new client address to add
+   */
+  virtual void AddClient (const Address& client);
+
+protected:
+  virtual void DoDispose (void);
+
+private:
+  virtual void StartApplication (void);
+  virtual void StopApplication (void);
+
+  /**
+   * \brief Handle a packet reception.
+   *
+   * This function is called by lower layers.
+   *
+   * \param socket the socket the packet was received to.
+   */
+  void HandleRead (Ptr<Socket> socket);
+  /**
+   * \brief Log client information.
+   *
+   * This function logs the number of clients and their session information.
+   * To log the output, at least NS_LOG_INFO must be enabled for this class.
+   *
+   */
+  void LogClients (void);
+  /**
+   * Add a client or update its timestamp, moving it to the back of the
+   * list of clients
+   * \param address The address of the client
+   * \return The key of the client
+   */
+  UdpGroupEchoClientKey UpdateClient (const Address& address);
+  /**
+   * Remove the clients whose session expired
+   */
+  void RemoveExpiredClients (void);
+  /**
+   * Send a packet to all the clients, in the order of the list
+   * \param socket The socket to use
+   * \param packet The packet
+   * \param skip The client to skip, if skipClient is true
+   * \param skipClient True to skip a client
+   */
+  void SendToClients (Ptr<Socket> socket, Ptr<Packet> packet, const UdpGroupEchoClientKey& skip, bool skipClient);
+  /**
+   * Send a packet to a client
+   * \param socket The socket to use
+   * \param packet The packet
+   * \param client The client
+   */
+  void SendToClient (Ptr<Socket> socket, Ptr<Packet> packet, const UdpGroupEchoClient& client);
+
+  /// The list of clients, ordered by timestamp
+  typedef std::list<std::pair<UdpGroupEchoClientKey, UdpGroupEchoClient> > ClientList;
+
+  Mode_t m_mode; ///< Mode of echo operation
+  uint16_t m_port; ///< Port on which we listen for incoming packets.
+  uint16_t m_port_client; ///< Port on which we echo packets to client.
+  Ptr<Socket> m_socket; ///< IPv4 Socket
+  Ptr<Socket> m_socket6; ///< IPv6 Socket
+  Address m_local; ///< local multicast address
+  ClientList m_clients; ///< Group of clients, the least recently heard first
+  std::unordered_map<UdpGroupEchoClientKey, ClientList::iterator, UdpGroupEchoClientKeyHash> m_clientIndex; ///< Clients by key
+  Time m_timeout; ///< Inactive client session expiration time
+  bool m_echoClient; ///< Set server to echo back to the client.
+  TracedCallback<Ptr<const Packet>, const Address &> m_rxTrace; ///< Callbacks for tracing the packet Rx events
+
+};
+
+} // namespace psc
+} // namespace ns3
+
+#endif /* UDP_GROUP_ECHO_SERVER_H */
+
@@ -0,0 +1,43 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef WIFI_SPECTRUM_SIGNAL_CODEC_H
+#define WIFI_SPECTRUM_SIGNAL_CODEC_H
+
+#include "ns3/distributed-spectrum-signal-codec.h"
+
+namespace ns3 {
+
+/**
+ * \ingroup wifi
+ *
+ * Codec of WifiSpectrumSignalParameters, sent by a
+ * DistributedSpectrumChannel to the receivers of other systems with the
+ * packet tags of their packet, such as the WifiPhyTag.  It is added to
+ * the channel when the wifi module is loaded.
+ */
+class WifiSpectrumSignalCodec : public DistributedSpectrumSignalCodec
+{
+public:
+  // inherited from DistributedSpectrumSignalCodec
+  virtual bool CanEncode (Ptr<const SpectrumSignalParameters> params) const;
+  virtual Ptr<Packet> Encode (Ptr<const SpectrumSignalParameters> params) const;
+  virtual Ptr<SpectrumSignalParameters> Decode (Ptr<Packet> p) const;
+};
+
+} // namespace ns3
+
+#endif /* WIFI_SPECTRUM_SIGNAL_CODEC_H */
@@ -127,6 +127,7 @@ BuildingListPriv::Add (Ptr<Building> building)
 {
   uint32_t index = m_buildings.size ();
   m_buildings.push_back (building);
+  Config::InvalidateCache ();
   Simulator::ScheduleWithContext (index, TimeStep (0), &Building::Initialize, building);
   return index;
 
@@ -190,4 +191,18 @@ BuildingList::GetNBuildings (void)
   return BuildingListPriv::Get ()->GetNBuildings ();
 }
 
+/**
+ * \ingroup buildings
+ * Register the BuildingList as a cached container of Config when the buildings
+ * module is loaded, since BuildingList::Add invalidates the Config cache.
+ */
+static class BuildingListCachedContainerInitializer
+{
+public:
+  BuildingListCachedContainerInitializer ()
+  {
+    Config::RegisterCachedContainer ("ns3::BuildingListPriv", "BuildingList");
+  }
+} g_buildingListCachedContainerInitializer; ///< the cached containers initializer
+
 } // namespace ns3
@@ -0,0 +1,340 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+// This program benchmarks the TypeId lookups by name, the Attribute and
+// TraceSource lookups by name, and Object::GetObject on aggregated
+// Objects.  Each lookup is compared with a reference implementation
+// using the public API only, which does what TypeId and Object did
+// before their lookups were indexed and cached: a std::map by name,
+// a linear scan of the Attributes and TraceSources up the parent chain,
+// and a linear scan of the aggregated Objects.
+// Sample usage:  ./waf --run 'bench-object-lookup --n=100000'
+
+#include "ns3/command-line.h"
+#include "ns3/system-wall-clock-ms.h"
+#include "ns3/object.h"
+#include "ns3/uinteger.h"
+#include "ns3/traced-value.h"
+#include "ns3/trace-source-accessor.h"
+#include <iostream>
+#include <iomanip>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <map>
+
+using namespace ns3;
+
+/// Number of Attributes and TraceSources of each benchmark Object class
+#define BENCH_N_MEMBERS 8
+
+/**
+ * Add the benchmark Attributes and TraceSources to a TypeId.  They all
+ * share the same member, only their names matter for the benchmark.
+ * \tparam T \deduced The class holding the members.
+ * \param [in] tid The TypeId.
+ * \param [in] prefix The prefix of the member names.
+ * \param [in] value The member of the Attributes.
+ * \param [in] traced The member of the TraceSources.
+ * \returns The TypeId.
+ */
+template <typename T>
+static TypeId
+AddBenchMembers (TypeId tid, std::string prefix,
+                 uint32_t T::*value, TracedValue<uint32_t> T::*traced)
+{
+  for (uint32_t i = 0; i < BENCH_N_MEMBERS; i++)
+    {
+      std::ostringstream oss;
+      oss << i;
+      tid.AddAttribute (prefix + "Value" + oss.str (), "A value.",
+                        UintegerValue (0),
+                        MakeUintegerAccessor (value),
+                        MakeUintegerChecker<uint32_t> ());
+      tid.AddTraceSource (prefix + "Traced" + oss.str (), "A traced value.",
+                          MakeTraceSourceAccessor (traced),
+                          "ns3::TracedValueCallback::Uint32");
+    }
+  return tid;
+}
+
+/// Base class of the benchmark Objects, with Attributes and TraceSources
+class BenchBase : public Object
+{
+public:
+  /**
+   * Register this type.
+   * \return The TypeId.
+   */
+  static TypeId GetTypeId (void);
+
+  uint32_t m_value; ///< Attribute value
+  TracedValue<uint32_t> m_traced; ///< TraceSource
+};
+
+TypeId
+BenchBase::GetTypeId (void)
+{
+  static TypeId tid = AddBenchMembers (TypeId ("ns3::BenchBase")
+                                       .SetParent<Object> ()
+                                       .SetGroupName ("Core"),
+                                       "Base", &BenchBase::m_value, &BenchBase::m_traced);
+  return tid;
+}
+
+/**
+ * Benchmark Object class, with Attributes and TraceSources of its own
+ * on top of those of BenchBase.
+ * \tparam N The class number, to get distinct aggregatable types.
+ */
+template <int N>
+class BenchObject : public BenchBase
+{
+public:
+  /**
+   * Register this type.
+   * \return The TypeId.
+   */
+  static TypeId GetTypeId (void);
+
+  uint32_t m_ownValue; ///< Attribute value
+  TracedValue<uint32_t> m_ownTraced; ///< TraceSource
+};
+
+template <int N>
+TypeId
+BenchObject<N>::GetTypeId (void)
+{
+  std::ostringstream name;
+  name << "ns3::BenchObject<" << N << ">";
+  static TypeId tid = AddBenchMembers (TypeId (name.str ().c_str ())
+                                       .SetParent<BenchBase> ()
+                                       .SetGroupName ("Core"),
+                                       "", &BenchObject<N>::m_ownValue, &BenchObject<N>::m_ownTraced);
+  return tid;
+}
+
+/**
+ * Reference Attribute lookup: linear scan up the parent chain.
+ * \param [in] tid The TypeId.
+ * \param [in] name The Attribute name.
+ * \param [out] info The Attribute information.
+ * \returns \c true if the Attribute was found.
+ */
+static bool
+ReferenceLookupAttribute (TypeId tid, std::string name, struct TypeId::AttributeInformation *info)
+{
+  TypeId nextTid = tid;
+  do {
+      tid = nextTid;
+      for (std::size_t i = 0; i < tid.GetAttributeN (); i++)
+        {
+          struct TypeId::AttributeInformation tmp = tid.GetAttribute (i);
+          if (tmp.name == name)
+            {
+              *info = tmp;
+              return true;
+            }
+        }
+      nextTid = tid.GetParent ();
+    } while (nextTid != tid);
+  return false;
+}
+
+/**
+ * Reference TraceSource lookup: linear scan up the parent chain.
+ * \param [in] tid The TypeId.
+ * \param [in] name The TraceSource name.
+ * \param [out] info The TraceSource information.
+ * \returns The TraceSource accessor, or 0 if it was not found.
+ */
+static Ptr<const TraceSourceAccessor>
+ReferenceLookupTraceSource (TypeId tid, std::string name, struct TypeId::TraceSourceInformation *info)
+{
+  TypeId nextTid = tid;
+  do {
+      tid = nextTid;
+      for (std::size_t i = 0; i < tid.GetTraceSourceN (); i++)
+        {
+          struct TypeId::TraceSourceInformation tmp = tid.GetTraceSource (i);
+          if (tmp.name == name)
+            {
+              *info = tmp;
+              return tmp.accessor;
+            }
+        }
+      nextTid = tid.GetParent ();
+    } while (nextTid != tid);
+  return 0;
+}
+
+/**
+ * Reference GetObject: linear scan of the aggregated Objects.
+ * \param [in] object The Object.
+ * \param [in] tid The TypeId to look for.
+ * \returns The aggregated Object, or 0 if there is none.
+ */
+static Ptr<const Object>
+ReferenceGetObject (Ptr<const Object> object, TypeId tid)
+{
+  TypeId objectTid = Object::GetTypeId ();
+  Object::AggregateIterator it = object->GetAggregateIterator ();
+  while (it.HasNext ())
+    {
+      Ptr<const Object> current = it.Next ();
+      TypeId cur = current->GetInstanceTypeId ();
+      while (cur != tid && cur != objectTid)
+        {
+          cur = cur.GetParent ();
+        }
+      if (cur == tid)
+        {
+          return current;
+        }
+    }
+  return 0;
+}
+
+/**
+ * Print the result of a benchmark.
+ * \param [in] name The name of the lookup.
+ * \param [in] n The number of lookups.
+ * \param [in] indexedMs The time of the indexed lookups.
+ * \param [in] referenceMs The time of the reference lookups.
+ */
+static void
+PrintResult (std::string name, uint64_t n, int64_t indexedMs, int64_t referenceMs)
+{
+  std::cout << std::left << std::setw (24) << name << std::right
+            << " n=" << n
+            << " indexed=" << indexedMs << "ms"
+            << " reference=" << referenceMs << "ms";
+  if (indexedMs > 0)
+    {
+      std::cout << " speedup=" << std::fixed << std::setprecision (1)
+                << static_cast<double> (referenceMs) / indexedMs << "x";
+    }
+  std::cout << std::endl;
+}
+
+int main (int argc, char *argv[])
+{
+  uint32_t n = 100000;
+
+  CommandLine cmd;
+  cmd.Usage ("Benchmark the TypeId, Attribute, TraceSource and aggregated Object lookups");
+  cmd.AddValue ("n", "number of iterations", n);
+  cmd.Parse (argc, argv);
+
+  std::vector<TypeId> tids;
+  tids.push_back (BenchObject<0>::GetTypeId ());
+  tids.push_back (BenchObject<1>::GetTypeId ());
+  tids.push_back (BenchObject<2>::GetTypeId ());
+  tids.push_back (BenchObject<3>::GetTypeId ());
+
+  // TypeId lookup by name, against a std::map of all the registered names
+  std::vector<std::string> names;
+  std::map<std::string, uint16_t> nameMap;
+  for (uint16_t i = 0; i < TypeId::GetRegisteredN (); i++)
+    {
+      TypeId tid = TypeId::GetRegistered (i);
+      names.push_back (tid.GetName ());
+      nameMap[tid.GetName ()] = tid.GetUid ();
+    }
+  uint64_t checksum = 0;
+  SystemWallClockMs time;
+  time.Start ();
+  for (uint32_t i = 0; i < n; i++)
+    {
+      checksum += TypeId::LookupByName (names[i % names.size ()]).GetUid ();
+    }
+  int64_t indexedMs = time.End ();
+  time.Start ();
+  for (uint32_t i = 0; i < n; i++)
+    {
+      checksum -= nameMap.find (names[i % names.size ()])->second;
+    }
+  PrintResult ("TypeId::LookupByName", n, indexedMs, time.End ());
+
+  // Attribute lookup by name, half of them in the parent TypeId
+  std::vector<std::string> attributes;
+  std::vector<std::string> traceSources;
+  for (uint32_t i = 0; i < BENCH_N_MEMBERS; i++)
+    {
+      std::ostringstream oss;
+      oss << i;
+      attributes.push_back ("Value" + oss.str ());
+      attributes.push_back ("BaseValue" + oss.str ());
+      traceSources.push_back ("Traced" + oss.str ());
+      traceSources.push_back ("BaseTraced" + oss.str ());
+    }
+  struct TypeId::AttributeInformation attributeInfo;
+  time.Start ();
+  for (uint32_t i = 0; i < n; i++)
+    {
+      checksum += tids[i % tids.size ()].LookupAttributeByName (attributes[i % attributes.size ()], &attributeInfo);
+    }
+  indexedMs = time.End ();
+  time.Start ();
+  for (uint32_t i = 0; i < n; i++)
+    {
+      checksum -= ReferenceLookupAttribute (tids[i % tids.size ()], attributes[i % attributes.size ()], &attributeInfo);
+    }
+  PrintResult ("LookupAttributeByName", n, indexedMs, time.End ());
+
+  // TraceSource lookup by name, half of them in the parent TypeId
+  struct TypeId::TraceSourceInformation traceSourceInfo;
+  time.Start ();
+  for (uint32_t i = 0; i < n; i++)
+    {
+      checksum += (tids[i % tids.size ()].LookupTraceSourceByName (traceSources[i % traceSources.size ()], &traceSourceInfo) != 0);
+    }
+  indexedMs = time.End ();
+  time.Start ();
+  for (uint32_t i = 0; i < n; i++)
+    {
+      checksum -= (ReferenceLookupTraceSource (tids[i % tids.size ()], traceSources[i % traceSources.size ()], &traceSourceInfo) != 0);
+    }
+  PrintResult ("LookupTraceSourceByName", n, indexedMs, time.End ());
+
+  // GetObject of the Objects aggregated to another one, by a base
+  // class so that the dynamic_cast shortcut of GetObject fails
+  Ptr<Object> object = CreateObject<Object> ();
+  object->AggregateObject (CreateObject<BenchObject<0> > ());
+  object->AggregateObject (CreateObject<BenchObject<1> > ());
+  object->AggregateObject (CreateObject<BenchObject<2> > ());
+  object->AggregateObject (CreateObject<BenchObject<3> > ());
+  time.Start ();
+  for (uint32_t i = 0; i < n; i++)
+    {
+      checksum += (object->GetObject<Object> (tids[i % tids.size ()]) != 0);
+    }
+  indexedMs = time.End ();
+  time.Start ();
+  for (uint32_t i = 0; i < n; i++)
+    {
+      checksum -= (ReferenceGetObject (object, tids[i % tids.size ()]) != 0);
+    }
+  PrintResult ("GetObject", n, indexedMs, time.End ());
+  object->Dispose ();
+
+  if (checksum != 0)
+    {
+      std::cerr << "The indexed and reference lookups differ" << std::endl;
+      return 1;
+    }
+  return 0;
+}
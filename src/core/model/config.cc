@@ -27,6 +27,9 @@
 #include "log.h"
 
 #include <sstream>
+#include <atomic>
+#include <map>
+#include <set>
 
 /**
  * \file
@@ -40,6 +43,34 @@ NS_LOG_COMPONENT_DEFINE ("Config");
 
 namespace Config {
 
+/**
+ * \ingroup config-impl
+ * The number of calls to Config::InvalidateCache.
+ *
+ * This is a global rather than a member of ConfigImpl, so that objects
+ * can be aggregated and disposed at any time, even while the ConfigImpl
+ * singleton is constructed or destroyed.  It is atomic since the threads
+ * of the multithreaded simulator may change the objects concurrently.
+ */
+static std::atomic<uint64_t> g_cacheGeneration (0);
+
+/**
+ * \ingroup config-impl
+ * The ObjectPtrContainer Attributes registered with
+ * Config::RegisterCachedContainer, as (TypeId name, Attribute name) pairs.
+ *
+ * This is a function static, so that the containers can be registered
+ * by static initializers in any order.
+ *
+ * \returns The registered containers.
+ */
+static std::set<std::pair<std::string, std::string> > &
+GetCachedContainers (void)
+{
+  static std::set<std::pair<std::string, std::string> > containers;
+  return containers;
+}
+
 MatchContainer::MatchContainer ()
 {
   NS_LOG_FUNCTION (this);
@@ -150,6 +181,9 @@ MatchContainer::DisconnectWithoutContext (std::string name, const CallbackBase &
 /**
  * \ingroup config-impl
  * Helper to test if an array entry matches a config path specification.
+ *
+ * The specification is parsed once, when the matcher is constructed,
+ * into a set of index ranges.
  */
 class ArrayMatcher
 {
@@ -168,6 +202,12 @@ public:
    */
   bool Matches (std::size_t i) const;
 private:
+  /**
+   * Parse a Config path specification, or one of its '|' alternatives.
+   *
+   * \param [in] element The Config path specification.
+   */
+  void Parse (std::string element);
   /**
    * Convert a string to an \c uint32_t.
    *
@@ -176,78 +216,79 @@ private:
    * \returns \c true if the string could be converted.
    */
   bool StringToUint32 (std::string str, uint32_t *value) const;
-  /** The Config path element. */
-  std::string m_element;
+  /** Whether the Config path element is the '*' wildcard. */
+  bool m_any;
+  /** The closed ranges of the indices matching the Config path element. */
+  std::vector<std::pair<uint32_t, uint32_t> > m_ranges;
 
 };  // class ArrayMatcher
 
 
 ArrayMatcher::ArrayMatcher (std::string element)
-  : m_element (element)
+  : m_any (false)
 {
   NS_LOG_FUNCTION (this << element);
+  Parse (element);
 }
-bool
-ArrayMatcher::Matches (std::size_t i) const
+void
+ArrayMatcher::Parse (std::string element)
 {
-  NS_LOG_FUNCTION (this << i);
-  if (m_element == "*")
+  NS_LOG_FUNCTION (this << element);
+  if (element == "*")
     {
-      NS_LOG_DEBUG ("Array "<<i<<" matches *");
-      return true;
+      m_any = true;
+      return;
     }
   std::string::size_type tmp;
-  tmp = m_element.find ("|");
+  tmp = element.find ("|");
   if (tmp != std::string::npos)
     {
-      std::string left = m_element.substr (0, tmp-0);
-      std::string right = m_element.substr (tmp+1, m_element.size () - (tmp + 1));
-      ArrayMatcher matcher = ArrayMatcher (left);
-      if (matcher.Matches (i))
-        {
-          NS_LOG_DEBUG ("Array "<<i<<" matches "<<left);
-          return true;
-        }
-      matcher = ArrayMatcher (right);
-      if (matcher.Matches (i))
-        {
-          NS_LOG_DEBUG ("Array "<<i<<" matches "<<right);
-          return true;
-        }
-      NS_LOG_DEBUG ("Array "<<i<<" does not match "<<m_element);
-      return false;
+      Parse (element.substr (0, tmp));
+      Parse (element.substr (tmp + 1, element.size () - (tmp + 1)));
+      return;
     }
-  std::string::size_type leftBracket = m_element.find ("[");
-  std::string::size_type rightBracket = m_element.find ("]");
-  std::string::size_type dash = m_element.find ("-");
-  if (leftBracket == 0 && rightBracket == m_element.size () - 1 &&
+  std::string::size_type leftBracket = element.find ("[");
+  std::string::size_type rightBracket = element.find ("]");
+  std::string::size_type dash = element.find ("-");
+  if (leftBracket == 0 && rightBracket == element.size () - 1 &&
       dash > leftBracket && dash < rightBracket)
     {
-      std::string lowerBound = m_element.substr (leftBracket + 1, dash - (leftBracket + 1));
-      std::string upperBound = m_element.substr (dash + 1, rightBracket - (dash + 1));
+      std::string lowerBound = element.substr (leftBracket + 1, dash - (leftBracket + 1));
+      std::string upperBound = element.substr (dash + 1, rightBracket - (dash + 1));
       uint32_t min;
       uint32_t max;
-      if (StringToUint32 (lowerBound, &min) && 
-          StringToUint32 (upperBound, &max) &&
-          i >= min && i <= max)
+      if (StringToUint32 (lowerBound, &min) &&
+          StringToUint32 (upperBound, &max))
         {
-          NS_LOG_DEBUG ("Array "<<i<<" matches "<<m_element);
-          return true;
-        }
-      else
-        {
-          NS_LOG_DEBUG ("Array "<<i<<" does not "<<m_element);
-          return false;
+          m_ranges.push_back (std::make_pair (min, max));
         }
+      return;
     }
   uint32_t value;
-  if (StringToUint32 (m_element, &value) &&
-      i == value)
+  if (StringToUint32 (element, &value))
+    {
+      m_ranges.push_back (std::make_pair (value, value));
+    }
+}
+bool
+ArrayMatcher::Matches (std::size_t i) const
+{
+  NS_LOG_FUNCTION (this << i);
+  if (m_any)
     {
-      NS_LOG_DEBUG ("Array "<<i<<" matches "<<m_element);
+      NS_LOG_DEBUG ("Array "<<i<<" matches *");
       return true;
     }
-  NS_LOG_DEBUG ("Array "<<i<<" does not match "<<m_element);
+  for (std::vector<std::pair<uint32_t, uint32_t> >::const_iterator range = m_ranges.begin ();
+       range != m_ranges.end (); ++range)
+    {
+      if (i >= range->first && i <= range->second)
+        {
+          NS_LOG_DEBUG ("Array "<<i<<" matches ["<<range->first<<"-"<<range->second<<"]");
+          return true;
+        }
+    }
+  NS_LOG_DEBUG ("Array "<<i<<" does not match");
   return false;
 }
 
@@ -263,47 +304,104 @@ ArrayMatcher::StringToUint32 (std::string str, uint32_t *value) const
 
 /**
  * \ingroup config-impl
- * Abstract class to parse Config paths into object references.
+ * Parse Config paths into object references.
+ *
+ * The Config path is split into its elements once, when the resolver is
+ * constructed, so that resolving it against many objects, e.g., against
+ * each device of each node when the NodeList and DeviceList indices are
+ * wildcards, only compares indices, and looks up the Attributes matching
+ * an element once per TypeId.
+ *
+ * The objects matched by a prefix of the path ending with a wildcard
+ * element ('*', '|' or '[x-y]') can be kept in a cache, so that the paths
+ * sharing this prefix resume from these objects.
  */
 class Resolver
 {
 public:
+  /** An object matched by a Config path, or by one of its prefixes. */
+  struct Match
+  {
+    Ptr<Object> object;  //!< The matched object.
+    std::string path;    //!< The matching Config path, with a trailing '/'.
+  };
+  /** Container type to hold the matched objects, in resolution order. */
+  typedef std::vector<Match> Matches;
+  /** Container type to hold the objects matched by Config path prefixes. */
+  typedef std::map<std::string, Matches> Cache;
+
   /**
    * Construct from a base Config path.
    *
    * \param [in] path The Config path.
    */
   Resolver (std::string path);
-  /** Destructor. */
-  virtual ~Resolver ();
 
   /**
-   * Parse the stored Config path into an object reference,
+   * Parse the stored Config path into object references,
    * beginning at the indicated root object.
    *
    * \param [in] root The object corresponding to the current position in
-   *                  in the Config path.
+   *                  in the Config path, or 0 to begin at the root of the
+   *                  "/Names" name space.
+   * \param [in,out] cache The objects matched by the prefixes of the
+   *                  Config path beginning at \p root, or 0 for no cache.
+   * \param [in,out] matches The list to append the matching objects to.
    */
-  void Resolve (Ptr<Object> root);
-  
+  void Resolve (Ptr<Object> root, Cache *cache, Matches *matches);
+
 private:
+  /** An Attribute which can lead to other objects. */
+  struct Member
+  {
+    std::string name;  //!< The Attribute name.
+    bool container;    //!< \c true for an ObjectPtrContainer Attribute, \c false for a Pointer one.
+    bool cached;       //!< Whether the objects matched through the Attribute can be cached.
+  };
+  /** An element of the Config path. */
+  struct Element
+  {
+    /**
+     * Constructor.
+     * \param [in] element The element.
+     */
+    Element (std::string element);
+    std::string item;        //!< The element.
+    ArrayMatcher matcher;    //!< The element, as an index specification.
+    bool getObject;          //!< Whether the element is a call to GetObject.
+    bool fanOut;             //!< Whether the element can match several indices or Attributes.
+    TypeId tid;              //!< The TypeId of a GetObject element, once looked up.
+    bool tidValid;           //!< Whether \c tid was looked up.
+    /** The Attributes matching the element, by uid of the object TypeId. */
+    std::map<uint16_t, std::vector<Member> > members;
+  };
+
   /** Ensure the Config path starts and ends with a '/'. */
   void Canonicalize (void);
+  /**
+   * Resolve part of the Config path from the given objects.
+   *
+   * \param [in] from The objects matched by the first \p level elements.
+   * \param [in] level The number of elements matched by \p from.
+   * \param [in] stop The number of elements to match.
+   * \param [in,out] matches The list to append the matching objects to.
+   */
+  void DoResolveFrom (const Matches &from, std::size_t level, std::size_t stop, Matches *matches);
   /**
    * Parse the next element in the Config path.
    *
-   * \param [in] path The remaining portion of the Config path.
+   * \param [in] level The index of the next element.
    * \param [in] root The object corresponding to the current position
    *                  in the Config path.
    */
-  void DoResolve (std::string path, Ptr<Object> root);
+  void DoResolve (std::size_t level, Ptr<Object> root);
   /**
    * Parse an index on the Config path.
    *
-   * \param [in] path The remaining Config path.
-   * \param [in,out] vector The resulting list of matching objects.
+   * \param [in] level The index of the element holding the index.
+   * \param [in,out] container The objects indexed by the element.
    */
-  void DoArrayResolve (std::string path, const ObjectPtrContainerValue &vector);
+  void DoArrayResolve (std::size_t level, const ObjectPtrContainerValue &container);
   /**
    * Handle one object found on the path.
    *
@@ -311,35 +409,75 @@ private:
    */
   void DoResolveOne (Ptr<Object> object);
   /**
-   * Get the current Config path.
+   * Get the Pointer and ObjectPtrContainer Attributes matching an element.
    *
-   * \returns The current Config path.
+   * \param [in,out] element The element.
+   * \param [in] tid The TypeId of the object.
+   * \returns The matching Attributes of \p tid and of its parents.
    */
-  std::string GetResolvedPath (void) const;
+  const std::vector<Member> & GetMembers (Element &element, TypeId tid) const;
   /**
-   * Handle one found object.
+   * Push an element on the current Config path.
    *
-   * \param [in] object The found object.
-   * \param [in] path The matching Config path context.
+   * \param [in] item The element.
+   * \returns The size of the current Config path before the element.
    */
-  virtual void DoOne (Ptr<Object> object, std::string path) = 0;
+  std::string::size_type Push (const std::string &item);
 
-  /** Current list of path tokens. */
-  std::vector<std::string> m_workStack;
   /** The Config path. */
   std::string m_path;
+  /** The elements of the Config path. */
+  std::vector<Element> m_elements;
+  /** The Config path up to each element, with a trailing '/'. */
+  std::vector<std::string> m_prefixes;
+  /** The current Config path. */
+  std::string m_resolvedPath;
+  /** The number of elements to match in the current resolution. */
+  std::size_t m_stop;
+  /** The objects matched by the current resolution. */
+  Matches *m_matches;
+  /**
+   * Whether the current resolution reached its last element in the
+   * middle of an ObjectPtrContainer, i.e., did not match objects.
+   */
+  bool m_incomplete;
+  /**
+   * Whether the current resolution went through an ObjectPtrContainer
+   * not registered with Config::RegisterCachedContainer.
+   */
+  bool m_uncached;
 
 };  // class Resolver
 
+Resolver::Element::Element (std::string element)
+  : item (element),
+    matcher (element),
+    getObject (element.find ("$") == 0),
+    fanOut (element == "*" || element.find_first_of ("|[") != std::string::npos),
+    tidValid (false)
+{
+}
+
 Resolver::Resolver (std::string path)
-  : m_path (path)
+  : m_path (path),
+    m_stop (0),
+    m_matches (0),
+    m_incomplete (false),
+    m_uncached (false)
 {
   NS_LOG_FUNCTION (this << path);
   Canonicalize ();
-}
-Resolver::~Resolver ()
-{
-  NS_LOG_FUNCTION (this);
+
+  std::string::size_type cur = 0;
+  std::string::size_type next = m_path.find ("/", 1);
+  m_prefixes.push_back ("/");
+  while (next != std::string::npos)
+    {
+      m_elements.push_back (Element (m_path.substr (cur + 1, next - (cur + 1))));
+      m_prefixes.push_back (m_path.substr (0, next + 1));
+      cur = next;
+      next = m_path.find ("/", cur + 1);
+    }
 }
 void
 Resolver::Canonicalize (void)
@@ -362,24 +500,87 @@ Resolver::Canonicalize (void)
 }
 
 void 
-Resolver::Resolve (Ptr<Object> root)
+Resolver::Resolve (Ptr<Object> root, Cache *cache, Matches *matches)
 {
-  NS_LOG_FUNCTION (this << root);
+  NS_LOG_FUNCTION (this << root << cache << matches);
 
-  DoResolve (m_path, root);
+  // The cache must not grow with the number of distinct paths,
+  // e.g., one per node index.
+  static const std::size_t maxCacheSize = 32;
+
+  Matches current;
+  Match start = {root, "/"};
+  current.push_back (start);
+  std::size_t level = 0;
+  if (root != 0 && cache != 0)
+    {
+      // Resume from the longest cached prefix, and cache the objects
+      // matched by each of the next prefixes ending with a wildcard.
+      for (std::size_t k = m_elements.size (); k > 0; k--)
+        {
+          Cache::const_iterator it = cache->find (m_prefixes[k]);
+          if (m_elements[k - 1].fanOut && it != cache->end ())
+            {
+              NS_LOG_DEBUG ("Resume from cached path=" << m_prefixes[k]);
+              current = it->second;
+              level = k;
+              break;
+            }
+        }
+      for (std::size_t k = level + 1; k <= m_elements.size (); k++)
+        {
+          if (!m_elements[k - 1].fanOut)
+            {
+              continue;
+            }
+          Matches next;
+          DoResolveFrom (current, level, k, &next);
+          if (m_incomplete)
+            {
+              // The prefix ends with a wildcard Attribute name matching
+              // an ObjectPtrContainer, not with objects.
+              break;
+            }
+          current.swap (next);
+          level = k;
+          if (m_uncached)
+            {
+              // The objects of the prefix, and of the longer prefixes,
+              // may change without invalidating the cache.
+              break;
+            }
+          if (cache->size () >= maxCacheSize)
+            {
+              cache->clear ();
+            }
+          (*cache)[m_prefixes[k]] = current;
+        }
+    }
+  DoResolveFrom (current, level, m_elements.size (), matches);
 }
 
-std::string
-Resolver::GetResolvedPath (void) const
+void
+Resolver::DoResolveFrom (const Matches &from, std::size_t level, std::size_t stop, Matches *matches)
 {
-  NS_LOG_FUNCTION (this);
-
-  std::string fullPath = "/";
-  for (std::vector<std::string>::const_iterator i = m_workStack.begin (); i != m_workStack.end (); i++)
+  NS_LOG_FUNCTION (this << &from << level << stop << matches);
+  m_stop = stop;
+  m_matches = matches;
+  m_incomplete = false;
+  m_uncached = false;
+  for (Matches::const_iterator i = from.begin (); i != from.end (); i++)
     {
-      fullPath += *i + "/";
+      m_resolvedPath = i->path;
+      DoResolve (level, i->object);
     }
-  return fullPath;
+}
+
+std::string::size_type
+Resolver::Push (const std::string &item)
+{
+  std::string::size_type size = m_resolvedPath.size ();
+  m_resolvedPath += item;
+  m_resolvedPath += '/';
+  return size;
 }
 
 void 
@@ -387,18 +588,62 @@ Resolver::DoResolveOne (Ptr<Object> object)
 {
   NS_LOG_FUNCTION (this << object);
 
-  NS_LOG_DEBUG ("resolved="<<GetResolvedPath ());
-  DoOne (object, GetResolvedPath ());
+  NS_LOG_DEBUG ("resolved="<<m_resolvedPath);
+  Match match = {object, m_resolvedPath};
+  m_matches->push_back (match);
+}
+
+const std::vector<Resolver::Member> &
+Resolver::GetMembers (Element &element, TypeId tid) const
+{
+  NS_LOG_FUNCTION (this << element.item << tid);
+  std::map<uint16_t, std::vector<Member> >::const_iterator found = element.members.find (tid.GetUid ());
+  if (found != element.members.end ())
+    {
+      return found->second;
+    }
+  std::vector<Member> &members = element.members[tid.GetUid ()];
+  TypeId nextTid = tid;
+  do
+    {
+      tid = nextTid;
+
+      for (uint32_t i = 0; i < tid.GetAttributeN (); i++)
+        {
+          struct TypeId::AttributeInformation info;
+          info = tid.GetAttribute (i);
+          if (info.name != element.item && element.item != "*")
+            {
+              continue;
+            }
+          // attempt to cast to a pointer checker.
+          if (dynamic_cast<const PointerChecker *> (PeekPointer (info.checker)) != 0)
+            {
+              Member member = {info.name, false, true};
+              members.push_back (member);
+            }
+          // attempt to cast to an object vector.
+          if (dynamic_cast<const ObjectPtrContainerChecker *> (PeekPointer (info.checker)) != 0)
+            {
+              bool cached = GetCachedContainers ().count (std::make_pair (tid.GetName (), info.name)) != 0;
+              Member member = {info.name, true, cached};
+              members.push_back (member);
+            }
+          // this could be anything else and we don't know what to do with it.
+          // So, we just ignore it.
+        }
+
+      nextTid = tid.GetParent ();
+    } while (nextTid != tid);
+  return members;
 }
 
 void
-Resolver::DoResolve (std::string path, Ptr<Object> root)
+Resolver::DoResolve (std::size_t level, Ptr<Object> root)
 {
-  NS_LOG_FUNCTION (this << path << root);
-  NS_ASSERT ((path.find ("/")) == 0);
-  std::string::size_type next = path.find ("/", 1);
+  NS_LOG_FUNCTION (this << level << root);
 
-  if (next == std::string::npos)
+  if (level == m_stop)
     {
       //
       // If root is zero, we're beginning to see if we can use the object name 
@@ -414,8 +659,8 @@ Resolver::DoResolve (std::string path, Ptr<Object> root)
         }
       return;
     }
-  std::string item = path.substr (1, next-1);
-  std::string pathLeft = path.substr (next, path.size ()-next);
+  Element &element = m_elements[level];
+  const std::string &item = element.item;
 
   //
   // If root is zero, we're beginning to see if we can use the object name 
@@ -426,12 +671,11 @@ Resolver::DoResolve (std::string path, Ptr<Object> root)
   //
   if (root == 0)
     {
-      std::string::size_type offset = path.find ("/Names");
-      if (offset == 0)
+      if (item.compare (0, 5, "Names") == 0)
         {
-          m_workStack.push_back (item);
-          DoResolve (pathLeft, root);
-          m_workStack.pop_back ();
+          std::string::size_type size = Push (item);
+          DoResolve (level + 1, root);
+          m_resolvedPath.resize (size);
           return;
         }
     }
@@ -446,9 +690,9 @@ Resolver::DoResolve (std::string path, Ptr<Object> root)
   if (namedObject)
     {
       NS_LOG_DEBUG ("Name system resolved item = " << item << " to " << namedObject);
-      m_workStack.push_back (item);
-      DoResolve (pathLeft, namedObject);
-      m_workStack.pop_back ();
+      std::string::size_type size = Push (item);
+      DoResolve (level + 1, namedObject);
+      m_resolvedPath.resize (size);
       return;
     }
 
@@ -463,105 +707,82 @@ Resolver::DoResolve (std::string path, Ptr<Object> root)
     {
       return;
     }
-  std::string::size_type dollarPos = item.find ("$");
-  if (dollarPos == 0)
+  if (element.getObject)
     {
       // This is a call to GetObject
-      std::string tidString = item.substr (1, item.size () - 1);
-      NS_LOG_DEBUG ("GetObject="<<tidString<<" on path="<<GetResolvedPath ());
-      TypeId tid = TypeId::LookupByName (tidString);
-      Ptr<Object> object = root->GetObject<Object> (tid);
+      NS_LOG_DEBUG ("GetObject="<<item.substr (1)<<" on path="<<m_resolvedPath);
+      if (!element.tidValid)
+        {
+          element.tid = TypeId::LookupByName (item.substr (1));
+          element.tidValid = true;
+        }
+      Ptr<Object> object = root->GetObject<Object> (element.tid);
       if (object == 0)
         {
-          NS_LOG_DEBUG ("GetObject ("<<tidString<<") failed on path="<<GetResolvedPath ());
+          NS_LOG_DEBUG ("GetObject ("<<item.substr (1)<<") failed on path="<<m_resolvedPath);
           return;
         }
-      m_workStack.push_back (item);
-      DoResolve (pathLeft, object);
-      m_workStack.pop_back ();
+      std::string::size_type size = Push (item);
+      DoResolve (level + 1, object);
+      m_resolvedPath.resize (size);
     }
   else 
     {
       // this is a normal attribute.
-      TypeId tid;
-      TypeId nextTid = root->GetInstanceTypeId ();
-      bool foundMatch = false;
-      
-      do
+      const std::vector<Member> &members = GetMembers (element, root->GetInstanceTypeId ());
+      if (members.empty ())
         {
-          tid = nextTid;
-          
-          for (uint32_t i = 0; i < tid.GetAttributeN(); i++)
+          NS_LOG_DEBUG ("Requested item="<<item<<" does not exist on path="<<m_resolvedPath);
+          return;
+        }
+      for (std::vector<Member>::const_iterator i = members.begin (); i != members.end (); i++)
+        {
+          if (!i->container)
             {
-              struct TypeId::AttributeInformation info;
-              info = tid.GetAttribute(i);
-              if (info.name != item && item != "*")
+              NS_LOG_DEBUG ("GetAttribute(ptr)="<<i->name<<" on path="<<m_resolvedPath);
+              PointerValue pValue;
+              root->GetAttribute (i->name, pValue);
+              Ptr<Object> object = pValue.Get<Object> ();
+              if (object == 0)
                 {
+                  NS_LOG_ERROR ("Requested object name=\""<<item<<
+                                "\" exists on path=\""<<m_resolvedPath<<"\""
+                                " but is null.");
                   continue;
                 }
-              // attempt to cast to a pointer checker.
-              const PointerChecker *pChecker = dynamic_cast<const PointerChecker *> (PeekPointer(info.checker));
-              if (pChecker != 0)
-                {
-                  NS_LOG_DEBUG ("GetAttribute(ptr)="<<info.name<<" on path="<<GetResolvedPath ());
-                  PointerValue pValue;
-                  root->GetAttribute (info.name, pValue);
-                  Ptr<Object> object = pValue.Get<Object> ();
-                  if (object == 0)
-                    {
-                      NS_LOG_ERROR ("Requested object name=\""<<item<<
-                                    "\" exists on path=\""<<GetResolvedPath ()<<"\""
-                                    " but is null.");
-                      continue;
-                    }
-                  foundMatch = true;
-                  m_workStack.push_back (info.name);
-                  DoResolve (pathLeft, object);
-                  m_workStack.pop_back ();
-                }
-              // attempt to cast to an object vector.
-              const ObjectPtrContainerChecker *vectorChecker = 
-                dynamic_cast<const ObjectPtrContainerChecker *> (PeekPointer (info.checker));
-              if (vectorChecker != 0)
-                {
-                  NS_LOG_DEBUG ("GetAttribute(vector)="<<info.name<<" on path="<<GetResolvedPath () << pathLeft);
-                  foundMatch = true;
-                  ObjectPtrContainerValue vector;
-                  root->GetAttribute (info.name, vector);
-                  m_workStack.push_back (info.name);
-                  DoArrayResolve (pathLeft, vector);
-                  m_workStack.pop_back ();
-                }
-              // this could be anything else and we don't know what to do with it.
-              // So, we just ignore it.
+              std::string::size_type size = Push (i->name);
+              DoResolve (level + 1, object);
+              m_resolvedPath.resize (size);
+            }
+          else
+            {
+              NS_LOG_DEBUG ("GetAttribute(vector)="<<i->name<<" on path="<<m_resolvedPath);
+              ObjectPtrContainerValue vector;
+              root->GetAttribute (i->name, vector);
+              m_uncached = m_uncached || !i->cached;
+              std::string::size_type size = Push (i->name);
+              DoArrayResolve (level + 1, vector);
+              m_resolvedPath.resize (size);
             }
-
-          nextTid = tid.GetParent ();
-        } while (nextTid != tid);
-      
-      if (!foundMatch)
-        {
-          NS_LOG_DEBUG ("Requested item="<<item<<" does not exist on path="<<GetResolvedPath ());
-          return;
         }
     }
 }
 
 void 
-Resolver::DoArrayResolve (std::string path, const ObjectPtrContainerValue &container)
+Resolver::DoArrayResolve (std::size_t level, const ObjectPtrContainerValue &container)
 {
-  NS_LOG_FUNCTION(this << path << &container);
-  NS_ASSERT (path != "");
-  NS_ASSERT ((path.find ("/")) == 0);
-  std::string::size_type next = path.find ("/", 1);
-  if (next == std::string::npos)
+  NS_LOG_FUNCTION(this << level << &container);
+  if (level == m_elements.size ())
     {
       return;
     }
-  std::string item = path.substr (1, next-1);
-  std::string pathLeft = path.substr (next, path.size ()-next);
+  if (level == m_stop)
+    {
+      m_incomplete = true;
+      return;
+    }
 
-  ArrayMatcher matcher = ArrayMatcher (item);
+  const ArrayMatcher &matcher = m_elements[level].matcher;
   ObjectPtrContainerValue::Iterator it;
   for (it = container.Begin (); it != container.End (); ++it)
     {
@@ -569,9 +790,9 @@ Resolver::DoArrayResolve (std::string path, const ObjectPtrContainerValue &conta
         {
           std::ostringstream oss;
           oss << (*it).first;
-          m_workStack.push_back (oss.str ());
-          DoResolve (pathLeft, (*it).second);
-          m_workStack.pop_back ();
+          std::string::size_type size = Push (oss.str ());
+          DoResolve (level + 1, (*it).second);
+          m_resolvedPath.resize (size);
         }
     }
 }
@@ -583,8 +804,12 @@ Resolver::DoArrayResolve (std::string path, const ObjectPtrContainerValue &conta
 class ConfigImpl : public Singleton<ConfigImpl>
 {
 public:
+  ConfigImpl ();
+
   /** \copydoc Config::Set() */
   void Set (std::string path, const AttributeValue &value);
+  /** \copydoc Config::SetMany() */
+  void SetMany (const std::vector<std::pair<std::string, Ptr<const AttributeValue> > > &settings);
   /** \copydoc Config::ConnectWithoutContext() */
   void ConnectWithoutContext (std::string path, const CallbackBase &cb);
   /** \copydoc Config::Connect() */
@@ -615,15 +840,48 @@ private:
    * \param [in,out] leaf The trailing part of the \p path.
    */
   void ParsePath (std::string path, std::string *root, std::string *leaf) const;
+  /** Clear the caches of the roots if Config::InvalidateCache was called. */
+  void CheckCache (void);
+
+  /** A Config path root, and the objects matched by path prefixes from it. */
+  struct Root
+  {
+    Ptr<Object> object;       //!< The root object.
+    Resolver::Cache cache;    //!< The objects matched by path prefixes.
+  };
 
   /** Container type to hold the root Config path tokens. */
-  typedef std::vector<Ptr<Object> > Roots;
+  typedef std::vector<Root> Roots;
 
   /** The list of Config path roots. */
   Roots m_roots;
+  /** The value of g_cacheGeneration when the caches were last checked. */
+  uint64_t m_cacheGeneration;
 
 };  // class ConfigImpl
 
+ConfigImpl::ConfigImpl ()
+  : m_cacheGeneration (g_cacheGeneration.load ())
+{
+  NS_LOG_FUNCTION (this);
+}
+
+void
+ConfigImpl::CheckCache (void)
+{
+  NS_LOG_FUNCTION (this);
+  uint64_t generation = g_cacheGeneration.load ();
+  if (m_cacheGeneration == generation)
+    {
+      return;
+    }
+  for (Roots::iterator i = m_roots.begin (); i != m_roots.end (); i++)
+    {
+      i->cache.clear ();
+    }
+  m_cacheGeneration = generation;
+}
+
 void 
 ConfigImpl::ParsePath (std::string path, std::string *root, std::string *leaf) const
 {
@@ -646,6 +904,29 @@ ConfigImpl::Set (std::string path, const AttributeValue &value)
   MatchContainer container = LookupMatches (root);
   container.Set (leaf, value);
 }
+void
+ConfigImpl::SetMany (const std::vector<std::pair<std::string, Ptr<const AttributeValue> > > &settings)
+{
+  NS_LOG_FUNCTION (this << &settings);
+
+  // Consecutive settings of the same objects share their resolution,
+  // unless setting an Attribute changed the objects matched by the path.
+  std::string lastRoot;
+  MatchContainer container;
+  uint64_t generation = 0;
+  for (std::size_t i = 0; i < settings.size (); i++)
+    {
+      std::string root, leaf;
+      ParsePath (settings[i].first, &root, &leaf);
+      if (i == 0 || root != lastRoot || generation != g_cacheGeneration)
+        {
+          container = LookupMatches (root);
+          lastRoot = root;
+          generation = g_cacheGeneration.load ();
+        }
+      container.Set (leaf, *settings[i].second);
+    }
+}
 void 
 ConfigImpl::ConnectWithoutContext (std::string path, const CallbackBase &cb)
 {
@@ -717,23 +998,12 @@ MatchContainer
 ConfigImpl::LookupMatches (std::string path)
 {
   NS_LOG_FUNCTION (this << path);
-  class LookupMatchesResolver : public Resolver 
-  {
-  public:
-    LookupMatchesResolver (std::string path)
-      : Resolver (path)
-    {}
-    virtual void DoOne (Ptr<Object> object, std::string path)
-    {
-      m_objects.push_back (object);
-      m_contexts.push_back (path);
-    }
-    std::vector<Ptr<Object> > m_objects;
-    std::vector<std::string> m_contexts;
-  } resolver = LookupMatchesResolver (path);
-  for (Roots::const_iterator i = m_roots.begin (); i != m_roots.end (); i++)
+  CheckCache ();
+  Resolver resolver (path);
+  Resolver::Matches matches;
+  for (Roots::iterator i = m_roots.begin (); i != m_roots.end (); i++)
     {
-      resolver.Resolve (*i);
+      resolver.Resolve (i->object, &i->cache, &matches);
     }
 
   //
@@ -741,16 +1011,27 @@ ConfigImpl::LookupMatches (std::string path)
   // the root pointer zeroed indicates to the resolver that it should start
   // looking at the root of the "/Names" namespace during this go.
   //
-  resolver.Resolve (0);
+  resolver.Resolve (0, 0, &matches);
 
-  return MatchContainer (resolver.m_objects, resolver.m_contexts, path);
+  std::vector<Ptr<Object> > objects;
+  std::vector<std::string> contexts;
+  objects.reserve (matches.size ());
+  contexts.reserve (matches.size ());
+  for (Resolver::Matches::const_iterator i = matches.begin (); i != matches.end (); i++)
+    {
+      objects.push_back (i->object);
+      contexts.push_back (i->path);
+    }
+  return MatchContainer (objects, contexts, path);
 }
 
 void 
 ConfigImpl::RegisterRootNamespaceObject (Ptr<Object> obj)
 {
   NS_LOG_FUNCTION (this << obj);
-  m_roots.push_back (obj);
+  Root root;
+  root.object = obj;
+  m_roots.push_back (root);
 }
 
 void 
@@ -758,9 +1039,9 @@ ConfigImpl::UnregisterRootNamespaceObject (Ptr<Object> obj)
 {
   NS_LOG_FUNCTION (this << obj);
 
-  for (std::vector<Ptr<Object> >::iterator i = m_roots.begin (); i != m_roots.end (); i++)
+  for (Roots::iterator i = m_roots.begin (); i != m_roots.end (); i++)
     {
-      if (*i == obj)
+      if (i->object == obj)
         {
           m_roots.erase (i);
           return;
@@ -778,7 +1059,7 @@ Ptr<Object>
 ConfigImpl::GetRootNamespaceObject (std::size_t i) const
 {
   NS_LOG_FUNCTION (this << i);
-  return m_roots[i];
+  return m_roots[i].object;
 }
 
 
@@ -807,6 +1088,11 @@ void Set (std::string path, const AttributeValue &value)
   NS_LOG_FUNCTION (path << &value);
   ConfigImpl::Get ()->Set (path, value);
 }
+void SetMany (const std::vector<std::pair<std::string, Ptr<const AttributeValue> > > &settings)
+{
+  NS_LOG_FUNCTION (&settings);
+  ConfigImpl::Get ()->SetMany (settings);
+}
 void SetDefault (std::string name, const AttributeValue &value)
 {
   NS_LOG_FUNCTION (name << &value);
@@ -885,6 +1171,80 @@ MatchContainer LookupMatches (std::string path)
   return ConfigImpl::Get ()->LookupMatches (path);
 }
 
+TraceContext::TraceContext (Ptr<Object> object, std::string root, std::string name)
+  : m_object (object),
+    m_root (root),
+    m_name (name)
+{
+  NS_LOG_FUNCTION (this << object << root << name);
+  std::string::size_type cur = 0;
+  while (cur != std::string::npos)
+    {
+      std::string::size_type next = m_root.find ("/", cur + 1);
+      std::string token = m_root.substr (cur + 1, next == std::string::npos ? std::string::npos : next - cur - 1);
+      if (!token.empty () && token.find_first_not_of ("0123456789") == std::string::npos)
+        {
+          m_indices.push_back (static_cast<uint32_t> (std::stoul (token)));
+        }
+      cur = next;
+    }
+}
+
+Ptr<Object>
+TraceContext::GetObject (void) const
+{
+  return m_object;
+}
+
+std::string
+TraceContext::GetName (void) const
+{
+  return m_name;
+}
+
+std::string
+TraceContext::GetPath (void) const
+{
+  return m_root + m_name;
+}
+
+std::size_t
+TraceContext::GetNIndices (void) const
+{
+  return m_indices.size ();
+}
+
+uint32_t
+TraceContext::GetIndex (std::size_t i) const
+{
+  NS_ASSERT_MSG (i < m_indices.size (), "The path " << m_root << " has no numeric token " << i);
+  return m_indices[i];
+}
+
+bool
+TraceContext::ConnectWithoutContext (const CallbackBase &cb) const
+{
+  NS_LOG_FUNCTION (this << &cb);
+  return m_object->TraceConnectWithoutContext (m_name, cb);
+}
+
+std::vector<Ptr<const TraceContext> >
+LookupTraceContexts (std::string path)
+{
+  NS_LOG_FUNCTION (path);
+  std::string::size_type slash = path.find_last_of ("/");
+  NS_ASSERT (slash != std::string::npos);
+  std::string root = path.substr (0, slash);
+  std::string leaf = path.substr (slash + 1);
+  MatchContainer container = LookupMatches (root);
+  std::vector<Ptr<const TraceContext> > contexts;
+  for (std::size_t i = 0; i < container.GetN (); ++i)
+    {
+      contexts.push_back (Create<TraceContext> (container.Get (i), container.GetMatchedPath (i), leaf));
+    }
+  return contexts;
+}
+
 void RegisterRootNamespaceObject (Ptr<Object> obj)
 {
   NS_LOG_FUNCTION (obj);
@@ -909,6 +1269,17 @@ Ptr<Object> GetRootNamespaceObject (uint32_t i)
   return ConfigImpl::Get ()->GetRootNamespaceObject (i);
 }
 
+void InvalidateCache (void)
+{
+  g_cacheGeneration.fetch_add (1, std::memory_order_relaxed);
+}
+
+void RegisterCachedContainer (std::string tid, std::string name)
+{
+  NS_LOG_FUNCTION (tid << name);
+  GetCachedContainers ().insert (std::make_pair (tid, name));
+}
+
 } // namespace Config
 
 } // namespace ns3
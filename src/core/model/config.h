@@ -21,8 +21,11 @@
 #define CONFIG_H
 
 #include "ptr.h"
+#include "callback.h"
+#include "simple-ref-count.h"
 #include <string>
 #include <vector>
+#include <utility>
 
 /**
  * \file
@@ -65,6 +68,23 @@ void Reset (void);
  * value.
  */
 void Set (std::string path, const AttributeValue &value);
+/**
+ * \ingroup config
+ * \param [in] settings The (path, value) pairs to set.
+ *
+ * This function is equivalent to calling Config::Set for each pair,
+ * in order, but consecutive pairs whose paths only differ by the
+ * attribute name share the matching of the objects, e.g.,
+ * \code
+ *   std::vector<std::pair<std::string, Ptr<const AttributeValue> > > settings;
+ *   settings.push_back (std::make_pair ("/NodeList/[0-9]/$ns3::MobilityModel/Position",
+ *                                       Create<VectorValue> (Vector (0, 0, 0))));
+ *   settings.push_back (std::make_pair ("/NodeList/[0-9]/$ns3::MobilityModel/Velocity",
+ *                                       Create<VectorValue> (Vector (1, 0, 0))));
+ *   Config::SetMany (settings);
+ * \endcode
+ */
+void SetMany (const std::vector<std::pair<std::string, Ptr<const AttributeValue> > > &settings);
 /**
  * \ingroup config
  * \param [in] name The full name of the attribute
@@ -258,6 +278,91 @@ private:
  */
 MatchContainer LookupMatches (std::string path);
 
+/**
+ * \ingroup config
+ * \brief The context of a trace source connected by
+ * Config::ConnectWithTraceContext.
+ *
+ * The context is resolved once, when the trace source is connected, and
+ * is passed to the callback as a pointer, so that the trace events do
+ * not copy a context string. The indices of the objects matched along the
+ * path, e.g., the node and device indices of
+ * "/NodeList/3/DeviceList/1/Mac/MacTx", are available as integers, while
+ * the path string is built only if requested.
+ */
+class TraceContext : public SimpleRefCount<TraceContext>
+{
+public:
+  /**
+   * Constructor.
+   * \param [in] object The object holding the trace source.
+   * \param [in] root The path matching the object, with a trailing slash.
+   * \param [in] name The name of the trace source.
+   */
+  TraceContext (Ptr<Object> object, std::string root, std::string name);
+
+  /** \returns The object holding the trace source. */
+  Ptr<Object> GetObject (void) const;
+  /** \returns The name of the trace source. */
+  std::string GetName (void) const;
+  /**
+   * \returns The path of the trace source, i.e., the context string
+   *          received by a callback connected with Config::Connect.
+   */
+  std::string GetPath (void) const;
+  /** \returns The number of numeric tokens of the path. */
+  std::size_t GetNIndices (void) const;
+  /**
+   * \param [in] i The position of the numeric token among the numeric
+   *            tokens of the path.
+   * \returns The value of the numeric token, e.g., a node index.
+   */
+  uint32_t GetIndex (std::size_t i) const;
+  /**
+   * Connect a callback to the trace source, without context.
+   * \param [in] cb The callback.
+   * \returns \c true if the trace source was connected.
+   */
+  bool ConnectWithoutContext (const CallbackBase &cb) const;
+
+private:
+  Ptr<Object> m_object;             //!< The object holding the trace source.
+  std::string m_root;               //!< The path matching the object.
+  std::string m_name;               //!< The name of the trace source.
+  std::vector<uint32_t> m_indices;  //!< The numeric tokens of the path.
+};
+
+/**
+ * \ingroup config
+ * \param [in] path A path to match trace sources.
+ * \returns The contexts of the trace sources matching the input path.
+ */
+std::vector<Ptr<const TraceContext> > LookupTraceContexts (std::string path);
+
+/**
+ * \ingroup config
+ * \param [in] path A path to match trace sources.
+ * \param [in] cb The callback to connect to the matching trace sources.
+ *
+ * This function will attempt to find all trace sources which
+ * match the input path and will then connect the input callback
+ * to them in such a way that the callback will receive, as first
+ * argument, the TraceContext of the trace source, resolved once
+ * by this function. Unlike the context string of Config::Connect,
+ * this argument is not copied upon trace event notification.
+ */
+template <typename R, typename T2, typename T3, typename T4, typename T5,
+          typename T6, typename T7, typename T8, typename T9>
+void
+ConnectWithTraceContext (std::string path, Callback<R, Ptr<const TraceContext>, T2, T3, T4, T5, T6, T7, T8, T9> cb)
+{
+  std::vector<Ptr<const TraceContext> > contexts = LookupTraceContexts (path);
+  for (std::size_t i = 0; i < contexts.size (); ++i)
+    {
+      contexts[i]->ConnectWithoutContext (cb.Bind (contexts[i]));
+    }
+}
+
 /**
  * \ingroup config
  * \param [in] obj A new root object
@@ -287,6 +392,36 @@ std::size_t GetRootNamespaceObjectN (void);
  */
 Ptr<Object> GetRootNamespaceObject (uint32_t i);
 
+/**
+ * \ingroup config
+ * Discard the objects cached by the path matching of Config::Set,
+ * Config::Connect, Config::LookupMatches and the like.
+ *
+ * The objects matched by the path prefixes ending with a wildcard, e.g.,
+ * the devices of all the nodes, are cached, so that consecutive calls
+ * with paths sharing these prefixes do not walk the whole object graph
+ * again.  Only the prefixes going through the ObjectPtrContainer
+ * Attributes registered with Config::RegisterCachedContainer are cached.
+ * The cache is invalidated when objects are aggregated or disposed, when
+ * a Pointer Attribute or a name of the object name service is set, and
+ * by the owners of the registered containers when they change, e.g., by
+ * NodeList::Add and Node::AddDevice.
+ */
+void InvalidateCache (void);
+
+/**
+ * \ingroup config
+ * \param [in] tid The name of the TypeId declaring the Attribute.
+ * \param [in] name The name of the ObjectPtrContainer Attribute.
+ *
+ * Allow the path matching to cache the objects matched through an
+ * ObjectPtrContainer Attribute.  The owner of the container must call
+ * Config::InvalidateCache whenever objects are added to or removed from
+ * it.  The objects matched through the other containers are never
+ * cached.
+ */
+void RegisterCachedContainer (std::string tid, std::string name);
+
 } // namespace Config
 
 } // namespace ns3
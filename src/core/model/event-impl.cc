@@ -21,6 +21,8 @@
 #include "event-impl.h"
 #include "log.h"
 
+#include <new>
+
 /**
  * \file
  * \ingroup events
@@ -31,6 +33,70 @@ namespace ns3 {
 
 NS_LOG_COMPONENT_DEFINE ("EventImpl");
 
+namespace {
+
+/// A free block of event storage
+struct FreeBlock
+{
+  FreeBlock *next; //!< the next free block of the same size
+};
+
+/// Granularity of the recycled block sizes, in bytes
+const std::size_t BLOCK_ALIGN = sizeof (void *);
+/// Largest block size, in bytes, which is recycled
+const std::size_t MAX_POOLED_BYTES = 256;
+/// Number of block sizes which are recycled
+const std::size_t POOL_SIZES = MAX_POOLED_BYTES / BLOCK_ALIGN + 1;
+/// Maximum number of free blocks kept for each block size
+const uint32_t MAX_FREE_BLOCKS = 16384;
+
+// The free lists are trivially destructible, so that they can still be
+// accessed by the events destroyed after the PoolReleaser of the same
+// thread.
+thread_local FreeBlock *g_freeBlocks[POOL_SIZES];   //!< free blocks, by size in words
+thread_local uint32_t g_nFreeBlocks[POOL_SIZES];    //!< number of free blocks, by size in words
+thread_local bool g_poolReleased = false;           //!< true after the thread pool has been released
+
+/**
+ * Return the free blocks of a thread to the heap when the thread exits
+ */
+struct PoolReleaser
+{
+  ~PoolReleaser ()
+  {
+    for (std::size_t i = 0; i < POOL_SIZES; ++i)
+      {
+        while (g_freeBlocks[i] != 0)
+          {
+            FreeBlock *block = g_freeBlocks[i];
+            g_freeBlocks[i] = block->next;
+            ::operator delete (block);
+          }
+        g_nFreeBlocks[i] = 0;
+      }
+    g_poolReleased = true;
+  }
+};
+
+thread_local PoolReleaser g_poolReleaser; //!< releases the pool of the thread
+
+/**
+ * \param bytes the size of a block
+ * \return the index of the free list of the block, or 0 if it is not pooled
+ */
+inline std::size_t
+GetPoolIndex (std::size_t bytes)
+{
+  if (bytes > MAX_POOLED_BYTES)
+    {
+      return 0;
+    }
+  // round up, so that the blocks of a list can hold any size mapped to it
+  return (bytes + BLOCK_ALIGN - 1) / BLOCK_ALIGN;
+}
+
+} // unnamed namespace
+
 EventImpl::~EventImpl ()
 {
   NS_LOG_FUNCTION (this);
@@ -66,4 +132,36 @@ EventImpl::IsCancelled (void)
   return m_cancel;
 }
 
+void*
+EventImpl::operator new (std::size_t size)
+{
+  // Do not add function logging here, events are created while logging
+  std::size_t index = GetPoolIndex (size);
+  if (index != 0 && g_freeBlocks[index] != 0)
+    {
+      FreeBlock *block = g_freeBlocks[index];
+      g_freeBlocks[index] = block->next;
+      --g_nFreeBlocks[index];
+      return block;
+    }
+  return ::operator new (index != 0 ? index * BLOCK_ALIGN : size);
+}
+
+void
+EventImpl::operator delete (void *p, std::size_t size)
+{
+  std::size_t index = GetPoolIndex (size);
+  if (index != 0 && !g_poolReleased && g_nFreeBlocks[index] < MAX_FREE_BLOCKS)
+    {
+      // make sure that the pool is released when the thread exits
+      static_cast<void> (&g_poolReleaser);
+      FreeBlock *block = static_cast<FreeBlock *> (p);
+      block->next = g_freeBlocks[index];
+      g_freeBlocks[index] = block;
+      ++g_nFreeBlocks[index];
+      return;
+    }
+  ::operator delete (p);
+}
+
 } // namespace ns3
@@ -21,6 +21,7 @@
 #define EVENT_IMPL_H
 
 #include <stdint.h>
+#include <cstddef>
 #include "simple-ref-count.h"
 
 /**
@@ -66,6 +67,23 @@ public:
    */
   bool IsCancelled (void);
 
+  /**
+   * Allocate the storage of an event, reusing a free block of the same
+   * size of the calling thread if available.
+   *
+   * \param [in] size The size of the event.
+   * \returns The storage of the event.
+   */
+  static void* operator new (std::size_t size);
+  /**
+   * Release the storage of an event to the free blocks of the calling
+   * thread.
+   *
+   * \param [in] p The storage of the event.
+   * \param [in] size The size of the event.
+   */
+  static void operator delete (void *p, std::size_t size);
+
 protected:
   /**
    * Implementation for Invoke().
@@ -0,0 +1,189 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "four-ary-heap-scheduler.h"
+#include "event-impl.h"
+#include "assert.h"
+#include "log.h"
+
+#include <algorithm>
+
+/**
+ * \file
+ * \ingroup scheduler
+ * Implementation of ns3::FourAryHeapScheduler class.
+ */
+
+namespace ns3 {
+
+NS_LOG_COMPONENT_DEFINE ("FourAryHeapScheduler");
+
+NS_OBJECT_ENSURE_REGISTERED (FourAryHeapScheduler);
+
+namespace {
+
+/** The number of children of a heap node. */
+const std::size_t ARITY = 4;
+
+} // unnamed namespace
+
+TypeId
+FourAryHeapScheduler::GetTypeId (void)
+{
+  static TypeId tid = TypeId ("ns3::FourAryHeapScheduler")
+    .SetParent<Scheduler> ()
+    .SetGroupName ("Core")
+    .AddConstructor<FourAryHeapScheduler> ()
+  ;
+  return tid;
+}
+
+FourAryHeapScheduler::FourAryHeapScheduler ()
+{
+  NS_LOG_FUNCTION (this);
+}
+
+FourAryHeapScheduler::~FourAryHeapScheduler ()
+{
+  NS_LOG_FUNCTION (this);
+}
+
+void
+FourAryHeapScheduler::SiftUp (std::size_t index)
+{
+  Scheduler::EventKey key = m_keys[index];
+  EventImpl *impl = m_impls[index];
+  while (index > 0)
+    {
+      std::size_t parent = (index - 1) / ARITY;
+      if (!(key < m_keys[parent]))
+        {
+          break;
+        }
+      m_keys[index] = m_keys[parent];
+      m_impls[index] = m_impls[parent];
+      index = parent;
+    }
+  m_keys[index] = key;
+  m_impls[index] = impl;
+}
+
+void
+FourAryHeapScheduler::SiftDown (std::size_t index)
+{
+  std::size_t size = m_keys.size ();
+  Scheduler::EventKey key = m_keys[index];
+  EventImpl *impl = m_impls[index];
+  while (true)
+    {
+      std::size_t first = index * ARITY + 1;
+      if (first >= size)
+        {
+          break;
+        }
+      std::size_t last = std::min (first + ARITY, size);
+      std::size_t smallest = first;
+      for (std::size_t child = first + 1; child < last; ++child)
+        {
+          if (m_keys[child] < m_keys[smallest])
+            {
+              smallest = child;
+            }
+        }
+      if (!(m_keys[smallest] < key))
+        {
+          break;
+        }
+      m_keys[index] = m_keys[smallest];
+      m_impls[index] = m_impls[smallest];
+      index = smallest;
+    }
+  m_keys[index] = key;
+  m_impls[index] = impl;
+}
+
+void
+FourAryHeapScheduler::RemoveAt (std::size_t index)
+{
+  std::size_t last = m_keys.size () - 1;
+  if (index != last)
+    {
+      m_keys[index] = m_keys[last];
+      m_impls[index] = m_impls[last];
+    }
+  m_keys.pop_back ();
+  m_impls.pop_back ();
+  if (index < m_keys.size ())
+    {
+      // the last item may belong either above or below the removed one
+      SiftDown (index);
+      SiftUp (index);
+    }
+}
+
+void
+FourAryHeapScheduler::Insert (const Event &ev)
+{
+  NS_LOG_FUNCTION (this << &ev);
+  m_keys.push_back (ev.key);
+  m_impls.push_back (ev.impl);
+  SiftUp (m_keys.size () - 1);
+}
+
+bool
+FourAryHeapScheduler::IsEmpty (void) const
+{
+  NS_LOG_FUNCTION (this);
+  return m_keys.empty ();
+}
+
+Scheduler::Event
+FourAryHeapScheduler::PeekNext (void) const
+{
+  NS_LOG_FUNCTION (this);
+  NS_ASSERT (!IsEmpty ());
+  Event next;
+  next.impl = m_impls.front ();
+  next.key = m_keys.front ();
+  return next;
+}
+
+Scheduler::Event
+FourAryHeapScheduler::RemoveNext (void)
+{
+  NS_LOG_FUNCTION (this);
+  Event next = PeekNext ();
+  RemoveAt (0);
+  return next;
+}
+
+void
+FourAryHeapScheduler::Remove (const Event &ev)
+{
+  NS_LOG_FUNCTION (this << &ev);
+  for (std::size_t i = 0; i < m_keys.size (); i++)
+    {
+      if (ev.key.m_uid == m_keys[i].m_uid && ev.key.m_ts == m_keys[i].m_ts)
+        {
+          NS_ASSERT (m_impls[i] == ev.impl);
+          RemoveAt (i);
+          return;
+        }
+    }
+  NS_ASSERT (false);
+}
+
+} // namespace ns3
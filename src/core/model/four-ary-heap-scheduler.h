@@ -0,0 +1,97 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef FOUR_ARY_HEAP_SCHEDULER_H
+#define FOUR_ARY_HEAP_SCHEDULER_H
+
+#include "scheduler.h"
+#include <stdint.h>
+#include <vector>
+
+/**
+ * \file
+ * \ingroup scheduler
+ * ns3::FourAryHeapScheduler declaration.
+ */
+
+namespace ns3 {
+
+class EventImpl;
+
+/**
+ * \ingroup scheduler
+ * \brief a 4-ary implicit heap event scheduler
+ *
+ * The heap is stored in two parallel arrays: the keys of the events,
+ * which are the only data accessed while reordering the heap, and the
+ * event implementations, which are only moved along. The four children
+ * of a node are contiguous in the key array, so that the search of the
+ * smallest child touches a single cache line most of the time, and the
+ * heap is half as deep as a binary heap.
+ *
+ * The arrays are never shrunk, so that a steady-state simulation does
+ * not allocate memory in the scheduler.
+ */
+class FourAryHeapScheduler : public Scheduler
+{
+public:
+  /**
+   *  Register this type.
+   *  \return The object TypeId.
+   */
+  static TypeId GetTypeId (void);
+
+  /** Constructor. */
+  FourAryHeapScheduler ();
+  /** Destructor. */
+  virtual ~FourAryHeapScheduler ();
+
+  // Inherited
+  virtual void Insert (const Scheduler::Event &ev);
+  virtual bool IsEmpty (void) const;
+  virtual Scheduler::Event PeekNext (void) const;
+  virtual Scheduler::Event RemoveNext (void);
+  virtual void Remove (const Scheduler::Event &ev);
+
+private:
+  /**
+   * Move an item towards the root until its parent is smaller.
+   *
+   * \param [in] index The index of the item.
+   */
+  void SiftUp (std::size_t index);
+  /**
+   * Move an item towards the leaves until its children are larger.
+   *
+   * \param [in] index The index of the item.
+   */
+  void SiftDown (std::size_t index);
+  /**
+   * Remove the item at a given index, replacing it with the last item.
+   *
+   * \param [in] index The index of the item.
+   */
+  void RemoveAt (std::size_t index);
+
+  /** The keys of the events, in heap order. */
+  std::vector<Scheduler::EventKey> m_keys;
+  /** The implementations of the events, at the same index as their keys. */
+  std::vector<EventImpl *> m_impls;
+};
+
+} // namespace ns3
+
+#endif /* FOUR_ARY_HEAP_SCHEDULER_H */
@@ -237,6 +237,13 @@ HeapScheduler::Remove (const Event &ev)
           Exch (i, Last ());
           m_heap.pop_back ();
           TopDown (i);
+          // the former last item may also be smaller than its new parent
+          while (i < m_heap.size () && !IsRoot (i)
+                 && IsLessStrictly (i, Parent (i)))
+            {
+              Exch (i, Parent (i));
+              i = Parent (i);
+            }
           return;
         }
     }
@@ -0,0 +1,953 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "simulator.h"
+#include "multithreaded-simulator-impl.h"
+#include "scheduler.h"
+#include "event-impl.h"
+
+#include "ptr.h"
+#include "uinteger.h"
+#include "assert.h"
+#include "fatal-error.h"
+#include "abort.h"
+#include "log.h"
+
+#include <algorithm>
+#include <limits>
+#include <thread>
+
+
+/**
+ * \file
+ * \ingroup simulator
+ * ns3::MultithreadedSimulatorImpl implementation.
+ */
+
+namespace ns3 {
+
+// Note:  Logging in this file is largely avoided due to the
+// number of calls that are made to these functions and the possibility
+// of causing recursions leading to stack overflow
+NS_LOG_COMPONENT_DEFINE ("MultithreadedSimulatorImpl");
+
+NS_OBJECT_ENSURE_REGISTERED (MultithreadedSimulatorImpl);
+
+thread_local MultithreadedSimulatorImpl::Partition *MultithreadedSimulatorImpl::m_currentPartition = 0;
+
+namespace {
+
+/**
+ * \ingroup simulator
+ * Lock of a SystemMutex, held until its destruction as a CriticalSection,
+ * which meets the BasicLockable requirements so that the condition
+ * variables can release it while waiting.
+ */
+class WindowLock
+{
+public:
+  /**
+   * Lock the mutex.
+   *
+   * \param mutex the mutex
+   */
+  WindowLock (SystemMutex &mutex)
+    : m_mutex (mutex)
+  {
+    m_mutex.Lock ();
+  }
+  /** Unlock the mutex. */
+  ~WindowLock ()
+  {
+    m_mutex.Unlock ();
+  }
+  /** Lock the mutex again, after unlock (). */
+  void lock (void)
+  {
+    m_mutex.Lock ();
+  }
+  /** Unlock the mutex. */
+  void unlock (void)
+  {
+    m_mutex.Unlock ();
+  }
+
+private:
+  /** The mutex. */
+  SystemMutex &m_mutex;
+};
+
+} // unnamed namespace
+
+TypeId
+MultithreadedSimulatorImpl::GetTypeId (void)
+{
+  static TypeId tid = TypeId ("ns3::MultithreadedSimulatorImpl")
+    .SetParent<SimulatorImpl> ()
+    .SetGroupName ("Core")
+    .AddConstructor<MultithreadedSimulatorImpl> ()
+    .AddAttribute ("Lookahead",
+                   "The minimum delay of the events scheduled by a node for "
+                   "the nodes of other partitions without a channel. A "
+                   "positive value lowers the lookahead derived from the "
+                   "channels connecting the partitions, zero keeps it.",
+                   TimeValue (Seconds (0)),
+                   MakeTimeAccessor (&MultithreadedSimulatorImpl::m_lookahead),
+                   MakeTimeChecker (Seconds (0)))
+    .AddAttribute ("MaxThreads",
+                   "The maximum number of threads processing the events. "
+                   "Zero uses one thread per hardware thread.",
+                   UintegerValue (0),
+                   MakeUintegerAccessor (&MultithreadedSimulatorImpl::m_maxThreads),
+                   MakeUintegerChecker<uint32_t> ())
+  ;
+  return tid;
+}
+
+MultithreadedSimulatorImpl::MultithreadedSimulatorImpl ()
+{
+  NS_LOG_FUNCTION (this);
+  m_stop = false;
+  m_nThreads = 1;
+  m_maxThreads = 0;
+  m_windowEnd = 0;
+  m_windowLookahead = 0;
+  m_inWindow = false;
+  m_windowSequence = 0;
+  m_runningWorkers = 0;
+  m_workerStartSequence = 0;
+  m_nextWorkerPartition = 0;
+  m_exitWorkers = false;
+  m_eventsWithContextEmpty = true;
+  m_main = SystemThread::Self ();
+}
+
+MultithreadedSimulatorImpl::~MultithreadedSimulatorImpl ()
+{
+  NS_LOG_FUNCTION (this);
+  StopWorkers ();
+}
+
+void
+MultithreadedSimulatorImpl::DoDispose (void)
+{
+  NS_LOG_FUNCTION (this);
+  StopWorkers ();
+  ProcessEventsWithContext ();
+
+  for (std::vector<Partition>::iterator it = m_partitions.begin (); it != m_partitions.end (); ++it)
+    {
+      while (!it->events->IsEmpty ())
+        {
+          Scheduler::Event next = it->events->RemoveNext ();
+          next.impl->Unref ();
+        }
+      for (std::vector<OutgoingEvent>::iterator ev = it->outgoing.begin (); ev != it->outgoing.end (); ++ev)
+        {
+          ev->event->Unref ();
+        }
+    }
+  m_partitions.clear ();
+  SimulatorImpl::DoDispose ();
+}
+
+void
+MultithreadedSimulatorImpl::Destroy ()
+{
+  NS_LOG_FUNCTION (this);
+  while (!m_destroyEvents.empty ())
+    {
+      Ptr<EventImpl> ev = m_destroyEvents.front ().PeekEventImpl ();
+      m_destroyEvents.pop_front ();
+      NS_LOG_LOGIC ("handle destroy " << ev);
+      if (!ev->IsCancelled ())
+        {
+          ev->Invoke ();
+        }
+    }
+}
+
+void
+MultithreadedSimulatorImpl::SetScheduler (ObjectFactory schedulerFactory)
+{
+  NS_LOG_FUNCTION (this << schedulerFactory);
+
+  if (m_partitions.empty ())
+    {
+      // the attributes are set after construction, so the partitions are
+      // created when the simulator installs the first scheduler
+      uint32_t maxThreads = m_maxThreads;
+      if (maxThreads == 0)
+        {
+          maxThreads = std::max (std::thread::hardware_concurrency (), 1U);
+        }
+      m_nThreads = maxThreads;
+      // the partitions are not copyable, because of their atomic time
+      std::vector<Partition> (m_nThreads > 1 ? m_nThreads + 1 : 1).swap (m_partitions);
+      for (uint32_t i = 0; i < m_partitions.size (); ++i)
+        {
+          Partition &partition = m_partitions[i];
+          partition.index = i;
+          partition.sequence = 0;
+          partition.simulator = this;
+          // uids are allocated from 4.
+          // uid 0 is "invalid" events
+          // uid 1 is "now" events
+          // uid 2 is "destroy" events
+          partition.uid = 4;
+          // before ::Run is entered, the currentUid will be zero
+          partition.currentUid = 0;
+          partition.currentTs.store (0, std::memory_order_relaxed);
+          partition.currentContext = Simulator::NO_CONTEXT;
+          partition.eventCount = 0;
+          partition.unscheduledEvents = 0;
+          partition.events = schedulerFactory.Create<Scheduler> ();
+        }
+      NS_LOG_INFO ("processing the events with " << m_nThreads << " threads");
+      return;
+    }
+
+  for (std::vector<Partition>::iterator it = m_partitions.begin (); it != m_partitions.end (); ++it)
+    {
+      Ptr<Scheduler> scheduler = schedulerFactory.Create<Scheduler> ();
+      while (!it->events->IsEmpty ())
+        {
+          Scheduler::Event next = it->events->RemoveNext ();
+          scheduler->Insert (next);
+        }
+      it->events = scheduler;
+    }
+}
+
+// System ID for non-distributed simulation is always zero
+uint32_t
+MultithreadedSimulatorImpl::GetSystemId (void) const
+{
+  return 0;
+}
+
+uint32_t
+MultithreadedSimulatorImpl::GetNThreads (void) const
+{
+  return m_nThreads;
+}
+
+MultithreadedSimulatorImpl::PartitionCallback &
+MultithreadedSimulatorImpl::GetPartitionCallback (void)
+{
+  static PartitionCallback partitionCallback;
+  return partitionCallback;
+}
+
+void
+MultithreadedSimulatorImpl::SetPartitionCallback (PartitionCallback cb)
+{
+  NS_LOG_FUNCTION (&cb);
+  GetPartitionCallback () = cb;
+}
+
+MultithreadedSimulatorImpl::LookaheadCallback &
+MultithreadedSimulatorImpl::GetLookaheadCallback (void)
+{
+  static LookaheadCallback lookaheadCallback;
+  return lookaheadCallback;
+}
+
+void
+MultithreadedSimulatorImpl::SetLookaheadCallback (LookaheadCallback cb)
+{
+  NS_LOG_FUNCTION (&cb);
+  GetLookaheadCallback () = cb;
+}
+
+bool
+MultithreadedSimulatorImpl::IsRemoteContext (uint32_t context)
+{
+  const Partition *partition = m_currentPartition;
+  return partition != 0
+         && partition->simulator->GetPartitionIndex (context) != partition->index;
+}
+
+bool
+MultithreadedSimulatorImpl::GetPartitionSequence (uint32_t &partition, uint64_t &value)
+{
+  if (m_currentPartition == 0)
+    {
+      return false;
+    }
+  partition = m_currentPartition->index + 1;
+  value = m_currentPartition->sequence++;
+  return true;
+}
+
+uint32_t
+MultithreadedSimulatorImpl::GetPartitionIndex (uint32_t context) const
+{
+  if (m_nThreads == 1 || context == Simulator::NO_CONTEXT)
+    {
+      return m_partitions.size () - 1;
+    }
+  if (context < m_contextPartitions.size ())
+    {
+      return m_contextPartitions[context];
+    }
+  return context % m_nThreads;
+}
+
+Time
+MultithreadedSimulatorImpl::GetChannelLookahead (const std::vector<uint32_t> &contextPartitions) const
+{
+  LookaheadCallback &lookaheadCallback = GetLookaheadCallback ();
+  if (lookaheadCallback.IsNull ())
+    {
+      return Time::Max ();
+    }
+  return lookaheadCallback (m_nThreads, contextPartitions);
+}
+
+void
+MultithreadedSimulatorImpl::AssignPartitions (void)
+{
+  if (m_nThreads == 1)
+    {
+      return;
+    }
+  // the nodes are assigned by id, unless a channel without minimum delay
+  // connects them
+  std::vector<uint32_t> contextPartitions;
+  Time lookahead = GetChannelLookahead (contextPartitions);
+  PartitionCallback &partitionCallback = GetPartitionCallback ();
+  if (lookahead.IsZero () && !partitionCallback.IsNull ())
+    {
+      contextPartitions = partitionCallback (m_nThreads);
+      for (std::vector<uint32_t>::const_iterator it = contextPartitions.begin (); it != contextPartitions.end (); ++it)
+        {
+          NS_ABORT_MSG_IF (*it >= m_nThreads, "Context assigned to partition " << *it
+                           << " out of " << m_nThreads);
+        }
+      lookahead = GetChannelLookahead (contextPartitions);
+    }
+  NS_ABORT_MSG_IF (!lookahead.IsStrictlyPositive (),
+                   "A channel without minimum delay connects the nodes of "
+                   "different partitions");
+  if (m_lookahead.IsStrictlyPositive () && m_lookahead < lookahead)
+    {
+      lookahead = m_lookahead;
+    }
+  m_windowLookahead = lookahead == Time::Max () ? 0 : lookahead.GetTimeStep ();
+  NS_LOG_INFO ("lookahead " << TimeStep (m_windowLookahead).As (Time::US));
+
+  if (contextPartitions == m_contextPartitions)
+    {
+      return;
+    }
+  m_contextPartitions = contextPartitions;
+
+  std::vector<Scheduler::Event> moved;
+  for (uint32_t i = 0; i < m_nThreads; ++i)
+    {
+      Partition &partition = m_partitions[i];
+      std::vector<Scheduler::Event> kept;
+      while (!partition.events->IsEmpty ())
+        {
+          Scheduler::Event ev = partition.events->RemoveNext ();
+          if (GetPartitionIndex (ev.key.m_context) == i)
+            {
+              kept.push_back (ev);
+            }
+          else
+            {
+              moved.push_back (ev);
+              partition.unscheduledEvents--;
+            }
+        }
+      for (std::vector<Scheduler::Event>::const_iterator ev = kept.begin (); ev != kept.end (); ++ev)
+        {
+          partition.events->Insert (*ev);
+        }
+    }
+  // the uids are only unique across the partitions until the first window
+  NS_ABORT_MSG_IF (!moved.empty () && m_windowSequence != 0,
+                   "The channels connecting the nodes changed after the "
+                   "first Simulator::Run ()");
+  for (std::vector<Scheduler::Event>::const_iterator ev = moved.begin (); ev != moved.end (); ++ev)
+    {
+      Partition &partition = m_partitions[GetPartitionIndex (ev->key.m_context)];
+      partition.events->Insert (*ev);
+      partition.unscheduledEvents++;
+    }
+
+  uint32_t used = 0;
+  for (uint32_t i = 0; i < m_nThreads; ++i)
+    {
+      if (std::find (m_contextPartitions.begin (), m_contextPartitions.end (), i) != m_contextPartitions.end ())
+        {
+          used++;
+        }
+    }
+  NS_LOG_INFO ("the channels assign the nodes to " << used << " partitions out of " << m_nThreads);
+}
+
+MultithreadedSimulatorImpl::Partition &
+MultithreadedSimulatorImpl::GetCurrentPartition (void)
+{
+  return m_currentPartition != 0 ? *m_currentPartition : m_partitions.back ();
+}
+
+const MultithreadedSimulatorImpl::Partition &
+MultithreadedSimulatorImpl::GetCurrentPartition (void) const
+{
+  return m_currentPartition != 0 ? *m_currentPartition : m_partitions.back ();
+}
+
+uint32_t
+MultithreadedSimulatorImpl::Insert (Partition &partition, uint64_t ts, uint32_t context, EventImpl *event)
+{
+  Scheduler::Event ev;
+  ev.impl = event;
+  ev.key.m_ts = ts;
+  ev.key.m_context = context;
+  // outside of the windows, all the partitions allocate from the uids of
+  // the global partition
+  Partition &allocator = m_inWindow ? partition : m_partitions.back ();
+  ev.key.m_uid = allocator.uid;
+  allocator.uid++;
+  partition.unscheduledEvents++;
+  partition.events->Insert (ev);
+  return ev.key.m_uid;
+}
+
+void
+MultithreadedSimulatorImpl::ProcessOneEvent (Partition &partition)
+{
+  Scheduler::Event next = partition.events->RemoveNext ();
+
+  NS_ASSERT (next.key.m_ts >= partition.currentTs.load (std::memory_order_relaxed));
+  partition.unscheduledEvents--;
+  partition.eventCount++;
+
+  partition.currentTs.store (next.key.m_ts, std::memory_order_relaxed);
+  partition.currentContext = next.key.m_context;
+  partition.currentUid = next.key.m_uid;
+  next.impl->Invoke ();
+  next.impl->Unref ();
+}
+
+void
+MultithreadedSimulatorImpl::ProcessWindow (Partition &partition)
+{
+  while (!m_stop
+         && !partition.events->IsEmpty ()
+         && partition.events->PeekNext ().key.m_ts < m_windowEnd)
+    {
+      ProcessOneEvent (partition);
+    }
+}
+
+bool
+MultithreadedSimulatorImpl::IsFinished (void) const
+{
+  if (m_stop)
+    {
+      return true;
+    }
+  for (std::vector<Partition>::const_iterator it = m_partitions.begin (); it != m_partitions.end (); ++it)
+    {
+      if (!it->events->IsEmpty ())
+        {
+          return false;
+        }
+    }
+  return true;
+}
+
+void
+MultithreadedSimulatorImpl::ProcessEventsWithContext (void)
+{
+  if (m_eventsWithContextEmpty)
+    {
+      return;
+    }
+
+  // swap queues
+  EventsWithContext eventsWithContext;
+  {
+    CriticalSection cs (m_eventsWithContextMutex);
+    m_eventsWithContext.swap (eventsWithContext);
+    m_eventsWithContextEmpty = true;
+  }
+  uint64_t now = m_partitions.back ().currentTs.load (std::memory_order_relaxed);
+  while (!eventsWithContext.empty ())
+    {
+      EventWithContext event = eventsWithContext.front ();
+      eventsWithContext.pop_front ();
+      Insert (m_partitions[GetPartitionIndex (event.context)],
+              now + event.timestamp, event.context, event.event);
+    }
+}
+
+void
+MultithreadedSimulatorImpl::DeliverOutgoingEvents (void)
+{
+  // the partitions are visited in a fixed order, so that the uids of the
+  // delivered events do not depend on the timing of the threads
+  for (std::vector<Partition>::iterator it = m_partitions.begin (); it != m_partitions.end (); ++it)
+    {
+      for (std::vector<OutgoingEvent>::const_iterator ev = it->outgoing.begin (); ev != it->outgoing.end (); ++ev)
+        {
+          Insert (m_partitions[GetPartitionIndex (ev->context)], ev->timestamp, ev->context, ev->event);
+        }
+      it->outgoing.clear ();
+    }
+}
+
+void
+MultithreadedSimulatorImpl::WorkerThread (void)
+{
+  uint32_t index;
+  uint64_t sequence;
+  {
+    CriticalSection cs (m_windowMutex);
+    index = m_nextWorkerPartition++;
+    sequence = m_workerStartSequence;
+  }
+  Partition &partition = m_partitions[index];
+
+  while (true)
+    {
+      {
+        WindowLock lock (m_windowMutex);
+        m_windowStart.wait (lock, [this, sequence] { return m_exitWorkers || m_windowSequence != sequence; });
+        if (m_exitWorkers)
+          {
+            return;
+          }
+        sequence = m_windowSequence;
+      }
+
+      m_currentPartition = &partition;
+      ProcessWindow (partition);
+      m_currentPartition = 0;
+
+      bool last;
+      {
+        CriticalSection cs (m_windowMutex);
+        last = (--m_runningWorkers == 0);
+      }
+      if (last)
+        {
+          m_windowDone.notify_one ();
+        }
+    }
+}
+
+void
+MultithreadedSimulatorImpl::StartWorkers (void)
+{
+  if (!m_workers.empty () || m_nThreads == 1)
+    {
+      return;
+    }
+  NS_LOG_FUNCTION (this);
+  // the main thread processes the first partition
+  m_nextWorkerPartition = 1;
+  m_workerStartSequence = m_windowSequence;
+  for (uint32_t i = 1; i < m_nThreads; ++i)
+    {
+      Ptr<SystemThread> worker = Create<SystemThread> (MakeCallback (&MultithreadedSimulatorImpl::WorkerThread, this));
+      worker->Start ();
+      m_workers.push_back (worker);
+    }
+}
+
+void
+MultithreadedSimulatorImpl::StopWorkers (void)
+{
+  if (m_workers.empty ())
+    {
+      return;
+    }
+  NS_LOG_FUNCTION (this);
+  {
+    CriticalSection cs (m_windowMutex);
+    m_exitWorkers = true;
+  }
+  m_windowStart.notify_all ();
+  for (std::vector<Ptr<SystemThread> >::iterator it = m_workers.begin (); it != m_workers.end (); ++it)
+    {
+      (*it)->Join ();
+    }
+  m_workers.clear ();
+  m_exitWorkers = false;
+}
+
+void
+MultithreadedSimulatorImpl::RunWindow (uint64_t windowEnd)
+{
+  Partition &global = m_partitions.back ();
+  for (uint32_t i = 0; i < m_nThreads; ++i)
+    {
+      m_partitions[i].uid = std::max (m_partitions[i].uid, global.uid);
+    }
+  {
+    CriticalSection cs (m_windowMutex);
+    m_windowEnd = windowEnd;
+    m_inWindow = true;
+    m_runningWorkers = m_workers.size ();
+    m_windowSequence++;
+  }
+  m_windowStart.notify_all ();
+
+  m_currentPartition = &m_partitions.front ();
+  ProcessWindow (m_partitions.front ());
+  m_currentPartition = 0;
+
+  {
+    WindowLock lock (m_windowMutex);
+    m_windowDone.wait (lock, [this] { return m_runningWorkers == 0; });
+    m_inWindow = false;
+  }
+
+  // the time seen outside of the windows is the one of the latest event
+  for (uint32_t i = 0; i < m_nThreads; ++i)
+    {
+      uint64_t ts = m_partitions[i].currentTs.load (std::memory_order_relaxed);
+      if (ts > global.currentTs.load (std::memory_order_relaxed))
+        {
+          global.currentTs.store (ts, std::memory_order_relaxed);
+        }
+      global.uid = std::max (global.uid, m_partitions[i].uid);
+    }
+}
+
+void
+MultithreadedSimulatorImpl::RunSerial (void)
+{
+  Partition &partition = m_partitions.back ();
+  ProcessEventsWithContext ();
+
+  while (!partition.events->IsEmpty () && !m_stop)
+    {
+      ProcessOneEvent (partition);
+      ProcessEventsWithContext ();
+    }
+}
+
+void
+MultithreadedSimulatorImpl::RunParallel (void)
+{
+  const uint64_t never = std::numeric_limits<uint64_t>::max ();
+  uint64_t lookahead = m_windowLookahead;
+  Partition &global = m_partitions.back ();
+  StartWorkers ();
+
+  while (!m_stop)
+    {
+      ProcessEventsWithContext ();
+
+      uint64_t next = never;
+      for (uint32_t i = 0; i < m_nThreads; ++i)
+        {
+          if (!m_partitions[i].events->IsEmpty ())
+            {
+              next = std::min (next, m_partitions[i].events->PeekNext ().key.m_ts);
+            }
+        }
+      uint64_t globalNext = global.events->IsEmpty () ? never : global.events->PeekNext ().key.m_ts;
+      if (next == never && globalNext == never)
+        {
+          break;
+        }
+
+      if (globalNext <= next)
+        {
+          // the events without context run alone, and may thus access
+          // the state of any node
+          ProcessOneEvent (global);
+          continue;
+        }
+
+      uint64_t windowEnd = lookahead != 0 && next < never - lookahead ? next + lookahead : never;
+      RunWindow (std::min (windowEnd, globalNext));
+      DeliverOutgoingEvents ();
+    }
+}
+
+void
+MultithreadedSimulatorImpl::Run (void)
+{
+  NS_LOG_FUNCTION (this);
+  // Set the current threadId as the main threadId
+  m_main = SystemThread::Self ();
+  m_stop = false;
+  AssignPartitions ();
+
+  if (m_nThreads == 1)
+    {
+      RunSerial ();
+    }
+  else
+    {
+      RunParallel ();
+    }
+
+  // If the simulator stopped naturally by lack of events, make a
+  // consistency test to check that we didn't lose any events along the way.
+  int unscheduledEvents = 0;
+  for (std::vector<Partition>::const_iterator it = m_partitions.begin (); it != m_partitions.end (); ++it)
+    {
+      unscheduledEvents += it->unscheduledEvents;
+    }
+  NS_ASSERT (!IsFinished () || m_stop || unscheduledEvents == 0);
+}
+
+void
+MultithreadedSimulatorImpl::Stop (void)
+{
+  NS_LOG_FUNCTION (this);
+  m_stop = true;
+}
+
+void
+MultithreadedSimulatorImpl::Stop (Time const &delay)
+{
+  NS_LOG_FUNCTION (this << delay.GetTimeStep ());
+  Simulator::Schedule (delay, &Simulator::Stop);
+}
+
+//
+// Schedule an event for a _relative_ time in the future.
+//
+EventId
+MultithreadedSimulatorImpl::Schedule (Time const &delay, EventImpl *event)
+{
+  NS_LOG_FUNCTION (this << delay.GetTimeStep () << event);
+  NS_ASSERT_MSG (m_currentPartition != 0 || SystemThread::Equals (m_main), "Simulator::Schedule Thread-unsafe invocation!");
+
+  NS_ASSERT_MSG (delay.IsPositive (), "MultithreadedSimulatorImpl::Schedule(): Negative delay");
+  Partition &partition = GetCurrentPartition ();
+  Time tAbsolute = delay + TimeStep (partition.currentTs.load (std::memory_order_relaxed));
+  uint64_t ts = (uint64_t) tAbsolute.GetTimeStep ();
+  uint32_t uid = Insert (partition, ts, partition.currentContext, event);
+  return EventId (event, ts, partition.currentContext, uid);
+}
+
+void
+MultithreadedSimulatorImpl::ScheduleWithContext (uint32_t context, Time const &delay, EventImpl *event)
+{
+  NS_LOG_FUNCTION (this << context << delay.GetTimeStep () << event);
+
+  if (m_currentPartition == 0 && !SystemThread::Equals (m_main))
+    {
+      EventWithContext ev;
+      ev.context = context;
+      // Current time added in ProcessEventsWithContext()
+      ev.timestamp = delay.GetTimeStep ();
+      ev.event = event;
+      {
+        CriticalSection cs (m_eventsWithContextMutex);
+        m_eventsWithContext.push_back (ev);
+        m_eventsWithContextEmpty = false;
+      }
+      return;
+    }
+
+  Partition &source = GetCurrentPartition ();
+  Partition &destination = m_partitions[GetPartitionIndex (context)];
+  Time tAbsolute = delay + TimeStep (source.currentTs.load (std::memory_order_relaxed));
+  uint64_t ts = (uint64_t) tAbsolute.GetTimeStep ();
+  if (!m_inWindow || &source == &destination)
+    {
+      Insert (destination, ts, context, event);
+      return;
+    }
+
+  if (ts < m_windowEnd)
+    {
+      NS_FATAL_ERROR ("Event scheduled by context " << source.currentContext
+                      << " for context " << context << " of another partition"
+                      << " with a delay of " << delay.As (Time::US)
+                      << " smaller than the lookahead ("
+                      << TimeStep (m_windowLookahead).As (Time::US) << "): connect"
+                      << " the nodes with a channel, or set the Lookahead attribute");
+    }
+  OutgoingEvent ev;
+  ev.context = context;
+  ev.timestamp = ts;
+  ev.event = event;
+  source.outgoing.push_back (ev);
+}
+
+EventId
+MultithreadedSimulatorImpl::ScheduleNow (EventImpl *event)
+{
+  NS_ASSERT_MSG (m_currentPartition != 0 || SystemThread::Equals (m_main), "Simulator::ScheduleNow Thread-unsafe invocation!");
+
+  Partition &partition = GetCurrentPartition ();
+  uint64_t ts = partition.currentTs.load (std::memory_order_relaxed);
+  uint32_t uid = Insert (partition, ts, partition.currentContext, event);
+  return EventId (event, ts, partition.currentContext, uid);
+}
+
+EventId
+MultithreadedSimulatorImpl::ScheduleDestroy (EventImpl *event)
+{
+  NS_ASSERT_MSG (m_currentPartition != 0 || SystemThread::Equals (m_main), "Simulator::ScheduleDestroy Thread-unsafe invocation!");
+
+  EventId id (Ptr<EventImpl> (event, false), GetCurrentPartition ().currentTs.load (std::memory_order_relaxed), 0xffffffff, 2);
+  CriticalSection cs (m_destroyEventsMutex);
+  m_destroyEvents.push_back (id);
+  return id;
+}
+
+Time
+MultithreadedSimulatorImpl::Now (void) const
+{
+  // Do not add function logging here, to avoid stack overflow
+  return TimeStep (GetCurrentPartition ().currentTs.load (std::memory_order_relaxed));
+}
+
+Time
+MultithreadedSimulatorImpl::GetDelayLeft (const EventId &id) const
+{
+  if (IsExpired (id))
+    {
+      return TimeStep (0);
+    }
+  else
+    {
+      return TimeStep (id.GetTs () - GetCurrentPartition ().currentTs.load (std::memory_order_relaxed));
+    }
+}
+
+void
+MultithreadedSimulatorImpl::Remove (const EventId &id)
+{
+  if (id.GetUid () == 2)
+    {
+      // destroy events.
+      CriticalSection cs (m_destroyEventsMutex);
+      for (DestroyEvents::iterator i = m_destroyEvents.begin (); i != m_destroyEvents.end (); i++)
+        {
+          if (*i == id)
+            {
+              m_destroyEvents.erase (i);
+              break;
+            }
+        }
+      return;
+    }
+  if (IsExpired (id))
+    {
+      return;
+    }
+  Partition &partition = m_partitions[GetPartitionIndex (id.GetContext ())];
+  NS_ASSERT_MSG (!m_inWindow || &partition == &GetCurrentPartition (),
+                 "Simulator::Remove of an event of context " << id.GetContext ()
+                 << " from context " << GetContext ());
+  Scheduler::Event event;
+  event.impl = id.PeekEventImpl ();
+  event.key.m_ts = id.GetTs ();
+  event.key.m_context = id.GetContext ();
+  event.key.m_uid = id.GetUid ();
+  partition.events->Remove (event);
+  event.impl->Cancel ();
+  // whenever we remove an event from the event list, we have to unref it.
+  event.impl->Unref ();
+
+  partition.unscheduledEvents--;
+}
+
+void
+MultithreadedSimulatorImpl::Cancel (const EventId &id)
+{
+  if (!IsExpired (id))
+    {
+      id.PeekEventImpl ()->Cancel ();
+    }
+}
+
+bool
+MultithreadedSimulatorImpl::IsExpired (const EventId &id) const
+{
+  if (id.GetUid () == 2)
+    {
+      if (id.PeekEventImpl () == 0
+          || id.PeekEventImpl ()->IsCancelled ())
+        {
+          return true;
+        }
+      // destroy events.
+      CriticalSection cs (m_destroyEventsMutex);
+      for (DestroyEvents::const_iterator i = m_destroyEvents.begin (); i != m_destroyEvents.end (); i++)
+        {
+          if (*i == id)
+            {
+              return false;
+            }
+        }
+      return true;
+    }
+  if (id.PeekEventImpl () == 0)
+    {
+      return true;
+    }
+  // the uids are only ordered within the partition of the event, and the
+  // current event of a partition is only stable in its own thread, or for
+  // the events without context during the windows
+  const Partition &partition = m_partitions[GetPartitionIndex (id.GetContext ())];
+  NS_ASSERT_MSG (!m_inWindow || &partition == &GetCurrentPartition ()
+                 || &partition == &m_partitions.back (),
+                 "Simulator::IsExpired of an event of context " << id.GetContext ()
+                 << " from context " << GetContext ());
+  uint64_t currentTs = partition.currentTs.load (std::memory_order_relaxed);
+  if (id.GetTs () < currentTs
+      || (id.GetTs () == currentTs
+          && id.GetUid () <= partition.currentUid)
+      || id.PeekEventImpl ()->IsCancelled ())
+    {
+      return true;
+    }
+  else
+    {
+      return false;
+    }
+}
+
+Time
+MultithreadedSimulatorImpl::GetMaximumSimulationTime (void) const
+{
+  return TimeStep (0x7fffffffffffffffLL);
+}
+
+uint32_t
+MultithreadedSimulatorImpl::GetContext (void) const
+{
+  return GetCurrentPartition ().currentContext;
+}
+
+uint64_t
+MultithreadedSimulatorImpl::GetEventCount (void) const
+{
+  uint64_t eventCount = 0;
+  for (std::vector<Partition>::const_iterator it = m_partitions.begin (); it != m_partitions.end (); ++it)
+    {
+      eventCount += it->eventCount;
+    }
+  return eventCount;
+}
+
+} // namespace ns3
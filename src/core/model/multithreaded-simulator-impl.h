@@ -0,0 +1,395 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef MULTITHREADED_SIMULATOR_IMPL_H
+#define MULTITHREADED_SIMULATOR_IMPL_H
+
+#include "simulator-impl.h"
+#include "scheduler.h"
+#include "event-impl.h"
+#include "system-thread.h"
+#include "system-mutex.h"
+#include "nstime.h"
+#include "callback.h"
+
+#include "ptr.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <list>
+#include <vector>
+
+/**
+ * \file
+ * \ingroup simulator
+ * ns3::MultithreadedSimulatorImpl declaration.
+ */
+
+namespace ns3 {
+
+/**
+ * \ingroup simulator
+ *
+ * A shared-memory parallel simulator implementation.
+ *
+ * The events are partitioned by execution context (i.e., by node), and
+ * each partition is processed by its own thread. The events without
+ * context (Simulator::NO_CONTEXT) are stored in a global partition
+ * processed by the main thread while all the other partitions are idle.
+ *
+ * The nodes are assigned to the partitions when Simulator::Run () is
+ * called, by node id modulo the number of threads. The lookahead is
+ * then the minimum delay of the channels connecting the nodes of
+ * different partitions, given by the callback set with
+ * SetLookaheadCallback, as DistributedSimulatorImpl does with the
+ * channels connecting the systems. The Lookahead attribute may only
+ * lower it, for the models which schedule events for the nodes of
+ * other partitions without a channel. When a channel connecting
+ * different partitions has no minimum delay, such as a wireless channel
+ * shared by its nodes, the nodes are instead assigned by the callback
+ * set with SetPartitionCallback, which keeps the nodes of such channels
+ * in the same partition. The network module sets both callbacks.
+ *
+ * The partitions are synchronized with a conservative time window
+ * protocol: all the partitions execute their events with a timestamp
+ * in [t, t + lookahead), where t is the earliest pending event, and
+ * then wait for each other. Without any channel between the partitions
+ * nor Lookahead attribute, the windows only end at the events without
+ * context. The events scheduled across partitions (with
+ * Simulator::ScheduleWithContext) are delivered at the end of the
+ * window, hence their delay must not be smaller than the lookahead, and
+ * a cross-partition event violating the lookahead aborts the
+ * simulation.
+ *
+ * The events of a partition run in the same order as with
+ * DefaultSimulatorImpl, except for the events with the same timestamp:
+ * these are executed in the order in which they were scheduled within
+ * a window, followed by the ones received from the other partitions at
+ * the end of the window. The order does not depend on the thread
+ * timings, i.e., a simulation is reproducible.
+ *
+ * The models running on different partitions must not share state
+ * without synchronization beyond the channels, which includes the
+ * reference counts of the objects (Ptr is not thread-safe), e.g., a
+ * propagation model installed in several channels: an event handed over
+ * to another partition may only carry data that is not accessed by the
+ * sending partition anymore (see IsRemoteContext). The packet uids are
+ * allocated from a sequence per partition (see GetPartitionSequence), so
+ * they do not depend on the timing of the threads either.
+ * Simulator::Stop () called by an event of a node stops the other
+ * partitions after their current event, at a time which depends on the
+ * timing of the threads, and Simulator::Remove (), Simulator::Cancel ()
+ * and Simulator::IsExpired () of an event of another partition are only
+ * allowed from the events without context.
+ *
+ * When a single thread is configured, all the events are processed by
+ * the main thread, in the same order as with DefaultSimulatorImpl.
+ */
+class MultithreadedSimulatorImpl : public SimulatorImpl
+{
+public:
+  /**
+   *  Register this type.
+   *  \return The object TypeId.
+   */
+  static TypeId GetTypeId (void);
+
+  /** Constructor. */
+  MultithreadedSimulatorImpl ();
+  /** Destructor. */
+  ~MultithreadedSimulatorImpl ();
+
+  // Inherited
+  virtual void Destroy ();
+  virtual bool IsFinished (void) const;
+  virtual void Stop (void);
+  virtual void Stop (const Time &delay);
+  virtual EventId Schedule (const Time &delay, EventImpl *event);
+  virtual void ScheduleWithContext (uint32_t context, const Time &delay, EventImpl *event);
+  virtual EventId ScheduleNow (EventImpl *event);
+  virtual EventId ScheduleDestroy (EventImpl *event);
+  virtual void Remove (const EventId &id);
+  virtual void Cancel (const EventId &id);
+  virtual bool IsExpired (const EventId &id) const;
+  virtual void Run (void);
+  virtual Time Now (void) const;
+  virtual Time GetDelayLeft (const EventId &id) const;
+  virtual Time GetMaximumSimulationTime (void) const;
+  virtual void SetScheduler (ObjectFactory schedulerFactory);
+  virtual uint32_t GetSystemId (void) const;
+  virtual uint32_t GetContext (void) const;
+  virtual uint64_t GetEventCount (void) const;
+
+  /**
+   * \return the number of threads processing the events, including the
+   *         main thread
+   */
+  uint32_t GetNThreads (void) const;
+
+  /**
+   * Callback assigning the contexts to the partitions: it gets the
+   * number of partitions, and returns the partition of each context
+   * (i.e., node id) from 0; the contexts beyond the vector are assigned
+   * modulo the number of partitions.
+   */
+  typedef Callback<std::vector<uint32_t>, uint32_t> PartitionCallback;
+
+  /**
+   * Set the callback assigning the contexts to the partitions, called
+   * by Run ().
+   *
+   * \param cb the callback
+   */
+  static void SetPartitionCallback (PartitionCallback cb);
+
+  /**
+   * Callback returning the minimum delay of the channels connecting the
+   * contexts of different partitions: it gets the number of partitions
+   * and the partition of each context, as PartitionCallback returns
+   * them, and returns Time::Max () if no channel connects different
+   * partitions, or zero if such a channel has no minimum delay.
+   */
+  typedef Callback<Time, uint32_t, const std::vector<uint32_t> &> LookaheadCallback;
+
+  /**
+   * Set the callback returning the minimum delay of the channels
+   * connecting the partitions, called by Run ().
+   *
+   * \param cb the callback
+   */
+  static void SetLookaheadCallback (LookaheadCallback cb);
+
+  /**
+   * Check whether the data handed over to the events of a context must
+   * not be shared with the calling thread, such as a packet whose buffer
+   * is shared by its copies or the reference count of an object.
+   *
+   * \param context an execution context
+   * \return true if the calling thread processes a window and the events
+   *         of the context are processed by another thread
+   */
+  static bool IsRemoteContext (uint32_t context);
+
+  /**
+   * Get the next value of the sequence of the partition processed by the
+   * calling thread, so that the models can number the objects created
+   * by the events of the partitions, such as the packets, independently
+   * of the timing of the threads.
+   *
+   * \param [out] partition the index of the partition, from 1
+   * \param [out] value the next value of its sequence
+   * \return false if the calling thread does not process a window, the
+   *         objects are then numbered by the models themselves
+   */
+  static bool GetPartitionSequence (uint32_t &partition, uint64_t &value);
+
+private:
+  virtual void DoDispose (void);
+
+  /** An event sent to another partition, delivered at the end of the window. */
+  struct OutgoingEvent
+  {
+    /** The event context. */
+    uint32_t context;
+    /** Absolute event timestamp. */
+    uint64_t timestamp;
+    /** The event implementation. */
+    EventImpl *event;
+  };
+
+  /** The events of a set of contexts, processed by a single thread. */
+  struct Partition
+  {
+    /** The event priority queue. */
+    Ptr<Scheduler> events;
+    /**
+     * Next event unique id. The one of the global partition is used
+     * outside of the windows, and all the partitions start each window
+     * from it, so that the uids of the events moved between partitions
+     * are unique.
+     */
+    uint32_t uid;
+    /** Unique id of the current event. */
+    uint32_t currentUid;
+    /**
+     * Timestamp of the current event. Atomic, since the one of the global
+     * partition is read by Now () from other threads.
+     */
+    std::atomic<uint64_t> currentTs;
+    /** Execution context of the current event. */
+    uint32_t currentContext;
+    /** The event count. */
+    uint64_t eventCount;
+    /** Number of events inserted but not yet processed. */
+    int unscheduledEvents;
+    /** Events for the other partitions scheduled during the current window. */
+    std::vector<OutgoingEvent> outgoing;
+    /** Index of the partition. */
+    uint32_t index;
+    /** Next value of the sequence returned by GetPartitionSequence. */
+    uint64_t sequence;
+    /** The simulator owning the partition. */
+    const MultithreadedSimulatorImpl *simulator;
+  };
+
+  /**
+   * \param context an execution context
+   * \return the index of the partition storing the events of the context
+   */
+  uint32_t GetPartitionIndex (uint32_t context) const;
+  /**
+   * \return the partition of the calling thread: the one being processed
+   *         by the thread during a window, the global one otherwise
+   */
+  Partition &GetCurrentPartition (void);
+  /** \copydoc GetCurrentPartition */
+  const Partition &GetCurrentPartition (void) const;
+  /**
+   * Insert an event in a partition, allocating its unique id.
+   * \param partition the partition
+   * \param ts the absolute timestamp
+   * \param context the execution context
+   * \param event the event implementation
+   * \return the unique id of the event
+   */
+  uint32_t Insert (Partition &partition, uint64_t ts, uint32_t context, EventImpl *event);
+  /**
+   * \return the callback assigning the contexts to the partitions
+   */
+  static PartitionCallback & GetPartitionCallback (void);
+  /**
+   * \return the callback returning the minimum delay of the channels
+   *         connecting the partitions
+   */
+  static LookaheadCallback & GetLookaheadCallback (void);
+  /**
+   * \param contextPartitions the partition of each context
+   * \return the minimum delay of the channels connecting the partitions
+   */
+  Time GetChannelLookahead (const std::vector<uint32_t> &contextPartitions) const;
+  /**
+   * Assign the contexts to the partitions, by node or else with the
+   * partition callback, set the lookahead, and move the pending events
+   * to their new partition.
+   */
+  void AssignPartitions (void);
+  /**
+   * Process the next event of a partition.
+   * \param partition the partition
+   */
+  static void ProcessOneEvent (Partition &partition);
+  /**
+   * Process the events of a partition with timestamp before the end of
+   * the current window.
+   * \param partition the partition
+   */
+  void ProcessWindow (Partition &partition);
+  /** Process all the events with the main thread. */
+  void RunSerial (void);
+  /** Process the events with the worker threads, window by window. */
+  void RunParallel (void);
+  /**
+   * Let all the threads process a window.
+   * \param windowEnd the end of the window, excluded
+   */
+  void RunWindow (uint64_t windowEnd);
+  /** Insert the events sent across partitions in their destination. */
+  void DeliverOutgoingEvents (void);
+  /** Move events from a different thread into the partitions. */
+  void ProcessEventsWithContext (void);
+  /** Entry point of the worker threads. */
+  void WorkerThread (void);
+  /** Start the worker threads, if not running yet. */
+  void StartWorkers (void);
+  /** Stop the worker threads and wait for their termination. */
+  void StopWorkers (void);
+
+  /** Wrap an event with its execution context. */
+  struct EventWithContext {
+    /** The event context. */
+    uint32_t context;
+    /** Event timestamp. */
+    uint64_t timestamp;
+    /** The event implementation. */
+    EventImpl *event;
+  };
+  /** Container type for the events from a different context. */
+  typedef std::list<struct EventWithContext> EventsWithContext;
+  /** The container of events from a different thread. */
+  EventsWithContext m_eventsWithContext;
+  /**
+   * Flag \c true if all events with context have been moved to the
+   * partitions.
+   */
+  bool m_eventsWithContextEmpty;
+  /** Mutex to control access to the list of events with context. */
+  SystemMutex m_eventsWithContextMutex;
+
+  /** Container type for the events to run at Simulator::Destroy() */
+  typedef std::list<EventId> DestroyEvents;
+  /** The container of events to run at Destroy. */
+  DestroyEvents m_destroyEvents;
+  /** Mutex to control access to the events to run at Destroy. */
+  mutable SystemMutex m_destroyEventsMutex;
+  /** Flag calling for the end of the simulation. */
+  std::atomic<bool> m_stop;
+
+  /** The partitions; the last one stores the events without context. */
+  std::vector<Partition> m_partitions;
+  /** The number of threads, and of partitions with context. */
+  uint32_t m_nThreads;
+  /** The partition of each context, from the partition callback. */
+  std::vector<uint32_t> m_contextPartitions;
+  /** The attribute setting the maximum number of threads. */
+  uint32_t m_maxThreads;
+  /** The attribute lowering the lookahead, or zero. */
+  Time m_lookahead;
+  /** The minimum delay of the events scheduled across partitions, or zero if unbounded. */
+  uint64_t m_windowLookahead;
+  /** End of the window being processed, excluded. */
+  uint64_t m_windowEnd;
+  /** True while the partitions are processing a window. */
+  bool m_inWindow;
+
+  /** The worker threads. */
+  std::vector<Ptr<SystemThread> > m_workers;
+  /** Mutex protecting the window synchronization state. */
+  SystemMutex m_windowMutex;
+  /** Notifies the workers of a new window, or of their termination. */
+  std::condition_variable_any m_windowStart;
+  /** Notifies the main thread that all the workers completed the window. */
+  std::condition_variable_any m_windowDone;
+  /** Sequence number of the current window. */
+  uint64_t m_windowSequence;
+  /** Number of workers still processing the current window. */
+  uint32_t m_runningWorkers;
+  /** Sequence number of the last window before the workers were started. */
+  uint64_t m_workerStartSequence;
+  /** Index of the partition assigned to the next started worker. */
+  uint32_t m_nextWorkerPartition;
+  /** Flag asking the workers to terminate. */
+  bool m_exitWorkers;
+
+  /** Partition processed by the calling thread during a window, if any. */
+  static thread_local Partition *m_currentPartition;
+
+  /** Main execution thread. */
+  SystemThread::ThreadId m_main;
+};
+
+} // namespace ns3
+
+#endif /* MULTITHREADED_SIMULATOR_IMPL_H */
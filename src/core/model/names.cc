@@ -23,6 +23,7 @@
 #include "abort.h"
 #include "names.h"
 #include "singleton.h"
+#include "config.h"
 
 /**
  * \file
@@ -295,6 +296,7 @@ void
 NamesPriv::Clear (void)
 {
   NS_LOG_FUNCTION (this);
+  Config::InvalidateCache ();
   //
   // Every name is associated with an object in the object map, so freeing the
   // NameNodes in this map will free all of the memory allocated for the NameNodes
@@ -390,6 +392,7 @@ bool
 NamesPriv::Add (Ptr<Object> context, std::string name, Ptr<Object> object)
 {
   NS_LOG_FUNCTION (this << context << name << object);
+  Config::InvalidateCache ();
 
   if (IsNamed (object))
     {
@@ -500,6 +503,7 @@ bool
 NamesPriv::Rename (Ptr<Object> context, std::string oldname, std::string newname)
 {
   NS_LOG_FUNCTION (this << context << oldname << newname);
+  Config::InvalidateCache ();
 
   NameNode *node = 0;
   if (context)
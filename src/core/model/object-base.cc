@@ -22,6 +22,8 @@
 #include "trace-source-accessor.h"
 #include "attribute-construction-list.h"
 #include "string.h"
+#include "pointer.h"
+#include "config.h"
 #include "ns3/core-config.h"
 #ifdef HAVE_STDLIB_H
 #include <cstdlib>
@@ -178,6 +180,11 @@ ObjectBase::DoSet (Ptr<const AttributeAccessor> accessor,
       return false;
     }
   bool ok = accessor->Set (this, *v);
+  if (ok && dynamic_cast<const PointerChecker *> (PeekPointer (checker)) != 0)
+    {
+      // the objects reachable from a Config path changed
+      Config::InvalidateCache ();
+    }
   return ok;
 }
 
@@ -25,6 +25,7 @@
 #include "attribute.h"
 #include "log.h"
 #include "string.h"
+#include "config.h"
 #include <vector>
 #include <sstream>
 #include <cstdlib>
@@ -103,6 +104,7 @@ Object::Object ()
   NS_LOG_FUNCTION (this);
   m_aggregates->n = 1;
   m_aggregates->buffer[0] = this;
+  ResetAggregatesCache (m_aggregates);
 }
 Object::~Object () 
 {
@@ -120,6 +122,13 @@ Object::~Object ()
           m_aggregates->n--;
         }
     }
+  for (uint32_t k = 0; k < Aggregates::CACHE_SIZE; k++)
+    {
+      if (m_aggregates->cacheObject[k] == this)
+        {
+          m_aggregates->cacheTid[k] = 0;
+        }
+    }
   // finally, if all objects have been removed from the list,
   // delete the aggregate list
   if (m_aggregates->n == 0)
@@ -137,6 +146,7 @@ Object::Object (const Object &o)
 {
   m_aggregates->n = 1;
   m_aggregates->buffer[0] = this;
+  ResetAggregatesCache (m_aggregates);
 }
 void
 Object::Construct (const AttributeConstructionList &attributes)
@@ -151,33 +161,86 @@ Object::DoGetObject (TypeId tid) const
   NS_LOG_FUNCTION (this << tid);
   NS_ASSERT (CheckLoose ());
 
-  uint32_t n = m_aggregates->n;
-  TypeId objectTid = Object::GetTypeId ();
-  for (uint32_t i = 0; i < n; i++)
+  struct Aggregates *aggregates = m_aggregates;
+  uint16_t uid = tid.GetUid ();
+  Object *found = 0;
+  uint32_t slot = 0;
+  uint32_t k = 0;
+  for (; k < Aggregates::CACHE_SIZE; k++)
     {
-      Object *current = m_aggregates->buffer[i];
-      TypeId cur = current->GetInstanceTypeId ();
-      while (cur != tid && cur != objectTid)
+      if (aggregates->cacheTid[k] == uid)
         {
-          cur = cur.GetParent ();
+          found = aggregates->cacheObject[k];
+          if (found == 0)
+            {
+              return 0;
+            }
+          slot = aggregates->cacheSlot[k];
+          if (slot >= aggregates->n || aggregates->buffer[slot] != found)
+            {
+              // the object was moved by the sort
+              slot = 0;
+              while (aggregates->buffer[slot] != found)
+                {
+                  slot++;
+                }
+            }
+          break;
         }
-      if (cur == tid)
+    }
+  if (k == Aggregates::CACHE_SIZE)
+    {
+      // Not cached: look for the first match, and cache it if it is the
+      // only one, as the sort below could change the first match otherwise
+      uint32_t n = aggregates->n;
+      uint32_t nMatches = 0;
+      TypeId objectTid = Object::GetTypeId ();
+      for (uint32_t i = 0; i < n; i++)
         {
-          // This is an attempt to 'cache' the result of this lookup.
-          // the idea is that if we perform a lookup for a TypeId on this object,
-          // we are likely to perform the same lookup later so, we make sure
-          // that the aggregate array is sorted by the number of accesses
-          // to each object.
-
-          // first, increment the access count
-          current->m_getObjectCount++;
-          // then, update the sort
-          UpdateSortedArray (m_aggregates, i);
-          // finally, return the match
-          return const_cast<Object *> (current);
+          Object *current = aggregates->buffer[i];
+          TypeId cur = current->GetInstanceTypeId ();
+          while (cur != tid && cur != objectTid)
+            {
+              cur = cur.GetParent ();
+            }
+          if (cur == tid)
+            {
+              if (nMatches == 0)
+                {
+                  found = current;
+                  slot = i;
+                }
+              nMatches++;
+            }
         }
+      if (nMatches <= 1)
+        {
+          k = aggregates->cacheNext;
+          aggregates->cacheNext = (k + 1) % Aggregates::CACHE_SIZE;
+          aggregates->cacheTid[k] = uid;
+          aggregates->cacheObject[k] = found;
+        }
+    }
+  if (found == 0)
+    {
+      return 0;
+    }
+  // This is an attempt to 'cache' the result of this lookup.
+  // the idea is that if we perform a lookup for a TypeId on this object,
+  // we are likely to perform the same lookup later so, we make sure
+  // that the aggregate array is sorted by the number of accesses
+  // to each object.
+
+  // first, increment the access count
+  found->m_getObjectCount++;
+  // then, update the sort
+  slot = UpdateSortedArray (aggregates, slot);
+  if (k < Aggregates::CACHE_SIZE)
+    {
+      aggregates->cacheSlot[k] = slot;
     }
-  return 0;
+  // finally, return the match
+  return const_cast<Object *> (found);
 }
 void
 Object::Initialize (void)
@@ -222,6 +285,7 @@ Object::Dispose (void)
    * user code.
    */
   NS_LOG_FUNCTION (this);
+  Config::InvalidateCache ();
 restart:
   uint32_t n = m_aggregates->n;
   for (uint32_t i = 0; i < n; i++)
@@ -236,6 +300,17 @@ restart:
     }
 }
 void
+Object::ResetAggregatesCache (struct Aggregates *aggregates)
+{
+  aggregates->cacheNext = 0;
+  for (uint32_t k = 0; k < Aggregates::CACHE_SIZE; k++)
+    {
+      aggregates->cacheTid[k] = 0;
+      aggregates->cacheObject[k] = 0;
+      aggregates->cacheSlot[k] = 0;
+    }
+}
+uint32_t
 Object::UpdateSortedArray (struct Aggregates *aggregates, uint32_t j) const
 {
   NS_LOG_FUNCTION (this << aggregates << j);
@@ -247,6 +322,7 @@ Object::UpdateSortedArray (struct Aggregates *aggregates, uint32_t j) const
       aggregates->buffer[j] = tmp;
       j--;
     }
+  return j;
 }
 void 
 Object::AggregateObject (Ptr<Object> o)
@@ -256,6 +332,7 @@ Object::AggregateObject (Ptr<Object> o)
   NS_ASSERT (!o->m_disposed);
   NS_ASSERT (CheckLoose ());
   NS_ASSERT (o->CheckLoose ());
+  Config::InvalidateCache ();
 
   Object *other = PeekPointer (o);
   // first create the new aggregate buffer.
@@ -263,6 +340,7 @@ Object::AggregateObject (Ptr<Object> o)
   struct Aggregates *aggregates = 
     (struct Aggregates *)std::malloc (sizeof(struct Aggregates)+(total-1)*sizeof(Object*));
   aggregates->n = total;
+  ResetAggregatesCache (aggregates);
 
   // copy our buffer to the new buffer
   std::memcpy (&aggregates->buffer[0], 
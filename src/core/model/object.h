@@ -331,14 +331,37 @@ private:
    * chunk of memory than the struct to allow space for a larger
    * variable sized buffer whose size is indicated by the element
    * \c n
+   *
+   * The list also caches the last TypeIds looked up by DoGetObject()
+   * with the Object matching them.  A TypeId is cached only if at most
+   * one of the Objects matches it, so that the cache never changes the
+   * result of a lookup.  The cache is reset when the list is replaced
+   * by AggregateObject().
    */
   struct Aggregates {
+    /** The size of the lookup cache. */
+    enum { CACHE_SIZE = 4 };
     /** The number of entries in \c buffer. */
     uint32_t n;
+    /** The next entry of the lookup cache to replace. */
+    uint32_t cacheNext;
+    /** The TypeId uids of the lookup cache, 0 for an empty entry. */
+    uint16_t cacheTid[CACHE_SIZE];
+    /** The Objects of the lookup cache, 0 if no Object matches the TypeId. */
+    Object *cacheObject[CACHE_SIZE];
+    /** The last known positions of the Objects of the lookup cache in \c buffer. */
+    uint32_t cacheSlot[CACHE_SIZE];
     /** The array of Objects. */
     Object *buffer[1];
   };
 
+  /**
+   * Empty the lookup cache of a list of aggregated Objects.
+   *
+   * \param [in,out] aggregates The list of aggregated Objects.
+   */
+  static void ResetAggregatesCache (struct Aggregates *aggregates);
+
   /**
    * Find an Object of TypeId tid in the aggregates of this Object.
    *
@@ -391,8 +414,9 @@ private:
    *
    * \param [in,out] aggregates The list of aggregated Objects.
    * \param [in] i The most recently used entry in the list.
+   * \returns The new position of the entry in the list.
    */
-  void UpdateSortedArray (struct Aggregates *aggregates, uint32_t i) const;
+  uint32_t UpdateSortedArray (struct Aggregates *aggregates, uint32_t i) const;
   /**
    * Attempt to delete this Object.
    *
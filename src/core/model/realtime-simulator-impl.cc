@@ -31,8 +31,11 @@
 #include "system-mutex.h"
 #include "boolean.h"
 #include "enum.h"
+#include "nstime.h"
+#include "trace-source-accessor.h"
 
 
+#include <algorithm>
 #include <cmath>
 
 
@@ -69,6 +72,23 @@ RealtimeSimulatorImpl::GetTypeId (void)
                    TimeValue (Seconds (0.1)),
                    MakeTimeAccessor (&RealtimeSimulatorImpl::m_hardLimit),
                    MakeTimeChecker ())
+    .AddAttribute ("InboundSpinTime",
+                   "Maximum wall-clock time to poll the queue of the events "
+                   "scheduled by other threads before sleeping in the synchronizer "
+                   "(zero to sleep right away)",
+                   TimeValue (Seconds (0)),
+                   MakeTimeAccessor (&RealtimeSimulatorImpl::m_inboundSpinTime),
+                   MakeTimeChecker (Seconds (0)))
+    .AddTraceSource ("EventLag",
+                     "Wall-clock time at the start of each event "
+                     "minus the event timestamp.",
+                     MakeTraceSourceAccessor (&RealtimeSimulatorImpl::m_eventLagTrace),
+                     "ns3::RealtimeSimulatorImpl::LagTracedCallback")
+    .AddTraceSource ("InboundLag",
+                     "Wall-clock time spent by each event scheduled by another "
+                     "thread before being inserted in the event list.",
+                     MakeTraceSourceAccessor (&RealtimeSimulatorImpl::m_inboundLagTrace),
+                     "ns3::RealtimeSimulatorImpl::LagTracedCallback")
   ;
   return tid;
 }
@@ -91,6 +111,8 @@ RealtimeSimulatorImpl::RealtimeSimulatorImpl ()
   m_currentContext = Simulator::NO_CONTEXT;
   m_unscheduledEvents = 0;
   m_eventCount = 0;
+  m_inbound = 0;
+  m_parked = false;
 
   m_main = SystemThread::Self();
 
@@ -113,6 +135,14 @@ RealtimeSimulatorImpl::DoDispose (void)
       Scheduler::Event next = m_events->RemoveNext ();
       next.impl->Unref ();
     }
+  InboundEvent *inbound = m_inbound.exchange (0);
+  while (inbound != 0)
+    {
+      InboundEvent *next = inbound->next;
+      inbound->impl->Unref ();
+      delete inbound;
+      inbound = next;
+    }
   m_events = 0;
   m_synchronizer = 0;
   SimulatorImpl::DoDispose ();
@@ -206,9 +236,16 @@ RealtimeSimulatorImpl::ProcessOneEvent (void)
       // We use tsNow as the indication of the current real time.
       //
       uint64_t tsNow;
+      InboundEvent *drained;
 
       { 
         CriticalSection cs (m_mutex);
+        //
+        // Move the events scheduled by other threads to the event list, so
+        // that NextTs sees them.
+        //
+        drained = DrainInbound ();
+
         //
         // Since we are in realtime mode, the time to delay has got to be the 
         // difference between the current realtime and the timestamp of the next 
@@ -259,6 +296,7 @@ RealtimeSimulatorImpl::ProcessOneEvent (void)
         //
         m_synchronizer->SetCondition (false);
       }
+      ReleaseInbound (drained);
 
       //
       // We have a time to delay.  This time may actually not be valid anymore
@@ -294,7 +332,17 @@ RealtimeSimulatorImpl::ProcessOneEvent (void)
       // It is expected that tsDelay become shorter as external events interrupt our
       // waits.
       //
-      if (m_synchronizer->Synchronize (tsNow, tsDelay))
+      // The events scheduled by other threads through the inbound queue only
+      // signal the synchronizer if we are parked in it (see Park).  If we have
+      // been configured to, we first poll the inbound queue for a while, which
+      // saves the sleep and the wakeup when the events come in quick succession.
+      //
+      if (tsDelay > 0 && m_inboundSpinTime.IsStrictlyPositive ()
+          && SpinInbound (tsNow + std::min (tsDelay, static_cast<uint64_t> (m_inboundSpinTime.GetTimeStep ()))))
+        {
+          continue;
+        }
+      if (Park (tsNow, tsDelay))
         {
           NS_LOG_LOGIC ("Interrupted ...");
           break;
@@ -317,10 +365,19 @@ RealtimeSimulatorImpl::ProcessOneEvent (void)
   // whatever event is at the head of this list if the list is in time order.
   //
   Scheduler::Event next;
+  InboundEvent *drained;
 
   { 
     CriticalSection cs (m_mutex);
 
+    //
+    // Events may have been pushed on the inbound queue since we drained it in
+    // the loop above, and one of them may be due before the event we waited
+    // for.  Insert them before pulling the next event, as if they had been
+    // scheduled directly in the event list.
+    //
+    drained = DrainInbound ();
+
     // 
     // We do know we're waiting for an event, so there had better be an event on the 
     // event queue.  Let's pull it off.  When we release the critical section, the
@@ -382,12 +439,18 @@ RealtimeSimulatorImpl::ProcessOneEvent (void)
           }
       }
   }
+  ReleaseInbound (drained);
 
   //
   // We have got the event we're about to execute completely disentangled from the 
   // event list so we can execute it outside a critical section without fear of someone
   // changing things out from under us.
 
+  uint64_t tsStart = m_synchronizer->GetCurrentRealtime ();
+  uint64_t lag = tsStart > next.key.m_ts ? tsStart - next.key.m_ts : 0;
+  AddToHistogram (m_eventLagHistogram, lag);
+  m_eventLagTrace (TimeStep (lag));
+
   EventImpl *event = next.impl;
   m_synchronizer->EventStart ();
   event->Invoke ();
@@ -401,7 +464,7 @@ RealtimeSimulatorImpl::IsFinished (void) const
   bool rc;
   {
     CriticalSection cs (m_mutex);
-    rc = m_events->IsEmpty () || m_stop;
+    rc = (m_events->IsEmpty () && m_inbound.load () == 0) || m_stop;
   }
 
   return rc;
@@ -441,9 +504,11 @@ RealtimeSimulatorImpl::Run (void)
   while (!m_stop) 
     {
       bool process = false;
+      InboundEvent *drained;
       {
         CriticalSection cs (m_mutex);
 
+        drained = DrainInbound ();
         if (!m_events->IsEmpty ())
           {
             process = true;
@@ -452,13 +517,19 @@ RealtimeSimulatorImpl::Run (void)
           {
             // Get current timestamp while holding the critical section
             tsNow = m_synchronizer->GetCurrentRealtime ();
+            m_synchronizer->SetCondition (false);
           }
       }
+      ReleaseInbound (drained);
  
       if (!process)
         {
-          // Sleep until signalled
-          tsNow = m_synchronizer->Synchronize (tsNow, tsDelay);
+          // Poll for the events of other threads, then sleep until signalled
+          if (!m_inboundSpinTime.IsStrictlyPositive ()
+              || !SpinInbound (tsNow + m_inboundSpinTime.GetTimeStep ()))
+            {
+              Park (tsNow, tsDelay);
+            }
 
           // Re-check event queue
           continue;
@@ -544,23 +615,21 @@ RealtimeSimulatorImpl::ScheduleWithContext (uint32_t context, Time const &delay,
 {
   NS_LOG_FUNCTION (this << context << delay << impl);
 
+  if (!SystemThread::Equals (m_main))
+    {
+      //
+      // If the simulator is running, we're pacing and have a meaningful 
+      // realtime clock.  If we're not, then m_currentTs is where we stopped.
+      // 
+      uint64_t realtime = m_synchronizer->GetCurrentRealtime ();
+      uint64_t ts = m_running ? realtime : m_currentTs.load ();
+      PushInbound (context, ts + delay.GetTimeStep (), realtime, impl);
+      return;
+    }
+
   {
     CriticalSection cs (m_mutex);
-    uint64_t ts;
-
-    if (SystemThread::Equals (m_main))
-      {
-        ts = m_currentTs + delay.GetTimeStep ();
-      }
-    else
-      {
-        //
-        // If the simulator is running, we're pacing and have a meaningful 
-        // realtime clock.  If we're not, then m_currentTs is where we stopped.
-        // 
-        ts = m_running ? m_synchronizer->GetCurrentRealtime () : m_currentTs;
-        ts += delay.GetTimeStep ();
-      }
+    uint64_t ts = m_currentTs + delay.GetTimeStep ();
 
     NS_ASSERT_MSG (ts >= m_currentTs, "RealtimeSimulatorImpl::ScheduleRealtime(): schedule for time < m_currentTs");
     Scheduler::Event ev;
@@ -610,6 +679,13 @@ RealtimeSimulatorImpl::ScheduleRealtimeWithContext (uint32_t context, Time const
 {
   NS_LOG_FUNCTION (this << context << time << impl);
 
+  if (!SystemThread::Equals (m_main))
+    {
+      uint64_t realtime = m_synchronizer->GetCurrentRealtime ();
+      PushInbound (context, realtime + time.GetTimeStep (), realtime, impl);
+      return;
+    }
+
   {
     CriticalSection cs (m_mutex);
 
@@ -618,6 +694,7 @@ RealtimeSimulatorImpl::ScheduleRealtimeWithContext (uint32_t context, Time const
     Scheduler::Event ev;
     ev.impl = impl;
     ev.key.m_ts = ts;
+    ev.key.m_context = context;
     ev.key.m_uid = m_uid;
     m_uid++;
     m_unscheduledEvents++;
@@ -637,6 +714,14 @@ void
 RealtimeSimulatorImpl::ScheduleRealtimeNowWithContext (uint32_t context, EventImpl *impl)
 {
   NS_LOG_FUNCTION (this << context << impl);
+
+  if (!SystemThread::Equals (m_main))
+    {
+      uint64_t realtime = m_synchronizer->GetCurrentRealtime ();
+      PushInbound (context, m_running ? realtime : m_currentTs.load (), realtime, impl);
+      return;
+    }
+
   {
     CriticalSection cs (m_mutex);
 
@@ -644,7 +729,7 @@ RealtimeSimulatorImpl::ScheduleRealtimeNowWithContext (uint32_t context, EventIm
     // If the simulator is running, we're pacing and have a meaningful 
     // realtime clock.  If we're not, then m_currentTs is were we stopped.
     // 
-    uint64_t ts = m_running ? m_synchronizer->GetCurrentRealtime () : m_currentTs;
+    uint64_t ts = m_running ? m_synchronizer->GetCurrentRealtime () : m_currentTs.load ();
     NS_ASSERT_MSG (ts >= m_currentTs, 
                    "RealtimeSimulatorImpl::ScheduleRealtimeNowWithContext(): schedule for time < m_currentTs");
     Scheduler::Event ev;
@@ -666,6 +751,155 @@ RealtimeSimulatorImpl::ScheduleRealtimeNow (EventImpl *impl)
   ScheduleRealtimeNowWithContext (GetContext (), impl);
 }
 
+void
+RealtimeSimulatorImpl::PushInbound (uint32_t context, uint64_t ts, uint64_t realtime, EventImpl *impl)
+{
+  InboundEvent *inbound = new InboundEvent;
+  inbound->impl = impl;
+  inbound->ts = ts;
+  inbound->realtime = realtime;
+  inbound->context = context;
+
+  //
+  // The inbound queue is a stack of the pushed events.  The main thread only
+  // ever takes the whole stack at once, so there is no ABA problem here.
+  //
+  inbound->next = m_inbound.load (std::memory_order_relaxed);
+  while (!m_inbound.compare_exchange_weak (inbound->next, inbound))
+    {
+    }
+
+  //
+  // Park sets m_parked before checking the inbound queue, and we check
+  // m_parked after pushing on it: either the main thread sees our event,
+  // or we see that it is parked and wake it up.  Only one thread needs to.
+  //
+  if (m_parked.load () && m_parked.exchange (false))
+    {
+      m_synchronizer->Signal ();
+    }
+}
+
+RealtimeSimulatorImpl::InboundEvent *
+RealtimeSimulatorImpl::DrainInbound (void)
+{
+  InboundEvent *inbound = m_inbound.exchange (0);
+  if (inbound == 0)
+    {
+      return 0;
+    }
+
+  // Reverse the stack to insert the events in the order they were pushed
+  InboundEvent *drained = 0;
+  while (inbound != 0)
+    {
+      InboundEvent *next = inbound->next;
+      inbound->next = drained;
+      drained = inbound;
+      inbound = next;
+    }
+
+  for (InboundEvent *i = drained; i != 0; i = i->next)
+    {
+      //
+      // We may have executed an event timestamped later than the real time
+      // at which this one was pushed.  Time cannot move backward, so it runs
+      // right away.
+      //
+      Scheduler::Event ev;
+      ev.impl = i->impl;
+      ev.key.m_ts = std::max (i->ts, m_currentTs.load ());
+      ev.key.m_context = i->context;
+      ev.key.m_uid = m_uid;
+      m_uid++;
+      m_unscheduledEvents++;
+      m_events->Insert (ev);
+    }
+  return drained;
+}
+
+void
+RealtimeSimulatorImpl::ReleaseInbound (InboundEvent *drained)
+{
+  if (drained == 0)
+    {
+      return;
+    }
+  uint64_t realtime = m_synchronizer->GetCurrentRealtime ();
+  while (drained != 0)
+    {
+      uint64_t lag = realtime > drained->realtime ? realtime - drained->realtime : 0;
+      AddToHistogram (m_inboundLagHistogram, lag);
+      m_inboundLagTrace (TimeStep (lag));
+      InboundEvent *next = drained->next;
+      delete drained;
+      drained = next;
+    }
+}
+
+bool
+RealtimeSimulatorImpl::SpinInbound (uint64_t tsUntil) const
+{
+  while (m_inbound.load () == 0)
+    {
+      if (m_stop || m_synchronizer->GetCurrentRealtime () >= tsUntil)
+        {
+          return false;
+        }
+    }
+  return true;
+}
+
+bool
+RealtimeSimulatorImpl::Park (uint64_t tsNow, uint64_t tsDelay)
+{
+  m_parked = true;
+  if (m_inbound.load () != 0)
+    {
+      m_parked = false;
+      return false;
+    }
+  bool rc = m_synchronizer->Synchronize (tsNow, tsDelay);
+  m_parked = false;
+  return rc;
+}
+
+void
+RealtimeSimulatorImpl::AddToHistogram (std::vector<uint64_t> &histogram, uint64_t lag)
+{
+  std::size_t bin = 0;
+  while (lag != 0)
+    {
+      bin++;
+      lag >>= 1;
+    }
+  if (bin >= histogram.size ())
+    {
+      histogram.resize (bin + 1, 0);
+    }
+  histogram[bin]++;
+}
+
+std::vector<uint64_t>
+RealtimeSimulatorImpl::GetEventLagHistogram (void) const
+{
+  return m_eventLagHistogram;
+}
+
+std::vector<uint64_t>
+RealtimeSimulatorImpl::GetInboundLagHistogram (void) const
+{
+  return m_inboundLagHistogram;
+}
+
+void
+RealtimeSimulatorImpl::ResetLagHistograms (void)
+{
+  NS_LOG_FUNCTION (this);
+  m_eventLagHistogram.clear ();
+  m_inboundLagHistogram.clear ();
+}
+
 Time
 RealtimeSimulatorImpl::RealtimeNow (void) const
 {
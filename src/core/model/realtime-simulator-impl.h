@@ -30,8 +30,12 @@
 #include "assert.h"
 #include "log.h"
 #include "system-mutex.h"
+#include "nstime.h"
+#include "traced-callback.h"
 
+#include <atomic>
 #include <list>
+#include <vector>
 
 /**
  * \file
@@ -52,6 +56,15 @@ namespace ns3 {
  * \ingroup realtime
  *
  * Realtime version of SimulatorImpl.
+ *
+ * The events scheduled by threads other than the main one, such as the
+ * FdReader threads of the emulation devices, with ScheduleWithContext,
+ * ScheduleRealtimeWithContext or ScheduleRealtimeNowWithContext are pushed
+ * on a lock-free inbound queue.  The main thread moves them to the event
+ * list in batches, before looking for the next event to execute.  The
+ * other threads only signal the synchronizer when the main thread is
+ * parked in it; with the InboundSpinTime attribute, the main thread polls
+ * the inbound queue for a while before parking.
  */
 class RealtimeSimulatorImpl : public SimulatorImpl
 {
@@ -155,6 +168,38 @@ public:
    */
   Time GetHardLimit (void) const;
 
+  /**
+   * Get the histogram of the lag of the event executions behind real
+   * time, that is the wall-clock time at the start of each event minus
+   * its timestamp.
+   *
+   * Bin 0 counts the lags of zero; bin \c i > 0 counts the lags in
+   * [2<sup>i-1</sup>, 2<sup>i</sup>) time steps.  Trailing empty bins are
+   * not returned.
+   *
+   * \returns The event lag histogram.
+   */
+  std::vector<uint64_t> GetEventLagHistogram (void) const;
+  /**
+   * Get the histogram of the wall-clock time spent by the events
+   * scheduled by other threads in the inbound queue, before the
+   * simulator thread inserts them in the event list.
+   *
+   * The bins are the same as those of GetEventLagHistogram().
+   *
+   * \returns The inbound lag histogram.
+   */
+  std::vector<uint64_t> GetInboundLagHistogram (void) const;
+  /** Reset the event lag and inbound lag histograms. */
+  void ResetLagHistograms (void);
+
+  /**
+   * TracedCallback signature for the lag trace sources.
+   *
+   * \param [in] lag The wall-clock lag.
+   */
+  typedef void (* LagTracedCallback)(Time lag);
+
 private:
   /**
    * Is the simulator running?
@@ -176,14 +221,83 @@ private:
   /** Destructor implementation. */
   virtual void DoDispose (void);
 
+  /** An event scheduled by another thread, waiting in the inbound queue. */
+  struct InboundEvent
+  {
+    EventImpl *impl;       /**< The event implementation. */
+    uint64_t ts;           /**< The event timestamp. */
+    uint64_t realtime;     /**< The real time when the event was pushed. */
+    uint32_t context;      /**< The event context. */
+    InboundEvent *next;    /**< The event pushed before this one. */
+  };
+
+  /**
+   * Push an event scheduled by a thread other than the main one on the
+   * inbound queue, without taking #m_mutex, and wake up the main thread
+   * if it is parked in the synchronizer.
+   *
+   * \param [in] context The event context.
+   * \param [in] ts The event timestamp.
+   * \param [in] realtime The current real time.
+   * \param [in] impl The event implementation.
+   */
+  void PushInbound (uint32_t context, uint64_t ts, uint64_t realtime, EventImpl *impl);
+  /**
+   * Move all the events of the inbound queue to the event list, in the
+   * order they were pushed.  Must be called by the main thread with
+   * #m_mutex held.
+   *
+   * \returns The drained events, to be passed to ReleaseInbound.
+   */
+  InboundEvent * DrainInbound (void);
+  /**
+   * Record the inbound lags of drained events and delete them.  Must be
+   * called by the main thread without #m_mutex held, since the trace
+   * sinks may schedule events.
+   *
+   * \param [in] drained The events returned by DrainInbound.
+   */
+  void ReleaseInbound (InboundEvent *drained);
+  /**
+   * Poll the inbound queue until an event is pushed, the simulation is
+   * stopped, or the real time reaches a limit.
+   *
+   * \param [in] tsUntil The real time to poll until.
+   * \returns \c true if the inbound queue is not empty.
+   */
+  bool SpinInbound (uint64_t tsUntil) const;
+  /**
+   * Wait in the synchronizer, after making sure it will be signaled by
+   * PushInbound.  The condition of the synchronizer must have been reset
+   * before calling this method.
+   *
+   * \param [in] tsNow The current real time.
+   * \param [in] tsDelay The time to wait.
+   * \returns The value returned by Synchronizer::Synchronize, or \c false
+   *   if the inbound queue was not empty.
+   */
+  bool Park (uint64_t tsNow, uint64_t tsDelay);
+  /**
+   * Add a lag to a histogram.
+   *
+   * \param [in,out] histogram The histogram.
+   * \param [in] lag The lag, in time steps.
+   */
+  static void AddToHistogram (std::vector<uint64_t> &histogram, uint64_t lag);
+
   /** Container type for events to be run at destroy time. */
   typedef std::list<EventId> DestroyEvents;
   /** Container for events to be run at destroy time. */
   DestroyEvents m_destroyEvents;
   /** Has the stopping condition been reached? */
   bool m_stop;
-  /** Is the simulator currently running. */
-  bool m_running;
+  /**
+   * Is the simulator currently running.
+   *
+   * Atomic since the threads which push on the inbound queue read it
+   * without #m_mutex.
+   */
+  std::atomic<bool> m_running;
 
   /**
    * \name Mutex-protected variables.
@@ -199,8 +313,13 @@ private:
   uint32_t m_uid;
   /**< Unique id of the current event. */
   uint32_t m_currentUid;
-  /**< Timestep of the current event. */
-  uint64_t m_currentTs;
+  /**
+   * Timestep of the current event.
+   *
+   * Written with #m_mutex held, but atomic since the threads which push
+   * on the inbound queue read it without #m_mutex.
+   */
+  std::atomic<uint64_t> m_currentTs;
   /**< Execution context. */
   uint32_t m_currentContext;  
   /** The event count. */
@@ -221,6 +340,22 @@ private:
 
   /** Main SystemThread. */
   SystemThread::ThreadId m_main;
+
+  /** The last event pushed on the inbound queue, or 0 if it is empty. */
+  std::atomic<InboundEvent *> m_inbound;
+  /** Is the main thread parked in the synchronizer, waiting for a signal? */
+  std::atomic<bool> m_parked;
+  /** Wall-clock time to poll the inbound queue before parking. */
+  Time m_inboundSpinTime;
+
+  /** The event lag histogram, updated by the main thread. */
+  std::vector<uint64_t> m_eventLagHistogram;
+  /** The inbound lag histogram, updated by the main thread. */
+  std::vector<uint64_t> m_inboundLagHistogram;
+  /** Trace of the lag of each event execution behind real time. */
+  TracedCallback<Time> m_eventLagTrace;
+  /** Trace of the time spent by each event in the inbound queue. */
+  TracedCallback<Time> m_inboundLagTrace;
 };
 
 } // namespace ns3
@@ -23,7 +23,7 @@
 #include "singleton.h"
 #include "trace-source-accessor.h"
 
-#include <map>
+#include <algorithm>
 #include <vector>
 #include <sstream>
 #include <iomanip>
@@ -51,7 +51,10 @@ NS_LOG_COMPONENT_DEFINE ("TypeId");
  * \brief TypeId information manager
  *
  * Information records are stored in a vector.  Name and hash lookup
- * are performed by maps to the vector index.
+ * are performed by an open addressing hash table of the vector indexes,
+ * probed from the type id hash.  Each record also keeps an open
+ * addressing table of the Attributes and TraceSources of the type id
+ * and its parents, by name, which is built on the first lookup.
  *
  * \internal
  * <b>Hash Chaining</b>
@@ -78,6 +81,8 @@ NS_LOG_COMPONENT_DEFINE ("TypeId");
 class IidManager : public Singleton<IidManager>
 {
 public:
+  /** Constructor. */
+  IidManager ();
   /**
    * Create a new unique type id.
    * \param [in] name The name of this type id.
@@ -118,7 +123,7 @@ public:
    * \param [in] name The type id to find.
    * \returns The type id.  A type id of 0 means \p name wasn't found.
    */
-  uint16_t GetUid (std::string name) const;
+  uint16_t GetUid (const std::string &name) const;
   /**
    * Get a type id by hash value.
    * \param [in] hash The type id to find.
@@ -264,6 +269,22 @@ public:
    * \returns Detailed information about the requested trace source.
    */
   struct TypeId::TraceSourceInformation GetTraceSource (uint16_t uid, std::size_t i) const;
+  /**
+   * Find an Attribute of a type id or of its parents by name.
+   * \param [in] uid The id.
+   * \param [in] name The Attribute name.
+   * \returns The information about the Attribute, or 0 if
+   *          \p uid and its parents have no Attribute \p name.
+   */
+  const struct TypeId::AttributeInformation * LookupAttribute (uint16_t uid, const std::string &name) const;
+  /**
+   * Find a TraceSource of a type id or of its parents by name.
+   * \param [in] uid The id.
+   * \param [in] name The TraceSource name.
+   * \returns The information about the TraceSource, or 0 if
+   *          \p uid and its parents have no TraceSource \p name.
+   */
+  const struct TypeId::TraceSourceInformation * LookupTraceSource (uint16_t uid, const std::string &name) const;
   /**
    * Check if this TypeId should not be listed in documentation.
    * \param [in] uid The id.
@@ -293,6 +314,18 @@ private:
    */
   static TypeId::hash_t Hasher (const std::string name);
 
+  /** An entry of the index of the Attributes or TraceSources of a type id. */
+  struct MemberIndexEntry {
+    /** The hash of the Attribute or TraceSource name. */
+    TypeId::hash_t hash;
+    /** The type id declaring the Attribute or TraceSource, 0 if the entry is empty. */
+    uint16_t uid;
+    /** The index of the Attribute or TraceSource in this type id. */
+    std::size_t i;
+  };
+  /** Type of the open addressing index of Attributes or TraceSources by name. */
+  typedef std::vector<struct MemberIndexEntry> memberindex_t;
+
   /** The information record about a single type id. */
   struct IidInformation {
     /** The type id name. */
@@ -319,6 +352,12 @@ private:
     TypeId::SupportLevel supportLevel;
     /** Support message. */
     std::string supportMsg;
+    /** The index of the Attributes of this type id and its parents. */
+    memberindex_t attributeIndex;
+    /** The index of the TraceSources of this type id and its parents. */
+    memberindex_t traceSourceIndex;
+    /** The type ids whose parent is this type id. */
+    std::vector<uint16_t> children;
   };
   /** Iterator type. */
   typedef std::vector<struct IidInformation>::const_iterator Iterator;
@@ -329,19 +368,58 @@ private:
    * \returns The information record.
    */
   struct IidManager::IidInformation *LookupInformation (uint16_t uid) const;
+  /**
+   * Insert a type id in the by-name and by-hash index, growing the
+   * index if it becomes more than half full.
+   * \param [in] uid The id.
+   */
+  void InsertUid (uint16_t uid);
+  /**
+   * Get the name of an Attribute or a TraceSource.
+   * \param [in] attribute \c true for an Attribute, \c false for a TraceSource.
+   * \param [in] uid The id declaring the Attribute or the TraceSource.
+   * \param [in] i The index of the Attribute or the TraceSource.
+   * \returns The name.
+   */
+  const std::string & GetMemberName (bool attribute, uint16_t uid, std::size_t i) const;
+  /**
+   * Find an Attribute or a TraceSource by name in an index.
+   * \param [in] index The index of the Attributes or the TraceSources.
+   * \param [in] attribute \c true for an Attribute, \c false for a TraceSource.
+   * \param [in] name The name.
+   * \param [in] hash The hash of \p name.
+   * \returns The entry of \p name in \p index, or 0 if there is none.
+   */
+  const struct MemberIndexEntry * FindMember (const memberindex_t &index, bool attribute,
+                                              const std::string &name, TypeId::hash_t hash) const;
+  /**
+   * Build the index of the Attributes or TraceSources of a type id and
+   * its parents.  Members of a type id hide the members of its parents
+   * with the same name.
+   * \param [in] uid The id.
+   * \param [in] attribute \c true for the Attributes, \c false for the TraceSources.
+   * \param [out] index The index.
+   */
+  void BuildMemberIndex (uint16_t uid, bool attribute, memberindex_t *index) const;
+  /**
+   * Rebuild the Attribute and TraceSource indexes of a type id and of
+   * the type ids inheriting from it, when their members change.  The
+   * indexes are only updated at registration time, so that lookups
+   * never modify them.
+   * \param [in] uid The id.
+   */
+  void UpdateMemberIndexes (uint16_t uid);
 
   /** The container of all type id records. */
   std::vector<struct IidInformation> m_information;
 
-  /** Type of the by-name index. */
-  typedef std::map<std::string, uint16_t> namemap_t;
-  /** The by-name index. */
-  namemap_t m_namemap;
+  /**
+   * The by-name and by-hash index: an open addressing hash table of
+   * type ids, 0 for an empty slot, probed linearly from the type id
+   * hash without the chaining flag.  Its size is a power of two.
+   */
+  std::vector<uint16_t> m_index;
 
-  /** Type of the by-hash index. */
-  typedef std::map<TypeId::hash_t, uint16_t> hashmap_t;
-  /** The by-hash index. */
-  hashmap_t m_hashmap;
 
 
   /** IidManager constants. */
@@ -378,16 +456,21 @@ IidManager::Hasher (const std::string name)
  */
 #define IIDL IID << ": "
 
+IidManager::IidManager ()
+  : m_index (1024, 0)
+{
+}
+
 uint16_t
 IidManager::AllocateUid (std::string name)
 {
   NS_LOG_FUNCTION (IID << name);
   // Type names are definitive: equal names are equal types
-  NS_ASSERT_MSG (m_namemap.count (name) == 0,
+  NS_ASSERT_MSG (GetUid (name) == 0,
                  "Trying to allocate twice the same uid: " << name);
   
   TypeId::hash_t hash = Hasher (name) & (~HashChainFlag);
-  if (m_hashmap.count (hash) == 1) {
+  if (GetUid (hash) != 0) {
     NS_LOG_ERROR ("Hash chaining TypeId for '" << name << "'.  "
                  << "This is not a bug, but is extremely unlikely.  "
                  << "Please contact the ns3 developers.");
@@ -403,7 +486,7 @@ IidManager::AllocateUid (std::string name)
     //  Oh, by the way, I owe you a beer, since I bet Mathieu that
     //  this would never happen..  -- Peter Barnes, LLNL
 
-    NS_ASSERT_MSG (m_hashmap.count (hash | HashChainFlag) == 0,
+    NS_ASSERT_MSG (GetUid (hash | HashChainFlag) == 0,
                    "Triplicate hash detected while chaining TypeId for '"
                    << name
                    << "'. Please contact the ns3 developers for assistance.");
@@ -423,10 +506,9 @@ IidManager::AllocateUid (std::string name)
     else
       { // chain old type
         NS_LOG_LOGIC (IIDL << "Old TypeId '" << hinfo->name << "' getting chained.");
-        uint16_t oldUid = GetUid (hinfo->hash);
-        m_hashmap.erase (m_hashmap.find (hinfo->hash));
+        // the index is probed from the unchained hash, so the old
+        // type stays in place
         hinfo->hash = hash | HashChainFlag;
-        m_hashmap.insert (std::make_pair (hinfo->hash, oldUid));
         // leave new hash unchained
       }
   }
@@ -444,13 +526,36 @@ IidManager::AllocateUid (std::string name)
   NS_ASSERT (tuid <= 0xffff);
   uint16_t uid = static_cast<uint16_t> (tuid);
 
-  // Add to both maps:
-  m_namemap.insert (std::make_pair (name, uid));
-  m_hashmap.insert (std::make_pair (hash, uid));
+  InsertUid (uid);
   NS_LOG_LOGIC (IIDL << uid);
   return uid;
 }
 
+void
+IidManager::InsertUid (uint16_t uid)
+{
+  NS_LOG_FUNCTION (IID << uid);
+  if (2 * m_information.size () > m_index.size ())
+    {
+      std::vector<uint16_t> index (2 * m_index.size (), 0);
+      m_index.swap (index);
+      for (std::vector<uint16_t>::const_iterator it = index.begin (); it != index.end (); ++it)
+        {
+          if (*it != 0)
+            {
+              InsertUid (*it);
+            }
+        }
+    }
+  std::size_t mask = m_index.size () - 1;
+  std::size_t slot = (LookupInformation (uid)->hash & (~HashChainFlag)) & mask;
+  while (m_index[slot] != 0)
+    {
+      slot = (slot + 1) & mask;
+    }
+  m_index[slot] = uid;
+}
+
 struct IidManager::IidInformation *
 IidManager::LookupInformation (uint16_t uid) const
 {
@@ -466,7 +571,21 @@ IidManager::SetParent (uint16_t uid, uint16_t parent)
   NS_LOG_FUNCTION (IID << uid << parent);
   NS_ASSERT (parent <= m_information.size ());
   struct IidInformation *information = LookupInformation (uid);
+  if (information->parent == parent)
+    {
+      return;
+    }
+  if (information->parent != 0 && information->parent != uid)
+    {
+      std::vector<uint16_t> &siblings = LookupInformation (information->parent)->children;
+      siblings.erase (std::find (siblings.begin (), siblings.end (), uid));
+    }
   information->parent = parent;
+  if (parent != 0 && parent != uid)
+    {
+      LookupInformation (parent)->children.push_back (uid);
+    }
+  UpdateMemberIndexes (uid);
 }
 void 
 IidManager::SetGroupName (uint16_t uid, std::string groupName)
@@ -504,14 +623,20 @@ IidManager::AddConstructor (uint16_t uid, Callback<ObjectBase *> callback)
 }
 
 uint16_t 
-IidManager::GetUid (std::string name) const
+IidManager::GetUid (const std::string &name) const
 {
   NS_LOG_FUNCTION (IID << name);
+  TypeId::hash_t hash = Hasher (name) & (~HashChainFlag);
+  std::size_t mask = m_index.size () - 1;
   uint16_t uid = 0;
-  namemap_t::const_iterator it = m_namemap.find (name);
-  if (it != m_namemap.end ())
+  for (std::size_t slot = hash & mask; m_index[slot] != 0; slot = (slot + 1) & mask)
     {
-      uid = it->second;
+      const struct IidInformation &information = m_information[m_index[slot] - 1];
+      if ((information.hash & (~HashChainFlag)) == hash && information.name == name)
+        {
+          uid = m_index[slot];
+          break;
+        }
     }
   NS_LOG_LOGIC (IIDL << uid);
   return uid;
@@ -520,11 +645,15 @@ uint16_t
 IidManager::GetUid (TypeId::hash_t hash) const
 {
   NS_LOG_FUNCTION (IID << hash);
-  hashmap_t::const_iterator it = m_hashmap.find (hash);
+  std::size_t mask = m_index.size () - 1;
   uint16_t uid = 0;
-  if (it != m_hashmap.end ())
+  for (std::size_t slot = (hash & (~HashChainFlag)) & mask; m_index[slot] != 0; slot = (slot + 1) & mask)
     {
-      uid = it->second;
+      if (m_information[m_index[slot] - 1].hash == hash)
+        {
+          uid = m_index[slot];
+          break;
+        }
     }
   NS_LOG_LOGIC (IIDL << uid);
   return uid;
@@ -676,6 +805,7 @@ IidManager::AddAttribute (uint16_t uid,
   info.supportLevel = supportLevel;
   info.supportMsg = supportMsg;
   information->attributes.push_back (info);
+  UpdateMemberIndexes (uid);
   NS_LOG_LOGIC (IIDL << information->attributes.size () - 1);
 }
 void 
@@ -767,6 +897,7 @@ IidManager::AddTraceSource (uint16_t uid,
   source.supportLevel = supportLevel;
   source.supportMsg = supportMsg;
   information->traceSources.push_back (source);
+  UpdateMemberIndexes (uid);
   NS_LOG_LOGIC (IIDL << information->traceSources.size () - 1);
 }
 std::size_t
@@ -797,6 +928,127 @@ IidManager::MustHideFromDocumentation (uint16_t uid) const
   return hide;
 }
 
+const std::string &
+IidManager::GetMemberName (bool attribute, uint16_t uid, std::size_t i) const
+{
+  const struct IidInformation &information = m_information[uid - 1];
+  return attribute ? information.attributes[i].name : information.traceSources[i].name;
+}
+
+const struct IidManager::MemberIndexEntry *
+IidManager::FindMember (const memberindex_t &index, bool attribute,
+                        const std::string &name, TypeId::hash_t hash) const
+{
+  if (index.empty ())
+    {
+      return 0;
+    }
+  std::size_t mask = index.size () - 1;
+  for (std::size_t slot = hash & mask; index[slot].uid != 0; slot = (slot + 1) & mask)
+    {
+      if (index[slot].hash == hash
+          && GetMemberName (attribute, index[slot].uid, index[slot].i) == name)
+        {
+          return &index[slot];
+        }
+    }
+  return 0;
+}
+
+void
+IidManager::BuildMemberIndex (uint16_t uid, bool attribute, memberindex_t *index) const
+{
+  NS_LOG_FUNCTION (IID << uid << attribute);
+  // Size the index for at most half of the slots to be used
+  std::size_t n = 0;
+  for (uint16_t cur = uid; cur != 0; )
+    {
+      const struct IidInformation &information = m_information[cur - 1];
+      n += attribute ? information.attributes.size () : information.traceSources.size ();
+      cur = (information.parent == cur) ? 0 : information.parent;
+    }
+  std::size_t size = 0;
+  if (n > 0)
+    {
+      size = 2;
+      while (size < 2 * n)
+        {
+          size *= 2;
+        }
+    }
+  struct MemberIndexEntry empty = { 0, 0, 0 };
+  index->assign (size, empty);
+  std::size_t mask = size - 1;
+  // Walk up from the type id, so that the members of the type id hide
+  // the members of its parents with the same name
+  for (uint16_t cur = uid; cur != 0; )
+    {
+      const struct IidInformation &information = m_information[cur - 1];
+      std::size_t nMembers = attribute ? information.attributes.size () : information.traceSources.size ();
+      for (std::size_t i = 0; i < nMembers; i++)
+        {
+          const std::string &name = GetMemberName (attribute, cur, i);
+          TypeId::hash_t hash = Hasher (name);
+          if (FindMember (*index, attribute, name, hash) != 0)
+            {
+              continue;
+            }
+          std::size_t slot = hash & mask;
+          while ((*index)[slot].uid != 0)
+            {
+              slot = (slot + 1) & mask;
+            }
+          (*index)[slot].hash = hash;
+          (*index)[slot].uid = cur;
+          (*index)[slot].i = i;
+        }
+      cur = (information.parent == cur) ? 0 : information.parent;
+    }
+}
+
+void
+IidManager::UpdateMemberIndexes (uint16_t uid)
+{
+  NS_LOG_FUNCTION (IID << uid);
+  struct IidInformation *information = LookupInformation (uid);
+  BuildMemberIndex (uid, true, &information->attributeIndex);
+  BuildMemberIndex (uid, false, &information->traceSourceIndex);
+  // A type id is normally registered after its parent is complete, so
+  // this recursion only happens when members are added to a parent later
+  for (std::size_t i = 0; i < information->children.size (); i++)
+    {
+      UpdateMemberIndexes (information->children[i]);
+    }
+}
+
+const struct TypeId::AttributeInformation *
+IidManager::LookupAttribute (uint16_t uid, const std::string &name) const
+{
+  NS_LOG_FUNCTION (IID << uid << name);
+  const struct IidInformation *information = LookupInformation (uid);
+  const struct MemberIndexEntry *entry = FindMember (information->attributeIndex, true,
+                                                     name, Hasher (name));
+  if (entry == 0)
+    {
+      return 0;
+    }
+  return &m_information[entry->uid - 1].attributes[entry->i];
+}
+
+const struct TypeId::TraceSourceInformation *
+IidManager::LookupTraceSource (uint16_t uid, const std::string &name) const
+{
+  NS_LOG_FUNCTION (IID << uid << name);
+  const struct IidInformation *information = LookupInformation (uid);
+  const struct MemberIndexEntry *entry = FindMember (information->traceSourceIndex, false,
+                                                     name, Hasher (name));
+  if (entry == 0)
+    {
+      return 0;
+    }
+  return &m_information[entry->uid - 1].traceSources[entry->i];
+}
+
 } // namespace ns3
 
 namespace ns3 {
@@ -877,37 +1129,29 @@ bool
 TypeId::LookupAttributeByName (std::string name, struct TypeId::AttributeInformation *info) const
 {
   NS_LOG_FUNCTION (this << name << info);
-  TypeId tid;
-  TypeId nextTid = *this;
-  do {
-      tid = nextTid;
-      for (std::size_t i = 0; i < tid.GetAttributeN (); i++)
-        {
-          struct TypeId::AttributeInformation tmp = tid.GetAttribute (i);
-          if (tmp.name == name)
-            {
-              if (tmp.supportLevel == TypeId::SUPPORTED)
-                {
-                  *info = tmp;
-                  return true;
-                }
-              else if (tmp.supportLevel == TypeId::DEPRECATED)
-                {
-                  std::cerr << "Attribute '" << name << "' is deprecated: "
-                                 << tmp.supportMsg << std::endl;
-                  *info = tmp;
-                  return true;
-                }
-              else if (tmp.supportLevel == TypeId::OBSOLETE)
-                {
-                  NS_FATAL_ERROR ("Attribute '" << name
-                                  << "' is obsolete, with no fallback: "
-                                  << tmp.supportMsg);
-                }
-            }
-        }
-      nextTid = tid.GetParent ();
-    } while (nextTid != tid);
+  const struct TypeId::AttributeInformation *tmp = IidManager::Get ()->LookupAttribute (m_tid, name);
+  if (tmp == 0)
+    {
+      return false;
+    }
+  if (tmp->supportLevel == TypeId::SUPPORTED)
+    {
+      *info = *tmp;
+      return true;
+    }
+  else if (tmp->supportLevel == TypeId::DEPRECATED)
+    {
+      std::cerr << "Attribute '" << name << "' is deprecated: "
+                     << tmp->supportMsg << std::endl;
+      *info = *tmp;
+      return true;
+    }
+  else if (tmp->supportLevel == TypeId::OBSOLETE)
+    {
+      NS_FATAL_ERROR ("Attribute '" << name
+                      << "' is obsolete, with no fallback: "
+                      << tmp->supportMsg);
+    }
   return false;
 }
 
@@ -1137,38 +1381,29 @@ TypeId::LookupTraceSourceByName (std::string name,
                                  struct TraceSourceInformation *info) const
 {
   NS_LOG_FUNCTION (this << name);
-  TypeId tid;
-  TypeId nextTid = *this;
-  struct TypeId::TraceSourceInformation tmp;
-  do {
-      tid = nextTid;
-      for (std::size_t i = 0; i < tid.GetTraceSourceN(); i++)
-        {
-          tmp = tid.GetTraceSource (i);
-          if (tmp.name == name)
-            {
-              if (tmp.supportLevel == TypeId::SUPPORTED)
-                {
-                  *info = tmp;
-                   return tmp.accessor;
-                }
-              else if (tmp.supportLevel == TypeId::DEPRECATED)
-                {
-                  std::cerr << "TraceSource '" << name << "' is deprecated: "
-                                 << tmp.supportMsg << std::endl;
-                  *info = tmp;
-                  return tmp.accessor;
-                }
-              else  if (tmp.supportLevel == TypeId::OBSOLETE)
-                {
-                  NS_FATAL_ERROR ("TraceSource '" << name
-                                  << "' is obsolete, with no fallback: "
-                                  << tmp.supportMsg);
-                }
-            }
-        }
-      nextTid = tid.GetParent ();
-    } while (nextTid != tid);
+  const struct TypeId::TraceSourceInformation *tmp = IidManager::Get ()->LookupTraceSource (m_tid, name);
+  if (tmp == 0)
+    {
+      return 0;
+    }
+  if (tmp->supportLevel == TypeId::SUPPORTED)
+    {
+      *info = *tmp;
+      return tmp->accessor;
+    }
+  else if (tmp->supportLevel == TypeId::DEPRECATED)
+    {
+      std::cerr << "TraceSource '" << name << "' is deprecated: "
+                     << tmp->supportMsg << std::endl;
+      *info = *tmp;
+      return tmp->accessor;
+    }
+  else  if (tmp->supportLevel == TypeId::OBSOLETE)
+    {
+      NS_FATAL_ERROR ("TraceSource '" << name
+                      << "' is obsolete, with no fallback: "
+                      << tmp->supportMsg);
+    }
   return 0;
 }
 
@@ -165,6 +165,8 @@ void
 ConfigTestObject::AddNodeA (Ptr<ConfigTestObject> a)
 {
   m_nodesA.push_back (a);
+  // NodesA is registered as a cached container by CachedPathConfigTestCase
+  Config::InvalidateCache ();
 }
 
 void 
@@ -775,6 +777,90 @@ ObjectVectorTraceConfigTestCase::DoRun (void)
   NS_TEST_ASSERT_MSG_EQ (m_path, "/NodeA/NodeB/NodesB/1/Source", "Trace 1 did not provide expected context");
 }
 
+/**
+ * \ingroup config-tests
+ * Test for the ability to trace connect with a TraceContext.
+ */
+class TraceContextConfigTestCase : public TestCase
+{
+public:
+  /** Constructor. */
+  TraceContextConfigTestCase ();
+  /** Destructor. */
+  virtual ~TraceContextConfigTestCase () {}
+
+  /**
+   * Trace callback with TraceContext.
+   * \param context The context.
+   * \param old The old value.
+   * \param newValue The new value.
+   */
+  void TraceWithContext (Ptr<const Config::TraceContext> context, int16_t old, int16_t newValue)
+  {
+    NS_UNUSED (old);
+    m_newValue = newValue;
+    m_context = context;
+  }
+
+private:
+  virtual void DoRun (void);
+
+  int16_t m_newValue; //!< Flag to detect tracing result.
+  Ptr<const Config::TraceContext> m_context; //!< The context.
+};
+
+TraceContextConfigTestCase::TraceContextConfigTestCase ()
+  : TestCase ("Check ability to trace connect through vectors of Object with a TraceContext")
+{
+}
+
+void
+TraceContextConfigTestCase::DoRun (void)
+{
+  Ptr<ConfigTestObject> root = CreateObject<ConfigTestObject> ();
+  Config::RegisterRootNamespaceObject (root);
+  Ptr<ConfigTestObject> a = CreateObject<ConfigTestObject> ();
+  root->SetNodeA (a);
+  Ptr<ConfigTestObject> b = CreateObject<ConfigTestObject> ();
+  a->SetNodeB (b);
+  Ptr<ConfigTestObject> obj0 = CreateObject<ConfigTestObject> ();
+  Ptr<ConfigTestObject> obj1 = CreateObject<ConfigTestObject> ();
+  Ptr<ConfigTestObject> obj2 = CreateObject<ConfigTestObject> ();
+  b->AddNodeB (obj0);
+  b->AddNodeB (obj1);
+  b->AddNodeB (obj2);
+
+  Config::ConnectWithTraceContext ("/NodeA/NodeB/NodesB/0|2/Source",
+                                   MakeCallback (&TraceContextConfigTestCase::TraceWithContext, this));
+
+  m_newValue = 0;
+  obj0->SetAttribute ("Source", IntegerValue (1));
+  NS_TEST_ASSERT_MSG_EQ (m_newValue, 1, "Trace 0 did not fire as expected");
+  NS_TEST_ASSERT_MSG_NE (m_context, 0, "Trace 0 did not provide a context");
+  NS_TEST_ASSERT_MSG_EQ (m_context->GetObject (), obj0, "Trace 0 did not provide the expected object");
+  NS_TEST_ASSERT_MSG_EQ (m_context->GetNIndices (), 1, "Trace 0 did not provide the expected indices");
+  NS_TEST_ASSERT_MSG_EQ (m_context->GetIndex (0), 0, "Trace 0 did not provide the expected index");
+  NS_TEST_ASSERT_MSG_EQ (m_context->GetName (), "Source", "Trace 0 did not provide the expected name");
+  NS_TEST_ASSERT_MSG_EQ (m_context->GetPath (), "/NodeA/NodeB/NodesB/0/Source", "Trace 0 did not provide the expected path");
+
+  m_newValue = 0;
+  m_context = 0;
+  obj1->SetAttribute ("Source", IntegerValue (2));
+  NS_TEST_ASSERT_MSG_EQ (m_newValue, 0, "Trace 1 fired unexpectedly");
+  NS_TEST_ASSERT_MSG_EQ (m_context, 0, "Trace 1 fired unexpectedly");
+
+  m_newValue = 0;
+  obj2->SetAttribute ("Source", IntegerValue (3));
+  NS_TEST_ASSERT_MSG_EQ (m_newValue, 3, "Trace 2 did not fire as expected");
+  NS_TEST_ASSERT_MSG_NE (m_context, 0, "Trace 2 did not provide a context");
+  NS_TEST_ASSERT_MSG_EQ (m_context->GetObject (), obj2, "Trace 2 did not provide the expected object");
+  NS_TEST_ASSERT_MSG_EQ (m_context->GetIndex (0), 2, "Trace 2 did not provide the expected index");
+  NS_TEST_ASSERT_MSG_EQ (m_context->GetPath (), "/NodeA/NodeB/NodesB/2/Source", "Trace 2 did not provide the expected path");
+
+  m_context = 0;
+  Config::UnregisterRootNamespaceObject (root);
+}
+
 /**
  * \ingroup config-tests
  * Test for the ability to search attributes of parent classes
@@ -830,6 +916,130 @@ SearchAttributesOfParentObjectsTestCase::DoRun (void)
 
 }
 
+/**
+ * \ingroup config-tests
+ * Test that the objects matched by the cached path prefixes follow
+ * the changes of the objects reachable from the root.
+ */
+class CachedPathConfigTestCase : public TestCase
+{
+public:
+  /** Constructor. */
+  CachedPathConfigTestCase ();
+  /** Destructor. */
+  virtual ~CachedPathConfigTestCase () {}
+
+private:
+  virtual void DoRun (void);
+};
+
+CachedPathConfigTestCase::CachedPathConfigTestCase ()
+  : TestCase ("Check the cache of the objects matched by paths with wildcards")
+{
+}
+
+void
+CachedPathConfigTestCase::DoRun (void)
+{
+  IntegerValue iv;
+
+  Config::RegisterCachedContainer ("ConfigTestObject", "NodesA");
+  Ptr<ConfigTestObject> root = CreateObject<ConfigTestObject> ();
+  Config::RegisterRootNamespaceObject (root);
+  std::vector<Ptr<ConfigTestObject> > nodes;
+  for (uint32_t i = 0; i < 4; i++)
+    {
+      Ptr<ConfigTestObject> node = CreateObject<ConfigTestObject> ();
+      node->SetNodeB (CreateObject<ConfigTestObject> ());
+      root->AddNodeA (node);
+      nodes.push_back (node);
+    }
+
+  //
+  // Resolve the same prefixes from scratch, then from the cache
+  //
+  Config::MatchContainer matches = Config::LookupMatches ("/NodesA/*/NodeB");
+  NS_TEST_ASSERT_MSG_EQ (matches.GetN (), 4, "Unexpected number of matches");
+  matches = Config::LookupMatches ("/NodesA/*/NodeB");
+  NS_TEST_ASSERT_MSG_EQ (matches.GetN (), 4, "Unexpected number of cached matches");
+  NS_TEST_ASSERT_MSG_EQ (matches.GetMatchedPath (3), "/NodesA/3/NodeB/", "Unexpected cached path");
+  matches = Config::LookupMatches ("/NodesA/[2-3]|0/NodeB");
+  NS_TEST_ASSERT_MSG_EQ (matches.GetN (), 3, "Unexpected number of matches");
+  NS_TEST_ASSERT_MSG_EQ (matches.GetMatchedPath (1), "/NodesA/2/NodeB/", "Unexpected path");
+  Config::Set ("/NodesA/*/A", IntegerValue (3));
+  Config::Set ("/NodesA/*/NodeB/A", IntegerValue (4));
+  for (uint32_t i = 0; i < nodes.size (); i++)
+    {
+      nodes[i]->GetAttribute ("A", iv);
+      NS_TEST_ASSERT_MSG_EQ (iv.Get (), 3, "Object Attribute \"A\" not set as expected");
+      PointerValue pv;
+      nodes[i]->GetAttribute ("NodeB", pv);
+      pv.Get<ConfigTestObject> ()->GetAttribute ("A", iv);
+      NS_TEST_ASSERT_MSG_EQ (iv.Get (), 4, "Object Attribute \"A\" not set as expected");
+    }
+
+  //
+  // A new object, and an existing object, added to a cached container
+  //
+  Ptr<ConfigTestObject> node = CreateObject<ConfigTestObject> ();
+  root->AddNodeA (node);
+  matches = Config::LookupMatches ("/NodesA/*");
+  NS_TEST_ASSERT_MSG_EQ (matches.GetN (), 5, "New object not matched");
+  root->AddNodeA (nodes[0]);
+  matches = Config::LookupMatches ("/NodesA/*");
+  NS_TEST_ASSERT_MSG_EQ (matches.GetN (), 6, "Existing object not matched");
+  NS_TEST_ASSERT_MSG_EQ (matches.GetMatchedPath (5), "/NodesA/5/", "Unexpected path");
+
+  //
+  // An object added to a container which is not cached, without
+  // Config::InvalidateCache
+  //
+  matches = Config::LookupMatches ("/NodesA/0/NodesB/*");
+  NS_TEST_ASSERT_MSG_EQ (matches.GetN (), 0, "Unexpected number of matches");
+  nodes[0]->AddNodeB (CreateObject<ConfigTestObject> ());
+  matches = Config::LookupMatches ("/NodesA/0/NodesB/*");
+  NS_TEST_ASSERT_MSG_EQ (matches.GetN (), 1, "Object of a container which is not cached not matched");
+
+  //
+  // Setting a Pointer Attribute
+  //
+  Config::Set ("/NodesA/0/NodeB", PointerValue (node));
+  matches = Config::LookupMatches ("/NodesA/*/NodeB");
+  NS_TEST_ASSERT_MSG_EQ (matches.GetN (), 5, "Unexpected number of matches");
+  NS_TEST_ASSERT_MSG_EQ (matches.Get (0), node, "Pointer Attribute change not matched");
+  NS_TEST_ASSERT_MSG_EQ (matches.GetMatchedPath (4), "/NodesA/5/NodeB/", "Unexpected path");
+
+  //
+  // A wildcard Attribute name matching ObjectPtrContainer Attributes
+  //
+  matches = Config::LookupMatches ("/*/1");
+  NS_TEST_ASSERT_MSG_EQ (matches.GetN (), 1, "Unexpected number of matches");
+  NS_TEST_ASSERT_MSG_EQ (matches.GetMatchedPath (0), "/NodesA/1/", "Unexpected path");
+  matches = Config::LookupMatches ("/*/1");
+  NS_TEST_ASSERT_MSG_EQ (matches.GetN (), 1, "Unexpected number of matches");
+
+  //
+  // A batch of settings
+  //
+  Ptr<ConfigTestObject> child = CreateObject<ConfigTestObject> ();
+  std::vector<std::pair<std::string, Ptr<const AttributeValue> > > settings;
+  settings.push_back (std::make_pair ("/NodesA/[1-2]/A", Create<IntegerValue> (5)));
+  settings.push_back (std::make_pair ("/NodesA/[1-2]/B", Create<IntegerValue> (6)));
+  settings.push_back (std::make_pair ("/NodesA/[1-2]/NodeB", Create<PointerValue> (child)));
+  settings.push_back (std::make_pair ("/NodesA/[1-2]/NodeB/A", Create<IntegerValue> (7)));
+  Config::SetMany (settings);
+  nodes[1]->GetAttribute ("A", iv);
+  NS_TEST_ASSERT_MSG_EQ (iv.Get (), 5, "Object Attribute \"A\" not set as expected");
+  nodes[2]->GetAttribute ("B", iv);
+  NS_TEST_ASSERT_MSG_EQ (iv.Get (), 6, "Object Attribute \"B\" not set as expected");
+  nodes[3]->GetAttribute ("A", iv);
+  NS_TEST_ASSERT_MSG_EQ (iv.Get (), 3, "Object Attribute \"A\" unexpectedly set");
+  child->GetAttribute ("A", iv);
+  NS_TEST_ASSERT_MSG_EQ (iv.Get (), 7, "Object Attribute \"A\" not set through the new Pointer");
+
+  Config::UnregisterRootNamespaceObject (root);
+}
+
 /**
  * \ingroup config-tests
  * The Test Suite that glues all of the Test Cases together.
@@ -848,6 +1058,8 @@ ConfigTestSuite::ConfigTestSuite ()
   AddTestCase (new UnderRootNamespaceConfigTestCase);
   AddTestCase (new ObjectVectorConfigTestCase);
   AddTestCase (new SearchAttributesOfParentObjectsTestCase);
+  AddTestCase (new TraceContextConfigTestCase);
+  AddTestCase (new CachedPathConfigTestCase);
 }
 
 /**
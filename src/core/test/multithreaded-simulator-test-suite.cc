@@ -0,0 +1,233 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "ns3/test.h"
+#include "ns3/simulator.h"
+#include "ns3/multithreaded-simulator-impl.h"
+#include "ns3/object-factory.h"
+#include "ns3/nstime.h"
+#include "ns3/uinteger.h"
+
+#include <algorithm>
+#include <set>
+#include <thread>
+#include <utility>
+#include <vector>
+
+using namespace ns3;
+
+/**
+ * \ingroup core-tests
+ *
+ * Check that the MultithreadedSimulatorImpl executes the events of each
+ * node at the same times as the DefaultSimulatorImpl, and that its
+ * execution order does not depend on the timing of the threads.
+ *
+ * Each node forwards a message to another node with a delay not smaller
+ * than the lookahead, or to itself with a zero lookahead, and arms a
+ * local timer which is cancelled when the next message is received
+ * before it expires.
+ */
+class MultithreadedSimulatorTestCase : public TestCase
+{
+public:
+  /**
+   * Constructor
+   * \param lookahead the Lookahead attribute of the simulator
+   * \param maxThreads the MaxThreads attribute of the simulator
+   */
+  MultithreadedSimulatorTestCase (Time lookahead, uint32_t maxThreads);
+
+private:
+  virtual void DoRun (void);
+
+  /** State of a node, only accessed by the events of the node */
+  struct NodeState
+  {
+    std::vector<std::pair<uint64_t, uint32_t> > received; //!< reception times and values
+    std::vector<std::pair<uint64_t, uint32_t> > events;   //!< times and values of all the events
+    std::set<std::thread::id> threads;                    //!< threads executing the events
+    EventId timer;                                         //!< the local timer
+    uint32_t wrongContexts;                                //!< events run with a wrong context
+  };
+
+  /**
+   * Run the scenario with a simulator implementation
+   * \param factory the factory of the simulator implementation
+   * \return the number of executed events
+   */
+  uint64_t RunScenario (ObjectFactory factory);
+  /**
+   * Receive a message
+   * \param node the receiving node
+   * \param hop the number of hops of the message
+   * \param value the payload of the message
+   */
+  void Receive (uint32_t node, uint32_t hop, uint32_t value);
+  /**
+   * Expire the local timer
+   * \param node the node
+   * \param value the value of the last received message
+   */
+  void Timeout (uint32_t node, uint32_t value);
+  /**
+   * Record the execution of an event
+   * \param node the node
+   * \param value the value associated to the event
+   */
+  void Record (uint32_t node, uint32_t value);
+
+  Time m_lookahead;                 //!< the Lookahead attribute of the simulator
+  uint32_t m_maxThreads;            //!< the MaxThreads attribute of the simulator
+  std::vector<NodeState> m_nodes;   //!< the state of the nodes
+};
+
+MultithreadedSimulatorTestCase::MultithreadedSimulatorTestCase (Time lookahead, uint32_t maxThreads)
+  : TestCase ("Check the multithreaded simulator with Lookahead = " + std::to_string (lookahead.GetNanoSeconds ())
+              + " ns and MaxThreads = " + std::to_string (maxThreads)),
+    m_lookahead (lookahead),
+    m_maxThreads (maxThreads)
+{
+}
+
+void
+MultithreadedSimulatorTestCase::Record (uint32_t node, uint32_t value)
+{
+  NodeState &state = m_nodes[node];
+  state.events.push_back (std::make_pair (Simulator::Now ().GetTimeStep (), value));
+  state.threads.insert (std::this_thread::get_id ());
+  if (Simulator::GetContext () != node)
+    {
+      state.wrongContexts++;
+    }
+}
+
+void
+MultithreadedSimulatorTestCase::Receive (uint32_t node, uint32_t hop, uint32_t value)
+{
+  Record (node, value);
+  NodeState &state = m_nodes[node];
+  state.received.push_back (std::make_pair (Simulator::Now ().GetTimeStep (), value));
+  if (!Simulator::IsExpired (state.timer))
+    {
+      Simulator::Cancel (state.timer);
+    }
+  state.timer = Simulator::Schedule (NanoSeconds (200 + value % 600), &MultithreadedSimulatorTestCase::Timeout, this, node, value);
+
+  if (hop < 60)
+    {
+      uint32_t next = m_lookahead.IsZero () ? node : (node * 5 + 3) % m_nodes.size ();
+      Simulator::ScheduleWithContext (next, MicroSeconds (1) + NanoSeconds (value % 1000),
+                                      &MultithreadedSimulatorTestCase::Receive, this, next, hop + 1, value * 31 + node);
+    }
+}
+
+void
+MultithreadedSimulatorTestCase::Timeout (uint32_t node, uint32_t value)
+{
+  Record (node, value + 1);
+}
+
+uint64_t
+MultithreadedSimulatorTestCase::RunScenario (ObjectFactory factory)
+{
+  m_nodes.assign (16, NodeState ());
+  for (std::vector<NodeState>::iterator it = m_nodes.begin (); it != m_nodes.end (); ++it)
+    {
+      it->wrongContexts = 0;
+    }
+  Simulator::SetImplementation (factory.Create<SimulatorImpl> ());
+  for (uint32_t i = 0; i < m_nodes.size (); ++i)
+    {
+      Simulator::ScheduleWithContext (i, NanoSeconds (i * 10), &MultithreadedSimulatorTestCase::Receive, this, i, 0, i);
+    }
+  Simulator::Stop (MicroSeconds (50));
+  Simulator::Run ();
+  uint64_t eventCount = Simulator::GetEventCount ();
+  NS_TEST_EXPECT_MSG_EQ (Simulator::Now (), MicroSeconds (50), "the simulation did not stop at the expected time");
+  Simulator::Destroy ();
+
+  for (uint32_t i = 0; i < m_nodes.size (); ++i)
+    {
+      NS_TEST_EXPECT_MSG_EQ (m_nodes[i].wrongContexts, 0, "events of node " << i << " run with a wrong context");
+    }
+  return eventCount;
+}
+
+void
+MultithreadedSimulatorTestCase::DoRun (void)
+{
+  ObjectFactory factory;
+  factory.SetTypeId ("ns3::DefaultSimulatorImpl");
+  uint64_t defaultEventCount = RunScenario (factory);
+  std::vector<NodeState> defaultNodes = m_nodes;
+
+  factory.SetTypeId ("ns3::MultithreadedSimulatorImpl");
+  factory.Set ("Lookahead", TimeValue (m_lookahead));
+  factory.Set ("MaxThreads", UintegerValue (m_maxThreads));
+  uint64_t eventCount = RunScenario (factory);
+  std::vector<NodeState> nodes = m_nodes;
+  NS_TEST_ASSERT_MSG_EQ (eventCount, defaultEventCount, "unexpected number of events");
+
+  bool parallel = m_maxThreads > 1;
+  std::set<std::thread::id> threads;
+  for (uint32_t i = 0; i < nodes.size (); ++i)
+    {
+      // the messages are independent of the order of the events with the
+      // same timestamp, the timers are not
+      std::vector<std::pair<uint64_t, uint32_t> > received = nodes[i].received;
+      std::vector<std::pair<uint64_t, uint32_t> > defaultReceived = defaultNodes[i].received;
+      std::sort (received.begin (), received.end ());
+      std::sort (defaultReceived.begin (), defaultReceived.end ());
+      NS_TEST_EXPECT_MSG_EQ ((received == defaultReceived), true, "unexpected messages received by node " << i);
+      if (!parallel)
+        {
+          NS_TEST_EXPECT_MSG_EQ ((nodes[i].events == defaultNodes[i].events), true, "unexpected events of node " << i);
+        }
+      NS_TEST_EXPECT_MSG_EQ (nodes[i].threads.size (), 1, "the events of node " << i << " run on several threads");
+      threads.insert (nodes[i].threads.begin (), nodes[i].threads.end ());
+    }
+  NS_TEST_EXPECT_MSG_EQ (threads.size (), (parallel ? m_maxThreads : 1), "unexpected number of threads");
+
+  // a second run must execute the events in exactly the same order
+  RunScenario (factory);
+  for (uint32_t i = 0; i < nodes.size (); ++i)
+    {
+      NS_TEST_EXPECT_MSG_EQ ((m_nodes[i].events == nodes[i].events), true, "the events of node " << i << " are not reproducible");
+    }
+}
+
+
+/**
+ * \ingroup core-tests
+ *
+ * The multithreaded simulator test suite.
+ */
+class MultithreadedSimulatorTestSuite : public TestSuite
+{
+public:
+  MultithreadedSimulatorTestSuite ()
+    : TestSuite ("multithreaded-simulator")
+  {
+    AddTestCase (new MultithreadedSimulatorTestCase (Seconds (0), 4), TestCase::QUICK);
+    AddTestCase (new MultithreadedSimulatorTestCase (MicroSeconds (1), 1), TestCase::QUICK);
+    AddTestCase (new MultithreadedSimulatorTestCase (MicroSeconds (1), 2), TestCase::QUICK);
+    AddTestCase (new MultithreadedSimulatorTestCase (MicroSeconds (1), 4), TestCase::QUICK);
+    AddTestCase (new MultithreadedSimulatorTestCase (NanoSeconds (500), 3), TestCase::QUICK);
+  }
+};
+
+static MultithreadedSimulatorTestSuite g_multithreadedSimulatorTestSuite; //!< Static variable for test initialization
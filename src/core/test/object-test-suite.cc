@@ -398,6 +398,64 @@ AggregateObjectTestCase::DoRun (void)
   NS_TEST_ASSERT_MSG_NE (baseA, 0, "Unable to GetObject on released object");
 }
 
+/**
+ * \ingroup object-tests
+ * Test the cache of GetObject lookups does not change their results.
+ */
+class GetObjectCacheTestCase : public TestCase
+{
+public:
+  /** Constructor. */
+  GetObjectCacheTestCase ();
+  /** Destructor. */
+  virtual ~GetObjectCacheTestCase ();
+
+private:
+  virtual void DoRun (void);
+};
+
+GetObjectCacheTestCase::GetObjectCacheTestCase ()
+  : TestCase ("Check cached GetObject lookups")
+{
+}
+
+GetObjectCacheTestCase::~GetObjectCacheTestCase ()
+{
+}
+
+void
+GetObjectCacheTestCase::DoRun (void)
+{
+  Ptr<BaseA> baseA = CreateObject<BaseA> ();
+  Ptr<BaseB> baseB = CreateObject<BaseB> ();
+  baseA->AggregateObject (baseB);
+
+  //
+  // Repeated lookups, and lookups of missing types, must give the same
+  // results once cached.
+  //
+  for (uint32_t i = 0; i < 3; i++)
+    {
+      NS_TEST_ASSERT_MSG_EQ (baseA->GetObject<BaseB> (), baseB, "Wrong BaseB through baseA");
+      NS_TEST_ASSERT_MSG_EQ (baseB->GetObject<BaseA> (), baseA, "Wrong BaseA through baseB");
+      NS_TEST_ASSERT_MSG_EQ (baseA->GetObject<DerivedB> (), 0, "Unexpectedly found a DerivedB through baseA");
+    }
+
+  //
+  // A missing type must be found once aggregated, even if its lookup
+  // failed before.  BaseB and DerivedB then both match BaseB: the lookup
+  // returns the most accessed one, which changes as they are accessed.
+  //
+  Ptr<DerivedB> derivedB = CreateObject<DerivedB> ();
+  baseA->AggregateObject (derivedB);
+  NS_TEST_ASSERT_MSG_EQ (baseA->GetObject<BaseB> (BaseB::GetTypeId ()), baseB, "Wrong BaseB through baseA");
+  for (uint32_t i = 0; i < 10; i++)
+    {
+      NS_TEST_ASSERT_MSG_EQ (baseA->GetObject<BaseB> (DerivedB::GetTypeId ()), derivedB, "Cannot GetObject (through baseA) for DerivedB Object");
+    }
+  NS_TEST_ASSERT_MSG_EQ (baseA->GetObject<BaseB> (BaseB::GetTypeId ()), derivedB, "BaseB lookup does not follow the access counts");
+}
+
 /**
  * \ingroup object-tests
  * Test an Object factory can create Objects
@@ -489,6 +547,7 @@ ObjectTestSuite::ObjectTestSuite ()
 {
   AddTestCase (new CreateObjectTestCase);
   AddTestCase (new AggregateObjectTestCase);
+  AddTestCase (new GetObjectCacheTestCase);
   AddTestCase (new ObjectFactoryTestCase);
 }
 
@@ -23,6 +23,12 @@
 #include "ns3/heap-scheduler.h"
 #include "ns3/map-scheduler.h"
 #include "ns3/calendar-scheduler.h"
+#include "ns3/four-ary-heap-scheduler.h"
+#include "ns3/event-impl.h"
+#include "ns3/make-event.h"
+
+#include <algorithm>
+#include <vector>
 
 using namespace ns3;
 
@@ -461,6 +467,99 @@ SimulatorTemplateTestCase::DoRun (void)
   Simulator::Destroy ();
 }
 
+class SchedulerOrderTestCase : public TestCase
+{
+public:
+  SchedulerOrderTestCase (ObjectFactory schedulerFactory);
+private:
+  virtual void DoRun (void);
+  ObjectFactory m_schedulerFactory;
+};
+
+SchedulerOrderTestCase::SchedulerOrderTestCase (ObjectFactory schedulerFactory)
+  : TestCase ("Check the order of the events removed from " +
+              schedulerFactory.GetTypeId ().GetName ()),
+    m_schedulerFactory (schedulerFactory)
+{
+}
+
+void
+SchedulerOrderTestCase::DoRun (void)
+{
+  Ptr<Scheduler> scheduler = m_schedulerFactory.Create<Scheduler> ();
+  std::vector<Scheduler::Event> expected;
+  uint32_t seed = 12345;
+  for (uint32_t uid = 4; uid < 2004; ++uid)
+    {
+      seed = seed * 1103515245 + 12345;
+      Scheduler::Event ev;
+      ev.impl = MakeEvent (&foo0);
+      // few timestamps, so that many events are ordered by uid
+      ev.key.m_ts = (seed >> 16) % 97;
+      ev.key.m_uid = uid;
+      ev.key.m_context = 0;
+      scheduler->Insert (ev);
+      expected.push_back (ev);
+    }
+  // remove every third event, in insertion order
+  std::vector<Scheduler::Event> kept;
+  for (std::size_t i = 0; i < expected.size (); ++i)
+    {
+      if (i % 3 == 0)
+        {
+          scheduler->Remove (expected[i]);
+          expected[i].impl->Unref ();
+        }
+      else
+        {
+          kept.push_back (expected[i]);
+        }
+    }
+  std::sort (kept.begin (), kept.end ());
+  for (std::size_t i = 0; i < kept.size (); ++i)
+    {
+      NS_TEST_ASSERT_MSG_EQ (scheduler->IsEmpty (), false, "scheduler empty too early");
+      Scheduler::Event next = scheduler->RemoveNext ();
+      NS_TEST_EXPECT_MSG_EQ (next.key.m_ts, kept[i].key.m_ts, "unexpected timestamp at position " << i);
+      NS_TEST_EXPECT_MSG_EQ (next.key.m_uid, kept[i].key.m_uid, "unexpected uid at position " << i);
+      NS_TEST_EXPECT_MSG_EQ (next.impl, kept[i].impl, "unexpected event at position " << i);
+      next.impl->Unref ();
+    }
+  NS_TEST_EXPECT_MSG_EQ (scheduler->IsEmpty (), true, "scheduler not empty");
+}
+
+class EventStorageTestCase : public TestCase
+{
+public:
+  EventStorageTestCase ();
+private:
+  virtual void DoRun (void);
+};
+
+EventStorageTestCase::EventStorageTestCase ()
+  : TestCase ("Check that the storage of the destroyed events is reused")
+{
+}
+
+void
+EventStorageTestCase::DoRun (void)
+{
+  EventImpl *first = MakeEvent (&foo2, 1, 2);
+  EventImpl *second = MakeEvent (&foo5, 1, 2, 3, 4, 5);
+  void *firstStorage = first;
+  void *secondStorage = second;
+  first->Unref ();
+  second->Unref ();
+
+  // the last released block of each size is reused first
+  EventImpl *third = MakeEvent (&foo5, 5, 4, 3, 2, 1);
+  NS_TEST_EXPECT_MSG_EQ (static_cast<void *> (third), secondStorage, "storage of a released event not reused");
+  EventImpl *fourth = MakeEvent (&foo2, 2, 1);
+  NS_TEST_EXPECT_MSG_EQ (static_cast<void *> (fourth), firstStorage, "storage of a released event not reused");
+  third->Unref ();
+  fourth->Unref ();
+}
+
 class SimulatorTestSuite : public TestSuite
 {
 public:
@@ -477,5 +576,13 @@ public:
     AddTestCase (new SimulatorEventsTestCase (factory), TestCase::QUICK);
     factory.SetTypeId (CalendarScheduler::GetTypeId ());
     AddTestCase (new SimulatorEventsTestCase (factory), TestCase::QUICK);
+    factory.SetTypeId (FourAryHeapScheduler::GetTypeId ());
+    AddTestCase (new SimulatorEventsTestCase (factory), TestCase::QUICK);
+
+    factory.SetTypeId (HeapScheduler::GetTypeId ());
+    AddTestCase (new SchedulerOrderTestCase (factory), TestCase::QUICK);
+    factory.SetTypeId (FourAryHeapScheduler::GetTypeId ());
+    AddTestCase (new SchedulerOrderTestCase (factory), TestCase::QUICK);
+    AddTestCase (new EventStorageTestCase, TestCase::QUICK);
   }
 } g_simulatorTestSuite;
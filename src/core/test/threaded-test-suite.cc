@@ -26,6 +26,10 @@
 #include "ns3/config.h"
 #include "ns3/string.h"
 #include "ns3/system-thread.h"
+#include "ns3/nstime.h"
+#ifdef HAVE_RT
+#include "ns3/realtime-simulator-impl.h"
+#endif
 
 #include <chrono>  // seconds, milliseconds
 #include <ctime>
@@ -226,6 +230,168 @@ ThreadedSimulatorEventsTestCase::DoRun (void)
   NS_TEST_EXPECT_MSG_EQ (m_a, m_d, "Bad scheduling");
 }
 
+#ifdef HAVE_RT
+/**
+ * Check that the events scheduled by other threads through the inbound
+ * queue of RealtimeSimulatorImpl are all executed, in the order each
+ * thread scheduled them, and that their lags are traced.
+ */
+class RealtimeInboundTestCase : public TestCase
+{
+public:
+  /**
+   * Constructor.
+   * \param [in] spinTime The InboundSpinTime attribute value.
+   */
+  RealtimeInboundTestCase (Time spinTime);
+  /**
+   * Schedule the events of a thread.
+   * \param [in] context The test case and the thread number.
+   */
+  static void SchedulingThread (std::pair<RealtimeInboundTestCase *, unsigned int> context);
+  /**
+   * Event scheduled by the threads.
+   * \param [in] threadno The thread number.
+   * \param [in] seq The sequence number of the event in its thread.
+   */
+  void Receive (unsigned int threadno, uint32_t seq);
+  /**
+   * Trace sink of the inbound lags.
+   * \param [in] lag The lag.
+   */
+  void InboundLag (Time lag);
+  /**
+   * Trace sink of the event lags.
+   * \param [in] lag The lag.
+   */
+  void EventLag (Time lag);
+
+private:
+  virtual void DoRun (void);
+  virtual void DoTeardown (void);
+
+  Time m_spinTime;                   ///< The InboundSpinTime attribute value
+  std::vector<uint32_t> m_next;      ///< Next expected sequence number of each thread
+  uint32_t m_received;               ///< Number of events received
+  uint32_t m_inboundLags;            ///< Number of inbound lags traced
+  uint32_t m_eventLags;              ///< Number of event lags traced
+  bool m_ordered;                    ///< Have all the events been received in order?
+};
+
+/// Number of threads of RealtimeInboundTestCase
+#define INBOUND_THREADS 4
+/// Number of events scheduled by each thread of RealtimeInboundTestCase
+#define INBOUND_EVENTS 2000
+
+RealtimeInboundTestCase::RealtimeInboundTestCase (Time spinTime)
+  : TestCase ("Check the inbound queue of the realtime simulator, with a spin time of " +
+              std::to_string (spinTime.GetMicroSeconds ()) + "us"),
+    m_spinTime (spinTime)
+{
+}
+
+void
+RealtimeInboundTestCase::SchedulingThread (std::pair<RealtimeInboundTestCase *, unsigned int> context)
+{
+  for (uint32_t seq = 0; seq < INBOUND_EVENTS; seq++)
+    {
+      Simulator::ScheduleWithContext (context.second, Seconds (0),
+                                      &RealtimeInboundTestCase::Receive, context.first,
+                                      context.second, seq);
+      if (seq % 100 == 99)
+        {
+          // Let the simulator thread park from time to time
+          std::this_thread::sleep_for (std::chrono::microseconds (200));
+        }
+    }
+}
+
+void
+RealtimeInboundTestCase::Receive (unsigned int threadno, uint32_t seq)
+{
+  if (Simulator::GetContext () != threadno || seq != m_next[threadno])
+    {
+      m_ordered = false;
+    }
+  m_next[threadno] = seq + 1;
+  if (++m_received == INBOUND_THREADS * INBOUND_EVENTS)
+    {
+      Simulator::Stop ();
+    }
+}
+
+void
+RealtimeInboundTestCase::InboundLag (Time lag)
+{
+  m_inboundLags++;
+}
+
+void
+RealtimeInboundTestCase::EventLag (Time lag)
+{
+  m_eventLags++;
+}
+
+void
+RealtimeInboundTestCase::DoRun (void)
+{
+  Config::SetGlobal ("SimulatorImplementationType", StringValue ("ns3::RealtimeSimulatorImpl"));
+  Ptr<RealtimeSimulatorImpl> impl = DynamicCast<RealtimeSimulatorImpl> (Simulator::GetImplementation ());
+  NS_TEST_ASSERT_MSG_NE (impl, 0, "Not a RealtimeSimulatorImpl");
+  impl->SetAttribute ("InboundSpinTime", TimeValue (m_spinTime));
+  impl->TraceConnectWithoutContext ("InboundLag", MakeCallback (&RealtimeInboundTestCase::InboundLag, this));
+  impl->TraceConnectWithoutContext ("EventLag", MakeCallback (&RealtimeInboundTestCase::EventLag, this));
+
+  m_next.assign (INBOUND_THREADS, 0);
+  m_received = 0;
+  m_inboundLags = 0;
+  m_eventLags = 0;
+  m_ordered = true;
+
+  std::vector<Ptr<SystemThread> > threads;
+  for (unsigned int i = 0; i < INBOUND_THREADS; i++)
+    {
+      threads.push_back (Create<SystemThread> (MakeBoundCallback (&RealtimeInboundTestCase::SchedulingThread,
+                                                                  std::pair<RealtimeInboundTestCase *, unsigned int> (this, i))));
+      threads.back ()->Start ();
+    }
+  // Do not wait forever if events are lost
+  Simulator::Schedule (Seconds (10), &Simulator::Stop);
+  Simulator::Run ();
+  for (unsigned int i = 0; i < INBOUND_THREADS; i++)
+    {
+      threads[i]->Join ();
+    }
+
+  uint64_t inboundCount = 0;
+  std::vector<uint64_t> histogram = impl->GetInboundLagHistogram ();
+  for (std::size_t i = 0; i < histogram.size (); i++)
+    {
+      inboundCount += histogram[i];
+    }
+  uint64_t eventCount = 0;
+  histogram = impl->GetEventLagHistogram ();
+  for (std::size_t i = 0; i < histogram.size (); i++)
+    {
+      eventCount += histogram[i];
+    }
+  Simulator::Destroy ();
+
+  NS_TEST_EXPECT_MSG_EQ (m_received, INBOUND_THREADS * INBOUND_EVENTS, "Lost inbound events");
+  NS_TEST_EXPECT_MSG_EQ (m_ordered, true, "Inbound events out of order");
+  NS_TEST_EXPECT_MSG_EQ (m_inboundLags, INBOUND_THREADS * INBOUND_EVENTS, "Inbound lags not traced");
+  NS_TEST_EXPECT_MSG_EQ (inboundCount, m_inboundLags, "Inbound lag histogram does not match its trace");
+  NS_TEST_EXPECT_MSG_EQ (m_eventLags, INBOUND_THREADS * INBOUND_EVENTS, "Event lags not traced");
+  NS_TEST_EXPECT_MSG_EQ (eventCount, m_eventLags, "Event lag histogram does not match its trace");
+}
+
+void
+RealtimeInboundTestCase::DoTeardown (void)
+{
+  Config::SetGlobal ("SimulatorImplementationType", StringValue ("ns3::DefaultSimulatorImpl"));
+}
+#endif /* HAVE_RT */
+
 class ThreadedSimulatorTestSuite : public TestSuite
 {
 public:
@@ -236,13 +402,15 @@ public:
 #ifdef HAVE_RT
       "ns3::RealtimeSimulatorImpl",
 #endif
+      "ns3::MultithreadedSimulatorImpl",
       "ns3::DefaultSimulatorImpl"
     };
     std::string schedulerTypes[] = {
       "ns3::ListScheduler",
       "ns3::HeapScheduler",
       "ns3::MapScheduler",
-      "ns3::CalendarScheduler"
+      "ns3::CalendarScheduler",
+      "ns3::FourAryHeapScheduler"
     };
     unsigned int threadcounts[] = {
       0,
@@ -263,5 +431,9 @@ public:
               }
           }
       }
+#ifdef HAVE_RT
+    AddTestCase (new RealtimeInboundTestCase (Seconds (0)), TestCase::QUICK);
+    AddTestCase (new RealtimeInboundTestCase (MicroSeconds (100)), TestCase::QUICK);
+#endif
   }
 } g_threadedSimulatorTestSuite;
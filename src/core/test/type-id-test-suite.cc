@@ -185,6 +185,19 @@ CollisionTestCase::DoRun (void)
                           "Second and lesser TypeId has HashChainFlag set");
   cout << suite << "collision: second,lesser not chained: OK" << endl;
 
+  // Check that the colliding types are still found by name and hash
+  TypeId tids[] = { t1, t2, t3, t4 };
+  for (uint32_t i = 0; i < 4; i++)
+    {
+      NS_TEST_ASSERT_MSG_EQ (TypeId::LookupByName (tids[i].GetName ()), tids[i],
+                             "LookupByName returned different TypeId for "
+                             << tids[i].GetName ());
+      NS_TEST_ASSERT_MSG_EQ (TypeId::LookupByHash (tids[i].GetHash ()), tids[i],
+                             "LookupByHash returned different TypeId for "
+                             << tids[i].GetName ());
+    }
+  cout << suite << "collision: lookups by name and hash: OK" << endl;
+
   /** TODO Extra credit:  register three types whose hashes collide
    *
    *  None found in /usr/share/dict/web2
@@ -325,6 +338,100 @@ DeprecatedAttributeTestCase::DoRun (void)
        << endl;
 }
 
+
+//----------------------------
+//
+// Attribute and TraceSource lookup test
+
+class LookupMember : public Object
+{
+public:
+  int m_attr;                   //!< The Attribute
+  TracedValue<double> m_trace;  //!< The TraceSource
+};
+
+class LookupMemberTestCase : public TestCase
+{
+public:
+  LookupMemberTestCase ();
+  virtual ~LookupMemberTestCase ();
+private:
+  virtual void DoRun (void);
+};
+
+LookupMemberTestCase::LookupMemberTestCase ()
+  : TestCase ("Check Attribute and TraceSource lookups through parents")
+{
+}
+
+LookupMemberTestCase::~LookupMemberTestCase ()
+{
+}
+
+void
+LookupMemberTestCase::DoRun (void)
+{
+  cerr << suite << endl;
+  cerr << suite << GetName () << endl;
+
+  TypeId parent = TypeId ("LookupMemberParent")
+    .SetParent<Object> ()
+    .AddAttribute ("shared", "the parent Attribute",
+                   IntegerValue (1),
+                   MakeIntegerAccessor (&LookupMember::m_attr),
+                   MakeIntegerChecker<int> ())
+    .AddTraceSource ("parentTrace", "the parent TraceSource",
+                     MakeTraceSourceAccessor (&LookupMember::m_trace),
+                     "ns3::TracedValueCallback::Double");
+  TypeId child = TypeId ("LookupMemberChild")
+    .SetParent (parent)
+    .AddAttribute ("childAttribute", "the child Attribute",
+                   IntegerValue (2),
+                   MakeIntegerAccessor (&LookupMember::m_attr),
+                   MakeIntegerChecker<int> ());
+
+  struct TypeId::AttributeInformation ainfo;
+  NS_TEST_ASSERT_MSG_EQ (child.LookupAttributeByName ("childAttribute", &ainfo), true,
+                         "lookup child attribute");
+  NS_TEST_ASSERT_MSG_EQ (ainfo.help, "the child Attribute", "wrong child attribute");
+  NS_TEST_ASSERT_MSG_EQ (child.LookupAttributeByName ("shared", &ainfo), true,
+                         "lookup parent attribute through child");
+  NS_TEST_ASSERT_MSG_EQ (ainfo.help, "the parent Attribute", "wrong parent attribute");
+  NS_TEST_ASSERT_MSG_EQ (parent.LookupAttributeByName ("childAttribute", &ainfo), false,
+                         "lookup child attribute through parent");
+  NS_TEST_ASSERT_MSG_EQ (child.LookupAttributeByName ("missing", &ainfo), false,
+                         "lookup missing attribute");
+
+  struct TypeId::TraceSourceInformation tinfo;
+  NS_TEST_ASSERT_MSG_NE (child.LookupTraceSourceByName ("parentTrace", &tinfo), 0,
+                         "lookup parent trace source through child");
+  NS_TEST_ASSERT_MSG_EQ (child.LookupTraceSourceByName ("childTrace"), 0,
+                         "lookup missing trace source");
+
+  // Members added after a lookup must be found too
+  child.AddTraceSource ("childTrace", "the child TraceSource",
+                        MakeTraceSourceAccessor (&LookupMember::m_trace),
+                        "ns3::TracedValueCallback::Double");
+  parent.AddAttribute ("late", "the late parent Attribute",
+                       IntegerValue (3),
+                       MakeIntegerAccessor (&LookupMember::m_attr),
+                       MakeIntegerChecker<int> ());
+  NS_TEST_ASSERT_MSG_NE (child.LookupTraceSourceByName ("childTrace", &tinfo), 0,
+                         "lookup late child trace source");
+  NS_TEST_ASSERT_MSG_EQ (child.LookupAttributeByName ("late", &ainfo), true,
+                         "lookup late parent attribute through child");
+  NS_TEST_ASSERT_MSG_EQ (ainfo.help, "the late parent Attribute", "wrong late attribute");
+
+  // Initial values changed after a lookup must be seen
+  NS_TEST_ASSERT_MSG_EQ (child.LookupAttributeByName ("shared", &ainfo), true,
+                         "lookup parent attribute through child");
+  parent.SetAttributeInitialValue (0, Create<IntegerValue> (4));
+  NS_TEST_ASSERT_MSG_EQ (child.LookupAttributeByName ("shared", &ainfo), true,
+                         "lookup parent attribute through child");
+  NS_TEST_ASSERT_MSG_EQ (DynamicCast<const IntegerValue> (ainfo.initialValue)->Get (), 4,
+                         "stale initial value");
+}
+
   
 //----------------------------
 //
@@ -437,6 +544,7 @@ TypeIdTestSuite::TypeIdTestSuite ()
   AddTestCase (new UniqueTypeIdTestCase, QUICK);
   AddTestCase (new CollisionTestCase, QUICK);
   AddTestCase (new DeprecatedAttributeTestCase, QUICK);
+  AddTestCase (new LookupMemberTestCase, QUICK);
 }
 
 static TypeIdTestSuite g_TypeIdTestSuite;  
@@ -0,0 +1,189 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ *
+ * Two rows of nodes sharing a DistributedSpectrumChannel, split between
+ * two logical processors: the nodes at x = 0 are placed on logical
+ * processor 0, and the nodes at x = distance on logical processor 1.
+ *
+ *           RANK 0  |  RANK 1
+ *                   |
+ *             n0 ~~~|~~~ n3
+ *             n1 ~~~|~~~ n4
+ *             n2 ~~~|~~~ n5
+ *                   |
+ *
+ * Each node sends packets to the node facing it with an
+ * AlohaNoackNetDevice.  The signals crossing from one logical processor
+ * to the other are sent in MPI messages, and arrive after the
+ * propagation delay between the rows, which is the lookahead of the
+ * distributed simulator.  Each logical processor prints the packets
+ * received by its nodes, which are the same as in the sequential run
+ * (without --distributed).
+ */
+
+#include "ns3/core-module.h"
+#include "ns3/network-module.h"
+#include "ns3/mobility-module.h"
+#include "ns3/spectrum-module.h"
+#include "ns3/distributed-spectrum-module.h"
+#include "ns3/mpi-interface.h"
+
+#ifdef NS3_MPI
+#include <mpi.h>
+#endif
+
+using namespace ns3;
+
+NS_LOG_COMPONENT_DEFINE ("SimpleDistributedSpectrum");
+
+/**
+ * Count a packet received by a node.
+ *
+ * \param rx the packet counters, by node id
+ * \param node the node id
+ * \param p the packet
+ */
+static void
+RxEndOk (std::vector<uint32_t> *rx, uint32_t node, Ptr<const Packet> p)
+{
+  (*rx)[node]++;
+}
+
+/**
+ * Send a packet from a device.
+ *
+ * \param device the device
+ * \param dest the destination address
+ * \param size the packet size
+ */
+static void
+SendPacket (Ptr<NetDevice> device, Address dest, uint32_t size)
+{
+  device->Send (Create<Packet> (size), dest, 0x0800);
+}
+
+int
+main (int argc, char *argv[])
+{
+#ifdef NS3_MPI
+
+  bool distributed = true;
+  uint32_t nRows = 3;
+  double distance = 300;
+  uint32_t nPackets = 50;
+
+  CommandLine cmd;
+  cmd.AddValue ("distributed", "Run on two logical processors", distributed);
+  cmd.AddValue ("rows", "Number of nodes on each logical processor", nRows);
+  cmd.AddValue ("distance", "Distance in meters between the nodes of the two logical processors", distance);
+  cmd.AddValue ("packets", "Number of packets sent by each node", nPackets);
+  cmd.Parse (argc, argv);
+
+  uint32_t systemId = 0;
+  if (distributed)
+    {
+      GlobalValue::Bind ("SimulatorImplementationType",
+                         StringValue ("ns3::DistributedSimulatorImpl"));
+      MpiInterface::Enable (&argc, &argv);
+      systemId = MpiInterface::GetSystemId ();
+      if (MpiInterface::GetSize () != 2)
+        {
+          std::cout << "This simulation requires 2 and only 2 logical processors." << std::endl;
+          return 1;
+        }
+    }
+
+  // Create the full topology on each logical processor
+  NodeContainer leftNodes;
+  NodeContainer rightNodes;
+  Ptr<ListPositionAllocator> positions = CreateObject<ListPositionAllocator> ();
+  for (uint32_t i = 0; i < nRows; i++)
+    {
+      leftNodes.Add (CreateObject<Node> (0));
+      positions->Add (Vector (0, 10 * i, 0));
+    }
+  for (uint32_t i = 0; i < nRows; i++)
+    {
+      rightNodes.Add (CreateObject<Node> (distributed ? 1 : 0));
+      positions->Add (Vector (distance, 10 * i, 0));
+    }
+  NodeContainer nodes (leftNodes, rightNodes);
+  MobilityHelper mobility;
+  mobility.SetPositionAllocator (positions);
+  mobility.Install (nodes);
+
+  SpectrumChannelHelper channelHelper;
+  channelHelper.SetChannel ("ns3::DistributedSpectrumChannel");
+  channelHelper.AddPropagationLoss ("ns3::FriisPropagationLossModel");
+  channelHelper.SetPropagationDelay ("ns3::ConstantSpeedPropagationDelayModel");
+  Ptr<SpectrumChannel> channel = channelHelper.Create ();
+
+  WifiSpectrumValue5MhzFactory sf;
+  AdhocAlohaNoackIdealPhyHelper deviceHelper;
+  deviceHelper.SetChannel (channel);
+  deviceHelper.SetTxPowerSpectralDensity (sf.CreateTxPowerSpectralDensity (0.1, 1));
+  deviceHelper.SetNoisePowerSpectralDensity (sf.CreateConstant (4.14e-21));
+  deviceHelper.SetPhyAttribute ("Rate", DataRateValue (DataRate ("1Mbps")));
+  NetDeviceContainer devices = deviceHelper.Install (nodes);
+
+  std::vector<uint32_t> rx (nodes.GetN (), 0);
+  for (uint32_t i = 0; i < nodes.GetN (); i++)
+    {
+      Ptr<Object> phy = devices.Get (i)->GetObject<AlohaNoackNetDevice> ()->GetPhy ();
+      phy->TraceConnectWithoutContext ("RxEndOk", MakeBoundCallback (&RxEndOk, &rx, i));
+    }
+
+  // Only send from the nodes of this logical processor, in turns to
+  // avoid collisions
+  for (uint32_t i = 0; i < nodes.GetN (); i++)
+    {
+      if (nodes.Get (i)->GetSystemId () != systemId)
+        {
+          continue;
+        }
+      Address dest = devices.Get ((i + nRows) % nodes.GetN ())->GetAddress ();
+      for (uint32_t k = 0; k < nPackets; k++)
+        {
+          Time t = MilliSeconds (10 * (k * nodes.GetN () + i));
+          Simulator::ScheduleWithContext (i, t, &SendPacket, devices.Get (i), dest, 100);
+        }
+    }
+
+  Simulator::Stop (MilliSeconds (10 * (nPackets + 1) * nodes.GetN ()));
+  Simulator::Run ();
+
+  TimeValue lookAhead;
+  channel->GetAttribute ("LookAhead", lookAhead);
+  std::cout << "System " << systemId << ": lookahead " << lookAhead.Get ().As (Time::US) << std::endl;
+  for (uint32_t i = 0; i < nodes.GetN (); i++)
+    {
+      if (nodes.Get (i)->GetSystemId () == systemId)
+        {
+          std::cout << "Node " << i << " received " << rx[i] << " packets" << std::endl;
+        }
+    }
+
+  Simulator::Destroy ();
+  if (distributed)
+    {
+      // Exit the MPI execution environment
+      MpiInterface::Disable ();
+    }
+  return 0;
+#else
+  NS_FATAL_ERROR ("Can't use distributed simulator without MPI compiled in");
+#endif
+}
@@ -0,0 +1,550 @@
+/* -*-  Mode: C++; c-file-style: "gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include <algorithm>
+#include <ns3/log.h>
+#include <ns3/abort.h>
+#include <ns3/simulator.h>
+#include <ns3/nstime.h>
+#include <ns3/node.h>
+#include <ns3/node-list.h>
+#include <ns3/net-device.h>
+#include <ns3/mobility-model.h>
+#include <ns3/antenna-model.h>
+#include <ns3/propagation-delay-model.h>
+#include <ns3/spectrum-phy.h>
+#include <ns3/mpi-interface.h>
+#include <ns3/mpi-receiver.h>
+#include "distributed-spectrum-channel.h"
+
+namespace ns3 {
+
+NS_LOG_COMPONENT_DEFINE ("DistributedSpectrumChannel");
+
+/**
+ * \ingroup distributed-spectrum
+ *
+ * SpectrumPhy standing, in the signals received from another system, for
+ * the phy which transmitted them.  It has the mobility of the node of the
+ * transmitting device, and the antenna of a receiver of that device.
+ */
+class DistributedSpectrumTxPhy : public SpectrumPhy
+{
+public:
+  /**
+   * \brief Get the type ID.
+   * \return the object TypeId
+   */
+  static TypeId GetTypeId (void);
+
+  /**
+   * \param antenna the antenna of the transmitting device
+   */
+  void SetAntenna (Ptr<AntennaModel> antenna);
+
+  // inherited from SpectrumPhy
+  virtual void SetDevice (Ptr<NetDevice> d);
+  virtual Ptr<NetDevice> GetDevice () const;
+  virtual void SetMobility (Ptr<MobilityModel> m);
+  virtual Ptr<MobilityModel> GetMobility ();
+  virtual void SetChannel (Ptr<SpectrumChannel> c);
+  virtual Ptr<const SpectrumModel> GetRxSpectrumModel () const;
+  virtual Ptr<AntennaModel> GetRxAntenna ();
+  virtual void StartRx (Ptr<SpectrumSignalParameters> params);
+
+protected:
+  virtual void DoDispose (void);
+
+private:
+  Ptr<NetDevice> m_device;          //!< the transmitting device
+  Ptr<MobilityModel> m_mobility;    //!< the mobility of its node
+  Ptr<AntennaModel> m_antenna;      //!< its antenna
+};
+
+NS_OBJECT_ENSURE_REGISTERED (DistributedSpectrumTxPhy);
+
+TypeId
+DistributedSpectrumTxPhy::GetTypeId (void)
+{
+  static TypeId tid = TypeId ("ns3::DistributedSpectrumTxPhy")
+    .SetParent<SpectrumPhy> ()
+    .SetGroupName ("DistributedSpectrum")
+  ;
+  return tid;
+}
+
+void
+DistributedSpectrumTxPhy::DoDispose (void)
+{
+  m_device = 0;
+  m_mobility = 0;
+  m_antenna = 0;
+  SpectrumPhy::DoDispose ();
+}
+
+void
+DistributedSpectrumTxPhy::SetAntenna (Ptr<AntennaModel> antenna)
+{
+  m_antenna = antenna;
+}
+
+void
+DistributedSpectrumTxPhy::SetDevice (Ptr<NetDevice> d)
+{
+  m_device = d;
+}
+
+Ptr<NetDevice>
+DistributedSpectrumTxPhy::GetDevice () const
+{
+  return m_device;
+}
+
+void
+DistributedSpectrumTxPhy::SetMobility (Ptr<MobilityModel> m)
+{
+  m_mobility = m;
+}
+
+Ptr<MobilityModel>
+DistributedSpectrumTxPhy::GetMobility ()
+{
+  return m_mobility;
+}
+
+void
+DistributedSpectrumTxPhy::SetChannel (Ptr<SpectrumChannel> c)
+{
+}
+
+Ptr<const SpectrumModel>
+DistributedSpectrumTxPhy::GetRxSpectrumModel () const
+{
+  return 0;
+}
+
+Ptr<AntennaModel>
+DistributedSpectrumTxPhy::GetRxAntenna ()
+{
+  return m_antenna;
+}
+
+void
+DistributedSpectrumTxPhy::StartRx (Ptr<SpectrumSignalParameters> params)
+{
+  NS_FATAL_ERROR ("DistributedSpectrumTxPhy does not receive");
+}
+
+
+NS_OBJECT_ENSURE_REGISTERED (DistributedSpectrumChannel);
+
+DistributedSpectrumChannel::DistributedSpectrumChannel ()
+  : m_partitioned (false),
+    m_lookAhead (Seconds (0)),
+    m_minPropagationDelay (Seconds (0))
+{
+  NS_LOG_FUNCTION (this);
+}
+
+DistributedSpectrumChannel::~DistributedSpectrumChannel ()
+{
+}
+
+TypeId
+DistributedSpectrumChannel::GetTypeId (void)
+{
+  static TypeId tid = TypeId ("ns3::DistributedSpectrumChannel")
+    .SetParent<MultiModelSpectrumChannel> ()
+    .SetGroupName ("DistributedSpectrum")
+    .AddConstructor<DistributedSpectrumChannel> ()
+    .AddAttribute ("LookAhead",
+                   "MinPropagationDelay if set, or else the minimum "
+                   "propagation delay from the nodes of this system to the "
+                   "receivers of the other systems when the simulation "
+                   "starts, or zero if there are none.",
+                   TypeId::ATTR_GET,
+                   TimeValue (Seconds (0)), // this value is ignored because there is no setter
+                   MakeTimeAccessor (&DistributedSpectrumChannel::GetLookAhead),
+                   MakeTimeChecker ())
+    .AddAttribute ("MinPropagationDelay",
+                   "A lower bound of the propagation delay from the nodes of "
+                   "this system to the receivers of the other systems during "
+                   "the whole simulation, such as the minimum distance between "
+                   "the areas of the systems divided by the propagation speed, "
+                   "or zero to use the delays when the simulation starts.",
+                   TimeValue (Seconds (0)),
+                   MakeTimeAccessor (&DistributedSpectrumChannel::m_minPropagationDelay),
+                   MakeTimeChecker (Seconds (0)))
+  ;
+  return tid;
+}
+
+void
+DistributedSpectrumChannel::NotifyConstructionCompleted (void)
+{
+  NS_LOG_FUNCTION (this);
+  Ptr<MpiReceiver> mpiRec = CreateObject<MpiReceiver> ();
+  mpiRec->SetReceiveCallback (MakeCallback (&DistributedSpectrumChannel::Receive, this));
+  AggregateObject (mpiRec);
+  MultiModelSpectrumChannel::NotifyConstructionCompleted ();
+}
+
+void
+DistributedSpectrumChannel::DoDispose (void)
+{
+  NS_LOG_FUNCTION (this);
+  m_pendingPhys.clear ();
+  m_remotePhys.clear ();
+  m_spectrumModels.clear ();
+  m_remoteSpectrumModels.clear ();
+  for (auto it = m_txPhys.begin (); it != m_txPhys.end (); ++it)
+    {
+      it->second->Dispose ();
+    }
+  m_txPhys.clear ();
+  MultiModelSpectrumChannel::DoDispose ();
+}
+
+uint32_t
+DistributedSpectrumChannel::GetSystemId (Ptr<SpectrumPhy> phy) const
+{
+  Ptr<NetDevice> device = phy->GetDevice ();
+  if (!MpiInterface::IsEnabled () || device == 0 || device->GetNode () == 0)
+    {
+      return MpiInterface::GetSystemId ();
+    }
+  return device->GetNode ()->GetSystemId ();
+}
+
+void
+DistributedSpectrumChannel::AddRx (Ptr<SpectrumPhy> phy)
+{
+  NS_LOG_FUNCTION (this << phy);
+  if (!MpiInterface::IsEnabled ())
+    {
+      MultiModelSpectrumChannel::AddRx (phy);
+    }
+  else if (m_partitioned)
+    {
+      AttachRx (phy);
+    }
+  else if (std::find (m_pendingPhys.begin (), m_pendingPhys.end (), phy) == m_pendingPhys.end ())
+    {
+      // the node may not be assigned to its system yet
+      m_pendingPhys.push_back (phy);
+    }
+}
+
+void
+DistributedSpectrumChannel::Partition (void)
+{
+  if (m_partitioned)
+    {
+      return;
+    }
+  NS_LOG_FUNCTION (this);
+  m_partitioned = true;
+  for (auto it = m_pendingPhys.begin (); it != m_pendingPhys.end (); ++it)
+    {
+      AttachRx (*it);
+    }
+  m_pendingPhys.clear ();
+}
+
+void
+DistributedSpectrumChannel::AttachRx (Ptr<SpectrumPhy> phy)
+{
+  NS_LOG_FUNCTION (this << phy);
+  AddSpectrumModel (phy->GetRxSpectrumModel ());
+  uint32_t systemId = GetSystemId (phy);
+  if (systemId == MpiInterface::GetSystemId ())
+    {
+      MultiModelSpectrumChannel::AddRx (phy);
+      return;
+    }
+  std::vector<Ptr<SpectrumPhy> > &phys = m_remotePhys[systemId];
+  if (std::find (phys.begin (), phys.end (), phy) == phys.end ())
+    {
+      NS_LOG_LOGIC ("phy " << phy << " belongs to system " << systemId);
+      phys.push_back (phy);
+    }
+}
+
+void
+DistributedSpectrumChannel::AddSpectrumModel (Ptr<const SpectrumModel> model)
+{
+  NS_ASSERT (model);
+  m_spectrumModels.insert (std::make_pair (model->GetUid (), model));
+}
+
+void
+DistributedSpectrumChannel::StartTx (Ptr<SpectrumSignalParameters> params)
+{
+  NS_LOG_FUNCTION (this << params);
+  if (MpiInterface::IsEnabled ())
+    {
+      Partition ();
+      if (GetSystemId (params->txPhy) != MpiInterface::GetSystemId ())
+        {
+          NS_LOG_LOGIC ("ignoring the signal of phy " << params->txPhy << " of another system");
+          return;
+        }
+      AddSpectrumModel (params->psd->GetSpectrumModel ());
+      SendToSystems (params);
+    }
+  MultiModelSpectrumChannel::StartTx (params);
+}
+
+void
+DistributedSpectrumChannel::SendToSystems (Ptr<SpectrumSignalParameters> params)
+{
+  NS_LOG_FUNCTION (this << params);
+  if (m_remotePhys.empty ())
+    {
+      return;
+    }
+  Ptr<MobilityModel> txMobility = params->txPhy->GetMobility ();
+  Ptr<NetDevice> txDevice = params->txPhy->GetDevice ();
+  NS_ABORT_MSG_UNLESS (txMobility && txDevice && m_propagationDelay,
+                       "DistributedSpectrumChannel needs the mobility and the device of "
+                       "the transmitters, and a PropagationDelayModel");
+  double maxRange = GetMaxRange ();
+
+  Ptr<Packet> msg;
+  for (auto it = m_remotePhys.begin (); it != m_remotePhys.end (); ++it)
+    {
+      bool inRange = false;
+      Time delay;
+      for (auto phy = it->second.begin (); phy != it->second.end (); ++phy)
+        {
+          Ptr<MobilityModel> rxMobility = (*phy)->GetMobility ();
+          NS_ASSERT (rxMobility);
+          if (maxRange > 0 && txMobility->GetDistanceFrom (rxMobility) > maxRange)
+            {
+              continue;
+            }
+          Time rxDelay = m_propagationDelay->GetDelay (txMobility, rxMobility);
+          if (!inRange || rxDelay < delay)
+            {
+              delay = rxDelay;
+              inRange = true;
+            }
+        }
+      if (!inRange)
+        {
+          continue;
+        }
+      // the synchronization only guarantees the delivery of the messages
+      // sent at least a LookAhead ahead
+      NS_ABORT_MSG_IF (delay < m_lookAhead || !delay.IsStrictlyPositive (),
+                       "Transmitter " << txDevice->GetNode ()->GetId () << " closer to system "
+                       << it->first << " than the LookAhead " << m_lookAhead
+                       << ": set MinPropagationDelay to a lower bound of the propagation "
+                       << "delay to the other systems during the whole simulation");
+
+      if (msg == 0)
+        {
+          DistributedSpectrumHeader header;
+          header.SetTxTime (Simulator::Now ());
+          header.SetDuration (params->duration);
+          header.SetTxDevice (txDevice->GetNode ()->GetId (), txDevice->GetIfIndex ());
+          header.SetTxAntenna (params->txAntenna != 0);
+          header.SetPsd (params->psd);
+          const std::vector<std::pair<uint32_t, Ptr<DistributedSpectrumSignalCodec> > > &codecs =
+            DistributedSpectrumSignalCodec::GetCodecs ();
+          for (auto codec = codecs.begin (); codec != codecs.end () && msg == 0; ++codec)
+            {
+              if (codec->second->CanEncode (params))
+                {
+                  header.SetCodec (codec->first);
+                  msg = codec->second->Encode (params);
+                }
+            }
+          if (msg == 0)
+            {
+              NS_LOG_LOGIC ("no codec for the signal, sending it as interference");
+              msg = Create<Packet> ();
+            }
+          msg->AddHeader (header);
+        }
+      NS_LOG_LOGIC ("sending the signal to system " << it->first << " with delay " << delay);
+      MpiInterface::SendChannelPacket (msg->Copy (), Simulator::Now () + delay, GetId (), it->first);
+    }
+}
+
+void
+DistributedSpectrumChannel::Receive (Ptr<Packet> p)
+{
+  NS_LOG_FUNCTION (this << p);
+  Partition ();
+  DistributedSpectrumHeader header;
+  p->RemoveHeader (header);
+  uint32_t systemId = NodeList::GetNode (header.GetTxNode ())->GetSystemId ();
+
+  Ptr<SpectrumSignalParameters> params;
+  if (header.GetCodec () != DistributedSpectrumHeader::NO_CODEC)
+    {
+      const std::vector<std::pair<uint32_t, Ptr<DistributedSpectrumSignalCodec> > > &codecs =
+        DistributedSpectrumSignalCodec::GetCodecs ();
+      auto codec = codecs.begin ();
+      while (codec != codecs.end () && codec->first != header.GetCodec ())
+        {
+          ++codec;
+        }
+      NS_ABORT_MSG_IF (codec == codecs.end (),
+                       "Unknown signal codec " << header.GetCodec () << ", the codecs must be added in all the systems");
+      params = codec->second->Decode (p);
+    }
+  else
+    {
+      params = Create<SpectrumSignalParameters> ();
+    }
+  params->duration = header.GetDuration ();
+  params->txPhy = GetTxPhy (header.GetTxNode (), header.GetTxDevice ());
+  if (header.HasTxAntenna ())
+    {
+      params->txAntenna = params->txPhy->GetRxAntenna ();
+    }
+  params->psd = Create<SpectrumValue> (GetSpectrumModel (systemId, header));
+  std::copy (header.GetPsdValues ().begin (), header.GetPsdValues ().end (), params->psd->ValuesBegin ());
+
+  DoStartTx (params, Simulator::Now () - header.GetTxTime ());
+}
+
+Ptr<const SpectrumModel>
+DistributedSpectrumChannel::GetSpectrumModel (uint32_t systemId, const DistributedSpectrumHeader &header)
+{
+  std::pair<uint32_t, SpectrumModelUid_t> key (systemId, header.GetSpectrumModelUid ());
+  auto it = m_remoteSpectrumModels.find (key);
+  if (it != m_remoteSpectrumModels.end ())
+    {
+      return it->second;
+    }
+
+  // reuse a SpectrumModel of this system with the same bands, so that
+  // the signal needs no conversion to the SpectrumModels of the receivers
+  const Bands &bands = header.GetBands ();
+  Ptr<const SpectrumModel> model;
+  for (auto local = m_spectrumModels.begin (); local != m_spectrumModels.end () && model == 0; ++local)
+    {
+      if (local->second->GetNumBands () == bands.size ()
+          && std::equal (bands.begin (), bands.end (), local->second->Begin (),
+                         [] (const BandInfo &a, const BandInfo &b)
+                         { return a.fl == b.fl && a.fc == b.fc && a.fh == b.fh; }))
+        {
+          model = local->second;
+        }
+    }
+  if (model == 0)
+    {
+      NS_LOG_LOGIC ("creating a SpectrumModel for uid " << key.second << " of system " << systemId);
+      model = Create<SpectrumModel> (bands);
+      AddSpectrumModel (model);
+    }
+  m_remoteSpectrumModels.insert (std::make_pair (key, model));
+  return model;
+}
+
+Ptr<SpectrumPhy>
+DistributedSpectrumChannel::GetTxPhy (uint32_t node, uint32_t device)
+{
+  std::pair<uint32_t, uint32_t> key (node, device);
+  auto it = m_txPhys.find (key);
+  if (it != m_txPhys.end ())
+    {
+      return it->second;
+    }
+
+  Ptr<Node> txNode = NodeList::GetNode (node);
+  Ptr<NetDevice> txDevice = txNode->GetDevice (device);
+  Ptr<DistributedSpectrumTxPhy> txPhy = CreateObject<DistributedSpectrumTxPhy> ();
+  txPhy->SetDevice (txDevice);
+  txPhy->SetMobility (txNode->GetObject<MobilityModel> ());
+  const std::vector<Ptr<SpectrumPhy> > &phys = m_remotePhys[txNode->GetSystemId ()];
+  for (auto phy = phys.begin (); phy != phys.end (); ++phy)
+    {
+      if ((*phy)->GetDevice () == txDevice)
+        {
+          txPhy->SetAntenna ((*phy)->GetRxAntenna ());
+          break;
+        }
+    }
+  m_txPhys.insert (std::make_pair (key, txPhy));
+  return txPhy;
+}
+
+Time
+DistributedSpectrumChannel::GetLookAhead (void) const
+{
+  NS_LOG_FUNCTION (this);
+  uint32_t localId = MpiInterface::GetSystemId ();
+  std::vector<Ptr<SpectrumPhy> > remotePhys;
+  if (MpiInterface::IsEnabled () && MpiInterface::GetSize () > 1)
+    {
+      for (auto it = m_pendingPhys.begin (); it != m_pendingPhys.end (); ++it)
+        {
+          if (GetSystemId (*it) != localId)
+            {
+              remotePhys.push_back (*it);
+            }
+        }
+      for (auto it = m_remotePhys.begin (); it != m_remotePhys.end (); ++it)
+        {
+          remotePhys.insert (remotePhys.end (), it->second.begin (), it->second.end ());
+        }
+    }
+  m_lookAhead = Seconds (0);
+  if (remotePhys.empty ())
+    {
+      return m_lookAhead;
+    }
+  if (m_minPropagationDelay.IsStrictlyPositive ())
+    {
+      m_lookAhead = m_minPropagationDelay;
+      NS_LOG_LOGIC ("LookAhead " << m_lookAhead);
+      return m_lookAhead;
+    }
+  NS_ABORT_MSG_UNLESS (m_propagationDelay, "DistributedSpectrumChannel needs a PropagationDelayModel");
+
+  bool found = false;
+  for (NodeList::Iterator node = NodeList::Begin (); node != NodeList::End (); ++node)
+    {
+      Ptr<MobilityModel> txMobility = (*node)->GetObject<MobilityModel> ();
+      if ((*node)->GetSystemId () != localId || txMobility == 0)
+        {
+          continue;
+        }
+      for (auto phy = remotePhys.begin (); phy != remotePhys.end (); ++phy)
+        {
+          Ptr<MobilityModel> rxMobility = (*phy)->GetMobility ();
+          NS_ABORT_MSG_UNLESS (rxMobility, "DistributedSpectrumChannel needs the mobility of the receivers");
+          Time delay = m_propagationDelay->GetDelay (txMobility, rxMobility);
+          NS_ABORT_MSG_UNLESS (delay.IsStrictlyPositive (),
+                               "Zero propagation delay from node " << (*node)->GetId ()
+                               << " to a receiver of system " << GetSystemId (*phy)
+                               << ", DistributedSpectrumChannel needs a positive LookAhead");
+          if (!found || delay < m_lookAhead)
+            {
+              m_lookAhead = delay;
+              found = true;
+            }
+        }
+    }
+  NS_LOG_LOGIC ("LookAhead " << m_lookAhead);
+  return m_lookAhead;
+}
+
+} // namespace ns3
@@ -0,0 +1,185 @@
+/* -*-  Mode: C++; c-file-style: "gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef DISTRIBUTED_SPECTRUM_CHANNEL_H
+#define DISTRIBUTED_SPECTRUM_CHANNEL_H
+
+#include <ns3/multi-model-spectrum-channel.h>
+#include <ns3/distributed-spectrum-signal-codec.h>
+#include <ns3/packet.h>
+#include <ns3/nstime.h>
+#include <map>
+#include <utility>
+#include <vector>
+
+/**
+ * \defgroup distributed-spectrum Distributed Spectrum
+ *
+ * A SpectrumChannel spanning the systems of a distributed simulation.
+ * It is kept out of the spectrum module so that only the simulations
+ * using it depend on the mpi module.
+ */
+
+namespace ns3 {
+
+/**
+ * \ingroup distributed-spectrum
+ *
+ * MultiModelSpectrumChannel spanning the systems of a distributed
+ * simulation, with the granted time window synchronization of
+ * ns3::DistributedSimulatorImpl.
+ *
+ * Every system builds the same topology, and owns the phys of its nodes,
+ * that is, a spatial partition of the phys.  The phys are assigned to
+ * the systems of their nodes when the first signal is transmitted or
+ * received, and only the phys of this system are then
+ * attached as receivers.  The signals transmitted by the phys of the
+ * other systems are ignored.
+ *
+ * A signal transmitted by a phy of this system is delivered to the
+ * receivers of this system like in MultiModelSpectrumChannel, and sent
+ * with MpiInterface::SendChannelPacket to every other system with
+ * receivers within MaxRange (all of them if MaxRange is not set).  The
+ * message holds a DistributedSpectrumHeader, followed by the members of
+ * the SpectrumSignalParameters subclass if a DistributedSpectrumSignalCodec
+ * was added for it with DistributedSpectrumSignalCodec::Add, and arrives
+ * at the propagation delay to the closest receiver of the system.  That
+ * system then delivers the signal to its receivers after the rest of
+ * their propagation delay.
+ *
+ * The LookAhead attribute, read by ns3::DistributedSimulatorImpl when it
+ * starts, is the MinPropagationDelay attribute if it is set, that is, a
+ * lower bound of the propagation delay from the nodes of this system to
+ * the receivers of the other ones which holds during the whole
+ * simulation, such as the minimum distance between the areas of the
+ * systems divided by the propagation speed.  Otherwise, it is the
+ * minimum propagation delay from the nodes of this system to the
+ * receivers of the other ones when the simulation starts, and a node of
+ * this system must not be at the position of a receiver of another
+ * system, since the lookahead would be zero.  A signal which would reach
+ * another system sooner than the LookAhead, because the nodes got closer
+ * during the simulation, aborts the simulation.  A
+ * PropagationDelayModel, and the mobility of the transmitters and of the
+ * receivers of the other systems, are needed.
+ *
+ * When MPI is not enabled, all the phys belong to this system and the
+ * channel behaves like MultiModelSpectrumChannel.
+ */
+class DistributedSpectrumChannel : public MultiModelSpectrumChannel
+{
+public:
+  DistributedSpectrumChannel ();
+  virtual ~DistributedSpectrumChannel ();
+
+  /**
+   * \brief Get the type ID.
+   * \return the object TypeId
+   */
+  static TypeId GetTypeId (void);
+
+  // inherited from SpectrumChannel
+  virtual void AddRx (Ptr<SpectrumPhy> phy);
+  virtual void StartTx (Ptr<SpectrumSignalParameters> params);
+
+  /**
+   * \return MinPropagationDelay if set, or else the minimum propagation
+   * delay from the nodes of this system to the receivers of the other
+   * systems, or zero if there are none
+   */
+  Time GetLookAhead (void) const;
+
+protected:
+  virtual void DoDispose (void);
+  virtual void NotifyConstructionCompleted (void);
+
+private:
+  /**
+   * Assign the phys added so far to the systems of their nodes, if not
+   * done yet.
+   */
+  void Partition (void);
+
+  /**
+   * Attach a phy as a receiver if it belongs to this system, or keep it
+   * as a receiver of another system.
+   *
+   * \param phy the phy
+   */
+  void AttachRx (Ptr<SpectrumPhy> phy);
+
+  /**
+   * \param phy a phy
+   * \return the system id of the node of the phy, or of this system if
+   * MPI is not enabled or the phy has no device
+   */
+  uint32_t GetSystemId (Ptr<SpectrumPhy> phy) const;
+
+  /**
+   * Send a signal transmitted by a phy of this system to the other
+   * systems with receivers in range.
+   *
+   * \param params the signal parameters
+   */
+  void SendToSystems (Ptr<SpectrumSignalParameters> params);
+
+  /**
+   * Receive a signal sent by another system, through the MpiReceiver
+   * aggregated to the channel.
+   *
+   * \param p the message
+   */
+  void Receive (Ptr<Packet> p);
+
+  /**
+   * \param systemId the system which sent a signal
+   * \param header the header of the signal
+   * \return a SpectrumModel of this system with the bands of the PSD
+   */
+  Ptr<const SpectrumModel> GetSpectrumModel (uint32_t systemId, const DistributedSpectrumHeader &header);
+
+  /**
+   * \param model a SpectrumModel of this system
+   */
+  void AddSpectrumModel (Ptr<const SpectrumModel> model);
+
+  /**
+   * \param node the id of a node of another system
+   * \param device the index of a device in the node
+   * \return the phy standing for the transmitter of that device
+   */
+  Ptr<SpectrumPhy> GetTxPhy (uint32_t node, uint32_t device);
+
+  /** Have the phys been assigned to their systems? */
+  bool m_partitioned;
+  /** The phys added before they were assigned to their systems. */
+  std::vector<Ptr<SpectrumPhy> > m_pendingPhys;
+  /** The receivers of the other systems, by system id. */
+  std::map<uint32_t, std::vector<Ptr<SpectrumPhy> > > m_remotePhys;
+  /** The SpectrumModels of the receivers and of the transmitted signals, by uid. */
+  std::map<SpectrumModelUid_t, Ptr<const SpectrumModel> > m_spectrumModels;
+  /** The SpectrumModels of the signals of the other systems, by system id and uid in that system. */
+  std::map<std::pair<uint32_t, SpectrumModelUid_t>, Ptr<const SpectrumModel> > m_remoteSpectrumModels;
+  /** The phys standing for the transmitters of the other systems, by node id and device index. */
+  std::map<std::pair<uint32_t, uint32_t>, Ptr<SpectrumPhy> > m_txPhys;
+  /** The last value returned by GetLookAhead. */
+  mutable Time m_lookAhead;
+  /** The lower bound of the propagation delay to the other systems, or zero if unknown. */
+  Time m_minPropagationDelay;
+};
+
+} // namespace ns3
+
+#endif /* DISTRIBUTED_SPECTRUM_CHANNEL_H */
@@ -0,0 +1,252 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include <ns3/object.h>
+#include <ns3/test.h>
+#include <ns3/simulator.h>
+#include <ns3/packet.h>
+#include <ns3/nstime.h>
+#include <ns3/config.h>
+#include <ns3/uinteger.h>
+#include <ns3/data-rate.h>
+#include <ns3/mobility-helper.h>
+#include <ns3/propagation-loss-model.h>
+#include <ns3/wifi-spectrum-value-helper.h>
+#include <ns3/spectrum-helper.h>
+#include <ns3/adhoc-aloha-noack-ideal-phy-helper.h>
+#include <ns3/packet-socket-helper.h>
+#include <ns3/packet-socket-address.h>
+#include <ns3/packet-socket-client.h>
+#include <ns3/mpi-receiver.h>
+#include <ns3/distributed-spectrum-channel.h>
+#include <cmath>
+#include <sstream>
+
+using namespace ns3;
+
+/**
+ * \ingroup distributed-spectrum
+ * \defgroup distributed-spectrum-test Distributed Spectrum module tests
+ */
+
+/**
+ * \ingroup distributed-spectrum-test
+ *
+ * Test that DistributedSpectrumChannel can receive from other systems,
+ * and sets no LookAhead when MPI is not enabled.
+ */
+class DistributedSpectrumChannelLookAheadTestCase : public TestCase
+{
+public:
+  DistributedSpectrumChannelLookAheadTestCase ();
+  virtual ~DistributedSpectrumChannelLookAheadTestCase ();
+
+private:
+  virtual void DoRun (void);
+};
+
+DistributedSpectrumChannelLookAheadTestCase::DistributedSpectrumChannelLookAheadTestCase ()
+  : TestCase ("Check the LookAhead of DistributedSpectrumChannel without MPI")
+{
+}
+
+DistributedSpectrumChannelLookAheadTestCase::~DistributedSpectrumChannelLookAheadTestCase ()
+{
+}
+
+void
+DistributedSpectrumChannelLookAheadTestCase::DoRun (void)
+{
+  Ptr<DistributedSpectrumChannel> channel = CreateObject<DistributedSpectrumChannel> ();
+  NS_TEST_ASSERT_MSG_NE (channel->GetObject<MpiReceiver> (), 0, "no MpiReceiver aggregated to the channel");
+  TimeValue lookAhead;
+  channel->GetAttribute ("LookAhead", lookAhead);
+  NS_TEST_ASSERT_MSG_EQ (lookAhead.Get (), Seconds (0), "unexpected LookAhead");
+  // the lower bound only applies to the channels reaching other systems
+  channel->SetAttribute ("MinPropagationDelay", TimeValue (MicroSeconds (5)));
+  channel->GetAttribute ("LookAhead", lookAhead);
+  NS_TEST_ASSERT_MSG_EQ (lookAhead.Get (), Seconds (0), "unexpected LookAhead without other systems");
+  Simulator::Destroy ();
+}
+
+/**
+ * \ingroup distributed-spectrum-test
+ *
+ * Test that DistributedSpectrumChannel delivers the HalfDuplexIdealPhy
+ * signals like MultiModelSpectrumChannel when MPI is not enabled: the
+ * rates below the capacity of the link get through, the others do not.
+ */
+class DistributedSpectrumChannelIdealPhyTestCase : public TestCase
+{
+public:
+  /**
+   * \param snrLinear the SNR at the receiver
+   * \param phyRate the rate of the phys
+   * \param rateIsAchievable is phyRate below the capacity of the link?
+   */
+  DistributedSpectrumChannelIdealPhyTestCase (double snrLinear, uint64_t phyRate, bool rateIsAchievable);
+  virtual ~DistributedSpectrumChannelIdealPhyTestCase ();
+
+private:
+  virtual void DoRun (void);
+
+  /**
+   * \param snrLinear the SNR at the receiver
+   * \param phyRate the rate of the phys
+   * \return the name of the test case
+   */
+  static std::string Name (double snrLinear, uint64_t phyRate);
+
+  /**
+   * \param p a packet received by a phy
+   */
+  void PhyRxEndOk (Ptr<const Packet> p);
+
+  double m_snrLinear;         ///< the SNR at the receiver
+  uint64_t m_phyRate;         ///< the rate of the phys
+  bool m_rateIsAchievable;    ///< is m_phyRate below the capacity of the link?
+  uint64_t m_rxBytes;         ///< the bytes received
+};
+
+std::string
+DistributedSpectrumChannelIdealPhyTestCase::Name (double snrLinear, uint64_t phyRate)
+{
+  std::ostringstream oss;
+  oss << "Check DistributedSpectrumChannel without MPI, snr = " << snrLinear
+      << " (linear), phyRate = " << phyRate << " bps";
+  return oss.str ();
+}
+
+DistributedSpectrumChannelIdealPhyTestCase::DistributedSpectrumChannelIdealPhyTestCase (double snrLinear,
+                                                                                        uint64_t phyRate,
+                                                                                        bool rateIsAchievable)
+  : TestCase (Name (snrLinear, phyRate)),
+    m_snrLinear (snrLinear),
+    m_phyRate (phyRate),
+    m_rateIsAchievable (rateIsAchievable),
+    m_rxBytes (0)
+{
+}
+
+DistributedSpectrumChannelIdealPhyTestCase::~DistributedSpectrumChannelIdealPhyTestCase ()
+{
+}
+
+void
+DistributedSpectrumChannelIdealPhyTestCase::PhyRxEndOk (Ptr<const Packet> p)
+{
+  m_rxBytes += p->GetSize ();
+}
+
+void
+DistributedSpectrumChannelIdealPhyTestCase::DoRun (void)
+{
+  double txPowerW = 0.1;
+  double noisePsdValue = 1.381e-23 * 290; // thermal noise at room temperature, W/Hz
+  double bandwidth = 20e6; // Hz
+  double lossDb = 10 * std::log10 (txPowerW / (m_snrLinear * noisePsdValue * bandwidth));
+  uint32_t pktSize = 50; // bytes
+  uint32_t numPkts = 200;
+  double testDuration = (numPkts * pktSize * 8.0) / m_phyRate;
+
+  NodeContainer c;
+  c.Create (2);
+
+  MobilityHelper mobility;
+  Ptr<ListPositionAllocator> positionAlloc = CreateObject<ListPositionAllocator> ();
+  positionAlloc->Add (Vector (0.0, 0.0, 0.0));
+  positionAlloc->Add (Vector (5.0, 0.0, 0.0));
+  mobility.SetPositionAllocator (positionAlloc);
+  mobility.SetMobilityModel ("ns3::ConstantPositionMobilityModel");
+  mobility.Install (c);
+
+  SpectrumChannelHelper channelHelper;
+  channelHelper.SetChannel ("ns3::DistributedSpectrumChannel");
+  channelHelper.SetPropagationDelay ("ns3::ConstantSpeedPropagationDelayModel");
+  Ptr<MatrixPropagationLossModel> propLoss = CreateObject<MatrixPropagationLossModel> ();
+  propLoss->SetLoss (c.Get (0)->GetObject<MobilityModel> (), c.Get (1)->GetObject<MobilityModel> (), lossDb, true);
+  channelHelper.AddPropagationLoss (propLoss);
+  Ptr<SpectrumChannel> channel = channelHelper.Create ();
+
+  WifiSpectrumValue5MhzFactory sf;
+  AdhocAlohaNoackIdealPhyHelper deviceHelper;
+  deviceHelper.SetChannel (channel);
+  deviceHelper.SetTxPowerSpectralDensity (sf.CreateTxPowerSpectralDensity (txPowerW, 1));
+  deviceHelper.SetNoisePowerSpectralDensity (sf.CreateConstant (noisePsdValue));
+  deviceHelper.SetPhyAttribute ("Rate", DataRateValue (DataRate (m_phyRate)));
+  NetDeviceContainer devices = deviceHelper.Install (c);
+
+  PacketSocketHelper packetSocket;
+  packetSocket.Install (c);
+
+  PacketSocketAddress socket;
+  socket.SetSingleDevice (devices.Get (0)->GetIfIndex ());
+  socket.SetPhysicalAddress (devices.Get (1)->GetAddress ());
+  socket.SetProtocol (1);
+
+  Ptr<PacketSocketClient> client = CreateObject<PacketSocketClient> ();
+  client->SetRemote (socket);
+  client->SetAttribute ("Interval", TimeValue (Seconds (double (pktSize * 8) / (1.2 * double (m_phyRate)))));
+  client->SetAttribute ("PacketSize", UintegerValue (pktSize));
+  client->SetAttribute ("MaxPackets", UintegerValue (0));
+  client->SetStartTime (Seconds (0.0));
+  client->SetStopTime (Seconds (testDuration));
+  c.Get (0)->AddApplication (client);
+
+  Config::ConnectWithoutContext ("/NodeList/*/DeviceList/*/Phy/RxEndOk",
+                                 MakeCallback (&DistributedSpectrumChannelIdealPhyTestCase::PhyRxEndOk, this));
+
+  Simulator::Stop (Seconds (testDuration + 0.000000001));
+  Simulator::Run ();
+  double throughputBps = (m_rxBytes * 8.0) / testDuration;
+  if (m_rateIsAchievable)
+    {
+      NS_TEST_ASSERT_MSG_EQ_TOL (throughputBps, m_phyRate, m_phyRate * 0.01, "throughput does not match PHY rate");
+    }
+  else
+    {
+      NS_TEST_ASSERT_MSG_EQ (throughputBps, 0.0, "PHY rate is not achievable but throughput is non-zero");
+    }
+  Simulator::Destroy ();
+}
+
+/**
+ * \ingroup distributed-spectrum-test
+ *
+ * DistributedSpectrumChannel test suite; the messages sent to the other
+ * systems are checked by the distributed-spectrum-signal-codec suite.
+ */
+class DistributedSpectrumChannelTestSuite : public TestSuite
+{
+public:
+  DistributedSpectrumChannelTestSuite ();
+};
+
+DistributedSpectrumChannelTestSuite::DistributedSpectrumChannelTestSuite ()
+  : TestSuite ("distributed-spectrum-channel", UNIT)
+{
+  AddTestCase (new DistributedSpectrumChannelLookAheadTestCase, TestCase::QUICK);
+  for (double snr = 0.01; snr <= 10; snr *= 10)
+    {
+      double achievableRate = 20e6 * std::log2 (1 + snr);
+      AddTestCase (new DistributedSpectrumChannelIdealPhyTestCase (snr, static_cast<uint64_t> (achievableRate * 0.1), true), TestCase::QUICK);
+      AddTestCase (new DistributedSpectrumChannelIdealPhyTestCase (snr, static_cast<uint64_t> (achievableRate * 0.95), true), TestCase::QUICK);
+      AddTestCase (new DistributedSpectrumChannelIdealPhyTestCase (snr, static_cast<uint64_t> (achievableRate * 1.05), false), TestCase::QUICK);
+      AddTestCase (new DistributedSpectrumChannelIdealPhyTestCase (snr, static_cast<uint64_t> (achievableRate * 4), false), TestCase::QUICK);
+    }
+}
+
+static DistributedSpectrumChannelTestSuite g_distributedSpectrumChannelTestSuite; ///< the test suite
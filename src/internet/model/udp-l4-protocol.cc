@@ -364,6 +364,14 @@ UdpL4Protocol::Receive (Ptr<Packet> packet,
     }
 
   packet->RemoveHeader(udpHeader);
+  if (endPoints.size () == 1)
+    {
+      // the packet is not used after this point, so a single receiver
+      // can take it over without a copy
+      endPoints.front ()->ForwardUp (packet, header, udpHeader.GetSourcePort (),
+                                     interface);
+      return IpL4Protocol::RX_OK;
+    }
   for (Ipv4EndPointDemux::EndPointsI endPoint = endPoints.begin ();
        endPoint != endPoints.end (); endPoint++)
     {
@@ -404,6 +412,13 @@ UdpL4Protocol::Receive (Ptr<Packet> packet,
       NS_LOG_LOGIC ("RX_ENDPOINT_UNREACH");
       return IpL4Protocol::RX_ENDPOINT_UNREACH;
     }
+  if (endPoints.size () == 1)
+    {
+      // the packet is not used after this point, so a single receiver
+      // can take it over without a copy
+      endPoints.front ()->ForwardUp (packet, header, udpHeader.GetSourcePort (), interface);
+      return IpL4Protocol::RX_OK;
+    }
   for (Ipv6EndPointDemux::EndPointsI endPoint = endPoints.begin ();
        endPoint != endPoints.end (); endPoint++)
     {
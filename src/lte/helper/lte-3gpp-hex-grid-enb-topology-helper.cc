@@ -49,6 +49,8 @@
 #include <ns3/building.h>
 #include <iostream>
 #include <iomanip>
+#include <algorithm>
+#include <cmath>
 
 
 namespace ns3 {
@@ -121,9 +123,12 @@ TypeId Lte3gppHexGridEnbTopologyHelper::GetTypeId (void)
 }
 
 Lte3gppHexGridEnbTopologyHelper::Lte3gppHexGridEnbTopologyHelper ()
+  : m_numRings (1),
+    m_d (500)
 {
   NS_LOG_FUNCTION (this);
   m_uniformRandomVariable = CreateObject<UniformRandomVariable> ();
+  UpdateWrapAroundOffsets ();
 }
 
 Lte3gppHexGridEnbTopologyHelper::~Lte3gppHexGridEnbTopologyHelper (void)
@@ -151,6 +156,7 @@ Lte3gppHexGridEnbTopologyHelper::SetNumRings (uint32_t ring)
 {
   NS_ABORT_MSG_IF (ring < 0, "Number of rings should be greater than zero");
   m_numRings = ring;
+  UpdateWrapAroundOffsets ();
 }
 
 void
@@ -165,6 +171,7 @@ Lte3gppHexGridEnbTopologyHelper::SetInterSiteDistance (double d)
 {
   NS_ABORT_MSG_IF (d < 0, "Inter site distance should be greater than zero");
   m_d = d;
+  UpdateWrapAroundOffsets ();
 }
 
 void
@@ -634,7 +641,7 @@ Lte3gppHexGridEnbTopologyHelper::GetNumRings () const
 
 
 bool
-Lte3gppHexGridEnbTopologyHelper::IsInsideHex (double xCenter, double yCenter, double h, double xPos, double yPos, bool flatBottom)
+Lte3gppHexGridEnbTopologyHelper::IsInsideHex (double xCenter, double yCenter, double h, double xPos, double yPos, bool flatBottom) const
 {
 
   double q2x = std::abs (xPos - xCenter);         // transform the test point locally and to quadrant 2
@@ -668,6 +675,27 @@ Lte3gppHexGridEnbTopologyHelper::GetDistance (double x1, double y1, double x2, d
   return sqrt ((x1 - x2) * (x1 - x2) + (y1 - y2) * (y1 - y2));
 }
 
+void
+Lte3gppHexGridEnbTopologyHelper::UpdateWrapAroundOffsets (void)
+{
+  NS_LOG_FUNCTION (this);
+
+  double s = m_d / std::sqrt (3); //hexagon side length
+  //Axial coordinates of the center of the first replica of the central cluster (C2)
+  int32_t q = 2 * static_cast<int32_t> (m_numRings) - 1;
+  int32_t r = 1 - static_cast<int32_t> (m_numRings);
+  for (uint32_t i = 0; i < 6; ++i)
+    {
+      m_wrapAroundOffsets[i][0] = (1.5 * q) * s;
+      m_wrapAroundOffsets[i][1] = (r + 0.5 * q) * m_d;
+      NS_LOG_LOGIC ("C" << i + 2 << " offset " << m_wrapAroundOffsets[i][0] << ":" << m_wrapAroundOffsets[i][1]);
+      //rotate by 60 degrees
+      int32_t tmp = q;
+      q = -r;
+      r = tmp + r;
+    }
+}
+
 bool
 Lte3gppHexGridEnbTopologyHelper::IsWithinDistance (double x, double y, std::vector<Vector> positions, double d)
 {
@@ -729,7 +757,35 @@ Lte3gppHexGridEnbTopologyHelper::AreOverlapping (double x, double y, double w, d
 }
 
 Vector
-Lte3gppHexGridEnbTopologyHelper::GetClosestPositionInWrapAround (Vector txPos, Vector rxPos)
+Lte3gppHexGridEnbTopologyHelper::DoGetClosestPositionInWrapAround (const Vector &txPos, const Vector &rxPos, double &distance) const
+{
+  //Compute the distance between the transmitter and the receiver in the central cluster (C1) along with its
+  //6 wrap-around locations (C2 to C7), in this order, and keep the first replica with the shortest distance.
+  double dx = txPos.x - rxPos.x;
+  double dy = txPos.y - rxPos.y;
+  double minD2 = dx * dx + dy * dy;
+  int32_t minIndex = -1;
+  for (uint32_t i = 0; i < 6; ++i)
+    {
+      double rdx = dx - m_wrapAroundOffsets[i][0];
+      double rdy = dy - m_wrapAroundOffsets[i][1];
+      double d2 = rdx * rdx + rdy * rdy;
+      if (d2 < minD2)
+        {
+          minD2 = d2;
+          minIndex = i;
+        }
+    }
+  distance = std::sqrt (minD2);
+  if (minIndex < 0)
+    {
+      return rxPos;
+    }
+  return Vector (rxPos.x + m_wrapAroundOffsets[minIndex][0], rxPos.y + m_wrapAroundOffsets[minIndex][1], rxPos.z);
+}
+
+Vector
+Lte3gppHexGridEnbTopologyHelper::GetClosestPositionInWrapAround (Vector txPos, Vector rxPos) const
 {
   NS_LOG_FUNCTION (this << txPos << rxPos);
 
@@ -741,126 +797,62 @@ Lte3gppHexGridEnbTopologyHelper::GetClosestPositionInWrapAround (Vector txPos, V
   //For D2D scenario, compute the distance between the transmitter UE (txPos) and the receiver UE (rxPos) along with its
   //6 wrap around locations. And then, return the position of the receiver UE with the shortest distance to transmitter UE.
 
-  double s = m_d / std::sqrt (3); //hexagon side length
-  Vector minPos (rxPos.x, rxPos.y, rxPos.z);
-  double minD = GetDistance (txPos.x, txPos.y, rxPos.x, rxPos.y);
-  NS_LOG_DEBUG ("C1 pos " << minPos << " distance=" << minD);
-  NS_LOG_DEBUG ("C1 center " << rxPos.x << ":" << rxPos.y);
-  m_enbPositionsCCluster.push_back (rxPos.x);
-  m_enbPositionsCCluster.push_back (rxPos.y);
-  //In LTE scenario, rxPos.z is the antenna orientation of the eNB and is different for all the three eNBs of three sector site.
-  //To avoid three different keys of the map for the same sight we insert m_siteHeight as z coordinate of the eNB.
-  if (rxPos.z == m_ueHeight)
-    {
-      m_enbPositionsCCluster.push_back (m_ueHeight);
-    }
-  else
-    {
-      m_enbPositionsCCluster.push_back (m_siteHeight);
-    }
-
-  Vector pos (rxPos.x + (1.5 * ((2 * m_numRings) - 1)) * s, rxPos.y + 0.5 * m_d, rxPos.z);
-  double d = GetDistance (txPos.x, txPos.y, pos.x, pos.y);
-  NS_LOG_DEBUG ("C2 pos " << pos << " distance=" << d);
-  NS_LOG_DEBUG ("C2 center " << pos.x << ":" << pos.y);
-  m_wAroundReplica.push_back (Vector (pos.x, pos.y, rxPos.z));
-
-  if (d < minD)
-    {
-      minD = d;
-      minPos = pos;
-    }
-
-  pos.x = rxPos.x + (1.5 * (m_numRings - 1)) * s;
-  pos.y = rxPos.y + (1 + (1.5 * (m_numRings - 1))) * m_d;
-  d = GetDistance (txPos.x, txPos.y, pos.x, pos.y);
-  NS_LOG_DEBUG ("C3 pos " << pos << " distance=" << d);
-  NS_LOG_DEBUG ("C3 center " << pos.x << ":" << pos.y);
-  m_wAroundReplica.push_back (Vector (pos.x, pos.y, rxPos.z));
+  double minD;
+  Vector minPos = DoGetClosestPositionInWrapAround (txPos, rxPos, minD);
+  NS_LOG_DEBUG ("Pos for min distance " << minPos << " distance=" << minD);
 
-  if (d < minD)
-    {
-      minD = d;
-      minPos = pos;
-    }
+  return minPos;
+}
 
-  pos.x = rxPos.x - (1.5 * m_numRings) * s;
-  pos.y = rxPos.y + (0.5 + (1.5 * (m_numRings - 1))) * m_d;
-  d = GetDistance (txPos.x, txPos.y, pos.x, pos.y);
-  NS_LOG_DEBUG ("C4 pos " << pos << " distance=" << d);
-  NS_LOG_DEBUG ("C4 center " << pos.x << ":" << pos.y);
-  m_wAroundReplica.push_back (Vector (pos.x, pos.y, rxPos.z));
+double
+Lte3gppHexGridEnbTopologyHelper::GetDistanceInWrapAround (Vector txPos, Vector rxPos) const
+{
+  NS_LOG_FUNCTION (this << txPos << rxPos);
 
-  if (d < minD)
-    {
-      minD = d;
-      minPos = pos;
-    }
+  NS_ABORT_MSG_IF (m_numRings > 4 || m_numRings < 0, "WRAP-AROUND : NO SUPPORT FOR TOPOLOGIES OTHER THAN 1 THROUGH 4 RINGS!");
 
-  pos.x = rxPos.x - (1.5 * ((2 * m_numRings) - 1)) * s;
-  pos.y = rxPos.y - 0.5 * m_d;
-  d = GetDistance (txPos.x, txPos.y, pos.x, pos.y);
-  NS_LOG_DEBUG ("C5 pos " << pos << " distance=" << d);
-  NS_LOG_DEBUG ("C5 center " << pos.x << ":" << pos.y);
-  m_wAroundReplica.push_back (Vector (pos.x, pos.y, rxPos.z));
+  double minD;
+  DoGetClosestPositionInWrapAround (txPos, rxPos, minD);
+  return minD;
+}
 
-  if (d < minD)
-    {
-      minD = d;
-      minPos = pos;
-    }
+void
+Lte3gppHexGridEnbTopologyHelper::GetClosestPositionsInWrapAround (Vector txPos, const std::vector<Vector> &rxPos,
+                                                                  std::vector<Vector> &closestPos, std::vector<double> &distances) const
+{
+  NS_LOG_FUNCTION (this << txPos << rxPos.size ());
 
-  pos.x = rxPos.x - (1.5 * (m_numRings - 1)) * s;
-  pos.y = rxPos.y - (1 + (1.5 * (m_numRings - 1))) * m_d;
-  d = GetDistance (txPos.x, txPos.y, pos.x, pos.y);
-  NS_LOG_DEBUG ("C6 pos " << pos << " distance=" << d);
-  NS_LOG_DEBUG ("C6 center " << pos.x << ":" << pos.y);
-  m_wAroundReplica.push_back (Vector (pos.x, pos.y, rxPos.z));
+  NS_ABORT_MSG_IF (m_numRings > 4 || m_numRings < 0, "WRAP-AROUND : NO SUPPORT FOR TOPOLOGIES OTHER THAN 1 THROUGH 4 RINGS!");
 
-  if (d < minD)
+  closestPos.resize (rxPos.size ());
+  distances.resize (rxPos.size ());
+  for (std::size_t i = 0; i < rxPos.size (); ++i)
     {
-      minD = d;
-      minPos = pos;
+      closestPos[i] = DoGetClosestPositionInWrapAround (txPos, rxPos[i], distances[i]);
     }
+}
 
-  pos.x = rxPos.x + (1.5 * m_numRings) * s;
-  pos.y = rxPos.y - (0.5 + (1.5 * (m_numRings - 1))) * m_d;
-  d = GetDistance (txPos.x, txPos.y, pos.x, pos.y);
-  NS_LOG_DEBUG ("C7 pos " << pos << " distance=" << d);
-  NS_LOG_DEBUG ("C7 center " << pos.x << ":" << pos.y);
-  m_wAroundReplica.push_back (Vector (pos.x, pos.y, rxPos.z));
-
-  if (d < minD)
-    {
-      minD = d;
-      minPos = pos;
-    }
+void
+Lte3gppHexGridEnbTopologyHelper::GetClosestPositionsInWrapAround (const std::vector<Vector> &txPos, const std::vector<Vector> &rxPos,
+                                                                  std::vector<Vector> &closestPos, std::vector<double> &distances) const
+{
+  NS_LOG_FUNCTION (this << txPos.size () << rxPos.size ());
 
-  WrapAroundReplicas replicas;
-  replicas.positions = m_wAroundReplica;
-  std::pair<std::map<std::vector<double>,WrapAroundReplicas >::iterator,bool> insertion = m_mapForWAround.insert (std::make_pair (m_enbPositionsCCluster, replicas));
-  m_enbPositionsCCluster.erase (m_enbPositionsCCluster.begin (),m_enbPositionsCCluster.end ());
-  m_wAroundReplica.erase (m_wAroundReplica.begin (), m_wAroundReplica.end ());
+  NS_ABORT_MSG_IF (m_numRings > 4 || m_numRings < 0, "WRAP-AROUND : NO SUPPORT FOR TOPOLOGIES OTHER THAN 1 THROUGH 4 RINGS!");
+  NS_ABORT_MSG_IF (txPos.size () != rxPos.size (), "The number of transmitters and receivers should be equal");
 
-  if (insertion.second)
+  closestPos.resize (rxPos.size ());
+  distances.resize (rxPos.size ());
+  for (std::size_t i = 0; i < rxPos.size (); ++i)
     {
-      NS_LOG_DEBUG ("Inserting the wrap-around replicas of hex positioned at " << m_enbPositionsCCluster[0] << " , " << m_enbPositionsCCluster[1]);
+      closestPos[i] = DoGetClosestPositionInWrapAround (txPos[i], rxPos[i], distances[i]);
     }
-  else
-    {
-      NS_LOG_DEBUG ("Insertion failed. The wrap-around replicas of hex positioned at " << m_enbPositionsCCluster[0] << " , " << m_enbPositionsCCluster[1] << "already exist in the map");
-    }
-
-  NS_LOG_DEBUG ("Pos for min distance " << minPos << " distance=" << minD);
-
-  return minPos;
 }
 
 std::vector< Ptr<Building> >
 Lte3gppHexGridEnbTopologyHelper::InstallWrapAroundBuildings (std::vector< Ptr<Building> > buildings)
 {
   NS_ABORT_MSG_IF (m_numRings > 4 || m_numRings < 0, "WRAP-AROUND : NO SUPPORT FOR TOPOLOGIES OTHER THAN 1 THROUGH 4 RINGS!");
-  double s = m_d / std::sqrt (3); //hexagon side length
 
   std::vector< Ptr<Building> > allBuildings;
   std::vector< Ptr<Building> >::iterator it;
@@ -869,12 +861,12 @@ Lte3gppHexGridEnbTopologyHelper::InstallWrapAroundBuildings (std::vector< Ptr<Bu
       Box b = (*it)->GetBoundaries ();
       //add current building and 6 other copies in extended coverage
       allBuildings.push_back (*it); // no need to duplicate the building
-      allBuildings.push_back (AddBuilding (b.xMin + (1.5 * ((2 * m_numRings) - 1)) * s, b.xMax + (1.5 * ((2 * m_numRings) - 1)) * s, b.yMin + 0.5 * m_d, b.yMax + 0.5 * m_d, b.zMin, b.zMax));
-      allBuildings.push_back (AddBuilding (b.xMin + (1.5 * (m_numRings - 1)) * s, b.xMax + (1.5 * (m_numRings - 1)) * s, b.yMin + (1 + (1.5 * (m_numRings - 1))) * m_d, b.yMax + (1 + (1.5 * (m_numRings - 1))) * m_d, b.zMin, b.zMax));
-      allBuildings.push_back (AddBuilding (b.xMin - (1.5 * m_numRings) * s, b.xMax - (1.5 * m_numRings) * s, b.yMin + (0.5 + (1.5 * (m_numRings - 1))) * m_d, b.yMax + (0.5 + (1.5 * (m_numRings - 1))) * m_d, b.zMin, b.zMax));
-      allBuildings.push_back (AddBuilding (b.xMin - (1.5 * ((2 * m_numRings) - 1)) * s, b.xMax - (1.5 * ((2 * m_numRings) - 1)) * s, b.yMin - 0.5 * m_d, b.yMax - 0.5 * m_d, b.zMin, b.zMax));
-      allBuildings.push_back (AddBuilding (b.xMin - (1.5 * (m_numRings - 1)) * s, b.xMax - (1.5 * (m_numRings - 1)) * s, b.yMin - (1 + (1.5 * (m_numRings - 1))) * m_d, b.yMax - (1 + (1.5 * (m_numRings - 1))) * m_d, b.zMin, b.zMax));
-      allBuildings.push_back (AddBuilding (b.xMin + (1.5 * m_numRings) * s, b.xMax + (1.5 * m_numRings) * s, b.yMin - (0.5 + (1.5 * (m_numRings - 1))) * m_d, b.yMax - (0.5 + (1.5 * (m_numRings - 1))) * m_d, b.zMin, b.zMax));
+      for (uint32_t i = 0; i < 6; ++i)
+        {
+          double dx = m_wrapAroundOffsets[i][0];
+          double dy = m_wrapAroundOffsets[i][1];
+          allBuildings.push_back (AddBuilding (b.xMin + dx, b.xMax + dx, b.yMin + dy, b.yMax + dy, b.zMin, b.zMax));
+        }
     }
   return allBuildings;
 }
@@ -883,79 +875,85 @@ void
 Lte3gppHexGridEnbTopologyHelper::AttachWithWrapAround (Ptr<PropagationLossModel> lossModel, NetDeviceContainer ueDevices, NetDeviceContainer enbDevices)
 {
   NS_ABORT_MSG_IF (m_numRings > 4 || m_numRings < 0, "WRAP-AROUND : NO SUPPORT FOR TOPOLOGIES OTHER THAN 1 THROUGH 4 RINGS!");
-  Vector closestPos;
-  Vector bestClosestPos;
-  Ptr<NetDevice> enbDev;
-  Ptr<NetDevice> bestEnbDev;
-  Ptr<NetDevice> ueDev;
   uint32_t bestEnb = 0;
   double rsrp = 0;
   double bestRsrp;
-  double txPower = 0;
+  Vector bestClosestPos;
   Vector posUe;
-  Vector posEnb;
-  Ptr<LteUeNetDevice> lteUeDev;
-  Ptr<LteEnbNetDevice> lteEnbDev;
-  Ptr<LteEnbNetDevice> bestLteEnbDev;
 
   NS_LOG_DEBUG ("Number of UEs : " << ueDevices.GetN ());
   NS_LOG_DEBUG ("Number of eNBs : " << enbDevices.GetN ());
 
+  //The eNBs do not move during the attachment, so their positions, transmission power and
+  //PHYs are retrieved once for all the UEs
+  std::vector<Vector> posEnbs (enbDevices.GetN ());
+  std::vector<double> txPowers (enbDevices.GetN ());
+  std::vector< Ptr<SpectrumPhy> > txPhys (enbDevices.GetN ());
+  std::vector< Ptr<MobilityModel> > enbMobilities (enbDevices.GetN ());
+  for (uint32_t i = 0; i < enbDevices.GetN (); ++i)
+    {
+      Ptr<LteEnbNetDevice> lteEnbDev = DynamicCast<LteEnbNetDevice> (enbDevices.Get (i));
+      NS_ABORT_MSG_IF (lteEnbDev == 0, "No LteEnbNetDevice found");
+      Ptr<LteEnbPhy> lteEnbPhy = lteEnbDev->GetPhy ();
+      NS_ABORT_MSG_IF (lteEnbPhy == 0, "No LteEnbPhy found");
+      txPowers[i] = lteEnbPhy->GetTxPower ();
+      NS_LOG_DEBUG ("Txpower : " << txPowers[i]);
+      txPhys[i] = lteEnbPhy->GetDlSpectrumPhy ();
+      enbMobilities[i] = lteEnbDev->GetNode ()->GetObject<MobilityModel> ();
+      posEnbs[i] = enbMobilities[i]->GetPosition ();
+    }
+
+  std::vector<Vector> closestPos;
+  std::vector<double> distances;
   for (uint32_t u = 0; u < ueDevices.GetN (); ++u)
     {
       bestRsrp = -std::numeric_limits<double>::infinity ();
-      ueDev = ueDevices.Get (u);
+      Ptr<NetDevice> ueDev = ueDevices.Get (u);
       posUe = ueDev->GetNode ()->GetObject<MobilityModel> ()->GetPosition ();
 
+      Ptr<LteUeNetDevice> lteUeDev = DynamicCast<LteUeNetDevice> (ueDev);
+      NS_ABORT_MSG_IF (lteUeDev == 0, "No LteUeNetDevice found");
+      Ptr<LteUePhy> lteUePhy = lteUeDev->GetPhy ();
+      NS_ABORT_MSG_IF (lteUePhy == 0, "No LteUePhy found");
+      Ptr<SpectrumPhy> rxPhy = lteUePhy->GetUlSpectrumPhy ();
+
+      //Find the positions of the eNBs closest to the UE (out of each eNB and its six wrap-around locations)
+      GetClosestPositionsInWrapAround (posUe, posEnbs, closestPos, distances);
+
       for (uint32_t i = 0; i < enbDevices.GetN (); ++i)
         {
-
-          enbDev = enbDevices.Get (i);
-          //Save the position of the eNB to restore it after RSRP is calculated for its closest position including its wrap-around locations
-          posEnb = enbDev->GetNode ()->GetObject<MobilityModel> ()->GetPosition ();
-          //Find position of the eNB closest to the UE (out of the eNB and its six wrap-around locations)
-          closestPos = GetClosestPositionInWrapAround (posUe,posEnb);
           //Change the position of the eNB and set location to the found closest eNB
           //to act as an eNB in a wrap-around location, so RSRP can be calculated
-          enbDev->GetNode ()->GetObject<MobilityModel> ()->SetPosition (closestPos);
-          lteEnbDev = DynamicCast<LteEnbNetDevice> (enbDev);
-          NS_ABORT_MSG_IF (lteEnbDev == 0, "No LteEnbNetDevice found");
-          Ptr<LteEnbPhy> lteEnbPhy = lteEnbDev->GetPhy ();
-          NS_ABORT_MSG_IF (lteEnbPhy == 0, "No LteEnbPhy found");
-          txPower = lteEnbPhy->GetTxPower ();
-          NS_LOG_DEBUG ("Txpower : " << txPower);
-          Ptr<SpectrumPhy> txPhy = lteEnbPhy->GetDlSpectrumPhy ();
-
-
-          lteUeDev = DynamicCast<LteUeNetDevice> (ueDev);
-          NS_ABORT_MSG_IF (lteUeDev == 0, "No LteUeNetDevice found");
-          Ptr<LteUePhy> lteUePhy = lteUeDev->GetPhy ();
-          NS_ABORT_MSG_IF (lteUePhy == 0, "No LteUePhy found");
-          Ptr<SpectrumPhy> rxPhy = lteUePhy->GetUlSpectrumPhy ();
+          bool moved = closestPos[i].x != posEnbs[i].x || closestPos[i].y != posEnbs[i].y;
+          if (moved)
+            {
+              enbMobilities[i]->SetPosition (closestPos[i]);
+            }
 
           //Calculate RSRP from eNB to UE
-          rsrp = SidelinkRsrpCalculator::CalcSlRsrpTxPw (lossModel, txPower, txPhy, rxPhy);
-
-          NS_LOG_DEBUG ("UE : " << u << " IMSI : " << lteUeDev->GetImsi () << " to Cell id : " << lteEnbDev->GetCellId ()
-                                << " Position of closest eNB : " << lteEnbDev->GetNode ()->GetObject<MobilityModel> ()->GetPosition () << " RSRP : " << rsrp << " dBm");
+          rsrp = SidelinkRsrpCalculator::CalcSlRsrpTxPw (lossModel, txPowers[i], txPhys[i], rxPhy);
 
+          NS_LOG_DEBUG ("UE : " << u << " IMSI : " << lteUeDev->GetImsi () << " to eNB : " << i
+                                << " Position of closest eNB : " << closestPos[i] << " RSRP : " << rsrp << " dBm");
 
           if (bestRsrp < rsrp)
             {
               bestRsrp = rsrp;
               bestEnb = i;
-              bestClosestPos = closestPos;
+              bestClosestPos = closestPos[i];
             }
           //Restore eNB position, since we already cache the pathloss restoring the position will not affect the future pathloss values.
           //This is needed to keep intact the position of the central cluster so that the remaining UEs can find the closest position correctly.
-          enbDev->GetNode ()->GetObject<MobilityModel> ()->SetPosition (posEnb);
+          if (moved)
+            {
+              enbMobilities[i]->SetPosition (posEnbs[i]);
+            }
         }
 
-
-      bestEnbDev = enbDevices.Get (bestEnb);
+      Ptr<NetDevice> bestEnbDev = enbDevices.Get (bestEnb);
       m_lteHelper->Attach (ueDev,bestEnbDev); //attach
 
-      bestLteEnbDev = DynamicCast<LteEnbNetDevice> (bestEnbDev);
+      Ptr<LteEnbNetDevice> bestLteEnbDev = DynamicCast<LteEnbNetDevice> (bestEnbDev);
 
       NS_LOG_DEBUG ("Attached UE with IMSI : " << lteUeDev->GetImsi () << " to Cell id : " << bestLteEnbDev->GetCellId ()
                                                << " Best eNB position  : " << bestClosestPos << " RSRP = " << bestRsrp);
@@ -963,7 +961,7 @@ Lte3gppHexGridEnbTopologyHelper::AttachWithWrapAround (Ptr<PropagationLossModel>
       if (IsInWrapAround (bestClosestPos.x, bestClosestPos.y))
         {
           NS_LOG_DEBUG ("Attached in wrap-around. UE : " << u << " IMSI : " << lteUeDev->GetImsi () << " to Cell id : " << bestLteEnbDev->GetCellId ()
-                                                         << " Position of best eNB in central cluster : " << bestEnbDev->GetNode ()->GetObject<MobilityModel> ()->GetPosition ()
+                                                         << " Position of best eNB in central cluster : " << posEnbs[bestEnb]
                                                          << " Best eNB position in wrap-around : " << bestClosestPos);
           m_imsi = lteUeDev->GetImsi ();
           m_wrapAroundInfo.cellId = bestLteEnbDev->GetCellId ();
@@ -1015,7 +1013,23 @@ std::map<std::vector<double>,WrapAroundReplicas>
 Lte3gppHexGridEnbTopologyHelper:: GetWrapAroundPositions ()
 {
   NS_LOG_FUNCTION (this);
-  return m_mapForWAround;
+
+  NS_ABORT_MSG_IF (m_numRings > 4 || m_numRings < 0, "WRAP-AROUND : NO SUPPORT FOR TOPOLOGIES OTHER THAN 1 THROUGH 4 RINGS!");
+
+  std::map<std::vector<double>,WrapAroundReplicas> mapForWAround;
+  std::vector<Vector> nodePositions = GetNodePositions ();
+  //The three sectors of a site share the same position, the z coordinate being their antenna orientation
+  for (uint32_t n = 0; n < nodePositions.size (); n += 3)
+    {
+      std::vector<double> site {nodePositions[n].x, nodePositions[n].y, m_siteHeight};
+      WrapAroundReplicas replicas;
+      for (uint32_t i = 0; i < 6; ++i)
+        {
+          replicas.positions.push_back (Vector (site[0] + m_wrapAroundOffsets[i][0], site[1] + m_wrapAroundOffsets[i][1], m_siteHeight));
+        }
+      mapForWAround.insert (std::make_pair (site, replicas));
+    }
+  return mapForWAround;
 }
 
 std::map<uint64_t,WrapAroundInfo_t>
@@ -1026,64 +1040,56 @@ Lte3gppHexGridEnbTopologyHelper::GetWrapAroundAttachInfo ()
 }
 
 bool
-Lte3gppHexGridEnbTopologyHelper::IsInWrapAround (double x, double y)
+Lte3gppHexGridEnbTopologyHelper::IsInWrapAround (double x, double y) const
 {
   NS_LOG_FUNCTION (this << x << y);
 
-  bool isInWrapAround = false;
-
-  double interSiteDistance = m_d;
-  uint32_t numRings = GetNumRings ();
-  NS_LOG_DEBUG ("numRings " << numRings);
-  double s = interSiteDistance / std::sqrt (3); //hexagon side length
-  double xCenterLastRing = 0;
-  double xMaxLastRing = 0;
-  double yMaxLastRing = 0;
-
-  uint32_t moreThanOneRings = numRings > 1 ? 1 : 0;
-  xCenterLastRing = (3 * s / 2) * (numRings - 1);
-  xMaxLastRing = s + xCenterLastRing  * moreThanOneRings;
-  yMaxLastRing = interSiteDistance * (numRings - 1) + interSiteDistance / 2;
-
-  NS_LOG_DEBUG ("xMinLastRing " << -xMaxLastRing << " xMaxLastRing " << xMaxLastRing << " yMinLastRing " << -yMaxLastRing << " yMaxLastRing " << yMaxLastRing);
-
-  //Before checking every hexagon of central cluster do a quick check to detect if the point is outside max limits.
-  if (x > xMaxLastRing || x < -xMaxLastRing)
+  //The sites are the centers of the hexagons of a lattice with flat top and bottom sides. Compute the
+  //axial coordinates (q, r) of the point in this lattice, and round them to find the closest site.
+  double s = m_d / std::sqrt (3); //hexagon side length
+  double q = (2.0 / 3.0 * x) / s;
+  double r = (-x / 3.0 + std::sqrt (3) / 3.0 * y) / s;
+  double qRound = std::round (q);
+  double rRound = std::round (r);
+  double sRound = std::round (-q - r);
+  double qDiff = std::abs (qRound - q);
+  double rDiff = std::abs (rRound - r);
+  double sDiff = std::abs (sRound + q + r);
+  if (qDiff > rDiff && qDiff > sDiff)
     {
-      NS_LOG_DEBUG ("Point is in wrap-around");
-      isInWrapAround = true;
-      return isInWrapAround;
+      qRound = -rRound - sRound;
     }
-  else if (y > yMaxLastRing || y < -yMaxLastRing)
+  else if (rDiff > sDiff)
     {
-      NS_LOG_DEBUG ("Point is in wrap-around");
-      isInWrapAround = true;
-      return isInWrapAround;
+      rRound = -qRound - sRound;
     }
+  int32_t hexQ = static_cast<int32_t> (qRound);
+  int32_t hexR = static_cast<int32_t> (rRound);
+  int32_t maxRing = static_cast<int32_t> (m_numRings) - 1;
 
-//if we reach here that means the point is in one of the corner hex whose center is under the limits of +-xMaxLastRing,+-yMaxLastRing but still
-//is out of central cluster. For 2 rings, there will 4 such hexagon, each on one corner and for 3 and 4 rings there will be 8 and 12, respectively.
-//In any case, this function is general enough to detect any point outside the hexagons of central cluster.
-
-  std::vector<Vector> nodePositions = GetNodePositions ();
+  //The central cluster holds the sites at less than m_numRings hexagons from the center
+  if (std::max (std::abs (hexQ), std::max (std::abs (hexR), std::abs (hexQ + hexR))) <= maxRing)
+    {
+      NS_LOG_DEBUG ("Point is inside of the central cluster hexagon. Hex center : " << 1.5 * hexQ * s << " : " << (hexR + 0.5 * hexQ) * m_d);
+      return false;
+    }
 
-  for (const auto &it : nodePositions)
+  //A point on the side of a hexagon of the central cluster is inside of the central cluster
+  static const int32_t neighbors[6][2] = {{1, 0}, {1, -1}, {0, -1}, {-1, 0}, {-1, 1}, {0, 1}};
+  for (uint32_t i = 0; i < 6; ++i)
     {
-      if (!(IsInsideHex (it.x, it.y, interSiteDistance / 2, x, y, true)))
+      int32_t nq = hexQ + neighbors[i][0];
+      int32_t nr = hexR + neighbors[i][1];
+      if (std::max (std::abs (nq), std::max (std::abs (nr), std::abs (nq + nr))) <= maxRing
+          && IsInsideHex (1.5 * nq * s, (nr + 0.5 * nq) * m_d, m_d / 2, x, y, true))
         {
-          NS_LOG_DEBUG ("Point is in wrap-around. Hex center : " << it.x << " : " << it.y);
-          isInWrapAround = true;
-          NS_LOG_DEBUG ("Check remaining hexagons if any");
-        }
-      else
-        {
-          NS_LOG_DEBUG ("Point is inside of the central cluster hexagon. Hex center : " << it.x << " : " << it.y);
-          isInWrapAround = false;
-          break;
+          NS_LOG_DEBUG ("Point is inside of the central cluster hexagon. Hex center : " << 1.5 * nq * s << " : " << (nr + 0.5 * nq) * m_d);
+          return false;
         }
     }
 
-  return isInWrapAround;
+  NS_LOG_DEBUG ("Point is in wrap-around");
+  return true;
 }
 
 
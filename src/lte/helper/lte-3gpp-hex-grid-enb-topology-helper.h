@@ -229,13 +229,56 @@ public:
    * Returns the position of the closest replica of the current cell in wrap-around
    * topology with respect to receiver's position.
    *
+   * The six replicas of a position are obtained by adding the translations of
+   * the central cluster, which are computed once from the hex-lattice
+   * coordinates of the cluster when the number of rings or the inter-site
+   * distance is set, so that this function does not allocate memory and
+   * can be called by the propagation loss models during the simulation.
+   *
    * \param txPos The position of the transmitter
    * \param rxPos The position of the receiver
    *
    * \return The position of the closest replica of the current cell in wrap-around
    * topology
    */
-  Vector GetClosestPositionInWrapAround (Vector txPos, Vector rxPos);
+  Vector GetClosestPositionInWrapAround (Vector txPos, Vector rxPos) const;
+
+  /**
+   * Returns the 2D distance between a transmitter and the closest replica of
+   * a receiver in wrap-around topology, see GetClosestPositionInWrapAround.
+   *
+   * \param txPos The position of the transmitter
+   * \param rxPos The position of the receiver
+   *
+   * \return The 2D distance in m
+   */
+  double GetDistanceInWrapAround (Vector txPos, Vector rxPos) const;
+
+  /**
+   * Computes, for a transmitter and many receivers, the position of the
+   * closest replica of each receiver in wrap-around topology and its 2D
+   * distance from the transmitter.
+   *
+   * \param txPos The position of the transmitter
+   * \param rxPos The positions of the receivers
+   * \param closestPos The positions of the closest replicas, resized to the number of receivers
+   * \param distances The 2D distances in m, resized to the number of receivers
+   */
+  void GetClosestPositionsInWrapAround (Vector txPos, const std::vector<Vector> &rxPos,
+                                        std::vector<Vector> &closestPos, std::vector<double> &distances) const;
+
+  /**
+   * Computes, for many transmitter-receiver pairs, the position of the
+   * closest replica of the receiver in wrap-around topology and its 2D
+   * distance from the transmitter.
+   *
+   * \param txPos The positions of the transmitters
+   * \param rxPos The positions of the receivers, one per transmitter
+   * \param closestPos The positions of the closest replicas, resized to the number of pairs
+   * \param distances The 2D distances in m, resized to the number of pairs
+   */
+  void GetClosestPositionsInWrapAround (const std::vector<Vector> &txPos, const std::vector<Vector> &rxPos,
+                                        std::vector<Vector> &closestPos, std::vector<double> &distances) const;
 
   /**
    * Returns a vector containing the positions of all the hotspots created
@@ -282,12 +325,12 @@ public:
   uint32_t GetNumRings () const;
 
   /**
-   * Returns a map containing the position of each hexagon and its six replicas in wrap-around
-   * map key value: a vector containing the coordinates of a hexagon in central cluster
-   * map mapped value: an object of WrapAroundReplicas, which is a vector containing theç
+   * Returns a map containing the position of each site and its six replicas in wrap-around
+   * map key value: a vector containing the coordinates of a site in central cluster
+   * map mapped value: an object of WrapAroundReplicas, which is a vector containing the
    * coordinates of all the six replicas
    *
-   * \return A map containing the position of each hexagon and its six replicas in wrap-around
+   * \return A map containing the position of each site and its six replicas in wrap-around
    */
   std::map<std::vector <double>,WrapAroundReplicas> GetWrapAroundPositions ();
 
@@ -307,7 +350,7 @@ public:
    *
    * \return True if a point lie in any of the wrap-around hexagon, False otherwise
    */
-  bool IsInWrapAround (double x, double y);
+  bool IsInWrapAround (double x, double y) const;
 
   /**
    * Assign a fixed random variable stream number to the random variables
@@ -333,7 +376,7 @@ private:
    *
    * \return True if the given x,y coordinate lie inside the hexagon, False otherwise
    */
-  bool IsInsideHex (double xCenter, double yCenter, double h, double xPos, double yPos, bool flatBottom);
+  bool IsInsideHex (double xCenter, double yCenter, double h, double xPos, double yPos, bool flatBottom) const;
 
   /**
    * Get distance function
@@ -347,6 +390,26 @@ private:
    */
   double GetDistance (double x1, double y1, double x2, double y2);
 
+  /**
+   * Computes the translations of the central cluster giving the six
+   * wrap-around replicas, for the current number of rings and inter-site
+   * distance. In the axial coordinates of the hexagonal lattice of the
+   * sites, the first translation is (2n - 1, 1 - n) for n rings, and
+   * the other ones are its rotations by multiples of 60 degrees.
+   */
+  void UpdateWrapAroundOffsets (void);
+
+  /**
+   * Find the closest replica of a receiver in wrap-around
+   *
+   * \param txPos The position of the transmitter
+   * \param rxPos The position of the receiver
+   * \param [out] distance The 2D distance between the transmitter and the closest replica
+   *
+   * \return The position of the closest replica
+   */
+  Vector DoGetClosestPositionInWrapAround (const Vector &txPos, const Vector &rxPos, double &distance) const;
+
   /**
    * Get node positions function
    *
@@ -454,9 +517,7 @@ private:
    */
   std::vector<Vector> m_hotspotPositions;
   Ptr<UniformRandomVariable> m_uniformRandomVariable; ///< Provides uniform random variables.
-  std::vector<double> m_enbPositionsCCluster; ///< Stores the position of an eNB in the central cluster of hexagonal grid
-  std::vector<Vector> m_wAroundReplica; ///< Stores the coordinates of all the six replicas
-  std::map<std::vector<double>,WrapAroundReplicas> m_mapForWAround; ///< A map for storing position of each hexagon and its six replicas in wrap-around
+  double m_wrapAroundOffsets[6][2]; ///< The x and y translations of the central cluster giving the six wrap-around replicas
   uint64_t m_imsi; ///< IMSI of the UE attached to an eNB in the wrap-around
   WrapAroundInfo_t m_wrapAroundInfo; ///< structure object to hold the wrap-around info of the UE
   std::map<uint64_t,WrapAroundInfo_t> m_mapForWrapAroundInfo; ///< map to store wrap-around info of the UE
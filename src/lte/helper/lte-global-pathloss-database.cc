@@ -23,7 +23,9 @@
 #include "ns3/lte-enb-net-device.h"
 #include "ns3/lte-ue-net-device.h"
 #include "ns3/lte-spectrum-phy.h"
+#include "ns3/spectrum-channel.h"
 
+#include <cmath>
 #include <limits>
 
 namespace ns3 {
@@ -96,5 +98,231 @@ UplinkLteGlobalPathlossDatabase::UpdatePathloss (std::string context,
 }
 
 
+LteDensePathlossDatabase::LteDensePathlossDatabase (void)
+{
+}
+
+LteDensePathlossDatabase::~LteDensePathlossDatabase (void)
+{
+  for (std::vector<Ptr<SpectrumChannel> >::iterator it = m_channels.begin ();
+       it != m_channels.end ();
+       ++it)
+    {
+      (*it)->TraceDisconnectWithoutContext ("PathLoss", MakeCallback (&LteDensePathlossDatabase::DoUpdatePathloss, this));
+    }
+}
+
+void
+LteDensePathlossDatabase::ConnectToChannel (Ptr<SpectrumChannel> channel)
+{
+  NS_LOG_FUNCTION (this << channel);
+  channel->TraceConnectWithoutContext ("PathLoss", MakeCallback (&LteDensePathlossDatabase::DoUpdatePathloss, this));
+  m_channels.push_back (channel);
+}
+
+void
+LteDensePathlossDatabase::DoUpdatePathloss (Ptr<const SpectrumPhy> txPhy, Ptr<const SpectrumPhy> rxPhy, double lossDb)
+{
+  UpdatePathloss (txPhy, rxPhy, lossDb);
+}
+
+double
+LteDensePathlossDatabase::GetPathloss (uint16_t cellId, uint64_t imsi) const
+{
+  NS_LOG_FUNCTION (this << cellId << imsi);
+  std::unordered_map<uint16_t, uint32_t>::const_iterator cellIt = m_cellIndexById.find (cellId);
+  std::unordered_map<uint64_t, uint32_t>::const_iterator ueIt = m_ueIndexByImsi.find (imsi);
+  if (cellIt == m_cellIndexById.end () || ueIt == m_ueIndexByImsi.end ())
+    {
+      return std::numeric_limits<double>::infinity ();
+    }
+  float lossDb = m_pathloss[cellIt->second][ueIt->second];
+  if (std::isnan (lossDb))
+    {
+      return std::numeric_limits<double>::infinity ();
+    }
+  return lossDb;
+}
+
+uint16_t
+LteDensePathlossDatabase::GetBestCellId (uint64_t imsi) const
+{
+  NS_LOG_FUNCTION (this << imsi);
+  std::unordered_map<uint64_t, uint32_t>::const_iterator ueIt = m_ueIndexByImsi.find (imsi);
+  if (ueIt == m_ueIndexByImsi.end ())
+    {
+      return 0;
+    }
+  uint16_t bestCellId = 0;
+  float bestLoss = std::numeric_limits<float>::infinity ();
+  for (uint32_t cellIndex = 0; cellIndex < m_pathloss.size (); ++cellIndex)
+    {
+      float lossDb = m_pathloss[cellIndex][ueIt->second];
+      // NaN compares false, i.e., missing values are skipped
+      if (lossDb < bestLoss)
+        {
+          bestLoss = lossDb;
+          bestCellId = m_cellIds[cellIndex];
+        }
+    }
+  return bestCellId;
+}
+
+uint32_t
+LteDensePathlossDatabase::GetNCells (void) const
+{
+  return m_cellIds.size ();
+}
+
+uint32_t
+LteDensePathlossDatabase::GetNUes (void) const
+{
+  return m_imsis.size ();
+}
+
+uint16_t
+LteDensePathlossDatabase::GetCellId (uint32_t cellIndex) const
+{
+  NS_ASSERT (cellIndex < m_cellIds.size ());
+  return m_cellIds[cellIndex];
+}
+
+uint64_t
+LteDensePathlossDatabase::GetImsi (uint32_t ueIndex) const
+{
+  NS_ASSERT (ueIndex < m_imsis.size ());
+  return m_imsis[ueIndex];
+}
+
+const float*
+LteDensePathlossDatabase::GetCellPathlosses (uint32_t cellIndex) const
+{
+  NS_ASSERT (cellIndex < m_pathloss.size ());
+  return m_pathloss[cellIndex].data ();
+}
+
+void
+LteDensePathlossDatabase::ExportCsv (std::ostream &os) const
+{
+  NS_LOG_FUNCTION (this);
+  for (uint32_t cellIndex = 0; cellIndex < m_pathloss.size (); ++cellIndex)
+    {
+      const std::vector<float> &row = m_pathloss[cellIndex];
+      for (uint32_t ueIndex = 0; ueIndex < row.size (); ++ueIndex)
+        {
+          if (!std::isnan (row[ueIndex]))
+            {
+              os << m_cellIds[cellIndex] << "," << m_imsis[ueIndex] << "," << row[ueIndex] << "\n";
+            }
+        }
+    }
+}
+
+void
+LteDensePathlossDatabase::ExportBinary (std::ostream &os) const
+{
+  NS_LOG_FUNCTION (this);
+  uint32_t nCells = m_cellIds.size ();
+  uint32_t nUes = m_imsis.size ();
+  os.write (reinterpret_cast<const char *> (&nCells), sizeof (nCells));
+  os.write (reinterpret_cast<const char *> (&nUes), sizeof (nUes));
+  os.write (reinterpret_cast<const char *> (m_cellIds.data ()), nCells * sizeof (uint16_t));
+  os.write (reinterpret_cast<const char *> (m_imsis.data ()), nUes * sizeof (uint64_t));
+  for (uint32_t cellIndex = 0; cellIndex < nCells; ++cellIndex)
+    {
+      os.write (reinterpret_cast<const char *> (m_pathloss[cellIndex].data ()), nUes * sizeof (float));
+    }
+}
+
+void
+LteDensePathlossDatabase::SetPathloss (Ptr<const SpectrumPhy> enbPhy, Ptr<const SpectrumPhy> uePhy, double lossDb)
+{
+  int32_t cellIndex = GetCellIndex (enbPhy);
+  int32_t ueIndex = GetUeIndex (uePhy);
+  if (cellIndex < 0 || ueIndex < 0)
+    {
+      return;
+    }
+  m_pathloss[cellIndex][ueIndex] = lossDb;
+}
+
+int32_t
+LteDensePathlossDatabase::GetCellIndex (Ptr<const SpectrumPhy> phy)
+{
+  std::unordered_map<const SpectrumPhy *, int32_t>::iterator it = m_cellIndexByPhy.find (PeekPointer (phy));
+  if (it != m_cellIndexByPhy.end ())
+    {
+      return it->second;
+    }
+  int32_t index = -1;
+  Ptr<NetDevice> device = phy->GetDevice ();
+  Ptr<LteEnbNetDevice> enbDevice = device ? device->GetObject<LteEnbNetDevice> () : 0;
+  if (enbDevice)
+    {
+      uint16_t cellId = enbDevice->GetCellId ();
+      std::unordered_map<uint16_t, uint32_t>::iterator cellIt = m_cellIndexById.find (cellId);
+      if (cellIt == m_cellIndexById.end ())
+        {
+          NS_LOG_LOGIC ("assigning index " << m_cellIds.size () << " to cell " << cellId);
+          cellIt = m_cellIndexById.insert (std::make_pair (cellId, m_cellIds.size ())).first;
+          m_cellIds.push_back (cellId);
+          m_pathloss.push_back (std::vector<float> (m_imsis.size (), std::numeric_limits<float>::quiet_NaN ()));
+        }
+      index = cellIt->second;
+    }
+  m_cellIndexByPhy[PeekPointer (phy)] = index;
+  return index;
+}
+
+int32_t
+LteDensePathlossDatabase::GetUeIndex (Ptr<const SpectrumPhy> phy)
+{
+  std::unordered_map<const SpectrumPhy *, int32_t>::iterator it = m_ueIndexByPhy.find (PeekPointer (phy));
+  if (it != m_ueIndexByPhy.end ())
+    {
+      return it->second;
+    }
+  int32_t index = -1;
+  Ptr<NetDevice> device = phy->GetDevice ();
+  Ptr<LteUeNetDevice> ueDevice = device ? device->GetObject<LteUeNetDevice> () : 0;
+  if (ueDevice)
+    {
+      uint64_t imsi = ueDevice->GetImsi ();
+      std::unordered_map<uint64_t, uint32_t>::iterator ueIt = m_ueIndexByImsi.find (imsi);
+      if (ueIt == m_ueIndexByImsi.end ())
+        {
+          NS_LOG_LOGIC ("assigning index " << m_imsis.size () << " to IMSI " << imsi);
+          ueIt = m_ueIndexByImsi.insert (std::make_pair (imsi, m_imsis.size ())).first;
+          m_imsis.push_back (imsi);
+          for (std::vector<std::vector<float> >::iterator rowIt = m_pathloss.begin ();
+               rowIt != m_pathloss.end ();
+               ++rowIt)
+            {
+              rowIt->push_back (std::numeric_limits<float>::quiet_NaN ());
+            }
+        }
+      index = ueIt->second;
+    }
+  m_ueIndexByPhy[PeekPointer (phy)] = index;
+  return index;
+}
+
+void
+DownlinkLteDensePathlossDatabase::UpdatePathloss (Ptr<const SpectrumPhy> txPhy,
+                                                  Ptr<const SpectrumPhy> rxPhy,
+                                                  double lossDb)
+{
+  NS_LOG_FUNCTION (this << lossDb);
+  SetPathloss (txPhy, rxPhy, lossDb);
+}
+
+void
+UplinkLteDensePathlossDatabase::UpdatePathloss (Ptr<const SpectrumPhy> txPhy,
+                                                Ptr<const SpectrumPhy> rxPhy,
+                                                double lossDb)
+{
+  NS_LOG_FUNCTION (this << lossDb);
+  SetPathloss (rxPhy, txPhy, lossDb);
+}
 
 } // namespace ns3
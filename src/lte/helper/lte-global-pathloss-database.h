@@ -26,10 +26,14 @@
 #include <ns3/ptr.h>
 #include <string>
 #include <map>
+#include <ostream>
+#include <unordered_map>
+#include <vector>
 
 namespace ns3 {
 
 class SpectrumPhy;
+class SpectrumChannel;
 
 /**
  * \ingroup lte
@@ -101,6 +105,182 @@ public:
   virtual void UpdatePathloss (std::string context, Ptr<const SpectrumPhy> txPhy, Ptr<const SpectrumPhy> rxPhy, double lossDb);
 };
 
+/**
+ * \ingroup lte
+ *
+ * Store the last pathloss value for each eNB-UE pair in dense arrays.
+ *
+ * This is a variant of LteGlobalPathlossDatabase for large scenarios:
+ * each cell and each UE is assigned an index the first time one of its
+ * PHYs is seen, the PHYs are classified only once, and the values are
+ * kept in one contiguous float array per cell, indexed by the UE index.
+ * The database is bound directly to the PathLoss trace of a
+ * SpectrumChannel by ConnectToChannel, so that no trace context string is
+ * built nor parsed at each update. The pairs which are not eNB-UE pairs
+ * for the direction of the database (e.g., sidelink UE-UE pairs) are
+ * ignored.
+ *
+ * The PHYs are identified by their address, hence they must not be
+ * destroyed while the database is in use.
+ */
+class LteDensePathlossDatabase
+{
+public:
+  LteDensePathlossDatabase (void);
+  virtual ~LteDensePathlossDatabase (void);
+
+  /**
+   * update the pathloss value
+   *
+   * \param txPhy the transmitting PHY
+   * \param rxPhy the receiving PHY
+   * \param lossDb the loss in dB
+   */
+  virtual void UpdatePathloss (Ptr<const SpectrumPhy> txPhy, Ptr<const SpectrumPhy> rxPhy, double lossDb) = 0;
+
+  /**
+   * Connect the database to the PathLoss trace of a channel. The
+   * database disconnects itself when it is destroyed.
+   *
+   * \param channel the channel
+   */
+  void ConnectToChannel (Ptr<SpectrumChannel> channel);
+
+  /**
+   * \param cellId the id of the eNB
+   * \param imsi the id of the UE
+   *
+   * \return the pathloss value between the UE and the eNB, or infinity if
+   * no value was received
+   */
+  double GetPathloss (uint16_t cellId, uint64_t imsi) const;
+
+  /**
+   * \param imsi the id of the UE
+   *
+   * \return the id of the cell with the lowest pathloss towards the UE,
+   * or 0 if no value was received for the UE
+   */
+  uint16_t GetBestCellId (uint64_t imsi) const;
+
+  /**
+   * \return the number of cells in the database
+   */
+  uint32_t GetNCells (void) const;
+
+  /**
+   * \return the number of UEs in the database
+   */
+  uint32_t GetNUes (void) const;
+
+  /**
+   * \param cellIndex the index of a cell, lower than GetNCells ()
+   * \return the id of the cell
+   */
+  uint16_t GetCellId (uint32_t cellIndex) const;
+
+  /**
+   * \param ueIndex the index of a UE, lower than GetNUes ()
+   * \return the IMSI of the UE
+   */
+  uint64_t GetImsi (uint32_t ueIndex) const;
+
+  /**
+   * Get the pathloss values of a cell, indexed by the UE index. The
+   * values not received yet are NaN.
+   *
+   * \param cellIndex the index of a cell, lower than GetNCells ()
+   * \return the array of GetNUes () values, in dB
+   */
+  const float* GetCellPathlosses (uint32_t cellIndex) const;
+
+  /**
+   * Write the values received so far as CSV, one "cellId,imsi,pathlossDb"
+   * line per eNB-UE pair, by cell index and UE index.
+   *
+   * \param os the output stream
+   */
+  void ExportCsv (std::ostream &os) const;
+
+  /**
+   * Write a binary snapshot of the database, in host byte order: the
+   * number of cells and the number of UEs (uint32_t), the cell ids
+   * (uint16_t), the IMSIs (uint64_t), and the pathloss matrix in dB
+   * (float, one row per cell, NaN for the missing values).
+   *
+   * \param os the output stream, which should be opened in binary mode
+   */
+  void ExportBinary (std::ostream &os) const;
+
+protected:
+  /**
+   * Store a pathloss value
+   *
+   * \param enbPhy the PHY of the eNB
+   * \param uePhy the PHY of the UE
+   * \param lossDb the loss in dB
+   */
+  void SetPathloss (Ptr<const SpectrumPhy> enbPhy, Ptr<const SpectrumPhy> uePhy, double lossDb);
+
+private:
+  /**
+   * Get the index of the cell of a PHY, assigning one if the PHY is seen
+   * for the first time
+   *
+   * \param phy the PHY
+   * \return the index, or -1 if the PHY does not belong to an eNB
+   */
+  int32_t GetCellIndex (Ptr<const SpectrumPhy> phy);
+
+  /**
+   * Get the index of the UE of a PHY, assigning one if the PHY is seen
+   * for the first time
+   *
+   * \param phy the PHY
+   * \return the index, or -1 if the PHY does not belong to a UE
+   */
+  int32_t GetUeIndex (Ptr<const SpectrumPhy> phy);
+
+  /**
+   * Trace sink connected to the channels, calling UpdatePathloss
+   *
+   * \param txPhy the transmitting PHY
+   * \param rxPhy the receiving PHY
+   * \param lossDb the loss in dB
+   */
+  void DoUpdatePathloss (Ptr<const SpectrumPhy> txPhy, Ptr<const SpectrumPhy> rxPhy, double lossDb);
+
+  std::unordered_map<const SpectrumPhy *, int32_t> m_cellIndexByPhy; ///< cell index of the PHYs, -1 if not an eNB PHY
+  std::unordered_map<const SpectrumPhy *, int32_t> m_ueIndexByPhy; ///< UE index of the PHYs, -1 if not a UE PHY
+  std::unordered_map<uint16_t, uint32_t> m_cellIndexById; ///< cell index, by cell id
+  std::unordered_map<uint64_t, uint32_t> m_ueIndexByImsi; ///< UE index, by IMSI
+  std::vector<uint16_t> m_cellIds; ///< cell id, by cell index
+  std::vector<uint64_t> m_imsis; ///< IMSI, by UE index
+  std::vector<std::vector<float> > m_pathloss; ///< pathloss values [dB], by cell index and UE index
+  std::vector<Ptr<SpectrumChannel> > m_channels; ///< channels the database is connected to
+};
+
+/**
+ * \ingroup lte
+ * Store the last pathloss value for each eNB-UE pair for downlink in dense arrays
+ */
+class DownlinkLteDensePathlossDatabase : public LteDensePathlossDatabase
+{
+public:
+  // inherited from LteDensePathlossDatabase
+  virtual void UpdatePathloss (Ptr<const SpectrumPhy> txPhy, Ptr<const SpectrumPhy> rxPhy, double lossDb);
+};
+
+/**
+ * \ingroup lte
+ * Store the last pathloss value for each eNB-UE pair for uplink in dense arrays
+ */
+class UplinkLteDensePathlossDatabase : public LteDensePathlossDatabase
+{
+public:
+  // inherited from LteDensePathlossDatabase
+  virtual void UpdatePathloss (Ptr<const SpectrumPhy> txPhy, Ptr<const SpectrumPhy> rxPhy, double lossDb);
+};
 
 } // namespace ns3
 
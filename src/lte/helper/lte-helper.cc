@@ -1654,43 +1654,43 @@ LteHelper::EnablePhyTraces (void)
 void
 LteHelper::EnableDlTxPhyTraces (void)
 {
-  Config::Connect ("/NodeList/*/DeviceList/*/ComponentCarrierMap/*/LteEnbPhy/DlPhyTransmission",
-                   MakeBoundCallback (&PhyTxStatsCalculator::DlPhyTransmissionCallback, m_phyTxStats));
+  Config::ConnectWithTraceContext ("/NodeList/*/DeviceList/*/ComponentCarrierMap/*/LteEnbPhy/DlPhyTransmission",
+                                   MakeBoundCallback (&PhyTxStatsCalculator::DlPhyTransmissionCallback, m_phyTxStats));
 }
 
 void
 LteHelper::EnableUlTxPhyTraces (void)
 {
-  Config::Connect ("/NodeList/*/DeviceList/*/ComponentCarrierMapUe/*/LteUePhy/UlPhyTransmission",
-                   MakeBoundCallback (&PhyTxStatsCalculator::UlPhyTransmissionCallback, m_phyTxStats));
+  Config::ConnectWithTraceContext ("/NodeList/*/DeviceList/*/ComponentCarrierMapUe/*/LteUePhy/UlPhyTransmission",
+                                   MakeBoundCallback (&PhyTxStatsCalculator::UlPhyTransmissionCallback, m_phyTxStats));
 }
 
 void
 LteHelper::EnableDlRxPhyTraces (void)
 {
-  Config::Connect ("/NodeList/*/DeviceList/*/ComponentCarrierMapUe/*/LteUePhy/DlSpectrumPhy/DlPhyReception",
-                   MakeBoundCallback (&PhyRxStatsCalculator::DlPhyReceptionCallback, m_phyRxStats));
+  Config::ConnectWithTraceContext ("/NodeList/*/DeviceList/*/ComponentCarrierMapUe/*/LteUePhy/DlSpectrumPhy/DlPhyReception",
+                                   MakeBoundCallback (&PhyRxStatsCalculator::DlPhyReceptionCallback, m_phyRxStats));
 }
 
 void
 LteHelper::EnableUlRxPhyTraces (void)
 {
-  Config::Connect ("/NodeList/*/DeviceList/*/ComponentCarrierMap/*/LteEnbPhy/UlSpectrumPhy/UlPhyReception",
-                   MakeBoundCallback (&PhyRxStatsCalculator::UlPhyReceptionCallback, m_phyRxStats));
+  Config::ConnectWithTraceContext ("/NodeList/*/DeviceList/*/ComponentCarrierMap/*/LteEnbPhy/UlSpectrumPhy/UlPhyReception",
+                                   MakeBoundCallback (&PhyRxStatsCalculator::UlPhyReceptionCallback, m_phyRxStats));
 }
 
 void
 LteHelper::EnableSlRxPhyTraces (void)
 {
-  Config::Connect ("/NodeList/*/DeviceList/*/ComponentCarrierMapUe/*/LteUePhy/SlSpectrumPhy/SlPhyReception",
-                   MakeBoundCallback (&PhyRxStatsCalculator::SlPhyReceptionCallback, m_phyRxStats));
+  Config::ConnectWithTraceContext ("/NodeList/*/DeviceList/*/ComponentCarrierMapUe/*/LteUePhy/SlSpectrumPhy/SlPhyReception",
+                                   MakeBoundCallback (&PhyRxStatsCalculator::SlPhyReceptionCallback, m_phyRxStats));
 }
 
 void
 LteHelper::EnableSlPscchRxPhyTraces (void)
 {
-  Config::Connect ("/NodeList/*/DeviceList/*/ComponentCarrierMapUe/*/LteUePhy/SlSpectrumPhy/SlPscchReception",
-                   MakeBoundCallback (&PhyRxStatsCalculator::SlPscchReceptionCallback, m_phyRxStats));
+  Config::ConnectWithTraceContext ("/NodeList/*/DeviceList/*/ComponentCarrierMapUe/*/LteUePhy/SlSpectrumPhy/SlPscchReception",
+                                   MakeBoundCallback (&PhyRxStatsCalculator::SlPscchReceptionCallback, m_phyRxStats));
 }
 
 
@@ -1713,57 +1713,57 @@ void
 LteHelper::EnableDlMacTraces (void)
 {
   NS_LOG_FUNCTION_NOARGS ();
-  Config::Connect ("/NodeList/*/DeviceList/*/ComponentCarrierMap/*/LteEnbMac/DlScheduling",
-                   MakeBoundCallback (&MacStatsCalculator::DlSchedulingCallback, m_macStats));
+  Config::ConnectWithTraceContext ("/NodeList/*/DeviceList/*/ComponentCarrierMap/*/LteEnbMac/DlScheduling",
+                                   MakeBoundCallback (&MacStatsCalculator::DlSchedulingCallback, m_macStats));
 }
 
 void
 LteHelper::EnableUlMacTraces (void)
 {
   NS_LOG_FUNCTION_NOARGS ();
-  Config::Connect ("/NodeList/*/DeviceList/*/ComponentCarrierMap/*/LteEnbMac/UlScheduling",
-                   MakeBoundCallback (&MacStatsCalculator::UlSchedulingCallback, m_macStats));
+  Config::ConnectWithTraceContext ("/NodeList/*/DeviceList/*/ComponentCarrierMap/*/LteEnbMac/UlScheduling",
+                                   MakeBoundCallback (&MacStatsCalculator::UlSchedulingCallback, m_macStats));
 }
 
 void
 LteHelper::EnableSlPscchMacTraces (void)
 {
   NS_LOG_FUNCTION_NOARGS ();
-  Config::Connect ("/NodeList/*/DeviceList/*/ComponentCarrierMapUe/*/LteUeMac/SlPscchScheduling",
-                   MakeBoundCallback (&MacStatsCalculator::SlUeCchSchedulingCallback, m_macStats));
+  Config::ConnectWithTraceContext ("/NodeList/*/DeviceList/*/ComponentCarrierMapUe/*/LteUeMac/SlPscchScheduling",
+                                   MakeBoundCallback (&MacStatsCalculator::SlUeCchSchedulingCallback, m_macStats));
 }
 
 void
 LteHelper::EnableSlPsschMacTraces (void)
 {
   NS_LOG_FUNCTION_NOARGS ();
-  Config::Connect ("/NodeList/*/DeviceList/*/ComponentCarrierMapUe/*/LteUeMac/SlPsschScheduling",
-                   MakeBoundCallback (&MacStatsCalculator::SlUeSchSchedulingCallback, m_macStats));
+  Config::ConnectWithTraceContext ("/NodeList/*/DeviceList/*/ComponentCarrierMapUe/*/LteUeMac/SlPsschScheduling",
+                                   MakeBoundCallback (&MacStatsCalculator::SlUeSchSchedulingCallback, m_macStats));
 }
 
 void
 LteHelper::EnableSlPsdchMacTraces (void)
 {
   NS_LOG_FUNCTION_NOARGS ();
-  Config::Connect ("/NodeList/*/DeviceList/*/ComponentCarrierMapUe/*/LteUeMac/SlPsdchScheduling",MakeBoundCallback (&MacStatsCalculator::SlUeDchSchedulingCallback, m_macStats));	
+  Config::ConnectWithTraceContext ("/NodeList/*/DeviceList/*/ComponentCarrierMapUe/*/LteUeMac/SlPsdchScheduling",MakeBoundCallback (&MacStatsCalculator::SlUeDchSchedulingCallback, m_macStats));	
 }
 
 void
 LteHelper::EnableDlPhyTraces (void)
 {
   NS_LOG_FUNCTION_NOARGS ();
-  Config::Connect ("/NodeList/*/DeviceList/*/ComponentCarrierMapUe/*/LteUePhy/ReportCurrentCellRsrpSinr",
-                   MakeBoundCallback (&PhyStatsCalculator::ReportCurrentCellRsrpSinrCallback, m_phyStats));
+  Config::ConnectWithTraceContext ("/NodeList/*/DeviceList/*/ComponentCarrierMapUe/*/LteUePhy/ReportCurrentCellRsrpSinr",
+                                   MakeBoundCallback (&PhyStatsCalculator::ReportCurrentCellRsrpSinrCallback, m_phyStats));
 }
 
 void
 LteHelper::EnableUlPhyTraces (void)
 {
   NS_LOG_FUNCTION_NOARGS ();
-  Config::Connect ("/NodeList/*/DeviceList/*/ComponentCarrierMap/*/LteEnbPhy/ReportUeSinr",
-                   MakeBoundCallback (&PhyStatsCalculator::ReportUeSinr, m_phyStats));
-  Config::Connect ("/NodeList/*/DeviceList/*/ComponentCarrierMap/*/LteEnbPhy/ReportInterference",
-                   MakeBoundCallback (&PhyStatsCalculator::ReportInterference, m_phyStats));
+  Config::ConnectWithTraceContext ("/NodeList/*/DeviceList/*/ComponentCarrierMap/*/LteEnbPhy/ReportUeSinr",
+                                   MakeBoundCallback (&PhyStatsCalculator::ReportUeSinr, m_phyStats));
+  Config::ConnectWithTraceContext ("/NodeList/*/DeviceList/*/ComponentCarrierMap/*/LteEnbPhy/ReportInterference",
+                                   MakeBoundCallback (&PhyStatsCalculator::ReportInterference, m_phyStats));
 
 }
 
@@ -1797,7 +1797,7 @@ void
 LteHelper::EnableDiscoveryMonitoringRrcTraces (void)
 {
   NS_LOG_FUNCTION_NOARGS ();
-  Config::Connect ("/NodeList/*/DeviceList/*/LteUeRrc/DiscoveryMonitoring", MakeBoundCallback (&RrcStatsCalculator::DiscoveryMonitoringRrcTraceCallback, m_rrcStats));	
+  Config::ConnectWithTraceContext ("/NodeList/*/DeviceList/*/LteUeRrc/DiscoveryMonitoring", MakeBoundCallback (&RrcStatsCalculator::DiscoveryMonitoringRrcTraceCallback, m_rrcStats));	
 }
 
 void
@@ -41,6 +41,8 @@
 #include <ns3/epc-helper.h>
 #include <ns3/angles.h>
 #include <ns3/random-variable-stream.h>
+#include <ns3/uinteger.h>
+#include <algorithm>
 #include <iostream>
 
 
@@ -52,6 +54,7 @@ NS_LOG_COMPONENT_DEFINE ("LteSidelinkHelper");
 NS_OBJECT_ENSURE_REGISTERED (LteSidelinkHelper);
 
 LteSidelinkHelper::LteSidelinkHelper ()
+  : m_associationThreads (0)
 {
   NS_LOG_FUNCTION (this);
   m_uniformRandomVariable = CreateObject<UniformRandomVariable> ();
@@ -69,7 +72,12 @@ TypeId LteSidelinkHelper::GetTypeId (void)
     TypeId ("ns3::LteSidelinkHelper")
     .SetParent<Object> ()
     .AddConstructor<LteSidelinkHelper> ()
-
+    .AddAttribute ("AssociationThreads",
+                   "The maximum number of threads evaluating the S-RSRP of the pairs of UEs "
+                   "when associating UEs, or 0 to use all the hardware threads",
+                   UintegerValue (0),
+                   MakeUintegerAccessor (&LteSidelinkHelper::m_associationThreads),
+                   MakeUintegerChecker<uint32_t> ())
   ;
   return tid;
 }
@@ -105,90 +113,136 @@ LteSidelinkHelper::RemoveNetDevice (NetDeviceContainer container, Ptr<NetDevice>
 }
 
 
+std::vector<Ptr<SpectrumPhy> >
+LteSidelinkHelper::GetUlSpectrumPhys (NetDeviceContainer ues)
+{
+  std::vector<Ptr<SpectrumPhy> > phys;
+  phys.reserve (ues.GetN ());
+  for (NetDeviceContainer::Iterator it = ues.Begin (); it != ues.End (); it++)
+    {
+      phys.push_back ((*it)->GetObject<LteUeNetDevice> ()->GetPhy ()->GetUlSpectrumPhy ());
+    }
+  return phys;
+}
+
+SidelinkRsrpNeighborTable
+LteSidelinkHelper::CalcRsrpGraph (double txPower, double ulEarfcn, double ulBandwidth, const std::vector<Ptr<SpectrumPhy> > &txPhys,
+                                  const std::vector<Ptr<SpectrumPhy> > &rxPhys, double rsrpThreshold, SrsrpMethod_t compMethod)
+{
+  NS_LOG_FUNCTION (this << txPower << ulEarfcn << ulBandwidth << txPhys.size () << rxPhys.size () << rsrpThreshold << compMethod);
+
+  Ptr<Object> uplinkPathlossModel = m_lteHelper->GetUplinkPathlossModel ();
+  Ptr<PropagationLossModel> lossModel = uplinkPathlossModel->GetObject<PropagationLossModel> ();
+  NS_ASSERT_MSG (lossModel != 0, " " << uplinkPathlossModel << " is not a PropagationLossModel");
+
+  if (compMethod == LteSidelinkHelper::SLRSRP_PSBCH)
+    {
+      return SidelinkRsrpCalculator::CalcSlRsrpPsbchGraph (lossModel, txPower, ulEarfcn, ulBandwidth, txPhys, rxPhys, rsrpThreshold, m_associationThreads);
+    }
+  return SidelinkRsrpCalculator::CalcSlRsrpTxPwGraph (lossModel, txPower, txPhys, rxPhys, rsrpThreshold, m_associationThreads);
+}
+
+std::vector<uint32_t>
+LteSidelinkHelper::SelectTransmitters (uint32_t nUes, uint32_t nTransmitters)
+{
+  NS_LOG_FUNCTION (this << nUes << nTransmitters);
+  NS_ABORT_MSG_IF (nTransmitters > nUes, "Cannot select " << nTransmitters << " transmitters among " << nUes << " UEs");
+
+  //Transmitter UEs are randomly selected from the total number of UEs, by
+  //a partial Fisher-Yates shuffle of the indexes of the UEs
+  std::vector<uint32_t> candidateTx (nUes);
+  for (uint32_t i = 0; i < nUes; i++)
+    {
+      candidateTx[i] = i;
+    }
+  for (uint32_t i = 0; i < nTransmitters; i++)
+    {
+      uint32_t iTx = i + m_uniformRandomVariable->GetValue (0, nUes - i);
+      std::swap (candidateTx[i], candidateTx[iTx]);
+    }
+  candidateTx.resize (nTransmitters);
+  return candidateTx;
+}
+
 std::vector < NetDeviceContainer >
 LteSidelinkHelper::AssociateForGroupcast (double txPower, double ulEarfcn, double ulBandwidth, NetDeviceContainer ues, double rsrpThreshold, int nGroups, int nReceivers, SrsrpMethod_t compMethod)
 {
   std::vector < NetDeviceContainer > groups; //groups created
 
-  NetDeviceContainer remainingUes; //list of UEs not assigned to groups
-  remainingUes.Add (ues);
+  //links above the threshold between all the UEs, evaluated once
+  std::vector<Ptr<SpectrumPhy> > phys = GetUlSpectrumPhys (ues);
+  SidelinkRsrpNeighborTable links = CalcRsrpGraph (txPower, ulEarfcn, ulBandwidth, phys, phys, rsrpThreshold, compMethod);
 
-  // Start association of groupcast links, set NUM_GROUPS_ASSOCIATED = 0.
-  int32_t numGroupsAssociated = 0;
+  //UEs not assigned to groups
+  std::vector<bool> assigned (ues.GetN (), false);
 
-  NetDeviceContainer candidateTx; //list of UEs not assigned to groups that can be selected for transmission
-  candidateTx.Add (ues);
+  //UEs not assigned to groups that can be selected for transmission, in no
+  //particular order, and their position in the list
+  std::vector<uint32_t> candidateTx (ues.GetN ());
+  std::vector<uint32_t> candidateTxPos (ues.GetN ());
+  for (uint32_t i = 0; i < ues.GetN (); i++)
+    {
+      candidateTx[i] = i;
+      candidateTxPos[i] = i;
+    }
+  auto removeCandidateTx = [&candidateTx, &candidateTxPos] (uint32_t ue)
+    {
+      uint32_t pos = candidateTxPos[ue];
+      if (pos < candidateTx.size () && candidateTx[pos] == ue)
+        {
+          candidateTx[pos] = candidateTx.back ();
+          candidateTxPos[candidateTx[pos]] = pos;
+          candidateTx.pop_back ();
+        }
+    };
 
-  Ptr<Object> uplinkPathlossModel = m_lteHelper->GetUplinkPathlossModel ();
-  Ptr<PropagationLossModel> lossModel = uplinkPathlossModel->GetObject<PropagationLossModel> ();
-  NS_ASSERT_MSG (lossModel != 0, " " << uplinkPathlossModel << " is not a PropagationLossModel");
+  // Start association of groupcast links, set NUM_GROUPS_ASSOCIATED = 0.
+  int32_t numGroupsAssociated = 0;
 
-  while (numGroupsAssociated < nGroups && candidateTx.GetN () > 0)
+  std::vector<uint32_t> candidateRx;
+  while (numGroupsAssociated < nGroups && candidateTx.size () > 0)
     {
       //Transmitter UE is randomly selected from the total number of UEs.
-      uint32_t iTx = m_uniformRandomVariable->GetValue (0, candidateTx.GetN ());
-      Ptr<NetDevice> tx = candidateTx.Get (iTx);
-      NS_LOG_DEBUG (" Candidate Tx= " << tx->GetNode ()->GetId ());
-      candidateTx = RemoveNetDevice (candidateTx, tx);
-      //build list of candidate receivers
-      NetDeviceContainer candidateRx = RemoveNetDevice (remainingUes, tx);
-      NetDeviceContainer selectedRx;
-
-      //Start selecting the receiver for the transmitter, set NUM_RECEIVERS_ASSOCIATED = 0.
-      int32_t numReceiversAssociated = 0;
-
-      //Receiver UE is randomly selected from the remaining UEs (i.e., not already part of a group).
-      while (numReceiversAssociated < nReceivers && candidateRx.GetN () > 0)
+      uint32_t iTx = m_uniformRandomVariable->GetValue (0, candidateTx.size ());
+      uint32_t tx = candidateTx[iTx];
+      NS_LOG_DEBUG (" Candidate Tx= " << ues.Get (tx)->GetNode ()->GetId ());
+      removeCandidateTx (tx);
+
+      //Receiver UEs are the remaining UEs (i.e., not already part of a group)
+      //within the RSRP of X dBm of the transmitter UE. Drawing them one by one
+      //among all the remaining UEs until enough are within the RSRP, as
+      //described in TR 36.843, selects a uniformly random subset of them.
+      candidateRx.clear ();
+      for (std::vector<SidelinkRsrpNeighbor>::const_iterator it = links[tx].begin (); it != links[tx].end (); it++)
         {
-          uint32_t iRx = m_uniformRandomVariable->GetValue (0, candidateRx.GetN ());
-          Ptr<NetDevice> rx = candidateRx.Get (iRx);
-          candidateRx = RemoveNetDevice (candidateRx, rx);
-          double rsrpRx = 0;
-
-          Ptr<SpectrumPhy> txPhy = tx->GetObject<LteUeNetDevice> ()->GetPhy ()->GetUlSpectrumPhy ();
-          Ptr<SpectrumPhy> rxPhy = rx->GetObject<LteUeNetDevice> ()->GetPhy ()->GetUlSpectrumPhy ();
-
-          if (compMethod == LteSidelinkHelper::SLRSRP_PSBCH)
-            {
-              rsrpRx = SidelinkRsrpCalculator::CalcSlRsrpPsbch (lossModel, txPower, ulEarfcn, ulBandwidth, txPhy, rxPhy);
-            }
-          else
-            {
-              rsrpRx = SidelinkRsrpCalculator::CalcSlRsrpTxPw (lossModel, txPower, txPhy, rxPhy);
-            }
-          //If receiver UE is not within RSRP* of X dBm of the transmitter UE then randomly reselect the receiver UE among the UEs that are
-          //within the RSRP of X dBm of the transmitter UE and are not part of a group already.
-          NS_LOG_DEBUG ("\tCandidate Rx= " << rx->GetNode ()->GetId () << " Rsrp=" << rsrpRx << " required=" << rsrpThreshold);
-          if (rsrpRx >= rsrpThreshold)
+          if (!assigned[it->index])
             {
-              //good receiver
-              selectedRx.Add (rx);
-              numReceiversAssociated++;
-              NS_LOG_DEBUG ("\tAdding Rx to group");
+              NS_LOG_DEBUG ("\tCandidate Rx= " << ues.Get (it->index)->GetNode ()->GetId () << " Rsrp=" << it->rsrp << " required=" << rsrpThreshold);
+              candidateRx.push_back (it->index);
             }
         }
-      if (numReceiversAssociated == nReceivers)
+      if (candidateRx.size () < static_cast<uint32_t> (nReceivers))
         {
-          NS_LOG_DEBUG (" Group successfully created");
-          //found all the receivers, update lists
-          //remove receivers from candidate Tx and remaining nodes
-          remainingUes = RemoveNetDevice (remainingUes, tx); //remove selected Tx
-          uint32_t nDevices = selectedRx.GetN ();
-          for (uint32_t i = 0; i < nDevices; ++i)
-            {
-              Ptr<NetDevice> p = selectedRx.Get (i);
-              candidateTx = RemoveNetDevice (candidateTx, p);
-              remainingUes = RemoveNetDevice (remainingUes, p);
-            }
-          NetDeviceContainer newGroup (tx);
-          newGroup.Add (selectedRx);
-          groups.push_back (newGroup);
-          numGroupsAssociated++;
+          NS_LOG_DEBUG (" Group failed. Found only " << candidateRx.size () << " receivers");
+          continue;
         }
-      else
+
+      NS_LOG_DEBUG (" Group successfully created");
+      NetDeviceContainer newGroup (ues.Get (tx));
+      assigned[tx] = true;
+      for (int32_t i = 0; i < nReceivers; i++)
         {
-          NS_LOG_DEBUG (" Group failed. Found only " << numReceiversAssociated << " receivers");
+          uint32_t iRx = i + m_uniformRandomVariable->GetValue (0, candidateRx.size () - i);
+          std::swap (candidateRx[i], candidateRx[iRx]);
+          uint32_t rx = candidateRx[i];
+          NS_LOG_DEBUG ("\tAdding Rx " << ues.Get (rx)->GetNode ()->GetId () << " to group");
+          newGroup.Add (ues.Get (rx));
+          //remove receivers from candidate Tx and remaining nodes
+          assigned[rx] = true;
+          removeCandidateTx (rx);
         }
+      groups.push_back (newGroup);
+      numGroupsAssociated++;
     }
 
   NS_LOG_INFO ("Groups created " << groups.size () << " expected " << nGroups);
@@ -201,88 +255,44 @@ LteSidelinkHelper::AssociateForBroadcast (double txPower, double ulEarfcn, doubl
 {
   std::vector < NetDeviceContainer > groups; //groups created
 
-  NetDeviceContainer remainingUes; //list of UEs not assigned to groups
-  remainingUes.Add (ues);
-
   // Start the selection of the transmitters
-  NetDeviceContainer candidateTx; //list of UEs that can be selected for transmission
-  candidateTx.Add (ues);
-  NetDeviceContainer selectedTx;
-  uint32_t numTransmittersSelected = 0;
-
-  Ptr<Object> uplinkPathlossModel = m_lteHelper->GetUplinkPathlossModel ();
-  Ptr<PropagationLossModel> lossModel = uplinkPathlossModel->GetObject<PropagationLossModel> ();
-  NS_ASSERT_MSG (lossModel != 0, " " << uplinkPathlossModel << " is not a PropagationLossModel");
-
-  while (numTransmittersSelected < nTransmitters)
+  std::vector<uint32_t> selectedTx = SelectTransmitters (ues.GetN (), nTransmitters);
+  std::vector<bool> isTx (ues.GetN (), false);
+  for (uint32_t i = 0; i < selectedTx.size (); i++)
     {
-      //Transmitter UE is randomly selected from the total number of UEs.
-      uint32_t iTx = m_uniformRandomVariable->GetValue (0, candidateTx.GetN ());
-      Ptr<NetDevice> tx = candidateTx.Get (iTx);
-      NS_LOG_DEBUG (" Candidate Tx= " << tx->GetNode ()->GetId ());
-      selectedTx.Add (tx);
-      candidateTx = RemoveNetDevice (candidateTx, tx);
-      remainingUes = RemoveNetDevice (remainingUes, tx);
-      numTransmittersSelected++;
+      NS_LOG_DEBUG (" Candidate Tx= " << ues.Get (selectedTx[i])->GetNode ()->GetId ());
+      isTx[selectedTx[i]] = true;
     }
 
-  //For each remaining UE, associate to all transmitters where RSRP is greater than X dBm
-  for (uint32_t i = 0; i < numTransmittersSelected; i++)
+  //list of UEs not selected for transmission
+  NetDeviceContainer remainingUes;
+  for (uint32_t i = 0; i < ues.GetN (); i++)
     {
-      Ptr<NetDevice> tx = selectedTx.Get (i);
-      //prepare group for this transmitter
-      NetDeviceContainer newGroup (tx);
-      uint32_t nRxDevices = remainingUes.GetN ();
-      double rsrpRx = 0;
-
-      for (uint32_t j = 0; j < nRxDevices; ++j)
+      if (!isTx[i])
         {
-          Ptr<NetDevice> rx = remainingUes.Get (j);
-
-          Ptr<SpectrumPhy> txPhy = tx->GetObject<LteUeNetDevice> ()->GetPhy ()->GetUlSpectrumPhy ();
-          Ptr<SpectrumPhy> rxPhy = rx->GetObject<LteUeNetDevice> ()->GetPhy ()->GetUlSpectrumPhy ();
-
-          if (compMethod == LteSidelinkHelper::SLRSRP_PSBCH)
-            {
-              rsrpRx = SidelinkRsrpCalculator::CalcSlRsrpPsbch (lossModel, txPower, ulEarfcn, ulBandwidth, txPhy, rxPhy);
-            }
-          else
-            {
-              rsrpRx = SidelinkRsrpCalculator::CalcSlRsrpTxPw (lossModel, txPower, txPhy, rxPhy);
-            }
-          //If receiver UE is not within RSRP* of X dBm of the transmitter UE then randomly reselect the receiver UE among the UEs
-          //that are within the RSRP of X dBm of the transmitter UE and are not part of a group already.
-          NS_LOG_DEBUG ("\tCandidate Rx= " << rx->GetNode ()->GetId () << " Rsrp=" << rsrpRx << " required=" << rsrpThreshold);
-          if (rsrpRx >= rsrpThreshold)
-            {
-              //good receiver
-              NS_LOG_DEBUG ("\tAdding Rx to group");
-              newGroup.Add (rx);
-            }
+          remainingUes.Add (ues.Get (i));
         }
+    }
 
-      //Initializing link to other transmitters to be able to receive SLSSs from other transmitters
-      for (uint32_t k = 0; k < numTransmittersSelected; k++)
+  //For each remaining UE, associate to all transmitters where RSRP is greater than X dBm
+  std::vector<Ptr<SpectrumPhy> > phys = GetUlSpectrumPhys (ues);
+  std::vector<Ptr<SpectrumPhy> > txPhys;
+  for (uint32_t i = 0; i < selectedTx.size (); i++)
+    {
+      txPhys.push_back (phys[selectedTx[i]]);
+    }
+  std::vector<Ptr<SpectrumPhy> > rxPhys = GetUlSpectrumPhys (remainingUes);
+  SidelinkRsrpNeighborTable links = CalcRsrpGraph (txPower, ulEarfcn, ulBandwidth, txPhys, rxPhys, rsrpThreshold, compMethod);
+
+  for (uint32_t i = 0; i < selectedTx.size (); i++)
+    {
+      //prepare group for this transmitter
+      NetDeviceContainer newGroup (ues.Get (selectedTx[i]));
+      for (std::vector<SidelinkRsrpNeighbor>::const_iterator it = links[i].begin (); it != links[i].end (); it++)
         {
-          if (k != i)
-            {
-              Ptr<NetDevice> othertx = selectedTx.Get (k);
-
-              Ptr<SpectrumPhy> txPhy = tx->GetObject<LteUeNetDevice> ()->GetPhy ()->GetUlSpectrumPhy ();
-              Ptr<SpectrumPhy> otherTxPhy = othertx->GetObject<LteUeNetDevice> ()->GetPhy ()->GetUlSpectrumPhy ();
-
-              if (compMethod == LteSidelinkHelper::SLRSRP_PSBCH)
-                {
-                  rsrpRx = SidelinkRsrpCalculator::CalcSlRsrpPsbch (lossModel, txPower, ulEarfcn, ulBandwidth, txPhy, otherTxPhy);
-                }
-              else
-                {
-                  rsrpRx = SidelinkRsrpCalculator::CalcSlRsrpTxPw (lossModel, txPower, txPhy, otherTxPhy);
-                }
-              NS_LOG_DEBUG ("\tOther Tx= " << othertx->GetNode ()->GetId () << " Rsrp=" << rsrpRx);
-            }
+          NS_LOG_DEBUG ("\tAdding Rx " << remainingUes.Get (it->index)->GetNode ()->GetId () << " Rsrp=" << it->rsrp << " to group");
+          newGroup.Add (remainingUes.Get (it->index));
         }
-
       groups.push_back (newGroup);
     }
 
@@ -294,65 +304,28 @@ LteSidelinkHelper::AssociateForBroadcastWithTxEnabledToReceive (double txPower,
 {
   std::vector < NetDeviceContainer > groups; //groups created
 
-  NetDeviceContainer remainingUes; //list of UEs not assigned to groups
-  remainingUes.Add (ues);
-
   // Start the selection of the transmitters
-  NetDeviceContainer candidateTx; //list of UEs that can be selected for transmission
-  candidateTx.Add (ues);
-  NetDeviceContainer selectedTx;
-  uint32_t numTransmittersSelected = 0;
-
-  Ptr<Object> uplinkPathlossModel = m_lteHelper->GetUplinkPathlossModel ();
-  Ptr<PropagationLossModel> lossModel = uplinkPathlossModel->GetObject<PropagationLossModel> ();
-  NS_ASSERT_MSG (lossModel != 0, " " << uplinkPathlossModel << " is not a PropagationLossModel");
+  std::vector<uint32_t> selectedTx = SelectTransmitters (ues.GetN (), nTransmitters);
 
-  while (numTransmittersSelected < nTransmitters)
+  //For each UE, associate to all transmitters where RSRP is greater than X dBm
+  //No loopback link is possible due to half-duplex
+  std::vector<Ptr<SpectrumPhy> > phys = GetUlSpectrumPhys (ues);
+  std::vector<Ptr<SpectrumPhy> > txPhys;
+  for (uint32_t i = 0; i < selectedTx.size (); i++)
     {
-      //Transmitter UE is randomly selected from the total number of UEs.
-      uint32_t iTx = m_uniformRandomVariable->GetValue (0, candidateTx.GetN ());
-      Ptr<NetDevice> tx = candidateTx.Get (iTx);
-      NS_LOG_DEBUG (" Candidate Tx= " << tx->GetNode ()->GetId ());
-      selectedTx.Add (tx);
-      candidateTx = RemoveNetDevice (candidateTx, tx);
-      numTransmittersSelected++;
+      NS_LOG_DEBUG (" Candidate Tx= " << ues.Get (selectedTx[i])->GetNode ()->GetId ());
+      txPhys.push_back (phys[selectedTx[i]]);
     }
+  SidelinkRsrpNeighborTable links = CalcRsrpGraph (txPower, ulEarfcn, ulBandwidth, txPhys, phys, rsrpThreshold, compMethod);
 
-  //For each remaining UE, associate to all transmitters where RSRP is greater than X dBm
-  for (uint32_t i = 0; i < numTransmittersSelected; i++)
+  for (uint32_t i = 0; i < selectedTx.size (); i++)
     {
-      Ptr<NetDevice> tx = selectedTx.Get (i);
       //prepare group for this transmitter
-      NetDeviceContainer newGroup (tx);
-      uint32_t nRxDevices = remainingUes.GetN ();
-      double rsrpRx = 0;
-
-      for (uint32_t j = 0; j < nRxDevices; ++j)
+      NetDeviceContainer newGroup (ues.Get (selectedTx[i]));
+      for (std::vector<SidelinkRsrpNeighbor>::const_iterator it = links[i].begin (); it != links[i].end (); it++)
         {
-          Ptr<NetDevice> rx = remainingUes.Get (j);
-          if (rx->GetNode ()->GetId () != tx->GetNode ()->GetId ()) //No loopback link possible due to half-duplex
-            {
-              Ptr<SpectrumPhy> txPhy = tx->GetObject<LteUeNetDevice> ()->GetPhy ()->GetUlSpectrumPhy ();
-              Ptr<SpectrumPhy> rxPhy = rx->GetObject<LteUeNetDevice> ()->GetPhy ()->GetUlSpectrumPhy ();
-
-              if (compMethod == LteSidelinkHelper::SLRSRP_PSBCH)
-                {
-
-                  rsrpRx = SidelinkRsrpCalculator::CalcSlRsrpPsbch (lossModel, txPower, ulEarfcn, ulBandwidth, txPhy, rxPhy);
-                }
-              else
-                {
-                  rsrpRx = SidelinkRsrpCalculator::CalcSlRsrpTxPw (lossModel, txPower, txPhy, rxPhy);
-                }
-              //If receiver UE is not within RSRP* of X dBm of the transmitter UE then randomly reselect the receiver UE among the UEs that are within the RSRP of X dBm of the transmitter UE and are not part of a group already.
-              NS_LOG_DEBUG ("\tCandidate Rx= " << rx->GetNode ()->GetId () << " Rsrp=" << rsrpRx << " required=" << rsrpThreshold);
-              if (rsrpRx >= rsrpThreshold)
-                {
-                  //good receiver
-                  NS_LOG_DEBUG ("\tAdding Rx to group");
-                  newGroup.Add (rx);
-                }
-            }
+          NS_LOG_DEBUG ("\tAdding Rx " << ues.Get (it->index)->GetNode ()->GetId () << " Rsrp=" << it->rsrp << " to group");
+          newGroup.Add (ues.Get (it->index));
         }
       groups.push_back (newGroup);
     }
@@ -365,60 +338,72 @@ LteSidelinkHelper::AssociateForBroadcastWithWrapAround (double txPower, double u
 {
   std::vector < NetDeviceContainer > groups; //groups created
 
-  NetDeviceContainer remainingUes; //list of UEs not assigned to groups
-  remainingUes.Add (ues);
-
   // Start the selection of the transmitters
-  NetDeviceContainer candidateTx; //list of UEs that can be selected for transmission
-  candidateTx.Add (ues);
-  NetDeviceContainer selectedTx;
-  uint32_t numTransmittersSelected = 0;
+  std::vector<uint32_t> selectedTx = SelectTransmitters (ues.GetN (), nTransmitters);
+  std::vector<bool> isTx (ues.GetN (), false);
+  for (uint32_t i = 0; i < selectedTx.size (); i++)
+    {
+      NS_LOG_DEBUG (" Candidate Tx= " << ues.Get (selectedTx[i])->GetNode ()->GetId ());
+      isTx[selectedTx[i]] = true;
+    }
+
+  //list of UEs not selected for transmission
+  NetDeviceContainer remainingUes;
+  for (uint32_t i = 0; i < ues.GetN (); i++)
+    {
+      if (!isTx[i])
+        {
+          remainingUes.Add (ues.Get (i));
+        }
+    }
 
   Ptr<Object> uplinkPathlossModel = m_lteHelper->GetUplinkPathlossModel ();
   Ptr<PropagationLossModel> lossModel = uplinkPathlossModel->GetObject<PropagationLossModel> ();
   NS_ASSERT_MSG (lossModel != 0, " " << uplinkPathlossModel << " is not a PropagationLossModel");
 
-  while (numTransmittersSelected < nTransmitters)
+  //For each remaining UE, associate to all transmitters where RSRP is greater than X dBm.
+  //The closest position of each pair depends on the pair, hence the closest
+  //positions of all the receivers are computed for each transmitter.
+  std::vector<Ptr<SpectrumPhy> > rxPhys = GetUlSpectrumPhys (remainingUes);
+  uint32_t nRxDevices = remainingUes.GetN ();
+  std::vector<Ptr<MobilityModel> > rxMobilities (nRxDevices);
+  std::vector<Vector> rxPositions (nRxDevices);
+  for (uint32_t j = 0; j < nRxDevices; ++j)
     {
-      //Transmitter UE is randomly selected from the total number of UEs.
-      uint32_t iTx = m_uniformRandomVariable->GetValue (0, candidateTx.GetN ());
-      Ptr<NetDevice> tx = candidateTx.Get (iTx);
-      NS_LOG_DEBUG (" Candidate Tx= " << tx->GetNode ()->GetId ());
-      selectedTx.Add (tx);
-      candidateTx = RemoveNetDevice (candidateTx, tx);
-      remainingUes = RemoveNetDevice (remainingUes, tx);
-      numTransmittersSelected++;
+      rxMobilities[j] = remainingUes.Get (j)->GetNode ()->GetObject<MobilityModel> ();
+      rxPositions[j] = rxMobilities[j]->GetPosition ();
     }
-
-  //For each remaining UE, associate to all transmitters where RSRP is greater than X dBm
-  for (uint32_t i = 0; i < numTransmittersSelected; i++)
+  std::vector<Vector> closestPositions;
+  std::vector<double> distances;
+  for (uint32_t i = 0; i < selectedTx.size (); i++)
     {
-      Ptr<NetDevice> tx = selectedTx.Get (i);
+      Ptr<NetDevice> tx = ues.Get (selectedTx[i]);
+      Ptr<SpectrumPhy> txPhy = tx->GetObject<LteUeNetDevice> ()->GetPhy ()->GetUlSpectrumPhy ();
+      Vector txPos = tx->GetNode ()->GetObject<MobilityModel> ()->GetPosition ();
       //prepare group for this transmitter
       NetDeviceContainer newGroup (tx);
-      uint32_t nRxDevices = remainingUes.GetN ();
       double rsrpRx = 0;
 
+      //With wrap around, the closest location may be in one of the extended hexagon
+      topologyHelper->GetClosestPositionsInWrapAround (txPos, rxPositions, closestPositions, distances);
+
       for (uint32_t j = 0; j < nRxDevices; ++j)
         {
           Ptr<NetDevice> rx = remainingUes.Get (j);
-          //With wrap around, the closest location may be in one of the extended hexagon
-          //store position
-          Vector rxPos = rx->GetNode ()->GetObject<MobilityModel> ()->GetPosition ();
-          Vector closestPos = topologyHelper->GetClosestPositionInWrapAround (tx->GetNode ()->GetObject<MobilityModel> ()->GetPosition (), rxPos);
           //assign temporary position to compute RSRP
-          rx->GetNode ()->GetObject<MobilityModel> ()->SetPosition (closestPos);
-
-          Ptr<SpectrumPhy> txPhy = tx->GetObject<LteUeNetDevice> ()->GetPhy ()->GetUlSpectrumPhy ();
-          Ptr<SpectrumPhy> rxPhy = rx->GetObject<LteUeNetDevice> ()->GetPhy ()->GetUlSpectrumPhy ();
+          bool moved = closestPositions[j].x != rxPositions[j].x || closestPositions[j].y != rxPositions[j].y;
+          if (moved)
+            {
+              rxMobilities[j]->SetPosition (closestPositions[j]);
+            }
 
           if (compMethod == LteSidelinkHelper::SLRSRP_PSBCH)
             {
-              rsrpRx = SidelinkRsrpCalculator::CalcSlRsrpPsbch (lossModel, txPower, ulEarfcn, ulBandwidth, txPhy, rxPhy);
+              rsrpRx = SidelinkRsrpCalculator::CalcSlRsrpPsbch (lossModel, txPower, ulEarfcn, ulBandwidth, txPhy, rxPhys[j]);
             }
           else
             {
-              rsrpRx = SidelinkRsrpCalculator::CalcSlRsrpTxPw (lossModel, txPower, txPhy, rxPhy);
+              rsrpRx = SidelinkRsrpCalculator::CalcSlRsrpTxPw (lossModel, txPower, txPhy, rxPhys[j]);
             }
           //If receiver UE is not within RSRP* of X dBm of the transmitter UE then randomly reselect the receiver UE among the UEs that are within the RSRP of X dBm of the transmitter UE and are not part of a group already.
           NS_LOG_DEBUG ("\tCandidate Rx= " << rx->GetNode ()->GetId () << " Rsrp=" << rsrpRx << " required=" << rsrpThreshold);
@@ -430,7 +415,10 @@ LteSidelinkHelper::AssociateForBroadcastWithWrapAround (double txPower, double u
             }
 
           //restore position
-          rx->GetNode ()->GetObject<MobilityModel> ()->SetPosition (rxPos);
+          if (moved)
+            {
+              rxMobilities[j]->SetPosition (rxPositions[j]);
+            }
         }
       groups.push_back (newGroup);
     }
@@ -104,6 +104,10 @@ public:
 
   /**
    * Associate UEs for group communication
+   *
+   * The S-RSRP of all the pairs of UEs is evaluated once, with the
+   * number of threads given by the AssociationThreads attribute.
+   *
    * \param txPower The transmit power used by the UEs
    * \param ulEarfcn The uplink frequency band
    * \param ulBandwidth The uplink bandwidth
@@ -227,8 +231,39 @@ public:
   int64_t AssignStreams (int64_t stream);
 
 private:
+  /**
+   * Get the uplink SpectrumPhy of UEs
+   * \param ues The UEs
+   * \return The uplink SpectrumPhy of each UE
+   */
+  static std::vector<Ptr<SpectrumPhy> > GetUlSpectrumPhys (NetDeviceContainer ues);
+
+  /**
+   * Compute the links between transmitters and receivers with an S-RSRP
+   * above a threshold, using the uplink path loss model of the LteHelper
+   * \param txPower The transmit power used by the UEs
+   * \param ulEarfcn The uplink frequency band
+   * \param ulBandwidth The uplink bandwidth
+   * \param txPhys The transmitters
+   * \param rxPhys The receivers
+   * \param rsrpThreshold The minimum RSRP to connect a transmitter and receiver
+   * \param compMethod The method to compute the SRSRP value
+   * \return The receivers linked to each transmitter
+   */
+  SidelinkRsrpNeighborTable CalcRsrpGraph (double txPower, double ulEarfcn, double ulBandwidth, const std::vector<Ptr<SpectrumPhy> > &txPhys,
+                                           const std::vector<Ptr<SpectrumPhy> > &rxPhys, double rsrpThreshold, SrsrpMethod_t compMethod);
+
+  /**
+   * Randomly select distinct transmitters
+   * \param nUes The number of UEs
+   * \param nTransmitters The number of transmitters to select
+   * \return The indexes of the transmitters, in the order of the selection
+   */
+  std::vector<uint32_t> SelectTransmitters (uint32_t nUes, uint32_t nTransmitters);
+
   Ptr<LteHelper> m_lteHelper; ///< Pointer to the LteHelper
   Ptr<UniformRandomVariable> m_uniformRandomVariable; ///< Provides uniform random variables
+  uint32_t m_associationThreads; ///< Maximum number of threads evaluating the S-RSRP of the pairs of UEs
 };
 
 
@@ -23,10 +23,16 @@
 
 #include <ns3/log.h>
 #include <ns3/config.h>
+#include <ns3/boolean.h>
+#include <ns3/simulator.h>
+#include <ns3/uinteger.h>
 #include <ns3/lte-enb-rrc.h>
 #include <ns3/lte-ue-rrc.h>
 #include <ns3/lte-enb-net-device.h>
 #include <ns3/lte-ue-net-device.h>
+#include <ns3/node-list.h>
+#include <ns3/node.h>
+#include <ns3/abort.h>
 
 namespace ns3 {
 
@@ -34,6 +40,8 @@ NS_LOG_COMPONENT_DEFINE ("LteStatsCalculator");
 
 NS_OBJECT_ENSURE_REGISTERED (LteStatsCalculator);
 
+std::map<std::string, Ptr<LteStatsOutputFile> > LteStatsCalculator::s_outputFiles;
+
 LteStatsCalculator::LteStatsCalculator ()
   : m_dlOutputFilename (""),
     m_ulOutputFilename (""),
@@ -58,11 +66,51 @@ LteStatsCalculator::GetTypeId (void)
     .SetParent<Object> ()
     .SetGroupName("Lte")
     .AddConstructor<LteStatsCalculator> ()
+    .AddAttribute ("OutputBufferSize",
+                   "Size in bytes of the buffer of an output file opened by this calculator",
+                   UintegerValue (1 << 20),
+                   MakeUintegerAccessor (&LteStatsCalculator::m_outputBufferSize),
+                   MakeUintegerChecker<uint32_t> (1))
+    .AddAttribute ("BackgroundWriter",
+                   "If true, the output files opened by this calculator are written by a background thread",
+                   BooleanValue (false),
+                   MakeBooleanAccessor (&LteStatsCalculator::m_backgroundWriter),
+                   MakeBooleanChecker ())
   ;
   return tid;
 }
 
 
+std::ostream&
+LteStatsCalculator::GetOutputStream (const std::string &filename, bool truncate)
+{
+  std::map<std::string, Ptr<LteStatsOutputFile> >::iterator it = s_outputFiles.find (filename);
+  if (it != s_outputFiles.end () && !truncate)
+    {
+      return it->second->GetStream ();
+    }
+  if (it != s_outputFiles.end ())
+    {
+      // close the file before truncating it
+      s_outputFiles.erase (it);
+    }
+  if (s_outputFiles.empty ())
+    {
+      Simulator::ScheduleDestroy (&LteStatsCalculator::CloseOutputFiles);
+    }
+  NS_LOG_LOGIC ("Opening " << filename);
+  Ptr<LteStatsOutputFile> file = Create<LteStatsOutputFile> (filename, !truncate, m_outputBufferSize, m_backgroundWriter);
+  s_outputFiles[filename] = file;
+  return file->GetStream ();
+}
+
+void
+LteStatsCalculator::CloseOutputFiles (void)
+{
+  NS_LOG_FUNCTION_NOARGS ();
+  s_outputFiles.clear ();
+}
+
 void
 LteStatsCalculator::SetUlOutputFilename (std::string outputFilename)
 {
@@ -348,4 +396,48 @@ LteStatsCalculator::FindImsiForUe (std::string path, uint16_t rnti)
 }
 
 
+uint64_t
+LteStatsCalculator::FindImsiFromUeDevice (Ptr<const Config::TraceContext> context)
+{
+  NS_LOG_FUNCTION (context);
+  Ptr<LteUeNetDevice> ueNetDevice = DynamicCast<LteUeNetDevice> (NodeList::GetNode (context->GetIndex (0))->GetDevice (context->GetIndex (1)));
+  NS_ABORT_MSG_IF (ueNetDevice == 0, "No LteUeNetDevice found for " << context->GetPath ());
+  return ueNetDevice->GetImsi ();
+}
+
+uint16_t
+LteStatsCalculator::FindCellIdFromEnbDevice (Ptr<const Config::TraceContext> context)
+{
+  NS_LOG_FUNCTION (context);
+  Ptr<LteEnbNetDevice> enbNetDevice = DynamicCast<LteEnbNetDevice> (NodeList::GetNode (context->GetIndex (0))->GetDevice (context->GetIndex (1)));
+  NS_ABORT_MSG_IF (enbNetDevice == 0, "No LteEnbNetDevice found for " << context->GetPath ());
+  return enbNetDevice->GetCellId ();
+}
+
+uint64_t
+LteStatsCalculator::GetImsiFromEnbDevice (Ptr<const Config::TraceContext> context, uint16_t rnti)
+{
+  NS_LOG_FUNCTION (this << context << rnti);
+  uint32_t nodeId = context->GetIndex (0);
+  uint32_t deviceId = context->GetIndex (1);
+  uint64_t key = (static_cast<uint64_t> (nodeId) << 32) | (static_cast<uint64_t> (deviceId & 0xffff) << 16) | rnti;
+  std::map<uint64_t, uint64_t>::const_iterator it = m_enbRntiImsiMap.find (key);
+  if (it != m_enbRntiImsiMap.end ())
+    {
+      return it->second;
+    }
+
+  Ptr<LteEnbNetDevice> enbNetDevice = DynamicCast<LteEnbNetDevice> (NodeList::GetNode (nodeId)->GetDevice (deviceId));
+  NS_ABORT_MSG_IF (enbNetDevice == 0, "No LteEnbNetDevice found for " << context->GetPath ());
+  Ptr<LteEnbRrc> enbRrc = enbNetDevice->GetRrc ();
+  if (!enbRrc->HasUeManager (rnti))
+    {
+      NS_FATAL_ERROR ("No UeManager found for RNTI " << rnti << " in " << context->GetPath ());
+    }
+  uint64_t imsi = enbRrc->GetUeManager (rnti)->GetImsi ();
+  NS_LOG_LOGIC ("GetImsiFromEnbDevice: " << nodeId << ", " << deviceId << ", " << rnti << ", " << imsi);
+  m_enbRntiImsiMap[key] = imsi;
+  return imsi;
+}
+
 } // namespace ns3
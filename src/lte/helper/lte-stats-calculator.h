@@ -24,6 +24,8 @@
 
 #include "ns3/object.h"
 #include "ns3/string.h"
+#include "ns3/config.h"
+#include "ns3/lte-stats-output-file.h"
 #include <map>
 
 namespace ns3 {
@@ -33,7 +35,8 @@ namespace ns3 {
  *
  * Base class for ***StatsCalculator classes. Provides
  * basic functionality to parse and store IMSI and CellId.
- * Also stores names of output files.
+ * Also stores names of output files, and keeps the output files open
+ * across the records, see GetOutputStream ().
  */
 
 class LteStatsCalculator : public Object
@@ -55,6 +58,13 @@ public:
    */
   static TypeId GetTypeId (void);
 
+  /**
+   * Write the pending records and close all the output files of the
+   * stats calculators. Called when the simulator is destroyed; a later
+   * record is appended to its reopened file.
+   */
+  static void CloseOutputFiles (void);
+
   /**
    * Set the name of the file where the uplink statistics will be stored.
    *
@@ -164,6 +174,18 @@ public:
 
 protected:
 
+  /**
+   * Get the stream of an output file, opening the file if it is not
+   * open yet. The files are shared by all the stats calculators, and
+   * stay open until CloseOutputFiles () is called, so that the records
+   * are written in large blocks.
+   *
+   * @param filename the name of the file
+   * @param truncate true to truncate the file, i.e., for the first record
+   * @return the stream, in a failed state if the file could not be opened
+   */
+  std::ostream& GetOutputStream (const std::string &filename, bool truncate);
+
   /**
    * Retrieves IMSI from Enb RLC path in the attribute system
    * @param path Path in the attribute system to get
@@ -224,7 +246,51 @@ protected:
    */
   static uint64_t FindImsiForUe (std::string path, uint16_t rnti);
 
+  /**
+   * Retrieves the IMSI of the LteUeNetDevice holding a trace source
+   * @param context Context of a trace source connected with
+   *        Config::ConnectWithTraceContext, whose path starts with
+   *        /NodeList/#NodeId/DeviceList/#DeviceId
+   * @return the IMSI of the UE
+   */
+  static uint64_t FindImsiFromUeDevice (Ptr<const Config::TraceContext> context);
+
+  /**
+   * Retrieves the CellId of the LteEnbNetDevice holding a trace source
+   * @param context Context of a trace source connected with
+   *        Config::ConnectWithTraceContext, whose path starts with
+   *        /NodeList/#NodeId/DeviceList/#DeviceId
+   * @return the CellId of the eNB
+   */
+  static uint16_t FindCellIdFromEnbDevice (Ptr<const Config::TraceContext> context);
+
+  /**
+   * Retrieves the IMSI of a UE served by the LteEnbNetDevice holding a
+   * trace source. The IMSI is stored the first time it is retrieved.
+   * @param context Context of a trace source connected with
+   *        Config::ConnectWithTraceContext, whose path starts with
+   *        /NodeList/#NodeId/DeviceList/#DeviceId
+   * @param rnti RNTI of UE for which IMSI is needed
+   * @return the IMSI associated with the eNB device and RNTI
+   */
+  uint64_t GetImsiFromEnbDevice (Ptr<const Config::TraceContext> context, uint16_t rnti);
+
 private:
+  /**
+   * The open output files, by name
+   */
+  static std::map<std::string, Ptr<LteStatsOutputFile> > s_outputFiles;
+
+  /**
+   * Size in bytes of the buffer of the output files
+   */
+  uint32_t m_outputBufferSize;
+
+  /**
+   * Whether the output files are written by a background thread
+   */
+  bool m_backgroundWriter;
+
   /**
    * List of IMSI by path in the attribute system
    */
@@ -235,6 +301,11 @@ private:
    */
   std::map<std::string, uint16_t> m_pathCellIdMap;
 
+  /**
+   * List of IMSI by eNB node index, eNB device index and RNTI
+   */
+  std::map<uint64_t, uint64_t> m_enbRntiImsiMap;
+
   /**
    * Name of the file where the downlink results will be saved
    */
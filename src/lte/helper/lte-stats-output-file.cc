@@ -0,0 +1,187 @@
+/* -*-  Mode: C++; c-file-style: "gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "lte-stats-output-file.h"
+
+#include <ns3/log.h>
+#include <algorithm>
+
+namespace ns3 {
+
+NS_LOG_COMPONENT_DEFINE ("LteStatsOutputFile");
+
+/// Number of buffers waiting for the background thread before the writer blocks
+static const std::size_t MAX_PENDING_BLOCKS = 4;
+
+LteStatsOutputFile::LteStatsOutputFile (const std::string &filename, bool append, uint32_t bufferSize, bool backgroundWriter)
+  : m_file (0),
+    m_stream (this),
+    m_current (std::max<uint32_t> (bufferSize, 1)),
+    m_backgroundWriter (backgroundWriter),
+    m_writing (false),
+    m_closing (false)
+{
+  NS_LOG_FUNCTION (filename << append << bufferSize << backgroundWriter);
+
+  m_file = std::fopen (filename.c_str (), append ? "a" : "w");
+  if (m_file == 0)
+    {
+      m_stream.setstate (std::ios_base::badbit);
+      return;
+    }
+  // the records are buffered here
+  std::setvbuf (m_file, 0, _IONBF, 0);
+  setp (m_current.data (), m_current.data () + m_current.size ());
+  if (m_backgroundWriter)
+    {
+      m_thread = std::thread (&LteStatsOutputFile::Run, this);
+    }
+}
+
+LteStatsOutputFile::~LteStatsOutputFile ()
+{
+  // no logging, the output files may be closed at exit
+  if (m_file == 0)
+    {
+      return;
+    }
+  HandOver ();
+  if (m_backgroundWriter)
+    {
+      {
+        std::unique_lock<std::mutex> lock (m_mutex);
+        m_closing = true;
+      }
+      m_pendingCv.notify_one ();
+      m_thread.join ();
+    }
+  std::fclose (m_file);
+}
+
+std::ostream &
+LteStatsOutputFile::GetStream (void)
+{
+  return m_stream;
+}
+
+void
+LteStatsOutputFile::Flush (void)
+{
+  NS_LOG_FUNCTION_NOARGS ();
+
+  if (m_file == 0)
+    {
+      return;
+    }
+  HandOver ();
+  if (m_backgroundWriter)
+    {
+      std::unique_lock<std::mutex> lock (m_mutex);
+      while (!m_pending.empty () || m_writing)
+        {
+          m_writtenCv.wait (lock);
+        }
+    }
+}
+
+LteStatsOutputFile::int_type
+LteStatsOutputFile::overflow (int_type c)
+{
+  HandOver ();
+  if (!traits_type::eq_int_type (c, traits_type::eof ()))
+    {
+      *pptr () = traits_type::to_char_type (c);
+      pbump (1);
+    }
+  return traits_type::not_eof (c);
+}
+
+int
+LteStatsOutputFile::sync (void)
+{
+  // called by std::endl: keep buffering
+  return 0;
+}
+
+void
+LteStatsOutputFile::HandOver (void)
+{
+  std::size_t size = pptr () - pbase ();
+  if (size == 0)
+    {
+      return;
+    }
+  if (!m_backgroundWriter)
+    {
+      std::fwrite (m_current.data (), 1, size, m_file);
+      setp (m_current.data (), m_current.data () + m_current.size ());
+      return;
+    }
+
+  std::unique_lock<std::mutex> lock (m_mutex);
+  while (m_pending.size () >= MAX_PENDING_BLOCKS)
+    {
+      m_writtenCv.wait (lock);
+    }
+  m_pending.push_back (Block ());
+  m_pending.back ().data.swap (m_current);
+  m_pending.back ().size = size;
+  if (!m_spare.empty ())
+    {
+      m_current.swap (m_spare.back ());
+      m_spare.pop_back ();
+    }
+  else
+    {
+      m_current.resize (m_pending.back ().data.size ());
+    }
+  lock.unlock ();
+  m_pendingCv.notify_one ();
+  setp (m_current.data (), m_current.data () + m_current.size ());
+}
+
+void
+LteStatsOutputFile::Run (void)
+{
+  NS_LOG_FUNCTION_NOARGS ();
+
+  std::unique_lock<std::mutex> lock (m_mutex);
+  while (true)
+    {
+      while (m_pending.empty () && !m_closing)
+        {
+          m_pendingCv.wait (lock);
+        }
+      if (m_pending.empty ())
+        {
+          break;
+        }
+      Block block;
+      block.data.swap (m_pending.front ().data);
+      block.size = m_pending.front ().size;
+      m_pending.pop_front ();
+      m_writing = true;
+      lock.unlock ();
+      std::fwrite (block.data.data (), 1, block.size, m_file);
+      lock.lock ();
+      m_writing = false;
+      m_spare.push_back (std::vector<char> ());
+      m_spare.back ().swap (block.data);
+      m_writtenCv.notify_all ();
+    }
+}
+
+} // namespace ns3
@@ -0,0 +1,112 @@
+/* -*-  Mode: C++; c-file-style: "gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef LTE_STATS_OUTPUT_FILE_H_
+#define LTE_STATS_OUTPUT_FILE_H_
+
+#include "ns3/simple-ref-count.h"
+#include <stdint.h>
+#include <condition_variable>
+#include <cstdio>
+#include <deque>
+#include <mutex>
+#include <ostream>
+#include <streambuf>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace ns3 {
+
+/**
+ * \ingroup lte
+ *
+ * An output file of the ***StatsCalculator classes, kept open across the
+ * records and written in large blocks.
+ *
+ * The records are formatted in a stream whose buffer is only written to
+ * the file when it is full, when Flush () is called or when the file is
+ * closed; std::endl does not flush it. The buffers are written either by
+ * the calling thread or, optionally, by a background thread, so that the
+ * simulation only formats the records.
+ */
+class LteStatsOutputFile : public SimpleRefCount<LteStatsOutputFile>,
+                           private std::streambuf
+{
+public:
+  /**
+   * Open an output file
+   *
+   * \param filename the name of the file
+   * \param append true to append to an existing file, false to truncate it
+   * \param bufferSize the size in bytes of the buffer of the records
+   * \param backgroundWriter true to write the buffers with a background thread
+   */
+  LteStatsOutputFile (const std::string &filename, bool append, uint32_t bufferSize, bool backgroundWriter);
+  /**
+   * Write the pending records and close the file
+   */
+  ~LteStatsOutputFile ();
+
+  /**
+   * Get the stream to write the records, which is in a failed state if
+   * the file could not be opened
+   * \return the stream
+   */
+  std::ostream &GetStream (void);
+  /**
+   * Write all the pending records to the file
+   */
+  void Flush (void);
+
+private:
+  // inherited from std::streambuf
+  virtual int_type overflow (int_type c);
+  virtual int sync (void);
+
+  /**
+   * Hand the current buffer over to be written, and start a new one
+   */
+  void HandOver (void);
+  /**
+   * Entry point of the background thread
+   */
+  void Run (void);
+
+  /// A buffer of formatted records
+  struct Block
+  {
+    std::vector<char> data; ///< the storage of the buffer
+    std::size_t size; ///< the number of bytes used
+  };
+
+  std::FILE *m_file; ///< the file
+  std::ostream m_stream; ///< the stream formatting the records in the current buffer
+  std::vector<char> m_current; ///< the buffer being filled
+  bool m_backgroundWriter; ///< true if the buffers are written by the background thread
+  std::deque<Block> m_pending; ///< the buffers waiting for the background thread
+  std::vector<std::vector<char> > m_spare; ///< the buffers already written, for reuse
+  bool m_writing; ///< true while the background thread writes a buffer
+  bool m_closing; ///< true when the background thread must terminate
+  std::mutex m_mutex; ///< protects the state shared with the background thread
+  std::condition_variable m_pendingCv; ///< notifies the background thread of a new buffer
+  std::condition_variable m_writtenCv; ///< notifies that a buffer has been written
+  std::thread m_thread; ///< the background thread
+};
+
+} // namespace ns3
+
+#endif /* LTE_STATS_OUTPUT_FILE_H_ */
@@ -151,28 +151,18 @@ MacStatsCalculator::DlScheduling (uint16_t cellId, uint64_t imsi, DlSchedulingCa
 		  dlSchedulingCallbackInfo.rnti << (uint32_t) dlSchedulingCallbackInfo.mcsTb1 << dlSchedulingCallbackInfo.sizeTb1 << (uint32_t) dlSchedulingCallbackInfo.mcsTb2 << dlSchedulingCallbackInfo.sizeTb2);
   NS_LOG_INFO ("Write DL Mac Stats in " << GetDlOutputFilename ().c_str ());
 
-  std::ofstream outFile;
+  std::ostream &outFile = GetOutputStream (GetDlOutputFilename (), m_dlFirstWrite);
+  if (!outFile)
+    {
+      NS_LOG_ERROR ("Can't open file " << GetDlOutputFilename ().c_str ());
+      return;
+    }
   if ( m_dlFirstWrite == true )
     {
-      outFile.open (GetDlOutputFilename ().c_str ());
-      if (!outFile.is_open ())
-        {
-          NS_LOG_ERROR ("Can't open file " << GetDlOutputFilename ().c_str ());
-          return;
-        }
       m_dlFirstWrite = false;
       outFile << "% time\tcellId\tIMSI\tframe\tsframe\tRNTI\tmcsTb1\tsizeTb1\tmcsTb2\tsizeTb2\tccId";
       outFile << std::endl;
     }
-  else
-    {
-      outFile.open (GetDlOutputFilename ().c_str (),  std::ios_base::app);
-      if (!outFile.is_open ())
-        {
-          NS_LOG_ERROR ("Can't open file " << GetDlOutputFilename ().c_str ());
-          return;
-        }
-    }
 
   outFile << Simulator::Now ().GetNanoSeconds () / (double) 1e9 << "\t";
   outFile << (uint32_t) cellId << "\t";
@@ -185,7 +175,6 @@ MacStatsCalculator::DlScheduling (uint16_t cellId, uint64_t imsi, DlSchedulingCa
   outFile << (uint32_t) dlSchedulingCallbackInfo.mcsTb2 << "\t";
   outFile << dlSchedulingCallbackInfo.sizeTb2 << "\t";
   outFile << (uint32_t) dlSchedulingCallbackInfo.componentCarrierId << std::endl;
-  outFile.close ();
 }
 
 void
@@ -195,28 +184,18 @@ MacStatsCalculator::UlScheduling (uint16_t cellId, uint64_t imsi, uint32_t frame
   NS_LOG_FUNCTION (this << cellId << imsi << frameNo << subframeNo << rnti << (uint32_t) mcsTb << size);
   NS_LOG_INFO ("Write UL Mac Stats in " << GetUlOutputFilename ().c_str ());
 
-  std::ofstream outFile;
+  std::ostream &outFile = GetOutputStream (GetUlOutputFilename (), m_ulFirstWrite);
+  if (!outFile)
+    {
+      NS_LOG_ERROR ("Can't open file " << GetUlOutputFilename ().c_str ());
+      return;
+    }
   if ( m_ulFirstWrite == true )
     {
-      outFile.open (GetUlOutputFilename ().c_str ());
-      if (!outFile.is_open ())
-        {
-          NS_LOG_ERROR ("Can't open file " << GetUlOutputFilename ().c_str ());
-          return;
-        }
       m_ulFirstWrite = false;
       outFile << "% time\tcellId\tIMSI\tframe\tsframe\tRNTI\tmcs\tsize\tccId";
       outFile << std::endl;
     }
-  else
-    {
-      outFile.open (GetUlOutputFilename ().c_str (),  std::ios_base::app);
-      if (!outFile.is_open ())
-        {
-          NS_LOG_ERROR ("Can't open file " << GetUlOutputFilename ().c_str ());
-          return;
-        }
-    }
 
   outFile << Simulator::Now ().GetNanoSeconds () / (double) 1e9 << "\t";
   outFile << (uint32_t) cellId << "\t";
@@ -227,7 +206,6 @@ MacStatsCalculator::UlScheduling (uint16_t cellId, uint64_t imsi, uint32_t frame
   outFile << (uint32_t) mcsTb << "\t";
   outFile << size << "\t";
   outFile << (uint32_t) componentCarrierId << std::endl;
-  outFile.close ();
 }
 
 void
@@ -238,28 +216,18 @@ MacStatsCalculator::SlUeCchScheduling (SlUeMacStatParameters params)
                    << params.m_txLengthRB << params.m_psschItrp << params.m_sidelinkDropped);
   NS_LOG_INFO ("Write SL UE Mac Stats in " << GetSlUeCchOutputFilename ().c_str ());
 
-  std::ofstream outFile;
+  std::ostream &outFile = GetOutputStream (GetSlUeCchOutputFilename (), m_slUeCchFirstWrite);
+  if (!outFile)
+    {
+      NS_LOG_ERROR ("Can't open file " << GetSlUeCchOutputFilename ().c_str ());
+      return;
+    }
   if ( m_slUeCchFirstWrite == true )
     {
-      outFile.open (GetSlUeCchOutputFilename ().c_str ());
-      if (!outFile.is_open ())
-        {
-          NS_LOG_ERROR ("Can't open file " << GetSlUeCchOutputFilename ().c_str ());
-          return;
-        }
       m_slUeCchFirstWrite = false;
       outFile << "% time\tcellId\tIMSI\tRNTI\tframe\tsframe\tscPrdStartFr\tscPrdStartSf\tresPscch\tsizeTb\tpscchRbLen\tpscchStartRb\thopping\thoppingInfo\tpsschRbLen\tpsschStartRb\tiTrp\tmcs\tl1GroupDstId\tdropped";
       outFile << std::endl;
     }
-  else
-    {
-      outFile.open (GetSlUeCchOutputFilename ().c_str (),  std::ios_base::app);
-      if (!outFile.is_open ())
-        {
-          NS_LOG_ERROR ("Can't open file " << GetSlUeCchOutputFilename ().c_str ());
-          return;
-        }
-    }
 
   outFile << params.m_timestamp << "\t";
   outFile << params.m_cellId << "\t";
@@ -281,8 +249,6 @@ MacStatsCalculator::SlUeCchScheduling (SlUeMacStatParameters params)
   outFile << (uint16_t) params.m_mcs << "\t";
   outFile << (uint16_t) params.m_groupDstId << "\t";
   outFile << (uint16_t) params.m_sidelinkDropped << std::endl;
-
-  outFile.close ();
 }
 
 void
@@ -292,28 +258,18 @@ MacStatsCalculator::SlUeSchScheduling (SlUeMacStatParameters params)
                    << (uint32_t) params.m_mcs << params.m_tbSize << params.m_txStartRB << params.m_txLengthRB);
   NS_LOG_INFO ("Write SL Shared Channel UE Mac Stats in " << GetSlUeSchOutputFilename ().c_str ());
 
-  std::ofstream outFile;
+  std::ostream &outFile = GetOutputStream (GetSlUeSchOutputFilename (), m_slUeSchFirstWrite);
+  if (!outFile)
+    {
+      NS_LOG_ERROR ("Can't open file " << GetSlUeSchOutputFilename ().c_str ());
+      return;
+    }
   if ( m_slUeSchFirstWrite == true )
     {
-      outFile.open (GetSlUeSchOutputFilename ().c_str ());
-      if (!outFile.is_open ())
-        {
-          NS_LOG_ERROR ("Can't open file " << GetSlUeSchOutputFilename ().c_str ());
-          return;
-        }
       m_slUeSchFirstWrite = false;
       outFile << "% time\tcellId\tIMSI\tRNTI\tcurrFr\tcurrSf\tscPrdStartFr\tscPrdStartSf\tpsschRbLen\tpsschStartRb\tmcs\tsizeTb\trv\tdropped";
       outFile << std::endl;
     }
-  else
-    {
-      outFile.open (GetSlUeSchOutputFilename ().c_str (),  std::ios_base::app);
-      if (!outFile.is_open ())
-        {
-          NS_LOG_ERROR ("Can't open file " << GetSlUeSchOutputFilename ().c_str ());
-          return;
-        }
-    }
 
   outFile << params.m_timestamp << "\t";
   outFile << params.m_cellId << "\t";
@@ -329,7 +285,6 @@ MacStatsCalculator::SlUeSchScheduling (SlUeMacStatParameters params)
   outFile << params.m_tbSize << "\t";
   outFile << (uint16_t) params.m_rv << "\t";
   outFile << (uint16_t) params.m_sidelinkDropped << std::endl;
-  outFile.close ();
 }
 
 void 
@@ -338,27 +293,17 @@ MacStatsCalculator::SlUeDchScheduling (SlUeMacStatParameters params, LteSlDiscHe
   NS_LOG_FUNCTION (this << params.m_cellId << params.m_imsi << params.m_rnti);
   NS_LOG_INFO ("Writing SL Discovery Channel UE Mac Stats in " << GetSlUeDchOutputFilename ().c_str ());
   	
-  std::ofstream outFile;
+  std::ostream &outFile = GetOutputStream (GetSlUeDchOutputFilename (), m_slUeDchFirstWrite);
+  if (!outFile)
+    {
+      NS_LOG_ERROR ("Can't open file " << GetSlUeDchOutputFilename ().c_str ());
+      return;
+    }
   if ( m_slUeDchFirstWrite == true )
     {
-      outFile.open (GetSlUeDchOutputFilename ().c_str ());
-      if (!outFile.is_open ())
-        {
-          NS_LOG_ERROR ("Can't open file " << GetSlUeDchOutputFilename ().c_str ());
-          return;
-        }
       m_slUeDchFirstWrite = false;
       outFile << "Time\tIMSI\tRNTI\tframe\tsubframe\tdiscPrdStartFr\tdiscPrdStartSf\tresPsdch\tpsdchRbLen\tpsdchStartRb\tmcs\tsizeTb\trv\tDiscType\tContentType\tDiscModel\tContent\tdropped" << std::endl;
     }
-  else
-    {
-      outFile.open (GetSlUeDchOutputFilename ().c_str (),  std::ios_base::app);
-      if (!outFile.is_open ())
-        {
-          NS_LOG_ERROR ("Can't open file " << GetSlUeDchOutputFilename ().c_str ());
-          return;
-        }
-    }
 
   outFile << params.m_timestamp << "\t";
   outFile << params.m_imsi << "\t";
@@ -401,141 +346,56 @@ MacStatsCalculator::SlUeDchScheduling (SlUeMacStatParameters params, LteSlDiscHe
 }
 
 void
-MacStatsCalculator::DlSchedulingCallback (Ptr<MacStatsCalculator> macStats, std::string path, DlSchedulingCallbackInfo dlSchedulingCallbackInfo)
+MacStatsCalculator::DlSchedulingCallback (Ptr<MacStatsCalculator> macStats, Ptr<const Config::TraceContext> context, DlSchedulingCallbackInfo dlSchedulingCallbackInfo)
 {
-  NS_LOG_FUNCTION (macStats << path);
-  uint64_t imsi = 0;
-  std::ostringstream pathAndRnti;
-  std::string pathEnb  = path.substr (0, path.find ("/ComponentCarrierMap"));
-  pathAndRnti << pathEnb << "/LteEnbRrc/UeMap/" << dlSchedulingCallbackInfo.rnti;
-  if (macStats->ExistsImsiPath (pathAndRnti.str ()) == true)
-    {
-      imsi = macStats->GetImsiPath (pathAndRnti.str ());
-    }
-  else
-    {
-      imsi = FindImsiFromEnbRlcPath (pathAndRnti.str ());
-      macStats->SetImsiPath (pathAndRnti.str (), imsi);
-    }
-  uint16_t cellId = 0;
-  if (macStats->ExistsCellIdPath (pathAndRnti.str ()) == true)
-    {
-      cellId = macStats->GetCellIdPath (pathAndRnti.str ());
-    }
-  else
-    {
-      cellId = FindCellIdFromEnbRlcPath (pathAndRnti.str ());
-      macStats->SetCellIdPath (pathAndRnti.str (), cellId);
-    }
+  NS_LOG_FUNCTION (macStats << context->GetPath ());
+  uint64_t imsi = macStats->GetImsiFromEnbDevice (context, dlSchedulingCallbackInfo.rnti);
+  uint16_t cellId = FindCellIdFromEnbDevice (context);
 
   macStats->DlScheduling (cellId, imsi, dlSchedulingCallbackInfo);
 }
 
 void
-MacStatsCalculator::UlSchedulingCallback (Ptr<MacStatsCalculator> macStats, std::string path,
+MacStatsCalculator::UlSchedulingCallback (Ptr<MacStatsCalculator> macStats, Ptr<const Config::TraceContext> context,
                       uint32_t frameNo, uint32_t subframeNo, uint16_t rnti,
                       uint8_t mcs, uint16_t size, uint8_t componentCarrierId)
 {
-  NS_LOG_FUNCTION (macStats << path);
+  NS_LOG_FUNCTION (macStats << context->GetPath ());
 
-  uint64_t imsi = 0;
-  std::ostringstream pathAndRnti;
-  std::string pathEnb  = path.substr (0, path.find ("/ComponentCarrierMap"));
-  pathAndRnti << pathEnb << "/LteEnbRrc/UeMap/" << rnti;
-  if (macStats->ExistsImsiPath (pathAndRnti.str ()) == true)
-    {
-      imsi = macStats->GetImsiPath (pathAndRnti.str ());
-    }
-  else
-    {
-      imsi = FindImsiFromEnbRlcPath (pathAndRnti.str ());
-      macStats->SetImsiPath (pathAndRnti.str (), imsi);
-    }
-  uint16_t cellId = 0;
-  if (macStats->ExistsCellIdPath (pathAndRnti.str ()) == true)
-    {
-      cellId = macStats->GetCellIdPath (pathAndRnti.str ());
-    }
-  else
-    {
-      cellId = FindCellIdFromEnbRlcPath (pathAndRnti.str ());
-      macStats->SetCellIdPath (pathAndRnti.str (), cellId);
-    }
+  uint64_t imsi = macStats->GetImsiFromEnbDevice (context, rnti);
+  uint16_t cellId = FindCellIdFromEnbDevice (context);
 
   macStats->UlScheduling (cellId, imsi, frameNo, subframeNo, rnti, mcs, size, componentCarrierId);
 }
 
 void
-MacStatsCalculator::SlUeCchSchedulingCallback (Ptr<MacStatsCalculator> macStats, std::string path, SlUeMacStatParameters params)
+MacStatsCalculator::SlUeCchSchedulingCallback (Ptr<MacStatsCalculator> macStats, Ptr<const Config::TraceContext> context, SlUeMacStatParameters params)
 {
-  NS_LOG_FUNCTION (macStats << path);
-  std::ostringstream pathAndRnti;
-  pathAndRnti << path << "/" << params.m_rnti;
-  if (macStats->ExistsImsiPath (pathAndRnti.str ()) == true)
-    {
-      NS_LOG_LOGIC("Existing IMSI path. Getting IMSI...");
-      params.m_imsi = macStats->GetImsiPath (pathAndRnti.str ());
-      NS_LOG_LOGIC("IMSI= " << params.m_imsi);
-    }
-  else
-    {
-      NS_LOG_LOGIC("NON-existing IMSI path. Finding IMSI from UE LteNetDevice...");
-      std::string ueNetDevicePath = path.substr (0, path.find("/ComponentCarrierMapUe"));
-      params.m_imsi = FindImsiFromLteNetDevice (ueNetDevicePath);
-      NS_LOG_LOGIC("Found IMSI= " << params.m_imsi);
-      macStats->SetImsiPath (pathAndRnti.str (), params.m_imsi);
-    }
+  NS_LOG_FUNCTION (macStats << context->GetPath ());
+  params.m_imsi = FindImsiFromUeDevice (context);
+  NS_LOG_LOGIC ("IMSI= " << params.m_imsi);
   params.m_cellId = 0;
 
   macStats->SlUeCchScheduling (params);
 }
 
 void
-MacStatsCalculator::SlUeSchSchedulingCallback (Ptr<MacStatsCalculator> macStats, std::string path, SlUeMacStatParameters params)
+MacStatsCalculator::SlUeSchSchedulingCallback (Ptr<MacStatsCalculator> macStats, Ptr<const Config::TraceContext> context, SlUeMacStatParameters params)
 {
-  NS_LOG_FUNCTION (macStats << path);
-  std::ostringstream pathAndRnti;
-  pathAndRnti << path << "/" << params.m_rnti;
-  if (macStats->ExistsImsiPath (pathAndRnti.str ()) == true)
-    {
-      NS_LOG_LOGIC("Existing IMSI path. Getting IMSI...");
-      params.m_imsi = macStats->GetImsiPath (pathAndRnti.str ());
-      NS_LOG_LOGIC("IMSI= " << params.m_imsi);
-    }
-  else
-    {
-      NS_LOG_LOGIC("NON-existing IMSI path. Finding IMSI from UE LteNetDevice...");
-      std::string ueNetDevicePath = path.substr (0, path.find("/ComponentCarrierMapUe"));
-      params.m_imsi = FindImsiFromLteNetDevice (ueNetDevicePath);
-      NS_LOG_LOGIC("Found IMSI= " << params.m_imsi);
-      macStats->SetImsiPath (pathAndRnti.str (), params.m_imsi);
-    }
+  NS_LOG_FUNCTION (macStats << context->GetPath ());
+  params.m_imsi = FindImsiFromUeDevice (context);
+  NS_LOG_LOGIC ("IMSI= " << params.m_imsi);
   params.m_cellId = 0;
 
   macStats->SlUeSchScheduling (params);
 }
 
 void 
-MacStatsCalculator::SlUeDchSchedulingCallback (Ptr<MacStatsCalculator> macStats, std::string path, SlUeMacStatParameters params, LteSlDiscHeader discMsg)
+MacStatsCalculator::SlUeDchSchedulingCallback (Ptr<MacStatsCalculator> macStats, Ptr<const Config::TraceContext> context, SlUeMacStatParameters params, LteSlDiscHeader discMsg)
 {
-  NS_LOG_FUNCTION (macStats << path);
-  
-std::ostringstream pathAndRnti;
-  pathAndRnti << path << "/" << params.m_rnti;
-  if (macStats->ExistsImsiPath (pathAndRnti.str ()) == true)
-    {
-      NS_LOG_LOGIC("Existing IMSI path. Getting IMSI...");
-      params.m_imsi = macStats->GetImsiPath (pathAndRnti.str ());
-      NS_LOG_LOGIC("IMSI= " << params.m_imsi);
-    }
-  else
-    {
-      NS_LOG_LOGIC("NON-existing IMSI path. Finding IMSI from UE LteNetDevice...");
-      std::string ueNetDevicePath = path.substr (0, path.find("/ComponentCarrierMapUe"));
-      params.m_imsi = FindImsiFromLteNetDevice (ueNetDevicePath);
-      NS_LOG_LOGIC("Found IMSI= " << params.m_imsi);
-      macStats->SetImsiPath (pathAndRnti.str (), params.m_imsi);
-    }
+  NS_LOG_FUNCTION (macStats << context->GetPath ());
+  params.m_imsi = FindImsiFromUeDevice (context);
+  NS_LOG_LOGIC ("IMSI= " << params.m_imsi);
   params.m_cellId = 0;
   
   macStats->SlUeDchScheduling (params, discMsg);
@@ -176,16 +176,16 @@ public:
    * Trace sink for the ns3::LteEnbMac::DlScheduling trace source
    *
    * \param macStats
-   * \param path
+   * \param context The context of the trace source
    * \param dlSchedulingCallbackInfo DlSchedulingCallbackInfo structure containing all downlink information that is generated what DlScheduling traces is fired
    */
-  static void DlSchedulingCallback (Ptr<MacStatsCalculator> macStats, std::string path, DlSchedulingCallbackInfo dlSchedulingCallbackInfo);
+  static void DlSchedulingCallback (Ptr<MacStatsCalculator> macStats, Ptr<const Config::TraceContext> context, DlSchedulingCallbackInfo dlSchedulingCallbackInfo);
 
   /**
    * Trace sink for the ns3::LteEnbMac::UlScheduling trace source
    *
    * \param macStats
-   * \param path
+   * \param context The context of the trace source
    * \param frameNo
    * \param subframeNo
    * \param rnti
@@ -193,7 +193,7 @@ public:
    * \param size
    * \param componentCarrierId
    */
-  static void UlSchedulingCallback (Ptr<MacStatsCalculator> macStats, std::string path,
+  static void UlSchedulingCallback (Ptr<MacStatsCalculator> macStats, Ptr<const Config::TraceContext> context,
                                     uint32_t frameNo, uint32_t subframeNo, uint16_t rnti,
                                     uint8_t mcs, uint16_t size, uint8_t componentCarrierId);
   //Sidelink
@@ -201,27 +201,27 @@ public:
   /**
    * Trace sink for the ns3::LteUeMac::SlPscchScheduling trace source
    * \param macStats
-   * \param path
+   * \param context The context of the trace source
    * \param params The SlUeMacStatParameters
    */
-  static void SlUeCchSchedulingCallback (Ptr<MacStatsCalculator> macStats, std::string path, SlUeMacStatParameters params);
+  static void SlUeCchSchedulingCallback (Ptr<MacStatsCalculator> macStats, Ptr<const Config::TraceContext> context, SlUeMacStatParameters params);
 
   /**
    * Trace sink for the ns3::LteUeMac::SlPsschScheduling trace source
    * \param macStats
-   * \param path
+   * \param context The context of the trace source
    * \param params The SlUeMacStatParameters
    */
-  static void SlUeSchSchedulingCallback (Ptr<MacStatsCalculator> macStats, std::string path, SlUeMacStatParameters params);
+  static void SlUeSchSchedulingCallback (Ptr<MacStatsCalculator> macStats, Ptr<const Config::TraceContext> context, SlUeMacStatParameters params);
 
   /**
    * Notifies the stats calculator that a Sidelink PSDCH UE MAC transmission has occurred.
    * \param macStats
-   * \param path
+   * \param context The context of the trace source
    * \param params
    * \param discMsg The LteSlDiscHeader
    */
-  static void SlUeDchSchedulingCallback (Ptr<MacStatsCalculator> macStats, std::string path, SlUeMacStatParameters params, LteSlDiscHeader discMsg);
+  static void SlUeDchSchedulingCallback (Ptr<MacStatsCalculator> macStats, Ptr<const Config::TraceContext> context, SlUeMacStatParameters params, LteSlDiscHeader discMsg);
 
   /**
    * Notifies the stats calculator that a Sidelink PSCCH UE MAC scheduling has occurred.
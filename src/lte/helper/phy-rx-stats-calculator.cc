@@ -132,28 +132,18 @@ PhyRxStatsCalculator::DlPhyReception (PhyReceptionStatParameters params)
   NS_LOG_FUNCTION (this << params.m_cellId << params.m_imsi << params.m_timestamp << params.m_rnti << params.m_layer << params.m_mcs << params.m_size << params.m_rv << params.m_ndi << params.m_correctness);
   NS_LOG_INFO ("Write DL Rx Phy Stats in " << GetDlRxOutputFilename ().c_str ());
 
-  std::ofstream outFile;
+  std::ostream &outFile = GetOutputStream (GetDlRxOutputFilename (), m_dlRxFirstWrite);
+  if (!outFile)
+    {
+      NS_LOG_ERROR ("Can't open file " << GetDlRxOutputFilename ().c_str ());
+      return;
+    }
   if ( m_dlRxFirstWrite == true )
     {
-      outFile.open (GetDlRxOutputFilename ().c_str ());
-      if (!outFile.is_open ())
-        {
-          NS_LOG_ERROR ("Can't open file " << GetDlRxOutputFilename ().c_str ());
-          return;
-        }
       m_dlRxFirstWrite = false;
       outFile << "% time\tcellId\tIMSI\tRNTI\ttxMode\tlayer\tmcs\tsize\trv\tndi\tcorrect\tavrgSinrPerRb\tccId";
       outFile << std::endl;
     }
-  else
-    {
-      outFile.open (GetDlRxOutputFilename ().c_str (),  std::ios_base::app);
-      if (!outFile.is_open ())
-        {
-          NS_LOG_ERROR ("Can't open file " << GetDlRxOutputFilename ().c_str ());
-          return;
-        }
-    }
 
 //   outFile << Simulator::Now ().GetNanoSeconds () / (double) 1e9 << "\t";
   outFile << params.m_timestamp << "\t";
@@ -169,7 +159,6 @@ PhyRxStatsCalculator::DlPhyReception (PhyReceptionStatParameters params)
   outFile << (uint32_t) params.m_correctness << "\t";
   outFile << (double) params.m_sinrPerRb << "\t";
   outFile << (uint32_t) params.m_ccId << std::endl;
-  outFile.close ();
 }
 
 void
@@ -178,28 +167,18 @@ PhyRxStatsCalculator::UlPhyReception (PhyReceptionStatParameters params)
   NS_LOG_FUNCTION (this << params.m_cellId << params.m_imsi << params.m_timestamp << params.m_rnti << params.m_layer << params.m_mcs << params.m_size << params.m_rv << params.m_ndi << params.m_correctness);
   NS_LOG_INFO ("Write UL Rx Phy Stats in " << GetUlRxOutputFilename ().c_str ());
 
-  std::ofstream outFile;
+  std::ostream &outFile = GetOutputStream (GetUlRxOutputFilename (), m_ulRxFirstWrite);
+  if (!outFile)
+    {
+      NS_LOG_ERROR ("Can't open file " << GetUlRxOutputFilename ().c_str ());
+      return;
+    }
   if ( m_ulRxFirstWrite == true )
     {
-      outFile.open (GetUlRxOutputFilename ().c_str ());
-      if (!outFile.is_open ())
-        {
-          NS_LOG_ERROR ("Can't open file " << GetUlRxOutputFilename ().c_str ());
-          return;
-        }
       m_ulRxFirstWrite = false;
       outFile << "% time\tcellId\tIMSI\tRNTI\tlayer\tmcs\tsize\trv\tndi\tcorrect\tavrgSinrPerRb\tccId";
       outFile << std::endl;
     }
-  else
-    {
-      outFile.open (GetUlRxOutputFilename ().c_str (),  std::ios_base::app);
-      if (!outFile.is_open ())
-        {
-          NS_LOG_ERROR ("Can't open file " << GetUlRxOutputFilename ().c_str ());
-          return;
-        }
-    }
 
 //   outFile << Simulator::Now ().GetNanoSeconds () / (double) 1e9 << "\t";
   outFile << params.m_timestamp << "\t";
@@ -214,7 +193,6 @@ PhyRxStatsCalculator::UlPhyReception (PhyReceptionStatParameters params)
   outFile << (uint32_t) params.m_correctness << "\t";
   outFile << (double) params.m_sinrPerRb << "\t";
   outFile << (uint32_t) params.m_ccId <<std::endl;
-  outFile.close ();
 }
 
 void
@@ -223,28 +201,18 @@ PhyRxStatsCalculator::SlPhyReception (PhyReceptionStatParameters params)
   NS_LOG_FUNCTION (this << params.m_cellId << params.m_imsi << params.m_timestamp << params.m_rnti << params.m_layer << params.m_mcs << params.m_size << params.m_rv << params.m_ndi << params.m_correctness);
   NS_LOG_INFO ("Write SL Rx Phy Stats in " << GetSlRxOutputFilename ().c_str ());
 
-  std::ofstream outFile;
+  std::ostream &outFile = GetOutputStream (GetSlRxOutputFilename (), m_slRxFirstWrite);
+  if (!outFile)
+    {
+      NS_LOG_ERROR ("Can't open file " << GetSlRxOutputFilename ().c_str ());
+      return;
+    }
   if (m_slRxFirstWrite == true)
     {
-      outFile.open (GetSlRxOutputFilename ().c_str ());
-      if (!outFile.is_open ())
-        {
-          NS_LOG_ERROR ("Can't open file " << GetSlRxOutputFilename ().c_str ());
-          return;
-        }
       m_slRxFirstWrite = false;
       outFile << "% time\tcellId\tIMSI\tRNTI\tlayer\tmcs\tsize\trv\tndi\tcorrect\tavrgSinrPerRb";
       outFile << std::endl;
     }
-  else
-    {
-      outFile.open (GetSlRxOutputFilename ().c_str (),  std::ios_base::app);
-      if (!outFile.is_open ())
-        {
-          NS_LOG_ERROR ("Can't open file " << GetSlRxOutputFilename ().c_str ());
-          return;
-        }
-    }
 
   outFile << params.m_timestamp << "\t";
   outFile << (uint32_t) params.m_cellId << "\t";
@@ -257,7 +225,6 @@ PhyRxStatsCalculator::SlPhyReception (PhyReceptionStatParameters params)
   outFile << (uint32_t) params.m_ndi << "\t";
   outFile << (uint32_t) params.m_correctness << "\t";
   outFile << (double) params.m_sinrPerRb <<std::endl;
-  outFile.close ();
 }
 
 void
@@ -266,28 +233,18 @@ PhyRxStatsCalculator::SlPscchReception (SlPhyReceptionStatParameters params)
   NS_LOG_FUNCTION (this << params.m_timestamp << params.m_cellId << params.m_imsi << params.m_rnti << (uint16_t)params.m_mcs << params.m_size << params.m_resPscch << (uint16_t)params.m_rbLen << (uint16_t)params.m_rbStart<< (uint16_t)params.m_iTrp << (uint16_t)params.m_hopping << (uint16_t)params.m_groupDstId << (uint16_t)params.m_correctness);
   NS_LOG_INFO ("Write SL Rx PSCCH Stats in " << GetSlPscchRxOutputFilename ().c_str ());
 
-  std::ofstream outFile;
+  std::ostream &outFile = GetOutputStream (GetSlPscchRxOutputFilename (), m_slPscchRxFirstWrite);
+  if (!outFile)
+    {
+      NS_LOG_ERROR ("Can't open file " << GetSlPscchRxOutputFilename ().c_str ());
+      return;
+    }
   if (m_slPscchRxFirstWrite == true)
     {
-      outFile.open (GetSlPscchRxOutputFilename ().c_str ());
-      if (!outFile.is_open ())
-        {
-          NS_LOG_ERROR ("Can't open file " << GetSlPscchRxOutputFilename ().c_str ());
-          return;
-        }
       m_slPscchRxFirstWrite = false;
       outFile << "% time\tcellId\tIMSI\tRNTI\tresPscch\tsizeTb\thopping\thoppingInfo\tpsschRbLen\tpsschStartRb\tiTrp\tmcs\tl1GroupDstId\tcorrect";
       outFile << std::endl;
     }
-  else
-    {
-      outFile.open (GetSlPscchRxOutputFilename ().c_str (),  std::ios_base::app);
-      if (!outFile.is_open ())
-        {
-          NS_LOG_ERROR ("Can't open file " << GetSlPscchRxOutputFilename ().c_str ());
-          return;
-        }
-    }
 
   outFile << params.m_timestamp << "\t";
   outFile << params.m_cellId << "\t";
@@ -303,27 +260,14 @@ PhyRxStatsCalculator::SlPscchReception (SlPhyReceptionStatParameters params)
   outFile << (uint32_t) params.m_mcs << "\t";
   outFile << (uint32_t) params.m_groupDstId << "\t";
   outFile << (uint32_t) params.m_correctness <<std::endl;
-  outFile.close ();
 }
 
 void
 PhyRxStatsCalculator::DlPhyReceptionCallback (Ptr<PhyRxStatsCalculator> phyRxStats,
-                      std::string path, PhyReceptionStatParameters params)
+                      Ptr<const Config::TraceContext> context, PhyReceptionStatParameters params)
 {
-  NS_LOG_FUNCTION (phyRxStats << path);
-  uint64_t imsi = 0;
-  std::ostringstream pathAndRnti;
-  pathAndRnti << path << "/" << params.m_rnti;
-  std::string pathUePhy  = path.substr (0, path.find ("/ComponentCarrierMapUe"));
-  if (phyRxStats->ExistsImsiPath (pathAndRnti.str ()) == true)
-    {
-      imsi = phyRxStats->GetImsiPath (pathAndRnti.str ());
-    }
-  else
-    {
-      imsi = FindImsiFromLteNetDevice (pathUePhy);
-      phyRxStats->SetImsiPath (pathAndRnti.str (), imsi);
-    }
+  NS_LOG_FUNCTION (phyRxStats << context->GetPath ());
+  uint64_t imsi = FindImsiFromUeDevice (context);
 
   params.m_imsi = imsi;
   phyRxStats->DlPhyReception (params);
@@ -331,22 +275,10 @@ PhyRxStatsCalculator::DlPhyReceptionCallback (Ptr<PhyRxStatsCalculator> phyRxSta
 
 void
 PhyRxStatsCalculator::UlPhyReceptionCallback (Ptr<PhyRxStatsCalculator> phyRxStats,
-                      std::string path, PhyReceptionStatParameters params)
+                      Ptr<const Config::TraceContext> context, PhyReceptionStatParameters params)
 {
-  NS_LOG_FUNCTION (phyRxStats << path);
-  uint64_t imsi = 0;
-  std::ostringstream pathAndRnti;
-  std::string pathEnb  = path.substr (0, path.find ("/ComponentCarrierMap"));
-  pathAndRnti << pathEnb << "/LteEnbRrc/UeMap/" << params.m_rnti;
-  if (phyRxStats->ExistsImsiPath (pathAndRnti.str ()) == true)
-    {
-      imsi = phyRxStats->GetImsiPath (pathAndRnti.str ());
-    }
-  else
-    {
-      imsi = FindImsiFromEnbRlcPath (pathAndRnti.str ());
-      phyRxStats->SetImsiPath (pathAndRnti.str (), imsi);
-    }
+  NS_LOG_FUNCTION (phyRxStats << context->GetPath ());
+  uint64_t imsi = phyRxStats->GetImsiFromEnbDevice (context, params.m_rnti);
 
   params.m_imsi = imsi;
   phyRxStats->UlPhyReception (params);
@@ -354,22 +286,10 @@ PhyRxStatsCalculator::UlPhyReceptionCallback (Ptr<PhyRxStatsCalculator> phyRxSta
 
 void
 PhyRxStatsCalculator::SlPhyReceptionCallback (Ptr<PhyRxStatsCalculator> phyRxStats,
-                      std::string path, PhyReceptionStatParameters params)
+                      Ptr<const Config::TraceContext> context, PhyReceptionStatParameters params)
 {
-  NS_LOG_FUNCTION (phyRxStats << path);
-  uint64_t imsi = 0;
-  std::ostringstream pathAndRnti;
-  pathAndRnti << path << "/" << params.m_rnti;
-  std::string pathSlUePhy  = path.substr (0, path.find ("/ComponentCarrierMapUe"));
-  if (phyRxStats->ExistsImsiPath (pathAndRnti.str ()) == true)
-    {
-      imsi = phyRxStats->GetImsiPath (pathAndRnti.str ());
-    }
-  else
-    {
-      imsi = FindImsiFromLteNetDevice (pathSlUePhy);
-      phyRxStats->SetImsiPath (pathAndRnti.str (), imsi);
-    }
+  NS_LOG_FUNCTION (phyRxStats << context->GetPath ());
+  uint64_t imsi = FindImsiFromUeDevice (context);
 
   params.m_imsi = imsi;
   phyRxStats->SlPhyReception (params);
@@ -377,22 +297,10 @@ PhyRxStatsCalculator::SlPhyReceptionCallback (Ptr<PhyRxStatsCalculator> phyRxSta
 
 void
 PhyRxStatsCalculator::SlPscchReceptionCallback (Ptr<PhyRxStatsCalculator> phyRxStats,
-                      std::string path, SlPhyReceptionStatParameters params)
+                      Ptr<const Config::TraceContext> context, SlPhyReceptionStatParameters params)
 {
-  NS_LOG_FUNCTION (phyRxStats << path);
-  uint64_t imsi = 0;
-  std::ostringstream pathAndRnti;
-  pathAndRnti << path << "/" << params.m_rnti;
-  std::string pathSlUePhy  = path.substr (0, path.find ("/ComponentCarrierMapUe"));
-  if (phyRxStats->ExistsImsiPath (pathAndRnti.str ()) == true)
-    {
-      imsi = phyRxStats->GetImsiPath (pathAndRnti.str ());
-    }
-  else
-    {
-      imsi = FindImsiFromLteNetDevice (pathSlUePhy);
-      phyRxStats->SetImsiPath (pathAndRnti.str (), imsi);
-    }
+  NS_LOG_FUNCTION (phyRxStats << context->GetPath ());
+  uint64_t imsi = FindImsiFromUeDevice (context);
 
   params.m_imsi = imsi;
   phyRxStats->SlPscchReception (params);
@@ -149,42 +149,42 @@ public:
    * trace sink
    * 
    * \param phyRxStats 
-   * \param path 
+   * \param context The context of the trace source
    * \param params 
    */
   static void DlPhyReceptionCallback (Ptr<PhyRxStatsCalculator> phyRxStats,
-                               std::string path, PhyReceptionStatParameters params);
+                               Ptr<const Config::TraceContext> context, PhyReceptionStatParameters params);
 
   /** 
    * trace sink
    * 
    * \param phyRxStats 
-   * \param path 
+   * \param context The context of the trace source
    * \param params 
    */
   static void UlPhyReceptionCallback (Ptr<PhyRxStatsCalculator> phyRxStats,
-                               std::string path, PhyReceptionStatParameters params);
+                               Ptr<const Config::TraceContext> context, PhyReceptionStatParameters params);
 
   /**
    * trace sink
    *
    * \param phyRxStats
-   * \param path
+   * \param context The context of the trace source
    * \param params
    */
   static void SlPhyReceptionCallback (Ptr<PhyRxStatsCalculator> phyRxStats,
-                               std::string path, PhyReceptionStatParameters params);
+                               Ptr<const Config::TraceContext> context, PhyReceptionStatParameters params);
 
 
   /**
    * trace sink
    *
    * \param phyRxStats
-   * \param path
+   * \param context The context of the trace source
    * \param params
    */
   static void SlPscchReceptionCallback (Ptr<PhyRxStatsCalculator> phyRxStats,
-                               std::string path, SlPhyReceptionStatParameters params);
+                               Ptr<const Config::TraceContext> context, SlPhyReceptionStatParameters params);
 private:
 
   /**
@@ -115,28 +115,18 @@ PhyStatsCalculator::ReportCurrentCellRsrpSinr (uint16_t cellId, uint64_t imsi, u
   NS_LOG_FUNCTION (this << cellId <<  imsi << rnti  << rsrp << sinr);
   NS_LOG_INFO ("Write RSRP/SINR Phy Stats in " << GetCurrentCellRsrpSinrFilename ().c_str ());
 
-  std::ofstream outFile;
+  std::ostream &outFile = GetOutputStream (GetCurrentCellRsrpSinrFilename (), m_RsrpSinrFirstWrite);
+  if (!outFile)
+    {
+      NS_LOG_ERROR ("Can't open file " << GetCurrentCellRsrpSinrFilename ().c_str ());
+      return;
+    }
   if ( m_RsrpSinrFirstWrite == true )
     {
-      outFile.open (GetCurrentCellRsrpSinrFilename ().c_str ());
-      if (!outFile.is_open ())
-        {
-          NS_LOG_ERROR ("Can't open file " << GetCurrentCellRsrpSinrFilename ().c_str ());
-          return;
-        }
       m_RsrpSinrFirstWrite = false;
       outFile << "% time\tcellId\tIMSI\tRNTI\trsrp\tsinr\tComponentCarrierId";
       outFile << std::endl;
     }
-  else
-    {
-      outFile.open (GetCurrentCellRsrpSinrFilename ().c_str (),  std::ios_base::app);
-      if (!outFile.is_open ())
-        {
-          NS_LOG_ERROR ("Can't open file " << GetCurrentCellRsrpSinrFilename ().c_str ());
-          return;
-        }
-    }
 
   outFile << Simulator::Now ().GetNanoSeconds () / (double) 1e9 << "\t";
   outFile << cellId << "\t";
@@ -145,7 +135,6 @@ PhyStatsCalculator::ReportCurrentCellRsrpSinr (uint16_t cellId, uint64_t imsi, u
   outFile << rsrp << "\t";
   outFile << sinr << "\t";
   outFile << (uint32_t)componentCarrierId << std::endl;
-  outFile.close ();
 }
 
 void
@@ -154,28 +143,18 @@ PhyStatsCalculator::ReportUeSinr (uint16_t cellId, uint64_t imsi, uint16_t rnti,
   NS_LOG_FUNCTION (this << cellId <<  imsi << rnti  << sinrLinear);
   NS_LOG_INFO ("Write SINR Linear Phy Stats in " << GetUeSinrFilename ().c_str ());
 
-  std::ofstream outFile;
+  std::ostream &outFile = GetOutputStream (GetUeSinrFilename (), m_UeSinrFirstWrite);
+  if (!outFile)
+    {
+      NS_LOG_ERROR ("Can't open file " << GetUeSinrFilename ().c_str ());
+      return;
+    }
   if ( m_UeSinrFirstWrite == true )
     {
-      outFile.open (GetUeSinrFilename ().c_str ());
-      if (!outFile.is_open ())
-        {
-          NS_LOG_ERROR ("Can't open file " << GetUeSinrFilename ().c_str ());
-          return;
-        }
       m_UeSinrFirstWrite = false;
       outFile << "% time\tcellId\tIMSI\tRNTI\tsinrLinear\tcomponentCarrierId";
       outFile << std::endl;
     }
-  else
-    {
-      outFile.open (GetUeSinrFilename ().c_str (),  std::ios_base::app);
-      if (!outFile.is_open ())
-        {
-          NS_LOG_ERROR ("Can't open file " << GetUeSinrFilename ().c_str ());
-          return;
-        }
-    }
 
   outFile << Simulator::Now ().GetNanoSeconds () / (double) 1e9 << "\t";
   outFile << cellId << "\t";
@@ -183,7 +162,6 @@ PhyStatsCalculator::ReportUeSinr (uint16_t cellId, uint64_t imsi, uint16_t rnti,
   outFile << rnti << "\t";
   outFile << sinrLinear << "\t";
   outFile << (uint32_t)componentCarrierId << std::endl;
-  outFile.close ();
 }
 
 void
@@ -192,86 +170,52 @@ PhyStatsCalculator::ReportInterference (uint16_t cellId, Ptr<SpectrumValue> inte
   NS_LOG_FUNCTION (this << cellId <<  interference);
   NS_LOG_INFO ("Write Interference Phy Stats in " << GetInterferenceFilename ().c_str ());
 
-  std::ofstream outFile;
+  std::ostream &outFile = GetOutputStream (GetInterferenceFilename (), m_InterferenceFirstWrite);
+  if (!outFile)
+    {
+      NS_LOG_ERROR ("Can't open file " << GetInterferenceFilename ().c_str ());
+      return;
+    }
   if ( m_InterferenceFirstWrite == true )
     {
-      outFile.open (GetInterferenceFilename ().c_str ());
-      if (!outFile.is_open ())
-        {
-          NS_LOG_ERROR ("Can't open file " << GetInterferenceFilename ().c_str ());
-          return;
-        }
       m_InterferenceFirstWrite = false;
       outFile << "% time\tcellId\tInterference";
       outFile << std::endl;
     }
-  else
-    {
-      outFile.open (GetInterferenceFilename ().c_str (),  std::ios_base::app);
-      if (!outFile.is_open ())
-        {
-          NS_LOG_ERROR ("Can't open file " << GetInterferenceFilename ().c_str ());
-          return;
-        }
-    }
 
   outFile << Simulator::Now ().GetNanoSeconds () / (double) 1e9 << "\t";
   outFile << cellId << "\t";
   outFile << *interference;
-  outFile.close ();
 }
 
 
 void
 PhyStatsCalculator::ReportCurrentCellRsrpSinrCallback (Ptr<PhyStatsCalculator> phyStats,
-                      std::string path, uint16_t cellId, uint16_t rnti,
+                      Ptr<const Config::TraceContext> context, uint16_t cellId, uint16_t rnti,
                       double rsrp, double sinr, uint8_t componentCarrierId)
 {
-  NS_LOG_FUNCTION (phyStats << path);
-  uint64_t imsi = 0;
-  std::string pathUePhy  = path.substr (0, path.find ("/ComponentCarrierMapUe"));
-  if (phyStats->ExistsImsiPath (pathUePhy) == true)
-    {
-      imsi = phyStats->GetImsiPath (pathUePhy);
-    }
-  else
-    {
-      imsi = FindImsiFromLteNetDevice (pathUePhy);
-      phyStats->SetImsiPath (pathUePhy, imsi);
-    }
+  NS_LOG_FUNCTION (phyStats << context->GetPath ());
+  uint64_t imsi = FindImsiFromUeDevice (context);
 
   phyStats->ReportCurrentCellRsrpSinr (cellId, imsi, rnti, rsrp, sinr, componentCarrierId);
 }
 
 void
-PhyStatsCalculator::ReportUeSinr (Ptr<PhyStatsCalculator> phyStats, std::string path,
+PhyStatsCalculator::ReportUeSinr (Ptr<PhyStatsCalculator> phyStats, Ptr<const Config::TraceContext> context,
                                   uint16_t cellId, uint16_t rnti, double sinrLinear, uint8_t componentCarrierId)
 {
-  NS_LOG_FUNCTION (phyStats << path);
-
-  uint64_t imsi = 0;
-  std::ostringstream pathAndRnti;
-  pathAndRnti << path << "/" << rnti;
-  std::string pathEnbMac  = path.substr (0, path.find ("/ComponentCarrierMap"));
-  pathEnbMac += "/LteEnbMac/DlScheduling";
-  if (phyStats->ExistsImsiPath (pathAndRnti.str ()) == true)
-    {
-      imsi = phyStats->GetImsiPath (pathAndRnti.str ());
-    }
-  else
-    {
-      imsi = FindImsiFromEnbMac (pathEnbMac, rnti);
-      phyStats->SetImsiPath (pathAndRnti.str (), imsi);
-    }
+  NS_LOG_FUNCTION (phyStats << context->GetPath ());
+
+  uint64_t imsi = phyStats->GetImsiFromEnbDevice (context, rnti);
 
   phyStats->ReportUeSinr (cellId, imsi, rnti, sinrLinear, componentCarrierId);
 }
 
 void
-PhyStatsCalculator::ReportInterference (Ptr<PhyStatsCalculator> phyStats, std::string path,
+PhyStatsCalculator::ReportInterference (Ptr<PhyStatsCalculator> phyStats, Ptr<const Config::TraceContext> context,
                     uint16_t cellId, Ptr<SpectrumValue> interference)
 {
-  NS_LOG_FUNCTION (phyStats << path);
+  NS_LOG_FUNCTION (phyStats << context->GetPath ());
   phyStats->ReportInterference (cellId, interference);
 }
 
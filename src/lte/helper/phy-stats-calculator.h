@@ -145,7 +145,7 @@ public:
    * trace sink
    * 
    * \param phyStats 
-   * \param path 
+   * \param context The context of the trace source
    * \param cellId 
    * \param rnti 
    * \param rsrp 
@@ -153,31 +153,31 @@ public:
    * \param componentCarrierId
    */
   static void ReportCurrentCellRsrpSinrCallback (Ptr<PhyStatsCalculator> phyStats,
-                                          std::string path, uint16_t cellId, uint16_t rnti,
+                                          Ptr<const Config::TraceContext> context, uint16_t cellId, uint16_t rnti,
                                           double rsrp, double sinr, uint8_t componentCarrierId);
   
   /** 
    * trace sink
    * 
    * \param phyStats 
-   * \param path 
+   * \param context The context of the trace source
    * \param cellId 
    * \param rnti 
    * \param sinrLinear
    * \param componentCarrierId
    */
-  static void ReportUeSinr (Ptr<PhyStatsCalculator> phyStats, std::string path,
+  static void ReportUeSinr (Ptr<PhyStatsCalculator> phyStats, Ptr<const Config::TraceContext> context,
                      uint16_t cellId, uint16_t rnti, double sinrLinear, uint8_t componentCarrierId);
 
   /** 
    * trace sink
    * 
    * \param phyStats 
-   * \param path 
+   * \param context The context of the trace source
    * \param cellId 
    * \param interference 
    */
-  static void ReportInterference (Ptr<PhyStatsCalculator> phyStats, std::string path,
+  static void ReportInterference (Ptr<PhyStatsCalculator> phyStats, Ptr<const Config::TraceContext> context,
                            uint16_t cellId, Ptr<SpectrumValue> interference);
 
 
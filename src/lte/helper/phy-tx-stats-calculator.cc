@@ -96,29 +96,19 @@ PhyTxStatsCalculator::DlPhyTransmission (PhyTransmissionStatParameters params)
   NS_LOG_FUNCTION (this << params.m_cellId << params.m_imsi << params.m_timestamp << params.m_rnti << params.m_layer << params.m_mcs << params.m_size << params.m_rv << params.m_ndi);
   NS_LOG_INFO ("Write DL Tx Phy Stats in " << GetDlTxOutputFilename ().c_str ());
 
-  std::ofstream outFile;
+  std::ostream &outFile = GetOutputStream (GetDlTxOutputFilename (), m_dlTxFirstWrite);
+  if (!outFile)
+    {
+      NS_LOG_ERROR ("Can't open file " << GetDlTxOutputFilename ().c_str ());
+      return;
+    }
   if ( m_dlTxFirstWrite == true )
     {
-      outFile.open (GetDlOutputFilename ().c_str ());
-      if (!outFile.is_open ())
-        {
-          NS_LOG_ERROR ("Can't open file " << GetDlTxOutputFilename ().c_str ());
-          return;
-        }
       m_dlTxFirstWrite = false;
       //outFile << "% time\tcellId\tIMSI\tRNTI\tlayer\tmcs\tsize\trv\tndi"; // txMode is not available at dl tx side
       outFile << "% time\tcellId\tIMSI\tRNTI\tlayer\tmcs\tsize\trv\tndi\tccId";
       outFile << std::endl;
     }
-  else
-    {
-      outFile.open (GetDlTxOutputFilename ().c_str (),  std::ios_base::app);
-      if (!outFile.is_open ())
-        {
-          NS_LOG_ERROR ("Can't open file " << GetDlTxOutputFilename ().c_str ());
-          return;
-        }
-    }
 
 //   outFile << Simulator::Now ().GetNanoSeconds () / (double) 1e9 << "\t";
   outFile << params.m_timestamp << "\t";
@@ -132,7 +122,6 @@ PhyTxStatsCalculator::DlPhyTransmission (PhyTransmissionStatParameters params)
   outFile << (uint32_t) params.m_rv << "\t";
   outFile << (uint32_t) params.m_ndi << "\t";
   outFile << (uint32_t) params.m_ccId << std::endl;
-  outFile.close ();
 }
 
 void
@@ -141,29 +130,19 @@ PhyTxStatsCalculator::UlPhyTransmission (PhyTransmissionStatParameters params)
   NS_LOG_FUNCTION (this << params.m_cellId << params.m_imsi << params.m_timestamp << params.m_rnti << params.m_layer << params.m_mcs << params.m_size << params.m_rv << params.m_ndi);
   NS_LOG_INFO ("Write UL Tx Phy Stats in " << GetUlTxOutputFilename ().c_str ());
 
-  std::ofstream outFile;
+  std::ostream &outFile = GetOutputStream (GetUlTxOutputFilename (), m_ulTxFirstWrite);
+  if (!outFile)
+    {
+      NS_LOG_ERROR ("Can't open file " << GetUlTxOutputFilename ().c_str ());
+      return;
+    }
   if ( m_ulTxFirstWrite == true )
     {
-      outFile.open (GetUlTxOutputFilename ().c_str ());
-      if (!outFile.is_open ())
-        {
-          NS_LOG_ERROR ("Can't open file " << GetUlTxOutputFilename ().c_str ());
-          return;
-        }
       m_ulTxFirstWrite = false;
 //       outFile << "% time\tcellId\tIMSI\tRNTI\ttxMode\tlayer\tmcs\tsize\trv\tndi";
       outFile << "% time\tcellId\tIMSI\tRNTI\tlayer\tmcs\tsize\trv\tndi\tccId";
       outFile << std::endl;
     }
-  else
-    {
-      outFile.open (GetUlTxOutputFilename ().c_str (),  std::ios_base::app);
-      if (!outFile.is_open ())
-        {
-          NS_LOG_ERROR ("Can't open file " << GetUlTxOutputFilename ().c_str ());
-          return;
-        }
-    }
 
 //   outFile << Simulator::Now ().GetNanoSeconds () / (double) 1e9 << "\t";
   outFile << params.m_timestamp << "\t";
@@ -177,27 +156,14 @@ PhyTxStatsCalculator::UlPhyTransmission (PhyTransmissionStatParameters params)
   outFile << (uint32_t) params.m_rv << "\t";
   outFile << (uint32_t) params.m_ndi << "\t";
   outFile << (uint32_t) params.m_ccId << std::endl;
-  outFile.close ();
 }
 
 void
 PhyTxStatsCalculator::DlPhyTransmissionCallback (Ptr<PhyTxStatsCalculator> phyTxStats,
-                      std::string path, PhyTransmissionStatParameters params)
+                      Ptr<const Config::TraceContext> context, PhyTransmissionStatParameters params)
 {
-  NS_LOG_FUNCTION (phyTxStats << path);
-  uint64_t imsi = 0;
-  std::ostringstream pathAndRnti;
-  std::string pathEnb  = path.substr (0, path.find ("/ComponentCarrierMap"));
-  pathAndRnti << pathEnb << "/LteEnbRrc/UeMap/" << params.m_rnti;
-  if (phyTxStats->ExistsImsiPath (pathAndRnti.str ()) == true)
-    {
-      imsi = phyTxStats->GetImsiPath (pathAndRnti.str ());
-    }
-  else
-    {
-      imsi = FindImsiFromEnbRlcPath (pathAndRnti.str ());
-      phyTxStats->SetImsiPath (pathAndRnti.str (), imsi);
-    }
+  NS_LOG_FUNCTION (phyTxStats << context->GetPath ());
+  uint64_t imsi = phyTxStats->GetImsiFromEnbDevice (context, params.m_rnti);
 
   params.m_imsi = imsi;
   phyTxStats->DlPhyTransmission (params);
@@ -205,22 +171,10 @@ PhyTxStatsCalculator::DlPhyTransmissionCallback (Ptr<PhyTxStatsCalculator> phyTx
 
 void
 PhyTxStatsCalculator::UlPhyTransmissionCallback (Ptr<PhyTxStatsCalculator> phyTxStats,
-                      std::string path, PhyTransmissionStatParameters params)
+                      Ptr<const Config::TraceContext> context, PhyTransmissionStatParameters params)
 {
-  NS_LOG_FUNCTION (phyTxStats << path);
-  uint64_t imsi = 0;
-  std::ostringstream pathAndRnti;
-  pathAndRnti << path << "/" << params.m_rnti;
-  std::string pathUePhy  = path.substr (0, path.find ("/ComponentCarrierMapUe"));
-  if (phyTxStats->ExistsImsiPath (pathAndRnti.str ()) == true)
-    {
-      imsi = phyTxStats->GetImsiPath (pathAndRnti.str ());
-    }
-  else
-    {
-      imsi = FindImsiFromLteNetDevice (pathUePhy);
-      phyTxStats->SetImsiPath (pathAndRnti.str (), imsi);
-    }
+  NS_LOG_FUNCTION (phyTxStats << context->GetPath ());
+  uint64_t imsi = FindImsiFromUeDevice (context);
 
   params.m_imsi = imsi;
   phyTxStats->UlPhyTransmission (params);
@@ -111,21 +111,21 @@ public:
    * trace sink
    * 
    * \param phyTxStats 
-   * \param path 
+   * \param context The context of the trace source
    * \param params 
    */
   static void DlPhyTransmissionCallback (Ptr<PhyTxStatsCalculator> phyTxStats,
-                                  std::string path, PhyTransmissionStatParameters params);
+                                  Ptr<const Config::TraceContext> context, PhyTransmissionStatParameters params);
 
   /** 
    * trace sink
    * 
    * \param phyTxStats 
-   * \param path 
+   * \param context The context of the trace source
    * \param params 
    */
   static void UlPhyTransmissionCallback (Ptr<PhyTxStatsCalculator> phyTxStats,
-                                  std::string path, PhyTransmissionStatParameters params);
+                                  Ptr<const Config::TraceContext> context, PhyTransmissionStatParameters params);
 
 private:
   /**
@@ -53,66 +53,62 @@ public:
 /**
  * Callback function for DL TX statistics for both RLC and PDCP
  * \param arg
- * \param path
  * \param rnti
  * \param lcid
  * \param packetSize
  */
 void
-DlTxPduCallback (Ptr<BoundCallbackArgument> arg, std::string path,
+DlTxPduCallback (Ptr<BoundCallbackArgument> arg,
                  uint16_t rnti, uint8_t lcid, uint32_t packetSize)
 {
-  NS_LOG_FUNCTION (path << rnti << (uint16_t)lcid << packetSize);
+  NS_LOG_FUNCTION (arg->imsi << arg->cellId << rnti << (uint16_t)lcid << packetSize);
   arg->stats->DlTxPdu (arg->cellId, arg->imsi, rnti, lcid, packetSize);
 }
 
 /**
  * Callback function for DL RX statistics for both RLC and PDCP
  * \param arg
- * \param path
  * \param rnti
  * \param lcid
  * \param packetSize
  * \param delay
  */
 void
-DlRxPduCallback (Ptr<BoundCallbackArgument> arg, std::string path,
+DlRxPduCallback (Ptr<BoundCallbackArgument> arg,
                  uint16_t rnti, uint8_t lcid, uint32_t packetSize, uint64_t delay)
 {
-  NS_LOG_FUNCTION (path << rnti << (uint16_t)lcid << packetSize << delay);
+  NS_LOG_FUNCTION (arg->imsi << arg->cellId << rnti << (uint16_t)lcid << packetSize << delay);
   arg->stats->DlRxPdu (arg->cellId, arg->imsi, rnti, lcid, packetSize, delay);
 }
 
 /**
  * Callback function for UL TX statistics for both RLC and PDCP
  * \param arg
- * \param path
  * \param rnti
  * \param lcid
  * \param packetSize
  */
 void
-UlTxPduCallback (Ptr<BoundCallbackArgument> arg, std::string path,
+UlTxPduCallback (Ptr<BoundCallbackArgument> arg,
                  uint16_t rnti, uint8_t lcid, uint32_t packetSize)
 {
-  NS_LOG_FUNCTION (path << rnti << (uint16_t)lcid << packetSize);
+  NS_LOG_FUNCTION (arg->imsi << arg->cellId << rnti << (uint16_t)lcid << packetSize);
   arg->stats->UlTxPdu (arg->cellId, arg->imsi, rnti, lcid, packetSize);
 }
 
 /**
  * Callback function for UL RX statistics for both RLC and PDCP
  * \param arg
- * \param path
  * \param rnti
  * \param lcid
  * \param packetSize
  * \param delay
  */
 void
-UlRxPduCallback (Ptr<BoundCallbackArgument> arg, std::string path,
+UlRxPduCallback (Ptr<BoundCallbackArgument> arg,
                  uint16_t rnti, uint8_t lcid, uint32_t packetSize, uint64_t delay)
 {
-  NS_LOG_FUNCTION (path << rnti << (uint16_t)lcid << packetSize << delay);
+  NS_LOG_FUNCTION (arg->imsi << arg->cellId << rnti << (uint16_t)lcid << packetSize << delay);
   arg->stats->UlRxPdu (arg->cellId, arg->imsi, rnti, lcid, packetSize, delay);
 }
 
@@ -228,14 +224,14 @@ RadioBearerStatsConnector::ConnectTracesSrb0 (std::string context, uint64_t imsi
       arg->imsi = imsi;
       arg->cellId = cellId;
       arg->stats = m_rlcStats;
-      Config::Connect (ueRrcPath + "/Srb0/LteRlc/TxPDU",
-                       MakeBoundCallback (&UlTxPduCallback, arg));
-      Config::Connect (ueRrcPath + "/Srb0/LteRlc/RxPDU",
-                       MakeBoundCallback (&DlRxPduCallback, arg));
-      Config::Connect (ueManagerPath + "/Srb0/LteRlc/TxPDU",
-                       MakeBoundCallback (&DlTxPduCallback, arg));
-      Config::Connect (ueManagerPath + "/Srb0/LteRlc/RxPDU",
-                       MakeBoundCallback (&UlRxPduCallback, arg));
+      Config::ConnectWithoutContext (ueRrcPath + "/Srb0/LteRlc/TxPDU",
+                                     MakeBoundCallback (&UlTxPduCallback, arg));
+      Config::ConnectWithoutContext (ueRrcPath + "/Srb0/LteRlc/RxPDU",
+                                     MakeBoundCallback (&DlRxPduCallback, arg));
+      Config::ConnectWithoutContext (ueManagerPath + "/Srb0/LteRlc/TxPDU",
+                                     MakeBoundCallback (&DlTxPduCallback, arg));
+      Config::ConnectWithoutContext (ueManagerPath + "/Srb0/LteRlc/RxPDU",
+                                     MakeBoundCallback (&UlRxPduCallback, arg));
     }
 }
 
@@ -258,14 +254,14 @@ RadioBearerStatsConnector::ConnectTracesSrb1 (std::string context, uint64_t imsi
       arg->imsi = imsi;
       arg->cellId = cellId;
       arg->stats = m_rlcStats;
-      Config::Connect (ueRrcPath + "/Srb1/LteRlc/TxPDU",
-                       MakeBoundCallback (&UlTxPduCallback, arg));
-      Config::Connect (ueRrcPath + "/Srb1/LteRlc/RxPDU",
-                       MakeBoundCallback (&DlRxPduCallback, arg));
-      Config::Connect (ueManagerPath + "/Srb1/LteRlc/TxPDU",
-                       MakeBoundCallback (&DlTxPduCallback, arg));
-      Config::Connect (ueManagerPath + "/Srb1/LteRlc/RxPDU",
-                       MakeBoundCallback (&UlRxPduCallback, arg));
+      Config::ConnectWithoutContext (ueRrcPath + "/Srb1/LteRlc/TxPDU",
+                                     MakeBoundCallback (&UlTxPduCallback, arg));
+      Config::ConnectWithoutContext (ueRrcPath + "/Srb1/LteRlc/RxPDU",
+                                     MakeBoundCallback (&DlRxPduCallback, arg));
+      Config::ConnectWithoutContext (ueManagerPath + "/Srb1/LteRlc/TxPDU",
+                                     MakeBoundCallback (&DlTxPduCallback, arg));
+      Config::ConnectWithoutContext (ueManagerPath + "/Srb1/LteRlc/RxPDU",
+                                     MakeBoundCallback (&UlRxPduCallback, arg));
     }
   if (m_pdcpStats)
     {
@@ -273,14 +269,14 @@ RadioBearerStatsConnector::ConnectTracesSrb1 (std::string context, uint64_t imsi
       arg->imsi = imsi;
       arg->cellId = cellId;
       arg->stats = m_pdcpStats;
-      Config::Connect (ueRrcPath + "/Srb1/LtePdcp/TxPDU",
-                       MakeBoundCallback (&UlTxPduCallback, arg));
-      Config::Connect (ueRrcPath + "/Srb1/LtePdcp/RxPDU",
-                       MakeBoundCallback (&DlRxPduCallback, arg));
-      Config::Connect (ueManagerPath + "/Srb1/LtePdcp/TxPDU",
-                       MakeBoundCallback (&DlTxPduCallback, arg));
-      Config::Connect (ueManagerPath + "/Srb1/LtePdcp/RxPDU",
-                       MakeBoundCallback (&UlRxPduCallback, arg));
+      Config::ConnectWithoutContext (ueRrcPath + "/Srb1/LtePdcp/TxPDU",
+                                     MakeBoundCallback (&UlTxPduCallback, arg));
+      Config::ConnectWithoutContext (ueRrcPath + "/Srb1/LtePdcp/RxPDU",
+                                     MakeBoundCallback (&DlRxPduCallback, arg));
+      Config::ConnectWithoutContext (ueManagerPath + "/Srb1/LtePdcp/TxPDU",
+                                     MakeBoundCallback (&DlTxPduCallback, arg));
+      Config::ConnectWithoutContext (ueManagerPath + "/Srb1/LtePdcp/RxPDU",
+                                     MakeBoundCallback (&UlRxPduCallback, arg));
     }
 }
 
@@ -298,10 +294,10 @@ RadioBearerStatsConnector::ConnectTracesDrbEnb (std::string context, uint64_t im
       arg->imsi = imsi;
       arg->cellId = cellId;
       arg->stats = m_rlcStats;
-      Config::Connect (basePath + "/LteRlc/TxPDU",
-                       MakeBoundCallback (&DlTxPduCallback, arg));
-      Config::Connect (basePath + "/LteRlc/RxPDU",
-                       MakeBoundCallback (&UlRxPduCallback, arg));
+      Config::ConnectWithoutContext (basePath + "/LteRlc/TxPDU",
+                                     MakeBoundCallback (&DlTxPduCallback, arg));
+      Config::ConnectWithoutContext (basePath + "/LteRlc/RxPDU",
+                                     MakeBoundCallback (&UlRxPduCallback, arg));
     }
   if (m_pdcpStats)
     {
@@ -309,10 +305,10 @@ RadioBearerStatsConnector::ConnectTracesDrbEnb (std::string context, uint64_t im
       arg->imsi = imsi;
       arg->cellId = cellId;
       arg->stats = m_pdcpStats;
-      Config::Connect (basePath + "/LtePdcp/TxPDU",
-                       MakeBoundCallback (&DlTxPduCallback, arg));
-      Config::Connect (basePath + "/LtePdcp/RxPDU",
-                       MakeBoundCallback (&UlRxPduCallback, arg));
+      Config::ConnectWithoutContext (basePath + "/LtePdcp/TxPDU",
+                                     MakeBoundCallback (&DlTxPduCallback, arg));
+      Config::ConnectWithoutContext (basePath + "/LtePdcp/RxPDU",
+                                     MakeBoundCallback (&UlRxPduCallback, arg));
     }
 }
 
@@ -330,10 +326,10 @@ RadioBearerStatsConnector::ConnectTracesDrbUe (std::string context, uint64_t ims
       arg->imsi = imsi;
       arg->cellId = cellId;
       arg->stats = m_rlcStats;
-      Config::Connect (basePath + "/LteRlc/TxPDU",
-                       MakeBoundCallback (&UlTxPduCallback, arg));
-      Config::Connect (basePath + "/LteRlc/RxPDU",
-                       MakeBoundCallback (&DlRxPduCallback, arg));
+      Config::ConnectWithoutContext (basePath + "/LteRlc/TxPDU",
+                                     MakeBoundCallback (&UlTxPduCallback, arg));
+      Config::ConnectWithoutContext (basePath + "/LteRlc/RxPDU",
+                                     MakeBoundCallback (&DlRxPduCallback, arg));
     }
   if (m_pdcpStats)
     {
@@ -341,10 +337,10 @@ RadioBearerStatsConnector::ConnectTracesDrbUe (std::string context, uint64_t ims
       arg->imsi = imsi;
       arg->cellId = cellId;
       arg->stats = m_pdcpStats;
-      Config::Connect (basePath + "/LtePdcp/TxPDU",
-                       MakeBoundCallback (&UlTxPduCallback, arg));
-      Config::Connect (basePath + "/LtePdcp/RxPDU",
-                       MakeBoundCallback (&DlRxPduCallback, arg));
+      Config::ConnectWithoutContext (basePath + "/LtePdcp/TxPDU",
+                                     MakeBoundCallback (&UlTxPduCallback, arg));
+      Config::ConnectWithoutContext (basePath + "/LtePdcp/RxPDU",
+                                     MakeBoundCallback (&DlRxPduCallback, arg));
     }
 }
 
@@ -36,10 +36,32 @@
 #include <ns3/simulator.h>
 #include <ns3/node.h>
 #include <ns3/buildings-helper.h>
+#include <ns3/building-list.h>
 #include <ns3/lte-spectrum-value-helper.h>
+#include <ns3/node-list.h>
+#include <ns3/lte-enb-net-device.h>
+#include <ns3/lte-ue-net-device.h>
+#include <ns3/component-carrier-enb.h>
+#include <ns3/component-carrier-ue.h>
+#include <ns3/lte-enb-phy.h>
+#include <ns3/lte-ue-phy.h>
+#include <ns3/lte-spectrum-phy.h>
+#include <ns3/propagation-loss-model.h>
+#include <ns3/spectrum-propagation-loss-model.h>
+#include <ns3/spectrum-converter.h>
+#include <ns3/antenna-model.h>
+#include <ns3/angles.h>
+#include <ns3/pointer.h>
+#include <ns3/object-factory.h>
 
 #include <fstream>
 #include <limits>
+#include <cmath>
+#include <map>
+#include <functional>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
 
 namespace ns3 {
 
@@ -47,7 +69,128 @@ NS_LOG_COMPONENT_DEFINE ("RadioEnvironmentMapHelper");
 
 NS_OBJECT_ENSURE_REGISTERED (RadioEnvironmentMapHelper);
 
+namespace {
+
+/// Magic number at the beginning of a binary map, with the format version
+const char REM_BINARY_MAGIC[8] = {'N', 'S', '3', 'R', 'E', 'M', 0, 1};
+
+/**
+ * Compute the power of a received PSD as the RemSpectrumPhy does
+ * \param psd the PSD
+ * \param rbId the RB of the map, or -1 for all the RBs
+ * \return the power in W
+ */
+double
+CalcRemPower (const SpectrumValue &psd, int32_t rbId)
+{
+  if (rbId >= 0)
+    {
+      return *(psd.ConstValuesBegin () + rbId) * 180000;
+    }
+  return Integral (psd);
+}
+
+/**
+ * Compute the average power per resource element of the RBs of a PSD, as
+ * the UE does for the RSRP
+ * \param psd the PSD
+ * \param rbId the RB of the map, or -1 for all the RBs
+ * \return the power per resource element in W
+ */
+double
+CalcRemRsrp (const SpectrumValue &psd, int32_t rbId)
+{
+  if (rbId >= 0)
+    {
+      return *(psd.ConstValuesBegin () + rbId) * 180000 / 12;
+    }
+  double sum = 0;
+  uint32_t rbNum = 0;
+  for (Values::const_iterator it = psd.ConstValuesBegin (); it != psd.ConstValuesEnd (); ++it)
+    {
+      if (*it > 0)
+        {
+          sum += *it * 180000 / 12;
+          ++rbNum;
+        }
+    }
+  return rbNum > 0 ? sum / rbNum : 0;
+}
+
+/**
+ * Create a copy of a propagation loss model and of the models chained to
+ * it, from the values of their attributes, so that the copy can be used by
+ * another thread
+ * \param model the model
+ * \return the copy, or 0 if an attribute of a model cannot be copied, i.e.,
+ *         it has no getter or it points to an object that would be shared
+ */
+Ptr<PropagationLossModel>
+CopyPropagationLossModel (Ptr<PropagationLossModel> model)
+{
+  ObjectFactory factory;
+  TypeId tid = model->GetInstanceTypeId ();
+  factory.SetTypeId (tid);
+  for (TypeId t = tid; ; t = t.GetParent ())
+    {
+      for (uint32_t i = 0; i < t.GetAttributeN (); ++i)
+        {
+          struct TypeId::AttributeInformation info = t.GetAttribute (i);
+          if (!(info.flags & TypeId::ATTR_CONSTRUCT) || !info.accessor->HasSetter ())
+            {
+              continue;
+            }
+          if (!info.accessor->HasGetter () || DynamicCast<const PointerChecker> (info.checker) != 0)
+            {
+              NS_LOG_LOGIC ("attribute " << info.name << " of " << tid.GetName () << " cannot be copied");
+              return 0;
+            }
+          Ptr<AttributeValue> value = info.checker->Create ();
+          model->GetAttribute (info.name, *value);
+          factory.Set (info.name, *value);
+        }
+      if (t.GetParent () == t)
+        {
+          break;
+        }
+    }
+  Ptr<PropagationLossModel> copy = factory.Create<PropagationLossModel> ();
+  if (model->GetNext () != 0)
+    {
+      Ptr<PropagationLossModel> next = CopyPropagationLossModel (model->GetNext ());
+      if (next == 0)
+        {
+          return 0;
+        }
+      copy->SetNext (next);
+    }
+  return copy;
+}
+
+/**
+ * Create a mobility model at a fixed position, with a building info if
+ * needed, for a thread of the offline engine
+ * \param position the position
+ * \param withBuildingInfo true to aggregate a consistent building info
+ * \return the mobility model
+ */
+Ptr<MobilityModel>
+CreateOfflineMobility (Vector position, bool withBuildingInfo)
+{
+  Ptr<MobilityModel> mobility = CreateObject<ConstantPositionMobilityModel> ();
+  mobility->SetPosition (position);
+  if (withBuildingInfo)
+    {
+      mobility->AggregateObject (CreateObject<MobilityBuildingInfo> ());
+      BuildingsHelper::MakeConsistent (mobility);
+    }
+  return mobility;
+}
+
+} // unnamed namespace
+
 RadioEnvironmentMapHelper::RadioEnvironmentMapHelper ()
+  : m_maxLossDb (std::numeric_limits<double>::max ())
 {
 }
 
@@ -62,6 +205,7 @@ void
 RadioEnvironmentMapHelper::DoDispose ()
 {
   NS_LOG_FUNCTION (this);
+  m_offlineTransmitters.clear ();
 }
 
 TypeId
@@ -144,6 +288,48 @@ RadioEnvironmentMapHelper::GetTypeId (void)
                    IntegerValue (-1),
                    MakeIntegerAccessor (&RadioEnvironmentMapHelper::m_rbId),
                    MakeIntegerChecker<int32_t> ())
+    .AddAttribute ("Offline",
+                   "If true, the REM is computed directly from the transmitters attached to "
+                   "the channel and the loss models of the channel, without simulating a "
+                   "listener per point. The transmitters are assumed to transmit on all their "
+                   "RBs, hence UseDataChannel has no effect, and the output has an additional "
+                   "column with the RSRP of the strongest transmitter in dBm",
+                   BooleanValue (false),
+                   MakeBooleanAccessor (&RadioEnvironmentMapHelper::m_offline),
+                   MakeBooleanChecker ())
+    .AddAttribute ("NumThreads",
+                   "The number of threads computing the REM when Offline is true, or 0 to use "
+                   "all the hardware threads. A single thread is used if the scenario has "
+                   "buildings, if the channel has a frequency-dependent loss model, or if the "
+                   "loss models cannot be copied from their attributes",
+                   UintegerValue (0),
+                   MakeUintegerAccessor (&RadioEnvironmentMapHelper::m_numThreads),
+                   MakeUintegerChecker<uint32_t> ())
+    .AddAttribute ("TileColumns",
+                   "The number of columns, i.e., of points along the x axis, computed at once "
+                   "by a thread when Offline is true",
+                   UintegerValue (16),
+                   MakeUintegerAccessor (&RadioEnvironmentMapHelper::m_tileColumns),
+                   MakeUintegerChecker<uint32_t> (1, std::numeric_limits<uint32_t>::max ()))
+    .AddAttribute ("BinaryOutput",
+                   "If true and Offline is true, the REM is saved as a binary raster, which "
+                   "can be converted to text with RadioEnvironmentMapHelper::ConvertBinaryToText",
+                   BooleanValue (false),
+                   MakeBooleanAccessor (&RadioEnvironmentMapHelper::m_binaryOutput),
+                   MakeBooleanChecker ())
+    .AddAttribute ("IncludeEnbs",
+                   "If true and Offline is true, the eNBs transmitting in the downlink on the "
+                   "channel are sources of the REM",
+                   BooleanValue (true),
+                   MakeBooleanAccessor (&RadioEnvironmentMapHelper::m_includeEnbs),
+                   MakeBooleanChecker ())
+    .AddAttribute ("IncludeSidelinkUes",
+                   "If true and Offline is true, the UEs transmitting in the Sidelink on the "
+                   "channel are sources of the REM. They are assumed to transmit at their "
+                   "TxPower over the bandwidth of the REM",
+                   BooleanValue (false),
+                   MakeBooleanAccessor (&RadioEnvironmentMapHelper::m_includeSidelinkUes),
+                   MakeBooleanChecker ())
   ;
   return tid;
 }
@@ -181,7 +367,7 @@ void
 RadioEnvironmentMapHelper::Install ()
 {
   NS_LOG_FUNCTION (this);
-  if (!m_rem.empty ())
+  if (!m_rem.empty () || m_outFile.is_open ())
     {
       NS_FATAL_ERROR ("only one REM supported per instance of RadioEnvironmentMapHelper");
     }
@@ -193,12 +379,23 @@ RadioEnvironmentMapHelper::Install ()
   m_channel = match.Get (0)->GetObject<SpectrumChannel> ();
   NS_ABORT_MSG_IF (m_channel == 0, "object at " << m_channelPath << "is not of type SpectrumChannel");
 
-  m_outFile.open (m_outputFile.c_str ());
+  std::ios_base::openmode mode = std::ios_base::out;
+  if (m_offline && m_binaryOutput)
+    {
+      mode |= std::ios_base::binary;
+    }
+  m_outFile.open (m_outputFile.c_str (), mode);
   if (!m_outFile.is_open ())
     {
       NS_FATAL_ERROR ("Can't open file " << (m_outputFile));
       return;
     }
+
+  if (m_offline)
+    {
+      Simulator::ScheduleNow (&RadioEnvironmentMapHelper::RunOffline, this);
+      return;
+    }
   
   double startDelay = 0.0026;
 
@@ -351,5 +548,400 @@ RadioEnvironmentMapHelper::Finalize ()
     }
 }
 
+void
+RadioEnvironmentMapHelper::RunOffline ()
+{
+  NS_LOG_FUNCTION (this);
+  m_xStep = (m_xMax - m_xMin)/(m_xRes-1);
+  m_yStep = (m_yMax - m_yMin)/(m_yRes-1);
+
+  DoubleValue maxLossDb;
+  m_channel->GetAttribute ("MaxLossDb", maxLossDb);
+  m_maxLossDb = maxLossDb.Get ();
+
+  FindOfflineTransmitters ();
+  NS_LOG_INFO ("computing the REM of " << m_offlineTransmitters.size () << " transmitters");
+
+  if (m_binaryOutput)
+    {
+      uint32_t xRes = m_xRes;
+      uint32_t yRes = m_yRes;
+      m_outFile.write (REM_BINARY_MAGIC, sizeof (REM_BINARY_MAGIC));
+      m_outFile.write (reinterpret_cast<const char *> (&xRes), sizeof (xRes));
+      m_outFile.write (reinterpret_cast<const char *> (&yRes), sizeof (yRes));
+      m_outFile.write (reinterpret_cast<const char *> (&m_xMin), sizeof (m_xMin));
+      m_outFile.write (reinterpret_cast<const char *> (&m_xMax), sizeof (m_xMax));
+      m_outFile.write (reinterpret_cast<const char *> (&m_yMin), sizeof (m_yMin));
+      m_outFile.write (reinterpret_cast<const char *> (&m_yMax), sizeof (m_yMax));
+      m_outFile.write (reinterpret_cast<const char *> (&m_z), sizeof (m_z));
+    }
+
+  uint32_t nTiles = (m_xRes + m_tileColumns - 1) / m_tileColumns;
+  uint32_t nThreads = m_numThreads;
+  if (nThreads == 0)
+    {
+      nThreads = std::max (std::thread::hardware_concurrency (), 1U);
+    }
+  nThreads = std::max (std::min (nThreads, nTiles), 1U);
+  std::vector<OfflineContext> contexts = CreateOfflineContexts (nThreads);
+  nThreads = contexts.size ();
+  NS_LOG_LOGIC ("computing " << nTiles << " tiles with " << nThreads << " threads");
+
+  if (nThreads == 1)
+    {
+      std::vector<float> values;
+      for (uint32_t tile = 0; tile < nTiles; ++tile)
+        {
+          uint32_t firstColumn = tile * m_tileColumns;
+          uint32_t lastColumn = std::min (firstColumn + m_tileColumns, (uint32_t) m_xRes);
+          ComputeOfflineColumns (contexts[0], firstColumn, lastColumn, values);
+          WriteOfflineColumns (firstColumn, lastColumn, values);
+        }
+      Finalize ();
+      return;
+    }
+
+  // The threads compute the tiles in order, at most maxPendingTiles ahead
+  // of the tile being written, and the calling thread writes them in order.
+  std::mutex mutex;
+  std::condition_variable condition;
+  uint32_t nextTile = 0;
+  uint32_t writtenTiles = 0;
+  uint32_t maxPendingTiles = 2 * nThreads;
+  std::map<uint32_t, std::vector<float> > computedTiles;
+  auto computeTiles = [&] (const OfflineContext &context)
+    {
+      std::unique_lock<std::mutex> lock (mutex);
+      while (true)
+        {
+          condition.wait (lock, [&] { return nextTile >= nTiles || nextTile < writtenTiles + maxPendingTiles; });
+          if (nextTile >= nTiles)
+            {
+              return;
+            }
+          uint32_t tile = nextTile++;
+          lock.unlock ();
+          uint32_t firstColumn = tile * m_tileColumns;
+          uint32_t lastColumn = std::min (firstColumn + m_tileColumns, (uint32_t) m_xRes);
+          std::vector<float> values;
+          ComputeOfflineColumns (context, firstColumn, lastColumn, values);
+          lock.lock ();
+          computedTiles[tile].swap (values);
+          condition.notify_all ();
+        }
+    };
+
+  std::vector<std::thread> threads;
+  for (uint32_t i = 0; i < nThreads; ++i)
+    {
+      threads.push_back (std::thread (computeTiles, std::cref (contexts[i])));
+    }
+  for (uint32_t tile = 0; tile < nTiles; ++tile)
+    {
+      std::vector<float> values;
+      {
+        std::unique_lock<std::mutex> lock (mutex);
+        condition.wait (lock, [&] { return computedTiles.find (tile) != computedTiles.end (); });
+        values.swap (computedTiles[tile]);
+        computedTiles.erase (tile);
+      }
+      uint32_t firstColumn = tile * m_tileColumns;
+      uint32_t lastColumn = std::min (firstColumn + m_tileColumns, (uint32_t) m_xRes);
+      WriteOfflineColumns (firstColumn, lastColumn, values);
+      {
+        std::unique_lock<std::mutex> lock (mutex);
+        ++writtenTiles;
+      }
+      condition.notify_all ();
+    }
+  for (std::vector<std::thread>::iterator it = threads.begin (); it != threads.end (); ++it)
+    {
+      it->join ();
+    }
+  Finalize ();
+}
+
+void
+RadioEnvironmentMapHelper::FindOfflineTransmitters ()
+{
+  NS_LOG_FUNCTION (this);
+  m_offlineTransmitters.clear ();
+  for (NodeList::Iterator nodeIt = NodeList::Begin (); nodeIt != NodeList::End (); ++nodeIt)
+    {
+      for (uint32_t i = 0; i < (*nodeIt)->GetNDevices (); ++i)
+        {
+          Ptr<NetDevice> device = (*nodeIt)->GetDevice (i);
+          Ptr<LteEnbNetDevice> enbDevice = DynamicCast<LteEnbNetDevice> (device);
+          if (enbDevice != 0 && m_includeEnbs)
+            {
+              std::map<uint8_t, Ptr<ComponentCarrierBaseStation> > ccMap = enbDevice->GetCcMap ();
+              for (std::map<uint8_t, Ptr<ComponentCarrierBaseStation> >::iterator ccIt = ccMap.begin ();
+                   ccIt != ccMap.end (); ++ccIt)
+                {
+                  Ptr<LteEnbPhy> phy = DynamicCast<ComponentCarrierEnb> (ccIt->second)->GetPhy ();
+                  std::vector<int> rbs;
+                  for (int rb = 0; rb < ccIt->second->GetDlBandwidth (); ++rb)
+                    {
+                      rbs.push_back (rb);
+                    }
+                  Ptr<SpectrumValue> psd = LteSpectrumValueHelper::CreateTxPowerSpectralDensity (ccIt->second->GetDlEarfcn (),
+                                                                                                 ccIt->second->GetDlBandwidth (),
+                                                                                                 phy->GetTxPower (), rbs);
+                  AddOfflineTransmitter (phy->GetDownlinkSpectrumPhy (), psd);
+                }
+            }
+          Ptr<LteUeNetDevice> ueDevice = DynamicCast<LteUeNetDevice> (device);
+          if (ueDevice != 0 && m_includeSidelinkUes)
+            {
+              std::map<uint8_t, Ptr<ComponentCarrierUe> > ccMap = ueDevice->GetCcMap ();
+              for (std::map<uint8_t, Ptr<ComponentCarrierUe> >::iterator ccIt = ccMap.begin ();
+                   ccIt != ccMap.end (); ++ccIt)
+                {
+                  Ptr<LteUePhy> phy = ccIt->second->GetPhy ();
+                  if (phy->GetSlSpectrumPhy () == 0)
+                    {
+                      continue;
+                    }
+                  std::vector<int> rbs;
+                  for (int rb = 0; rb < m_bandwidth; ++rb)
+                    {
+                      rbs.push_back (rb);
+                    }
+                  Ptr<SpectrumValue> psd = LteSpectrumValueHelper::CreateTxPowerSpectralDensity (m_earfcn, m_bandwidth,
+                                                                                                 phy->GetTxPower (), rbs);
+                  AddOfflineTransmitter (phy->GetSlSpectrumPhy (), psd);
+                }
+            }
+        }
+    }
+}
+
+void
+RadioEnvironmentMapHelper::AddOfflineTransmitter (Ptr<LteSpectrumPhy> phy, Ptr<SpectrumValue> psd)
+{
+  NS_LOG_FUNCTION (this << phy << psd);
+  if (phy->GetChannel () != m_channel)
+    {
+      return;
+    }
+  Ptr<const SpectrumModel> spectrumModel = LteSpectrumValueHelper::GetSpectrumModel (m_earfcn, m_bandwidth);
+  if (psd->GetSpectrumModelUid () != spectrumModel->GetUid ())
+    {
+      SpectrumConverter converter (psd->GetSpectrumModel (), spectrumModel);
+      psd = converter.Convert (psd);
+    }
+  OfflineTransmitter transmitter;
+  transmitter.mobility = phy->GetMobility ();
+  NS_ABORT_MSG_IF (transmitter.mobility == 0, "transmitter " << phy << " has no mobility model");
+  transmitter.antenna = phy->GetRxAntenna ();
+  transmitter.psd = psd;
+  transmitter.power = CalcRemPower (*psd, m_rbId);
+  transmitter.rsrp = CalcRemRsrp (*psd, m_rbId);
+  m_offlineTransmitters.push_back (transmitter);
+}
+
+std::vector<RadioEnvironmentMapHelper::OfflineContext>
+RadioEnvironmentMapHelper::CreateOfflineContexts (uint32_t nThreads)
+{
+  NS_LOG_FUNCTION (this << nThreads);
+  Ptr<PropagationLossModel> propagationLoss = m_channel->GetPropagationLossModel ();
+  Ptr<SpectrumPropagationLossModel> spectrumPropagationLoss = m_channel->GetSpectrumPropagationLossModel ();
+  bool hasBuildings = BuildingList::GetNBuildings () > 0;
+
+  std::vector<OfflineContext> contexts;
+  if (nThreads > 1 && !hasBuildings && spectrumPropagationLoss == 0)
+    {
+      // Each thread uses its own copies of the models, as the models and
+      // the reference counts of the objects are not thread safe.
+      for (uint32_t i = 0; i < nThreads; ++i)
+        {
+          OfflineContext context;
+          if (propagationLoss != 0)
+            {
+              context.propagationLoss = CopyPropagationLossModel (propagationLoss);
+              if (context.propagationLoss == 0)
+                {
+                  contexts.clear ();
+                  break;
+                }
+            }
+          for (std::vector<OfflineTransmitter>::const_iterator it = m_offlineTransmitters.begin ();
+               it != m_offlineTransmitters.end (); ++it)
+            {
+              bool withBuildingInfo = it->mobility->GetObject<MobilityBuildingInfo> () != 0;
+              context.txMobility.push_back (CreateOfflineMobility (it->mobility->GetPosition (), withBuildingInfo));
+            }
+          context.rxMobility = CreateOfflineMobility (Vector (m_xMin, m_yMin, m_z), true);
+          context.makeConsistent = false;
+          contexts.push_back (context);
+        }
+      if (!contexts.empty ())
+        {
+          return contexts;
+        }
+    }
+
+  if (nThreads > 1)
+    {
+      NS_LOG_WARN ("the loss models cannot be evaluated concurrently, the REM is computed by a single thread");
+    }
+  OfflineContext context;
+  context.propagationLoss = propagationLoss;
+  context.spectrumPropagationLoss = spectrumPropagationLoss;
+  for (std::vector<OfflineTransmitter>::const_iterator it = m_offlineTransmitters.begin ();
+       it != m_offlineTransmitters.end (); ++it)
+    {
+      context.txMobility.push_back (it->mobility);
+    }
+  context.rxMobility = CreateOfflineMobility (Vector (m_xMin, m_yMin, m_z), true);
+  context.makeConsistent = hasBuildings;
+  contexts.push_back (context);
+  return contexts;
+}
+
+void
+RadioEnvironmentMapHelper::ComputeOfflineColumns (const OfflineContext &context, uint32_t firstColumn,
+                                                  uint32_t lastColumn, std::vector<float> &values) const
+{
+  values.resize (2 * (lastColumn - firstColumn) * m_yRes);
+  std::vector<float>::iterator valueIt = values.begin ();
+  for (uint32_t i = firstColumn; i < lastColumn; ++i)
+    {
+      for (uint32_t j = 0; j < m_yRes; ++j)
+        {
+          Vector rxPosition (m_xMin + i * m_xStep, m_yMin + j * m_yStep, m_z);
+          context.rxMobility->SetPosition (rxPosition);
+          if (context.makeConsistent)
+            {
+              BuildingsHelper::MakeConsistent (context.rxMobility);
+            }
+
+          // same operations as the channel and the RemSpectrumPhy
+          double sumPower = 0;
+          double referencePower = 0;
+          double referenceRsrp = 0;
+          for (uint32_t k = 0; k < m_offlineTransmitters.size (); ++k)
+            {
+              const OfflineTransmitter &transmitter = m_offlineTransmitters[k];
+              const Ptr<MobilityModel> &txMobility = context.txMobility[k];
+              double pathLossDb = 0;
+              if (transmitter.antenna != 0)
+                {
+                  Angles txAngles (rxPosition, txMobility->GetPosition ());
+                  pathLossDb -= transmitter.antenna->GetGainDb (txAngles);
+                }
+              if (context.propagationLoss != 0)
+                {
+                  pathLossDb -= context.propagationLoss->CalcRxPower (0, txMobility, context.rxMobility);
+                }
+              if (pathLossDb > m_maxLossDb)
+                {
+                  continue;
+                }
+              double pathGainLinear = std::pow (10.0, (-pathLossDb) / 10.0);
+              double power = transmitter.power * pathGainLinear;
+              double rsrp = transmitter.rsrp * pathGainLinear;
+              if (context.spectrumPropagationLoss != 0)
+                {
+                  Ptr<SpectrumValue> rxPsd = context.spectrumPropagationLoss->CalcRxPowerSpectralDensity (transmitter.psd, txMobility,
+                                                                                                           context.rxMobility);
+                  *rxPsd *= pathGainLinear;
+                  power = CalcRemPower (*rxPsd, m_rbId);
+                  rsrp = CalcRemRsrp (*rxPsd, m_rbId);
+                }
+              sumPower += power;
+              if (power > referencePower)
+                {
+                  referencePower = power;
+                  referenceRsrp = rsrp;
+                }
+            }
+          *valueIt++ = referencePower / (sumPower - referencePower + m_noisePower);
+          *valueIt++ = 10 * std::log10 (referenceRsrp) + 30;
+        }
+    }
+}
+
+void
+RadioEnvironmentMapHelper::WriteOfflineColumns (uint32_t firstColumn, uint32_t lastColumn,
+                                                const std::vector<float> &values)
+{
+  NS_LOG_FUNCTION (this << firstColumn << lastColumn);
+  if (m_binaryOutput)
+    {
+      m_outFile.write (reinterpret_cast<const char *> (values.data ()), values.size () * sizeof (float));
+      return;
+    }
+  std::vector<float>::const_iterator valueIt = values.begin ();
+  for (uint32_t i = firstColumn; i < lastColumn; ++i)
+    {
+      for (uint32_t j = 0; j < m_yRes; ++j)
+        {
+          m_outFile << m_xMin + i * m_xStep << "\t"
+                    << m_yMin + j * m_yStep << "\t"
+                    << m_z << "\t"
+                    << *valueIt << "\t"
+                    << *(valueIt + 1) << "\n";
+          valueIt += 2;
+        }
+    }
+}
+
+void
+RadioEnvironmentMapHelper::ConvertBinaryToText (std::string binaryFilename, std::string textFilename)
+{
+  NS_LOG_FUNCTION (binaryFilename << textFilename);
+  std::ifstream inFile (binaryFilename.c_str (), std::ios_base::in | std::ios_base::binary);
+  if (!inFile.is_open ())
+    {
+      NS_FATAL_ERROR ("Can't open file " << binaryFilename);
+    }
+  char magic[sizeof (REM_BINARY_MAGIC)];
+  uint32_t xRes;
+  uint32_t yRes;
+  double xMin;
+  double xMax;
+  double yMin;
+  double yMax;
+  double z;
+  inFile.read (magic, sizeof (magic));
+  inFile.read (reinterpret_cast<char *> (&xRes), sizeof (xRes));
+  inFile.read (reinterpret_cast<char *> (&yRes), sizeof (yRes));
+  inFile.read (reinterpret_cast<char *> (&xMin), sizeof (xMin));
+  inFile.read (reinterpret_cast<char *> (&xMax), sizeof (xMax));
+  inFile.read (reinterpret_cast<char *> (&yMin), sizeof (yMin));
+  inFile.read (reinterpret_cast<char *> (&yMax), sizeof (yMax));
+  inFile.read (reinterpret_cast<char *> (&z), sizeof (z));
+  if (!inFile || std::string (magic, sizeof (magic)) != std::string (REM_BINARY_MAGIC, sizeof (REM_BINARY_MAGIC)))
+    {
+      NS_FATAL_ERROR ("File " << binaryFilename << " is not a binary REM");
+    }
+
+  std::ofstream outFile (textFilename.c_str ());
+  if (!outFile.is_open ())
+    {
+      NS_FATAL_ERROR ("Can't open file " << textFilename);
+    }
+  double xStep = (xMax - xMin) / (xRes - 1);
+  double yStep = (yMax - yMin) / (yRes - 1);
+  std::vector<float> column (2 * yRes);
+  for (uint32_t i = 0; i < xRes; ++i)
+    {
+      inFile.read (reinterpret_cast<char *> (column.data ()), column.size () * sizeof (float));
+      if (!inFile)
+        {
+          NS_FATAL_ERROR ("File " << binaryFilename << " is truncated at column " << i);
+        }
+      for (uint32_t j = 0; j < yRes; ++j)
+        {
+          outFile << xMin + i * xStep << "\t"
+                  << yMin + j * yStep << "\t"
+                  << z << "\t"
+                  << column[2 * j] << "\t"
+                  << column[2 * j + 1] << "\n";
+        }
+    }
+}
+
 
 } // namespace ns3
@@ -25,6 +25,7 @@
 
 #include <ns3/object.h>
 #include <fstream>
+#include <vector>
 
 
 namespace ns3 {
@@ -35,6 +36,11 @@ class NetDevice;
 class SpectrumChannel;
 //class BuildingsMobilityModel;
 class MobilityModel;
+class AntennaModel;
+class SpectrumValue;
+class LteSpectrumPhy;
+class PropagationLossModel;
+class SpectrumPropagationLossModel;
 
 /** 
  * \ingroup lte
@@ -42,6 +48,13 @@ class MobilityModel;
  * Generates a 2D map of the SINR from the strongest transmitter in the
  * downlink of an LTE FDD system. For instructions on usage, please refer to
  * the User Documentation.
+ *
+ * If the `Offline` attribute is true, the map is computed directly from the
+ * transmitters attached to the channel and the loss models of the channel,
+ * instead of simulating a listener for each point. The points are then
+ * evaluated by a pool of threads, a tile of columns at a time, and the tiles
+ * are written in order as they are completed, either as text or as a binary
+ * raster (see ConvertBinaryToText).
  */
 class RadioEnvironmentMapHelper : public Object
 {
@@ -75,6 +88,18 @@ public:
    */
   void Install ();
 
+  /**
+   * Convert a map written by the offline engine as a binary raster (see the
+   * `BinaryOutput` attribute) to the text format of the offline engine,
+   * i.e., one line per point with the x, y and z coordinates, the SINR in
+   * linear units and the RSRP of the strongest transmitter in dBm. The
+   * binary file must have been written on a host with the same byte order.
+   *
+   * \param binaryFilename the name of the binary file to read
+   * \param textFilename the name of the text file to write
+   */
+  static void ConvertBinaryToText (std::string binaryFilename, std::string textFilename);
+
 private:
 
   /**
@@ -108,6 +133,98 @@ private:
   /// Called when the map generation procedure has been completed.
   void Finalize ();
 
+  /// A transmitter evaluated by the offline engine.
+  struct OfflineTransmitter
+  {
+    /// Position of the transmitter.
+    Ptr<MobilityModel> mobility;
+    /// Antenna of the transmitter, or 0 for an isotropic antenna.
+    Ptr<AntennaModel> antenna;
+    /// Transmitted PSD, converted to the spectrum model of the map.
+    Ptr<SpectrumValue> psd;
+    /// Power of the PSD, in W, as computed by the RemSpectrumPhy.
+    double power;
+    /// Power of the PSD per resource element, in W, for the RSRP.
+    double rsrp;
+  };
+
+  /**
+   * The models used by a thread of the offline engine. The thread is the
+   * only user of the objects of its context, except of the models of the
+   * channel and of the mobility models of the transmitters, which are only
+   * used when the map is evaluated by the calling thread alone.
+   */
+  struct OfflineContext
+  {
+    /// Single-frequency loss model of the channel, or a copy of it.
+    Ptr<PropagationLossModel> propagationLoss;
+    /// Frequency-dependent loss model of the channel.
+    Ptr<SpectrumPropagationLossModel> spectrumPropagationLoss;
+    /// Mobility models of the transmitters, or copies of them.
+    std::vector<Ptr<MobilityModel> > txMobility;
+    /// Position of the point being evaluated.
+    Ptr<MobilityModel> rxMobility;
+    /// True if the building info of the point is updated at each point.
+    bool makeConsistent;
+  };
+
+  /**
+   * Scheduled by Install() when the `Offline` attribute is true, to compute
+   * the whole map directly from the transmitters and the loss models of the
+   * channel, then call Finalize().
+   */
+  void RunOffline ();
+
+  /**
+   * Collect in m_offlineTransmitters the eNBs and/or the Sidelink UEs that
+   * transmit on the channel of the map, according to the `IncludeEnbs` and
+   * `IncludeSidelinkUes` attributes.
+   */
+  void FindOfflineTransmitters ();
+
+  /**
+   * Add a transmitter to m_offlineTransmitters if it is attached to the
+   * channel of the map.
+   *
+   * \param phy the spectrum phy of the transmitter
+   * \param psd the PSD transmitted
+   */
+  void AddOfflineTransmitter (Ptr<LteSpectrumPhy> phy, Ptr<SpectrumValue> psd);
+
+  /**
+   * Create the contexts of the threads of the offline engine. When the
+   * models cannot be evaluated concurrently, e.g., the scenario has
+   * buildings or the channel has a frequency-dependent loss model, a
+   * single context using the models of the channel is created.
+   *
+   * \param nThreads the number of threads requested
+   * \return the contexts, one per thread
+   */
+  std::vector<OfflineContext> CreateOfflineContexts (uint32_t nThreads);
+
+  /**
+   * Compute the SINR and the RSRP of a tile of columns of the map. This
+   * function may be called concurrently by several threads, each with its
+   * own context, hence it does not log.
+   *
+   * \param context the models used by the calling thread
+   * \param firstColumn the index of the first column of the tile
+   * \param lastColumn the index following the last column of the tile
+   * \param values the SINR and RSRP of each point, column by column
+   */
+  void ComputeOfflineColumns (const OfflineContext &context, uint32_t firstColumn,
+                              uint32_t lastColumn, std::vector<float> &values) const;
+
+  /**
+   * Write a tile of columns of the map to the output file.
+   *
+   * \param firstColumn the index of the first column of the tile
+   * \param lastColumn the index following the last column of the tile
+   * \param values the SINR and RSRP of each point, column by column
+   */
+  void WriteOfflineColumns (uint32_t firstColumn, uint32_t lastColumn,
+                            const std::vector<float> &values);
+
   /// A complete Radio Environment Map is composed of many of this structure.
   struct RemPoint 
   {
@@ -152,6 +269,18 @@ private:
   bool m_useDataChannel;  ///< The `UseDataChannel` attribute.
   int32_t m_rbId;         ///< The `RbId` attribute.
 
+  bool m_offline;                 ///< The `Offline` attribute.
+  uint32_t m_numThreads;          ///< The `NumThreads` attribute.
+  uint32_t m_tileColumns;         ///< The `TileColumns` attribute.
+  bool m_binaryOutput;            ///< The `BinaryOutput` attribute.
+  bool m_includeEnbs;             ///< The `IncludeEnbs` attribute.
+  bool m_includeSidelinkUes;      ///< The `IncludeSidelinkUes` attribute.
+
+  /// The maximum loss of the channel, above which a signal is not received.
+  double m_maxLossDb;
+  /// The transmitters evaluated by the offline engine.
+  std::vector<OfflineTransmitter> m_offlineTransmitters;
+
 }; // end of `class RadioEnvironmentMapHelper`
 
 
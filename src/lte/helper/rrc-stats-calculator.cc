@@ -89,27 +89,17 @@ RrcStatsCalculator::RrcDiscoveryMonitoring (uint64_t imsi, uint16_t cellId, uint
 {
   NS_LOG_INFO ("Writing Discovery Monitoring Stats in "<< GetSlDiscRrcOutputFilename ().c_str ());
 
-  std::ofstream outFile;
+  std::ostream &outFile = GetOutputStream (GetSlDiscRrcOutputFilename (), m_discoveryMonitoringRrcFirstWrite);
+  if (!outFile)
+    {
+      NS_LOG_ERROR ("Can't open file " << GetSlDiscRrcOutputFilename ().c_str ());
+      return;
+    }
   if (m_discoveryMonitoringRrcFirstWrite == true )
     {
-      outFile.open (GetSlDiscRrcOutputFilename ().c_str ());
-      if (!outFile.is_open ())
-        {
-          NS_LOG_ERROR ("Can't open file " << GetSlDiscRrcOutputFilename ().c_str ());
-          return;
-        }
       m_discoveryMonitoringRrcFirstWrite = false;
       outFile << "Time\tIMSI\tCellId\tRNTI\tDiscType\tContentType\tDiscModel\tContent" << std::endl;
     }
-  else
-    {
-      outFile.open (GetSlDiscRrcOutputFilename ().c_str (),  std::ios_base::app);
-      if (!outFile.is_open ())
-        {
-          NS_LOG_ERROR ("Can't open file " << GetSlDiscRrcOutputFilename ().c_str ());
-          return;
-        }
-    }
 
 
   outFile << Simulator::Now ().GetMilliSeconds () << "\t" << imsi << "\t" << cellId << "\t" << rnti << "\t";
@@ -141,9 +131,9 @@ RrcStatsCalculator::RrcDiscoveryMonitoring (uint64_t imsi, uint16_t cellId, uint
 }
 
 void
-RrcStatsCalculator::DiscoveryMonitoringRrcTraceCallback (Ptr<RrcStatsCalculator> rrcStats, std::string path, uint64_t imsi, uint16_t cellId, uint16_t rnti, LteSlDiscHeader discMsg)
+RrcStatsCalculator::DiscoveryMonitoringRrcTraceCallback (Ptr<RrcStatsCalculator> rrcStats, Ptr<const Config::TraceContext> context, uint64_t imsi, uint16_t cellId, uint16_t rnti, LteSlDiscHeader discMsg)
 {
-  NS_LOG_FUNCTION (rrcStats << path);
+  NS_LOG_FUNCTION (rrcStats << context->GetPath ());
 
   rrcStats->RrcDiscoveryMonitoring (imsi, cellId, rnti, discMsg);
 }
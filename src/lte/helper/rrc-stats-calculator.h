@@ -74,13 +74,13 @@ public:
    * Trace sink for the ns3::LteUeRrc::DiscoveryMonitoring trace source
    *
    * \param rrcStats
-   * \param path
+   * \param context The context of the trace source
    * \param imsi
    * \param cellId
    * \param rnti
    * \param discMsg
    */
-  static void DiscoveryMonitoringRrcTraceCallback (Ptr<RrcStatsCalculator> rrcStats, std::string path, uint64_t imsi, uint16_t cellId, uint16_t rnti, LteSlDiscHeader discMsg);
+  static void DiscoveryMonitoringRrcTraceCallback (Ptr<RrcStatsCalculator> rrcStats, Ptr<const Config::TraceContext> context, uint64_t imsi, uint16_t cellId, uint16_t rnti, LteSlDiscHeader discMsg);
 
   /**
    * Notifies the stats calculator that a RRC has received a Sidelink discovery message.
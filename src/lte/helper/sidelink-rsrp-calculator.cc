@@ -40,7 +40,14 @@
 #include <ns3/log.h>
 #include <ns3/abort.h>
 #include <ns3/angles.h>
+#include <ns3/isotropic-antenna-model.h>
 #include <cfloat>
+#include <algorithm>
+#include <thread>
+
+#if defined (__AVX__) || defined (__SSE2__)
+#include <immintrin.h>
+#endif
 
 namespace ns3 {
 
@@ -95,18 +102,17 @@ SidelinkRsrpCalculator::DoDispose ()
 }
 
 
-double
-SidelinkRsrpCalculator::CalcSlRsrpPsbch (Ptr<PropagationLossModel> lossModel, double txPower, double ulEarfcn, double ulBandwidth, Ptr<SpectrumPhy> txPhy, Ptr<SpectrumPhy> rxPhy)
+/**
+ * Create the PSD of the reference signal used for the S-RSRP defined in TS 36.214,
+ * i.e., in the central 6 PRBs
+ * \param txPower Transmit power for the reference signal
+ * \param ulEarfcn Uplink frequency
+ * \param ulBandwidth Uplink bandwidth
+ * \return The PSD
+ */
+static Ptr<SpectrumValue>
+CreatePsbchPsd (double txPower, double ulEarfcn, double ulBandwidth)
 {
-
-  NS_ASSERT_MSG (lossModel != 0, "No PropagationLossModel provided");
-
-  /*
-    36.214: Sidelink Reference Signal Received Power (S-RSRP) is defined as the linear average over the
-    power contributions (in [W]) of the resource elements that carry demodulation reference signals
-    associated with PSBCH, within the central 6 PRBs of the applicable subframes.
-  */
-  //This method returned very low values of RSRP
   std::vector <int> rbMask;
   int indexLowerRb = 0;
   int indexUpperRb = 0;
@@ -125,7 +131,61 @@ SidelinkRsrpCalculator::CalcSlRsrpPsbch (Ptr<PropagationLossModel> lossModel, do
       rbMask.push_back (i);
     }
   LteSpectrumValueHelper psdHelper;
-  Ptr<SpectrumValue> psd = psdHelper.CreateUlTxPowerSpectralDensity (ulEarfcn, ulBandwidth, txPower, rbMask);
+  return psdHelper.CreateUlTxPowerSpectralDensity (ulEarfcn, ulBandwidth, txPower, rbMask);
+}
+
+SidelinkRsrpMatrix::SidelinkRsrpMatrix ()
+  : m_nTx (0),
+    m_nRx (0)
+{
+}
+
+SidelinkRsrpMatrix::SidelinkRsrpMatrix (uint32_t nTx, uint32_t nRx)
+  : m_nTx (nTx),
+    m_nRx (nRx),
+    m_values (static_cast<std::size_t> (nTx) * nRx, 0)
+{
+}
+
+uint32_t
+SidelinkRsrpMatrix::GetNTx (void) const
+{
+  return m_nTx;
+}
+
+uint32_t
+SidelinkRsrpMatrix::GetNRx (void) const
+{
+  return m_nRx;
+}
+
+double
+SidelinkRsrpMatrix::Get (uint32_t tx, uint32_t rx) const
+{
+  NS_ASSERT_MSG (tx < m_nTx && rx < m_nRx, "Invalid pair " << tx << " -> " << rx);
+  return m_values[static_cast<std::size_t> (rx) * m_nTx + tx];
+}
+
+void
+SidelinkRsrpMatrix::Set (uint32_t tx, uint32_t rx, double rsrp)
+{
+  NS_ASSERT_MSG (tx < m_nTx && rx < m_nRx, "Invalid pair " << tx << " -> " << rx);
+  m_values[static_cast<std::size_t> (rx) * m_nTx + tx] = rsrp;
+}
+
+double
+SidelinkRsrpCalculator::CalcSlRsrpPsbch (Ptr<PropagationLossModel> lossModel, double txPower, double ulEarfcn, double ulBandwidth, Ptr<SpectrumPhy> txPhy, Ptr<SpectrumPhy> rxPhy)
+{
+
+  NS_ASSERT_MSG (lossModel != 0, "No PropagationLossModel provided");
+
+  /*
+    36.214: Sidelink Reference Signal Received Power (S-RSRP) is defined as the linear average over the
+    power contributions (in [W]) of the resource elements that carry demodulation reference signals
+    associated with PSBCH, within the central 6 PRBs of the applicable subframes.
+  */
+  //This method returned very low values of RSRP
+  Ptr<SpectrumValue> psd = CreatePsbchPsd (txPower, ulEarfcn, ulBandwidth);
 
   double rsrp = DoCalcRsrp (lossModel, psd, txPhy, rxPhy);
 
@@ -250,5 +310,456 @@ SidelinkRsrpCalculator::DoCalcRsrp (Ptr<PropagationLossModel> propagationLoss, d
   return rsrp;
 }
 
+namespace {
+
+/// The loss models evaluated in closed form by the bulk functions
+enum ClosedFormModel
+{
+  NO_CLOSED_FORM,
+  FRIIS_CLOSED_FORM,
+  LOG_DISTANCE_CLOSED_FORM
+};
+
+/// Parameters of the closed form loss models
+struct ClosedFormParameters
+{
+  ClosedFormModel model; ///< The loss model
+  double lambda; ///< Wavelength of the Friis model
+  double systemLoss; ///< System loss of the Friis model
+  double minLoss; ///< Minimum loss of the Friis model
+  double exponent; ///< Path loss exponent of the log distance model
+  double referenceDistance; ///< Reference distance of the log distance model
+  double referenceLoss; ///< Reference loss of the log distance model
+};
+
+/// The positions and antenna gains of a set of UEs, stored by coordinate
+struct BulkUes
+{
+  std::vector<double> x; ///< The x coordinates
+  std::vector<double> y; ///< The y coordinates
+  std::vector<double> z; ///< The z coordinates
+  std::vector<double> gainDb; ///< The antenna gains in dB
+  std::vector<bool> hasAntenna; ///< Whether a UE has an antenna
+};
+
+/**
+ * Identify the loss models that can be evaluated in closed form, i.e., a
+ * single Friis or log distance model without next model
+ * \param lossModel The loss model
+ * \param [out] parameters The parameters of the model
+ * \return true if the model can be evaluated in closed form
+ */
+bool
+GetClosedFormParameters (Ptr<PropagationLossModel> lossModel, ClosedFormParameters &parameters)
+{
+  parameters.model = NO_CLOSED_FORM;
+  if (lossModel == 0 || lossModel->GetNext () != 0)
+    {
+      return false;
+    }
+  if (lossModel->GetInstanceTypeId () == FriisPropagationLossModel::GetTypeId ())
+    {
+      Ptr<FriisPropagationLossModel> friis = DynamicCast<FriisPropagationLossModel> (lossModel);
+      // same computation as FriisPropagationLossModel::SetFrequency
+      static const double C = 299792458.0; // speed of light in vacuum
+      parameters.model = FRIIS_CLOSED_FORM;
+      parameters.lambda = C / friis->GetFrequency ();
+      parameters.systemLoss = friis->GetSystemLoss ();
+      parameters.minLoss = friis->GetMinLoss ();
+      return true;
+    }
+  if (lossModel->GetInstanceTypeId () == LogDistancePropagationLossModel::GetTypeId ())
+    {
+      Ptr<LogDistancePropagationLossModel> logDistance = DynamicCast<LogDistancePropagationLossModel> (lossModel);
+      DoubleValue referenceDistance;
+      DoubleValue referenceLoss;
+      logDistance->GetAttribute ("ReferenceDistance", referenceDistance);
+      logDistance->GetAttribute ("ReferenceLoss", referenceLoss);
+      parameters.model = LOG_DISTANCE_CLOSED_FORM;
+      parameters.exponent = logDistance->GetPathLossExponent ();
+      parameters.referenceDistance = referenceDistance.Get ();
+      parameters.referenceLoss = referenceLoss.Get ();
+      return true;
+    }
+  return false;
+}
+
+/**
+ * Collect the positions and the antenna gains of a set of UEs
+ * \param phys The UEs
+ * \param [out] ues The positions and antenna gains
+ * \return true if all the antennas are isotropic, i.e., if the closed form
+ *         evaluation is possible
+ */
+bool
+GetBulkUes (const std::vector<Ptr<SpectrumPhy> > &phys, BulkUes &ues)
+{
+  ues.x.resize (phys.size ());
+  ues.y.resize (phys.size ());
+  ues.z.resize (phys.size ());
+  ues.gainDb.resize (phys.size ());
+  ues.hasAntenna.resize (phys.size ());
+  for (std::size_t i = 0; i < phys.size (); i++)
+    {
+      Vector position = phys[i]->GetMobility ()->GetPosition ();
+      ues.x[i] = position.x;
+      ues.y[i] = position.y;
+      ues.z[i] = position.z;
+      Ptr<AntennaModel> antenna = phys[i]->GetRxAntenna ();
+      ues.hasAntenna[i] = (antenna != 0);
+      ues.gainDb[i] = 0;
+      if (antenna != 0)
+        {
+          if (antenna->GetInstanceTypeId () != IsotropicAntennaModel::GetTypeId ())
+            {
+              return false;
+            }
+          ues.gainDb[i] = antenna->GetGainDb (Angles ());
+        }
+    }
+  return true;
+}
+
+/**
+ * Compute the distances from a receiver to a set of transmitters, with the
+ * same operations as CalculateDistance so that the results are identical
+ * \param distance The distances
+ * \param txX The x coordinates of the transmitters
+ * \param txY The y coordinates of the transmitters
+ * \param txZ The z coordinates of the transmitters
+ * \param rxX The x coordinate of the receiver
+ * \param rxY The y coordinate of the receiver
+ * \param rxZ The z coordinate of the receiver
+ * \param n The number of transmitters
+ */
+void
+CalcDistances (double *distance, const double *txX, const double *txY, const double *txZ,
+               double rxX, double rxY, double rxZ, std::size_t n)
+{
+  std::size_t i = 0;
+#if defined (__AVX__)
+  __m256d rx4 = _mm256_set1_pd (rxX);
+  __m256d ry4 = _mm256_set1_pd (rxY);
+  __m256d rz4 = _mm256_set1_pd (rxZ);
+  for (; i + 4 <= n; i += 4)
+    {
+      __m256d dx = _mm256_sub_pd (rx4, _mm256_loadu_pd (txX + i));
+      __m256d dy = _mm256_sub_pd (ry4, _mm256_loadu_pd (txY + i));
+      __m256d dz = _mm256_sub_pd (rz4, _mm256_loadu_pd (txZ + i));
+      __m256d d2 = _mm256_add_pd (_mm256_add_pd (_mm256_mul_pd (dx, dx), _mm256_mul_pd (dy, dy)), _mm256_mul_pd (dz, dz));
+      _mm256_storeu_pd (distance + i, _mm256_sqrt_pd (d2));
+    }
+#endif
+#if defined (__SSE2__)
+  __m128d rx2 = _mm_set1_pd (rxX);
+  __m128d ry2 = _mm_set1_pd (rxY);
+  __m128d rz2 = _mm_set1_pd (rxZ);
+  for (; i + 2 <= n; i += 2)
+    {
+      __m128d dx = _mm_sub_pd (rx2, _mm_loadu_pd (txX + i));
+      __m128d dy = _mm_sub_pd (ry2, _mm_loadu_pd (txY + i));
+      __m128d dz = _mm_sub_pd (rz2, _mm_loadu_pd (txZ + i));
+      __m128d d2 = _mm_add_pd (_mm_add_pd (_mm_mul_pd (dx, dx), _mm_mul_pd (dy, dy)), _mm_mul_pd (dz, dz));
+      _mm_storeu_pd (distance + i, _mm_sqrt_pd (d2));
+    }
+#endif
+  for (; i < n; i++)
+    {
+      double dx = rxX - txX[i];
+      double dy = rxY - txY[i];
+      double dz = rxZ - txZ[i];
+      distance[i] = std::sqrt (dx * dx + dy * dy + dz * dz);
+    }
+}
+
+/**
+ * Compute the propagation gains, in dB, of the closed form models, with the
+ * same operations as the DoCalcRxPower function of the models with a
+ * transmit power of 0 dBm
+ * \param gain The gains, computed in place from the distances
+ * \param n The number of values
+ * \param parameters The parameters of the model
+ */
+void
+CalcClosedFormGains (double *gain, std::size_t n, const ClosedFormParameters &parameters)
+{
+  if (parameters.model == FRIIS_CLOSED_FORM)
+    {
+      double numerator = parameters.lambda * parameters.lambda;
+      for (std::size_t i = 0; i < n; i++)
+        {
+          double distance = gain[i];
+          if (distance <= 0)
+            {
+              gain[i] = 0 - parameters.minLoss;
+              continue;
+            }
+          double denominator = 16 * M_PI * M_PI * distance * distance * parameters.systemLoss;
+          double lossDb = -10 * std::log10 (numerator / denominator);
+          gain[i] = 0 - std::max (lossDb, parameters.minLoss);
+        }
+    }
+  else
+    {
+      for (std::size_t i = 0; i < n; i++)
+        {
+          double distance = gain[i];
+          if (distance <= parameters.referenceDistance)
+            {
+              gain[i] = 0 - parameters.referenceLoss;
+              continue;
+            }
+          double pathLossDb = 10 * parameters.exponent * std::log10 (distance / parameters.referenceDistance);
+          double rxc = -parameters.referenceLoss - pathLossDb;
+          gain[i] = 0 + rxc;
+        }
+    }
+}
+
+} // unnamed namespace
+
+double
+SidelinkRsrpCalculator::CalcPsbchReferencePower (double txPower, double ulEarfcn, double ulBandwidth)
+{
+  Ptr<SpectrumValue> psd = CreatePsbchPsd (txPower, ulEarfcn, ulBandwidth);
+
+  // same average as DoCalcRsrp, without path loss
+  double sum = 0.0;
+  uint8_t rbNum = 0;
+  for (Values::const_iterator it = psd->ConstValuesBegin (); it != psd->ConstValuesEnd (); it++)
+    {
+      if ((*it))
+        {
+          double powerTxW = ((*it) * 180000.0) / 12.0;
+          sum += powerTxW;
+          rbNum++;
+        }
+    }
+  double rsrp = (rbNum > 0) ? (sum / rbNum) : DBL_MAX;
+  return 10 * std::log10 (rsrp) + 30;
+}
+
+void
+SidelinkRsrpCalculator::DoCalcRsrpRows (Ptr<PropagationLossModel> propagationLoss, double txPower,
+                                        const std::vector<Ptr<SpectrumPhy> >& txPhys, const std::vector<Ptr<SpectrumPhy> >& rxPhys,
+                                        uint32_t nThreads, const RsrpRowCallback &callback)
+{
+  NS_LOG_FUNCTION (propagationLoss << txPower << txPhys.size () << rxPhys.size () << nThreads);
+
+  ClosedFormParameters parameters;
+  BulkUes txUes;
+  BulkUes rxUes;
+  bool closedForm = GetClosedFormParameters (propagationLoss, parameters)
+    && GetBulkUes (txPhys, txUes)
+    && GetBulkUes (rxPhys, rxUes);
+
+  if (!closedForm)
+    {
+      NS_LOG_LOGIC ("evaluating the pairs through the loss model");
+      std::vector<double> row (txPhys.size ());
+      for (uint32_t rx = 0; rx < rxPhys.size (); rx++)
+        {
+          for (uint32_t tx = 0; tx < txPhys.size (); tx++)
+            {
+              row[tx] = DoCalcRsrp (propagationLoss, txPower, txPhys[tx], rxPhys[rx]);
+            }
+          callback (rx, row.data ());
+        }
+      return;
+    }
+
+  uint32_t nTx = txPhys.size ();
+  uint32_t nRx = rxPhys.size ();
+  auto calcRows = [&] (uint32_t firstRx, uint32_t lastRx)
+    {
+      std::vector<double> row (nTx);
+      for (uint32_t rx = firstRx; rx < lastRx; rx++)
+        {
+          CalcDistances (row.data (), txUes.x.data (), txUes.y.data (), txUes.z.data (),
+                         rxUes.x[rx], rxUes.y[rx], rxUes.z[rx], nTx);
+          CalcClosedFormGains (row.data (), nTx, parameters);
+          for (uint32_t tx = 0; tx < nTx; tx++)
+            {
+              // same operations as DoCalcRsrp
+              double pathLossDb = 0;
+              if (txUes.hasAntenna[tx])
+                {
+                  pathLossDb -= txUes.gainDb[tx];
+                }
+              if (rxUes.hasAntenna[rx])
+                {
+                  pathLossDb -= rxUes.gainDb[rx];
+                }
+              pathLossDb -= row[tx];
+              row[tx] = txPower - pathLossDb;
+            }
+          callback (rx, row.data ());
+        }
+    };
+
+  if (nThreads == 0)
+    {
+      nThreads = std::max (std::thread::hardware_concurrency (), 1U);
+    }
+  nThreads = std::max (std::min (nThreads, nRx), 1U);
+  NS_LOG_LOGIC ("evaluating the pairs in closed form with " << nThreads << " threads");
+
+  std::vector<std::thread> threads;
+  uint32_t rowsPerThread = nRx / nThreads;
+  uint32_t extraRows = nRx % nThreads;
+  uint32_t firstRx = 0;
+  for (uint32_t i = 0; i < nThreads; i++)
+    {
+      uint32_t lastRx = firstRx + rowsPerThread + (i < extraRows ? 1 : 0);
+      if (i == nThreads - 1)
+        {
+          // the calling thread takes the last rows
+          calcRows (firstRx, lastRx);
+        }
+      else
+        {
+          threads.push_back (std::thread (calcRows, firstRx, lastRx));
+        }
+      firstRx = lastRx;
+    }
+  for (std::vector<std::thread>::iterator it = threads.begin (); it != threads.end (); it++)
+    {
+      it->join ();
+    }
+}
+
+SidelinkRsrpMatrix
+SidelinkRsrpCalculator::CalcSlRsrpPsbchMatrix (Ptr<PropagationLossModel> lossModel, double txPower, double ulEarfcn, double ulBandwidth,
+                                               const std::vector<Ptr<SpectrumPhy> >& txPhys, const std::vector<Ptr<SpectrumPhy> >& rxPhys,
+                                               uint32_t nThreads)
+{
+  NS_ASSERT_MSG (lossModel != 0, "No PropagationLossModel provided");
+
+  // the reference signal is flat over the central RBs, hence the S-RSRP is
+  // its average power shifted by the path loss
+  double referencePower = CalcPsbchReferencePower (txPower, ulEarfcn, ulBandwidth);
+  return CalcSlRsrpTxPwMatrix (lossModel, referencePower, txPhys, rxPhys, nThreads);
+}
+
+SidelinkRsrpMatrix
+SidelinkRsrpCalculator::CalcSlRsrpTxPwMatrix (Ptr<PropagationLossModel> lossModel, double txPower,
+                                              const std::vector<Ptr<SpectrumPhy> >& txPhys, const std::vector<Ptr<SpectrumPhy> >& rxPhys,
+                                              uint32_t nThreads)
+{
+  NS_ASSERT_MSG (lossModel != 0, "No PropagationLossModel provided");
+
+  SidelinkRsrpMatrix matrix (txPhys.size (), rxPhys.size ());
+  DoCalcRsrpRows (lossModel, txPower, txPhys, rxPhys, nThreads,
+                  [&matrix] (uint32_t rx, const double *rsrp)
+                  {
+                    for (uint32_t tx = 0; tx < matrix.GetNTx (); tx++)
+                      {
+                        matrix.Set (tx, rx, rsrp[tx]);
+                      }
+                  });
+  return matrix;
+}
+
+SidelinkRsrpNeighborTable
+SidelinkRsrpCalculator::CalcSlRsrpPsbchNeighbors (Ptr<PropagationLossModel> lossModel, double txPower, double ulEarfcn, double ulBandwidth,
+                                                  const std::vector<Ptr<SpectrumPhy> >& phys, uint32_t k, uint32_t nThreads)
+{
+  NS_ASSERT_MSG (lossModel != 0, "No PropagationLossModel provided");
+
+  double referencePower = CalcPsbchReferencePower (txPower, ulEarfcn, ulBandwidth);
+  return DoCalcNeighbors (lossModel, referencePower, phys, k, nThreads);
+}
+
+SidelinkRsrpNeighborTable
+SidelinkRsrpCalculator::CalcSlRsrpTxPwNeighbors (Ptr<PropagationLossModel> lossModel, double txPower,
+                                                 const std::vector<Ptr<SpectrumPhy> >& phys, uint32_t k, uint32_t nThreads)
+{
+  NS_ASSERT_MSG (lossModel != 0, "No PropagationLossModel provided");
+
+  return DoCalcNeighbors (lossModel, txPower, phys, k, nThreads);
+}
+
+SidelinkRsrpNeighborTable
+SidelinkRsrpCalculator::DoCalcNeighbors (Ptr<PropagationLossModel> propagationLoss, double txPower,
+                                         const std::vector<Ptr<SpectrumPhy> >& phys, uint32_t k, uint32_t nThreads)
+{
+  SidelinkRsrpNeighborTable table (phys.size ());
+  DoCalcRsrpRows (propagationLoss, txPower, phys, phys, nThreads,
+                  [&table, k] (uint32_t rx, const double *rsrp)
+                  {
+                    std::vector<SidelinkRsrpNeighbor> candidates;
+                    candidates.reserve (table.size ());
+                    for (uint32_t tx = 0; tx < table.size (); tx++)
+                      {
+                        if (tx != rx)
+                          {
+                            candidates.push_back ({tx, rsrp[tx]});
+                          }
+                      }
+                    std::size_t n = std::min<std::size_t> (k, candidates.size ());
+                    // strongest first, the lowest index first for the same S-RSRP
+                    std::partial_sort (candidates.begin (), candidates.begin () + n, candidates.end (),
+                                       [] (const SidelinkRsrpNeighbor &a, const SidelinkRsrpNeighbor &b)
+                                       {
+                                         return a.rsrp > b.rsrp || (a.rsrp == b.rsrp && a.index < b.index);
+                                       });
+                    candidates.resize (n);
+                    table[rx] = candidates;
+                  });
+  return table;
+}
+
+SidelinkRsrpNeighborTable
+SidelinkRsrpCalculator::CalcSlRsrpPsbchGraph (Ptr<PropagationLossModel> lossModel, double txPower, double ulEarfcn, double ulBandwidth,
+                                              const std::vector<Ptr<SpectrumPhy> >& txPhys, const std::vector<Ptr<SpectrumPhy> >& rxPhys,
+                                              double rsrpThreshold, uint32_t nThreads)
+{
+  NS_ASSERT_MSG (lossModel != 0, "No PropagationLossModel provided");
+
+  double referencePower = CalcPsbchReferencePower (txPower, ulEarfcn, ulBandwidth);
+  return DoCalcGraph (lossModel, referencePower, txPhys, rxPhys, rsrpThreshold, nThreads);
+}
+
+SidelinkRsrpNeighborTable
+SidelinkRsrpCalculator::CalcSlRsrpTxPwGraph (Ptr<PropagationLossModel> lossModel, double txPower,
+                                             const std::vector<Ptr<SpectrumPhy> >& txPhys, const std::vector<Ptr<SpectrumPhy> >& rxPhys,
+                                             double rsrpThreshold, uint32_t nThreads)
+{
+  NS_ASSERT_MSG (lossModel != 0, "No PropagationLossModel provided");
+
+  return DoCalcGraph (lossModel, txPower, txPhys, rxPhys, rsrpThreshold, nThreads);
+}
+
+SidelinkRsrpNeighborTable
+SidelinkRsrpCalculator::DoCalcGraph (Ptr<PropagationLossModel> propagationLoss, double txPower,
+                                     const std::vector<Ptr<SpectrumPhy> >& txPhys, const std::vector<Ptr<SpectrumPhy> >& rxPhys,
+                                     double rsrpThreshold, uint32_t nThreads)
+{
+  // each receiver row is handled by a single thread, hence the links are
+  // first gathered by receiver, then transposed
+  std::vector<std::vector<SidelinkRsrpNeighbor> > rxLinks (rxPhys.size ());
+  DoCalcRsrpRows (propagationLoss, txPower, txPhys, rxPhys, nThreads,
+                  [&] (uint32_t rx, const double *rsrp)
+                  {
+                    for (uint32_t tx = 0; tx < txPhys.size (); tx++)
+                      {
+                        if (rsrp[tx] >= rsrpThreshold && txPhys[tx] != rxPhys[rx])
+                          {
+                            rxLinks[rx].push_back ({tx, rsrp[tx]});
+                          }
+                      }
+                  });
+
+  SidelinkRsrpNeighborTable graph (txPhys.size ());
+  for (uint32_t rx = 0; rx < rxLinks.size (); rx++)
+    {
+      for (std::vector<SidelinkRsrpNeighbor>::const_iterator it = rxLinks[rx].begin (); it != rxLinks[rx].end (); it++)
+        {
+          graph[it->index].push_back ({rx, it->rsrp});
+        }
+    }
+  return graph;
+}
+
 } // namespace ns3
 
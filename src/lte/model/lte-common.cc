@@ -240,6 +240,32 @@ TransmissionModesLayers::TxMode2LayerNum (uint8_t txMode)
 }
 
 
+const uint32_t LteSubframeNumbering::SUBFRAMES_PER_CYCLE = 10240;
+
+uint32_t
+LteSubframeNumbering::GetIndex (uint32_t frameNo, uint32_t subframeNo)
+{
+  NS_ASSERT_MSG (frameNo > 0 && subframeNo > 0 && subframeNo <= 10, "frame and subframe numbers start at 1");
+  return ((frameNo - 1) * 10 + subframeNo - 1) % SUBFRAMES_PER_CYCLE;
+}
+
+uint32_t
+LteSubframeNumbering::GetDistance (uint32_t fromFrameNo, uint32_t fromSubframeNo,
+                                   uint32_t toFrameNo, uint32_t toSubframeNo)
+{
+  return (GetIndex (toFrameNo, toSubframeNo) + SUBFRAMES_PER_CYCLE
+          - GetIndex (fromFrameNo, fromSubframeNo)) % SUBFRAMES_PER_CYCLE;
+}
+
+void
+LteSubframeNumbering::Advance (uint32_t &frameNo, uint32_t &subframeNo, uint32_t nSubframes)
+{
+  uint32_t index = (GetIndex (frameNo, subframeNo) + nSubframes % SUBFRAMES_PER_CYCLE) % SUBFRAMES_PER_CYCLE;
+  frameNo = index / 10 + 1;
+  subframeNo = index % 10 + 1;
+}
+
+
 double 
 EutranMeasurementMapping::RsrpRange2Dbm (uint8_t range)
 {
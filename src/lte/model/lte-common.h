@@ -182,6 +182,44 @@ public:
   static uint8_t TxMode2LayerNum (uint8_t txMode);
 };
 
+/**
+ * \ingroup lte
+ *
+ * Arithmetic on the frame and subframe numbers of the UE, which start at 1
+ * and wrap around after 1024 frames of 10 subframes
+ */
+class LteSubframeNumbering
+{
+public:
+  /// Number of subframes after which the frame number wraps around
+  static const uint32_t SUBFRAMES_PER_CYCLE;
+
+  /**
+   * \param frameNo The frame number
+   * \param subframeNo The subframe number
+   * \returns the index of the subframe in the cycle, starting at 0
+   */
+  static uint32_t GetIndex (uint32_t frameNo, uint32_t subframeNo);
+  /**
+   * \param fromFrameNo The frame number of the first subframe
+   * \param fromSubframeNo The subframe number of the first subframe
+   * \param toFrameNo The frame number of the second subframe
+   * \param toSubframeNo The subframe number of the second subframe
+   * \returns the number of subframes from the first subframe to the next
+   *          occurrence of the second one, 0 if they are the same subframe
+   */
+  static uint32_t GetDistance (uint32_t fromFrameNo, uint32_t fromSubframeNo,
+                               uint32_t toFrameNo, uint32_t toSubframeNo);
+  /**
+   * Move the frame and subframe numbers forward
+   *
+   * \param frameNo The frame number, updated
+   * \param subframeNo The subframe number, updated
+   * \param nSubframes The number of subframes to move forward
+   */
+  static void Advance (uint32_t &frameNo, uint32_t &subframeNo, uint32_t nSubframes);
+};
+
 
 /// PhyTransmissionStatParameters structure
 struct PhyTransmissionStatParameters
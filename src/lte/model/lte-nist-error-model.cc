@@ -38,6 +38,9 @@
 #include <stdint.h>
 #include <ns3/math.h>
 #include <ns3/lte-nist-error-model.h>
+#include <algorithm>
+#include <functional>
+#include <vector>
 
 namespace ns3 {
 NS_LOG_COMPONENT_DEFINE ("LteNistErrorModel");
@@ -352,6 +355,119 @@ static const double PsbchAwgnSisoBlerCurveYaxis[43] = {
 };
 
 
+namespace {
+
+/**
+ * Lookup data precomputed from one of the BLER curve tables above.
+ *
+ * For every point of the SINR grid of each row, it stores the SINR in
+ * linear scale, evaluated with exactly the same expression as the
+ * interpolation, so that looking it up gives the same result as
+ * computing it. It also stores the running minimum of the BLER values
+ * of each row, which is non-increasing even when the measured BLER
+ * values are not, and thus allows the reverse lookup from BLER to SINR
+ * to use a binary search.
+ */
+class BlerCurveTable
+{
+public:
+  /**
+   * Build the lookup data of a table
+   * \param xtable the x-axis table
+   * \param ytable the y-axis table
+   * \param ysize the number of BLER values per row
+   * \param rows the number of rows
+   */
+  BlerCurveTable (const double (*xtable)[XTABLE_SIZE], const double *ytable, uint16_t ysize, uint16_t rows)
+    : m_ytable (ytable),
+      m_ysize (ysize),
+      m_sinr (ysize * rows),
+      m_minBler (ysize * rows)
+  {
+    for (uint16_t row = 0; row < rows; ++row)
+      {
+        double minBler = ytable[row * ysize];
+        for (uint16_t index = 0; index < ysize; ++index)
+          {
+            m_sinr[row * ysize + index] = std::pow (10, (xtable[row][0] + index * xtable[row][2]) / 10);
+            minBler = std::min (minBler, ytable[row * ysize + index]);
+            m_minBler[row * ysize + index] = minBler;
+          }
+      }
+  }
+
+  /**
+   * \param ytable a y-axis table
+   * \return true if this lookup data was built from the table
+   */
+  bool IsBuiltFrom (const double *ytable) const
+  {
+    return m_ytable == ytable;
+  }
+
+  /**
+   * \param row the row
+   * \param index the column
+   * \return the linear SINR of the grid point
+   */
+  double GetSinr (uint16_t row, uint16_t index) const
+  {
+    return m_sinr[row * m_ysize + index];
+  }
+
+  /**
+   * \param row the row
+   * \param bler the BLER
+   * \return the first column of the row whose BLER is not above bler
+   */
+  uint16_t FindFirstNotAbove (uint16_t row, double bler) const
+  {
+    std::vector<double>::const_iterator first = m_minBler.begin () + row * m_ysize;
+    std::vector<double>::const_iterator last = first + m_ysize;
+    std::vector<double>::const_iterator it = std::lower_bound (first, last, bler, std::greater<double> ());
+    if (it == last)
+      {
+        // the last value of each row is the lowest BLER of the curve
+        --it;
+      }
+    return it - first;
+  }
+
+private:
+  const double *m_ytable;         //!< the y-axis table
+  uint16_t m_ysize;               //!< the number of BLER values per row
+  std::vector<double> m_sinr;     //!< linear SINR of each grid point
+  std::vector<double> m_minBler;  //!< running minimum of the BLER values of each row
+};
+
+/// Lookup data of the tables, built when the library is loaded
+static const BlerCurveTable g_blerCurveTables[] = {
+  BlerCurveTable (PuschAwgnSisoBlerCurveXaxis, PuschAwgnSisoBlerCurveYaxis, PUSCH_AWGN_SIZE, 116),
+  BlerCurveTable (PsdchAwgnSisoBlerCurveXaxis, PsdchAwgnSisoBlerCurveYaxis, PSDCH_AWGN_SIZE, 4),
+  BlerCurveTable (PscchAwgnSisoBlerCurveXaxis, PscchAwgnSisoBlerCurveYaxis, PSCCH_AWGN_SIZE, 1),
+  BlerCurveTable (PsbchAwgnSisoBlerCurveXaxis, PsbchAwgnSisoBlerCurveYaxis, PSBCH_AWGN_SIZE, 1)
+};
+
+/**
+ * \param ytable one of the y-axis tables
+ * \return the lookup data of the table
+ */
+const BlerCurveTable &
+GetBlerCurveTable (const double *ytable)
+{
+  for (const BlerCurveTable &table : g_blerCurveTables)
+    {
+      if (table.IsBuiltFrom (ytable))
+        {
+          return table;
+        }
+    }
+  NS_FATAL_ERROR ("Unknown BLER curve table");
+}
+
+} // unnamed namespace
+
+
 int16_t
 LteNistErrorModel::GetRowIndex (uint16_t mcs, uint8_t harq)
 {
@@ -397,8 +513,9 @@ LteNistErrorModel::GetBlerValue (const double (*xtable)[XTABLE_SIZE], const doub
       if (index1 != index2)
         {
           //interpolate
-          double sinr1 = std::pow (10, (xtable[rIndex][0] + index1 * xtable[rIndex][2]) / 10);
-          double sinr2 = std::pow (10, (xtable[rIndex][0] + index2 * xtable[rIndex][2]) / 10);
+          const BlerCurveTable &table = GetBlerCurveTable (ytable);
+          double sinr1 = table.GetSinr (rIndex, index1);
+          double sinr2 = table.GetSinr (rIndex, index2);
           double bler1 = ytable[rIndex * ysize + index1];
           double bler2 = ytable[rIndex * ysize + index2];
           bler = bler1 + (bler2 - bler1) * (sinr - sinr1) / (sinr2 - sinr1);
@@ -416,16 +533,13 @@ LteNistErrorModel::GetSinrValue (const double (*xtable)[XTABLE_SIZE], const doub
 {
   double sinr = 0;
   int16_t rIndex = GetRowIndex (mcs, harq);
-  uint16_t index = 0;
-  while (ytable[rIndex * ysize + index] > bler)
-    {
-      index++;
-    }
+  const BlerCurveTable &table = GetBlerCurveTable (ytable);
+  uint16_t index = table.FindFirstNotAbove (rIndex, bler);
 
   if (ytable[rIndex * ysize + index] < bler)
     {
-      double sinr1 = std::pow (10, (xtable[rIndex][0] + (index - 1) * xtable[rIndex][2]) / 10);
-      double sinr2 = std::pow (10, (xtable[rIndex][0] + index * xtable[rIndex][2]) / 10);
+      double sinr1 = table.GetSinr (rIndex, index - 1);
+      double sinr2 = table.GetSinr (rIndex, index);
       double bler1 = ytable[rIndex * ysize + index - 1];
       double bler2 = ytable[rIndex * ysize + index];
       sinr = sinr1 + (bler - bler1) * (sinr2 - sinr1) / (bler2 - bler1);
@@ -433,7 +547,7 @@ LteNistErrorModel::GetSinrValue (const double (*xtable)[XTABLE_SIZE], const doub
   else
     {
       //last or equal element
-      sinr = std::pow (10, (xtable[rIndex][0] + index * xtable[rIndex][2]) / 10);
+      sinr = table.GetSinr (rIndex, index);
     }
   return sinr;
 }
@@ -451,11 +565,7 @@ LteNistErrorModel::GetValueForIndex (uint16_t index, double min, double max, dou
 uint16_t
 LteNistErrorModel::GetBlerIndex (double bler, uint16_t row, const double (*ytable), const uint16_t ysize)
 {
-  uint16_t index = 0;
-  while (ytable[row * ysize + index] > bler)
-    {
-      index++;
-    }
+  uint16_t index = GetBlerCurveTable (ytable).FindFirstNotAbove (row, bler);
   return index - 1; //return the index of the last column where BLER is above the target one
 }
 
@@ -551,6 +661,55 @@ LteNistErrorModel::GetPsschBler (LteFadingModel fadingChannel, LteTxMode txmode,
   return tbStat;
 }
 
+std::vector<TbErrorStats_t>
+LteNistErrorModel::GetPsschBler (LteFadingModel fadingChannel, LteTxMode txmode, const std::vector<uint16_t> &mcs, const std::vector<double> &sinr, const std::vector<HarqProcessInfoList_t> &harqHistory)
+{
+  NS_ASSERT_MSG (mcs.size () == sinr.size () && mcs.size () == harqHistory.size (), "One MCS, SINR and HARQ history per TB");
+
+  //Find the table to use
+  const double (*xtable)[XTABLE_SIZE];
+  const double *ytable;
+  double ysize = 0;
+
+  switch (fadingChannel)
+    {
+    case AWGN:
+      switch (txmode)
+        {
+        case SISO:
+          xtable = PuschAwgnSisoBlerCurveXaxis;
+          ytable = PuschAwgnSisoBlerCurveYaxis;
+          ysize = PUSCH_AWGN_SIZE;
+          break;
+        default:
+          NS_FATAL_ERROR ("Transmit mode " << txmode << " not supported in AWGN channel");
+        }
+      break;
+    default:
+      NS_FATAL_ERROR ("Fading channel " << fadingChannel << " not supported");
+    }
+
+  std::vector<TbErrorStats_t> tbStats (mcs.size ());
+  for (std::size_t i = 0; i < mcs.size (); ++i)
+    {
+      //Check mcs values
+      if (mcs[i] > 20)
+        {
+          NS_FATAL_ERROR ("PSSCH modulation cannot exceed 20");
+        }
+      if (harqHistory[i].size () == 0)
+        {
+          tbStats[i] = GetBler (xtable, ytable, ysize, mcs[i], 0, 0,  sinr[i]);
+        }
+      else
+        {
+          tbStats[i] = GetBler (xtable, ytable, ysize, mcs[i], harqHistory[i].size (), harqHistory[i][harqHistory[i].size () - 1].m_sinr,  sinr[i]);
+        }
+    }
+
+  return tbStats;
+}
+
 TbErrorStats_t
 LteNistErrorModel::GetPsdchBler (LteFadingModel fadingChannel, LteTxMode txmode, double sinr, HarqProcessInfoList_t harqHistory)
 {
@@ -36,6 +36,7 @@
 #ifndef LTE_NIST_ERROR_MODEL_H
 #define LTE_NIST_ERROR_MODEL_H
 #include <stdint.h>
+#include <vector>
 #include <ns3/lte-harq-phy.h>
 
 namespace ns3 {
@@ -109,6 +110,18 @@ public:
    */
   static TbErrorStats_t GetPsschBler (LteFadingModel fadingChannel, LteTxMode txmode, uint16_t mcs, double sinr, HarqProcessInfoList_t harqHistory);
 
+  /**
+   * \brief Lookup the BLER of all the PSSCH TBs received in a subframe.
+   *        The table of the channel is selected once for all the TBs.
+   * \param fadingChannel The channel to use
+   * \param txmode The Transmission mode used
+   * \param mcs The MCS of each TB
+   * \param sinr The mean sinr of each TB
+   * \param harqHistory The HARQ information of each TB
+   * \return The TbErrorStats_t of each TB, in the same order
+   */
+  static std::vector<TbErrorStats_t> GetPsschBler (LteFadingModel fadingChannel, LteTxMode txmode, const std::vector<uint16_t> &mcs, const std::vector<double> &sinr, const std::vector<HarqProcessInfoList_t> &harqHistory);
+
   /**
    * \brief Lookup the BLER for the given SINR
    * \param fadingChannel The channel to use
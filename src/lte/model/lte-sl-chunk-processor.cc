@@ -79,7 +79,7 @@ LteSlChunkProcessor::EvaluateChunk (uint32_t index, const SpectrumValue& sinr, T
     {
       m_chunkValues[index].m_sumValues = Create<SpectrumValue> (sinr.GetSpectrumModel ());
     }
-  *(m_chunkValues[index].m_sumValues) += sinr * duration.GetSeconds ();
+  m_chunkValues[index].m_sumValues->AddScaled (sinr, duration.GetSeconds ());
   m_chunkValues[index].m_totDuration += duration;
 }
 
@@ -91,6 +91,7 @@ LteSlChunkProcessor::End ()
   if (m_chunkValues[0].m_totDuration.GetSeconds () > 0)
     {
       std::vector<SpectrumValue> values;
+      values.reserve (m_chunkValues.size ());
       std::vector<LteSlChunkValue>::iterator itValues;
       for (itValues = m_chunkValues.begin() ; itValues != m_chunkValues.end () ; itValues++)
         {
@@ -191,22 +191,32 @@ LteSlInterference::ConditionallyEvaluateChunk ()
   NS_LOG_DEBUG (this << " now "  << Now () << " last " << m_lastChangeTime);
   if (m_receiving && (Now () > m_lastChangeTime))
     {
+      Time duration = Now () - m_lastChangeTime;
+      // the total power m_allSignals is kept up to date by DoAddSignal and
+      // DoSubtractSignal, so each signal only costs one pass over the RBs,
+      // and only for the values that some chunk processor consumes
+      bool needInterf = !m_interfChunkProcessorList.empty () || !m_sinrChunkProcessorList.empty ();
+      bool needSinr = !m_sinrChunkProcessorList.empty ();
       //compute values for each signal being received
       for (uint32_t index = 0 ; index < m_rxSignal.size() ; ++index)
         {
           NS_LOG_LOGIC (this << " signal = " << *(m_rxSignal[index]) << " allSignals = " << *m_allSignals << " noise = " << *m_noise);
-          
-          SpectrumValue interf =  (*m_allSignals) - (*(m_rxSignal[index])) + (*m_noise);
-          
-          SpectrumValue sinr = (*(m_rxSignal[index])) / interf;
-          Time duration = Now () - m_lastChangeTime;
+
+          if (needInterf)
+            {
+              m_interf.SetInterferencePlusNoise (*m_allSignals, *(m_rxSignal[index]), *m_noise);
+            }
+          if (needSinr)
+            {
+              m_sinr.SetSinr (*(m_rxSignal[index]), m_interf);
+            }
           for (std::list<Ptr<LteSlChunkProcessor> >::const_iterator it = m_sinrChunkProcessorList.begin (); it != m_sinrChunkProcessorList.end (); ++it)
             {
-              (*it)->EvaluateChunk (index, sinr, duration);
+              (*it)->EvaluateChunk (index, m_sinr, duration);
             }
           for (std::list<Ptr<LteSlChunkProcessor> >::const_iterator it = m_interfChunkProcessorList.begin (); it != m_interfChunkProcessorList.end (); ++it)
             {
-              (*it)->EvaluateChunk (index, interf, duration);
+              (*it)->EvaluateChunk (index, m_interf, duration);
             }
           for (std::list<Ptr<LteSlChunkProcessor> >::const_iterator it = m_rsPowerChunkProcessorList.begin (); it != m_rsPowerChunkProcessorList.end (); ++it)
             {
@@ -150,6 +150,9 @@ private:
 
   Ptr<const SpectrumValue> m_noise; ///< the noise value
 
+  SpectrumValue m_interf; ///< interference plus noise of the signal being evaluated, reused across signals and chunks
+  SpectrumValue m_sinr;   ///< SINR of the signal being evaluated, reused across signals and chunks
+
   Time m_lastChangeTime;     /**< the time of the last change in
                                 m_TotalPower */
 
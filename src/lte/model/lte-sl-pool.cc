@@ -272,10 +272,76 @@ void
 SidelinkCommResourcePool::Initialize ()
 {
   NS_LOG_FUNCTION (this);
+  m_geometry = GetGeometryCache ();
   ComputeNumberOfPscchResources ();
   ComputeNumberOfPsschResources ();
 }
 
+std::map<SidelinkCommResourcePool::GeometryCacheKey, Ptr<SidelinkCommResourcePool::GeometryCache> > SidelinkCommResourcePool::s_geometryCaches;
+std::mutex SidelinkCommResourcePool::s_geometryCachesMutex;
+
+Ptr<SidelinkCommResourcePool::GeometryCache>
+SidelinkCommResourcePool::GetGeometryCache ()
+{
+  NS_LOG_FUNCTION (this);
+  GeometryCacheKey key;
+  key.push_back (m_type);
+  key.push_back (m_scCpLen.cplen);
+  key.push_back (m_scPeriod.period);
+  key.push_back (m_scTfResourceConfig.prbNum);
+  key.push_back (m_scTfResourceConfig.prbStart);
+  key.push_back (m_scTfResourceConfig.prbEnd);
+  key.push_back (m_scTfResourceConfig.offsetIndicator.offset);
+  key.push_back (m_scTfResourceConfig.subframeBitmap.bitmap.to_ullong ());
+  key.push_back (m_dataCpLen.cplen);
+  key.push_back (m_dataHoppingConfig.hoppingParameter);
+  key.push_back (m_dataHoppingConfig.numSubbands);
+  key.push_back (m_dataHoppingConfig.rbOffset);
+  key.push_back (m_dataHoppingConfig.hoppingInfo);
+  if (m_type == SidelinkCommResourcePool::UE_SELECTED)
+    {
+      key.push_back (m_dataTfResourceConfig.prbNum);
+      key.push_back (m_dataTfResourceConfig.prbStart);
+      key.push_back (m_dataTfResourceConfig.prbEnd);
+      key.push_back (m_dataTfResourceConfig.offsetIndicator.offset);
+      key.push_back (m_dataTfResourceConfig.subframeBitmap.bitmap.to_ullong ());
+      key.push_back (m_trptSubset.subset.to_ulong ());
+    }
+
+  std::lock_guard<std::mutex> lock (s_geometryCachesMutex);
+  std::map<GeometryCacheKey, Ptr<GeometryCache> >::const_iterator it = s_geometryCaches.find (key);
+  if (it != s_geometryCaches.end ())
+    {
+      NS_LOG_LOGIC ("reusing the tables of an existing pool with the same configuration");
+      return it->second;
+    }
+  if (s_geometryCaches.empty ())
+    {
+      Simulator::ScheduleDestroy (&SidelinkCommResourcePool::ClearGeometryCaches);
+    }
+
+  Ptr<GeometryCache> cache = Create<GeometryCache> ();
+  cache->type = m_type;
+  cache->scCpLen = m_scCpLen;
+  cache->scPeriod = m_scPeriod;
+  cache->scTfResourceConfig = m_scTfResourceConfig;
+  cache->dataCpLen = m_dataCpLen;
+  cache->dataHoppingConfig = m_dataHoppingConfig;
+  cache->trptSubset = m_trptSubset;
+  cache->dataTfResourceConfig = m_dataTfResourceConfig;
+  cache->haveValidAllocations = false;
+  s_geometryCaches[key] = cache;
+  return cache;
+}
+
+void
+SidelinkCommResourcePool::ClearGeometryCaches (void)
+{
+  NS_LOG_FUNCTION_NOARGS ();
+  std::lock_guard<std::mutex> lock (s_geometryCachesMutex);
+  s_geometryCaches.clear ();
+}
+
 SidelinkCommResourcePool::SlPoolType
 SidelinkCommResourcePool::GetSchedulingType ()
 {
@@ -435,6 +501,41 @@ std::list<SidelinkCommResourcePool::SidelinkTransmissionInfo>
 SidelinkCommResourcePool::GetPsschTransmissions (SidelinkCommResourcePool::SubframeInfo periodStart, uint8_t itrp, uint8_t rbStart, uint8_t rbLen)
 {
   NS_LOG_FUNCTION (this << Simulator::Now ().GetMilliSeconds () << "Frame no. " << periodStart.frameNo << "subframe no. " << periodStart.subframeNo << "itrp  " << (uint16_t) itrp << " rbStart " << (uint16_t) rbStart << " rbLen " << (uint16_t) rbLen);
+  const std::vector<SidelinkTransmissionInfo> &txInfo = GetPsschTransmissionVector (periodStart, itrp, rbStart, rbLen);
+  return std::list<SidelinkTransmissionInfo> (txInfo.begin (), txInfo.end ());
+}
+
+const std::vector<SidelinkCommResourcePool::SidelinkTransmissionInfo>&
+SidelinkCommResourcePool::GetPsschTransmissionVector (SidelinkCommResourcePool::SubframeInfo periodStart, uint8_t itrp, uint8_t rbStart, uint8_t rbLen)
+{
+  NS_LOG_FUNCTION (this << periodStart.frameNo << periodStart.subframeNo << (uint16_t) itrp << (uint16_t) rbStart << (uint16_t) rbLen);
+  int32_t periodSubframe = 10 * (periodStart.frameNo % 1024) + periodStart.subframeNo % 10;
+  uint64_t key = (static_cast<uint64_t> (periodSubframe) << 24) | (static_cast<uint64_t> (itrp) << 16)
+    | (static_cast<uint64_t> (rbStart) << 8) | rbLen;
+
+  //the entries are never erased, so that the references returned to the
+  //pools of other threads remain valid
+  std::lock_guard<std::mutex> lock (m_geometry->mutex);
+  std::unordered_map<uint64_t, std::vector<SidelinkTransmissionInfo> >::iterator it = m_geometry->psschTransmissions.find (key);
+  if (it != m_geometry->psschTransmissions.end ())
+    {
+      return it->second;
+    }
+  if (m_geometry->psschTransmissions.size () >= GeometryCache::MAX_PSSCH_TRANSMISSIONS)
+    {
+      m_psschTransmissions.clear ();
+      ComputePsschTransmissions (periodSubframe, itrp, rbStart, rbLen, m_psschTransmissions);
+      return m_psschTransmissions;
+    }
+  it = m_geometry->psschTransmissions.insert (std::make_pair (key, std::vector<SidelinkTransmissionInfo> ())).first;
+  ComputePsschTransmissions (periodSubframe, itrp, rbStart, rbLen, it->second);
+  return it->second;
+}
+
+void
+SidelinkCommResourcePool::ComputePsschTransmissions (int32_t periodSubframe, uint8_t itrp, uint8_t rbStart, uint8_t rbLen, std::vector<SidelinkTransmissionInfo> &txInfo)
+{
+  NS_LOG_FUNCTION (this << periodSubframe << (uint16_t) itrp << (uint16_t) rbStart << (uint16_t) rbLen);
 
   if (m_type == SidelinkCommResourcePool::UE_SELECTED)
     {
@@ -452,8 +553,6 @@ SidelinkCommResourcePool::GetPsschTransmissions (SidelinkCommResourcePool::Subfr
         }
     }
 
-  int32_t periodSubframe = 10 * (periodStart.frameNo % 1024) + periodStart.subframeNo % 10;
-
   //N_TRP and the bitmap b' as defined in TS 36.213 14.1.1.1.1
   uint32_t ntrp = 8;
   std::bitset<8> bitmap = ItrpToBitmap[itrp];
@@ -501,7 +600,8 @@ SidelinkCommResourcePool::GetPsschTransmissions (SidelinkCommResourcePool::Subfr
         }
     }
 
-  std::list<SidelinkCommResourcePool::SidelinkTransmissionInfo> txInfo;
+  txInfo.clear ();
+  txInfo.reserve (psschsubframes.size ());
   uint32_t tx_counter = 1;   //Transmission counter, used to keep track of parity when frequency hopping.
   for (std::vector<uint32_t>::iterator it = psschsubframes.begin (); it != psschsubframes.end (); it++)
     {
@@ -535,7 +635,6 @@ SidelinkCommResourcePool::GetPsschTransmissions (SidelinkCommResourcePool::Subfr
       txInfo.push_back (info);
       tx_counter++;
     }
-  return txInfo;
 }
 
 std::vector<uint32_t>
@@ -691,11 +790,16 @@ SidelinkCommResourcePool::GetValidRBstart (uint8_t rbLen)
   return rbStartIndexes;
 }
 
-std::vector< std::vector<uint8_t> >
+const std::vector< std::vector<uint8_t> >&
 SidelinkCommResourcePool::GetValidAllocations ()
 {
   NS_LOG_FUNCTION (this);
-  std::vector< std::vector<uint8_t> > allValidRBstartIndexes;
+  std::lock_guard<std::mutex> lock (m_geometry->mutex);
+  if (m_geometry->haveValidAllocations)
+    {
+      return m_geometry->validAllocations;
+    }
+  std::vector< std::vector<uint8_t> > &allValidRBstartIndexes = m_geometry->validAllocations;
   NS_LOG_DEBUG ("HoppingInfo = " << uint16_t (m_dataHoppingConfig.hoppingInfo));
   if (m_dataHoppingConfig.hoppingInfo <= 3)   //Frequency Hopping Enabled
     {
@@ -758,6 +862,7 @@ SidelinkCommResourcePool::GetValidAllocations ()
           NS_FATAL_ERROR (this << " GetValidAllocations() CANNOT BE CALLED WITH FREUQNECY HOPPING DISABLED.");
         }
     }
+  m_geometry->haveValidAllocations = true;
   return allValidRBstartIndexes;
 }
 
@@ -882,7 +987,7 @@ SidelinkCommResourcePool::GetNprbType2 (uint8_t rbStart, uint8_t rbLen, std::vec
   uint8_t mirroring = 0;
   for (std::vector<uint32_t>::iterator it = psschSFIndexes.begin (); it != psschSFIndexes.end (); it++)
     {
-      hopIndex = m_hopSequence[*it];   //FHopFunction (*it);
+      hopIndex = m_geometry->hopSequence[*it];   //FHopFunction (*it);
       hop_distance = hopIndex * sbSize;
       if (m_dataHoppingConfig.numSubbands == 1)
         {
@@ -943,8 +1048,8 @@ SidelinkCommResourcePool::FHopFunction (uint32_t i)
   uint32_t sum = 0;
   for (uint32_t k = i * 10 + 1; k <= i * 10 + 9; k++)
     {
-      NS_ASSERT (k < m_goldSequence.size ());
-      sum += m_goldSequence[k] * (uint32_t) std::pow (2, k - (i * 10 + 1));
+      NS_ASSERT (k < m_geometry->goldSequence.size ());
+      sum += m_geometry->goldSequence[k] * (uint32_t) std::pow (2, k - (i * 10 + 1));
     }
 
   if (m_dataHoppingConfig.numSubbands == 2)
@@ -967,9 +1072,9 @@ SidelinkCommResourcePool::GenerateHopSequence ()
 {
   NS_LOG_FUNCTION (this);
   //Ensure the vector is empty in case this function gets called again.
-  if (m_hopSequence.size () != 0)
+  if (m_geometry->hopSequence.size () != 0)
     {
-      m_hopSequence.clear ();
+      m_geometry->hopSequence.clear ();
     }
 
   uint8_t fhop_prev = 0;
@@ -977,32 +1082,32 @@ SidelinkCommResourcePool::GenerateHopSequence ()
     {
       if (m_dataHoppingConfig.numSubbands == 1)
         {
-          m_hopSequence.push_back (0);
+          m_geometry->hopSequence.push_back (0);
         }
       else
         {
           uint32_t sum = 0;
           for (uint32_t k = i * 10 + 1; k <= i * 10 + 9; k++)
             {
-              NS_ASSERT (k < m_goldSequence.size ());
-              sum += m_goldSequence[k] * (uint32_t) std::pow (2, k - (i * 10 + 1));
+              NS_ASSERT (k < m_geometry->goldSequence.size ());
+              sum += m_geometry->goldSequence[k] * (uint32_t) std::pow (2, k - (i * 10 + 1));
             }
 
           if (m_dataHoppingConfig.numSubbands == 2)
             {
-              m_hopSequence.push_back (uint8_t ((fhop_prev + sum) % m_dataHoppingConfig.numSubbands));
+              m_geometry->hopSequence.push_back (uint8_t ((fhop_prev + sum) % m_dataHoppingConfig.numSubbands));
             }
           else if (m_dataHoppingConfig.numSubbands > 2)
             {
               sum = sum % (m_dataHoppingConfig.numSubbands - 1);
-              m_hopSequence.push_back (uint8_t ((fhop_prev + sum + 1) % m_dataHoppingConfig.numSubbands));
+              m_geometry->hopSequence.push_back (uint8_t ((fhop_prev + sum + 1) % m_dataHoppingConfig.numSubbands));
             }
           else
             {
               NS_FATAL_ERROR (this << " INVALID NUMBER OF SUBBANDS FOR FREQUENCY HOPPING. ONLY VALUES 1, 2, OR 4 ARE VALID.");
             }
         }
-      fhop_prev =  m_hopSequence.back ();
+      fhop_prev =  m_geometry->hopSequence.back ();
     }
 }
 
@@ -1041,9 +1146,9 @@ SidelinkCommResourcePool::GenerateGoldSequence ()
     }
 
   //Ensure the vector is empty in case this function gets called again.
-  if (m_goldSequence.size () != 0)
+  if (m_geometry->goldSequence.size () != 0)
     {
-      m_goldSequence.clear ();
+      m_geometry->goldSequence.clear ();
     }
 
   uint32_t sum = 0;
@@ -1051,10 +1156,10 @@ SidelinkCommResourcePool::GenerateGoldSequence ()
   for (uint32_t i = 0; i < maxMpn; ++i)
     {
       sum = (x1[i + Nc] + x2[i + Nc]);
-      m_goldSequence.push_back (sum % 2);
+      m_geometry->goldSequence.push_back (sum % 2);
       total_sum_test += sum % 2;
     }
-  NS_LOG_INFO ("GoldSeq size " << m_goldSequence.size () << ", Gold sum " << total_sum_test);
+  NS_LOG_INFO ("GoldSeq size " << m_geometry->goldSequence.size () << ", Gold sum " << total_sum_test);
 
   delete [] x1;
   delete [] x2;
@@ -1072,7 +1177,7 @@ SidelinkCommResourcePool::FMirroringFunction (uint32_t i)
     }
   else if (m_dataHoppingConfig.numSubbands > 1)
     {
-      return m_goldSequence[i * 10];
+      return m_geometry->goldSequence[i * 10];
     }
   else
     {
@@ -1154,7 +1259,8 @@ SidelinkCommResourcePool::ComputeNumberOfPsschResources ()
             }
         }
       m_rbpssch = m_rbpsschVector.size ();  //number of usable RBs
-      if (m_dataHoppingConfig.hoppingInfo == 3)   //Type 2 frequency hopping
+      std::lock_guard<std::mutex> lock (m_geometry->mutex);
+      if (m_dataHoppingConfig.hoppingInfo == 3 && m_geometry->hopSequence.empty ())   //Type 2 frequency hopping
         {
           GenerateGoldSequence ();
           GenerateHopSequence ();
@@ -38,6 +38,9 @@
 
 #include <map>
 #include <set>
+#include <unordered_map>
+#include <mutex>
+#include <ns3/simple-ref-count.h>
 #include "lte-rrc-sap.h"
 #include <ns3/traced-callback.h>
 
@@ -235,6 +238,19 @@ public:
    */
   std::list<SidelinkCommResourcePool::SidelinkTransmissionInfo> GetPsschTransmissions (SubframeInfo periodStart, uint8_t itrp, uint8_t rbStart, uint8_t rbLen);
 
+  /**
+   * Returns the subframes and RBs associated with the transmission on PSSCH,
+   * without copying them. The transmissions are computed once per pool
+   * configuration and reused by all the pools sharing the same configuration.
+   * \param periodStart The first subframe in the Sidelink period
+   * \param itrp The repetition pattern from the SCI format 0 message
+   * \param rbStart The index of the PRB where the transmission occurs
+   * \param rbLen The length of the transmission
+   * \return The subframes and RBs associated with the transmission on PSSCH,
+   *         valid until the next call to this method on this pool
+   */
+  const std::vector<SidelinkCommResourcePool::SidelinkTransmissionInfo>& GetPsschTransmissionVector (SubframeInfo periodStart, uint8_t itrp, uint8_t rbStart, uint8_t rbLen);
+
   /**
    * Returns all PSSCH subframe index relative to the start of SL period
    * \return A vector of subframe index relative to the start of SL period
@@ -258,7 +274,7 @@ public:
    * Computes all valid rbStart values for every Lcrb value from range [0,10]
    * \return A vector of vectors which contains valid rbStart indexes for corresponding Lcrb value
    */
-  std::vector< std::vector<uint8_t> > GetValidAllocations ();
+  const std::vector< std::vector<uint8_t> >& GetValidAllocations ();
 
 protected:
   /**
@@ -288,6 +304,64 @@ protected:
   LteRrcSap::SlTfResourceConfig m_dataTfResourceConfig; ///< shared channel pool information
 
 private:
+  /**
+   * Tables derived from the configuration of a pool, which are shared by
+   * all the pools having the same configuration (e.g., the pools of all
+   * the UEs using the same preconfigured pool) and populated lazily.
+   */
+  struct GeometryCache : public SimpleRefCount<GeometryCache>
+  {
+    /// Maximum number of PSSCH transmission patterns kept in the cache
+    static const std::size_t MAX_PSSCH_TRANSMISSIONS = 65536;
+
+    //Configuration of the pools using the cache
+    SlPoolType type; ///< The type of pool
+    LteRrcSap::SlCpLen scCpLen; ///< cyclic prefix length of control channel
+    LteRrcSap::SlPeriodComm scPeriod; ///< duration of the Sidelink period
+    LteRrcSap::SlTfResourceConfig scTfResourceConfig; ///< control pool information (subframes and PRBs)
+    LteRrcSap::SlCpLen dataCpLen; ///< cyclic prefix for the shared channel
+    LteRrcSap::SlHoppingConfigComm dataHoppingConfig; ///< frequency hopping parameters
+    LteRrcSap::SlTrptSubset trptSubset; ///< repetition patterns allowed in UE selected pools
+    LteRrcSap::SlTfResourceConfig dataTfResourceConfig; ///< shared channel pool information
+
+    std::vector <uint8_t> hopSequence; ///< Hop sequence, holds hop distance for every subframe
+    std::vector <uint8_t> goldSequence; ///< Pseudo random sequence used for frequency hopping Type 2.
+    /// PSSCH transmissions, indexed by period start subframe, itrp, rbStart and rbLen
+    std::unordered_map<uint64_t, std::vector<SidelinkTransmissionInfo> > psschTransmissions;
+    bool haveValidAllocations; ///< true if validAllocations was computed
+    std::vector< std::vector<uint8_t> > validAllocations; ///< valid rbStart indexes for each Lcrb value
+    std::mutex mutex; ///< protects the tables populated lazily by the pools of different threads
+  };
+
+  /// Key of a geometry cache, made of the configuration fields the tables depend on
+  typedef std::vector<uint64_t> GeometryCacheKey;
+
+  /**
+   * Find the cache of a pool having the same configuration as this one,
+   * or create a new cache if none exists
+   * \return the cache to use for this pool
+   */
+  Ptr<GeometryCache> GetGeometryCache ();
+
+  /**
+   * Release the geometry caches of all the pools, when the simulator is
+   * destroyed. The pools still alive keep their own cache.
+   */
+  static void ClearGeometryCaches (void);
+
+  static std::map<GeometryCacheKey, Ptr<GeometryCache> > s_geometryCaches; ///< The geometry caches, indexed by configuration
+  static std::mutex s_geometryCachesMutex; ///< protects s_geometryCaches
+
+  /**
+   * Compute the subframes and RBs associated with the transmission on PSSCH
+   * \param periodSubframe The first subframe in the Sidelink period
+   * \param itrp The repetition pattern from the SCI format 0 message
+   * \param rbStart The index of the PRB where the transmission occurs
+   * \param rbLen The length of the transmission
+   * \param txInfo The vector where the transmissions are stored
+   */
+  void ComputePsschTransmissions (int32_t periodSubframe, uint8_t itrp, uint8_t rbStart, uint8_t rbLen, std::vector<SidelinkTransmissionInfo> &txInfo);
+
   /**
    * Checks if a resource with a given rbStart and length is within the valid pool range
    * \param rbStart The starting position of the contiguous resource blocks
@@ -366,8 +440,8 @@ private:
   uint32_t m_rbpssch; ///< Total number of RBs that belong to PSSCH pool
   std::vector <uint32_t> m_rbpsschVector; ///< List of RBs that belong to PSSCH pool
   std::map <uint32_t, uint32_t> m_rbpsschPoolPrbToVrbIndexMap;  ///< RB_index, Pool_index>
-  std::vector <uint8_t> m_hopSequence; ///< Hop sequence, holds hop distance for every subframe
-  std::vector <uint8_t> m_goldSequence; ///< Pseudo random sequence used for frequency hopping Type 2.
+  Ptr<GeometryCache> m_geometry; ///< Tables shared with the pools having the same configuration
+  std::vector<SidelinkTransmissionInfo> m_psschTransmissions; ///< PSSCH transmissions computed once the shared table is full
 
 
   bool m_preconfigured; ///< Indicates if the pool is preconfigured
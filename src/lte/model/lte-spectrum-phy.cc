@@ -2170,9 +2170,41 @@ LteSpectrumPhy::RxSlPssch (std::vector<uint32_t> pktIndexes)
 
     }
 
+  //Look up the BLER of all the expected TBs at once
+  std::map <SlTbId_t, uint32_t>::iterator itSinr;
+  std::vector<uint16_t> blerMcs;
+  std::vector<double> blerSinr;
+  std::vector<HarqProcessInfoList_t> blerHarqHistory;
+  if (m_slDataErrorModelEnabled && m_rxPacketInfo.size () > 0)
+    {
+      for (expectedSlTbs_t::iterator itTb = m_expectedSlTbs.begin (); itTb != m_expectedSlTbs.end (); itTb++)
+        {
+          itSinr = expectedTbToSinrIndex.find ((*itTb).first);
+          if (itSinr == expectedTbToSinrIndex.end ())
+            {
+              continue;
+            }
+          HarqProcessInfoList_t harqInfoList;
+          // retrieve HARQ info
+          if ((*itTb).second.ndi == 0)
+            {
+              harqInfoList = m_slHarqPhyModule->GetHarqProcessInfoSl ((*itTb).first.m_rnti, (*itTb).first.m_l1dst);
+              NS_LOG_DEBUG ("Nb Retx=" << harqInfoList.size ());
+            }
+          blerMcs.push_back ((*itTb).second.mcs);
+          blerSinr.push_back (GetMeanSinr (m_slSinrPerceived[(*itSinr).second] * m_slRxGain, (*itTb).second.rbBitmap));
+          blerHarqHistory.push_back (harqInfoList);
+        }
+    }
+  std::vector<TbErrorStats_t> blerStats;
+  if (!blerMcs.empty ())
+    {
+      blerStats = LteNistErrorModel::GetPsschBler (m_fadingModel, LteNistErrorModel::SISO, blerMcs, blerSinr, blerHarqHistory);
+    }
+
   //Compute the error and check for collision for each expected Tb
+  std::size_t blerIndex = 0;
   expectedSlTbs_t::iterator itTb = m_expectedSlTbs.begin ();
-  std::map <SlTbId_t, uint32_t>::iterator itSinr;
   while (itTb != m_expectedSlTbs.end ())
     {
       itSinr = expectedTbToSinrIndex.find ((*itTb).first);
@@ -2183,12 +2215,7 @@ LteSpectrumPhy::RxSlPssch (std::vector<uint32_t> pktIndexes)
           bool rbCollided = false;
           if (m_slDataErrorModelEnabled)
             {
-              // retrieve HARQ info
-              if ((*itTb).second.ndi == 0)
-                {
-                  harqInfoList = m_slHarqPhyModule->GetHarqProcessInfoSl ((*itTb).first.m_rnti, (*itTb).first.m_l1dst);
-                  NS_LOG_DEBUG ("Nb Retx=" << harqInfoList.size ());
-                }
+              harqInfoList = blerHarqHistory[blerIndex];
 
               NS_LOG_DEBUG ("Time: " << Simulator::Now ().GetMilliSeconds () << "msec From: " << (*itTb).first.m_rnti << " Corrupt: " << (*itTb).second.corrupt);
 
@@ -2208,7 +2235,7 @@ LteSpectrumPhy::RxSlPssch (std::vector<uint32_t> pktIndexes)
                         }
                     }
                 }
-              TbErrorStats_t tbStats = LteNistErrorModel::GetPsschBler (m_fadingModel,LteNistErrorModel::SISO, (*itTb).second.mcs, GetMeanSinr (m_slSinrPerceived[(*itSinr).second] * m_slRxGain, (*itTb).second.rbBitmap),  harqInfoList);
+              const TbErrorStats_t &tbStats = blerStats[blerIndex++];
               (*itTb).second.sinr = tbStats.sinr;
               if (!rbCollided)
                 {
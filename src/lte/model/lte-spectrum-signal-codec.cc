@@ -0,0 +1,348 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include <ns3/log.h>
+#include <ns3/packet-burst.h>
+#include "lte-spectrum-signal-parameters.h"
+#include "lte-spectrum-signal-codec.h"
+
+namespace ns3 {
+
+NS_LOG_COMPONENT_DEFINE ("LteSpectrumSignalCodec");
+
+/// The LTE signals, as written in the messages
+enum LteSignalType
+{
+  LTE_SIGNAL = 0,
+  LTE_DATA_FRAME,
+  LTE_DL_CTRL_FRAME,
+  LTE_UL_SRS_FRAME,
+  LTE_SL_FRAME,
+  LTE_SL_CTRL_FRAME,
+  LTE_SL_DATA_FRAME,
+  LTE_SL_DISC_FRAME,
+  LTE_SL_MIB_FRAME
+};
+
+/**
+ * \param params the signal
+ * \param [out] type the type of the signal
+ * \return true if the signal is an LTE signal
+ */
+static bool
+GetSignalType (Ptr<const SpectrumSignalParameters> params, LteSignalType *type)
+{
+  // the subclasses are checked before their parent
+  if (DynamicCast<const LteSpectrumSignalParametersSlCtrlFrame> (params))
+    {
+      *type = LTE_SL_CTRL_FRAME;
+    }
+  else if (DynamicCast<const LteSpectrumSignalParametersSlDataFrame> (params))
+    {
+      *type = LTE_SL_DATA_FRAME;
+    }
+  else if (DynamicCast<const LteSpectrumSignalParametersSlDiscFrame> (params))
+    {
+      *type = LTE_SL_DISC_FRAME;
+    }
+  else if (DynamicCast<const LteSpectrumSignalParametersSlMibFrame> (params))
+    {
+      *type = LTE_SL_MIB_FRAME;
+    }
+  else if (DynamicCast<const LteSpectrumSignalParametersSlFrame> (params))
+    {
+      *type = LTE_SL_FRAME;
+    }
+  else if (DynamicCast<const LteSpectrumSignalParametersDataFrame> (params))
+    {
+      *type = LTE_DATA_FRAME;
+    }
+  else if (DynamicCast<const LteSpectrumSignalParametersDlCtrlFrame> (params))
+    {
+      *type = LTE_DL_CTRL_FRAME;
+    }
+  else if (DynamicCast<const LteSpectrumSignalParametersUlSrsFrame> (params))
+    {
+      *type = LTE_UL_SRS_FRAME;
+    }
+  else if (DynamicCast<const LteSpectrumSignalParameters> (params))
+    {
+      *type = LTE_SIGNAL;
+    }
+  else
+    {
+      return false;
+    }
+  return true;
+}
+
+/**
+ * \param burst a packet burst, or null
+ * \return the size of the burst written by WriteBurst
+ */
+static uint32_t
+GetBurstSerializedSize (Ptr<const PacketBurst> burst)
+{
+  uint32_t size = 1;
+  if (burst != 0)
+    {
+      size += 4;
+      for (auto it = burst->Begin (); it != burst->End (); ++it)
+        {
+          size += DistributedSpectrumSignalCodec::GetPacketSerializedSize (*it);
+        }
+    }
+  return size;
+}
+
+/**
+ * Write a packet burst to a buffer.
+ *
+ * \param i the buffer iterator
+ * \param burst the packet burst, or null
+ */
+static void
+WriteBurst (Buffer::Iterator &i, Ptr<const PacketBurst> burst)
+{
+  i.WriteU8 (burst != 0 ? 1 : 0);
+  if (burst != 0)
+    {
+      i.WriteHtonU32 (burst->GetNPackets ());
+      for (auto it = burst->Begin (); it != burst->End (); ++it)
+        {
+          DistributedSpectrumSignalCodec::SerializePacket (i, *it);
+        }
+    }
+}
+
+/**
+ * Read a packet burst written by WriteBurst from a buffer.
+ *
+ * \param i the buffer iterator
+ * \return the packet burst, or null
+ */
+static Ptr<PacketBurst>
+ReadBurst (Buffer::Iterator &i)
+{
+  if (i.ReadU8 () == 0)
+    {
+      return 0;
+    }
+  Ptr<PacketBurst> burst = CreateObject<PacketBurst> ();
+  uint32_t n = i.ReadNtohU32 ();
+  for (uint32_t k = 0; k < n; k++)
+    {
+      burst->AddPacket (DistributedSpectrumSignalCodec::DeserializePacket (i));
+    }
+  return burst;
+}
+
+bool
+LteSpectrumSignalCodec::CanEncode (Ptr<const SpectrumSignalParameters> params) const
+{
+  LteSignalType type;
+  return GetSignalType (params, &type);
+}
+
+Ptr<Packet>
+LteSpectrumSignalCodec::Encode (Ptr<const SpectrumSignalParameters> params) const
+{
+  NS_LOG_FUNCTION (this << params);
+  LteSignalType type = LTE_SIGNAL;
+  GetSignalType (params, &type);
+  Ptr<const LteSpectrumSignalParametersSlFrame> sl = DynamicCast<const LteSpectrumSignalParametersSlFrame> (params);
+  Ptr<const LteSpectrumSignalParametersDataFrame> data = DynamicCast<const LteSpectrumSignalParametersDataFrame> (params);
+  Ptr<const LteSpectrumSignalParametersDlCtrlFrame> dlCtrl = DynamicCast<const LteSpectrumSignalParametersDlCtrlFrame> (params);
+  Ptr<const LteSpectrumSignalParametersUlSrsFrame> ulSrs = DynamicCast<const LteSpectrumSignalParametersUlSrsFrame> (params);
+
+  uint32_t size = 1;
+  switch (type)
+    {
+    case LTE_SIGNAL:
+      size += GetBurstSerializedSize (DynamicCast<const LteSpectrumSignalParameters> (params)->packetBurst);
+      break;
+    case LTE_DATA_FRAME:
+      if (!data->ctrlMsgList.empty ())
+        {
+          NS_LOG_LOGIC ("not sending the control messages to the other systems");
+        }
+      size += GetBurstSerializedSize (data->packetBurst) + 2;
+      break;
+    case LTE_DL_CTRL_FRAME:
+      size += 2 + 1;
+      break;
+    case LTE_UL_SRS_FRAME:
+      size += 2;
+      break;
+    case LTE_SL_FRAME:
+    case LTE_SL_MIB_FRAME:
+      size += GetBurstSerializedSize (sl->packetBurst) + 4 + 8;
+      break;
+    case LTE_SL_CTRL_FRAME:
+    case LTE_SL_DATA_FRAME:
+      size += GetBurstSerializedSize (sl->packetBurst) + 4 + 8 + 1;
+      break;
+    case LTE_SL_DISC_FRAME:
+      size += GetBurstSerializedSize (sl->packetBurst) + 4 + 8 + 4 + 1;
+      break;
+    }
+
+  Buffer buffer;
+  buffer.AddAtStart (size);
+  Buffer::Iterator i = buffer.Begin ();
+  i.WriteU8 (type);
+  switch (type)
+    {
+    case LTE_SIGNAL:
+      WriteBurst (i, DynamicCast<const LteSpectrumSignalParameters> (params)->packetBurst);
+      break;
+    case LTE_DATA_FRAME:
+      WriteBurst (i, data->packetBurst);
+      i.WriteHtonU16 (data->cellId);
+      break;
+    case LTE_DL_CTRL_FRAME:
+      i.WriteHtonU16 (dlCtrl->cellId);
+      i.WriteU8 (dlCtrl->pss ? 1 : 0);
+      break;
+    case LTE_UL_SRS_FRAME:
+      i.WriteHtonU16 (ulSrs->cellId);
+      break;
+    default:
+      WriteBurst (i, sl->packetBurst);
+      i.WriteHtonU32 (sl->nodeId);
+      i.WriteHtonU64 (sl->slssId);
+      break;
+    }
+  if (type == LTE_SL_CTRL_FRAME)
+    {
+      i.WriteU8 (DynamicCast<const LteSpectrumSignalParametersSlCtrlFrame> (params)->groupId);
+    }
+  else if (type == LTE_SL_DATA_FRAME)
+    {
+      i.WriteU8 (DynamicCast<const LteSpectrumSignalParametersSlDataFrame> (params)->groupId);
+    }
+  else if (type == LTE_SL_DISC_FRAME)
+    {
+      Ptr<const LteSpectrumSignalParametersSlDiscFrame> disc = DynamicCast<const LteSpectrumSignalParametersSlDiscFrame> (params);
+      i.WriteHtonU32 (disc->resNo);
+      i.WriteU8 (disc->rv);
+    }
+  return Create<Packet> (buffer.PeekData (), size);
+}
+
+Ptr<SpectrumSignalParameters>
+LteSpectrumSignalCodec::Decode (Ptr<Packet> p) const
+{
+  NS_LOG_FUNCTION (this << p);
+  Buffer buffer;
+  buffer.AddAtStart (p->GetSize ());
+  Buffer::Iterator i = buffer.Begin ();
+  std::vector<uint8_t> data (p->GetSize ());
+  p->CopyData (data.data (), data.size ());
+  i.Write (data.data (), data.size ());
+  i = buffer.Begin ();
+
+  LteSignalType type = static_cast<LteSignalType> (i.ReadU8 ());
+  switch (type)
+    {
+    case LTE_SIGNAL:
+      {
+        Ptr<LteSpectrumSignalParameters> params = Create<LteSpectrumSignalParameters> ();
+        params->packetBurst = ReadBurst (i);
+        return params;
+      }
+    case LTE_DATA_FRAME:
+      {
+        Ptr<LteSpectrumSignalParametersDataFrame> params = Create<LteSpectrumSignalParametersDataFrame> ();
+        params->packetBurst = ReadBurst (i);
+        params->cellId = i.ReadNtohU16 ();
+        return params;
+      }
+    case LTE_DL_CTRL_FRAME:
+      {
+        Ptr<LteSpectrumSignalParametersDlCtrlFrame> params = Create<LteSpectrumSignalParametersDlCtrlFrame> ();
+        params->cellId = i.ReadNtohU16 ();
+        params->pss = i.ReadU8 () != 0;
+        return params;
+      }
+    case LTE_UL_SRS_FRAME:
+      {
+        Ptr<LteSpectrumSignalParametersUlSrsFrame> params = Create<LteSpectrumSignalParametersUlSrsFrame> ();
+        params->cellId = i.ReadNtohU16 ();
+        return params;
+      }
+    default:
+      break;
+    }
+
+  Ptr<LteSpectrumSignalParametersSlFrame> params;
+  switch (type)
+    {
+    case LTE_SL_CTRL_FRAME:
+      params = Create<LteSpectrumSignalParametersSlCtrlFrame> ();
+      break;
+    case LTE_SL_DATA_FRAME:
+      params = Create<LteSpectrumSignalParametersSlDataFrame> ();
+      break;
+    case LTE_SL_DISC_FRAME:
+      params = Create<LteSpectrumSignalParametersSlDiscFrame> ();
+      break;
+    case LTE_SL_MIB_FRAME:
+      params = Create<LteSpectrumSignalParametersSlMibFrame> ();
+      break;
+    case LTE_SL_FRAME:
+      params = Create<LteSpectrumSignalParametersSlFrame> ();
+      break;
+    default:
+      NS_FATAL_ERROR ("Unknown LTE signal type " << (uint16_t) type);
+    }
+  params->packetBurst = ReadBurst (i);
+  params->nodeId = i.ReadNtohU32 ();
+  params->slssId = i.ReadNtohU64 ();
+  if (type == LTE_SL_CTRL_FRAME)
+    {
+      DynamicCast<LteSpectrumSignalParametersSlCtrlFrame> (params)->groupId = i.ReadU8 ();
+    }
+  else if (type == LTE_SL_DATA_FRAME)
+    {
+      DynamicCast<LteSpectrumSignalParametersSlDataFrame> (params)->groupId = i.ReadU8 ();
+    }
+  else if (type == LTE_SL_DISC_FRAME)
+    {
+      Ptr<LteSpectrumSignalParametersSlDiscFrame> disc = DynamicCast<LteSpectrumSignalParametersSlDiscFrame> (params);
+      disc->resNo = i.ReadNtohU32 ();
+      disc->rv = i.ReadU8 ();
+    }
+  return params;
+}
+
+/**
+ * \ingroup lte
+ *
+ * Add the LteSpectrumSignalCodec to the DistributedSpectrumChannel codecs when
+ * the lte module is loaded.
+ */
+static class LteSpectrumSignalCodecRegistration
+{
+public:
+  LteSpectrumSignalCodecRegistration ()
+  {
+    DistributedSpectrumSignalCodec::Add ("ns3::LteSpectrumSignalParameters",
+                                         Create<LteSpectrumSignalCodec> ());
+  }
+} g_lteSpectrumSignalCodecRegistration; ///< the codec registration
+
+} // namespace ns3
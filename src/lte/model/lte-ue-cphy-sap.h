@@ -259,6 +259,16 @@ public:
    */
   virtual void SetImsi (uint64_t imsi) = 0;
 
+  /**
+   * \brief Get the number of subframes that started since the last
+   * subframe indication reported to the RRC, and whose indications were
+   * skipped because the UE was idle (see the LteUePhy SkipIdleSubframes
+   * attribute)
+   * \return the number of skipped subframes, 0 if the indications are not
+   * skipped
+   */
+  virtual uint32_t GetSkippedSubframes () = 0;
+
 };
 
 
@@ -448,6 +458,7 @@ public:
   virtual void ResetRlfParams ();
   virtual void StartInSnycDetection ();
   virtual void SetImsi (uint64_t imsi);
+  virtual uint32_t GetSkippedSubframes ();
 
 private:
   MemberLteUeCphySapProvider ();
@@ -574,6 +585,12 @@ void MemberLteUeCphySapProvider<C>::SetImsi (uint64_t imsi)
   m_owner->DoSetImsi (imsi);
 }
 
+template <class C>
+uint32_t MemberLteUeCphySapProvider<C>::GetSkippedSubframes ()
+{
+  return m_owner->DoGetSkippedSubframes ();
+}
+
 
 
 //Sidelink discovery
@@ -43,6 +43,7 @@
 #include <ns3/lte-common.h>
 
 #include <bitset>
+#include <algorithm>
 
 
 namespace ns3 {
@@ -283,6 +284,7 @@ public:
   virtual void NotifyChangeOfTiming (uint32_t frameNo, uint32_t subframeNo);
   virtual void NotifySidelinkEnabled ();
   virtual void NotifyUlTransmission ();
+  virtual uint32_t GetIdleSubframes (uint32_t frameNo, uint32_t subframeNo);
 
 private:
   LteUeMac* m_mac; ///< the UE MAC
@@ -341,6 +343,12 @@ UeMemberLteUePhySapUser::NotifyUlTransmission ()
   m_mac->DoNotifyUlTransmission ();
 }
 
+uint32_t
+UeMemberLteUePhySapUser::GetIdleSubframes (uint32_t frameNo, uint32_t subframeNo)
+{
+  return m_mac->DoGetIdleSubframes (frameNo, subframeNo);
+}
+
 
 //////////////////////////////////////////////////////////
 // LteUeMac methods
@@ -409,6 +417,8 @@ LteUeMac::LteUeMac ()
   m_rnti (0),
      m_imsi (0),
   m_rachConfigured (false),
+  m_frameNo (0),
+  m_subframeNo (0),
   m_waitingForRaResponse (false),
   m_slBsrPeriodicity (MilliSeconds (1)),
   m_slBsrLast (MilliSeconds (0)),
@@ -508,6 +518,7 @@ void
 LteUeMac::DoTransmitPdu (LteMacSapProvider::TransmitPduParameters params)
 {
   NS_LOG_FUNCTION (this);
+  UpdateSkippedSubframes ();
   NS_ASSERT_MSG (m_rnti == params.rnti, "RNTI mismatch between RLC and MAC");
 
   if (params.discMsg)
@@ -594,6 +605,7 @@ LteUeMac::DoTransmitPdu (LteMacSapProvider::TransmitPduParameters params)
 
         }
     }
+  m_uePhySapProvider->ResumeSubframeIndication ();
 }
 
 void
@@ -644,6 +656,7 @@ LteUeMac::DoReportBufferStatus (LteMacSapProvider::ReportBufferStatusParameters
         }
       m_freshSlBsr = true;
     }
+  m_uePhySapProvider->ResumeSubframeIndication ();
 }
 
 
@@ -1015,6 +1028,7 @@ void
 LteUeMac::DoSetSlDiscTxPool (Ptr<SidelinkTxDiscResourcePool> pool)
 {
   NS_LOG_FUNCTION (this);
+  UpdateSkippedSubframes ();
   //NS_ASSERT_MSG (m_discTxPool.m_pool != nullptr, "Cannot add discovery transmission pool for " << m_rnti << ". Pool already exist for destination");
   DiscPoolInfo info;
   info.m_pool = pool;
@@ -1038,6 +1052,7 @@ LteUeMac::DoSetSlDiscTxPool (Ptr<SidelinkTxDiscResourcePool> pool)
 
   info.m_nextGrants.clear ();
   m_discTxPool = info;
+  m_uePhySapProvider->ResumeSubframeIndication ();
 }
 
 void
@@ -1058,6 +1073,7 @@ void
 LteUeMac::DoAddSlCommTxPool (uint32_t dstL2Id, Ptr<SidelinkTxCommResourcePool> pool)
 {
   NS_LOG_FUNCTION (this << dstL2Id << pool);
+  UpdateSkippedSubframes ();
   std::map <uint32_t, PoolInfo >::iterator it;
   it = m_sidelinkTxPoolsMap.find (dstL2Id);
   NS_ASSERT_MSG (it == m_sidelinkTxPoolsMap.end (), "Cannot add Sidelink transmission pool for " << dstL2Id << ". Pool already exist for destination");
@@ -1087,6 +1103,7 @@ LteUeMac::DoAddSlCommTxPool (uint32_t dstL2Id, Ptr<SidelinkTxCommResourcePool> p
   info.m_grantReceived = false;
 
   m_sidelinkTxPoolsMap.insert (std::pair<uint32_t, PoolInfo > (dstL2Id, info));
+  m_uePhySapProvider->ResumeSubframeIndication ();
 }
 
 void
@@ -1195,6 +1212,7 @@ void
 LteUeMac::DoReceiveSlSciPhyPdu (Ptr<Packet> p)
 {
   NS_LOG_FUNCTION (this);
+  UpdateSkippedSubframes ();
 
   LteSlSciHeader sciHeader;
   p->PeekHeader (sciHeader);
@@ -1221,17 +1239,18 @@ LteUeMac::DoReceiveSlSciPhyPdu (Ptr<Packet> p)
 
           SidelinkCommResourcePool::SubframeInfo tmp = (*poolIt)->GetCurrentScPeriod (m_slSchedTime.frameNo - 1, m_slSchedTime.subframeNo - 1);
 
-          std::list<SidelinkCommResourcePool::SidelinkTransmissionInfo> psschTx = (*poolIt)->GetPsschTransmissions (tmp, sciHeader.GetTrp (), sciHeader.GetRbStart (), sciHeader.GetRbLen ());
-          std::list<SidelinkCommResourcePool::SidelinkTransmissionInfo>::iterator rxIt;
+          const std::vector<SidelinkCommResourcePool::SidelinkTransmissionInfo> &psschTx = (*poolIt)->GetPsschTransmissionVector (tmp, sciHeader.GetTrp (), sciHeader.GetRbStart (), sciHeader.GetRbLen ());
+          std::vector<SidelinkCommResourcePool::SidelinkTransmissionInfo>::const_iterator rxIt;
           for (rxIt = psschTx.begin (); rxIt != psschTx.end (); rxIt++)
             {
               //adjust for index starting at 1
-              rxIt->subframe.frameNo++;
-              rxIt->subframe.subframeNo++;
-              NS_LOG_INFO ("Subframe Rx " << rxIt->subframe.frameNo << "/" << rxIt->subframe.subframeNo);
-              if (m_slSchedTime < rxIt->subframe)
+              SidelinkCommResourcePool::SubframeInfo rxSubframe = rxIt->subframe;
+              rxSubframe.frameNo++;
+              rxSubframe.subframeNo++;
+              NS_LOG_INFO ("Subframe Rx " << rxSubframe.frameNo << "/" << rxSubframe.subframeNo);
+              if (m_slSchedTime < rxSubframe)
                 {
-                  m_psschRxSet.insert (rxIt->subframe);
+                  m_psschRxSet.insert (rxSubframe);
                 }
               else
                 {
@@ -1245,6 +1264,7 @@ LteUeMac::DoReceiveSlSciPhyPdu (Ptr<Packet> p)
             }
         }
     }
+  m_uePhySapProvider->ResumeSubframeIndication ();
 }
 
 void
@@ -1522,11 +1542,56 @@ LteUeMac::RefreshHarqProcessesPacketBuffer (void)
     }
 }
 
+void
+LteUeMac::UpdateSkippedSubframes (void)
+{
+  if (m_frameNo == 0)
+    {
+      // no subframe indicated yet
+      return;
+    }
+  // The subframes whose start is strictly in the past were indicated, or
+  // skipped by the PHY. The indication of a subframe starting now counts as
+  // not triggered yet.
+  Time elapsed = Simulator::Now () - m_lastSubframeIndicationTime;
+  if (!elapsed.IsStrictlyPositive ())
+    {
+      return;
+    }
+  Time tti = m_uePhySapProvider->GetTti ();
+  uint32_t skipped = (elapsed.GetTimeStep () - 1) / tti.GetTimeStep ();
+  if (skipped == 0)
+    {
+      return;
+    }
+  NS_LOG_LOGIC (this << " " << skipped << " subframes skipped after " << m_frameNo << "/" << m_subframeNo);
+  LteSubframeNumbering::Advance (m_frameNo, m_subframeNo, skipped);
+  m_harqProcessId = (m_harqProcessId + skipped) % HARQ_PERIOD;
+  m_lastSubframeIndicationTime += tti * static_cast<int64_t> (skipped);
+  if (m_sidelinkEnabled)
+    {
+      // the sidelink scheduling time is updated by the delayed indication
+      // of each subframe, which did not run yet for the current one
+      uint32_t frameNo = m_frameNo;
+      uint32_t subframeNo = m_subframeNo;
+      uint32_t delay = UL_PUSCH_TTIS_DELAY;
+      if (Simulator::Now () <= m_lastSubframeIndicationTime + SL_SF_INDICATION_DELAY)
+        {
+          delay += LteSubframeNumbering::SUBFRAMES_PER_CYCLE - 1;
+        }
+      LteSubframeNumbering::Advance (frameNo, subframeNo, delay);
+      m_slSchedTime.frameNo = frameNo;
+      m_slSchedTime.subframeNo = subframeNo;
+    }
+}
+
 
 void
 LteUeMac::DoSubframeIndication (uint32_t frameNo, uint32_t subframeNo)
 {
   NS_LOG_FUNCTION (this << frameNo << subframeNo);
+  UpdateSkippedSubframes ();
+  m_lastSubframeIndicationTime = Simulator::Now ();
   m_frameNo = frameNo;
   m_subframeNo = subframeNo;
   RefreshHarqProcessesPacketBuffer ();
@@ -2230,6 +2295,9 @@ LteUeMac::DoSlDelayedSubframeIndication (uint32_t frameNo, uint32_t subframeNo)
 
         }     //end loop through discovery grants
     }
+
+  //The transmissions scheduled in this subframe may end the idle period of the PHY
+  m_uePhySapProvider->ResumeSubframeIndication ();
 }
 
 void
@@ -2342,4 +2410,80 @@ LteUeMac::DoNotifyUlTransmission ()
   m_hasUlToTx = true;
 }
 
+uint32_t
+LteUeMac::DoGetIdleSubframes (uint32_t frameNo, uint32_t subframeNo)
+{
+  NS_LOG_FUNCTION (this << frameNo << subframeNo);
+
+  if (m_freshUlBsr || m_freshSlBsr || m_slSynchPendingTxMsg)
+    {
+      return 0;
+    }
+  for (uint16_t i = 0; i < m_miUlHarqProcessesPacketTimer.size (); i++)
+    {
+      if (m_miUlHarqProcessesPacketTimer.at (i) != 0 || m_miUlHarqProcessesPacket.at (i)->GetNPackets () > 0)
+        {
+          return 0;
+        }
+    }
+  uint32_t idle = LteSubframeNumbering::SUBFRAMES_PER_CYCLE;
+  if (!m_sidelinkEnabled)
+    {
+      return idle;
+    }
+
+  //The sidelink scheduling is UL_PUSCH_TTIS_DELAY subframes ahead of the PHY
+  uint32_t schedFrameNo = frameNo;
+  uint32_t schedSubframeNo = subframeNo;
+  LteSubframeNumbering::Advance (schedFrameNo, schedSubframeNo, UL_PUSCH_TTIS_DELAY);
+
+  for (const auto &poolIt : m_sidelinkTxPoolsMap)
+    {
+      if (poolIt.second.m_nextScPeriod.frameNo == 0)
+        {
+          return 0;
+        }
+      idle = std::min (idle, LteSubframeNumbering::GetDistance (schedFrameNo, schedSubframeNo,
+                                                                poolIt.second.m_nextScPeriod.frameNo,
+                                                                poolIt.second.m_nextScPeriod.subframeNo));
+      if (!poolIt.second.m_pscchTx.empty ())
+        {
+          const SidelinkCommResourcePool::SubframeInfo &txSubframe = poolIt.second.m_pscchTx.front ().subframe;
+          idle = std::min (idle, LteSubframeNumbering::GetDistance (schedFrameNo, schedSubframeNo,
+                                                                    txSubframe.frameNo, txSubframe.subframeNo));
+        }
+      if (!poolIt.second.m_psschTx.empty ())
+        {
+          const SidelinkCommResourcePool::SubframeInfo &txSubframe = poolIt.second.m_psschTx.front ().subframe;
+          idle = std::min (idle, LteSubframeNumbering::GetDistance (schedFrameNo, schedSubframeNo,
+                                                                    txSubframe.frameNo, txSubframe.subframeNo));
+        }
+    }
+  for (const auto &rxSubframe : m_psschRxSet)
+    {
+      idle = std::min (idle, LteSubframeNumbering::GetDistance (schedFrameNo, schedSubframeNo,
+                                                                rxSubframe.frameNo, rxSubframe.subframeNo));
+    }
+  if (m_discTxPool.m_pool != nullptr)
+    {
+      if (m_discTxPool.m_nextDiscPeriod.frameNo == 0)
+        {
+          return 0;
+        }
+      idle = std::min (idle, LteSubframeNumbering::GetDistance (schedFrameNo, schedSubframeNo,
+                                                                m_discTxPool.m_nextDiscPeriod.frameNo,
+                                                                m_discTxPool.m_nextDiscPeriod.subframeNo));
+      for (const auto &grantIt : m_discTxPool.m_currentGrants)
+        {
+          if (!grantIt.m_psdchTx.empty ())
+            {
+              const SidelinkDiscResourcePool::SubframeInfo &txSubframe = grantIt.m_psdchTx.front ().subframe;
+              idle = std::min (idle, LteSubframeNumbering::GetDistance (schedFrameNo, schedSubframeNo,
+                                                                        txSubframe.frameNo, txSubframe.subframeNo));
+            }
+        }
+    }
+  return idle;
+}
+
 } // namespace ns3
@@ -349,6 +349,17 @@ private:
    */
   void DoNotifyUlTransmission ();
 
+  /**
+   * Get idle subframes function
+   * The PHY asks the MAC how many subframes it can skip
+   *
+   * \param frameNo The frame number of the first subframe
+   * \param subframeNo The subframe number of the first subframe
+   * \return The number of consecutive subframes, starting with the given
+   *         one, in which the MAC has nothing to do
+   */
+  uint32_t DoGetIdleSubframes (uint32_t frameNo, uint32_t subframeNo);
+
   // internal methods
   /// Randomly select and send RA preamble function
   void RandomlySelectAndSendRaPreamble ();
@@ -386,6 +397,12 @@ private:
    * Refresh HARQ processes packet buffer function
    */
   void RefreshHarqProcessesPacketBuffer (void);
+  /**
+   * Move the frame and subframe numbers, the HARQ process and the sidelink
+   * scheduling time past the subframes whose indications were skipped by
+   * the PHY while the UE was idle
+   */
+  void UpdateSkippedSubframes (void);
 
   /// component carrier Id --> used to address sap
   uint8_t m_componentCarrierId;
@@ -582,6 +599,8 @@ private:
   bool m_hasSlCommToRx; ///< True if sidelink communication is expected in the current TTI/subframe
 
   SidelinkCommResourcePool::SubframeInfo m_slSchedTime; ///< Current time regarding sidelink scheduling
+
+  Time m_lastSubframeIndicationTime; ///< Start time of the last subframe indicated, or skipped by the PHY
 };
 
 } // namespace ns3
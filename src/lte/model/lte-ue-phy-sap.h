@@ -25,6 +25,7 @@
 #define LTE_UE_PHY_SAP_H
 
 #include <ns3/packet.h>
+#include <ns3/nstime.h>
 
 namespace ns3 {
 
@@ -121,6 +122,21 @@ public:
    */
   virtual void NotifyConnectionSuccessful () = 0;
 
+  /**
+   * \brief Notify the PHY that the MAC has new work to do, e.g., a new
+   * buffer status report, so that the PHY triggers again the subframe
+   * indications it skips while the UE is idle
+   */
+  virtual void ResumeSubframeIndication () = 0;
+
+  /**
+   * \brief Get the duration of a subframe, so that the MAC counts the
+   * subframes skipped by the PHY with the same TTI
+   *
+   * \return The TTI of the PHY
+   */
+  virtual Time GetTti () = 0;
+
 };
 
 
@@ -195,6 +211,16 @@ public:
    */
   virtual void NotifyUlTransmission () = 0;
 
+  /**
+   * \brief Get the number of consecutive subframes in which the MAC has
+   * nothing to do, so that the PHY can skip their subframe indications
+   *
+   * \param frameNo The frame number of the first subframe
+   * \param subframeNo The subframe number of the first subframe
+   * \return The number of idle subframes starting with the given one
+   */
+  virtual uint32_t GetIdleSubframes (uint32_t frameNo, uint32_t subframeNo) = 0;
+
 };
 
 } // namespace ns3
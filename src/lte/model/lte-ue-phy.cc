@@ -29,6 +29,7 @@
 #include <ns3/node.h>
 #include <cfloat>
 #include <cmath>
+#include <algorithm>
 #include <ns3/simulator.h>
 #include <ns3/double.h>
 #include "lte-ue-phy.h"
@@ -95,6 +96,8 @@ public:
   virtual void SendLteControlMessage (Ptr<LteControlMessage> msg);
   virtual void SendRachPreamble (uint32_t prachId, uint32_t raRnti);
   virtual void NotifyConnectionSuccessful ();
+  virtual void ResumeSubframeIndication ();
+  virtual Time GetTti ();
 
 private:
   LteUePhy* m_phy; ///< the Phy
@@ -135,6 +138,18 @@ UeMemberLteUePhySapProvider::NotifyConnectionSuccessful ()
   m_phy->DoNotifyConnectionSuccessful ();
 }
 
+void
+UeMemberLteUePhySapProvider::ResumeSubframeIndication ()
+{
+  m_phy->DoResumeSubframeIndication ();
+}
+
+Time
+UeMemberLteUePhySapProvider::GetTti ()
+{
+  return Seconds (m_phy->GetTti ());
+}
+
 
 ////////////////////////////////////////
 // LteUePhy methods
@@ -187,7 +202,11 @@ LteUePhy::LteUePhy (Ptr<LteSpectrumPhy> dlPhy, Ptr<LteSpectrumPhy> ulPhy)
   m_currFrameNo (0),
   m_currSubframeNo (0),
   m_resyncRequested (false),
-  m_waitingNextScPeriod (false)
+  m_waitingNextScPeriod (false),
+  m_slssConfigured (false),
+  m_slTbExpected (false),
+  m_lastFrameNo (0),
+  m_lastSubframeNo (0)
 {
   m_amc = CreateObject <LteAmc> ();
   m_powerControl = CreateObject <LteUePowerControl> ();
@@ -433,6 +452,13 @@ LteUePhy::GetTypeId (void)
                    BooleanValue (false),
                    MakeBooleanAccessor (&LteUePhy::m_chooseFrameAndSubframeRandomly),
                    MakeBooleanChecker ())
+    .AddAttribute ("SkipIdleSubframes",
+                   "If True, the subframe indications are skipped while the UE is out of coverage and has "
+                   "nothing to do until its next sidelink transmission or reception opportunity. The frame "
+                   "and subframe numbers and the results are the same as when all the subframes are indicated",
+                   BooleanValue (false),
+                   MakeBooleanAccessor (&LteUePhy::m_skipIdleSubframes),
+                   MakeBooleanChecker ())
     .AddAttribute ("MinSrsrp",
                    "The minimum S-RSRP required to consider a SyncRef detectable",
                    DoubleValue (-125),
@@ -618,6 +644,7 @@ LteUePhy::DoSendMacPdu (Ptr<Packet> p)
   NS_LOG_FUNCTION (this);
 
   SetMacPdu (p);
+  DoResumeSubframeIndication ();
 }
 
 void
@@ -645,6 +672,7 @@ LteUePhy::DoSendSlMacPdu (Ptr<Packet> p, LteUePhySapProvider::TransmitSlPhySduPa
 
   NS_ASSERT_MSG (m_packetParamsQueue.at (m_packetParamsQueue.size () - 1).size () == 0, "Error: Can only send one sidelink message per TTI");
   m_packetParamsQueue.at (m_packetParamsQueue.size () - 1).push_back (params);
+  DoResumeSubframeIndication ();
 }
 
 std::list <LteUePhySapProvider::TransmitSlPhySduParameters>
@@ -734,6 +762,7 @@ LteUePhy::PhyPscchPduReceived (Ptr<Packet> p)
     }
   //Pass information to the MAC
   m_uePhySapUser->ReceiveSlSciPhyPdu (p);
+  DoResumeSubframeIndication ();
 }
 
 void
@@ -760,7 +789,8 @@ LteUePhy::PhyPsbchPduReceived (Ptr<Packet> p, uint16_t slssid)
                                 (std::pair<uint16_t, uint16_t> (slssid, rxOffset), mibSl));
     }
 
-  //Pass the message to the RRC
+  //Report the skipped subframes before passing the message to the RRC
+  DoResumeSubframeIndication ();
   m_ueCphySapUser->ReceiveMibSL (p, slssid);
 
 }
@@ -1062,6 +1092,7 @@ LteUePhy::ReportInterference (const SpectrumValue& interf)
   NS_LOG_FUNCTION (this << interf);
   m_rsInterferencePowerUpdated = true;
   m_rsInterferencePower = interf;
+  DoResumeSubframeIndication ();
 }
 
 void
@@ -1079,6 +1110,7 @@ LteUePhy::ReportRsReceivedPower (const SpectrumValue& power)
   NS_LOG_FUNCTION (this << power);
   m_rsReceivedPowerUpdated = true;
   m_rsReceivedPower = power;
+  DoResumeSubframeIndication ();
 
   if (m_enableUplinkPowerControl)
     {
@@ -1257,6 +1289,7 @@ LteUePhy::DoSendLteControlMessage (Ptr<LteControlMessage> msg)
   NS_LOG_FUNCTION (this << msg);
 
   SetControlMessages (msg);
+  DoResumeSubframeIndication ();
 }
 
 void
@@ -1270,6 +1303,7 @@ LteUePhy::DoSendRachPreamble (uint32_t raPreambleId, uint32_t raRnti)
   m_raPreambleId = raPreambleId;
   m_raRnti = raRnti;
   m_controlMessagesQueue.at (0).push_back (msg);
+  DoResumeSubframeIndication ();
 }
 
 void
@@ -1505,6 +1539,7 @@ LteUePhy::ReceivePss (uint16_t cellId, Ptr<SpectrumValue> p)
   el.pssPsdSum = sum;
   el.nRB = nRB;
   m_pssList.push_back (el);
+  DoResumeSubframeIndication ();
 
 } // end of void LteUePhy::ReceivePss (uint16_t cellId, Ptr<SpectrumValue> p)
 
@@ -1523,6 +1558,8 @@ LteUePhy::SubframeIndication (uint32_t frameNo, uint32_t subframeNo)
 
   NS_ASSERT_MSG (frameNo > 0, "the SRS index check code assumes that frameNo starts at 1");
 
+  m_lastSubframeTime = Simulator::Now ();
+
   // refresh internal variables
   m_rsReceivedPowerUpdated = false;
   m_rsInterferencePowerUpdated = false;
@@ -1531,6 +1568,7 @@ LteUePhy::SubframeIndication (uint32_t frameNo, uint32_t subframeNo)
   if (m_sidelinkSpectrumPhy)
     {
       m_sidelinkSpectrumPhy->ClearExpectedSlTb ();
+      m_slTbExpected = false;
       //Notify RRC about the current Subframe indication
       m_ueCphySapUser->ReportSubframeIndication (frameNo, subframeNo);
     }
@@ -1550,6 +1588,8 @@ LteUePhy::SubframeIndication (uint32_t frameNo, uint32_t subframeNo)
           NS_LOG_LOGIC ("(re)synchronization postponed");
         }
     }
+  m_lastFrameNo = frameNo;
+  m_lastSubframeNo = subframeNo;
 
   if (m_ulConfigured)
     {
@@ -1645,6 +1685,7 @@ LteUePhy::SubframeIndication (uint32_t frameNo, uint32_t subframeNo)
                                                         grantIt->second.m_psschTx.size () % 4 == 0,
                                                         grantIt->second.m_grant.m_tbSize,
                                                         grantIt->second.m_grant.m_mcs, rbMap, rv);
+                  m_slTbExpected = true;
                   //remove reception information
                   grantIt->second.m_psschTx.erase (rxIt);
 
@@ -1882,7 +1923,179 @@ LteUePhy::SubframeIndication (uint32_t frameNo, uint32_t subframeNo)
     }
 
   // schedule next subframe indication
-  Simulator::Schedule (Seconds (GetTti ()), &LteUePhy::SubframeIndication, this, frameNo, subframeNo);
+  ScheduleSubframeIndication (frameNo, subframeNo);
+}
+
+
+uint32_t
+LteUePhy::GetIdleSubframes (uint32_t frameNo, uint32_t subframeNo)
+{
+  NS_LOG_FUNCTION (this << frameNo << subframeNo);
+
+  // Only the out-of-coverage UEs without sidelink synchronization skip
+  // subframes, and only while no transmission is queued and no
+  // downlink signal is being processed
+  if (!m_skipIdleSubframes || m_cellId != 0 || m_srsConfigured || m_slssConfigured
+      || m_resyncRequested || m_waitingNextScPeriod
+      || m_ueSlssScanningInProgress || m_ueSlssMeasurementInProgress
+      || m_rsReceivedPowerUpdated || m_rsInterferencePowerUpdated || m_pssReceived
+      || m_slTbExpected || !m_subChannelsForTransmission.empty ())
+    {
+      return 0;
+    }
+  for (uint32_t i = 0; i < m_packetBurstQueue.size (); i++)
+    {
+      if (m_packetBurstQueue.at (i)->GetNPackets () > 0)
+        {
+          return 0;
+        }
+    }
+  for (uint32_t i = 0; i < m_controlMessagesQueue.size (); i++)
+    {
+      if (!m_controlMessagesQueue.at (i).empty ())
+        {
+          return 0;
+        }
+    }
+  for (uint32_t i = 0; i < m_packetParamsQueue.size (); i++)
+    {
+      if (!m_packetParamsQueue.at (i).empty ())
+        {
+          return 0;
+        }
+    }
+  for (uint32_t i = 0; i < m_subChannelsForTransmissionQueue.size (); i++)
+    {
+      if (!m_subChannelsForTransmissionQueue.at (i).empty ())
+        {
+          return 0;
+        }
+    }
+
+  uint32_t idle = LteSubframeNumbering::SUBFRAMES_PER_CYCLE;
+  if (m_ulConfigured)
+    {
+      // wake up at the start of the periods of the pools and at the
+      // expected PSSCH receptions
+      if (m_slTxPoolInfo.m_pool)
+        {
+          if (m_slTxPoolInfo.m_nextScPeriod.frameNo == 0)
+            {
+              return 0;
+            }
+          idle = std::min (idle, LteSubframeNumbering::GetDistance (frameNo, subframeNo,
+                                                                    m_slTxPoolInfo.m_nextScPeriod.frameNo,
+                                                                    m_slTxPoolInfo.m_nextScPeriod.subframeNo));
+        }
+      for (const auto &it : m_discRxPools)
+        {
+          if (it.m_nextDiscPeriod.frameNo == 0)
+            {
+              return 0;
+            }
+          idle = std::min (idle, LteSubframeNumbering::GetDistance (frameNo, subframeNo,
+                                                                    it.m_nextDiscPeriod.frameNo,
+                                                                    it.m_nextDiscPeriod.subframeNo));
+        }
+      for (const auto &it : m_sidelinkRxPools)
+        {
+          for (const auto &grantIt : it.m_currentGrants)
+            {
+              if (grantIt.second.m_grantReceived)
+                {
+                  return 0;
+                }
+              if (!grantIt.second.m_psschTx.empty ())
+                {
+                  const SidelinkCommResourcePool::SubframeInfo &rxSubframe = grantIt.second.m_psschTx.front ().subframe;
+                  idle = std::min (idle, LteSubframeNumbering::GetDistance (frameNo, subframeNo,
+                                                                            rxSubframe.frameNo,
+                                                                            rxSubframe.subframeNo));
+                }
+            }
+        }
+    }
+  if (idle > 0)
+    {
+      idle = std::min (idle, m_uePhySapUser->GetIdleSubframes (frameNo, subframeNo));
+    }
+  return idle;
+}
+
+void
+LteUePhy::ScheduleSubframeIndication (uint32_t frameNo, uint32_t subframeNo)
+{
+  NS_LOG_FUNCTION (this << frameNo << subframeNo);
+  uint32_t idle = GetIdleSubframes (frameNo, subframeNo);
+  if (idle > 0)
+    {
+      NS_LOG_LOGIC ("Skipping the indications of " << idle << " idle subframes");
+      LteSubframeNumbering::Advance (frameNo, subframeNo, idle);
+    }
+  Time delay = m_lastSubframeTime + Seconds (GetTti ()) * static_cast<int64_t> (1 + idle) - Simulator::Now ();
+  m_subframeIndicationEvent = Simulator::Schedule (delay, &LteUePhy::SubframeIndication, this, frameNo, subframeNo);
+}
+
+void
+LteUePhy::DoResumeSubframeIndication ()
+{
+  NS_LOG_FUNCTION (this);
+  if (!m_skipIdleSubframes || !m_subframeIndicationEvent.IsRunning ())
+    {
+      // all the subframes are indicated, or the next subframe indication
+      // is not scheduled yet, e.g., because the current one is running
+      return;
+    }
+
+  Time tti = Seconds (GetTti ());
+  uint32_t skipped = DoGetSkippedSubframes ();
+  if (skipped > 0)
+    {
+      LteSubframeNumbering::Advance (m_lastFrameNo, m_lastSubframeNo, skipped);
+      m_lastSubframeTime += tti * static_cast<int64_t> (skipped);
+      m_subframeNo = m_lastSubframeNo;
+      if (m_sidelinkSpectrumPhy)
+        {
+          m_ueCphySapUser->ReportSubframeIndication (m_lastFrameNo, m_lastSubframeNo);
+        }
+    }
+
+  uint32_t frameNo = m_lastFrameNo;
+  uint32_t subframeNo = m_lastSubframeNo;
+  LteSubframeNumbering::Advance (frameNo, subframeNo, 1);
+  uint32_t idle = GetIdleSubframes (frameNo, subframeNo);
+  if (m_lastSubframeTime + tti * static_cast<int64_t> (1 + idle) >= TimeStep (m_subframeIndicationEvent.GetTs ()))
+    {
+      return;
+    }
+
+  uint32_t nodeId = m_netDevice->GetNode ()->GetId ();
+  if (Simulator::GetContext () != nodeId)
+    {
+      // the subframe indications run in the context of the node
+      Simulator::ScheduleWithContext (nodeId, Seconds (0), &LteUePhy::DoResumeSubframeIndication, this);
+      return;
+    }
+  NS_LOG_LOGIC ("Resuming the subframe indications at " << frameNo << "/" << subframeNo);
+  m_subframeIndicationEvent.Cancel ();
+  ScheduleSubframeIndication (frameNo, subframeNo);
+}
+
+uint32_t
+LteUePhy::DoGetSkippedSubframes ()
+{
+  if (!m_skipIdleSubframes || !m_subframeIndicationEvent.IsRunning ())
+    {
+      return 0;
+    }
+  // The subframes whose start is strictly in the past were idle. The
+  // indication of a subframe starting now counts as not triggered yet.
+  Time elapsed = Simulator::Now () - m_lastSubframeTime;
+  if (!elapsed.IsStrictlyPositive ())
+    {
+      return 0;
+    }
+  return (elapsed.GetTimeStep () - 1) / Seconds (GetTti ()).GetTimeStep ();
 }
 
 
@@ -1996,6 +2209,7 @@ LteUePhy::DoSynchronizeWithEnb (uint16_t cellId)
   m_ulConfigured = false;
 
   SwitchToState (SYNCHRONIZED);
+  DoResumeSubframeIndication ();
 }
 
 void
@@ -2049,6 +2263,7 @@ LteUePhy::DoConfigureUplink (uint32_t ulEarfcn, uint8_t ulBandwidth)
           m_sidelinkSpectrumPhy->GetChannel ()->AddRx (m_sidelinkSpectrumPhy);
         }
     }
+  DoResumeSubframeIndication ();
 }
 
 void
@@ -2088,6 +2303,7 @@ LteUePhy::DoSetSrsConfigurationIndex (uint16_t srcCi)
   // if we use a static one, we can have a 0ms guard time
   m_srsStartTime = Simulator::Now () + MilliSeconds (0);
   NS_LOG_DEBUG (this << " UE SRS P " << m_srsPeriodicity << " RNTI " << m_rnti << " offset " << m_srsSubframeOffset << " cellId " << m_cellId << " CI " << srcCi);
+  DoResumeSubframeIndication ();
 }
 
 void
@@ -2322,6 +2538,7 @@ LteUePhy::ReceiveLteDlHarqFeedback (DlInfoListElement_s m)
   Ptr<DlHarqFeedbackLteControlMessage> msg = Create<DlHarqFeedbackLteControlMessage> ();
   msg->SetDlHarqFeedback (m);
   SetControlMessages (msg);
+  DoResumeSubframeIndication ();
 }
 
 void
@@ -2393,6 +2610,7 @@ LteUePhy::DoSetSlDiscRxPools (std::list<Ptr<SidelinkRxDiscResourcePool> > pools)
           m_sidelinkSpectrumPhy->SetDiscNumRetx (newpool.m_pool->GetNumRetx ());
         }
     }
+  DoResumeSubframeIndication ();
 }
 
 void
@@ -2439,6 +2657,7 @@ LteUePhy::DoSetSlCommTxPool (Ptr<SidelinkTxCommResourcePool> pool)
   m_slTxPoolInfo.m_pool = pool;
   m_slTxPoolInfo.m_nextScPeriod.frameNo = 0; //init to 0 to make it invalid
   m_slTxPoolInfo.m_nextScPeriod.subframeNo = 0; //init to 0 to make it invalid
+  DoResumeSubframeIndication ();
 }
 
 void
@@ -2521,6 +2740,8 @@ LteUePhy::SetFirstScanningTime (Time t)
   NS_LOG_FUNCTION (this);
   m_tFirstScanning = t;
   Simulator::Schedule (m_tFirstScanning,&LteUePhy::StartSlssScanning, this);
+  m_slssConfigured = true;
+  DoResumeSubframeIndication ();
 }
 
 Time
@@ -2638,6 +2859,7 @@ LteUePhy::StartSlssScanning ()
   m_ueSlssScanningInProgress = true;
   m_detectedMibSl.clear ();
   Simulator::Schedule (m_ueSlssScanningPeriod, &LteUePhy::EndSlssScanning, this);
+  DoResumeSubframeIndication ();
 }
 
 void
@@ -3071,6 +3293,8 @@ LteUePhy::DoSetSlssId (uint64_t slssid)
   NS_LOG_FUNCTION (this);
   m_uplinkSpectrumPhy->SetSlssid (slssid);
   m_sidelinkSpectrumPhy->SetSlssid (slssid);
+  m_slssConfigured = true;
+  DoResumeSubframeIndication ();
 }
 
 void
@@ -3085,6 +3309,7 @@ LteUePhy::DoSynchronizeToSyncRef (LteSlSyncParams synchParams)
   //Request the synchronization (change of timing) for the next subframe
   m_resyncRequested = true;
   m_resyncParams = synchParams;
+  DoResumeSubframeIndication ();
 }
 
 int64_t
@@ -548,6 +548,24 @@ private:
    */
   void InitializeDiscRxPool (uint32_t frameNo, uint32_t subframeNo);
 
+  /**
+   * Get the number of consecutive subframes in which the UE has nothing to
+   * do, i.e., whose subframe indications can be skipped when the
+   * SkipIdleSubframes attribute is true
+   *
+   * \param frameNo The frame number of the first subframe
+   * \param subframeNo The subframe number of the first subframe
+   * \return The number of idle subframes starting with the given one
+   */
+  uint32_t GetIdleSubframes (uint32_t frameNo, uint32_t subframeNo);
+  /**
+   * Schedule the next subframe indication, after the idle subframes
+   *
+   * \param frameNo The frame number of the subframe following the current one
+   * \param subframeNo The subframe number of the subframe following the current one
+   */
+  void ScheduleSubframeIndication (uint32_t frameNo, uint32_t subframeNo);
+
 
 
   // UE CPHY SAP methods
@@ -766,6 +784,18 @@ private:
    * establishment.
    */
   virtual void DoNotifyConnectionSuccessful ();
+  /**
+   * \brief Report to the RRC the subframes that started while their
+   * indications were skipped, and trigger the next subframe indication
+   * earlier if the UE is not idle anymore
+   */
+  void DoResumeSubframeIndication ();
+  /**
+   * \brief Get the number of subframes that started strictly before now,
+   * after the last subframe indication, and whose indications were skipped
+   * \return the number of skipped subframes
+   */
+  uint32_t DoGetSkippedSubframes ();
 
   /**
   * Gets the transmission parameters for the given packet burst
@@ -1163,6 +1193,37 @@ private:
    */
   bool m_waitingNextScPeriod;
 
+  /**
+   * The `SkipIdleSubframes` attribute. If true, the subframe indications of
+   * the subframes in which the UE has nothing to do are skipped
+   */
+  bool m_skipIdleSubframes;
+  /**
+   * True if the sidelink synchronization is configured, in which case all
+   * the subframe indications are triggered
+   */
+  bool m_slssConfigured;
+  /**
+   * True if a sidelink TB is expected in the current subframe
+   */
+  bool m_slTbExpected;
+  /**
+   * The next subframe indication
+   */
+  EventId m_subframeIndicationEvent;
+  /**
+   * The start time of the last subframe indicated, or skipped while idle
+   */
+  Time m_lastSubframeTime;
+  /**
+   * The frame number of the last subframe indicated, or skipped while idle
+   */
+  uint32_t m_lastFrameNo;
+  /**
+   * The subframe number of the last subframe indicated, or skipped while idle
+   */
+  uint32_t m_lastSubframeNo;
+
   /**
    * Set the upper limit for the random values generated by m_nextScanRdm
    *
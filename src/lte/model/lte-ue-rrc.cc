@@ -4406,14 +4406,30 @@ uint64_t
 LteUeRrc::GetFrameNumber ()
 {
   NS_LOG_FUNCTION (this);
-  return m_currFrameNo;
+  uint32_t skipped = m_cphySapProvider.at (0)->GetSkippedSubframes ();
+  if (skipped == 0)
+    {
+      return m_currFrameNo;
+    }
+  uint32_t frameNo = m_currFrameNo;
+  uint32_t subframeNo = m_currSubframeNo;
+  LteSubframeNumbering::Advance (frameNo, subframeNo, skipped);
+  return frameNo;
 }
 
 uint64_t
 LteUeRrc::GetSubFrameNumber ()
 {
   NS_LOG_FUNCTION (this);
-  return m_currSubframeNo;
+  uint32_t skipped = m_cphySapProvider.at (0)->GetSkippedSubframes ();
+  if (skipped == 0)
+    {
+      return m_currSubframeNo;
+    }
+  uint32_t frameNo = m_currFrameNo;
+  uint32_t subframeNo = m_currSubframeNo;
+  LteSubframeNumbering::Advance (frameNo, subframeNo, skipped);
+  return subframeNo;
 }
 
 void
@@ -455,13 +455,15 @@ public:
   void StopRelayService (uint32_t serviceCode);
 
   /**
-   * \brief Get the current frame number reported to the RRC
+   * \brief Get the current frame number reported to the RRC, counting the
+   * subframes whose indications the PHY skipped since the last report
    * \return the frame number value
    */
   uint64_t GetFrameNumber ();
 
   /**
-   * \brief Get the current subframe number reported to the RRC
+   * \brief Get the current subframe number reported to the RRC, counting
+   * the subframes whose indications the PHY skipped since the last report
    * \return the subframe number value
    */
   uint64_t GetSubFrameNumber ();
@@ -0,0 +1,315 @@
+/* -*-  Mode: C++; c-file-style: "gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include <ns3/log.h>
+#include <ns3/test.h>
+#include <ns3/simulator.h>
+#include <ns3/double.h>
+#include <ns3/uinteger.h>
+#include <ns3/boolean.h>
+#include <ns3/string.h>
+#include <ns3/node-container.h>
+#include <ns3/net-device-container.h>
+#include <ns3/mobility-helper.h>
+#include <ns3/constant-position-mobility-model.h>
+#include <ns3/position-allocator.h>
+#include <ns3/lte-helper.h>
+#include <ns3/lte-ue-net-device.h>
+#include <ns3/lte-ue-phy.h>
+#include <ns3/lte-enb-net-device.h>
+#include <ns3/lte-enb-phy.h>
+#include <ns3/spectrum-channel.h>
+#include <ns3/propagation-loss-model.h>
+#include <ns3/radio-environment-map-helper.h>
+#include <fstream>
+#include <sstream>
+#include <vector>
+#include <cmath>
+#include <limits>
+
+using namespace ns3;
+
+NS_LOG_COMPONENT_DEFINE ("LteTestRadioEnvironmentMap");
+
+/**
+ * \ingroup lte-test
+ * \ingroup tests
+ *
+ * \brief Read the lines of a REM in text format
+ * \param filename the name of the file
+ * \param columns the number of columns of the file
+ * \return the values of each line
+ */
+static std::vector<std::vector<double> >
+ReadRem (const std::string &filename, uint32_t columns)
+{
+  std::vector<std::vector<double> > lines;
+  std::ifstream in (filename.c_str ());
+  std::string line;
+  while (std::getline (in, line))
+    {
+      std::istringstream iss (line);
+      std::vector<double> values (columns);
+      for (uint32_t i = 0; i < columns; ++i)
+        {
+          iss >> values[i];
+        }
+      lines.push_back (values);
+    }
+  return lines;
+}
+
+/**
+ * \ingroup lte-test
+ * \ingroup tests
+ *
+ * \brief Test that the offline REM of three eNBs has the SINR of the REM
+ * computed by simulating the listeners, and the RSRP of the strongest eNB
+ */
+class LteRemOfflineEnbTestCase : public TestCase
+{
+public:
+  /**
+   * Constructor
+   *
+   * \param numThreads the number of threads of the offline engine
+   * \param binaryOutput true to write the offline REM as a binary raster
+   */
+  LteRemOfflineEnbTestCase (uint32_t numThreads, bool binaryOutput);
+
+private:
+  virtual void DoRun (void);
+
+  uint32_t m_numThreads; ///< the number of threads of the offline engine
+  bool m_binaryOutput; ///< true to write the offline REM as a binary raster
+};
+
+LteRemOfflineEnbTestCase::LteRemOfflineEnbTestCase (uint32_t numThreads, bool binaryOutput)
+  : TestCase ("Offline REM of eNBs with " + std::to_string (numThreads)
+              + (binaryOutput ? " threads, binary output" : " threads")),
+    m_numThreads (numThreads),
+    m_binaryOutput (binaryOutput)
+{
+}
+
+void
+LteRemOfflineEnbTestCase::DoRun (void)
+{
+  Ptr<LteHelper> lteHelper = CreateObject<LteHelper> ();
+
+  NodeContainer enbNodes;
+  enbNodes.Create (3);
+  Ptr<ListPositionAllocator> positionAlloc = CreateObject<ListPositionAllocator> ();
+  positionAlloc->Add (Vector (0, 0, 30));
+  positionAlloc->Add (Vector (400, 50, 30));
+  positionAlloc->Add (Vector (150, 300, 30));
+  MobilityHelper mobility;
+  mobility.SetMobilityModel ("ns3::ConstantPositionMobilityModel");
+  mobility.SetPositionAllocator (positionAlloc);
+  mobility.Install (enbNodes);
+  NetDeviceContainer enbDevs = lteHelper->InstallEnbDevice (enbNodes);
+
+  std::ostringstream channelPath;
+  channelPath << "/ChannelList/" << lteHelper->GetDownlinkSpectrumChannel ()->GetId ();
+  std::string liveFile = CreateTempDirFilename ("rem-live.out");
+  std::string offlineFile = CreateTempDirFilename (m_binaryOutput ? "rem-offline.bin" : "rem-offline.out");
+  std::string textFile = CreateTempDirFilename ("rem-offline.out");
+
+  Ptr<RadioEnvironmentMapHelper> liveRem = CreateObject<RadioEnvironmentMapHelper> ();
+  Ptr<RadioEnvironmentMapHelper> offlineRem = CreateObject<RadioEnvironmentMapHelper> ();
+  for (Ptr<RadioEnvironmentMapHelper> rem : {liveRem, offlineRem})
+    {
+      rem->SetAttribute ("ChannelPath", StringValue (channelPath.str ()));
+      rem->SetAttribute ("XMin", DoubleValue (-100.0));
+      rem->SetAttribute ("XMax", DoubleValue (500.0));
+      rem->SetAttribute ("XRes", UintegerValue (13));
+      rem->SetAttribute ("YMin", DoubleValue (-50.0));
+      rem->SetAttribute ("YMax", DoubleValue (350.0));
+      rem->SetAttribute ("YRes", UintegerValue (9));
+      rem->SetAttribute ("Z", DoubleValue (1.5));
+    }
+  liveRem->SetAttribute ("OutputFile", StringValue (liveFile));
+  offlineRem->SetAttribute ("OutputFile", StringValue (offlineFile));
+  offlineRem->SetAttribute ("Offline", BooleanValue (true));
+  offlineRem->SetAttribute ("NumThreads", UintegerValue (m_numThreads));
+  offlineRem->SetAttribute ("TileColumns", UintegerValue (2));
+  offlineRem->SetAttribute ("BinaryOutput", BooleanValue (m_binaryOutput));
+  offlineRem->SetAttribute ("StopWhenDone", BooleanValue (false));
+  liveRem->Install ();
+  offlineRem->Install ();
+
+  Simulator::Run ();
+
+  // expected RSRP of the strongest eNB, which transmits its power over
+  // the 12 resource elements of each RB
+  Ptr<PropagationLossModel> lossModel = lteHelper->GetDownlinkSpectrumChannel ()->GetPropagationLossModel ();
+  Ptr<MobilityModel> rxMobility = CreateObject<ConstantPositionMobilityModel> ();
+  std::vector<double> txPowerPerRe;
+  for (uint32_t i = 0; i < enbDevs.GetN (); ++i)
+    {
+      Ptr<LteEnbNetDevice> enbDev = enbDevs.Get (i)->GetObject<LteEnbNetDevice> ();
+      txPowerPerRe.push_back (enbDev->GetPhy ()->GetTxPower () - 10 * std::log10 (12.0 * enbDev->GetDlBandwidth ()));
+    }
+
+  Simulator::Destroy ();
+
+  if (m_binaryOutput)
+    {
+      RadioEnvironmentMapHelper::ConvertBinaryToText (offlineFile, textFile);
+    }
+  std::vector<std::vector<double> > live = ReadRem (liveFile, 4);
+  std::vector<std::vector<double> > offline = ReadRem (textFile, 5);
+  NS_TEST_ASSERT_MSG_EQ (live.size (), 13 * 9, "unexpected number of points in the REM");
+  NS_TEST_ASSERT_MSG_EQ (offline.size (), live.size (), "the offline REM should have the points of the REM");
+  for (uint32_t i = 0; i < live.size (); ++i)
+    {
+      NS_TEST_ASSERT_MSG_EQ_TOL (offline[i][0], live[i][0], 1e-6, "wrong x coordinate at point " << i);
+      NS_TEST_ASSERT_MSG_EQ_TOL (offline[i][1], live[i][1], 1e-6, "wrong y coordinate at point " << i);
+      NS_TEST_ASSERT_MSG_EQ_TOL (offline[i][2], live[i][2], 1e-6, "wrong z coordinate at point " << i);
+      NS_TEST_ASSERT_MSG_EQ_TOL (offline[i][3], live[i][3], 1e-4 * live[i][3], "wrong SINR at point " << i);
+
+      rxMobility->SetPosition (Vector (offline[i][0], offline[i][1], offline[i][2]));
+      double rsrp = -std::numeric_limits<double>::infinity ();
+      for (uint32_t j = 0; j < enbNodes.GetN (); ++j)
+        {
+          Ptr<MobilityModel> txMobility = enbNodes.Get (j)->GetObject<MobilityModel> ();
+          rsrp = std::max (rsrp, lossModel->CalcRxPower (txPowerPerRe[j], txMobility, rxMobility));
+        }
+      NS_TEST_ASSERT_MSG_EQ_TOL (offline[i][4], rsrp, 1e-3, "wrong RSRP at point " << i);
+    }
+}
+
+/**
+ * \ingroup lte-test
+ * \ingroup tests
+ *
+ * \brief Test the offline REM of UEs transmitting in the Sidelink
+ */
+class LteRemOfflineSidelinkTestCase : public TestCase
+{
+public:
+  LteRemOfflineSidelinkTestCase ();
+
+private:
+  virtual void DoRun (void);
+};
+
+LteRemOfflineSidelinkTestCase::LteRemOfflineSidelinkTestCase ()
+  : TestCase ("Offline REM of Sidelink UEs")
+{
+}
+
+void
+LteRemOfflineSidelinkTestCase::DoRun (void)
+{
+  Ptr<LteHelper> lteHelper = CreateObject<LteHelper> ();
+  lteHelper->SetAttribute ("UseSidelink", BooleanValue (true));
+  // channel model initialization, as no eNB is installed
+  lteHelper->Initialize ();
+
+  NodeContainer ueNodes;
+  ueNodes.Create (2);
+  Ptr<ListPositionAllocator> positionAlloc = CreateObject<ListPositionAllocator> ();
+  positionAlloc->Add (Vector (0, 0, 1.5));
+  positionAlloc->Add (Vector (100, 0, 1.5));
+  MobilityHelper mobility;
+  mobility.SetMobilityModel ("ns3::ConstantPositionMobilityModel");
+  mobility.SetPositionAllocator (positionAlloc);
+  mobility.Install (ueNodes);
+  NetDeviceContainer ueDevs = lteHelper->InstallUeDevice (ueNodes);
+  ueDevs.Get (1)->GetObject<LteUeNetDevice> ()->GetPhy ()->SetAttribute ("TxPower", DoubleValue (23.0));
+
+  std::ostringstream channelPath;
+  channelPath << "/ChannelList/" << lteHelper->GetUplinkSpectrumChannel ()->GetId ();
+  std::string remFile = CreateTempDirFilename ("rem-sidelink.out");
+  double noisePower = 1e-13;
+
+  Ptr<RadioEnvironmentMapHelper> rem = CreateObject<RadioEnvironmentMapHelper> ();
+  rem->SetAttribute ("ChannelPath", StringValue (channelPath.str ()));
+  rem->SetAttribute ("OutputFile", StringValue (remFile));
+  rem->SetAttribute ("XMin", DoubleValue (-50.0));
+  rem->SetAttribute ("XMax", DoubleValue (150.0));
+  rem->SetAttribute ("XRes", UintegerValue (5));
+  rem->SetAttribute ("YMin", DoubleValue (-20.0));
+  rem->SetAttribute ("YMax", DoubleValue (20.0));
+  rem->SetAttribute ("YRes", UintegerValue (3));
+  rem->SetAttribute ("Z", DoubleValue (1.5));
+  rem->SetAttribute ("Earfcn", UintegerValue (23330));
+  rem->SetAttribute ("Bandwidth", UintegerValue (50));
+  rem->SetAttribute ("NoisePower", DoubleValue (noisePower));
+  rem->SetAttribute ("Offline", BooleanValue (true));
+  rem->SetAttribute ("IncludeSidelinkUes", BooleanValue (true));
+  rem->Install ();
+
+  Simulator::Run ();
+
+  Ptr<PropagationLossModel> lossModel = lteHelper->GetUplinkSpectrumChannel ()->GetPropagationLossModel ();
+  Ptr<MobilityModel> rxMobility = CreateObject<ConstantPositionMobilityModel> ();
+  std::vector<double> txPowerDbm;
+  for (uint32_t i = 0; i < ueDevs.GetN (); ++i)
+    {
+      txPowerDbm.push_back (ueDevs.Get (i)->GetObject<LteUeNetDevice> ()->GetPhy ()->GetTxPower ());
+    }
+
+  std::vector<std::vector<double> > points = ReadRem (remFile, 5);
+  NS_TEST_ASSERT_MSG_EQ (points.size (), 5 * 3, "unexpected number of points in the REM");
+  for (uint32_t i = 0; i < points.size (); ++i)
+    {
+      rxMobility->SetPosition (Vector (points[i][0], points[i][1], points[i][2]));
+      double sumPower = 0;
+      double maxPower = 0;
+      double rsrp = 0;
+      for (uint32_t j = 0; j < ueNodes.GetN (); ++j)
+        {
+          Ptr<MobilityModel> txMobility = ueNodes.Get (j)->GetObject<MobilityModel> ();
+          double rxPowerDbm = lossModel->CalcRxPower (txPowerDbm[j], txMobility, rxMobility);
+          double rxPower = std::pow (10.0, (rxPowerDbm - 30) / 10);
+          sumPower += rxPower;
+          if (rxPower > maxPower)
+            {
+              maxPower = rxPower;
+              rsrp = rxPowerDbm - 10 * std::log10 (12.0 * 50);
+            }
+        }
+      double sinr = maxPower / (sumPower - maxPower + noisePower);
+      NS_TEST_ASSERT_MSG_EQ_TOL (points[i][3], sinr, 1e-4 * sinr, "wrong SINR at point " << i);
+      NS_TEST_ASSERT_MSG_EQ_TOL (points[i][4], rsrp, 1e-3, "wrong RSRP at point " << i);
+    }
+
+  Simulator::Destroy ();
+}
+
+/**
+ * \ingroup lte-test
+ * \ingroup tests
+ *
+ * \brief Radio environment map test suite
+ */
+class LteRadioEnvironmentMapTestSuite : public TestSuite
+{
+public:
+  LteRadioEnvironmentMapTestSuite ();
+};
+
+LteRadioEnvironmentMapTestSuite::LteRadioEnvironmentMapTestSuite ()
+  : TestSuite ("lte-radio-environment-map", SYSTEM)
+{
+  AddTestCase (new LteRemOfflineEnbTestCase (1, false), TestCase::QUICK);
+  AddTestCase (new LteRemOfflineEnbTestCase (4, true), TestCase::QUICK);
+  AddTestCase (new LteRemOfflineSidelinkTestCase, TestCase::QUICK);
+}
+
+static LteRadioEnvironmentMapTestSuite g_lteRadioEnvironmentMapTestSuite;
@@ -0,0 +1,231 @@
+/* -*-  Mode: C++; c-file-style: "gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "ns3/test.h"
+#include "ns3/log.h"
+#include "ns3/packet.h"
+#include "ns3/packet-burst.h"
+#include "ns3/lte-radio-bearer-tag.h"
+#include "ns3/lte-control-messages.h"
+#include "ns3/lte-spectrum-signal-parameters.h"
+#include "ns3/lte-spectrum-signal-codec.h"
+#include "ns3/lte-spectrum-value-helper.h"
+#include "ns3/distributed-spectrum-signal-codec.h"
+
+using namespace ns3;
+
+NS_LOG_COMPONENT_DEFINE ("LteTestSpectrumSignalCodec");
+
+/**
+ * \ingroup lte-test
+ * \ingroup tests
+ *
+ * \brief Test that LteSpectrumSignalCodec sends the sidelink data frames
+ * whole, with the tags of their packets.
+ */
+class LteSlDataFrameCodecTestCase : public TestCase
+{
+public:
+  LteSlDataFrameCodecTestCase ();
+  virtual ~LteSlDataFrameCodecTestCase ();
+
+private:
+  virtual void DoRun (void);
+};
+
+LteSlDataFrameCodecTestCase::LteSlDataFrameCodecTestCase ()
+  : TestCase ("Check the encoding of the sidelink data frames")
+{
+}
+
+LteSlDataFrameCodecTestCase::~LteSlDataFrameCodecTestCase ()
+{
+}
+
+void
+LteSlDataFrameCodecTestCase::DoRun (void)
+{
+  Ptr<LteSpectrumSignalParametersSlDataFrame> sent = Create<LteSpectrumSignalParametersSlDataFrame> ();
+  sent->packetBurst = CreateObject<PacketBurst> ();
+  for (uint32_t k = 0; k < 2; k++)
+    {
+      Ptr<Packet> p = Create<Packet> (100 + k);
+      p->AddPacketTag (LteRadioBearerTag (5, 1 + k, 1001, 2002));
+      sent->packetBurst->AddPacket (p);
+    }
+  sent->nodeId = 17;
+  sent->slssId = 0x123456789aULL;
+  sent->groupId = 3;
+
+  LteSpectrumSignalCodec codec;
+  NS_TEST_ASSERT_MSG_EQ (codec.CanEncode (sent), true, "sidelink data frame not supported");
+  Ptr<LteSpectrumSignalParametersSlDataFrame> received =
+    DynamicCast<LteSpectrumSignalParametersSlDataFrame> (codec.Decode (codec.Encode (sent)));
+  NS_TEST_ASSERT_MSG_NE (received, 0, "wrong signal type");
+  NS_TEST_EXPECT_MSG_EQ (received->nodeId, 17u, "wrong node id");
+  NS_TEST_EXPECT_MSG_EQ (received->slssId, 0x123456789aULL, "wrong SLSS id");
+  NS_TEST_EXPECT_MSG_EQ ((uint16_t) received->groupId, 3, "wrong group id");
+  NS_TEST_ASSERT_MSG_NE (received->packetBurst, 0, "packet burst lost");
+  NS_TEST_ASSERT_MSG_EQ (received->packetBurst->GetNPackets (), 2u, "wrong number of packets");
+  uint32_t k = 0;
+  for (auto it = received->packetBurst->Begin (); it != received->packetBurst->End (); ++it, ++k)
+    {
+      NS_TEST_EXPECT_MSG_EQ ((*it)->GetSize (), 100 + k, "wrong packet size");
+      LteRadioBearerTag tag;
+      NS_TEST_ASSERT_MSG_EQ ((*it)->PeekPacketTag (tag), true, "radio bearer tag lost");
+      NS_TEST_EXPECT_MSG_EQ (tag.GetRnti (), 5, "wrong RNTI");
+      NS_TEST_EXPECT_MSG_EQ ((uint16_t) tag.GetLcid (), 1 + k, "wrong LCID");
+      NS_TEST_EXPECT_MSG_EQ (tag.GetSourceL2Id (), 1001u, "wrong source L2 id");
+      NS_TEST_EXPECT_MSG_EQ (tag.GetDestinationL2Id (), 2002u, "wrong destination L2 id");
+    }
+}
+
+/**
+ * \ingroup lte-test
+ * \ingroup tests
+ *
+ * \brief Test that LteSpectrumSignalCodec sends the downlink control
+ * frames without their control messages.
+ */
+class LteDlCtrlFrameCodecTestCase : public TestCase
+{
+public:
+  LteDlCtrlFrameCodecTestCase ();
+  virtual ~LteDlCtrlFrameCodecTestCase ();
+
+private:
+  virtual void DoRun (void);
+};
+
+LteDlCtrlFrameCodecTestCase::LteDlCtrlFrameCodecTestCase ()
+  : TestCase ("Check the encoding of the downlink control frames")
+{
+}
+
+LteDlCtrlFrameCodecTestCase::~LteDlCtrlFrameCodecTestCase ()
+{
+}
+
+void
+LteDlCtrlFrameCodecTestCase::DoRun (void)
+{
+  Ptr<LteSpectrumSignalParametersDlCtrlFrame> sent = Create<LteSpectrumSignalParametersDlCtrlFrame> ();
+  sent->cellId = 42;
+  sent->pss = true;
+  sent->ctrlMsgList.push_back (Create<DlDciLteControlMessage> ());
+
+  LteSpectrumSignalCodec codec;
+  Ptr<LteSpectrumSignalParametersDlCtrlFrame> received =
+    DynamicCast<LteSpectrumSignalParametersDlCtrlFrame> (codec.Decode (codec.Encode (sent)));
+  NS_TEST_ASSERT_MSG_NE (received, 0, "wrong signal type");
+  NS_TEST_EXPECT_MSG_EQ (received->cellId, 42, "wrong cell id");
+  NS_TEST_EXPECT_MSG_EQ (received->pss, true, "wrong PSS");
+  NS_TEST_EXPECT_MSG_EQ (received->ctrlMsgList.empty (), true, "control messages not expected");
+}
+
+/**
+ * \ingroup lte-test
+ * \ingroup tests
+ *
+ * \brief Test that the message of a 100 RB downlink data frame, whose
+ * PSD makes it larger than the buffers of the packets sent to nodes,
+ * goes through the serialization of the MPI interface whole.
+ */
+class LteFullBandwidthMessageTestCase : public TestCase
+{
+public:
+  LteFullBandwidthMessageTestCase ();
+  virtual ~LteFullBandwidthMessageTestCase ();
+
+private:
+  virtual void DoRun (void);
+};
+
+LteFullBandwidthMessageTestCase::LteFullBandwidthMessageTestCase ()
+  : TestCase ("Check the message of a 100 RB data frame")
+{
+}
+
+LteFullBandwidthMessageTestCase::~LteFullBandwidthMessageTestCase ()
+{
+}
+
+void
+LteFullBandwidthMessageTestCase::DoRun (void)
+{
+  std::vector<int> activeRbs;
+  for (int rb = 0; rb < 100; rb++)
+    {
+      activeRbs.push_back (rb);
+    }
+  Ptr<LteSpectrumSignalParametersDataFrame> sent = Create<LteSpectrumSignalParametersDataFrame> ();
+  sent->psd = LteSpectrumValueHelper::CreateTxPowerSpectralDensity (100, 100, 46, activeRbs);
+  sent->packetBurst = CreateObject<PacketBurst> ();
+  sent->packetBurst->AddPacket (Create<Packet> (1500));
+  sent->cellId = 7;
+
+  // build the message like DistributedSpectrumChannel, and serialize it
+  // like the MPI interface
+  LteSpectrumSignalCodec codec;
+  DistributedSpectrumHeader header;
+  header.SetPsd (sent->psd);
+  header.SetCodec (1);
+  Ptr<Packet> msg = codec.Encode (sent);
+  msg->AddHeader (header);
+  uint32_t size = msg->GetSerializedSize ();
+  NS_TEST_ASSERT_MSG_GT (size, 2000u, "the message does not exceed the buffers of the node packets");
+  std::vector<uint8_t> buffer (size);
+  NS_TEST_ASSERT_MSG_EQ (msg->Serialize (buffer.data (), size), 1u, "message not serialized");
+
+  Ptr<Packet> p = Create<Packet> (buffer.data (), size, true);
+  DistributedSpectrumHeader receivedHeader;
+  p->RemoveHeader (receivedHeader);
+  NS_TEST_ASSERT_MSG_EQ (receivedHeader.GetBands ().size (), 100u, "wrong number of bands");
+  for (uint32_t k = 0; k < 100; k++)
+    {
+      NS_TEST_EXPECT_MSG_EQ (receivedHeader.GetBands ()[k].fc, sent->psd->GetSpectrumModel ()->Begin ()[k].fc,
+                             "wrong band " << k);
+      NS_TEST_EXPECT_MSG_EQ (receivedHeader.GetPsdValues ()[k], (*sent->psd)[k], "wrong PSD value " << k);
+    }
+  Ptr<LteSpectrumSignalParametersDataFrame> received =
+    DynamicCast<LteSpectrumSignalParametersDataFrame> (codec.Decode (p));
+  NS_TEST_ASSERT_MSG_NE (received, 0, "wrong signal type");
+  NS_TEST_EXPECT_MSG_EQ (received->cellId, 7, "wrong cell id");
+  NS_TEST_ASSERT_MSG_NE (received->packetBurst, 0, "packet burst lost");
+  NS_TEST_EXPECT_MSG_EQ (received->packetBurst->GetSize (), 1500u, "wrong packet burst size");
+}
+
+/**
+ * \ingroup lte-test
+ * \ingroup tests
+ *
+ * \brief LteSpectrumSignalCodec test suite.
+ */
+class LteSpectrumSignalCodecTestSuite : public TestSuite
+{
+public:
+  LteSpectrumSignalCodecTestSuite ();
+};
+
+LteSpectrumSignalCodecTestSuite::LteSpectrumSignalCodecTestSuite ()
+  : TestSuite ("lte-spectrum-signal-codec", UNIT)
+{
+  AddTestCase (new LteSlDataFrameCodecTestCase, TestCase::QUICK);
+  AddTestCase (new LteDlCtrlFrameCodecTestCase, TestCase::QUICK);
+  AddTestCase (new LteFullBandwidthMessageTestCase, TestCase::QUICK);
+}
+
+static LteSpectrumSignalCodecTestSuite g_lteSpectrumSignalCodecTestSuite; ///< the test suite
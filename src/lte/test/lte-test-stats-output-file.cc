@@ -0,0 +1,186 @@
+/* -*-  Mode: C++; c-file-style: "gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include <ns3/log.h>
+#include <ns3/lte-stats-output-file.h>
+#include <ns3/mac-stats-calculator.h>
+#include <ns3/simulator.h>
+#include <ns3/string.h>
+#include <ns3/test.h>
+#include <fstream>
+#include <sstream>
+
+using namespace ns3;
+
+NS_LOG_COMPONENT_DEFINE ("LteTestStatsOutputFile");
+
+/**
+ * \ingroup lte-test
+ * \ingroup tests
+ *
+ * \brief Read a whole file
+ * \param filename the name of the file
+ * \return the content of the file
+ */
+static std::string
+ReadFile (const std::string &filename)
+{
+  std::ifstream in (filename.c_str ());
+  std::ostringstream content;
+  content << in.rdbuf ();
+  return content.str ();
+}
+
+/**
+ * \ingroup lte-test
+ * \ingroup tests
+ *
+ * \brief Test that an LteStatsOutputFile writes exactly the records
+ * formatted in its stream, whatever the size of its buffer
+ */
+class LteStatsOutputFileTestCase : public TestCase
+{
+public:
+  /**
+   * Constructor
+   *
+   * \param bufferSize the size of the buffer of the file
+   * \param backgroundWriter true to write the buffers with a background thread
+   */
+  LteStatsOutputFileTestCase (uint32_t bufferSize, bool backgroundWriter);
+
+private:
+  virtual void DoRun (void);
+
+  uint32_t m_bufferSize; ///< the size of the buffer of the file
+  bool m_backgroundWriter; ///< true to write the buffers with a background thread
+};
+
+LteStatsOutputFileTestCase::LteStatsOutputFileTestCase (uint32_t bufferSize, bool backgroundWriter)
+  : TestCase ("Output file with a buffer of " + std::to_string (bufferSize)
+              + (backgroundWriter ? " bytes, background writer" : " bytes")),
+    m_bufferSize (bufferSize),
+    m_backgroundWriter (backgroundWriter)
+{
+}
+
+void
+LteStatsOutputFileTestCase::DoRun (void)
+{
+  std::string filename = CreateTempDirFilename ("LteStatsOutputFile.txt");
+  std::ostringstream expected;
+
+  Ptr<LteStatsOutputFile> file = Create<LteStatsOutputFile> (filename, false, m_bufferSize, m_backgroundWriter);
+  NS_TEST_ASSERT_MSG_EQ (bool (file->GetStream ()), true, "the file was not opened");
+  for (uint32_t i = 0; i < 1000; i++)
+    {
+      file->GetStream () << i * 0.001 << "\t" << i << std::endl;
+      expected << i * 0.001 << "\t" << i << std::endl;
+    }
+  file->Flush ();
+  NS_TEST_ASSERT_MSG_EQ (ReadFile (filename), expected.str (), "records missing after a flush");
+  file->GetStream () << "last" << std::endl;
+  expected << "last" << std::endl;
+  file = 0;
+  NS_TEST_ASSERT_MSG_EQ (ReadFile (filename), expected.str (), "records missing after closing the file");
+
+  file = Create<LteStatsOutputFile> (filename, true, m_bufferSize, m_backgroundWriter);
+  file->GetStream () << "appended" << std::endl;
+  expected << "appended" << std::endl;
+  file = 0;
+  NS_TEST_ASSERT_MSG_EQ (ReadFile (filename), expected.str (), "record not appended");
+
+  file = Create<LteStatsOutputFile> (filename, false, m_bufferSize, m_backgroundWriter);
+  file = 0;
+  NS_TEST_ASSERT_MSG_EQ (ReadFile (filename), "", "file not truncated");
+}
+
+/**
+ * \ingroup lte-test
+ * \ingroup tests
+ *
+ * \brief Test that the files of the stats calculators stay open across
+ * the records and are complete once the simulator is destroyed
+ */
+class LteStatsCalculatorOutputFileTestCase : public TestCase
+{
+public:
+  LteStatsCalculatorOutputFileTestCase ();
+
+private:
+  virtual void DoRun (void);
+};
+
+LteStatsCalculatorOutputFileTestCase::LteStatsCalculatorOutputFileTestCase ()
+  : TestCase ("Output file of a stats calculator")
+{
+}
+
+void
+LteStatsCalculatorOutputFileTestCase::DoRun (void)
+{
+  std::string filename = CreateTempDirFilename ("DlMacStats.txt");
+  Ptr<MacStatsCalculator> macStats = CreateObject<MacStatsCalculator> ();
+  macStats->SetAttribute ("DlOutputFilename", StringValue (filename));
+
+  DlSchedulingCallbackInfo info;
+  info.frameNo = 1;
+  info.subframeNo = 2;
+  info.rnti = 3;
+  info.mcsTb1 = 4;
+  info.sizeTb1 = 5;
+  info.mcsTb2 = 0;
+  info.sizeTb2 = 0;
+  info.componentCarrierId = 0;
+  macStats->DlScheduling (1, 10, info);
+  macStats->DlScheduling (1, 11, info);
+  Simulator::Destroy ();
+
+  std::string expected = "% time\tcellId\tIMSI\tframe\tsframe\tRNTI\tmcsTb1\tsizeTb1\tmcsTb2\tsizeTb2\tccId\n"
+    "0\t1\t10\t1\t2\t3\t4\t5\t0\t0\t0\n"
+    "0\t1\t11\t1\t2\t3\t4\t5\t0\t0\t0\n";
+  NS_TEST_ASSERT_MSG_EQ (ReadFile (filename), expected, "unexpected content of the output file");
+
+  // a new simulation appends to the file closed by Simulator::Destroy
+  macStats->DlScheduling (1, 12, info);
+  Simulator::Destroy ();
+  expected += "0\t1\t12\t1\t2\t3\t4\t5\t0\t0\t0\n";
+  NS_TEST_ASSERT_MSG_EQ (ReadFile (filename), expected, "record not appended after Simulator::Destroy");
+}
+
+/**
+ * \ingroup lte-test
+ * \ingroup tests
+ *
+ * \brief Test suite of the output files of the stats calculators
+ */
+class LteStatsOutputFileTestSuite : public TestSuite
+{
+public:
+  LteStatsOutputFileTestSuite ();
+};
+
+LteStatsOutputFileTestSuite::LteStatsOutputFileTestSuite ()
+  : TestSuite ("lte-stats-output-file", UNIT)
+{
+  AddTestCase (new LteStatsOutputFileTestCase (1 << 20, false), TestCase::QUICK);
+  AddTestCase (new LteStatsOutputFileTestCase (7, false), TestCase::QUICK);
+  AddTestCase (new LteStatsOutputFileTestCase (7, true), TestCase::QUICK);
+  AddTestCase (new LteStatsOutputFileTestCase (1024, true), TestCase::QUICK);
+  AddTestCase (new LteStatsCalculatorOutputFileTestCase, TestCase::QUICK);
+}
+
+static LteStatsOutputFileTestSuite g_lteStatsOutputFileTestSuite; ///< the test suite
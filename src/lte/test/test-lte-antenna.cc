@@ -38,6 +38,8 @@
 #include "ns3/lte-global-pathloss-database.h"
 
 #include <ns3/lte-chunk-processor.h>
+#include <limits>
+#include <sstream>
 
 
 using namespace ns3;
@@ -196,6 +198,11 @@ LteEnbAntennaTestCase::DoRun (void)
                    MakeCallback (&DownlinkLteGlobalPathlossDatabase::UpdatePathloss, &dlPathlossDb));
   Config::Connect ("/ChannelList/1/PathLoss",
                     MakeCallback (&UplinkLteGlobalPathlossDatabase::UpdatePathloss, &ulPathlossDb)); 
+  // and in two dense databases bound directly to the channels
+  DownlinkLteDensePathlossDatabase dlDensePathlossDb;
+  UplinkLteDensePathlossDatabase ulDensePathlossDb;
+  dlDensePathlossDb.ConnectToChannel (lteHelper->GetDownlinkSpectrumChannel ());
+  ulDensePathlossDb.ConnectToChannel (lteHelper->GetUplinkSpectrumChannel ());
 
   Simulator::Stop (Seconds (0.035));
   Simulator::Run ();
@@ -241,6 +248,19 @@ LteEnbAntennaTestCase::DoRun (void)
   double measuredLossUl = ulPathlossDb.GetPathloss (1, 1);
   NS_TEST_ASSERT_MSG_EQ_TOL (measuredLossUl, -m_antennaGainDb, tolerance, "Wrong UL loss!");
 
+  // and with the dense databases
+  NS_TEST_ASSERT_MSG_EQ (dlDensePathlossDb.GetNCells (), 1, "Wrong number of cells in the DL dense database!");
+  NS_TEST_ASSERT_MSG_EQ (dlDensePathlossDb.GetNUes (), 1, "Wrong number of UEs in the DL dense database!");
+  NS_TEST_ASSERT_MSG_EQ_TOL (dlDensePathlossDb.GetPathloss (1, 1), measuredLossDl, tolerance, "Wrong DL loss in the dense database!");
+  NS_TEST_ASSERT_MSG_EQ_TOL (ulDensePathlossDb.GetPathloss (1, 1), measuredLossUl, tolerance, "Wrong UL loss in the dense database!");
+  NS_TEST_ASSERT_MSG_EQ (dlDensePathlossDb.GetBestCellId (1), 1, "Wrong best cell in the DL dense database!");
+  NS_TEST_ASSERT_MSG_EQ (dlDensePathlossDb.GetPathloss (2, 1), std::numeric_limits<double>::infinity (), "Unexpected DL loss for an unknown cell!");
+  std::ostringstream csv;
+  csv << "1,1," << dlDensePathlossDb.GetCellPathlosses (0)[0] << "\n";
+  std::ostringstream exported;
+  dlDensePathlossDb.ExportCsv (exported);
+  NS_TEST_ASSERT_MSG_EQ (exported.str (), csv.str (), "Wrong CSV export of the DL dense database!");
+
   
   Simulator::Destroy ();
 }
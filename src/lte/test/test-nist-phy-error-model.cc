@@ -211,6 +211,60 @@ LteNistPhyErrorModelTestCase::DoRun ()
     }
 }
 
+/**
+ * \ingroup lte-test
+ * \ingroup tests
+ *
+ * \brief Test that the batch PSSCH BLER lookup returns, for each TB, the
+ * same values as the lookup of the TB alone.
+ */
+class LteNistPhyErrorModelBatchTestCase : public TestCase
+{
+public:
+  LteNistPhyErrorModelBatchTestCase ();
+
+private:
+  virtual void DoRun (void);
+};
+
+LteNistPhyErrorModelBatchTestCase::LteNistPhyErrorModelBatchTestCase ()
+  : TestCase ("PSSCH batch BLER lookup")
+{
+}
+
+void
+LteNistPhyErrorModelBatchTestCase::DoRun ()
+{
+  std::vector<uint16_t> mcs;
+  std::vector<double> sinr;
+  std::vector<HarqProcessInfoList_t> harqHistory;
+  HarqProcessInfoElement_t el;
+  for (uint16_t m = 0; m <= 20; m += 5)
+    {
+      for (double sinrDb = -12; sinrDb <= 12; sinrDb += 0.7)
+        {
+          mcs.push_back (m);
+          sinr.push_back (std::pow (10, sinrDb / 10));
+          HarqProcessInfoList_t harqInfoList;
+          for (uint16_t tx = 0; tx < m % 4; ++tx)
+            {
+              el.m_sinr = std::pow (10, (sinrDb - 1.3 * tx) / 10);
+              harqInfoList.push_back (el);
+            }
+          harqHistory.push_back (harqInfoList);
+        }
+    }
+
+  std::vector<TbErrorStats_t> tbStats = LteNistErrorModel::GetPsschBler (LteNistErrorModel::AWGN, LteNistErrorModel::SISO, mcs, sinr, harqHistory);
+  NS_TEST_ASSERT_MSG_EQ (tbStats.size (), mcs.size (), "one TbErrorStats_t per TB");
+  for (std::size_t i = 0; i < mcs.size (); ++i)
+    {
+      TbErrorStats_t tbStat = LteNistErrorModel::GetPsschBler (LteNistErrorModel::AWGN, LteNistErrorModel::SISO, mcs[i], sinr[i], harqHistory[i]);
+      NS_TEST_EXPECT_MSG_EQ (tbStats[i].tbler, tbStat.tbler, "wrong value of the bler for TB " << i);
+      NS_TEST_EXPECT_MSG_EQ (tbStats[i].sinr, tbStat.sinr, "wrong value of the sinr for TB " << i);
+    }
+}
+
 /**
  * \ingroup lte-test
  * \ingroup tests
@@ -267,6 +321,9 @@ LteNistPhyErrorModelTestSuite::LteNistPhyErrorModelTestSuite ()
 
   AddTestCase (new LteNistPhyErrorModelTestCase (LteNistErrorModel::PSCCH, LteNistErrorModel::AWGN, LteNistErrorModel::SISO, 0, std::pow (10, (2 / 10.0)),  harqInfoList, 0,    EQUAL), TestCase::QUICK);
 
+  //Testing the batch lookup
+  AddTestCase (new LteNistPhyErrorModelBatchTestCase (), TestCase::QUICK);
+
 }
 
 static LteNistPhyErrorModelTestSuite staticLteNistPhyErrorModelTestSuiteInstance;
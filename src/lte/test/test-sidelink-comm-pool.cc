@@ -531,6 +531,62 @@ void SidelinkCommPoolPsschTestCase::DoRun ()
   NS_TEST_EXPECT_MSG_EQ (((m_expectedFrameNo == actualFrameNo) && (m_expectedSubframeNo == actualSubframeNo) && (m_expectedRbStart == actualRbStart) && (m_expectedNbCount == actualRbCount)), true, "Expected and Actual Frame no, Subframe no, and rbStart for PSSCH are not equal");
 }
 
+/**
+ * \ingroup lte-test
+ * \ingroup tests
+ *
+ * \brief Test that the pools sharing the same configuration return the same
+ * PSSCH transmissions, whether they are computed or taken from the shared cache.
+ */
+class SidelinkCommPoolSharedGeometryTestCase : public TestCase
+{
+public:
+  /**
+   * Constructor
+   *
+   * \param pfactory LteSlResourcePoolFactory
+   */
+  SidelinkCommPoolSharedGeometryTestCase (LteSlResourcePoolFactory pfactory);
+
+private:
+  virtual void DoRun (void);
+  LteSlResourcePoolFactory m_pfactory; ///< LteSlResourcePoolFactory
+};
+
+SidelinkCommPoolSharedGeometryTestCase::SidelinkCommPoolSharedGeometryTestCase (LteSlResourcePoolFactory pfactory)
+  : TestCase ("TestCase:SidelinkCommPoolSharedGeometryTestCase, HoppingInfo:" + std::to_string (pfactory.GetDataHoppingInfo ())),
+    m_pfactory (pfactory)
+{
+}
+
+void SidelinkCommPoolSharedGeometryTestCase::DoRun ()
+{
+  LteRrcSap::SlCommResourcePool pool = m_pfactory.CreatePool ();
+  Ptr<SidelinkTxCommResourcePool> txpool = CreateObject<SidelinkTxCommResourcePool> ();
+  txpool->SetPool (pool);
+  Ptr<SidelinkRxCommResourcePool> rxpool = CreateObject<SidelinkRxCommResourcePool> ();
+  rxpool->SetPool (pool);
+
+  SidelinkCommResourcePool::SubframeInfo periodStart = txpool->GetNextScPeriod (0, 5);
+  for (uint32_t period = 0; period < 3; ++period)
+    {
+      for (uint8_t iTrp = 0; iTrp < 5; ++iTrp)
+        {
+          std::list<SidelinkCommResourcePool::SidelinkTransmissionInfo> txInfo = txpool->GetPsschTransmissions (periodStart, iTrp, 2, 3);
+          std::vector<SidelinkCommResourcePool::SidelinkTransmissionInfo> rxInfo = rxpool->GetPsschTransmissionVector (periodStart, iTrp, 2, 3);
+          NS_TEST_ASSERT_MSG_EQ (txInfo.size (), rxInfo.size (), "different number of PSSCH transmissions");
+          std::vector<SidelinkCommResourcePool::SidelinkTransmissionInfo>::const_iterator rxIt = rxInfo.begin ();
+          for (std::list<SidelinkCommResourcePool::SidelinkTransmissionInfo>::const_iterator txIt = txInfo.begin (); txIt != txInfo.end (); ++txIt, ++rxIt)
+            {
+              NS_TEST_EXPECT_MSG_EQ ((txIt->subframe == rxIt->subframe), true, "different PSSCH subframe");
+              NS_TEST_EXPECT_MSG_EQ ((uint16_t) txIt->rbStart, (uint16_t) rxIt->rbStart, "different PSSCH rbStart");
+              NS_TEST_EXPECT_MSG_EQ ((uint16_t) txIt->nbRb, (uint16_t) rxIt->nbRb, "different PSSCH number of RBs");
+            }
+        }
+      periodStart = txpool->GetNextScPeriod (periodStart.frameNo, periodStart.subframeNo);
+    }
+}
+
 /**
  * \ingroup lte-test
  * \ingroup tests
@@ -677,6 +733,12 @@ SidelinkCommPoolTestSuite::SidelinkCommPoolTestSuite ()
   //psschTransmissionNo:2, 3rd
   AddTestCase (new SidelinkCommPoolPsschTestCase (pfactory,0,5,5,2,3,2,13,1,5,3),TestCase::QUICK);
   //psschTransmissionNo:3, 4th
-  AddTestCase (new SidelinkCommPoolPsschTestCase (pfactory,0,5,5,2,3,3,14,7,0,3),TestCase::QUICK);}
+  AddTestCase (new SidelinkCommPoolPsschTestCase (pfactory,0,5,5,2,3,3,14,7,0,3),TestCase::QUICK);
+
+  //Pools with the same configuration share their PSSCH transmissions
+  AddTestCase (new SidelinkCommPoolSharedGeometryTestCase (pfactory),TestCase::QUICK);
+  pfactory.SetDataHoppingInfo (4); //no hopping
+  AddTestCase (new SidelinkCommPoolSharedGeometryTestCase (pfactory),TestCase::QUICK);
+}
 
 static SidelinkCommPoolTestSuite staticSidelinkCommPoolTestSuite;
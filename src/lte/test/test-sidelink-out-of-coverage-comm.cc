@@ -35,11 +35,14 @@
 
 
 #include <sstream>
+#include <vector>
 #include "ns3/object.h"
 #include "ns3/test.h"
 #include "ns3/lte-helper.h"
 #include "ns3/lte-sidelink-helper.h"
 #include "ns3/lte-sl-preconfig-pool-factory.h"
+#include "ns3/lte-ue-net-device.h"
+#include "ns3/lte-ue-rrc.h"
 #include "ns3/internet-stack-helper.h"
 #include "ns3/ipv4-static-routing-helper.h"
 #include "ns3/point-to-point-helper.h"
@@ -63,18 +66,32 @@ NS_LOG_COMPONENT_DEFINE ("TestSidelinkOutOfCoverageComm");
  * \ingroup tests
  *
  * \brief Sidelink out of coverage communication test case.
+ *
+ * When the UEs skip their idle subframes, the scenario is also run
+ * without skipping them, and the packets must be received at the same
+ * times with fewer simulation events. The frame and subframe numbers
+ * read from the RRC of the receiving UE must be the same too.
  */
 class SidelinkOutOfCoverageCommTestCase : public TestCase
 {
 public:
   /**
    * Constructor
+   *
+   * \param skipIdleSubframes The value of the LteUePhy::SkipIdleSubframes attribute
    */
-  SidelinkOutOfCoverageCommTestCase ();
+  SidelinkOutOfCoverageCommTestCase (bool skipIdleSubframes);
   virtual ~SidelinkOutOfCoverageCommTestCase ();
 
 private:
   virtual void DoRun (void);
+  /**
+   * \brief Run the scenario
+   *
+   * \param skipIdleSubframes The value of the LteUePhy::SkipIdleSubframes attribute
+   * \return The number of events executed by the simulator
+   */
+  uint64_t RunScenario (bool skipIdleSubframes);
   /**
    * \brief Sink Rx function
    *
@@ -82,11 +99,22 @@ private:
    * \param add Address
    */
   void SinkRxNode (Ptr<const Packet> p, const Address &add);
+  /**
+   * \brief Record the frame and subframe numbers of the RRC of a UE
+   *
+   * \param rrc The RRC of the UE
+   */
+  void SampleSubframe (Ptr<LteUeRrc> rrc);
+  bool m_skipIdleSubframes; ///< Whether the UEs skip their idle subframes
   uint32_t m_numPacketRx; ///< Total number of Rx packets
+  std::vector<Time> m_rxTimes; ///< Times of the Rx packets
+  std::vector<uint64_t> m_subframes; ///< Frame and subframe numbers sampled from the RRC
 };
 
-SidelinkOutOfCoverageCommTestCase::SidelinkOutOfCoverageCommTestCase ()
-  : TestCase ("Scenario with 2 out of coverage UEs performing Sidelink communication"),
+SidelinkOutOfCoverageCommTestCase::SidelinkOutOfCoverageCommTestCase (bool skipIdleSubframes)
+  : TestCase (std::string ("Scenario with 2 out of coverage UEs performing Sidelink communication")
+              + (skipIdleSubframes ? ", skipping idle subframes" : "")),
+    m_skipIdleSubframes (skipIdleSubframes),
     m_numPacketRx (0)
 {
 }
@@ -100,10 +128,45 @@ SidelinkOutOfCoverageCommTestCase::SinkRxNode (Ptr<const Packet> p, const Addres
 {
   NS_LOG_INFO ("Node received " << m_numPacketRx << " packets");
   m_numPacketRx++;
+  m_rxTimes.push_back (Simulator::Now ());
+}
+
+void
+SidelinkOutOfCoverageCommTestCase::SampleSubframe (Ptr<LteUeRrc> rrc)
+{
+  m_subframes.push_back (rrc->GetFrameNumber () * 10 + rrc->GetSubFrameNumber ());
 }
 
 void
 SidelinkOutOfCoverageCommTestCase::DoRun (void)
+{
+  uint64_t events = RunScenario (m_skipIdleSubframes);
+  NS_TEST_ASSERT_MSG_EQ (m_numPacketRx, 20, "20 packets should be received at the receiver!");
+
+  if (m_skipIdleSubframes)
+    {
+      std::vector<Time> rxTimes = m_rxTimes;
+      std::vector<uint64_t> subframes = m_subframes;
+      m_numPacketRx = 0;
+      m_rxTimes.clear ();
+      m_subframes.clear ();
+      uint64_t referenceEvents = RunScenario (false);
+      NS_TEST_ASSERT_MSG_EQ (rxTimes.size (), m_rxTimes.size (), "Skipping idle subframes changed the number of Rx packets");
+      for (uint32_t i = 0; i < rxTimes.size (); ++i)
+        {
+          NS_TEST_ASSERT_MSG_EQ (rxTimes[i], m_rxTimes[i], "Skipping idle subframes changed the time of Rx packet " << i);
+        }
+      NS_TEST_ASSERT_MSG_EQ (subframes.size (), m_subframes.size (), "Skipping idle subframes changed the number of samples");
+      for (uint32_t i = 0; i < subframes.size (); ++i)
+        {
+          NS_TEST_ASSERT_MSG_EQ (subframes[i], m_subframes[i], "Skipping idle subframes changed the RRC subframe of sample " << i);
+        }
+      NS_TEST_ASSERT_MSG_LT (events, referenceEvents, "Skipping idle subframes should execute fewer events");
+    }
+}
+
+uint64_t
+SidelinkOutOfCoverageCommTestCase::RunScenario (bool skipIdleSubframes)
 {
  /**
   * Create a scenario with two UEs, which are out of coverage.
@@ -135,6 +198,7 @@ SidelinkOutOfCoverageCommTestCase::DoRun (void)
 
   //Set the UEs power in dBm
   Config::SetDefault ("ns3::LteUePhy::TxPower", DoubleValue (23.0));
+  Config::SetDefault ("ns3::LteUePhy::SkipIdleSubframes", BooleanValue (skipIdleSubframes));
 
   // Set error models
   Config::SetDefault ("ns3::LteSpectrumPhy::SlCtrlErrorModelEnabled", BooleanValue (true));
@@ -274,15 +338,25 @@ SidelinkOutOfCoverageCommTestCase::DoRun (void)
   proseHelper->ActivateSidelinkBearer (Seconds (2.0), ueDevs, tft);
   ///*** End of application configuration ***///
 
+  //Sample the frame and subframe numbers of the receiver in the middle of
+  //subframes, including the idle ones
+  Ptr<LteUeRrc> rxRrc = ueDevs.Get (1)->GetObject<LteUeNetDevice> ()->GetRrc ();
+  for (Time t = MicroSeconds (500500); t < Seconds (simTime); t += MicroSeconds (73100))
+    {
+      Simulator::Schedule (t, &SidelinkOutOfCoverageCommTestCase::SampleSubframe, this, rxRrc);
+    }
+
   //Enable traces
   lteHelper->EnableTraces ();
 
   Simulator::Stop (Seconds (simTime));
 
   Simulator::Run ();
+  uint64_t events = Simulator::GetEventCount ();
   Simulator::Destroy ();
+  Config::SetDefault ("ns3::LteUePhy::SkipIdleSubframes", BooleanValue (false));
 
-  NS_TEST_ASSERT_MSG_EQ (m_numPacketRx, 20, "20 packets should be received at the receiver!");
+  return events;
 }
 
 /**
@@ -303,7 +377,9 @@ SidelinkOutOfCoverageCommTestSuite::SidelinkOutOfCoverageCommTestSuite ()
   // LogComponentEnable ("TestSidelinkOutOfCoverageComm", LOG_LEVEL_ALL);
 
   //Test 1
-  AddTestCase (new SidelinkOutOfCoverageCommTestCase (), TestCase::QUICK);
+  AddTestCase (new SidelinkOutOfCoverageCommTestCase (false), TestCase::QUICK);
+  //Test 2
+  AddTestCase (new SidelinkOutOfCoverageCommTestCase (true), TestCase::QUICK);
 }
 
 static SidelinkOutOfCoverageCommTestSuite staticSidelinkOutOfCoverageCommTestSuite;
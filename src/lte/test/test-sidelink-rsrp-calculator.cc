@@ -0,0 +1,265 @@
+/* -*-  Mode: C++; c-file-style: "gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * NIST-developed software is provided by NIST as a public
+ * service. You may use, copy and distribute copies of the software in
+ * any medium, provided that you keep intact this entire notice. You
+ * may improve, modify and create derivative works of the software or
+ * any portion of the software, and you may copy and distribute such
+ * modifications or works. Modified works should carry a notice
+ * stating that you changed the software and should note the date and
+ * nature of any such change. Please explicitly acknowledge the
+ * National Institute of Standards and Technology as the source of the
+ * software.
+ *
+ * NIST-developed software is expressly provided "AS IS." NIST MAKES
+ * NO WARRANTY OF ANY KIND, EXPRESS, IMPLIED, IN FACT OR ARISING BY
+ * OPERATION OF LAW, INCLUDING, WITHOUT LIMITATION, THE IMPLIED
+ * WARRANTY OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE,
+ * NON-INFRINGEMENT AND DATA ACCURACY. NIST NEITHER REPRESENTS NOR
+ * WARRANTS THAT THE OPERATION OF THE SOFTWARE WILL BE UNINTERRUPTED
+ * OR ERROR-FREE, OR THAT ANY DEFECTS WILL BE CORRECTED. NIST DOES NOT
+ * WARRANT OR MAKE ANY REPRESENTATIONS REGARDING THE USE OF THE
+ * SOFTWARE OR THE RESULTS THEREOF, INCLUDING BUT NOT LIMITED TO THE
+ * CORRECTNESS, ACCURACY, RELIABILITY, OR USEFULNESS OF THE SOFTWARE.
+ *
+ * You are solely responsible for determining the appropriateness of
+ * using and distributing the software and you assume all risks
+ * associated with its use, including but not limited to the risks and
+ * costs of program errors, compliance with applicable laws, damage to
+ * or loss of data, programs or equipment, and the unavailability or
+ * interruption of operation. This software is not intended to be used
+ * in any situation where a failure could cause risk of injury or
+ * damage to property. The software developed by NIST employees is not
+ * subject to copyright protection within the United States.
+ */
+
+#include "ns3/sidelink-rsrp-calculator.h"
+#include <ns3/constant-position-mobility-model.h>
+#include <ns3/isotropic-antenna-model.h>
+#include <ns3/log.h>
+#include <ns3/lte-spectrum-phy.h>
+#include <ns3/propagation-loss-model.h>
+#include <ns3/test.h>
+#include <cmath>
+#include <limits>
+#include <string>
+#include <vector>
+
+NS_LOG_COMPONENT_DEFINE ("TestSidelinkRsrpCalculator");
+
+using namespace ns3;
+
+/**
+ * \ingroup lte
+ *
+ * Test case checking that the bulk S-RSRP functions of the SidelinkRsrpCalculator
+ * give the same values as the functions evaluating a single pair of UEs
+ */
+class SidelinkRsrpCalculatorBulkTestCase : public TestCase
+{
+public:
+  /**
+   * Constructor
+   *
+   * \param name The name of the test case
+   * \param lossModel The loss model
+   * \param antennaGain The gain of the isotropic antennas of the UEs, or NaN for UEs without antenna
+   * \param nThreads The maximum number of threads
+   */
+  SidelinkRsrpCalculatorBulkTestCase (std::string name, Ptr<PropagationLossModel> lossModel, double antennaGain, uint32_t nThreads);
+
+private:
+  virtual void DoRun (void);
+
+  /**
+   * Create UEs at pseudo-random positions
+   * \param n The number of UEs
+   * \param seed The seed of the positions
+   * \return The UEs
+   */
+  std::vector<Ptr<SpectrumPhy> > CreateUes (uint32_t n, uint32_t seed) const;
+
+  Ptr<PropagationLossModel> m_lossModel; ///< The loss model
+  double m_antennaGain; ///< The gain of the antennas, or NaN
+  uint32_t m_nThreads; ///< The maximum number of threads
+};
+
+SidelinkRsrpCalculatorBulkTestCase::SidelinkRsrpCalculatorBulkTestCase (std::string name, Ptr<PropagationLossModel> lossModel, double antennaGain, uint32_t nThreads)
+  : TestCase (name),
+    m_lossModel (lossModel),
+    m_antennaGain (antennaGain),
+    m_nThreads (nThreads)
+{
+}
+
+std::vector<Ptr<SpectrumPhy> >
+SidelinkRsrpCalculatorBulkTestCase::CreateUes (uint32_t n, uint32_t seed) const
+{
+  std::vector<Ptr<SpectrumPhy> > ues;
+  uint32_t state = seed;
+  for (uint32_t i = 0; i < n; i++)
+    {
+      Ptr<ConstantPositionMobilityModel> mobility = CreateObject<ConstantPositionMobilityModel> ();
+      double coordinates[3];
+      for (uint32_t j = 0; j < 3; j++)
+        {
+          state = state * 1103515245 + 12345;
+          coordinates[j] = (state >> 8) % 200000 / 100.0;
+        }
+      mobility->SetPosition (Vector (coordinates[0], coordinates[1], coordinates[2] / 100));
+      Ptr<LteSpectrumPhy> phy = CreateObject<LteSpectrumPhy> ();
+      phy->SetMobility (mobility);
+      if (!std::isnan (m_antennaGain))
+        {
+          Ptr<IsotropicAntennaModel> antenna = CreateObject<IsotropicAntennaModel> ();
+          antenna->SetAttribute ("Gain", DoubleValue (m_antennaGain));
+          phy->SetAntenna (antenna);
+        }
+      ues.push_back (phy);
+    }
+  // two UEs at the same position
+  ues.back ()->GetMobility ()->SetPosition (ues.front ()->GetMobility ()->GetPosition ());
+  return ues;
+}
+
+void
+SidelinkRsrpCalculatorBulkTestCase::DoRun (void)
+{
+  double txPower = 23;
+  double ulEarfcn = 23330;
+  double ulBandwidth = 50;
+  std::vector<Ptr<SpectrumPhy> > txPhys = CreateUes (23, 1);
+  std::vector<Ptr<SpectrumPhy> > rxPhys = CreateUes (17, 2);
+
+  SidelinkRsrpMatrix txPw = SidelinkRsrpCalculator::CalcSlRsrpTxPwMatrix (m_lossModel, txPower, txPhys, rxPhys, m_nThreads);
+  SidelinkRsrpMatrix psbch = SidelinkRsrpCalculator::CalcSlRsrpPsbchMatrix (m_lossModel, txPower, ulEarfcn, ulBandwidth, txPhys, rxPhys, m_nThreads);
+  NS_TEST_ASSERT_MSG_EQ (txPw.GetNTx (), txPhys.size (), "Unexpected number of transmitters");
+  NS_TEST_ASSERT_MSG_EQ (txPw.GetNRx (), rxPhys.size (), "Unexpected number of receivers");
+  for (uint32_t rx = 0; rx < rxPhys.size (); rx++)
+    {
+      for (uint32_t tx = 0; tx < txPhys.size (); tx++)
+        {
+          double expected = SidelinkRsrpCalculator::CalcSlRsrpTxPw (m_lossModel, txPower, txPhys[tx], rxPhys[rx]);
+          NS_TEST_ASSERT_MSG_EQ_TOL (txPw.Get (tx, rx), expected, 1e-4, "Unexpected RSRP from " << tx << " at " << rx);
+          expected = SidelinkRsrpCalculator::CalcSlRsrpPsbch (m_lossModel, txPower, ulEarfcn, ulBandwidth, txPhys[tx], rxPhys[rx]);
+          NS_TEST_ASSERT_MSG_EQ_TOL (psbch.Get (tx, rx), expected, 1e-4, "Unexpected S-RSRP from " << tx << " at " << rx);
+        }
+    }
+
+  uint32_t k = 4;
+  SidelinkRsrpNeighborTable neighbors = SidelinkRsrpCalculator::CalcSlRsrpTxPwNeighbors (m_lossModel, txPower, txPhys, k, m_nThreads);
+  NS_TEST_ASSERT_MSG_EQ (neighbors.size (), txPhys.size (), "Unexpected size of the neighbor table");
+  for (uint32_t ue = 0; ue < txPhys.size (); ue++)
+    {
+      NS_TEST_ASSERT_MSG_EQ (neighbors[ue].size (), k, "Unexpected number of neighbors of " << ue);
+      double previous = 0;
+      for (uint32_t i = 0; i < k; i++)
+        {
+          const SidelinkRsrpNeighbor &neighbor = neighbors[ue][i];
+          NS_TEST_ASSERT_MSG_NE (neighbor.index, ue, "A UE is its own neighbor");
+          double expected = SidelinkRsrpCalculator::CalcSlRsrpTxPw (m_lossModel, txPower, txPhys[neighbor.index], txPhys[ue]);
+          NS_TEST_ASSERT_MSG_EQ_TOL (neighbor.rsrp, expected, 1e-9, "Unexpected RSRP of a neighbor of " << ue);
+          if (i > 0)
+            {
+              NS_TEST_ASSERT_MSG_LT_OR_EQ (neighbor.rsrp, previous, "Neighbors of " << ue << " not sorted");
+            }
+          previous = neighbor.rsrp;
+        }
+      // no other UE is received with a higher RSRP than the last neighbor
+      for (uint32_t other = 0; other < txPhys.size (); other++)
+        {
+          bool isNeighbor = (other == ue);
+          for (uint32_t i = 0; i < k; i++)
+            {
+              isNeighbor = isNeighbor || neighbors[ue][i].index == other;
+            }
+          if (!isNeighbor)
+            {
+              double rsrp = SidelinkRsrpCalculator::CalcSlRsrpTxPw (m_lossModel, txPower, txPhys[other], txPhys[ue]);
+              NS_TEST_ASSERT_MSG_LT_OR_EQ (rsrp, previous, "UE " << other << " should be a neighbor of " << ue);
+            }
+        }
+    }
+
+  SidelinkRsrpNeighborTable psbchNeighbors = SidelinkRsrpCalculator::CalcSlRsrpPsbchNeighbors (m_lossModel, txPower, ulEarfcn, ulBandwidth, txPhys, 1, m_nThreads);
+  for (uint32_t ue = 0; ue < txPhys.size (); ue++)
+    {
+      // the S-RSRP only differs from the RSRP by a constant
+      NS_TEST_ASSERT_MSG_EQ (psbchNeighbors[ue].size (), 1, "Unexpected number of neighbors of " << ue);
+      NS_TEST_ASSERT_MSG_EQ (psbchNeighbors[ue][0].index, neighbors[ue][0].index, "Unexpected strongest neighbor of " << ue);
+    }
+
+  // a threshold keeping about half of the links
+  double threshold = (psbch.Get (0, 0) + psbch.Get (1, 1)) / 2;
+  SidelinkRsrpNeighborTable graph = SidelinkRsrpCalculator::CalcSlRsrpPsbchGraph (m_lossModel, txPower, ulEarfcn, ulBandwidth, txPhys, rxPhys, threshold, m_nThreads);
+  NS_TEST_ASSERT_MSG_EQ (graph.size (), txPhys.size (), "Unexpected size of the graph");
+  for (uint32_t tx = 0; tx < txPhys.size (); tx++)
+    {
+      std::vector<bool> linked (rxPhys.size (), false);
+      for (uint32_t i = 0; i < graph[tx].size (); i++)
+        {
+          const SidelinkRsrpNeighbor &link = graph[tx][i];
+          if (i > 0)
+            {
+              NS_TEST_ASSERT_MSG_GT (link.index, graph[tx][i - 1].index, "Links of " << tx << " not sorted");
+            }
+          double expected = SidelinkRsrpCalculator::CalcSlRsrpPsbch (m_lossModel, txPower, ulEarfcn, ulBandwidth, txPhys[tx], rxPhys[link.index]);
+          NS_TEST_ASSERT_MSG_EQ_TOL (link.rsrp, expected, 1e-4, "Unexpected S-RSRP of a link of " << tx);
+          linked[link.index] = true;
+        }
+      for (uint32_t rx = 0; rx < rxPhys.size (); rx++)
+        {
+          double rsrp = SidelinkRsrpCalculator::CalcSlRsrpPsbch (m_lossModel, txPower, ulEarfcn, ulBandwidth, txPhys[tx], rxPhys[rx]);
+          if (std::abs (rsrp - threshold) > 1e-3)
+            {
+              NS_TEST_ASSERT_MSG_EQ (linked[rx], (rsrp >= threshold), "Unexpected link from " << tx << " to " << rx);
+            }
+        }
+    }
+
+  // no UE is linked to itself
+  graph = SidelinkRsrpCalculator::CalcSlRsrpTxPwGraph (m_lossModel, txPower, txPhys, txPhys, -std::numeric_limits<double>::infinity (), m_nThreads);
+  for (uint32_t ue = 0; ue < txPhys.size (); ue++)
+    {
+      NS_TEST_ASSERT_MSG_EQ (graph[ue].size (), txPhys.size () - 1, "Unexpected number of links of " << ue);
+      for (uint32_t i = 0; i < graph[ue].size (); i++)
+        {
+          NS_TEST_ASSERT_MSG_NE (graph[ue][i].index, ue, "A UE is linked to itself");
+        }
+    }
+}
+
+/**
+ * \ingroup lte
+ *
+ * Test suite for the SidelinkRsrpCalculator
+ */
+class SidelinkRsrpCalculatorTestSuite : public TestSuite
+{
+public:
+  SidelinkRsrpCalculatorTestSuite ();
+};
+
+SidelinkRsrpCalculatorTestSuite::SidelinkRsrpCalculatorTestSuite ()
+  : TestSuite ("sidelink-rsrp-calculator", UNIT)
+{
+  double noAntenna = std::numeric_limits<double>::quiet_NaN ();
+
+  Ptr<FriisPropagationLossModel> friis = CreateObject<FriisPropagationLossModel> ();
+  friis->SetFrequency (700e6);
+  AddTestCase (new SidelinkRsrpCalculatorBulkTestCase ("Friis, 1 thread", friis, noAntenna, 1), TestCase::QUICK);
+  AddTestCase (new SidelinkRsrpCalculatorBulkTestCase ("Friis, 4 threads", friis, noAntenna, 4), TestCase::QUICK);
+
+  Ptr<LogDistancePropagationLossModel> logDistance = CreateObject<LogDistancePropagationLossModel> ();
+  logDistance->SetAttribute ("ReferenceDistance", DoubleValue (10));
+  logDistance->SetAttribute ("Exponent", DoubleValue (3.5));
+  AddTestCase (new SidelinkRsrpCalculatorBulkTestCase ("Log distance, isotropic antennas, 3 threads", logDistance, 5, 3), TestCase::QUICK);
+
+  // a chain of models is evaluated through the loss models
+  Ptr<LogDistancePropagationLossModel> chain = CreateObject<LogDistancePropagationLossModel> ();
+  chain->SetNext (CreateObject<FriisPropagationLossModel> ());
+  AddTestCase (new SidelinkRsrpCalculatorBulkTestCase ("Chained models", chain, 2, 4), TestCase::QUICK);
+  AddTestCase (new SidelinkRsrpCalculatorBulkTestCase ("Three log distance", CreateObject<ThreeLogDistancePropagationLossModel> (), noAntenna, 2), TestCase::QUICK);
+}
+
+static SidelinkRsrpCalculatorTestSuite staticSidelinkRsrpCalculatorTestSuite;
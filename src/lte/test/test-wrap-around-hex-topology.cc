@@ -38,6 +38,8 @@
 #include <ns3/simulator.h>
 #include <ns3/abort.h>
 #include <ns3/pointer.h>
+#include <ns3/double.h>
+#include <ns3/uinteger.h>
 
 #include <ns3/mobility-helper.h>
 #include <ns3/lte-helper.h>
@@ -270,6 +272,116 @@ WrapAroundTopologyTestCase::DoRun ()
 
 }
 
+/**
+ * \ingroup lte-test
+ * \ingroup tests
+ *
+ * \brief Wrap around distance test case.
+ *
+ * Verifies that the closest positions in wrap-around are the closest
+ * replicas of the receivers returned by GetWrapAroundPositions, that the
+ * batched and single pair functions agree, and that IsInWrapAround detects
+ * the points of the central cluster and of its replicas.
+ */
+class WrapAroundDistanceTestCase : public TestCase
+{
+public:
+  /**
+   * Constructor
+   *
+   * \param nRings Number of Rings of hexagonal cells
+   */
+  WrapAroundDistanceTestCase (uint32_t nRings)
+    : TestCase ("Verifying the closest positions and distances in wrap-around for " + std::to_string (nRings) + " rings"),
+      m_nRings (nRings)
+  {
+  }
+
+private:
+  virtual void DoRun (void);
+
+  uint32_t m_nRings; ///< Number of Rings of hexagonal cells
+};
+
+void
+WrapAroundDistanceTestCase::DoRun ()
+{
+  double isd = 500;
+  Ptr<Lte3gppHexGridEnbTopologyHelper> topoHelper = CreateObject<Lte3gppHexGridEnbTopologyHelper> ();
+  topoHelper->SetAttribute ("InterSiteDistance", DoubleValue (isd));
+  topoHelper->SetAttribute ("NumberOfRings", UintegerValue (m_nRings));
+
+  std::map<std::vector<double>,WrapAroundReplicas> replicas = topoHelper->GetWrapAroundPositions ();
+  uint32_t nSites = 1 + 3 * m_nRings * (m_nRings - 1);
+  NS_TEST_ASSERT_MSG_EQ (replicas.size (), nSites, "Unexpected number of sites");
+
+  //The translations of the central cluster
+  const std::vector<double> &center = replicas.begin ()->first;
+  std::vector<Vector> offsets;
+  for (const auto &pos : replicas.begin ()->second.positions)
+    {
+      offsets.push_back (Vector (pos.x - center[0], pos.y - center[1], 0));
+    }
+  NS_TEST_ASSERT_MSG_EQ (offsets.size (), 6, "Unexpected number of replicas");
+
+  for (const auto &site : replicas)
+    {
+      NS_TEST_ASSERT_MSG_EQ (topoHelper->IsInWrapAround (site.first[0], site.first[1]), false, "Site should be in the central cluster");
+      NS_TEST_ASSERT_MSG_EQ (topoHelper->IsInWrapAround (site.first[0] + 0.45 * isd, site.first[1]), false, "Point should be in the central cluster");
+      NS_TEST_ASSERT_MSG_EQ (topoHelper->IsInWrapAround (site.first[0], site.first[1] - 0.45 * isd), false, "Point should be in the central cluster");
+      for (const auto &pos : site.second.positions)
+        {
+          NS_TEST_ASSERT_MSG_EQ (topoHelper->IsInWrapAround (pos.x, pos.y), true, "Replica should be in wrap-around");
+          NS_TEST_ASSERT_MSG_EQ (topoHelper->IsInWrapAround (pos.x - 0.45 * isd, pos.y), true, "Point should be in wrap-around");
+          NS_TEST_ASSERT_MSG_EQ (topoHelper->IsInWrapAround (pos.x, pos.y + 0.45 * isd), true, "Point should be in wrap-around");
+        }
+    }
+
+  //Receivers on a grid covering the central cluster
+  double extent = isd * m_nRings;
+  std::vector<Vector> rxPos;
+  for (double x = -extent; x <= extent; x += isd / 3)
+    {
+      for (double y = -extent; y <= extent; y += isd / 4)
+        {
+          rxPos.push_back (Vector (x, y, 1.5));
+        }
+    }
+  std::vector<Vector> txPos (rxPos.rbegin (), rxPos.rend ());
+
+  std::vector<Vector> closestPos;
+  std::vector<double> distances;
+  topoHelper->GetClosestPositionsInWrapAround (txPos, rxPos, closestPos, distances);
+  NS_TEST_ASSERT_MSG_EQ (closestPos.size (), rxPos.size (), "Unexpected number of closest positions");
+  NS_TEST_ASSERT_MSG_EQ (distances.size (), rxPos.size (), "Unexpected number of distances");
+
+  std::vector<Vector> closestPosFromTx;
+  std::vector<double> distancesFromTx;
+  topoHelper->GetClosestPositionsInWrapAround (txPos[0], rxPos, closestPosFromTx, distancesFromTx);
+
+  for (uint32_t i = 0; i < rxPos.size (); ++i)
+    {
+      double minDistance = CalculateDistance (Vector (txPos[i].x, txPos[i].y, 0), Vector (rxPos[i].x, rxPos[i].y, 0));
+      for (const auto &offset : offsets)
+        {
+          double d = CalculateDistance (Vector (txPos[i].x, txPos[i].y, 0), Vector (rxPos[i].x + offset.x, rxPos[i].y + offset.y, 0));
+          minDistance = std::min (minDistance, d);
+        }
+      NS_TEST_ASSERT_MSG_EQ_TOL (distances[i], minDistance, 1e-6, "Unexpected wrap-around distance");
+      NS_TEST_ASSERT_MSG_EQ_TOL (topoHelper->GetDistanceInWrapAround (txPos[i], rxPos[i]), distances[i], 1e-9, "Single and batched distances differ");
+      Vector closest = topoHelper->GetClosestPositionInWrapAround (txPos[i], rxPos[i]);
+      NS_TEST_ASSERT_MSG_EQ_TOL (closest.x, closestPos[i].x, 1e-9, "Single and batched positions differ");
+      NS_TEST_ASSERT_MSG_EQ_TOL (closest.y, closestPos[i].y, 1e-9, "Single and batched positions differ");
+      NS_TEST_ASSERT_MSG_EQ (closest.z, rxPos[i].z, "The height of the receiver should be kept");
+      NS_TEST_ASSERT_MSG_EQ_TOL (CalculateDistance (Vector (txPos[i].x, txPos[i].y, 0), Vector (closest.x, closest.y, 0)), distances[i], 1e-6, "Distance to the closest position differs");
+
+      closest = topoHelper->GetClosestPositionInWrapAround (txPos[0], rxPos[i]);
+      NS_TEST_ASSERT_MSG_EQ_TOL (closest.x, closestPosFromTx[i].x, 1e-9, "Single and batched positions differ");
+      NS_TEST_ASSERT_MSG_EQ_TOL (closest.y, closestPosFromTx[i].y, 1e-9, "Single and batched positions differ");
+      NS_TEST_ASSERT_MSG_EQ_TOL (topoHelper->GetDistanceInWrapAround (txPos[0], rxPos[i]), distancesFromTx[i], 1e-9, "Single and batched distances differ");
+    }
+}
+
 /**
  * \ingroup lte-test
  * \ingroup tests
@@ -287,6 +399,10 @@ WrapAroundTopologyTestSuite::WrapAroundTopologyTestSuite ()
 {
   //LogComponentEnable("WrapAroundTopologyTest", LOG_LEVEL_ALL);
   AddTestCase (new WrapAroundTopologyTestCase (2, 2, Seconds (0.8)), TestCase::QUICK);
+  for (uint32_t nRings = 1; nRings <= 4; ++nRings)
+    {
+      AddTestCase (new WrapAroundDistanceTestCase (nRings), TestCase::QUICK);
+    }
 }
 
 static WrapAroundTopologyTestSuite g_wrapAroundTopologyTestSuite;
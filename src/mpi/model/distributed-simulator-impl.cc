@@ -25,6 +25,7 @@
 #include "ns3/scheduler.h"
 #include "ns3/event-impl.h"
 #include "ns3/channel.h"
+#include "ns3/channel-list.h"
 #include "ns3/node-container.h"
 #include "ns3/ptr.h"
 #include "ns3/pointer.h"
@@ -230,6 +231,22 @@ DistributedSimulatorImpl::CalculateLookAhead (void)
                 }
             }
         }
+
+      // Other channels spanning several systems, such as
+      // DistributedSpectrumChannel, report the minimum delay from this
+      // system to the others in their LookAhead attribute, which is
+      // zero only if they do not reach any other system: they abort on
+      // a zero delay to the receivers of another system.
+      for (ChannelList::Iterator iter = ChannelList::Begin (); iter != ChannelList::End (); ++iter)
+        {
+          TimeValue delay;
+          if ((*iter)->GetAttributeFailSafe ("LookAhead", delay)
+              && delay.Get ().IsStrictlyPositive ()
+              && delay.Get () < m_lookAhead)
+            {
+              m_lookAhead = delay.Get ();
+            }
+        }
     }
 
   // m_lookAhead is now set
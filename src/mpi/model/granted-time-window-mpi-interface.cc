@@ -23,6 +23,7 @@
 #include <iostream>
 #include <iomanip>
 #include <list>
+#include <vector>
 
 #include "granted-time-window-mpi-interface.h"
 #include "mpi-receiver.h"
@@ -30,11 +31,14 @@
 
 #include "ns3/node.h"
 #include "ns3/node-list.h"
+#include "ns3/channel.h"
+#include "ns3/channel-list.h"
 #include "ns3/net-device.h"
 #include "ns3/simulator.h"
 #include "ns3/simulator-impl.h"
 #include "ns3/nstime.h"
 #include "ns3/log.h"
+#include "ns3/abort.h"
 
 #ifdef NS3_MPI
 #include <mpi.h>
@@ -192,12 +196,31 @@ GrantedTimeWindowMpiInterface::SendPacket (Ptr<Packet> p, const Time& rxTime, ui
 {
   NS_LOG_FUNCTION (this << p << rxTime.GetTimeStep () << node << dev);
 
+  // Find the system id for the destination node
+  Ptr<Node> destNode = NodeList::GetNode (node);
+  Send (p, rxTime, node, dev, destNode->GetSystemId ());
+}
+
+void
+GrantedTimeWindowMpiInterface::SendChannelPacket (Ptr<Packet> p, const Time& rxTime, uint32_t channel, uint32_t systemId)
+{
+  NS_LOG_FUNCTION (this << p << rxTime.GetTimeStep () << channel << systemId);
+
+  Send (p, rxTime, channel, CHANNEL_DEVICE, systemId);
+}
+
+void
+GrantedTimeWindowMpiInterface::Send (Ptr<Packet> p, const Time& rxTime, uint32_t node, uint32_t dev, uint32_t systemId)
+{
 #ifdef NS3_MPI
   SentBuffer sendBuf;
   m_pendingTx.push_back (sendBuf);
   std::list<SentBuffer>::reverse_iterator i = m_pendingTx.rbegin (); // Points to the last element
 
   uint32_t serializedSize = p->GetSerializedSize ();
+  NS_ABORT_MSG_IF (dev != CHANNEL_DEVICE && serializedSize + 16 > MAX_MPI_MSG_SIZE,
+                   "Packet of " << serializedSize << " bytes exceeds the MPI receive buffers of "
+                   << MAX_MPI_MSG_SIZE << " bytes");
   uint8_t* buffer =  new uint8_t[serializedSize + 16];
   i->SetBuffer (buffer);
   // Add the time, dest node and dest device
@@ -210,12 +233,8 @@ GrantedTimeWindowMpiInterface::SendPacket (Ptr<Packet> p, const Time& rxTime, ui
   // Serialize the packet
   p->Serialize (reinterpret_cast<uint8_t *> (pData), serializedSize);
 
-  // Find the system id for the destination node
-  Ptr<Node> destNode = NodeList::GetNode (node);
-  uint32_t nodeSysId = destNode->GetSystemId ();
-
-  MPI_Isend (reinterpret_cast<void *> (i->GetBuffer ()), serializedSize + 16, MPI_CHAR, nodeSysId,
-             0, MPI_COMM_WORLD, (i->GetRequest ()));
+  MPI_Isend (reinterpret_cast<void *> (i->GetBuffer ()), serializedSize + 16, MPI_CHAR, systemId,
+             dev == CHANNEL_DEVICE ? CHANNEL_TAG : 0, MPI_COMM_WORLD, (i->GetRequest ()));
   m_txCount++;
 #else
   NS_FATAL_ERROR ("Can't use distributed simulator without MPI compiled in");
@@ -281,6 +300,58 @@ GrantedTimeWindowMpiInterface::ReceiveMessages ()
       MPI_Irecv (m_pRxBuffers[index], MAX_MPI_MSG_SIZE, MPI_CHAR, MPI_ANY_SOURCE, 0,
                  MPI_COMM_WORLD, &m_requests[index]);
     }
+  ReceiveChannelMessages ();
+#else
+  NS_FATAL_ERROR ("Can't use distributed simulator without MPI compiled in");
+#endif
+}
+
+void
+GrantedTimeWindowMpiInterface::ReceiveChannelMessages ()
+{
+  NS_LOG_FUNCTION_NOARGS ();
+
+#ifdef NS3_MPI
+  // The channel packets carry the PSD of a signal, which may exceed
+  // MAX_MPI_MSG_SIZE, so each one is received in a buffer of its size
+  std::vector<char> buffer;
+  while (true)
+    {
+      int flag = 0;
+      MPI_Status status;
+
+      MPI_Iprobe (MPI_ANY_SOURCE, CHANNEL_TAG, MPI_COMM_WORLD, &flag, &status);
+      if (!flag)
+        {
+          break;        // No more messages
+        }
+      int count;
+      MPI_Get_count (&status, MPI_CHAR, &count);
+      buffer.resize (count);
+      MPI_Recv (buffer.data (), count, MPI_CHAR, status.MPI_SOURCE, CHANNEL_TAG,
+                MPI_COMM_WORLD, MPI_STATUS_IGNORE);
+      m_rxCount++; // Count this receive
+
+      // Get the meta data first
+      uint64_t* pTime = reinterpret_cast<uint64_t *> (buffer.data ());
+      uint64_t time = *pTime++;
+      uint32_t* pData = reinterpret_cast<uint32_t *> (pTime);
+      uint32_t channel = *pData++;
+      uint32_t dev  = *pData++;
+      NS_ASSERT (dev == CHANNEL_DEVICE);
+
+      Time rxTime (time);
+
+      count -= sizeof (time) + sizeof (channel) + sizeof (dev);
+
+      Ptr<Packet> p = Create<Packet> (reinterpret_cast<uint8_t *> (pData), count, true);
+
+      // The packet is for the instance of a channel in this system
+      Ptr<MpiReceiver> pMpiRec = ChannelList::GetChannel (channel)->GetObject<MpiReceiver> ();
+      NS_ASSERT (pMpiRec);
+      Simulator::ScheduleWithContext (Simulator::NO_CONTEXT, rxTime - Simulator::Now (),
+                                      &MpiReceiver::Receive, pMpiRec, p);
+    }
 #else
   NS_FATAL_ERROR ("Can't use distributed simulator without MPI compiled in");
 #endif
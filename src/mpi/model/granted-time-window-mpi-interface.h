@@ -41,7 +41,8 @@ namespace ns3 {
 
 /**
  * maximum MPI message size for easy
- * buffer creation
+ * buffer creation; the channel packets, which may be larger, are
+ * received in a buffer of their own size
  */
 const uint32_t MAX_MPI_MSG_SIZE = 2000;
 
@@ -131,6 +132,18 @@ public:
    * Serialize and send a packet to the specified node and net device
    */
   virtual void SendPacket (Ptr<Packet> p, const Time &rxTime, uint32_t node, uint32_t dev);
+  /**
+   * \param p packet to send
+   * \param rxTime received time at destination
+   * \param channel destination channel index in the ChannelList
+   * \param systemId destination system id
+   *
+   * Serialize and send a packet to the instance of a channel in the
+   * specified system.  The packet is sent like those of SendPacket,
+   * with the channel index in place of the node id and CHANNEL_DEVICE
+   * in place of the device.
+   */
+  virtual void SendChannelPacket (Ptr<Packet> p, const Time &rxTime, uint32_t channel, uint32_t systemId);
   /**
    * Check for received messages complete
    */
@@ -149,6 +162,30 @@ public:
   static uint32_t GetTxCount ();
 
 private:
+  /** Device id of the packets sent by SendChannelPacket. */
+  static const uint32_t CHANNEL_DEVICE = 0xffffffff;
+  /** MPI tag of the packets sent by SendChannelPacket. */
+  static const int CHANNEL_TAG = 1;
+
+  /**
+   * Receive the packets sent by SendChannelPacket, which are probed for
+   * their size instead of being received in the buffers of
+   * MAX_MPI_MSG_SIZE bytes, and schedule their reception.
+   */
+  static void ReceiveChannelMessages ();
+
+  /**
+   * Serialize and send a packet to a system.  The packets sent to a
+   * node must not exceed MAX_MPI_MSG_SIZE bytes with their metadata.
+   *
+   * \param p packet to send
+   * \param rxTime received time at destination
+   * \param node destination node, or channel index
+   * \param dev destination device, or CHANNEL_DEVICE
+   * \param systemId destination system id
+   */
+  void Send (Ptr<Packet> p, const Time &rxTime, uint32_t node, uint32_t dev, uint32_t systemId);
+
   static uint32_t m_sid;
   static uint32_t m_size;
 
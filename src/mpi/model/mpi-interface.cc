@@ -115,6 +115,13 @@ MpiInterface::SendPacket (Ptr<Packet> p, const Time& rxTime, uint32_t node, uint
   g_parallelCommunicationInterface->SendPacket (p, rxTime, node, dev);
 }
 
+void
+MpiInterface::SendChannelPacket (Ptr<Packet> p, const Time& rxTime, uint32_t channel, uint32_t systemId)
+{
+  NS_ASSERT (g_parallelCommunicationInterface);
+  g_parallelCommunicationInterface->SendChannelPacket (p, rxTime, channel, systemId);
+}
+
 
 void
 MpiInterface::Disable ()
@@ -94,6 +94,18 @@ public:
    * Serialize and send a packet to the specified node and net device
    */
   static void SendPacket (Ptr<Packet> p, const Time &rxTime, uint32_t node, uint32_t dev);
+  /**
+   * \param p packet to send
+   * \param rxTime received time at destination
+   * \param channel destination channel index in the ChannelList
+   * \param systemId destination system id
+   *
+   * Serialize and send a packet to the instance of a channel in the
+   * specified system, for channels spanning several systems such as
+   * DistributedSpectrumChannel.  The packet is delivered to the
+   * MpiReceiver aggregated to the channel.
+   */
+  static void SendChannelPacket (Ptr<Packet> p, const Time &rxTime, uint32_t channel, uint32_t systemId);
 private:
 
   /**
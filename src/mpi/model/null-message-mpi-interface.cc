@@ -239,6 +239,15 @@ NullMessageMpiInterface::SendPacket (Ptr<Packet> p, const Time& rxTime, uint32_t
 #endif
 }
 
+void
+NullMessageMpiInterface::SendChannelPacket (Ptr<Packet> p, const Time& rxTime, uint32_t channel, uint32_t systemId)
+{
+  NS_LOG_FUNCTION (this << p << rxTime.GetTimeStep () << channel << systemId);
+
+  NS_FATAL_ERROR ("Channels spanning several systems are only supported by the granted time window synchronization "
+                  "(ns3::DistributedSimulatorImpl)");
+}
+
 void
 NullMessageMpiInterface::SendNullMessage (const Time& guarantee_update, Ptr<RemoteChannelBundle> bundle)
 {
@@ -140,6 +140,16 @@ public:
    * uint8_t[] serialized packet
    */
   virtual void SendPacket (Ptr<Packet> p, const Time &rxTime, uint32_t node, uint32_t dev);
+  /**
+   * \param p packet to send
+   * \param rxTime received time at destination
+   * \param channel destination channel index in the ChannelList
+   * \param systemId destination system id
+   *
+   * Not supported: the Null Message algorithm only knows the remote
+   * systems connected by point-to-point links.
+   */
+  virtual void SendChannelPacket (Ptr<Packet> p, const Time &rxTime, uint32_t channel, uint32_t systemId);
   /**
    * \param guaranteeUpdate guarantee update time for the Null Message
    * \bundle the destination bundle for the Null Message.
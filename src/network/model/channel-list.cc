@@ -21,8 +21,18 @@
 #include "ns3/config.h"
 #include "ns3/log.h"
 #include "ns3/assert.h"
+#include "ns3/core-config.h"
+#ifdef HAVE_PTHREAD_H
+#include "ns3/multithreaded-simulator-impl.h"
+#endif /* HAVE_PTHREAD_H */
 #include "channel-list.h"
 #include "channel.h"
+#include "net-device.h"
+#include "node.h"
+#include "node-list.h"
+
+#include <algorithm>
+#include <utility>
 
 namespace ns3 {
 
@@ -176,6 +186,7 @@ ChannelListPriv::Add (Ptr<Channel> channel)
   NS_LOG_FUNCTION (this << channel);
   uint32_t index = m_channels.size ();
   m_channels.push_back (channel);
+  Config::InvalidateCache ();
   return index;
 
 }
@@ -245,4 +256,213 @@ ChannelList::GetNChannels (void)
   return ChannelListPriv::Get ()->GetNChannels ();
 }
 
+#ifdef HAVE_PTHREAD_H
+
+/**
+ * Get the minimum delay of the packets delivered by a channel to the
+ * nodes of other partitions of MultithreadedSimulatorImpl: as for
+ * DistributedSimulatorImpl, only the channels of point-to-point devices
+ * schedule their delivery with their Delay attribute.
+ *
+ * \param channel the channel
+ * \return the minimum delay of the channel, or zero
+ */
+static Time
+GetChannelDelay (Ptr<Channel> channel)
+{
+  for (std::size_t i = 0; i < channel->GetNDevices (); ++i)
+    {
+      Ptr<NetDevice> device = channel->GetDevice (i);
+      if (device != 0 && !device->IsPointToPoint ())
+        {
+          return Seconds (0);
+        }
+    }
+  TimeValue delay;
+  if (!channel->GetAttributeFailSafe ("Delay", delay))
+    {
+      return Seconds (0);
+    }
+  return delay.Get ();
+}
+
+/**
+ * Get the minimum delay of the channels connecting the nodes of different
+ * partitions of MultithreadedSimulatorImpl.
+ *
+ * \param nPartitions the number of partitions
+ * \param partitions the partition of each node, the other nodes being
+ *        assigned by node id modulo the number of partitions
+ * \return the minimum delay, or Time::Max () if no channel connects
+ *         different partitions
+ */
+static Time
+GetChannelLookahead (uint32_t nPartitions, const std::vector<uint32_t> &partitions)
+{
+  NS_LOG_FUNCTION (nPartitions);
+  Time lookahead = Time::Max ();
+  for (ChannelList::Iterator it = ChannelList::Begin (); it != ChannelList::End (); ++it)
+    {
+      Ptr<Channel> channel = *it;
+      uint32_t first = nPartitions;
+      bool crossing = false;
+      for (std::size_t i = 0; i < channel->GetNDevices (); ++i)
+        {
+          Ptr<NetDevice> device = channel->GetDevice (i);
+          if (device == 0 || device->GetNode () == 0)
+            {
+              continue;
+            }
+          uint32_t node = device->GetNode ()->GetId ();
+          uint32_t partition = node < partitions.size () ? partitions[node] : node % nPartitions;
+          if (first == nPartitions)
+            {
+              first = partition;
+            }
+          else if (partition != first)
+            {
+              crossing = true;
+            }
+        }
+      if (crossing)
+        {
+          lookahead = std::min (lookahead, GetChannelDelay (channel));
+        }
+    }
+  return lookahead;
+}
+
+/**
+ * Find the representative of a set of nodes, i.e., its smallest node id.
+ *
+ * \param parent the parent of each node in its set
+ * \param node the node id
+ * \return the representative of the set of the node
+ */
+static uint32_t
+FindChannelComponent (std::vector<uint32_t> &parent, uint32_t node)
+{
+  while (parent[node] != node)
+    {
+      parent[node] = parent[parent[node]];
+      node = parent[node];
+    }
+  return node;
+}
+
+/**
+ * Assign the nodes to the partitions of MultithreadedSimulatorImpl, when
+ * a channel without minimum delay connects the nodes of different
+ * partitions: the nodes connected by such channels, directly or through
+ * other nodes, share the channels and the packets, and are thus assigned
+ * to the same partition, and the sets of nodes are spread, from the
+ * largest, on the partitions with the fewest nodes.
+ *
+ * \param nPartitions the number of partitions
+ * \return the partition of each node
+ */
+static std::vector<uint32_t>
+AssignChannelPartitions (uint32_t nPartitions)
+{
+  NS_LOG_FUNCTION (nPartitions);
+  uint32_t nNodes = NodeList::GetNNodes ();
+  std::vector<uint32_t> parent (nNodes);
+  for (uint32_t i = 0; i < nNodes; ++i)
+    {
+      parent[i] = i;
+    }
+  for (ChannelList::Iterator it = ChannelList::Begin (); it != ChannelList::End (); ++it)
+    {
+      Ptr<Channel> channel = *it;
+      if (GetChannelDelay (channel).IsStrictlyPositive ())
+        {
+          continue;
+        }
+      uint32_t first = nNodes;
+      for (std::size_t i = 0; i < channel->GetNDevices (); ++i)
+        {
+          Ptr<NetDevice> device = channel->GetDevice (i);
+          if (device == 0 || device->GetNode () == 0)
+            {
+              continue;
+            }
+          uint32_t component = FindChannelComponent (parent, device->GetNode ()->GetId ());
+          if (first == nNodes)
+            {
+              first = component;
+            }
+          else if (component != first)
+            {
+              parent[std::max (first, component)] = std::min (first, component);
+              first = std::min (first, component);
+            }
+        }
+    }
+
+  std::vector<uint32_t> size (nNodes, 0);
+  for (uint32_t i = 0; i < nNodes; ++i)
+    {
+      size[FindChannelComponent (parent, i)]++;
+    }
+  // (-size, representative), so that the largest sets come first
+  std::vector<std::pair<int64_t, uint32_t> > components;
+  for (uint32_t i = 0; i < nNodes; ++i)
+    {
+      if (size[i] != 0)
+        {
+          components.push_back (std::make_pair (-static_cast<int64_t> (size[i]), i));
+        }
+    }
+  std::sort (components.begin (), components.end ());
+
+  std::vector<uint32_t> load (nPartitions, 0);
+  std::vector<uint32_t> componentPartition (nNodes, 0);
+  for (std::vector<std::pair<int64_t, uint32_t> >::const_iterator it = components.begin (); it != components.end (); ++it)
+    {
+      uint32_t partition = std::min_element (load.begin (), load.end ()) - load.begin ();
+      componentPartition[it->second] = partition;
+      load[partition] += -it->first;
+    }
+
+  std::vector<uint32_t> partitions (nNodes);
+  for (uint32_t i = 0; i < nNodes; ++i)
+    {
+      partitions[i] = componentPartition[FindChannelComponent (parent, i)];
+    }
+  NS_LOG_INFO (components.size () << " sets of nodes connected by channels without delay");
+  return partitions;
+}
+
+/**
+ * \ingroup network
+ * Set GetChannelLookahead and AssignChannelPartitions as the lookahead and
+ * partition callbacks of MultithreadedSimulatorImpl when the network
+ * module is loaded.
+ */
+static class ChannelPartitionInitializer
+{
+public:
+  ChannelPartitionInitializer ()
+  {
+    MultithreadedSimulatorImpl::SetLookaheadCallback (MakeCallback (&GetChannelLookahead));
+    MultithreadedSimulatorImpl::SetPartitionCallback (MakeCallback (&AssignChannelPartitions));
+  }
+} g_channelPartitionInitializer; ///< the partition callback initializer
+
+#endif /* HAVE_PTHREAD_H */
+
+/**
+ * \ingroup network
+ * Register the ChannelList as a cached container of Config when the network
+ * module is loaded, since ChannelList::Add invalidates the Config cache.
+ */
+static class ChannelListCachedContainerInitializer
+{
+public:
+  ChannelListCachedContainerInitializer ()
+  {
+    Config::RegisterCachedContainer ("ns3::ChannelListPriv", "ChannelList");
+  }
+} g_channelListCachedContainerInitializer; ///< the cached containers initializer
+
 } // namespace ns3
@@ -178,6 +178,7 @@ NodeListPriv::Add (Ptr<Node> node)
   NS_LOG_FUNCTION (this << node);
   uint32_t index = m_nodes.size ();
   m_nodes.push_back (node);
+  Config::InvalidateCache ();
   Simulator::ScheduleWithContext (index, TimeStep (0), &Node::Initialize, node);
   return index;
 
@@ -250,4 +251,18 @@ NodeList::GetNNodes (void)
   return NodeListPriv::Get ()->GetNNodes ();
 }
 
+/**
+ * \ingroup network
+ * Register the NodeList as a cached container of Config when the network
+ * module is loaded, since NodeList::Add invalidates the Config cache.
+ */
+static class NodeListCachedContainerInitializer
+{
+public:
+  NodeListCachedContainerInitializer ()
+  {
+    Config::RegisterCachedContainer ("ns3::NodeListPriv", "NodeList");
+  }
+} g_nodeListCachedContainerInitializer; ///< the cached containers initializer
+
 } // namespace ns3
@@ -31,6 +31,7 @@
 #include "ns3/assert.h"
 #include "ns3/global-value.h"
 #include "ns3/boolean.h"
+#include "ns3/config.h"
 
 namespace ns3 {
 
@@ -130,6 +131,7 @@ Node::AddDevice (Ptr<NetDevice> device)
   NS_LOG_FUNCTION (this << device);
   uint32_t index = m_devices.size ();
   m_devices.push_back (device);
+  Config::InvalidateCache ();
   device->SetNode (this);
   device->SetIfIndex (index);
   device->SetReceiveCallback (MakeCallback (&Node::NonPromiscReceiveFromDevice, this));
@@ -159,6 +161,7 @@ Node::AddApplication (Ptr<Application> application)
   NS_LOG_FUNCTION (this << application);
   uint32_t index = m_applications.size ();
   m_applications.push_back (application);
+  Config::InvalidateCache ();
   application->SetNode (this);
   Simulator::ScheduleWithContext (GetId (), Seconds (0.0), 
                                   &Application::Initialize, application);
@@ -368,4 +371,20 @@ Node::NotifyDeviceAdded (Ptr<NetDevice> device)
 }
  
 
+/**
+ * \ingroup network
+ * Register the devices and applications of the nodes as cached
+ * containers of Config when the network module is loaded, since
+ * Node::AddDevice and Node::AddApplication invalidate the Config cache.
+ */
+static class NodeCachedContainerInitializer
+{
+public:
+  NodeCachedContainerInitializer ()
+  {
+    Config::RegisterCachedContainer ("ns3::Node", "DeviceList");
+    Config::RegisterCachedContainer ("ns3::Node", "ApplicationList");
+  }
+} g_nodeCachedContainerInitializer; ///< the cached containers initializer
+
 } // namespace ns3
@@ -34,6 +34,70 @@ namespace ns3 {
 
 NS_LOG_COMPONENT_DEFINE ("PacketTagList");
 
+namespace {
+
+/// A free TagData block
+struct FreeTagBlock
+{
+  FreeTagBlock *next; //!< the next free block of the same size
+};
+
+/// Granularity of the recycled block sizes, in bytes
+const std::size_t TAG_BLOCK_ALIGN = sizeof (void *);
+/// Largest serialized tag size whose TagData block is recycled
+const std::size_t MAX_POOLED_TAG_SIZE = 128;
+/// Number of block sizes which are recycled
+const std::size_t TAG_POOL_SIZES = MAX_POOLED_TAG_SIZE / TAG_BLOCK_ALIGN + 2;
+/// Maximum number of free blocks kept for each block size
+const uint32_t MAX_FREE_TAG_BLOCKS = 4096;
+
+// The free lists are trivially destructible, so that they can still be
+// accessed by the tags destroyed after the TagPoolReleaser of the same
+// thread.
+thread_local FreeTagBlock *g_freeTagBlocks[TAG_POOL_SIZES];  //!< free blocks, by rounded tag size
+thread_local uint32_t g_nFreeTagBlocks[TAG_POOL_SIZES];      //!< number of free blocks, by rounded tag size
+thread_local bool g_tagPoolReleased = false;                 //!< true after the thread pool has been released
+
+/**
+ * Return the free TagData blocks of a thread to the heap when the thread exits
+ */
+struct TagPoolReleaser
+{
+  ~TagPoolReleaser ()
+  {
+    for (std::size_t i = 0; i < TAG_POOL_SIZES; ++i)
+      {
+        while (g_freeTagBlocks[i] != 0)
+          {
+            FreeTagBlock *block = g_freeTagBlocks[i];
+            g_freeTagBlocks[i] = block->next;
+            std::free (block);
+          }
+        g_nFreeTagBlocks[i] = 0;
+      }
+    g_tagPoolReleased = true;
+  }
+};
+
+thread_local TagPoolReleaser g_tagPoolReleaser; //!< releases the pool of the thread
+
+/**
+ * \param dataSize the serialized size of a tag
+ * \return the index of the free list of its TagData, or 0 if it is not pooled
+ */
+inline std::size_t
+GetTagPoolIndex (std::size_t dataSize)
+{
+  if (dataSize > MAX_POOLED_TAG_SIZE)
+    {
+      return 0;
+    }
+  // round up, so that the blocks of a list can hold any size mapped to it
+  return dataSize / TAG_BLOCK_ALIGN + 1;
+}
+
+} // unnamed namespace
+
 PacketTagList::TagData *
 PacketTagList::CreateTagData (size_t dataSize)
 {
@@ -43,14 +107,48 @@ PacketTagList::CreateTagData (size_t dataSize)
                  << " exceeds maximum "
                  << std::numeric_limits<decltype(TagData::size)>::max () );
 
-  void * p = std::malloc (sizeof (TagData) + dataSize - 1);
-  // The matching frees are in RemoveAll and RemoveWriter
+  void * p;
+  std::size_t index = GetTagPoolIndex (dataSize);
+  if (index != 0 && g_freeTagBlocks[index] != 0)
+    {
+      FreeTagBlock *block = g_freeTagBlocks[index];
+      g_freeTagBlocks[index] = block->next;
+      --g_nFreeTagBlocks[index];
+      p = block;
+    }
+  else if (index != 0)
+    {
+      p = std::malloc (sizeof (TagData) + index * TAG_BLOCK_ALIGN - 1);
+    }
+  else
+    {
+      p = std::malloc (sizeof (TagData) + dataSize - 1);
+    }
+  // The matching releases are in FreeTagData
 
   TagData * tag = new (p) TagData;
   tag->size = dataSize;
   return tag;
 }
 
+void
+PacketTagList::FreeTagData (TagData *tag)
+{
+  std::size_t index = GetTagPoolIndex (tag->size);
+  tag->~TagData ();
+  if (index != 0 && !g_tagPoolReleased && g_nFreeTagBlocks[index] < MAX_FREE_TAG_BLOCKS)
+    {
+      // make sure that the pool is released when the thread exits
+      static_cast<void> (&g_tagPoolReleaser);
+      FreeTagBlock *block = reinterpret_cast<FreeTagBlock *> (tag);
+      block->next = g_freeTagBlocks[index];
+      g_freeTagBlocks[index] = block;
+      ++g_nFreeTagBlocks[index];
+      return;
+    }
+  std::free (tag);
+}
+
 bool
 PacketTagList::COWTraverse (Tag & tag, PacketTagList::COWWriter Writer)
 {
@@ -194,8 +292,7 @@ PacketTagList::RemoveWriter (Tag & tag, bool preMerge,
   if (preMerge)
     {
       // found tid before first merge, so delete cur
-      cur->~TagData ();
-      std::free (cur);
+      FreeTagData (cur);
     }
   else
     {
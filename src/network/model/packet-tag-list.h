@@ -228,6 +228,16 @@ private:
    */
   static
   TagData * CreateTagData (size_t dataSize);
+  /**
+   * Destroy and release a TagData struct created by CreateTagData.
+   *
+   * The storage of the small TagData structs is kept in a per-thread
+   * free list, by size, and reused by CreateTagData.
+   *
+   * \param [in] tag The TagData object.
+   */
+  static
+  void FreeTagData (TagData *tag);
   
   /**
    * Typedef of method function pointer for copy-on-write operations
@@ -341,15 +351,13 @@ PacketTagList::RemoveAll (void)
         }
       if (prev != 0) 
         {
-          prev->~TagData ();
-          std::free (prev);
+          FreeTagData (prev);
         }
       prev = cur;
     }
   if (prev != 0) 
     {
-      prev->~TagData ();
-      std::free (prev);
+      FreeTagData (prev);
     }
   m_next = 0;
 }
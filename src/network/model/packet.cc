@@ -21,8 +21,13 @@
 #include "ns3/assert.h"
 #include "ns3/log.h"
 #include "ns3/simulator.h"
+#include "ns3/core-config.h"
+#ifdef HAVE_PTHREAD_H
+#include "ns3/multithreaded-simulator-impl.h"
+#endif /* HAVE_PTHREAD_H */
 #include <string>
 #include <cstdarg>
+#include <new>
 
 namespace ns3 {
 
@@ -30,6 +35,75 @@ NS_LOG_COMPONENT_DEFINE ("Packet");
 
 uint32_t Packet::m_globalUid = 0;
 
+namespace {
+
+/// A free block of packet storage
+struct FreePacket
+{
+  FreePacket *next; //!< the next free block
+};
+
+/// Maximum number of free blocks kept by each thread
+const uint32_t MAX_FREE_PACKETS = 16384;
+
+// The free list is trivially destructible, so that it can still be
+// accessed by the packets destroyed after the PacketPoolReleaser of
+// the same thread.
+thread_local FreePacket *g_freePackets = 0;      //!< free blocks of the thread
+thread_local uint32_t g_nFreePackets = 0;        //!< number of free blocks of the thread
+thread_local bool g_packetPoolReleased = false;  //!< true after the thread pool has been released
+
+/**
+ * Return the free packet blocks of a thread to the heap when the thread exits
+ */
+struct PacketPoolReleaser
+{
+  ~PacketPoolReleaser ()
+  {
+    while (g_freePackets != 0)
+      {
+        FreePacket *block = g_freePackets;
+        g_freePackets = block->next;
+        ::operator delete (block);
+      }
+    g_nFreePackets = 0;
+    g_packetPoolReleased = true;
+  }
+};
+
+thread_local PacketPoolReleaser g_packetPoolReleaser; //!< releases the pool of the thread
+
+} // unnamed namespace
+
+void*
+Packet::operator new (std::size_t size)
+{
+  if (size == sizeof (Packet) && g_freePackets != 0)
+    {
+      FreePacket *block = g_freePackets;
+      g_freePackets = block->next;
+      --g_nFreePackets;
+      return block;
+    }
+  return ::operator new (size);
+}
+
+void
+Packet::operator delete (void *p)
+{
+  if (!g_packetPoolReleased && g_nFreePackets < MAX_FREE_PACKETS)
+    {
+      // make sure that the pool is released when the thread exits
+      static_cast<void> (&g_packetPoolReleaser);
+      FreePacket *block = static_cast<FreePacket *> (p);
+      block->next = g_freePackets;
+      g_freePackets = block;
+      ++g_nFreePackets;
+      return;
+    }
+  ::operator delete (p);
+}
+
 TypeId 
 ByteTagIterator::Item::GetTypeId (void) const
 {
@@ -117,6 +191,22 @@ PacketTagIterator::Item::GetTag (Tag &tag) const
 }
 
 
+uint64_t
+Packet::AllocateUid (void)
+{
+#ifdef HAVE_PTHREAD_H
+  uint32_t partition;
+  uint64_t sequence;
+  if (MultithreadedSimulatorImpl::GetPartitionSequence (partition, sequence))
+    {
+      return static_cast<uint64_t> (partition) << 48
+             | static_cast<uint64_t> (Simulator::GetSystemId ()) << 32
+             | static_cast<uint32_t> (sequence);
+    }
+#endif /* HAVE_PTHREAD_H */
+  return static_cast<uint64_t> (Simulator::GetSystemId ()) << 32 | m_globalUid++;
+}
+
 Ptr<Packet> 
 Packet::Copy (void) const
 {
@@ -134,12 +224,11 @@ Packet::Packet ()
      * metadata is for the system id. For non-
      * distributed simulations, this is simply 
      * zero.  The lower 32 bits are for the 
-     * global UID
+     * global UID (see AllocateUid)
      */
-    m_metadata (static_cast<uint64_t> (Simulator::GetSystemId ()) << 32 | m_globalUid, 0),
+    m_metadata (AllocateUid (), 0),
     m_nixVector (0)
 {
-  m_globalUid++;
 }
 
 Packet::Packet (const Packet &o)
@@ -176,12 +265,11 @@ Packet::Packet (uint32_t size)
      * metadata is for the system id. For non-
      * distributed simulations, this is simply 
      * zero.  The lower 32 bits are for the 
-     * global UID
+     * global UID (see AllocateUid)
      */
-    m_metadata (static_cast<uint64_t> (Simulator::GetSystemId ()) << 32 | m_globalUid, size),
+    m_metadata (AllocateUid (), size),
     m_nixVector (0)
 {
-  m_globalUid++;
 }
 Packet::Packet (uint8_t const *buffer, uint32_t size, bool magic)
   : m_buffer (0, false),
@@ -202,12 +290,11 @@ Packet::Packet (uint8_t const*buffer, uint32_t size)
      * metadata is for the system id. For non-
      * distributed simulations, this is simply 
      * zero.  The lower 32 bits are for the 
-     * global UID
+     * global UID (see AllocateUid)
      */
-    m_metadata (static_cast<uint64_t> (Simulator::GetSystemId ()) << 32 | m_globalUid, size),
+    m_metadata (AllocateUid (), size),
     m_nixVector (0)
 {
-  m_globalUid++;
   m_buffer.AddAtStart (size);
   Buffer::Iterator i = m_buffer.Begin ();
   i.Write (buffer, size);
@@ -758,8 +758,27 @@ public:
    */
   typedef void (* SinrTracedCallback)
     (Ptr<const Packet> packet, double sinr);
-    
-  
+
+  /**
+   * \brief Allocate the storage of a packet.
+   *
+   * The storage of the destroyed packets is kept in a per-thread free
+   * list and reused by the next packets created by the same thread, so
+   * that creating, copying and fragmenting packets does not go through
+   * the heap allocator in a steady state.
+   *
+   * \param size the size of the packet object
+   * \returns the storage of the packet
+   */
+  static void* operator new (std::size_t size);
+  /**
+   * \brief Release the storage of a packet to the free list of the
+   * calling thread.
+   *
+   * \param p the storage of the packet
+   */
+  static void operator delete (void *p);
+
 private:
   /**
    * \brief Constructor
@@ -787,6 +806,17 @@ private:
   /* Please see comments above about nix-vector */
   Ptr<NixVector> m_nixVector; //!< the packet's Nix vector
 
+  /**
+   * Allocate the uid of a new packet: the upper 32 bits are the system id
+   * and the lower 32 bits the global counter, or, for the packets created
+   * by the threads of MultithreadedSimulatorImpl, the upper 16 bits are
+   * the partition and the lower 32 bits its own counter, so that the
+   * uids do not depend on the timing of the threads.
+   *
+   * \returns the uid
+   */
+  static uint64_t AllocateUid (void);
+
   static uint32_t m_globalUid; //!< Global counter of packets Uid
 };
 
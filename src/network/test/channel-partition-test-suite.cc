@@ -0,0 +1,164 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "ns3/test.h"
+#include "ns3/simulator.h"
+#include "ns3/simulator-impl.h"
+#include "ns3/object-factory.h"
+#include "ns3/nstime.h"
+#include "ns3/uinteger.h"
+#include "ns3/node.h"
+#include "ns3/packet.h"
+#include "ns3/mac48-address.h"
+#include "ns3/simple-channel.h"
+#include "ns3/simple-net-device.h"
+
+#include <set>
+#include <thread>
+#include <vector>
+
+using namespace ns3;
+
+/**
+ * \ingroup network-test
+ * \ingroup tests
+ *
+ * Check that MultithreadedSimulatorImpl processes the events of the
+ * nodes connected by a channel without minimum delay on the same thread:
+ * two pairs of nodes exchange packets over their own SimpleChannel, and
+ * each pair must run on its own thread.
+ */
+class ChannelPartitionTestCase : public TestCase
+{
+public:
+  ChannelPartitionTestCase ();
+
+private:
+  virtual void DoRun (void);
+
+  /**
+   * Receive a packet.
+   * \param device the receiving device
+   * \param packet the packet
+   * \param protocol the protocol number
+   * \param from the sender address
+   * \return true
+   */
+  bool Receive (Ptr<NetDevice> device, Ptr<const Packet> packet, uint16_t protocol, const Address &from);
+
+  /**
+   * Send a packet.
+   * \param device the sending device
+   * \param dest the destination address
+   */
+  static void Send (Ptr<NetDevice> device, Address dest);
+
+  std::vector<std::set<std::thread::id> > m_threads; //!< the threads of the receptions of each node
+  std::vector<std::vector<uint64_t> > m_uids;        //!< the uids of the packets received by each node
+};
+
+ChannelPartitionTestCase::ChannelPartitionTestCase ()
+  : TestCase ("Check that the nodes connected by a channel without delay share a partition")
+{
+}
+
+bool
+ChannelPartitionTestCase::Receive (Ptr<NetDevice> device, Ptr<const Packet> packet, uint16_t protocol, const Address &from)
+{
+  uint32_t node = device->GetNode ()->GetId ();
+  m_threads[node].insert (std::this_thread::get_id ());
+  m_uids[node].push_back (packet->GetUid ());
+  return true;
+}
+
+void
+ChannelPartitionTestCase::Send (Ptr<NetDevice> device, Address dest)
+{
+  device->Send (Create<Packet> (100), dest, 0x0800);
+}
+
+void
+ChannelPartitionTestCase::DoRun (void)
+{
+  ObjectFactory factory;
+  factory.SetTypeId ("ns3::MultithreadedSimulatorImpl");
+  factory.Set ("MaxThreads", UintegerValue (2));
+  Simulator::SetImplementation (factory.Create<SimulatorImpl> ());
+
+  const uint32_t nNodes = 4;
+  const uint32_t nPackets = 20;
+  m_threads.assign (nNodes, std::set<std::thread::id> ());
+  m_uids.assign (nNodes, std::vector<uint64_t> ());
+
+  // nodes 0 and 1 on one channel, 2 and 3 on another, so that the
+  // partitions differ from the node ids modulo the number of threads
+  std::vector<Ptr<SimpleNetDevice> > devices;
+  Ptr<SimpleChannel> channels[2] = { CreateObject<SimpleChannel> (), CreateObject<SimpleChannel> () };
+  for (uint32_t i = 0; i < nNodes; ++i)
+    {
+      Ptr<Node> node = CreateObject<Node> ();
+      Ptr<SimpleNetDevice> device = CreateObject<SimpleNetDevice> ();
+      device->SetAddress (Mac48Address::Allocate ());
+      device->SetChannel (channels[i / 2]);
+      node->AddDevice (device);
+      // after Node::AddDevice, which sets its own receive callback
+      device->SetReceiveCallback (MakeCallback (&ChannelPartitionTestCase::Receive, this));
+      devices.push_back (device);
+    }
+  for (uint32_t i = 0; i < nNodes; ++i)
+    {
+      Address dest = devices[i ^ 1]->GetAddress ();
+      for (uint32_t k = 0; k < nPackets; ++k)
+        {
+          Simulator::ScheduleWithContext (i, MicroSeconds (10 * k), &ChannelPartitionTestCase::Send, devices[i], dest);
+        }
+    }
+  Simulator::Stop (MilliSeconds (1));
+  Simulator::Run ();
+  Simulator::Destroy ();
+
+  std::set<uint64_t> uids;
+  for (uint32_t i = 0; i < nNodes; ++i)
+    {
+      NS_TEST_ASSERT_MSG_EQ (m_uids[i].size (), nPackets, "unexpected number of packets received by node " << i);
+      NS_TEST_ASSERT_MSG_EQ (m_threads[i].size (), 1, "the packets of node " << i << " received on several threads");
+      uids.insert (m_uids[i].begin (), m_uids[i].end ());
+    }
+  NS_TEST_EXPECT_MSG_EQ (uids.size (), nNodes * nPackets, "duplicate packet uids");
+  NS_TEST_EXPECT_MSG_EQ ((m_threads[0] == m_threads[1]), true, "nodes 0 and 1 of a channel run on different threads");
+  NS_TEST_EXPECT_MSG_EQ ((m_threads[2] == m_threads[3]), true, "nodes 2 and 3 of a channel run on different threads");
+  NS_TEST_EXPECT_MSG_EQ ((m_threads[0] != m_threads[2]), true, "the two channels run on the same thread");
+}
+
+/**
+ * \ingroup network-test
+ * \ingroup tests
+ *
+ * The channel partition test suite.
+ */
+class ChannelPartitionTestSuite : public TestSuite
+{
+public:
+  ChannelPartitionTestSuite ();
+};
+
+ChannelPartitionTestSuite::ChannelPartitionTestSuite ()
+  : TestSuite ("channel-partition", UNIT)
+{
+  AddTestCase (new ChannelPartitionTestCase, TestCase::QUICK);
+}
+
+static ChannelPartitionTestSuite g_channelPartitionTestSuite; //!< Static variable for test initialization
@@ -1035,6 +1035,67 @@ PacketTagListTest::DoRun (void)
     
 }
 
+/**
+ * \ingroup network-test
+ * \ingroup tests
+ *
+ * Check that the storage of the destroyed packets and packet tags is
+ * reused without affecting the packets still alive.
+ */
+class PacketPoolTest : public TestCase
+{
+public:
+  PacketPoolTest ();
+private:
+  void DoRun (void);
+};
+
+PacketPoolTest::PacketPoolTest ()
+  : TestCase ("Check the reuse of the packet and packet tag storage")
+{
+}
+
+void
+PacketPoolTest::DoRun (void)
+{
+  Ptr<Packet> packet = Create<Packet> (100);
+  const Packet *storage = PeekPointer (packet);
+  packet = 0;
+  packet = Create<Packet> (20);
+  NS_TEST_EXPECT_MSG_EQ (PeekPointer (packet), storage, "storage of a destroyed packet not reused");
+  NS_TEST_EXPECT_MSG_EQ (packet->GetSize (), 20, "unexpected size of a packet in reused storage");
+
+  // tags of pooled and non pooled sizes, shared by a copy
+  packet->AddPacketTag (ATestTag<3> (1));
+  packet->AddPacketTag (ATestTag<20> (2));
+  packet->AddPacketTag (ATestTag<200> (3));
+  Ptr<Packet> copy = packet->Copy ();
+  ATestTag<20> tag20;
+  NS_TEST_EXPECT_MSG_EQ (copy->RemovePacketTag (tag20), true, "tag not found in the copy");
+  NS_TEST_EXPECT_MSG_EQ (tag20.GetData (), 2, "unexpected tag data in the copy");
+  copy->AddPacketTag (ATestTag<21> (4));
+  copy = 0;
+
+  // the storage released by the copy is reused by new tags
+  Ptr<Packet> other = Create<Packet> (10);
+  other->AddPacketTag (ATestTag<20> (5));
+  other->AddPacketTag (ATestTag<21> (6));
+
+  ATestTag<3> tag3;
+  ATestTag<200> tag200;
+  NS_TEST_EXPECT_MSG_EQ (packet->PeekPacketTag (tag3), true, "tag removed from the original packet");
+  NS_TEST_EXPECT_MSG_EQ (tag3.GetData (), 1, "unexpected tag data in the original packet");
+  NS_TEST_EXPECT_MSG_EQ (tag3.m_error, false, "corrupted tag in the original packet");
+  NS_TEST_EXPECT_MSG_EQ (packet->PeekPacketTag (tag20), true, "tag removed from the original packet");
+  NS_TEST_EXPECT_MSG_EQ (tag20.GetData (), 2, "unexpected tag data in the original packet");
+  NS_TEST_EXPECT_MSG_EQ (tag20.m_error, false, "corrupted tag in the original packet");
+  NS_TEST_EXPECT_MSG_EQ (packet->PeekPacketTag (tag200), true, "tag removed from the original packet");
+  NS_TEST_EXPECT_MSG_EQ (tag200.GetData (), 3, "unexpected tag data in the original packet");
+  NS_TEST_EXPECT_MSG_EQ (tag200.m_error, false, "corrupted tag in the original packet");
+  NS_TEST_EXPECT_MSG_EQ (other->PeekPacketTag (tag20), true, "tag not found in the new packet");
+  NS_TEST_EXPECT_MSG_EQ (tag20.GetData (), 5, "unexpected tag data in the new packet");
+}
+
 /**
  * \ingroup network-test
  * \ingroup tests
@@ -1052,6 +1113,7 @@ PacketTestSuite::PacketTestSuite ()
 {
   AddTestCase (new PacketTest, TestCase::QUICK);
   AddTestCase (new PacketTagListTest, TestCase::QUICK);
+  AddTestCase (new PacketPoolTest, TestCase::QUICK);
 }
 
 static PacketTestSuite g_packetTestSuite; //!< Static variable for test initialization
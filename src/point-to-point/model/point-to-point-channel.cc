@@ -21,14 +21,77 @@
 #include "ns3/trace-source-accessor.h"
 #include "ns3/packet.h"
 #include "ns3/simulator.h"
+#include "ns3/core-config.h"
+#ifdef HAVE_PTHREAD_H
+#include "ns3/multithreaded-simulator-impl.h"
+#endif /* HAVE_PTHREAD_H */
+#include "ns3/tag.h"
 #include "ns3/log.h"
 
+#include <vector>
+
 namespace ns3 {
 
 NS_LOG_COMPONENT_DEFINE ("PointToPointChannel");
 
 NS_OBJECT_ENSURE_REGISTERED (PointToPointChannel);
 
+#ifdef HAVE_PTHREAD_H
+
+/**
+ * \ingroup point-to-point
+ * Create a tag of the given type.
+ *
+ * \param tid the type of the tag
+ * \return a new instance of the tag, to be deleted by the caller
+ */
+static Tag *
+CreateTag (TypeId tid)
+{
+  Tag *tag = dynamic_cast<Tag *> (tid.GetConstructor () ());
+  NS_ABORT_MSG_IF (tag == 0, "Cannot create tag " << tid.GetName ());
+  return tag;
+}
+
+/**
+ * \ingroup point-to-point
+ * Copy a packet without sharing its buffer, metadata and tags, whose
+ * reference counts are not atomic, so that it can be handed over to the
+ * thread of another partition of MultithreadedSimulatorImpl.
+ *
+ * \param p the packet
+ * \return the copy
+ */
+static Ptr<Packet>
+CopyUnshared (Ptr<const Packet> p)
+{
+  std::vector<uint8_t> data (p->GetSerializedSize ());
+  p->Serialize (data.data (), data.size ());
+  Ptr<Packet> copy = Create<Packet> (data.data (), data.size (), true);
+
+  PacketTagIterator packetTags = p->GetPacketTagIterator ();
+  while (packetTags.HasNext ())
+    {
+      PacketTagIterator::Item item = packetTags.Next ();
+      Tag *tag = CreateTag (item.GetTypeId ());
+      item.GetTag (*tag);
+      copy->AddPacketTag (*tag);
+      delete tag;
+    }
+  ByteTagIterator byteTags = p->GetByteTagIterator ();
+  while (byteTags.HasNext ())
+    {
+      ByteTagIterator::Item item = byteTags.Next ();
+      Tag *tag = CreateTag (item.GetTypeId ());
+      item.GetTag (*tag);
+      copy->AddByteTag (*tag, item.GetStart (), item.GetEnd ());
+      delete tag;
+    }
+  return copy;
+}
+
+#endif /* HAVE_PTHREAD_H */
+
 TypeId 
 PointToPointChannel::GetTypeId (void)
 {
@@ -80,6 +143,15 @@ PointToPointChannel::Attach (Ptr<PointToPointNetDevice> device)
       m_link[1].m_dst = m_link[0].m_src;
       m_link[0].m_state = IDLE;
       m_link[1].m_state = IDLE;
+      // the node of the destination is only looked up once, since its
+      // reference count must not be shared with another thread
+      for (uint32_t i = 0; i < N_DEVICES; ++i)
+        {
+          if (m_link[i].m_dst->GetNode () != 0)
+            {
+              m_link[i].m_dstNode = m_link[i].m_dst->GetNode ()->GetId ();
+            }
+        }
     }
 }
 
@@ -96,8 +168,25 @@ PointToPointChannel::TransmitStart (
   NS_ASSERT (m_link[1].m_state != INITIALIZING);
 
   uint32_t wire = src == m_link[0].m_src ? 0 : 1;
+  uint32_t context = m_link[wire].m_dstNode;
+  if (context == Simulator::NO_CONTEXT)
+    {
+      context = m_link[wire].m_dst->GetNode ()->GetId ();
+    }
+
+#ifdef HAVE_PTHREAD_H
+  if (MultithreadedSimulatorImpl::IsRemoteContext (context))
+    {
+      // the event holds the destination device by pointer, and the packet
+      // is not shared with this thread
+      Simulator::ScheduleWithContext (context, txTime + m_delay,
+                                      &PointToPointNetDevice::Receive,
+                                      PeekPointer (m_link[wire].m_dst), CopyUnshared (p));
+      return true;
+    }
+#endif /* HAVE_PTHREAD_H */
 
-  Simulator::ScheduleWithContext (m_link[wire].m_dst->GetNode ()->GetId (),
+  Simulator::ScheduleWithContext (context,
                                   txTime + m_delay, &PointToPointNetDevice::Receive,
                                   m_link[wire].m_dst, p->Copy ());
 
@@ -44,6 +44,11 @@ class Packet;
  * [0] wire to transmit on.  The second device gets the [1] wire.  There is a
  * state (IDLE, TRANSMITTING) associated with each wire.
  *
+ * With MultithreadedSimulatorImpl, the two devices may belong to nodes
+ * processed by different threads: the packet is then delivered as an
+ * unshared copy, and the TxRxPointToPoint trace is not fired, as by
+ * PointToPointRemoteChannel.
+ *
  * \see Attach
  * \see TransmitStart
  */
@@ -194,11 +199,12 @@ public:
     /** \brief Create the link, it will be in INITIALIZING state
      *
      */
-    Link() : m_state (INITIALIZING), m_src (0), m_dst (0) {}
+    Link() : m_state (INITIALIZING), m_src (0), m_dst (0), m_dstNode (0xffffffff) {}
 
     WireState                  m_state; //!< State of the link
     Ptr<PointToPointNetDevice> m_src;   //!< First NetDevice
     Ptr<PointToPointNetDevice> m_dst;   //!< Second NetDevice
+    uint32_t                   m_dstNode; //!< Node id of the second NetDevice, if known on Attach
   };
 
   Link    m_link[N_DEVICES]; //!< Link model
@@ -18,12 +18,22 @@
  * Author: Mathieu Lacage <mathieu.lacage@sophia.inria.fr>
  */
 
+#include "ns3/core-config.h"
 #include "ns3/test.h"
 #include "ns3/drop-tail-queue.h"
 #include "ns3/simulator.h"
 #include "ns3/point-to-point-net-device.h"
 #include "ns3/point-to-point-channel.h"
 #include "ns3/net-device-queue-interface.h"
+#include "ns3/simulator-impl.h"
+#include "ns3/object-factory.h"
+#include "ns3/uinteger.h"
+#include "ns3/data-rate.h"
+#include "ns3/tag.h"
+
+#include <set>
+#include <thread>
+#include <vector>
 
 using namespace ns3;
 
@@ -94,6 +104,268 @@ PointToPointTest::DoRun (void)
   Simulator::Destroy ();
 }
 
+#ifdef HAVE_PTHREAD_H
+
+/**
+ * \brief Byte tag carried by the packets of PointToPointMultithreadedTest
+ */
+class PointToPointTestTag : public Tag
+{
+public:
+  /**
+   * \brief Get the TypeId
+   *
+   * \return The TypeId for this class
+   */
+  static TypeId GetTypeId (void)
+  {
+    static TypeId tid = TypeId ("ns3::PointToPointTestTag")
+      .SetParent<Tag> ()
+      .SetGroupName ("PointToPoint")
+      .HideFromDocumentation ()
+      .AddConstructor<PointToPointTestTag> ()
+    ;
+    return tid;
+  }
+  /**
+   * \brief Create the tag
+   *
+   * \param value the value of the tag
+   */
+  PointToPointTestTag (uint32_t value = 0)
+    : m_value (value)
+  {
+  }
+  virtual TypeId GetInstanceTypeId (void) const
+  {
+    return GetTypeId ();
+  }
+  virtual uint32_t GetSerializedSize (void) const
+  {
+    return 4;
+  }
+  virtual void Serialize (TagBuffer buf) const
+  {
+    buf.WriteU32 (m_value);
+  }
+  virtual void Deserialize (TagBuffer buf)
+  {
+    m_value = buf.ReadU32 ();
+  }
+  virtual void Print (std::ostream &os) const
+  {
+    os << "value=" << m_value;
+  }
+  uint32_t m_value; //!< the value of the tag
+};
+
+/**
+ * \brief Test the PointToPoint model with MultithreadedSimulatorImpl
+ *
+ * Two pairs of nodes exchange packets over their PointToPointChannel:
+ * the nodes of each pair are assigned to different threads, the channel
+ * delay bounding the windows despite a larger Lookahead attribute, and
+ * the packet uids received by each node must not depend on the timing of
+ * the threads. The packets carry byte tags, which are allocated and
+ * released concurrently by the threads, and must be received with their
+ * values and byte ranges.
+ */
+class PointToPointMultithreadedTest : public TestCase
+{
+public:
+  /**
+   * \brief Create the test
+   */
+  PointToPointMultithreadedTest ();
+
+  /**
+   * \brief Run the test
+   */
+  virtual void DoRun (void);
+
+private:
+  /**
+   * \brief Run the simulation once
+   *
+   * \param [out] threads the threads of the receptions of each node
+   * \param [out] uids the uids of the packets received by each node
+   * \param [out] tags the byte tag values received by each node
+   */
+  void RunOnce (std::vector<std::set<std::thread::id> > &threads, std::vector<std::vector<uint64_t> > &uids,
+                std::vector<std::vector<uint32_t> > &tags);
+
+  /**
+   * \brief Receive a packet
+   *
+   * \param device the receiving device
+   * \param packet the packet
+   * \param protocol the protocol number
+   * \param from the sender address
+   * \return true
+   */
+  bool Receive (Ptr<NetDevice> device, Ptr<const Packet> packet, uint16_t protocol, const Address &from);
+
+  /**
+   * \brief Send one packet to the other device of the channel
+   *
+   * \param device the sending device
+   * \param value the value of the byte tags of the packet
+   */
+  static void SendOnePacket (Ptr<PointToPointNetDevice> device, uint32_t value);
+
+  /// The number of packets sent by each node
+  static const uint32_t N_PACKETS = 10000;
+
+  std::vector<std::set<std::thread::id> > *m_threads; //!< the threads of the receptions of each node
+  std::vector<std::vector<uint64_t> > *m_uids;        //!< the uids of the packets received by each node
+  std::vector<std::vector<uint32_t> > *m_tags;        //!< the byte tag values received by each node
+};
+
+const uint32_t PointToPointMultithreadedTest::N_PACKETS;
+
+PointToPointMultithreadedTest::PointToPointMultithreadedTest ()
+  : TestCase ("PointToPoint with MultithreadedSimulatorImpl"),
+    m_threads (0),
+    m_uids (0),
+    m_tags (0)
+{
+}
+
+bool
+PointToPointMultithreadedTest::Receive (Ptr<NetDevice> device, Ptr<const Packet> packet, uint16_t protocol, const Address &from)
+{
+  uint32_t node = device->GetNode ()->GetId ();
+  (*m_threads)[node].insert (std::this_thread::get_id ());
+  (*m_uids)[node].push_back (packet->GetUid ());
+
+  // a tag over the whole packet, then one over bytes [10, 50)
+  ByteTagIterator i = packet->GetByteTagIterator ();
+  uint32_t expectedStart[2] = { 0, 10 };
+  uint32_t expectedEnd[2] = { 100, 50 };
+  for (uint32_t k = 0; k < 2; ++k)
+    {
+      PointToPointTestTag tag;
+      if (!i.HasNext ())
+        {
+          (*m_tags)[node].push_back (0xffffffff);
+          return true;
+        }
+      ByteTagIterator::Item item = i.Next ();
+      item.GetTag (tag);
+      if (item.GetStart () != expectedStart[k] || item.GetEnd () != expectedEnd[k])
+        {
+          tag.m_value = 0xffffffff;
+        }
+      (*m_tags)[node].push_back (tag.m_value);
+    }
+  return true;
+}
+
+void
+PointToPointMultithreadedTest::SendOnePacket (Ptr<PointToPointNetDevice> device, uint32_t value)
+{
+  Ptr<Packet> p = Create<Packet> (100);
+  p->AddByteTag (PointToPointTestTag (value));
+  p->AddByteTag (PointToPointTestTag (value + 1), 10, 50);
+  device->Send (p, device->GetBroadcast (), 0x800);
+}
+
+void
+PointToPointMultithreadedTest::RunOnce (std::vector<std::set<std::thread::id> > &threads, std::vector<std::vector<uint64_t> > &uids,
+                                        std::vector<std::vector<uint32_t> > &tags)
+{
+  ObjectFactory factory;
+  factory.SetTypeId ("ns3::MultithreadedSimulatorImpl");
+  factory.Set ("MaxThreads", UintegerValue (2));
+  factory.Set ("Lookahead", TimeValue (Seconds (1)));
+  Simulator::SetImplementation (factory.Create<SimulatorImpl> ());
+
+  const uint32_t nNodes = 4;
+  threads.assign (nNodes, std::set<std::thread::id> ());
+  uids.assign (nNodes, std::vector<uint64_t> ());
+  tags.assign (nNodes, std::vector<uint32_t> ());
+  m_threads = &threads;
+  m_uids = &uids;
+  m_tags = &tags;
+
+  // nodes 0 and 1 on one channel, 2 and 3 on another, so that the nodes
+  // of each channel are in different partitions
+  std::vector<Ptr<PointToPointNetDevice> > devices;
+  for (uint32_t i = 0; i < nNodes; ++i)
+    {
+      Ptr<Node> node = CreateObject<Node> ();
+      Ptr<PointToPointNetDevice> device = CreateObject<PointToPointNetDevice> ();
+      device->SetAddress (Mac48Address::Allocate ());
+      device->SetQueue (CreateObject<DropTailQueue<Packet> > ());
+      device->SetDataRate (DataRate ("100Mbps"));
+      node->AddDevice (device);
+      // after Node::AddDevice, which sets its own receive callback
+      device->SetReceiveCallback (MakeCallback (&PointToPointMultithreadedTest::Receive, this));
+      devices.push_back (device);
+    }
+  for (uint32_t i = 0; i < nNodes; i += 2)
+    {
+      Ptr<PointToPointChannel> channel = CreateObject<PointToPointChannel> ();
+      channel->SetAttribute ("Delay", TimeValue (MilliSeconds (2)));
+      devices[i]->Attach (channel);
+      devices[i + 1]->Attach (channel);
+    }
+  for (uint32_t i = 0; i < nNodes; ++i)
+    {
+      for (uint32_t k = 0; k < N_PACKETS; ++k)
+        {
+          Simulator::ScheduleWithContext (i, MicroSeconds (100 * k + i),
+                                          &PointToPointMultithreadedTest::SendOnePacket, devices[i],
+                                          2 * (i * N_PACKETS + k));
+        }
+    }
+  Simulator::Stop (Seconds (2));
+  Simulator::Run ();
+  Simulator::Destroy ();
+  m_threads = 0;
+  m_uids = 0;
+  m_tags = 0;
+}
+
+void
+PointToPointMultithreadedTest::DoRun (void)
+{
+  std::vector<std::set<std::thread::id> > threads;
+  std::vector<std::vector<uint64_t> > uids;
+  std::vector<std::vector<uint32_t> > tags;
+  RunOnce (threads, uids, tags);
+
+  std::set<uint64_t> allUids;
+  for (uint32_t i = 0; i < uids.size (); ++i)
+    {
+      NS_TEST_ASSERT_MSG_EQ (uids[i].size (), N_PACKETS, "unexpected number of packets received by node " << i);
+      NS_TEST_ASSERT_MSG_EQ (threads[i].size (), 1, "the packets of node " << i << " received on several threads");
+      allUids.insert (uids[i].begin (), uids[i].end ());
+      // the packets of the other node of the channel, in order
+      std::vector<uint32_t> expected;
+      for (uint32_t k = 0; k < N_PACKETS; ++k)
+        {
+          expected.push_back (2 * ((i ^ 1) * N_PACKETS + k));
+          expected.push_back (2 * ((i ^ 1) * N_PACKETS + k) + 1);
+        }
+      NS_TEST_EXPECT_MSG_EQ ((tags[i] == expected), true, "unexpected byte tags received by node " << i);
+    }
+  NS_TEST_EXPECT_MSG_EQ (allUids.size (), 4 * N_PACKETS, "duplicate packet uids");
+  NS_TEST_EXPECT_MSG_EQ ((threads[0] != threads[1]), true, "nodes 0 and 1 of a channel run on the same thread");
+  NS_TEST_EXPECT_MSG_EQ ((threads[2] != threads[3]), true, "nodes 2 and 3 of a channel run on the same thread");
+
+  std::vector<std::set<std::thread::id> > otherThreads;
+  std::vector<std::vector<uint64_t> > otherUids;
+  std::vector<std::vector<uint32_t> > otherTags;
+  RunOnce (otherThreads, otherUids, otherTags);
+  for (uint32_t i = 0; i < uids.size (); ++i)
+    {
+      NS_TEST_EXPECT_MSG_EQ ((otherUids[i] == uids[i]), true, "the packet uids of node " << i << " differ between runs");
+    }
+}
+
+#endif /* HAVE_PTHREAD_H */
+
 /**
  * \brief TestSuite for PointToPoint module
  */
@@ -110,6 +382,9 @@ PointToPointTestSuite::PointToPointTestSuite ()
   : TestSuite ("devices-point-to-point", UNIT)
 {
   AddTestCase (new PointToPointTest, TestCase::QUICK);
+#ifdef HAVE_PTHREAD_H
+  AddTestCase (new PointToPointMultithreadedTest, TestCase::QUICK);
+#endif /* HAVE_PTHREAD_H */
 }
 
 static PointToPointTestSuite g_pointToPointTestSuite; //!< The testsuite
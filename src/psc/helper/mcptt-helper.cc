@@ -33,6 +33,7 @@
 #include <string>
 
 #include <ns3/address.h>
+#include <ns3/boolean.h>
 #include <ns3/callback.h>
 #include <ns3/config.h>
 #include <ns3/data-rate.h>
@@ -176,22 +177,24 @@ McpttHelper::Install (const NodeContainer& c)
 }
 
 void
-McpttHelper::EnableMsgTraces (void)
+McpttHelper::EnableMsgTraces (bool binary)
 {
   if (m_msgTracer == 0)
     {
       m_msgTracer = CreateObject<McpttMsgStats> ();
+      m_msgTracer->SetAttribute ("BinaryOutput", BooleanValue (binary));
       Config::ConnectWithoutContext ("/NodeList/*/ApplicationList/*/$ns3::McpttPttApp/RxTrace", MakeCallback (&McpttMsgStats::ReceiveRxTrace, m_msgTracer));
       Config::ConnectWithoutContext ("/NodeList/*/ApplicationList/*/$ns3::McpttPttApp/TxTrace", MakeCallback (&McpttMsgStats::ReceiveTxTrace, m_msgTracer));
     }
 }
 
 void
-McpttHelper::EnableStateMachineTraces (void)
+McpttHelper::EnableStateMachineTraces (bool binary)
 {
   if (m_stateMachineTracer == 0)
     {
       m_stateMachineTracer = CreateObject<McpttStateMachineStats> ();
+      m_stateMachineTracer->SetAttribute ("BinaryOutput", BooleanValue (binary));
       Config::ConnectWithoutContext ("/NodeList/*/ApplicationList/*/$ns3::McpttPttApp/Calls/*/CallMachine/StateChangeTrace", MakeCallback (&McpttStateMachineStats::StateChangeCb, m_stateMachineTracer));
       Config::ConnectWithoutContext ("/NodeList/*/ApplicationList/*/$ns3::McpttPttApp/Calls/*/CallMachine/CallTypeMachine/StateChangeTrace", MakeCallback (&McpttStateMachineStats::StateChangeCb, m_stateMachineTracer));
       Config::ConnectWithoutContext ("/NodeList/*/ApplicationList/*/$ns3::McpttPttApp/Calls/*/CallMachine/EmergAlertMachine/StateChangeTrace", MakeCallback (&McpttStateMachineStats::StateChangeCb, m_stateMachineTracer));
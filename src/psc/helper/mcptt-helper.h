@@ -104,12 +104,16 @@ public:
  virtual ApplicationContainer Install (const std::string& nodeName);
  /**
   * Enables the MCPTT message trace at the application layer.
+  * \param binary Whether the trace is written in the binary format of
+  *        McpttTraceWriter, to convert to text offline, instead of text.
   */
- virtual void EnableMsgTraces (void);
+ virtual void EnableMsgTraces (bool binary = false);
  /**
   * Enables the MCPTT state machine traces.
+  * \param binary Whether the trace is written in the binary format of
+  *        McpttTraceWriter, to convert to text offline, instead of text.
   */
- virtual void EnableStateMachineTraces (void);
+ virtual void EnableStateMachineTraces (bool binary = false);
  /**
   * Configures the MCPTT PTT app.
   * \param tid the string representation of the ns3::TypeId associated with the model to set
@@ -30,6 +30,7 @@
  */
 
 #include <fstream>
+#include <sstream>
 
 #include <ns3/boolean.h>
 #include <ns3/log.h>
@@ -55,6 +56,11 @@ McpttMsgStats::GetTypeId (void)
   static TypeId tid = TypeId ("ns3::McpttMsgStats")
     .SetParent<Object> ()
     .AddConstructor<McpttMsgStats> ()
+    .AddAttribute ("BinaryOutput",
+                   "Indicates if the trace should be written in the binary format of McpttTraceWriter instead of text.",
+                   BooleanValue (false),
+                   MakeBooleanAccessor (&McpttMsgStats::m_binaryOutput),
+                   MakeBooleanChecker ())
     .AddAttribute ("CallControl",
                    "Indicates if call control messages should be included.",
                    BooleanValue (true),
@@ -87,7 +93,10 @@ McpttMsgStats::GetTypeId (void)
 
 McpttMsgStats::McpttMsgStats (void)
   : Object (),
-    m_firstMsg (true)
+    m_firstMsg (true),
+    m_writer (0),
+    m_rxId (0),
+    m_txId (0)
 {
   NS_LOG_FUNCTION (this);
 }
@@ -105,6 +114,15 @@ McpttMsgStats::GetInstanceTypeId (void) const
   return McpttMsgStats::GetTypeId ();
 }
 
+void
+McpttMsgStats::DoDispose (void)
+{
+  NS_LOG_FUNCTION (this);
+
+  m_writer = 0;
+  Object::DoDispose ();
+}
+
 void
 McpttMsgStats::ReceiveRxTrace (const McpttPttApp& pttApp, const McpttMsg& msg)
 {
@@ -130,6 +148,11 @@ McpttMsgStats::Trace (const McpttPttApp& pttApp, const McpttMsg& msg, bool rx)
       || (msg.IsA (McpttFloorMsg::GetTypeId ()) && m_floorControl == true)
       || (msg.IsA (McpttMediaMsg::GetTypeId ()) && m_media == true))
     {
+      if (m_binaryOutput)
+        {
+          TraceBinary (pttApp, msg, rx);
+          return;
+        }
 
       std::ofstream outFile;
       if (m_firstMsg == true)
@@ -163,5 +186,51 @@ McpttMsgStats::Trace (const McpttPttApp& pttApp, const McpttMsg& msg, bool rx)
     }
 }
 
+void
+McpttMsgStats::TraceBinary (const McpttPttApp& pttApp, const McpttMsg& msg, bool rx)
+{
+  NS_LOG_FUNCTION (this << &pttApp << &msg << rx);
+
+  if (m_writer == 0)
+    {
+      std::vector<McpttTraceWriter::Column> columns;
+      columns.push_back ({"time(ms)", McpttTraceWriter::INTEGER});
+      columns.push_back ({"userid", McpttTraceWriter::INTEGER});
+      columns.push_back ({"rx/tx", McpttTraceWriter::STRING});
+      columns.push_back ({"bytes", McpttTraceWriter::INTEGER});
+      columns.push_back ({"message", m_includeMsgContent ? McpttTraceWriter::TEXT : McpttTraceWriter::STRING});
+      m_writer = Create<McpttTraceWriter> (m_outputFileName, columns);
+      m_rxId = m_writer->Intern ("RX");
+      m_txId = m_writer->Intern ("TX");
+    }
+
+  McpttTraceWriter::Record record;
+  record.values[0] = Simulator::Now ().GetMilliSeconds ();
+  record.values[1] = pttApp.GetUserId ();
+  record.values[2] = rx ? m_rxId : m_txId;
+  record.values[3] = msg.GetSerializedSize ();
+  if (m_includeMsgContent)
+    {
+      // the content of each message is different, so it is not interned
+      std::ostringstream content;
+      msg.Print (content);
+      record.text = content.str ();
+    }
+  else
+    {
+      TypeId tid = msg.GetInstanceTypeId ();
+      if (tid.GetUid () >= m_typeNameIds.size ())
+        {
+          m_typeNameIds.resize (tid.GetUid () + 1, -1);
+        }
+      if (m_typeNameIds[tid.GetUid ()] < 0)
+        {
+          m_typeNameIds[tid.GetUid ()] = m_writer->Intern (tid.GetName ());
+        }
+      record.values[4] = m_typeNameIds[tid.GetUid ()];
+    }
+  m_writer->Write (record);
+}
+
 } // namespace ns3
 
@@ -37,12 +37,18 @@
 #include <ns3/mcptt-ptt-app.h>
 #include <ns3/type-id.h>
 
+#include "mcptt-trace-writer.h"
+
 namespace ns3 {
 
 /**
  * \ingroup psc
  *
  * A class used to capture MCPTT messages.
+ *
+ * The trace is written either in text, one line per message, or in the
+ * binary format of McpttTraceWriter (attribute BinaryOutput), which is
+ * converted offline to the same text.
  */
 class McpttMsgStats : public Object
 {
@@ -78,6 +84,10 @@ public:
   */
   virtual void ReceiveTxTrace (const McpttPttApp& pttApp, const McpttMsg& msg);
 protected:
+ /**
+  * Releases the binary trace writer, writing the pending records.
+  */
+ virtual void DoDispose (void);
  /**
   * Writes to the trace.
   * \param pttApp The app.
@@ -86,12 +96,24 @@ protected:
   */
  virtual void Trace (const McpttPttApp& pttApp, const McpttMsg& msg, bool rx);
 private:
+ /**
+  * Writes a message to the binary trace.
+  * \param pttApp The app.
+  * \param msg The message.
+  * \param rx The flag that indicates if an RX or TX should be traced.
+  */
+ void TraceBinary (const McpttPttApp& pttApp, const McpttMsg& msg, bool rx);
+ bool m_binaryOutput; //!< The flag that indicates if the trace is written in the binary format.
  bool m_callControl; //!< The flag that indicates if call control messages should be included.
  bool m_firstMsg; //!< Flag that indicates if no message has been traced yet.
  bool m_floorControl; //!< The flag that indicates if floor control messages should be included.
  bool m_includeMsgContent; //!< The flag that indicates if the message contents should be included.
  bool m_media; //!< The flag that indicates if media messages should be included.
  std::string m_outputFileName; //!< The file name of the trace file.
+ Ptr<McpttTraceWriter> m_writer; //!< The writer of the binary trace.
+ uint32_t m_rxId; //!< The index of the "RX" string in the binary trace.
+ uint32_t m_txId; //!< The index of the "TX" string in the binary trace.
+ std::vector<int64_t> m_typeNameIds; //!< The index of the name of each message type in the binary trace, by type ID UID, or -1.
 };
 
 } // namespace ns3
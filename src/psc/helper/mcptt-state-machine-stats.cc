@@ -55,6 +55,11 @@ McpttStateMachineStats::GetTypeId (void)
   static TypeId tid = TypeId ("ns3::McpttStateMachineStats")
     .SetParent<Object> ()
     .AddConstructor<McpttStateMachineStats> ()
+    .AddAttribute ("BinaryOutput",
+                   "Indicates if the trace should be written in the binary format of McpttTraceWriter instead of text.",
+                   BooleanValue (false),
+                   MakeBooleanAccessor (&McpttStateMachineStats::m_binaryOutput),
+                   MakeBooleanChecker ())
     .AddAttribute ("OutputFileName",
                    "The name to use for the trace file.",
                    StringValue ("mcptt_state_machine_stats.txt"),
@@ -68,7 +73,8 @@ McpttStateMachineStats::GetTypeId (void)
 McpttStateMachineStats::McpttStateMachineStats (void)
   : Object (),
     m_firstCb (true),
-    m_outputFileName ("mcptt_state_machine_stats.txt")
+    m_outputFileName ("mcptt_state_machine_stats.txt"),
+    m_writer (0)
 {
   NS_LOG_FUNCTION (this);
 }
@@ -86,10 +92,43 @@ McpttStateMachineStats::GetInstanceTypeId (void) const
   return McpttStateMachineStats::GetTypeId ();
 }
 
+void
+McpttStateMachineStats::DoDispose (void)
+{
+  NS_LOG_FUNCTION (this);
+
+  m_writer = 0;
+  Object::DoDispose ();
+}
+
 void
 McpttStateMachineStats::StateChangeCb (uint32_t userId, uint32_t callId, const std::string& typeId, const std::string& oldStateName, const std::string& newStateName)
 {
   NS_LOG_FUNCTION (this << userId << callId << typeId << oldStateName << newStateName);
+  if (m_binaryOutput)
+    {
+      if (m_writer == 0)
+        {
+          std::vector<McpttTraceWriter::Column> columns;
+          columns.push_back ({"time(ms)", McpttTraceWriter::INTEGER});
+          columns.push_back ({"userid", McpttTraceWriter::INTEGER});
+          columns.push_back ({"callid", McpttTraceWriter::INTEGER});
+          columns.push_back ({"typeid", McpttTraceWriter::STRING});
+          columns.push_back ({"oldstate", McpttTraceWriter::STRING});
+          columns.push_back ({"newstate", McpttTraceWriter::STRING});
+          m_writer = Create<McpttTraceWriter> (m_outputFileName, columns);
+        }
+      McpttTraceWriter::Record record;
+      record.values[0] = Simulator::Now ().GetMilliSeconds ();
+      record.values[1] = userId;
+      record.values[2] = callId;
+      record.values[3] = m_writer->Intern (typeId);
+      record.values[4] = m_writer->Intern (oldStateName);
+      record.values[5] = m_writer->Intern (newStateName);
+      m_writer->Write (record);
+      return;
+    }
+
   std::ofstream outFile;
   if (m_firstCb == true)
     {
@@ -37,6 +37,8 @@
 #include <ns3/mcptt-ptt-app.h>
 #include <ns3/type-id.h>
 
+#include "mcptt-trace-writer.h"
+
 namespace ns3 {
 
 /**
@@ -74,9 +76,16 @@ public:
   * \param newStateName THe name of the current state.
   */
  virtual void StateChangeCb (uint32_t userId, uint32_t callId, const std::string& typeId, const std::string& oldStateName, const std::string& newStateName);
+protected:
+ /**
+  * Releases the binary trace writer, writing the pending records.
+  */
+ virtual void DoDispose (void);
 private:
+ bool m_binaryOutput; //!< The flag that indicates if the trace is written in the binary format.
  bool m_firstCb; //!< Flag that indicates if the callback has been fired yet.
  std::string m_outputFileName; //!< The file name of the trace file.
+ Ptr<McpttTraceWriter> m_writer; //!< The writer of the binary trace.
 };
 
 } // namespace ns3
@@ -0,0 +1,445 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * NIST-developed software is provided by NIST as a public service. You may
+ * use, copy and distribute copies of the software in any medium, provided that
+ * you keep intact this entire notice. You may improve, modify and create
+ * derivative works of the software or any portion of the software, and you may
+ * copy and distribute such modifications or works. Modified works should carry
+ * a notice stating that you changed the software and should note the date and
+ * nature of any such change. Please explicitly acknowledge the National
+ * Institute of Standards and Technology as the source of the software.
+ * 
+ * NIST-developed software is expressly provided "AS IS." NIST MAKES NO
+ * WARRANTY OF ANY KIND, EXPRESS, IMPLIED, IN FACT OR ARISING BY OPERATION OF
+ * LAW, INCLUDING, WITHOUT LIMITATION, THE IMPLIED WARRANTY OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE, NON-INFRINGEMENT AND DATA ACCURACY. NIST
+ * NEITHER REPRESENTS NOR WARRANTS THAT THE OPERATION OF THE SOFTWARE WILL BE
+ * UNINTERRUPTED OR ERROR-FREE, OR THAT ANY DEFECTS WILL BE CORRECTED. NIST
+ * DOES NOT WARRANT OR MAKE ANY REPRESENTATIONS REGARDING THE USE OF THE
+ * SOFTWARE OR THE RESULTS THEREOF, INCLUDING BUT NOT LIMITED TO THE
+ * CORRECTNESS, ACCURACY, RELIABILITY, OR USEFULNESS OF THE SOFTWARE.
+ * 
+ * You are solely responsible for determining the appropriateness of using and
+ * distributing the software and you assume all risks associated with its use,
+ * including but not limited to the risks and costs of program errors,
+ * compliance with applicable laws, damage to or loss of data, programs or
+ * equipment, and the unavailability or interruption of operation. This
+ * software is not intended to be used in any situation where a failure could
+ * cause risk of injury or damage to property. The software developed by NIST
+ * employees is not subject to copyright protection within the United States.
+ */
+
+#include <algorithm>
+#include <cstring>
+
+#include <ns3/abort.h>
+#include <ns3/assert.h>
+#include <ns3/log.h>
+
+#include "mcptt-trace-writer.h"
+
+namespace ns3
+{
+NS_LOG_COMPONENT_DEFINE ("McpttTraceWriter");
+
+namespace {
+
+/** The magic string at the start of a binary trace. */
+const char TRACE_MAGIC[] = "MCPTTTRC";
+/** The length of the magic string. */
+const std::size_t TRACE_MAGIC_LENGTH = 8;
+/** The version of the format of the binary traces. */
+const uint32_t TRACE_VERSION = 2;
+
+/**
+ * Reads a 32-bit unsigned integer from a binary trace.
+ * \param in The stream of the binary trace.
+ * \param value The value read.
+ * \returns True if the value was read.
+ */
+bool
+ReadU32 (std::istream& in, uint32_t& value)
+{
+  in.read (reinterpret_cast<char *> (&value), sizeof (value));
+  return in.gcount () == sizeof (value);
+}
+
+/**
+ * Reads a string from a binary trace.
+ * \param in The stream of the binary trace.
+ * \param value The string read.
+ * \returns True if the string was read.
+ */
+bool
+ReadString (std::istream& in, std::string& value)
+{
+  uint32_t length;
+  if (!ReadU32 (in, length))
+    {
+      return false;
+    }
+  value.resize (length);
+  if (length > 0)
+    {
+      in.read (&value[0], length);
+    }
+  return in.gcount () == length;
+}
+
+} // unnamed namespace
+
+bool
+McpttTraceWriter::ConvertToText (const std::string& binaryFileName, const std::string& textFileName)
+{
+  NS_LOG_FUNCTION (binaryFileName << textFileName);
+
+  std::ifstream in (binaryFileName.c_str (), std::ios_base::binary);
+  if (!in.is_open ())
+    {
+      NS_LOG_ERROR ("cannot open " << binaryFileName);
+      return false;
+    }
+  std::ofstream out (textFileName.c_str ());
+  if (!out.is_open ())
+    {
+      NS_LOG_ERROR ("cannot create " << textFileName);
+      return false;
+    }
+
+  return ConvertToText (in, out);
+}
+
+bool
+McpttTraceWriter::ConvertToText (std::istream& in, std::ostream& out)
+{
+  NS_LOG_FUNCTION (&in << &out);
+
+  char magic[TRACE_MAGIC_LENGTH];
+  in.read (magic, TRACE_MAGIC_LENGTH);
+  uint32_t version;
+  if (in.gcount () != TRACE_MAGIC_LENGTH
+      || std::memcmp (magic, TRACE_MAGIC, TRACE_MAGIC_LENGTH) != 0
+      || !ReadU32 (in, version)
+      || version != TRACE_VERSION)
+    {
+      NS_LOG_ERROR ("not an MCPTT binary trace");
+      return false;
+    }
+
+  uint32_t nColumns;
+  if (!ReadU32 (in, nColumns) || nColumns == 0 || nColumns > MAX_COLUMNS)
+    {
+      NS_LOG_ERROR ("invalid number of columns");
+      return false;
+    }
+  std::vector<ColumnType> types (nColumns);
+  uint32_t nValueColumns = 0;
+  for (uint32_t column = 0; column < nColumns; column++)
+    {
+      uint32_t type;
+      std::string name;
+      if (!ReadU32 (in, type) || type > TEXT || !ReadString (in, name)
+          || (type == TEXT && nValueColumns < column))
+        {
+          NS_LOG_ERROR ("invalid column " << column);
+          return false;
+        }
+      types[column] = static_cast<ColumnType> (type);
+      if (type != TEXT)
+        {
+          nValueColumns++;
+        }
+      out << (column == 0 ? "" : "\t") << name;
+    }
+  out << std::endl;
+  bool hasText = nValueColumns < nColumns;
+
+  std::vector<std::string> strings;
+  std::vector<int64_t> values;
+  std::vector<std::string> texts;
+  uint32_t nStrings;
+  while (ReadU32 (in, nStrings))
+    {
+      for (uint32_t i = 0; i < nStrings; i++)
+        {
+          std::string value;
+          if (!ReadString (in, value))
+            {
+              NS_LOG_ERROR ("truncated string table");
+              return false;
+            }
+          strings.push_back (value);
+        }
+
+      uint32_t nRecords;
+      if (!ReadU32 (in, nRecords))
+        {
+          NS_LOG_ERROR ("truncated block");
+          return false;
+        }
+      values.resize (static_cast<std::size_t> (nRecords) * nValueColumns);
+      std::streamsize size = values.size () * sizeof (int64_t);
+      in.read (reinterpret_cast<char *> (values.data ()), size);
+      if (in.gcount () != size)
+        {
+          NS_LOG_ERROR ("truncated block");
+          return false;
+        }
+      texts.resize (hasText ? nRecords : 0);
+      for (std::size_t record = 0; record < texts.size (); record++)
+        {
+          if (!ReadString (in, texts[record]))
+            {
+              NS_LOG_ERROR ("truncated texts");
+              return false;
+            }
+        }
+
+      for (uint32_t record = 0; record < nRecords; record++)
+        {
+          uint32_t valueColumn = 0;
+          for (uint32_t column = 0; column < nColumns; column++)
+            {
+              if (column > 0)
+                {
+                  out << "\t";
+                }
+              if (types[column] == TEXT)
+                {
+                  out << texts[record];
+                  continue;
+                }
+              int64_t value = values[static_cast<std::size_t> (valueColumn++) * nRecords + record];
+              if (types[column] == STRING)
+                {
+                  if (value < 0 || static_cast<uint64_t> (value) >= strings.size ())
+                    {
+                      NS_LOG_ERROR ("invalid string index " << value);
+                      return false;
+                    }
+                  out << strings[value];
+                }
+              else
+                {
+                  out << value;
+                }
+            }
+          out << std::endl;
+        }
+    }
+
+  return true;
+}
+
+McpttTraceWriter::McpttTraceWriter (const std::string& fileName, const std::vector<Column>& columns, uint32_t capacity)
+  : m_columns (columns),
+    m_hasText (false),
+    m_ring (capacity),
+    m_head (0),
+    m_count (0),
+    m_batchSize (std::max<uint32_t> (capacity / 2, 1)),
+    m_appended (0),
+    m_written (0),
+    m_flushRequested (false),
+    m_closing (false)
+{
+  NS_LOG_FUNCTION (this << fileName << columns.size () << capacity);
+
+  NS_ABORT_MSG_IF (columns.empty () || columns.size () > MAX_COLUMNS, "Invalid number of columns: " << columns.size ());
+  NS_ABORT_MSG_IF (capacity == 0, "The ring buffer must hold at least one record.");
+  for (uint32_t column = 0; column < m_columns.size (); column++)
+    {
+      if (m_columns[column].type == TEXT)
+        {
+          NS_ABORT_MSG_IF (m_hasText, "A trace has at most one text column.");
+          m_hasText = true;
+        }
+      else
+        {
+          m_valueColumns.push_back (column);
+        }
+    }
+
+  m_file.open (fileName.c_str (), std::ios_base::binary | std::ios_base::trunc);
+  NS_ABORT_MSG_IF (!m_file.is_open (), "Cannot create the trace file " << fileName);
+
+  m_file.write (TRACE_MAGIC, TRACE_MAGIC_LENGTH);
+  WriteU32 (TRACE_VERSION);
+  WriteU32 (m_columns.size ());
+  for (std::vector<Column>::const_iterator it = m_columns.begin (); it != m_columns.end (); it++)
+    {
+      WriteU32 (it->type);
+      WriteU32 (it->name.size ());
+      m_file.write (it->name.data (), it->name.size ());
+    }
+
+  m_thread = std::thread (&McpttTraceWriter::Run, this);
+}
+
+McpttTraceWriter::~McpttTraceWriter (void)
+{
+  NS_LOG_FUNCTION (this);
+
+  {
+    std::unique_lock<std::mutex> lock (m_mutex);
+    m_closing = true;
+  }
+  m_dataReady.notify_one ();
+  m_thread.join ();
+  m_file.close ();
+}
+
+uint32_t
+McpttTraceWriter::Intern (const std::string& value)
+{
+  std::unordered_map<std::string, uint32_t>::const_iterator it = m_stringIds.find (value);
+  if (it != m_stringIds.end ())
+    {
+      return it->second;
+    }
+
+  uint32_t id = m_stringIds.size ();
+  m_stringIds.insert (std::make_pair (value, id));
+  std::unique_lock<std::mutex> lock (m_mutex);
+  m_newStrings.push_back (value);
+
+  return id;
+}
+
+void
+McpttTraceWriter::Write (Record& record)
+{
+  std::unique_lock<std::mutex> lock (m_mutex);
+  while (m_count == m_ring.size ())
+    {
+      m_dataReady.notify_one ();
+      m_spaceAvailable.wait (lock);
+    }
+  uint32_t tail = m_head + m_count;
+  if (tail >= m_ring.size ())
+    {
+      tail -= m_ring.size ();
+    }
+  std::copy (record.values, record.values + MAX_COLUMNS, m_ring[tail].values);
+  if (m_hasText)
+    {
+      m_ring[tail].text.swap (record.text);
+    }
+  m_count++;
+  m_appended++;
+  if (m_count == m_batchSize)
+    {
+      m_dataReady.notify_one ();
+    }
+}
+
+void
+McpttTraceWriter::Flush (void)
+{
+  NS_LOG_FUNCTION (this);
+
+  std::unique_lock<std::mutex> lock (m_mutex);
+  m_flushRequested = true;
+  m_dataReady.notify_one ();
+  while (m_written != m_appended)
+    {
+      m_dataWritten.wait (lock);
+    }
+  m_flushRequested = false;
+  m_file.flush ();
+}
+
+void
+McpttTraceWriter::Run (void)
+{
+  NS_LOG_FUNCTION (this);
+
+  std::vector<std::string> strings;
+  std::vector<int64_t> columns;
+  std::vector<std::string> texts;
+  std::unique_lock<std::mutex> lock (m_mutex);
+  while (true)
+    {
+      while (m_count < m_batchSize && !m_flushRequested && !m_closing)
+        {
+          m_dataReady.wait (lock);
+        }
+      if (m_count == 0 && m_newStrings.empty ())
+        {
+          if (m_closing)
+            {
+              break;
+            }
+          m_dataWritten.notify_all ();
+          m_dataReady.wait (lock);
+          continue;
+        }
+
+      // take all the pending records, column by column; the strings they
+      // use were interned before them, hence are either taken now or were
+      // already written
+      uint32_t nRecords = m_count;
+      strings.swap (m_newStrings);
+      columns.resize (static_cast<std::size_t> (nRecords) * m_valueColumns.size ());
+      texts.resize (m_hasText ? nRecords : 0);
+      uint32_t index = m_head;
+      for (uint32_t record = 0; record < nRecords; record++)
+        {
+          for (uint32_t column = 0; column < m_valueColumns.size (); column++)
+            {
+              columns[static_cast<std::size_t> (column) * nRecords + record] = m_ring[index].values[m_valueColumns[column]];
+            }
+          if (m_hasText)
+            {
+              texts[record].swap (m_ring[index].text);
+            }
+          if (++index == m_ring.size ())
+            {
+              index = 0;
+            }
+        }
+      m_head = index;
+      m_count = 0;
+      m_spaceAvailable.notify_one ();
+
+      lock.unlock ();
+      WriteBlock (strings, columns, texts, nRecords);
+      strings.clear ();
+      lock.lock ();
+
+      m_written += nRecords;
+      if (m_written == m_appended)
+        {
+          m_dataWritten.notify_all ();
+        }
+    }
+}
+
+void
+McpttTraceWriter::WriteBlock (const std::vector<std::string>& strings, const std::vector<int64_t>& columns,
+                              const std::vector<std::string>& texts, uint32_t nRecords)
+{
+  NS_LOG_FUNCTION (this << strings.size () << nRecords);
+
+  WriteU32 (strings.size ());
+  for (std::vector<std::string>::const_iterator it = strings.begin (); it != strings.end (); it++)
+    {
+      WriteU32 (it->size ());
+      m_file.write (it->data (), it->size ());
+    }
+  WriteU32 (nRecords);
+  m_file.write (reinterpret_cast<const char *> (columns.data ()), columns.size () * sizeof (int64_t));
+  for (std::vector<std::string>::const_iterator it = texts.begin (); it != texts.end (); it++)
+    {
+      WriteU32 (it->size ());
+      m_file.write (it->data (), it->size ());
+    }
+}
+
+void
+McpttTraceWriter::WriteU32 (uint32_t value)
+{
+  m_file.write (reinterpret_cast<const char *> (&value), sizeof (value));
+}
+
+} // namespace ns3
@@ -0,0 +1,199 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * NIST-developed software is provided by NIST as a public service. You may
+ * use, copy and distribute copies of the software in any medium, provided that
+ * you keep intact this entire notice. You may improve, modify and create
+ * derivative works of the software or any portion of the software, and you may
+ * copy and distribute such modifications or works. Modified works should carry
+ * a notice stating that you changed the software and should note the date and
+ * nature of any such change. Please explicitly acknowledge the National
+ * Institute of Standards and Technology as the source of the software.
+ *
+ * NIST-developed software is expressly provided "AS IS." NIST MAKES NO
+ * WARRANTY OF ANY KIND, EXPRESS, IMPLIED, IN FACT OR ARISING BY OPERATION OF
+ * LAW, INCLUDING, WITHOUT LIMITATION, THE IMPLIED WARRANTY OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE, NON-INFRINGEMENT AND DATA ACCURACY. NIST
+ * NEITHER REPRESENTS NOR WARRANTS THAT THE OPERATION OF THE SOFTWARE WILL BE
+ * UNINTERRUPTED OR ERROR-FREE, OR THAT ANY DEFECTS WILL BE CORRECTED. NIST
+ * DOES NOT WARRANT OR MAKE ANY REPRESENTATIONS REGARDING THE USE OF THE
+ * SOFTWARE OR THE RESULTS THEREOF, INCLUDING BUT NOT LIMITED TO THE
+ * CORRECTNESS, ACCURACY, RELIABILITY, OR USEFULNESS OF THE SOFTWARE.
+ *
+ * You are solely responsible for determining the appropriateness of using and
+ * distributing the software and you assume all risks associated with its use,
+ * including but not limited to the risks and costs of program errors,
+ * compliance with applicable laws, damage to or loss of data, programs or
+ * equipment, and the unavailability or interruption of operation. This
+ * software is not intended to be used in any situation where a failure could
+ * cause risk of injury or damage to property. The software developed by NIST
+ * employees is not subject to copyright protection within the United States.
+ */
+
+#ifndef MCPTT_TRACE_WRITER_H
+#define MCPTT_TRACE_WRITER_H
+
+#include <stdint.h>
+#include <condition_variable>
+#include <fstream>
+#include <iostream>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include <ns3/simple-ref-count.h>
+
+namespace ns3 {
+
+/**
+ * \ingroup psc
+ *
+ * A buffered writer of MCPTT traces in a binary, columnar format.
+ *
+ * The records of a trace are tuples of integers with a fixed number of
+ * columns. A string column stores the index of the string in a table of
+ * interned strings, so that a string with few distinct values (e.g., a
+ * message type or a state name) is only written once to the file. A
+ * record may also hold a text, for a value which is different in almost
+ * every record (e.g., the content of a message), which is written inline
+ * with the record instead of being interned. The records are stored by the
+ * caller in a ring buffer of fixed capacity, and a background thread
+ * writes them to the file in blocks, column by column, so the caller
+ * neither formats nor writes the records. When the ring buffer is full,
+ * the caller waits for the background thread to make room.
+ *
+ * The file starts with the magic string "MCPTTTRC", the version of the
+ * format, the number of columns and, for each column, its type and its
+ * name. It then contains a sequence of blocks, each one made of the
+ * strings interned since the previous block (count, then length and
+ * characters of each string), the number of records, the values of each
+ * integer and string column for all the records of the block and, if the
+ * trace has a text column, the length and characters of the text of each
+ * record. All the integers are stored in the byte order of the host.
+ *
+ * A binary trace is converted offline to the text format of the MCPTT
+ * statistics with ConvertToText (), also available in the
+ * mcptt-trace-converter program.
+ *
+ * The Intern () and Write () methods must be called from a single thread.
+ */
+class McpttTraceWriter : public SimpleRefCount<McpttTraceWriter>
+{
+public:
+ /**
+  * The type of the values of a column.
+  */
+ enum ColumnType
+ {
+   INTEGER = 0, //!< A signed integer.
+   STRING = 1,  //!< The index of an interned string.
+   TEXT = 2     //!< A string written inline, stored in Record::text.
+ };
+ /**
+  * The description of a column.
+  */
+ struct Column
+ {
+   std::string name; //!< The name of the column, used as header of the text format.
+   ColumnType type;  //!< The type of the values.
+ };
+ /**
+  * The maximum number of columns of a trace.
+  */
+ static const uint32_t MAX_COLUMNS = 8;
+ /**
+  * A record, i.e., a row of the trace.
+  */
+ struct Record
+ {
+   int64_t values[MAX_COLUMNS]; //!< The values of the integer and string columns.
+   std::string text; //!< The value of the text column, if the trace has one.
+ };
+ /**
+  * Converts a binary trace to the text format.
+  * \param binaryFileName The name of the binary trace file.
+  * \param textFileName The name of the text file to create.
+  * \returns True if the binary trace was converted successfully.
+  */
+ static bool ConvertToText (const std::string& binaryFileName, const std::string& textFileName);
+ /**
+  * Converts a binary trace to the text format.
+  * \param in The stream of the binary trace.
+  * \param out The stream of the text format.
+  * \returns True if the binary trace was converted successfully.
+  */
+ static bool ConvertToText (std::istream& in, std::ostream& out);
+ /**
+  * Creates an instance of the McpttTraceWriter class, which creates the
+  * trace file and starts the background thread.
+  * \param fileName The name of the trace file.
+  * \param columns The columns of the trace, with at most one text column.
+  * \param capacity The number of records of the ring buffer.
+  */
+ McpttTraceWriter (const std::string& fileName, const std::vector<Column>& columns, uint32_t capacity = 4096);
+ /**
+  * \brief The destructor of the McpttTraceWriter class, which writes the
+  * pending records and closes the trace file.
+  */
+ ~McpttTraceWriter (void);
+ /**
+  * Gets the index of a string, interning it if not seen before.
+  * \param value The string.
+  * \returns The index of the string, to store in a string column.
+  */
+ uint32_t Intern (const std::string& value);
+ /**
+  * Appends a record to the trace.
+  * \param record The record, with a value for each column. Its text is
+  *        moved to the ring buffer.
+  */
+ void Write (Record& record);
+ /**
+  * Waits until all the records appended so far are written to the file.
+  */
+ void Flush (void);
+private:
+ /**
+  * The function of the background thread, which writes the records.
+  */
+ void Run (void);
+ /**
+  * Writes a block of records to the file.
+  * \param strings The strings interned since the previous block.
+  * \param columns The values of the records, integer and string column by column.
+  * \param texts The texts of the records, if the trace has a text column.
+  * \param nRecords The number of records.
+  */
+ void WriteBlock (const std::vector<std::string>& strings, const std::vector<int64_t>& columns,
+                  const std::vector<std::string>& texts, uint32_t nRecords);
+ /**
+  * Writes a 32-bit unsigned integer to the file.
+  * \param value The value.
+  */
+ void WriteU32 (uint32_t value);
+
+ std::ofstream m_file; //!< The trace file.
+ std::vector<Column> m_columns; //!< The columns of the trace.
+ std::vector<uint32_t> m_valueColumns; //!< The indexes of the integer and string columns.
+ bool m_hasText; //!< Flag that indicates if the trace has a text column.
+ std::unordered_map<std::string, uint32_t> m_stringIds; //!< The indexes of the interned strings.
+ std::vector<std::string> m_newStrings; //!< The strings interned since the last block taken by the background thread.
+ std::vector<Record> m_ring; //!< The ring buffer of the records.
+ uint32_t m_head; //!< The index of the oldest record in the ring buffer.
+ uint32_t m_count; //!< The number of records in the ring buffer.
+ uint32_t m_batchSize; //!< The number of records waking up the background thread.
+ uint64_t m_appended; //!< The number of records appended.
+ uint64_t m_written; //!< The number of records written to the file.
+ bool m_flushRequested; //!< Flag that indicates if a caller waits for the records to be written.
+ bool m_closing; //!< Flag that indicates if the background thread must terminate.
+ std::mutex m_mutex; //!< The mutex protecting the state shared with the background thread.
+ std::condition_variable m_dataReady; //!< Notifies the background thread that records are ready.
+ std::condition_variable m_spaceAvailable; //!< Notifies the callers that records were taken from the ring buffer.
+ std::condition_variable m_dataWritten; //!< Notifies the callers that records were written.
+ std::thread m_thread; //!< The background thread.
+};
+
+} // namespace ns3
+
+#endif /* MCPTT_TRACE_WRITER_H */
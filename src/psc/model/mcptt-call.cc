@@ -82,6 +82,14 @@ McpttCall::McpttCall (void)
     m_txCb (MakeNullCallback<void, const McpttCall&, const McpttMsg&> ())
 {
   NS_LOG_FUNCTION (this);
+
+  RegisterFloorMsg (McpttFloorMsgRequest::SUBTYPE, McpttFloorMsgRequest::GetTypeId ());
+  RegisterFloorMsg (McpttFloorMsgGranted::SUBTYPE, McpttFloorMsgGranted::GetTypeId ());
+  RegisterFloorMsg (McpttFloorMsgDeny::SUBTYPE, McpttFloorMsgDeny::GetTypeId ());
+  RegisterFloorMsg (McpttFloorMsgRelease::SUBTYPE, McpttFloorMsgRelease::GetTypeId ());
+  RegisterFloorMsg (McpttFloorMsgTaken::SUBTYPE, McpttFloorMsgTaken::GetTypeId ());
+  RegisterFloorMsg (McpttFloorMsgQueuePosReq::SUBTYPE, McpttFloorMsgQueuePosReq::GetTypeId ());
+  RegisterFloorMsg (McpttFloorMsgQueueInfo::SUBTYPE, McpttFloorMsgQueueInfo::GetTypeId ());
 }
 
 McpttCall::~McpttCall (void)
@@ -206,6 +214,23 @@ McpttCall::Receive (const McpttMediaMsg& msg)
   floorMachine->Receive (msg);
 }
 
+void
+McpttCall::RegisterFloorMsg (uint8_t subtype, const TypeId& msgTypeId)
+{
+  NS_LOG_FUNCTION (this << (uint32_t)subtype << msgTypeId);
+
+  void (McpttCall::*receive) (const McpttFloorMsg&) = &McpttCall::Receive;
+  RegisterFloorMsg (subtype, msgTypeId, MakeCallback (receive, this));
+}
+
+void
+McpttCall::RegisterFloorMsg (uint8_t subtype, const TypeId& msgTypeId, const Callback<void, const McpttFloorMsg&>& handler)
+{
+  NS_LOG_FUNCTION (this << (uint32_t)subtype << msgTypeId);
+
+  m_floorMsgDispatcher.Register (subtype, msgTypeId, handler);
+}
+
 void
 McpttCall::Send (const McpttCallMsg& msg)
 {
@@ -280,54 +305,12 @@ McpttCall::ReceiveFloorPkt (Ptr<Packet>  pkt)
 {
   NS_LOG_FUNCTION (this << &pkt);
 
-  McpttFloorMsg temp;
-
-  pkt->PeekHeader (temp);
-  uint8_t subtype = temp.GetSubtype ();
+  // the last five bits of the first byte of a floor control message are its subtype
+  uint8_t firstByte = 0;
+  NS_ABORT_MSG_IF (pkt->CopyData (&firstByte, 1) != 1, "Received an empty floor control packet.");
+  uint8_t subtype = (firstByte & 0x1F);
 
-  if (subtype == McpttFloorMsgRequest::SUBTYPE)
-    {
-      McpttFloorMsgRequest reqMsg;
-      pkt->RemoveHeader (reqMsg);
-      Receive (reqMsg);
-    }
-  else if (subtype == McpttFloorMsgGranted::SUBTYPE)
-    {
-      McpttFloorMsgGranted grantedMsg;
-      pkt->RemoveHeader (grantedMsg);
-      Receive (grantedMsg);
-    }
-  else if (subtype == McpttFloorMsgDeny::SUBTYPE)
-    {
-      McpttFloorMsgDeny denyMsg;
-      pkt->RemoveHeader (denyMsg);
-      Receive (denyMsg);
-    }
-  else if (subtype == McpttFloorMsgRelease::SUBTYPE)
-    {
-      McpttFloorMsgRelease releaseMsg;
-      pkt->RemoveHeader (releaseMsg);
-      Receive (releaseMsg);
-    }
-  else if (subtype == McpttFloorMsgTaken::SUBTYPE)
-    {
-      McpttFloorMsgTaken takenMsg;
-      pkt->RemoveHeader (takenMsg);
-      Receive (takenMsg);
-    }
-  else if (subtype == McpttFloorMsgQueuePosReq::SUBTYPE)
-    {
-      McpttFloorMsgQueuePosReq queuePosReqMsg;
-      pkt->RemoveHeader (queuePosReqMsg);
-      Receive (queuePosReqMsg);
-    }
-  else if (subtype == McpttFloorMsgQueueInfo::SUBTYPE)
-    {
-      McpttFloorMsgQueueInfo queueInfoMsg;
-      pkt->RemoveHeader (queueInfoMsg);
-      Receive (queueInfoMsg);
-    }
-  else
+  if (!m_floorMsgDispatcher.Dispatch (subtype, pkt))
     {
       NS_FATAL_ERROR ("Could not resolve message subtype = " << (uint32_t)subtype << ".");
     }
@@ -43,6 +43,7 @@
 #include "mcptt-floor-machine.h"
 #include "mcptt-floor-msg.h"
 #include "mcptt-media-msg.h"
+#include "mcptt-msg-dispatcher.h"
 
 namespace ns3 {
 
@@ -123,6 +124,22 @@ public:
   * \param msg The message that was received.
   */
  void Receive (const McpttMediaMsg& msg);
+ /**
+  * Registers the type of the floor control messages with a given subtype,
+  * which are then passed to the Receive function when received.
+  * \param subtype The message subtype.
+  * \param msgTypeId The type ID of the message class.
+  */
+ void RegisterFloorMsg (uint8_t subtype, const TypeId& msgTypeId);
+ /**
+  * Registers the type of the floor control messages with a given subtype,
+  * and the handler of the received messages, replacing the previous
+  * registration of the subtype.
+  * \param subtype The message subtype.
+  * \param msgTypeId The type ID of the message class.
+  * \param handler The handler of the received messages.
+  */
+ void RegisterFloorMsg (uint8_t subtype, const TypeId& msgTypeId, const Callback<void, const McpttFloorMsg&>& handler);
  /**
   * Sends a call message.
   * \param msg The message to send.
@@ -157,6 +174,7 @@ protected:
  Ptr<McpttCallMachine> m_callMachine; //!< The call control state machine.
  Ptr<McpttChan> m_floorChan; //!< The channel to use for floor control messages.
  Ptr<McpttFloorMachine> m_floorMachine; //!< The floor state machine.
+ McpttMsgDispatcher<McpttFloorMsg> m_floorMsgDispatcher; //!< The dispatch table of the received floor control messages.
  Ptr<McpttChan> m_mediaChan; //!< The channel to use for media messages.
  McpttPttApp* m_owner; //!< The owner of this call.
  Callback<void, const McpttCall&, const McpttMsg&> m_rxCb; //!< The received message callback.
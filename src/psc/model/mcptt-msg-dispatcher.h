@@ -0,0 +1,289 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * NIST-developed software is provided by NIST as a public service. You may
+ * use, copy and distribute copies of the software in any medium, provided that
+ * you keep intact this entire notice. You may improve, modify and create
+ * derivative works of the software or any portion of the software, and you may
+ * copy and distribute such modifications or works. Modified works should carry
+ * a notice stating that you changed the software and should note the date and
+ * nature of any such change. Please explicitly acknowledge the National
+ * Institute of Standards and Technology as the source of the software.
+ * 
+ * NIST-developed software is expressly provided "AS IS." NIST MAKES NO
+ * WARRANTY OF ANY KIND, EXPRESS, IMPLIED, IN FACT OR ARISING BY OPERATION OF
+ * LAW, INCLUDING, WITHOUT LIMITATION, THE IMPLIED WARRANTY OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE, NON-INFRINGEMENT AND DATA ACCURACY. NIST
+ * NEITHER REPRESENTS NOR WARRANTS THAT THE OPERATION OF THE SOFTWARE WILL BE
+ * UNINTERRUPTED OR ERROR-FREE, OR THAT ANY DEFECTS WILL BE CORRECTED. NIST
+ * DOES NOT WARRANT OR MAKE ANY REPRESENTATIONS REGARDING THE USE OF THE
+ * SOFTWARE OR THE RESULTS THEREOF, INCLUDING BUT NOT LIMITED TO THE
+ * CORRECTNESS, ACCURACY, RELIABILITY, OR USEFULNESS OF THE SOFTWARE.
+ * 
+ * You are solely responsible for determining the appropriateness of using and
+ * distributing the software and you assume all risks associated with its use,
+ * including but not limited to the risks and costs of program errors,
+ * compliance with applicable laws, damage to or loss of data, programs or
+ * equipment, and the unavailability or interruption of operation. This
+ * software is not intended to be used in any situation where a failure could
+ * cause risk of injury or damage to property. The software developed by NIST
+ * employees is not subject to copyright protection within the United States.
+ */
+
+#ifndef MCPTT_MSG_DISPATCHER_H
+#define MCPTT_MSG_DISPATCHER_H
+
+#include <stdint.h>
+#include <vector>
+
+#include <ns3/abort.h>
+#include <ns3/callback.h>
+#include <ns3/packet.h>
+#include <ns3/ptr.h>
+#include <ns3/type-id.h>
+
+namespace ns3 {
+
+/**
+ * \ingroup mcptt
+ *
+ * A table that dispatches the MCPTT messages received in packets according
+ * to their code (e.g., the message type of a call control message or the
+ * subtype of a floor control message).
+ *
+ * For each code, a message type and a handler are registered. The table
+ * owns one instance of each registered message type, which is reused to
+ * deserialize all the received messages of that type, so that a message is
+ * deserialized once, without constructing a new message object. The handler
+ * receives the message as a reference to the base class T, and may not keep
+ * the reference after it returns. When a handler receives, directly or not,
+ * a second message of the same type before returning, the second message is
+ * deserialized into a temporary instance.
+ *
+ * New message types, or handlers that intercept a message type, are plugged
+ * in by registering them, possibly replacing the previous registration of
+ * the code.
+ *
+ * \tparam T The base class of the messages, e.g. McpttCallMsg.
+ */
+template <typename T>
+class McpttMsgDispatcher
+{
+public:
+ /**
+  * The handler of a received message.
+  */
+ typedef Callback<void, const T&> Handler;
+ /**
+  * Creates an empty instance of the McpttMsgDispatcher class.
+  */
+ McpttMsgDispatcher (void);
+ /**
+  * \brief The destructor of the McpttMsgDispatcher class, which deletes the
+  * message instances.
+  */
+ ~McpttMsgDispatcher (void);
+ /**
+  * Registers a message type, replacing the previous registration of its code.
+  * \param code The code of the message type.
+  * \param msgTypeId The type ID of the message type, which must have a
+  *        constructor and derive from T.
+  * \param handler The handler of the messages of that type.
+  */
+ void Register (uint8_t code, const TypeId& msgTypeId, const Handler& handler);
+ /**
+  * Removes the registration of a code.
+  * \param code The code of the message type.
+  */
+ void Unregister (uint8_t code);
+ /**
+  * Removes all the registrations.
+  */
+ void Clear (void);
+ /**
+  * Indicates if a code is registered.
+  * \param code The code.
+  * \returns True, if a message type is registered for the code.
+  */
+ bool IsRegistered (uint8_t code) const;
+ /**
+  * Removes the message from a packet and passes it to the handler of its code.
+  * \param code The code of the message, peeked from the packet.
+  * \param pkt The packet.
+  * \returns False, if no message type is registered for the code, in which
+  *          case the packet is left untouched.
+  */
+ bool Dispatch (uint8_t code, Ptr<Packet> pkt);
+private:
+ /**
+  * The registration of a message type.
+  */
+ struct Entry
+ {
+   TypeId msgTypeId; //!< The type ID of the message type.
+   Handler handler; //!< The handler of the messages.
+   T* msg; //!< The instance reused to deserialize the messages.
+   bool busy; //!< Flag that indicates if the instance is being handled.
+ };
+ /**
+  * The index of a code that is not registered.
+  */
+ static const uint8_t UNREGISTERED = 0xff;
+ /**
+  * Creates an instance of a message type.
+  * \param msgTypeId The type ID of the message type.
+  * \returns The new message.
+  */
+ static T* CreateMsg (const TypeId& msgTypeId);
+ /**
+  * Disabled copy constructor, the dispatcher owns the message instances.
+  * \param other The other instance.
+  */
+ McpttMsgDispatcher (const McpttMsgDispatcher<T>& other);
+ /**
+  * Disabled assignment operator.
+  * \param other The other instance.
+  * \returns This instance.
+  */
+ McpttMsgDispatcher<T>& operator= (const McpttMsgDispatcher<T>& other);
+
+ uint8_t m_index[256]; //!< The index of the entry of each code.
+ std::vector<Entry> m_entries; //!< The registered message types.
+};
+
+template <typename T>
+McpttMsgDispatcher<T>::McpttMsgDispatcher (void)
+{
+  for (uint32_t code = 0; code < 256; code++)
+    {
+      m_index[code] = UNREGISTERED;
+    }
+}
+
+template <typename T>
+McpttMsgDispatcher<T>::~McpttMsgDispatcher (void)
+{
+  Clear ();
+}
+
+template <typename T>
+T*
+McpttMsgDispatcher<T>::CreateMsg (const TypeId& msgTypeId)
+{
+  NS_ABORT_MSG_UNLESS (msgTypeId.HasConstructor (), "Message type " << msgTypeId.GetName () << " has no constructor.");
+  ObjectBase* base = msgTypeId.GetConstructor () ();
+  T* msg = dynamic_cast<T*> (base);
+  NS_ABORT_MSG_IF (msg == 0, "Message type " << msgTypeId.GetName () << " is not a " << T::GetTypeId ().GetName () << ".");
+  return msg;
+}
+
+template <typename T>
+void
+McpttMsgDispatcher<T>::Register (uint8_t code, const TypeId& msgTypeId, const Handler& handler)
+{
+  Entry entry;
+  entry.msgTypeId = msgTypeId;
+  entry.handler = handler;
+  entry.msg = CreateMsg (msgTypeId);
+  entry.busy = false;
+
+  if (m_index[code] != UNREGISTERED)
+    {
+      Entry& old = m_entries[m_index[code]];
+      NS_ABORT_MSG_IF (old.busy, "Code " << (uint32_t)code << " replaced while a message is handled.");
+      delete old.msg;
+      old = entry;
+    }
+  else
+    {
+      NS_ABORT_MSG_IF (m_entries.size () >= UNREGISTERED, "Too many message types.");
+      m_index[code] = m_entries.size ();
+      m_entries.push_back (entry);
+    }
+}
+
+template <typename T>
+void
+McpttMsgDispatcher<T>::Unregister (uint8_t code)
+{
+  uint8_t index = m_index[code];
+  if (index == UNREGISTERED)
+    {
+      return;
+    }
+  NS_ABORT_MSG_IF (m_entries[index].busy, "Code " << (uint32_t)code << " removed while a message is handled.");
+  delete m_entries[index].msg;
+  m_index[code] = UNREGISTERED;
+  // move the last entry into the free slot
+  uint8_t last = m_entries.size () - 1;
+  if (index != last)
+    {
+      m_entries[index] = m_entries[last];
+      for (uint32_t other = 0; other < 256; other++)
+        {
+          if (m_index[other] == last)
+            {
+              m_index[other] = index;
+            }
+        }
+    }
+  m_entries.pop_back ();
+}
+
+template <typename T>
+void
+McpttMsgDispatcher<T>::Clear (void)
+{
+  for (typename std::vector<Entry>::iterator it = m_entries.begin (); it != m_entries.end (); it++)
+    {
+      NS_ABORT_MSG_IF (it->busy, "Message types removed while a message is handled.");
+      delete it->msg;
+    }
+  m_entries.clear ();
+  for (uint32_t code = 0; code < 256; code++)
+    {
+      m_index[code] = UNREGISTERED;
+    }
+}
+
+template <typename T>
+bool
+McpttMsgDispatcher<T>::IsRegistered (uint8_t code) const
+{
+  return m_index[code] != UNREGISTERED;
+}
+
+template <typename T>
+bool
+McpttMsgDispatcher<T>::Dispatch (uint8_t code, Ptr<Packet> pkt)
+{
+  uint8_t index = m_index[code];
+  if (index == UNREGISTERED)
+    {
+      return false;
+    }
+
+  Entry& entry = m_entries[index];
+  if (entry.busy)
+    {
+      // received while handling a message of the same type
+      Handler handler = entry.handler;
+      T* msg = CreateMsg (entry.msgTypeId);
+      pkt->RemoveHeader (*msg);
+      handler (*msg);
+      delete msg;
+      return true;
+    }
+
+  T* msg = entry.msg;
+  Handler handler = entry.handler;
+  pkt->RemoveHeader (*msg);
+  entry.busy = true;
+  handler (*msg);
+  // the entries may have been reallocated by the handler
+  m_entries[m_index[code]].busy = false;
+  return true;
+}
+
+} // namespace ns3
+
+#endif /* MCPTT_MSG_DISPATCHER_H */
@@ -126,6 +126,27 @@ McpttPttApp::McpttPttApp (void)
     m_userId (0)
 {  
   NS_LOG_FUNCTION (this);
+
+  RegisterCallMsg (McpttCallMsgGrpProbe::CODE, McpttCallMsgGrpProbe::GetTypeId ());
+  RegisterCallMsg (McpttCallMsgGrpAnnoun::CODE, McpttCallMsgGrpAnnoun::GetTypeId ());
+  RegisterCallMsg (McpttCallMsgGrpAccept::CODE, McpttCallMsgGrpAccept::GetTypeId ());
+  RegisterCallMsg (McpttCallMsgGrpImmPerilEnd::CODE, McpttCallMsgGrpImmPerilEnd::GetTypeId ());
+  RegisterCallMsg (McpttCallMsgGrpEmergEnd::CODE, McpttCallMsgGrpEmergEnd::GetTypeId ());
+  RegisterCallMsg (McpttCallMsgGrpEmergAlert::CODE, McpttCallMsgGrpEmergAlert::GetTypeId ());
+  RegisterCallMsg (McpttCallMsgGrpEmergAlertAck::CODE, McpttCallMsgGrpEmergAlertAck::GetTypeId ());
+  RegisterCallMsg (McpttCallMsgGrpEmergAlertCancel::CODE, McpttCallMsgGrpEmergAlertCancel::GetTypeId ());
+  RegisterCallMsg (McpttCallMsgGrpEmergAlertCancelAck::CODE, McpttCallMsgGrpEmergAlertCancelAck::GetTypeId ());
+  RegisterCallMsg (McpttCallMsgGrpBroadcast::CODE, McpttCallMsgGrpBroadcast::GetTypeId ());
+  RegisterCallMsg (McpttCallMsgGrpBroadcastEnd::CODE, McpttCallMsgGrpBroadcastEnd::GetTypeId ());
+  RegisterCallMsg (McpttCallMsgPrivateSetupReq::CODE, McpttCallMsgPrivateSetupReq::GetTypeId ());
+  RegisterCallMsg (McpttCallMsgPrivateRinging::CODE, McpttCallMsgPrivateRinging::GetTypeId ());
+  RegisterCallMsg (McpttCallMsgPrivateAccept::CODE, McpttCallMsgPrivateAccept::GetTypeId ());
+  RegisterCallMsg (McpttCallMsgPrivateReject::CODE, McpttCallMsgPrivateReject::GetTypeId ());
+  RegisterCallMsg (McpttCallMsgPrivateRelease::CODE, McpttCallMsgPrivateRelease::GetTypeId ());
+  RegisterCallMsg (McpttCallMsgPrivateReleaseAck::CODE, McpttCallMsgPrivateReleaseAck::GetTypeId ());
+  RegisterCallMsg (McpttCallMsgPrivateAcceptAck::CODE, McpttCallMsgPrivateAcceptAck::GetTypeId ());
+  RegisterCallMsg (McpttCallMsgPrivateEmergCancel::CODE, McpttCallMsgPrivateEmergCancel::GetTypeId ());
+  RegisterCallMsg (McpttCallMsgPrivateEmergCancelAck::CODE, McpttCallMsgPrivateEmergCancelAck::GetTypeId ());
 }
 
 McpttPttApp::~McpttPttApp (void)
@@ -418,6 +439,22 @@ McpttPttApp::Receive (const McpttCallMsg& msg)
     }
 }
 
+void
+McpttPttApp::RegisterCallMsg (uint8_t code, const TypeId& msgTypeId)
+{
+  NS_LOG_FUNCTION (this << (uint32_t)code << msgTypeId);
+
+  RegisterCallMsg (code, msgTypeId, MakeCallback (&McpttPttApp::Receive, this));
+}
+
+void
+McpttPttApp::RegisterCallMsg (uint8_t code, const TypeId& msgTypeId, const Callback<void, const McpttCallMsg&>& handler)
+{
+  NS_LOG_FUNCTION (this << (uint32_t)code << msgTypeId);
+
+  m_callMsgDispatcher.Register (code, msgTypeId, handler);
+}
+
 void
 McpttPttApp::SelectCall (uint32_t callIdx)
 {
@@ -640,133 +677,11 @@ McpttPttApp::ReceiveCallPkt (Ptr<Packet>  pkt)
 
   NS_LOG_LOGIC (Simulator::Now ().GetSeconds () << "s: PttApp receieved " << pkt->GetSize () << " byte(s).");
 
-  McpttCallMsg temp;
-  pkt->PeekHeader (temp);
+  // the first byte of a call control message is its type
+  uint8_t code = 0;
+  NS_ABORT_MSG_IF (pkt->CopyData (&code, 1) != 1, "Received an empty call control packet.");
 
-  McpttCallMsgFieldMsgType msgType = temp.GetMsgType ();
-  uint8_t code = msgType.GetType ();
-
-  if (code == McpttCallMsgGrpProbe::CODE)
-    {
-      McpttCallMsgGrpProbe probeMsg;
-      pkt->RemoveHeader (probeMsg);
-      Receive (probeMsg);
-    }
-  else if (code == McpttCallMsgGrpAnnoun::CODE)
-    {
-      McpttCallMsgGrpAnnoun grpAnnounMsg;
-      pkt->RemoveHeader (grpAnnounMsg);
-      Receive (grpAnnounMsg);
-    }
-  else if (code == McpttCallMsgGrpAccept::CODE)
-    {
-      McpttCallMsgGrpAccept grpAcceptMsg;
-      pkt->RemoveHeader (grpAcceptMsg);
-      Receive (grpAcceptMsg);
-    }
-  else if (code == McpttCallMsgGrpImmPerilEnd::CODE)
-    {
-      McpttCallMsgGrpImmPerilEnd grpImmPerilEndMsg;
-      pkt->RemoveHeader (grpImmPerilEndMsg);
-      Receive (grpImmPerilEndMsg);
-    }
-  else if (code == McpttCallMsgGrpEmergEnd::CODE)
-    {
-      McpttCallMsgGrpEmergEnd grpEmergEndMsg;
-      pkt->RemoveHeader (grpEmergEndMsg);
-      Receive (grpEmergEndMsg);
-    }
-  else if (code == McpttCallMsgGrpEmergAlert::CODE)
-    {
-      McpttCallMsgGrpEmergAlert grpEmergAlertMsg;
-      pkt->RemoveHeader (grpEmergAlertMsg);
-      Receive (grpEmergAlertMsg);
-    }
-  else if (code == McpttCallMsgGrpEmergAlertAck::CODE)
-    {
-      McpttCallMsgGrpEmergAlertAck grpEmergAlertAckMsg;
-      pkt->RemoveHeader (grpEmergAlertAckMsg);
-      Receive (grpEmergAlertAckMsg);
-    }
-  else if (code == McpttCallMsgGrpEmergAlertCancel::CODE)
-    {
-      McpttCallMsgGrpEmergAlertCancel grpEmergAlertCancelMsg;
-      pkt->RemoveHeader (grpEmergAlertCancelMsg);
-      Receive (grpEmergAlertCancelMsg);
-    }
-  else if (code == McpttCallMsgGrpEmergAlertCancelAck::CODE)
-    {
-      McpttCallMsgGrpEmergAlertCancelAck emergAlertCancelAckMsg;
-      pkt->RemoveHeader (emergAlertCancelAckMsg);
-      Receive (emergAlertCancelAckMsg);
-    }
-  else if (code == McpttCallMsgGrpBroadcast::CODE)
-    {
-      McpttCallMsgGrpBroadcast grpBroadcastMsg;
-      pkt->RemoveHeader (grpBroadcastMsg);
-      Receive (grpBroadcastMsg);
-    }
-  else if (code == McpttCallMsgGrpBroadcastEnd::CODE)
-    {
-      McpttCallMsgGrpBroadcastEnd grpBroadcastEndMsg;
-      pkt->RemoveHeader (grpBroadcastEndMsg);
-      Receive (grpBroadcastEndMsg);
-    }
-  else if (code == McpttCallMsgPrivateSetupReq::CODE)
-    {
-      McpttCallMsgPrivateSetupReq privateSetupReqMsg;
-      pkt->RemoveHeader (privateSetupReqMsg);
-      Receive (privateSetupReqMsg);
-    }
-  else if (code == McpttCallMsgPrivateRinging::CODE)
-    {
-      McpttCallMsgPrivateRinging privateRingingMsg;
-      pkt->RemoveHeader (privateRingingMsg);
-      Receive (privateRingingMsg);
-    }
-  else if (code == McpttCallMsgPrivateAccept::CODE)
-    {
-      McpttCallMsgPrivateAccept privateAcceptMsg;
-      pkt->RemoveHeader (privateAcceptMsg);
-      Receive (privateAcceptMsg);
-    }
-  else if (code == McpttCallMsgPrivateReject::CODE)
-    {
-      McpttCallMsgPrivateReject privateRejectMsg;
-      pkt->RemoveHeader (privateRejectMsg);
-      Receive (privateRejectMsg);
-    }
-  else if (code == McpttCallMsgPrivateRelease::CODE)
-    {
-      McpttCallMsgPrivateRelease privateReleaseMsg;
-      pkt->RemoveHeader (privateReleaseMsg);
-      Receive (privateReleaseMsg);
-    }
-  else if (code == McpttCallMsgPrivateReleaseAck::CODE)
-    {
-      McpttCallMsgPrivateReleaseAck privateReleaseAckMsg;
-      pkt->RemoveHeader (privateReleaseAckMsg);
-      Receive (privateReleaseAckMsg);
-    }
-  else if (code == McpttCallMsgPrivateAcceptAck::CODE)
-    {
-      McpttCallMsgPrivateAcceptAck privateAcceptAckMsg;
-      pkt->RemoveHeader (privateAcceptAckMsg);
-      Receive (privateAcceptAckMsg);
-    }
-  else if (code == McpttCallMsgPrivateEmergCancel::CODE)
-    {
-      McpttCallMsgPrivateEmergCancel privateEmergCancelMsg;
-      pkt->RemoveHeader (privateEmergCancelMsg);
-      Receive (privateEmergCancelMsg);
-    }
-  else if (code == McpttCallMsgPrivateEmergCancelAck::CODE)
-    {
-      McpttCallMsgPrivateEmergCancelAck privateEmergCancelAckMsg;
-      pkt->RemoveHeader (privateEmergCancelAckMsg);
-      Receive (privateEmergCancelAckMsg);
-    }
-  else
+  if (!m_callMsgDispatcher.Dispatch (code, pkt))
     {
       NS_FATAL_ERROR ("Could not resolve message code = " << (uint32_t)code << ".");
     }
@@ -46,6 +46,7 @@
 #include "mcptt-call-msg.h"
 #include "mcptt-chan.h"
 #include "mcptt-media-sink.h"
+#include "mcptt-msg-dispatcher.h"
 #include "mcptt-pushable.h"
 #include "mcptt-pusher.h"
 #include "mcptt-media-src.h"
@@ -183,6 +184,22 @@ public:
   * \param msg The message that was received.
   */
  virtual void Receive (const McpttCallMsg& msg);
+ /**
+  * Registers the type of the call control messages with a given code, which
+  * are then passed to the Receive function when received.
+  * \param code The message type code.
+  * \param msgTypeId The type ID of the message class.
+  */
+ virtual void RegisterCallMsg (uint8_t code, const TypeId& msgTypeId);
+ /**
+  * Registers the type of the call control messages with a given code, and
+  * the handler of the received messages, replacing the previous
+  * registration of the code.
+  * \param code The message type code.
+  * \param msgTypeId The type ID of the message class.
+  * \param handler The handler of the received messages.
+  */
+ virtual void RegisterCallMsg (uint8_t code, const TypeId& msgTypeId, const Callback<void, const McpttCallMsg&>& handler);
  /**
   * Selects a call.
   * \param callIdx The index of the call.
@@ -259,6 +276,7 @@ private:
  static uint16_t s_portNumber; //!< A port number.
  uint16_t m_callPort; //!< The port on which call control messages will flow.
  Ptr<McpttChan> m_callChan; //!< The channel for call control messages.
+ McpttMsgDispatcher<McpttCallMsg> m_callMsgDispatcher; //!< The dispatch table of the received call control messages.
  std::vector<Ptr<McpttCall> > m_calls; //!< The collection of calls.
  Callback<void> m_floorGrantedCb; //!< The floor granted callback.
  Ipv4Address m_localAddress; //!< The local IP address.
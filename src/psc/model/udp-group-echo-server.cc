@@ -124,20 +124,14 @@ UdpGroupEchoServer::~UdpGroupEchoServer ()
 void
 UdpGroupEchoServer::AddClient (const Address& address)
 {
-  UdpGroupEchoClient src_client;
-  std::ostringstream os;
-  InetSocketAddress clientAddress = InetSocketAddress::ConvertFrom (address);
+  NS_LOG_FUNCTION (this << address);
 
-  os << clientAddress.GetIpv4 () << ":" << clientAddress.GetPort ();
-  std::string ipaddrskey = os.str ();
+  UpdateClient (address);
 
-  src_client.m_address = address;
-  src_client.m_echo_address = InetSocketAddress (clientAddress.GetIpv4 (), m_port_client);
-  src_client.m_timestamp = Simulator::Now ();
-
-  m_clients[ipaddrskey] = src_client;
-
-  LogClients ();
+  if (g_log.IsEnabled (LOG_INFO))
+    {
+      LogClients ();
+    }
 }
 
 void
@@ -221,12 +215,7 @@ UdpGroupEchoServer::HandleRead (Ptr<Socket> socket)
   NS_LOG_FUNCTION (this << socket);
 
   Ptr<Packet> packet;
-  Address from, echo_address;
-  std::map<std::string, UdpGroupEchoClient>::iterator it, tempit;
-  std::string ipaddrskey;
-  std::ostringstream os;
-  UdpGroupEchoClient src_client;
-  Time lapse;
+  Address from;
 
   while ((packet = socket->RecvFrom (from)))
     {
@@ -236,25 +225,17 @@ UdpGroupEchoServer::HandleRead (Ptr<Socket> socket)
           NS_LOG_INFO (Simulator::Now ().GetSeconds () << " server received " << packet->GetSize () << " bytes from " <<
                        InetSocketAddress::ConvertFrom (from).GetIpv4 () << " port " <<
                        InetSocketAddress::ConvertFrom (from).GetPort ());
-
-          os << InetSocketAddress::ConvertFrom (from).GetIpv4 () << ":" << InetSocketAddress::ConvertFrom (from).GetPort ();
-
-          InetSocketAddress inet_addrs = InetSocketAddress::ConvertFrom (from);
-          inet_addrs.SetPort (m_port_client);
-          echo_address = inet_addrs;
         }
       else if (Inet6SocketAddress::IsMatchingType (from))
         {
           NS_LOG_INFO (Simulator::Now ().GetSeconds () << " server received " << packet->GetSize () << " bytes from " <<
                        Inet6SocketAddress::ConvertFrom (from).GetIpv6 () << " port " <<
                        Inet6SocketAddress::ConvertFrom (from).GetPort ());
-          os << Inet6SocketAddress::ConvertFrom (from).GetIpv6 () << ":" << Inet6SocketAddress::ConvertFrom (from).GetPort ();
-
-          Inet6SocketAddress inet6_addrs = Inet6SocketAddress::ConvertFrom (from);
-          inet6_addrs.SetPort (m_port_client);
-          echo_address = inet6_addrs;
         }
-
+      else
+        {
+          continue;
+        }
 
       packet->RemoveAllPacketTags ();
       packet->RemoveAllByteTags ();
@@ -263,200 +244,187 @@ UdpGroupEchoServer::HandleRead (Ptr<Socket> socket)
        * If exist, update timestamp. Else, add client to group with new timestamp.
        * Echo packet.
        */
-
-      ipaddrskey = os.str ();
-
-      it = m_clients.find (ipaddrskey);
-      if (it != m_clients.end ())
-        {
-          // Client is a group member. Udate timestamp.
-          NS_LOG_DEBUG ("Client found; old timestamp: " << it->second.m_timestamp.GetSeconds ());
-          it->second.m_timestamp = Simulator::Now ();
-          NS_LOG_DEBUG ("New timestamp: " << it->second.m_timestamp.GetSeconds ());
-        }
-      else // Add client to group
-        {
-          src_client.m_address = from;
-          src_client.m_echo_address = echo_address;
-          src_client.m_timestamp = Simulator::Now ();
-          m_clients[ipaddrskey] = src_client;
-        }
+      UdpGroupEchoClientKey key = UpdateClient (from);
 
       if (g_log.IsEnabled (LOG_DEBUG))
         {
           LogClients ();
         }
 
-      /* Echoing packet to group.
-       * Iterate through all the clients, check timestamp.
-       * If timestamp has expired, remove client.
-       * Else, echo/fwd packet to client.*/
-
       /* m_mode == INF_SESSION      : Server serves group clients indefinitely
        * m_mode == NO_GROUP_SESSION : Server behaves as single echo-client (no group echo)
        * m_mode == TIMEOUT_LIMITED  : Server group echo clients that have been active within
        *                 the m_timeout elapsed time.
        */
-      Address addrs_dest;
       if (m_mode == INF_SESSION)
         {
-          // Server serves group clients indefinitely.
-          for (it = m_clients.begin ();
-               it != m_clients.end (); ++it)
-            {
-              // If no echo back to client, neglect client source
-              if (!m_echoClient && it->first == ipaddrskey)
-                {
-                  continue;
-                }
-
-              // Check elapsed time
-              lapse = Simulator::Now () - it->second.m_timestamp;
-
-              // Set destination address with the agreed client port.
-              if (m_port_client != 0)
-                {
-                  addrs_dest = it->second.m_echo_address;
-                }
-              else
-                {
-                  addrs_dest = it->second.m_address;
-                }
-
-              // Forward packet
-              NS_LOG_LOGIC ("Echoing packet");
-              socket->SendTo (packet, 0, addrs_dest);
-
-              if (InetSocketAddress::IsMatchingType (addrs_dest))
-                {
-                  NS_LOG_INFO (Simulator::Now ().GetSeconds ()
-                               << " server sent "
-                               << packet->GetSize ()
-                               << " bytes to "
-                               << InetSocketAddress::ConvertFrom (addrs_dest).GetIpv4 ()
-                               << " port "
-                               << InetSocketAddress::ConvertFrom (addrs_dest).GetPort ());
-                }
-              else if (Inet6SocketAddress::IsMatchingType (addrs_dest))
-                {
-                  NS_LOG_INFO (Simulator::Now ().GetSeconds ()
-                               << " server sent "
-                               << packet->GetSize ()
-                               << " bytes to "
-                               << Inet6SocketAddress::ConvertFrom (addrs_dest).GetIpv6 ()
-                               << " port "
-                               << Inet6SocketAddress::ConvertFrom (addrs_dest).GetPort ());
-                }
-            }
+          SendToClients (socket, packet, key, !m_echoClient);
         }
       else if (m_mode == NO_GROUP_SESSION)
         {
           // Only one client allowed in group.
-          it = m_clients.find (ipaddrskey);
+          std::unordered_map<UdpGroupEchoClientKey, ClientList::iterator, UdpGroupEchoClientKeyHash>::iterator it = m_clientIndex.find (key);
           if (m_echoClient)
             {
-              // Set destination address with the agreed client port.
-              if (m_port_client != 0)
-                {
-                  addrs_dest = it->second.m_echo_address;
-                }
-              else
-                {
-                  addrs_dest = it->second.m_address;
-                }
-
-              // Forward packet
-              NS_LOG_LOGIC ("Echoing packet");
-              socket->SendTo (packet, 0, addrs_dest);
-
-              if (InetSocketAddress::IsMatchingType (addrs_dest))
-                {
-                  NS_LOG_INFO (Simulator::Now ().GetSeconds ()
-                               << " server sent "
-                               << packet->GetSize ()
-                               << " bytes to "
-                               << InetSocketAddress::ConvertFrom (addrs_dest).GetIpv4 ()
-                               << " port "
-                               << InetSocketAddress::ConvertFrom (addrs_dest).GetPort ());
-                }
-              else if (Inet6SocketAddress::IsMatchingType (addrs_dest))
-                {
-                  NS_LOG_INFO (Simulator::Now ().GetSeconds ()
-                               << " server sent "
-                               << packet->GetSize ()
-                               << " bytes to "
-                               << Inet6SocketAddress::ConvertFrom (addrs_dest).GetIpv6 ()
-                               << " port "
-                               << Inet6SocketAddress::ConvertFrom (addrs_dest).GetPort ());
-                }
+              SendToClient (socket, packet, it->second->second);
             }
           // Remove client
-          m_clients.erase (it);
+          m_clients.erase (it->second);
+          m_clientIndex.erase (it);
         }
       else //if (m_mode == TIMEOUT_LIMITED)
         {
-          for (it = m_clients.begin ();
-               it != m_clients.end (); ++it)
-            {
-              // If no echo back, neglect client source
-              if (!m_echoClient && it->first == ipaddrskey)
-                {
-                  continue;
-                }
-
-              // Check elapsed time
-              lapse = Simulator::Now () - it->second.m_timestamp;
-
-              if (lapse < m_timeout)
-                {
-                  // Set destination address with the agreed client port.
-                  if (m_port_client != 0)
-                    {
-                      addrs_dest = it->second.m_echo_address;
-                    }
-                  else
-                    {
-                      addrs_dest = it->second.m_address;
-                    }
-
-                  // Forward packet
-                  NS_LOG_LOGIC ("Echoing packet");
-                  socket->SendTo (packet, 0, addrs_dest);
-
-
-                  if (InetSocketAddress::IsMatchingType (addrs_dest))
-                    {
-                      NS_LOG_INFO (Simulator::Now ().GetSeconds ()
-                                   << " server sent "
-                                   << packet->GetSize ()
-                                   << " bytes to "
-                                   << InetSocketAddress::ConvertFrom (addrs_dest).GetIpv4 ()
-                                   << " port "
-                                   << InetSocketAddress::ConvertFrom (addrs_dest).GetPort ());
-                    }
-                  else if (Inet6SocketAddress::IsMatchingType (addrs_dest))
-                    {
-                      NS_LOG_INFO (Simulator::Now ().GetSeconds ()
-                                   << " server sent "
-                                   << packet->GetSize ()
-                                   << " bytes to "
-                                   << Inet6SocketAddress::ConvertFrom (addrs_dest).GetIpv6 ()
-                                   << " port "
-                                   << Inet6SocketAddress::ConvertFrom (addrs_dest).GetPort ());
-                    }
-                }
-              else // Time has expired. Remove client.
-                {
-                  //NS_LOG_INFO ("At time " << Simulator::Now ().GetSeconds () <<" client " << it->first << " session time expired! ");
-                  tempit = it;
-                  --it;
-                  m_clients.erase (tempit);
-                }
-            }
-        } //end for
+          RemoveExpiredClients ();
+          SendToClients (socket, packet, key, !m_echoClient);
+        }
     } //end while
 }
 
+UdpGroupEchoClientKey
+UdpGroupEchoClientKey::FromAddress (const Address& address)
+{
+  UdpGroupEchoClientKey key;
+  if (Inet6SocketAddress::IsMatchingType (address))
+    {
+      Inet6SocketAddress inet6Address = Inet6SocketAddress::ConvertFrom (address);
+      uint8_t buf[16];
+      inet6Address.GetIpv6 ().GetBytes (buf);
+      key.m_high = 0;
+      key.m_low = 0;
+      for (uint32_t i = 0; i < 8; i++)
+        {
+          key.m_high = (key.m_high << 8) | buf[i];
+          key.m_low = (key.m_low << 8) | buf[i + 8];
+        }
+      key.m_port = inet6Address.GetPort () | (1 << 16);
+    }
+  else
+    {
+      InetSocketAddress inetAddress = InetSocketAddress::ConvertFrom (address);
+      key.m_high = 0;
+      key.m_low = inetAddress.GetIpv4 ().Get ();
+      key.m_port = inetAddress.GetPort ();
+    }
+  return key;
+}
+
+bool
+UdpGroupEchoClientKey::operator== (const UdpGroupEchoClientKey& other) const
+{
+  return m_high == other.m_high && m_low == other.m_low && m_port == other.m_port;
+}
+
+std::size_t
+UdpGroupEchoClientKeyHash::operator() (const UdpGroupEchoClientKey& key) const
+{
+  // Mix the words (64-bit FNV prime and golden ratio constants)
+  uint64_t h = key.m_high * 0x100000001b3ULL;
+  h = (h ^ key.m_low) * 0x9e3779b97f4a7c15ULL;
+  h = (h ^ key.m_port) * 0x9e3779b97f4a7c15ULL;
+  return static_cast<std::size_t> (h ^ (h >> 32));
+}
+
+UdpGroupEchoClientKey
+UdpGroupEchoServer::UpdateClient (const Address& address)
+{
+  NS_LOG_FUNCTION (this << address);
+
+  UdpGroupEchoClientKey key = UdpGroupEchoClientKey::FromAddress (address);
+  std::unordered_map<UdpGroupEchoClientKey, ClientList::iterator, UdpGroupEchoClientKeyHash>::iterator it = m_clientIndex.find (key);
+  if (it != m_clientIndex.end ())
+    {
+      // Client is a group member. Update timestamp and move it to the back.
+      UdpGroupEchoClient& client = it->second->second;
+      NS_LOG_DEBUG ("Client found; old timestamp: " << client.m_timestamp.GetSeconds ());
+      client.m_timestamp = Simulator::Now ();
+      NS_LOG_DEBUG ("New timestamp: " << client.m_timestamp.GetSeconds ());
+      m_clients.splice (m_clients.end (), m_clients, it->second);
+    }
+  else // Add client to group
+    {
+      UdpGroupEchoClient client;
+      client.m_address = address;
+      if (Inet6SocketAddress::IsMatchingType (address))
+        {
+          Inet6SocketAddress inet6Address = Inet6SocketAddress::ConvertFrom (address);
+          inet6Address.SetPort (m_port_client);
+          client.m_echo_address = inet6Address;
+        }
+      else
+        {
+          InetSocketAddress inetAddress = InetSocketAddress::ConvertFrom (address);
+          inetAddress.SetPort (m_port_client);
+          client.m_echo_address = inetAddress;
+        }
+      client.m_timestamp = Simulator::Now ();
+      m_clientIndex[key] = m_clients.insert (m_clients.end (), std::make_pair (key, client));
+    }
+  return key;
+}
+
+void
+UdpGroupEchoServer::RemoveExpiredClients (void)
+{
+  NS_LOG_FUNCTION (this);
+
+  // The list is ordered by timestamp, stop at the first active client
+  Time now = Simulator::Now ();
+  while (!m_clients.empty () && now - m_clients.front ().second.m_timestamp >= m_timeout)
+    {
+      NS_LOG_DEBUG ("Client session expired, last heard at " << m_clients.front ().second.m_timestamp.GetSeconds ());
+      m_clientIndex.erase (m_clients.front ().first);
+      m_clients.pop_front ();
+    }
+}
+
+void
+UdpGroupEchoServer::SendToClients (Ptr<Socket> socket, Ptr<Packet> packet, const UdpGroupEchoClientKey& skip, bool skipClient)
+{
+  NS_LOG_FUNCTION (this << socket << packet << skipClient);
+
+  for (ClientList::const_iterator it = m_clients.begin (); it != m_clients.end (); ++it)
+    {
+      // If no echo back to client, neglect client source
+      if (skipClient && it->first == skip)
+        {
+          continue;
+        }
+      SendToClient (socket, packet, it->second);
+    }
+}
+
+void
+UdpGroupEchoServer::SendToClient (Ptr<Socket> socket, Ptr<Packet> packet, const UdpGroupEchoClient& client)
+{
+  // Set destination address with the agreed client port.
+  const Address& dest = (m_port_client != 0) ? client.m_echo_address : client.m_address;
+
+  // Forward packet; the socket copies it before adding its headers
+  NS_LOG_LOGIC ("Echoing packet");
+  socket->SendTo (packet, 0, dest);
+
+  if (InetSocketAddress::IsMatchingType (dest))
+    {
+      NS_LOG_INFO (Simulator::Now ().GetSeconds ()
+                   << " server sent "
+                   << packet->GetSize ()
+                   << " bytes to "
+                   << InetSocketAddress::ConvertFrom (dest).GetIpv4 ()
+                   << " port "
+                   << InetSocketAddress::ConvertFrom (dest).GetPort ());
+    }
+  else if (Inet6SocketAddress::IsMatchingType (dest))
+    {
+      NS_LOG_INFO (Simulator::Now ().GetSeconds ()
+                   << " server sent "
+                   << packet->GetSize ()
+                   << " bytes to "
+                   << Inet6SocketAddress::ConvertFrom (dest).GetIpv6 ()
+                   << " port "
+                   << Inet6SocketAddress::ConvertFrom (dest).GetPort ());
+    }
+}
+
 void
 UdpGroupEchoServer::LogClients (void)
 {
@@ -471,19 +439,30 @@ UdpGroupEchoServer::LogClients (void)
       NS_LOG_INFO (std::setfill ('-') << std::setw (57) << "-" << std::setfill (' '));
       NS_LOG_INFO (std::setw (23) << "Client  " << std::setw (10) << "Session");
       NS_LOG_INFO (std::setfill ('-') << std::setw (57) << "-" << std::setfill (' '));
-      for (std::map<std::string, UdpGroupEchoClient>::iterator it = m_clients.begin ();
+      for (ClientList::const_iterator it = m_clients.begin ();
            it != m_clients.end (); ++it)
         {
+          std::ostringstream os;
+          if (InetSocketAddress::IsMatchingType (it->second.m_address))
+            {
+              os << InetSocketAddress::ConvertFrom (it->second.m_address).GetIpv4 () << ":"
+                 << InetSocketAddress::ConvertFrom (it->second.m_address).GetPort ();
+            }
+          else
+            {
+              os << Inet6SocketAddress::ConvertFrom (it->second.m_address).GetIpv6 () << ":"
+                 << Inet6SocketAddress::ConvertFrom (it->second.m_address).GetPort ();
+            }
           lapse = tstamp - it->second.m_timestamp;
           if (m_mode == INF_SESSION
               || m_mode == NO_GROUP_SESSION
               || (m_mode == TIMEOUT_LIMITED && lapse < m_timeout))
             {
-              NS_LOG_INFO (std::setw (23) << it->first << " " << std::setw (10) << lapse.GetSeconds ());
+              NS_LOG_INFO (std::setw (23) << os.str () << " " << std::setw (10) << lapse.GetSeconds ());
             }
           else
             {
-              NS_LOG_INFO (std::setw (23) << it->first << " " << std::setw (10) << lapse.GetSeconds () << " **Session Expired!**");
+              NS_LOG_INFO (std::setw (23) << os.str () << " " << std::setw (10) << lapse.GetSeconds () << " **Session Expired!**");
             }
         }
       NS_LOG_INFO (std::setfill ('=') << std::setw (57) << "=" << std::setfill (' '));
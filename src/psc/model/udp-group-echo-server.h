@@ -29,8 +29,9 @@
 #include "ns3/address.h"
 #include "ns3/nstime.h"
 #include "ns3/traced-callback.h"
-#include <map>
+#include <list>
 #include <string>
+#include <unordered_map>
 
 namespace ns3 {
 
@@ -49,6 +50,41 @@ struct UdpGroupEchoClient
   Time m_timestamp; //!< Last time the server heard from the client
 };
 
+/**
+ * Key of a client of the UdpGroupEchoServer, i.e., its IP address and port
+ * packed in integers
+ */
+struct UdpGroupEchoClientKey
+{
+  uint64_t m_high; //!< The first 8 bytes of an IPv6 address, or 0
+  uint64_t m_low; //!< The last 8 bytes of an IPv6 address, or an IPv4 address
+  uint32_t m_port; //!< The port, with bit 16 set for an IPv6 address
+
+  /**
+   * Create the key of a client
+   * \param address The address of the client, an InetSocketAddress or an Inet6SocketAddress
+   * \return The key
+   */
+  static UdpGroupEchoClientKey FromAddress (const Address& address);
+  /**
+   * \param other The other key
+   * \return True if both keys are equal
+   */
+  bool operator== (const UdpGroupEchoClientKey& other) const;
+};
+
+/**
+ * Hash function of the UdpGroupEchoClientKey
+ */
+struct UdpGroupEchoClientKeyHash
+{
+  /**
+   * \param key The key
+   * \return The hash of the key
+   */
+  std::size_t operator() (const UdpGroupEchoClientKey& key) const;
+};
+
 /**
  * \defgroup psc Public Safety Communications
  */
@@ -58,6 +94,11 @@ struct UdpGroupEchoClient
  * \brief A Udp Group Echo server
  *
  * Every packet received is sent back to active group members.
+ *
+ * The clients are looked up in a hash table keyed by their address and
+ * port, and kept in a list ordered by the last time the server heard from
+ * them, so that the expired clients are removed from the front of the list
+ * when a packet is received, without checking every client.
  */
 class UdpGroupEchoServer : public Application
 {
@@ -109,6 +150,35 @@ private:
    *
    */
   void LogClients (void);
+  /**
+   * Add a client or update its timestamp, moving it to the back of the
+   * list of clients
+   * \param address The address of the client
+   * \return The key of the client
+   */
+  UdpGroupEchoClientKey UpdateClient (const Address& address);
+  /**
+   * Remove the clients whose session expired
+   */
+  void RemoveExpiredClients (void);
+  /**
+   * Send a packet to all the clients, in the order of the list
+   * \param socket The socket to use
+   * \param packet The packet
+   * \param skip The client to skip, if skipClient is true
+   * \param skipClient True to skip a client
+   */
+  void SendToClients (Ptr<Socket> socket, Ptr<Packet> packet, const UdpGroupEchoClientKey& skip, bool skipClient);
+  /**
+   * Send a packet to a client
+   * \param socket The socket to use
+   * \param packet The packet
+   * \param client The client
+   */
+  void SendToClient (Ptr<Socket> socket, Ptr<Packet> packet, const UdpGroupEchoClient& client);
+
+  /// The list of clients, ordered by timestamp
+  typedef std::list<std::pair<UdpGroupEchoClientKey, UdpGroupEchoClient> > ClientList;
 
   Mode_t m_mode; ///< Mode of echo operation
   uint16_t m_port; ///< Port on which we listen for incoming packets.
@@ -116,7 +186,8 @@ private:
   Ptr<Socket> m_socket; ///< IPv4 Socket
   Ptr<Socket> m_socket6; ///< IPv6 Socket
   Address m_local; ///< local multicast address
-  std::map<std::string, UdpGroupEchoClient> m_clients; ///< Group of clients
+  ClientList m_clients; ///< Group of clients, the least recently heard first
+  std::unordered_map<UdpGroupEchoClientKey, ClientList::iterator, UdpGroupEchoClientKeyHash> m_clientIndex; ///< Clients by key
   Time m_timeout; ///< Inactive client session expiration time
   bool m_echoClient; ///< Set server to echo back to the client.
   TracedCallback<Ptr<const Packet>, const Address &> m_rxTrace; ///< Callbacks for tracing the packet Rx events
@@ -0,0 +1,144 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * NIST-developed software is provided by NIST as a public service. You may
+ * use, copy and distribute copies of the software in any medium, provided that
+ * you keep intact this entire notice. You may improve, modify and create
+ * derivative works of the software or any portion of the software, and you may
+ * copy and distribute such modifications or works. Modified works should carry
+ * a notice stating that you changed the software and should note the date and
+ * nature of any such change. Please explicitly acknowledge the National
+ * Institute of Standards and Technology as the source of the software.
+ * 
+ * NIST-developed software is expressly provided "AS IS." NIST MAKES NO
+ * WARRANTY OF ANY KIND, EXPRESS, IMPLIED, IN FACT OR ARISING BY OPERATION OF
+ * LAW, INCLUDING, WITHOUT LIMITATION, THE IMPLIED WARRANTY OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE, NON-INFRINGEMENT AND DATA ACCURACY. NIST
+ * NEITHER REPRESENTS NOR WARRANTS THAT THE OPERATION OF THE SOFTWARE WILL BE
+ * UNINTERRUPTED OR ERROR-FREE, OR THAT ANY DEFECTS WILL BE CORRECTED. NIST
+ * DOES NOT WARRANT OR MAKE ANY REPRESENTATIONS REGARDING THE USE OF THE
+ * SOFTWARE OR THE RESULTS THEREOF, INCLUDING BUT NOT LIMITED TO THE
+ * CORRECTNESS, ACCURACY, RELIABILITY, OR USEFULNESS OF THE SOFTWARE.
+ * 
+ * You are solely responsible for determining the appropriateness of using and
+ * distributing the software and you assume all risks associated with its use,
+ * including but not limited to the risks and costs of program errors,
+ * compliance with applicable laws, damage to or loss of data, programs or
+ * equipment, and the unavailability or interruption of operation. This
+ * software is not intended to be used in any situation where a failure could
+ * cause risk of injury or damage to property. The software developed by NIST
+ * employees is not subject to copyright protection within the United States.
+ */
+
+#include <vector>
+
+#include <ns3/core-module.h>
+#include <ns3/packet.h>
+
+#include <ns3/mcptt-call-msg.h>
+#include <ns3/mcptt-call-msg-field.h>
+#include <ns3/mcptt-msg-dispatcher.h>
+
+using namespace ns3;
+
+NS_LOG_COMPONENT_DEFINE ("McpttMsgDispatcherTest");
+
+/**
+ * Checks that the messages dispatched with a reused message instance,
+ * including a message received while handling another one, carry the
+ * content of their packet.
+ */
+class McpttMsgDispatcherTest : public TestCase
+{
+public:
+ McpttMsgDispatcherTest (void);
+ virtual void DoRun (void);
+private:
+ /**
+  * Creates a packet holding a group call probe.
+  * \param grpId The group ID of the probe.
+  * \returns The packet.
+  */
+ static Ptr<Packet> CreateProbe (uint32_t grpId);
+ /**
+  * Handles a received probe.
+  * \param msg The probe.
+  */
+ void ReceiveProbe (const McpttCallMsg& msg);
+
+ McpttMsgDispatcher<McpttCallMsg> m_dispatcher; //!< The dispatcher under test.
+ std::vector<uint32_t> m_grpIds; //!< The group IDs of the received probes.
+ Ptr<Packet> m_nested; //!< The packet to dispatch while handling the next probe.
+};
+
+McpttMsgDispatcherTest::McpttMsgDispatcherTest (void)
+  : TestCase ("Message dispatch table")
+{ }
+
+Ptr<Packet>
+McpttMsgDispatcherTest::CreateProbe (uint32_t grpId)
+{
+  McpttCallMsgGrpProbe probe;
+  probe.SetGrpId (McpttCallMsgFieldGrpId (grpId));
+  Ptr<Packet> pkt = Create<Packet> ();
+  pkt->AddHeader (probe);
+  return pkt;
+}
+
+void
+McpttMsgDispatcherTest::ReceiveProbe (const McpttCallMsg& msg)
+{
+  NS_TEST_ASSERT_MSG_EQ (msg.IsA (McpttCallMsgGrpProbe::GetTypeId ()), true, "Unexpected message type.");
+  const McpttCallMsgGrpProbe& probe = dynamic_cast<const McpttCallMsgGrpProbe&> (msg);
+  uint32_t grpId = probe.GetGrpId ().GetGrpId ();
+  if (m_nested != 0)
+    {
+      Ptr<Packet> nested = m_nested;
+      m_nested = 0;
+      m_dispatcher.Dispatch (McpttCallMsgGrpProbe::CODE, nested);
+      NS_TEST_ASSERT_MSG_EQ (probe.GetGrpId ().GetGrpId (), grpId, "The message was overwritten by the nested one.");
+    }
+  m_grpIds.push_back (grpId);
+}
+
+void
+McpttMsgDispatcherTest::DoRun (void)
+{
+  NS_TEST_ASSERT_MSG_EQ (m_dispatcher.IsRegistered (McpttCallMsgGrpProbe::CODE), false, "No code should be registered.");
+  m_dispatcher.Register (McpttCallMsgGrpProbe::CODE, McpttCallMsgGrpProbe::GetTypeId (),
+                         MakeCallback (&McpttMsgDispatcherTest::ReceiveProbe, this));
+  NS_TEST_ASSERT_MSG_EQ (m_dispatcher.IsRegistered (McpttCallMsgGrpProbe::CODE), true, "The code should be registered.");
+
+  NS_TEST_ASSERT_MSG_EQ (m_dispatcher.Dispatch (McpttCallMsgGrpProbe::CODE, CreateProbe (1)), true, "The probe was not dispatched.");
+  NS_TEST_ASSERT_MSG_EQ (m_dispatcher.Dispatch (McpttCallMsgGrpProbe::CODE, CreateProbe (2)), true, "The probe was not dispatched.");
+  m_nested = CreateProbe (4);
+  NS_TEST_ASSERT_MSG_EQ (m_dispatcher.Dispatch (McpttCallMsgGrpProbe::CODE, CreateProbe (3)), true, "The probe was not dispatched.");
+
+  NS_TEST_ASSERT_MSG_EQ (m_grpIds.size (), 4, "Unexpected number of received probes.");
+  NS_TEST_ASSERT_MSG_EQ (m_grpIds[0], 1, "Unexpected group ID.");
+  NS_TEST_ASSERT_MSG_EQ (m_grpIds[1], 2, "Unexpected group ID.");
+  NS_TEST_ASSERT_MSG_EQ (m_grpIds[2], 4, "Unexpected group ID of the nested probe.");
+  NS_TEST_ASSERT_MSG_EQ (m_grpIds[3], 3, "Unexpected group ID.");
+
+  Ptr<Packet> pkt = CreateProbe (5);
+  uint32_t size = pkt->GetSize ();
+  NS_TEST_ASSERT_MSG_EQ (m_dispatcher.Dispatch (McpttCallMsgGrpAnnoun::CODE, pkt), false, "An unregistered code was dispatched.");
+  NS_TEST_ASSERT_MSG_EQ (pkt->GetSize (), size, "The packet of an unregistered code was modified.");
+
+  m_dispatcher.Unregister (McpttCallMsgGrpProbe::CODE);
+  NS_TEST_ASSERT_MSG_EQ (m_dispatcher.Dispatch (McpttCallMsgGrpProbe::CODE, pkt), false, "An unregistered code was dispatched.");
+  NS_TEST_ASSERT_MSG_EQ (m_grpIds.size (), 4, "Unexpected number of received probes.");
+}
+
+class McpttMsgDispatcherTestSuite : public TestSuite
+{
+public:
+ McpttMsgDispatcherTestSuite (void);
+};
+
+McpttMsgDispatcherTestSuite::McpttMsgDispatcherTestSuite (void)
+  : TestSuite ("mcptt-msg-dispatcher", TestSuite::UNIT)
+{
+  AddTestCase (new McpttMsgDispatcherTest (), TestCase::QUICK);
+}
+
+static McpttMsgDispatcherTestSuite suite;
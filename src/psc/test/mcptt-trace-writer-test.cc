@@ -0,0 +1,213 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * NIST-developed software is provided by NIST as a public service. You may
+ * use, copy and distribute copies of the software in any medium, provided that
+ * you keep intact this entire notice. You may improve, modify and create
+ * derivative works of the software or any portion of the software, and you may
+ * copy and distribute such modifications or works. Modified works should carry
+ * a notice stating that you changed the software and should note the date and
+ * nature of any such change. Please explicitly acknowledge the National
+ * Institute of Standards and Technology as the source of the software.
+ * 
+ * NIST-developed software is expressly provided "AS IS." NIST MAKES NO
+ * WARRANTY OF ANY KIND, EXPRESS, IMPLIED, IN FACT OR ARISING BY OPERATION OF
+ * LAW, INCLUDING, WITHOUT LIMITATION, THE IMPLIED WARRANTY OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE, NON-INFRINGEMENT AND DATA ACCURACY. NIST
+ * NEITHER REPRESENTS NOR WARRANTS THAT THE OPERATION OF THE SOFTWARE WILL BE
+ * UNINTERRUPTED OR ERROR-FREE, OR THAT ANY DEFECTS WILL BE CORRECTED. NIST
+ * DOES NOT WARRANT OR MAKE ANY REPRESENTATIONS REGARDING THE USE OF THE
+ * SOFTWARE OR THE RESULTS THEREOF, INCLUDING BUT NOT LIMITED TO THE
+ * CORRECTNESS, ACCURACY, RELIABILITY, OR USEFULNESS OF THE SOFTWARE.
+ * 
+ * You are solely responsible for determining the appropriateness of using and
+ * distributing the software and you assume all risks associated with its use,
+ * including but not limited to the risks and costs of program errors,
+ * compliance with applicable laws, damage to or loss of data, programs or
+ * equipment, and the unavailability or interruption of operation. This
+ * software is not intended to be used in any situation where a failure could
+ * cause risk of injury or damage to property. The software developed by NIST
+ * employees is not subject to copyright protection within the United States.
+ */
+
+#include <fstream>
+#include <sstream>
+#include <string>
+
+#include <ns3/core-module.h>
+
+#include <ns3/mcptt-state-machine-stats.h>
+#include <ns3/mcptt-trace-writer.h>
+
+using namespace ns3;
+
+NS_LOG_COMPONENT_DEFINE ("McpttTraceWriterTest");
+
+/**
+ * Reads the whole content of a file.
+ * \param fileName The name of the file.
+ * \returns The content of the file.
+ */
+static std::string
+ReadFile (const std::string& fileName)
+{
+  std::ifstream file (fileName.c_str ());
+  std::ostringstream content;
+  content << file.rdbuf ();
+  return content.str ();
+}
+
+/**
+ * Checks that the records written with a ring buffer smaller than the
+ * trace are converted back to the expected text.
+ */
+class McpttTraceWriterRoundTripTest : public TestCase
+{
+public:
+ McpttTraceWriterRoundTripTest (void);
+ virtual void DoRun (void);
+};
+
+McpttTraceWriterRoundTripTest::McpttTraceWriterRoundTripTest (void)
+  : TestCase ("Binary trace round trip")
+{ }
+
+void
+McpttTraceWriterRoundTripTest::DoRun (void)
+{
+  std::string fileName = CreateTempDirFilename ("mcptt-trace-writer.bin");
+  std::vector<McpttTraceWriter::Column> columns;
+  columns.push_back ({"time(ms)", McpttTraceWriter::INTEGER});
+  columns.push_back ({"name", McpttTraceWriter::STRING});
+  columns.push_back ({"value", McpttTraceWriter::INTEGER});
+
+  std::ostringstream expected;
+  expected << "time(ms)\tname\tvalue" << std::endl;
+  Ptr<McpttTraceWriter> writer = Create<McpttTraceWriter> (fileName, columns, 3);
+  for (int64_t i = 0; i < 100; i++)
+    {
+      std::string name = "name" + std::to_string (i % 7);
+      McpttTraceWriter::Record record;
+      record.values[0] = i * 10;
+      record.values[1] = writer->Intern (name);
+      record.values[2] = -i;
+      writer->Write (record);
+      expected << i * 10 << "\t" << name << "\t" << -i << std::endl;
+      if (i == 50)
+        {
+          writer->Flush ();
+        }
+    }
+  writer = 0;
+
+  std::ifstream in (fileName.c_str (), std::ios_base::binary);
+  std::ostringstream out;
+  NS_TEST_ASSERT_MSG_EQ (McpttTraceWriter::ConvertToText (in, out), true, "The conversion failed.");
+  NS_TEST_ASSERT_MSG_EQ (out.str (), expected.str (), "The converted trace does not match the records.");
+
+  std::istringstream invalid ("not a trace");
+  std::ostringstream ignored;
+  NS_TEST_ASSERT_MSG_EQ (McpttTraceWriter::ConvertToText (invalid, ignored), false, "An invalid trace was converted.");
+}
+
+/**
+ * Checks that the texts of a trace with a text column are written inline
+ * and converted back to the expected text.
+ */
+class McpttTraceWriterTextTest : public TestCase
+{
+public:
+ McpttTraceWriterTextTest (void);
+ virtual void DoRun (void);
+};
+
+McpttTraceWriterTextTest::McpttTraceWriterTextTest (void)
+  : TestCase ("Binary trace with a text column")
+{ }
+
+void
+McpttTraceWriterTextTest::DoRun (void)
+{
+  std::string fileName = CreateTempDirFilename ("mcptt-trace-writer-text.bin");
+  std::vector<McpttTraceWriter::Column> columns;
+  columns.push_back ({"time(ms)", McpttTraceWriter::INTEGER});
+  columns.push_back ({"content", McpttTraceWriter::TEXT});
+  columns.push_back ({"type", McpttTraceWriter::STRING});
+
+  std::ostringstream expected;
+  expected << "time(ms)\tcontent\ttype" << std::endl;
+  Ptr<McpttTraceWriter> writer = Create<McpttTraceWriter> (fileName, columns, 3);
+  for (int64_t i = 0; i < 100; i++)
+    {
+      std::string content = "(message " + std::to_string (i) + ")";
+      std::string type = i % 2 ? "odd" : "even";
+      McpttTraceWriter::Record record;
+      record.values[0] = i;
+      record.text = content;
+      record.values[2] = writer->Intern (type);
+      writer->Write (record);
+      expected << i << "\t" << content << "\t" << type << std::endl;
+    }
+  writer->Flush ();
+  writer = 0;
+
+  std::ifstream in (fileName.c_str (), std::ios_base::binary);
+  std::ostringstream out;
+  NS_TEST_ASSERT_MSG_EQ (McpttTraceWriter::ConvertToText (in, out), true, "The conversion failed.");
+  NS_TEST_ASSERT_MSG_EQ (out.str (), expected.str (), "The converted trace does not match the records.");
+}
+
+/**
+ * Checks that a binary state machine trace converts to the same text as
+ * the text trace.
+ */
+class McpttTraceWriterStatsTest : public TestCase
+{
+public:
+ McpttTraceWriterStatsTest (void);
+ virtual void DoRun (void);
+};
+
+McpttTraceWriterStatsTest::McpttTraceWriterStatsTest (void)
+  : TestCase ("Binary and text state machine traces")
+{ }
+
+void
+McpttTraceWriterStatsTest::DoRun (void)
+{
+  std::string textFileName = CreateTempDirFilename ("mcptt-state-machine-stats.txt");
+  std::string binaryFileName = CreateTempDirFilename ("mcptt-state-machine-stats.bin");
+  std::string convertedFileName = CreateTempDirFilename ("mcptt-state-machine-stats-converted.txt");
+
+  Ptr<McpttStateMachineStats> textStats = CreateObject<McpttStateMachineStats> ();
+  textStats->SetAttribute ("OutputFileName", StringValue (textFileName));
+  Ptr<McpttStateMachineStats> binaryStats = CreateObject<McpttStateMachineStats> ();
+  binaryStats->SetAttribute ("OutputFileName", StringValue (binaryFileName));
+  binaryStats->SetAttribute ("BinaryOutput", BooleanValue (true));
+
+  const char *states[] = {"'S1: start-stop'", "'S2: waiting for call establishment'", "'S3: part of ongoing call'"};
+  for (uint32_t i = 0; i < 20; i++)
+    {
+      textStats->StateChangeCb (i % 4, i / 4, "ns3::McpttCallMachineGrpBasic", states[i % 3], states[(i + 1) % 3]);
+      binaryStats->StateChangeCb (i % 4, i / 4, "ns3::McpttCallMachineGrpBasic", states[i % 3], states[(i + 1) % 3]);
+    }
+  binaryStats->Dispose ();
+
+  NS_TEST_ASSERT_MSG_EQ (McpttTraceWriter::ConvertToText (binaryFileName, convertedFileName), true, "The conversion failed.");
+  NS_TEST_ASSERT_MSG_EQ (ReadFile (convertedFileName), ReadFile (textFileName), "The converted trace does not match the text trace.");
+}
+
+class McpttTraceWriterTestSuite : public TestSuite
+{
+public:
+ McpttTraceWriterTestSuite (void);
+};
+
+McpttTraceWriterTestSuite::McpttTraceWriterTestSuite (void)
+  : TestSuite ("mcptt-trace-writer", TestSuite::UNIT)
+{
+  AddTestCase (new McpttTraceWriterRoundTripTest (), TestCase::QUICK);
+  AddTestCase (new McpttTraceWriterTextTest (), TestCase::QUICK);
+  AddTestCase (new McpttTraceWriterStatsTest (), TestCase::QUICK);
+}
+
+static McpttTraceWriterTestSuite suite;
@@ -0,0 +1,202 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * NIST-developed software is provided by NIST as a public service. You may use,
+ * copy and distribute copies of the software in any medium, provided that you
+ * keep intact this entire notice. You may improve,modify and create derivative
+ * works of the software or any portion of the software, and you may copy and
+ * distribute such modifications or works. Modified works should carry a notice
+ * stating that you changed the software and should note the date and nature of
+ * any such change. Please explicitly acknowledge the National Institute of
+ * Standards and Technology as the source of the software.
+ *
+ * NIST-developed software is expressly provided "AS IS." NIST MAKES NO
+ * WARRANTY OF ANY KIND, EXPRESS, IMPLIED, IN FACT OR ARISING BY OPERATION OF
+ * LAW, INCLUDING, WITHOUT LIMITATION, THE IMPLIED WARRANTY OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, NON-INFRINGEMENT
+ * AND DATA ACCURACY. NIST NEITHER REPRESENTS NOR WARRANTS THAT THE
+ * OPERATION OF THE SOFTWARE WILL BE UNINTERRUPTED OR ERROR-FREE, OR THAT
+ * ANY DEFECTS WILL BE CORRECTED. NIST DOES NOT WARRANT OR MAKE ANY
+ * REPRESENTATIONS REGARDING THE USE OF THE SOFTWARE OR THE RESULTS THEREOF,
+ * INCLUDING BUT NOT LIMITED TO THE CORRECTNESS, ACCURACY, RELIABILITY,
+ * OR USEFULNESS OF THE SOFTWARE.
+ *
+ * You are solely responsible for determining the appropriateness of using and
+ * distributing the software and you assume all risks associated with its use,
+ * including but not limited to the risks and costs of program errors,
+ * compliance with applicable laws, damage to or loss of data, programs or
+ * equipment, and the unavailability or interruption of operation. This
+ * software is not intended to be used in any situation where a failure could
+ * cause risk of injury or damage to property. The software developed by NIST
+ * employees is not subject to copyright protection within the United States.
+ */
+
+/**
+ * \file udp-group-echo-server-test.cc
+ * \ingroup psc-tests
+ *
+ * UdpGroupEchoServer test suite
+ */
+
+#include <ns3/core-module.h>
+#include <ns3/internet-module.h>
+#include <ns3/point-to-point-module.h>
+#include <ns3/psc-module.h>
+#include <ns3/simulator.h>
+#include <ns3/test.h>
+#include <ns3/log.h>
+#include <algorithm>
+
+NS_LOG_COMPONENT_DEFINE ("UdpGroupEchoServerTestSuite");
+
+namespace ns3 {
+namespace tests {
+
+/**
+ * \ingroup psc-tests
+ *
+ * Checks the group members that a UdpGroupEchoServer echoes a packet to.
+ * Three clients on the same node send a packet each, one second apart,
+ * then the first client sends a second packet.
+ */
+class UdpGroupEchoServerTestCase : public TestCase
+{
+public:
+  /**
+   * Constructor
+   * \param name The name of the test case
+   * \param mode The mode of the server
+   * \param echoClient True if the server echoes back to the sending client
+   * \param expected The number of packets expected by each client
+   */
+  UdpGroupEchoServerTestCase (const std::string &name, psc::UdpGroupEchoServer::Mode_t mode,
+                              bool echoClient, const std::vector<uint32_t> &expected);
+
+private:
+  virtual void DoRun (void);
+  /**
+   * Receive the packets echoed to a client
+   * \param socket The socket of the client
+   */
+  void Receive (Ptr<Socket> socket);
+  /**
+   * Send a packet from a client to the server
+   * \param index The index of the client
+   */
+  void Send (uint32_t index);
+
+  psc::UdpGroupEchoServer::Mode_t m_mode; ///< The mode of the server
+  bool m_echoClient; ///< True if the server echoes back to the sending client
+  std::vector<uint32_t> m_expected; ///< The number of packets expected by each client
+  std::vector<uint32_t> m_received; ///< The number of packets received by each client
+  std::vector<Ptr<Socket> > m_sockets; ///< The sockets of the clients
+  Address m_serverAddress; ///< The address of the server
+};
+
+UdpGroupEchoServerTestCase::UdpGroupEchoServerTestCase (const std::string &name, psc::UdpGroupEchoServer::Mode_t mode,
+                                                        bool echoClient, const std::vector<uint32_t> &expected)
+  : TestCase (name),
+    m_mode (mode),
+    m_echoClient (echoClient),
+    m_expected (expected)
+{
+}
+
+void
+UdpGroupEchoServerTestCase::Receive (Ptr<Socket> socket)
+{
+  uint32_t index = std::find (m_sockets.begin (), m_sockets.end (), socket) - m_sockets.begin ();
+  Ptr<Packet> packet;
+  while ((packet = socket->Recv ()))
+    {
+      m_received[index]++;
+    }
+}
+
+void
+UdpGroupEchoServerTestCase::Send (uint32_t index)
+{
+  m_sockets[index]->SendTo (Create<Packet> (100), 0, m_serverAddress);
+}
+
+void
+UdpGroupEchoServerTestCase::DoRun (void)
+{
+  NodeContainer nodes;
+  nodes.Create (2);
+
+  PointToPointHelper pointToPoint;
+  pointToPoint.SetDeviceAttribute ("DataRate", StringValue ("100Gbps"));
+  pointToPoint.SetChannelAttribute ("Delay", StringValue ("1ms"));
+  NetDeviceContainer devices = pointToPoint.Install (nodes);
+
+  InternetStackHelper stack;
+  stack.Install (nodes);
+
+  Ipv4AddressHelper address;
+  address.SetBase ("10.1.1.0", "255.255.255.0");
+  Ipv4InterfaceContainer interfaces = address.Assign (devices);
+
+  Ptr<psc::UdpGroupEchoServer> server = CreateObject<psc::UdpGroupEchoServer> ();
+  server->SetAttribute ("Port", UintegerValue (9));
+  server->SetAttribute ("Mode", EnumValue (m_mode));
+  server->SetAttribute ("Timeout", TimeValue (Seconds (1.5)));
+  server->SetAttribute ("EchoClient", BooleanValue (m_echoClient));
+  server->SetStartTime (Seconds (0));
+  server->SetStopTime (Seconds (10));
+  nodes.Get (0)->AddApplication (server);
+  m_serverAddress = InetSocketAddress (interfaces.GetAddress (0), 9);
+
+  m_received.assign (m_expected.size (), 0);
+  for (uint32_t i = 0; i < m_expected.size (); i++)
+    {
+      Ptr<Socket> socket = Socket::CreateSocket (nodes.Get (1), UdpSocketFactory::GetTypeId ());
+      socket->Bind (InetSocketAddress (Ipv4Address::GetAny (), 1000 + i));
+      socket->SetRecvCallback (MakeCallback (&UdpGroupEchoServerTestCase::Receive, this));
+      m_sockets.push_back (socket);
+      Simulator::Schedule (Seconds (1 + i), &UdpGroupEchoServerTestCase::Send, this, i);
+    }
+  Simulator::Schedule (Seconds (1 + m_expected.size ()), &UdpGroupEchoServerTestCase::Send, this, 0);
+
+  Simulator::Stop (Seconds (10));
+  Simulator::Run ();
+  Simulator::Destroy ();
+
+  for (uint32_t i = 0; i < m_expected.size (); i++)
+    {
+      NS_TEST_ASSERT_MSG_EQ (m_received[i], m_expected[i], "Unexpected number of packets echoed to client " << i);
+    }
+  m_sockets.clear ();
+}
+
+/**
+ * \ingroup psc-tests
+ *
+ * UdpGroupEchoServer test suite
+ */
+class UdpGroupEchoServerTestSuite : public TestSuite
+{
+public:
+  UdpGroupEchoServerTestSuite ();
+};
+
+UdpGroupEchoServerTestSuite::UdpGroupEchoServerTestSuite ()
+  : TestSuite ("udp-group-echo-server", UNIT)
+{
+  // Client 0 sends at 1 s and 4 s, client 1 at 2 s, and client 2 at 3 s
+  AddTestCase (new UdpGroupEchoServerTestCase ("No group session", psc::UdpGroupEchoServer::NO_GROUP_SESSION,
+                                               true, {2, 1, 1}), TestCase::QUICK);
+  AddTestCase (new UdpGroupEchoServerTestCase ("Infinite session", psc::UdpGroupEchoServer::INF_SESSION,
+                                               true, {4, 3, 2}), TestCase::QUICK);
+  AddTestCase (new UdpGroupEchoServerTestCase ("Infinite session, no echo to the sender", psc::UdpGroupEchoServer::INF_SESSION,
+                                               false, {2, 2, 1}), TestCase::QUICK);
+  // With a timeout of 1.5 s, client 0 expires at 3 s and client 1 at 4 s
+  AddTestCase (new UdpGroupEchoServerTestCase ("Timeout limited session", psc::UdpGroupEchoServer::TIMEOUT_LIMITED,
+                                               true, {3, 2, 2}), TestCase::QUICK);
+  AddTestCase (new UdpGroupEchoServerTestCase ("Timeout limited session, no echo to the sender", psc::UdpGroupEchoServer::TIMEOUT_LIMITED,
+                                               false, {1, 1, 1}), TestCase::QUICK);
+}
+
+static UdpGroupEchoServerTestSuite g_udpGroupEchoServerTestSuite; ///< the test suite
+
+} // namespace tests
+} // namespace ns3
@@ -0,0 +1,498 @@
+/* -*-  Mode: C++; c-file-style: "gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include <algorithm>
+#include <cstring>
+#include <ns3/log.h>
+#include <ns3/abort.h>
+#include <ns3/hash.h>
+#include <ns3/tag.h>
+#include <ns3/tag-buffer.h>
+#include <ns3/half-duplex-ideal-phy-signal-parameters.h>
+#include "distributed-spectrum-signal-codec.h"
+
+namespace ns3 {
+
+NS_LOG_COMPONENT_DEFINE ("DistributedSpectrumSignalCodec");
+
+
+
+/**
+ * \ingroup spectrum
+ *
+ * Codec of HalfDuplexIdealPhySignalParameters, whose only member is the
+ * data packet.
+ */
+class HalfDuplexIdealPhySignalCodec : public DistributedSpectrumSignalCodec
+{
+public:
+  virtual bool CanEncode (Ptr<const SpectrumSignalParameters> params) const
+  {
+    return DynamicCast<const HalfDuplexIdealPhySignalParameters> (params) != 0;
+  }
+  virtual Ptr<Packet> Encode (Ptr<const SpectrumSignalParameters> params) const
+  {
+    return DynamicCast<const HalfDuplexIdealPhySignalParameters> (params)->data->Copy ();
+  }
+  virtual Ptr<SpectrumSignalParameters> Decode (Ptr<Packet> p) const
+  {
+    Ptr<HalfDuplexIdealPhySignalParameters> params = Create<HalfDuplexIdealPhySignalParameters> ();
+    params->data = p;
+    return params;
+  }
+};
+
+DistributedSpectrumSignalCodec::~DistributedSpectrumSignalCodec ()
+{
+}
+
+/**
+ * \param tid the TypeId of a tag
+ * \return a new instance of the tag, to be deleted by the caller
+ */
+static Tag *
+CreateTag (TypeId tid)
+{
+  NS_ABORT_MSG_UNLESS (tid.HasConstructor (), "Tag " << tid.GetName () << " has no constructor");
+  Tag *tag = dynamic_cast<Tag *> (tid.GetConstructor () ());
+  NS_ASSERT (tag != 0);
+  return tag;
+}
+
+/**
+ * Write the contents of a tag to a buffer.
+ *
+ * \param i the buffer iterator
+ * \param tag the tag
+ */
+static void
+WriteTag (Buffer::Iterator &i, const Tag &tag)
+{
+  uint32_t size = tag.GetSerializedSize ();
+  std::vector<uint8_t> data (size);
+  TagBuffer tagBuffer (data.data (), data.data () + size);
+  tag.Serialize (tagBuffer);
+  i.WriteHtonU32 (tag.GetInstanceTypeId ().GetHash ());
+  i.WriteHtonU32 (size);
+  i.Write (data.data (), size);
+}
+
+/**
+ * Read the contents of a tag written by WriteTag from a buffer.
+ *
+ * \param i the buffer iterator
+ * \return a new instance of the tag, to be deleted by the caller
+ */
+static Tag *
+ReadTag (Buffer::Iterator &i)
+{
+  Tag *tag = CreateTag (TypeId::LookupByHash (i.ReadNtohU32 ()));
+  uint32_t size = i.ReadNtohU32 ();
+  std::vector<uint8_t> data (size);
+  i.Read (data.data (), size);
+  TagBuffer tagBuffer (data.data (), data.data () + size);
+  tag->Deserialize (tagBuffer);
+  return tag;
+}
+
+uint32_t
+DistributedSpectrumSignalCodec::GetPacketSerializedSize (Ptr<const Packet> p)
+{
+  uint32_t size = 4 + p->GetSerializedSize () + 4 + 4;
+  PacketTagIterator packetTags = p->GetPacketTagIterator ();
+  while (packetTags.HasNext ())
+    {
+      PacketTagIterator::Item item = packetTags.Next ();
+      Tag *tag = CreateTag (item.GetTypeId ());
+      item.GetTag (*tag);
+      size += 4 + 4 + tag->GetSerializedSize ();
+      delete tag;
+    }
+  ByteTagIterator byteTags = p->GetByteTagIterator ();
+  while (byteTags.HasNext ())
+    {
+      ByteTagIterator::Item item = byteTags.Next ();
+      Tag *tag = CreateTag (item.GetTypeId ());
+      item.GetTag (*tag);
+      size += 4 + 4 + 4 + 4 + tag->GetSerializedSize ();
+      delete tag;
+    }
+  return size;
+}
+
+void
+DistributedSpectrumSignalCodec::SerializePacket (Buffer::Iterator &i, Ptr<const Packet> p)
+{
+  uint32_t size = p->GetSerializedSize ();
+  std::vector<uint8_t> data (size);
+  p->Serialize (data.data (), size);
+  i.WriteHtonU32 (size);
+  i.Write (data.data (), size);
+
+  std::vector<Tag *> tags;
+  PacketTagIterator packetTags = p->GetPacketTagIterator ();
+  while (packetTags.HasNext ())
+    {
+      PacketTagIterator::Item item = packetTags.Next ();
+      tags.push_back (CreateTag (item.GetTypeId ()));
+      item.GetTag (*tags.back ());
+    }
+  i.WriteHtonU32 (tags.size ());
+  for (std::size_t k = 0; k < tags.size (); k++)
+    {
+      WriteTag (i, *tags[k]);
+      delete tags[k];
+    }
+
+  uint32_t nByteTags = 0;
+  ByteTagIterator byteTags = p->GetByteTagIterator ();
+  while (byteTags.HasNext ())
+    {
+      byteTags.Next ();
+      nByteTags++;
+    }
+  i.WriteHtonU32 (nByteTags);
+  byteTags = p->GetByteTagIterator ();
+  while (byteTags.HasNext ())
+    {
+      ByteTagIterator::Item item = byteTags.Next ();
+      Tag *tag = CreateTag (item.GetTypeId ());
+      item.GetTag (*tag);
+      i.WriteHtonU32 (item.GetStart ());
+      i.WriteHtonU32 (item.GetEnd ());
+      WriteTag (i, *tag);
+      delete tag;
+    }
+}
+
+Ptr<Packet>
+DistributedSpectrumSignalCodec::DeserializePacket (Buffer::Iterator &i)
+{
+  uint32_t size = i.ReadNtohU32 ();
+  std::vector<uint8_t> data (size);
+  i.Read (data.data (), size);
+  Ptr<Packet> p = Create<Packet> (data.data (), size, true);
+
+  uint32_t nPacketTags = i.ReadNtohU32 ();
+  for (uint32_t k = 0; k < nPacketTags; k++)
+    {
+      Tag *tag = ReadTag (i);
+      p->AddPacketTag (*tag);
+      delete tag;
+    }
+  uint32_t nByteTags = i.ReadNtohU32 ();
+  if (nByteTags == 0)
+    {
+      return p;
+    }
+
+  // Packet::AddByteTag takes the offsets of the buffer of the packet, so
+  // the packet is rebuilt from fragments bounded by the tagged ranges,
+  // each one with the byte tags covering it; the fragments keep the
+  // packet tags added above
+  std::vector<std::pair<uint32_t, uint32_t> > ranges;
+  std::vector<Tag *> tags;
+  std::vector<uint32_t> bounds (1, 0);
+  bounds.push_back (p->GetSize ());
+  for (uint32_t k = 0; k < nByteTags; k++)
+    {
+      uint32_t start = std::min (i.ReadNtohU32 (), p->GetSize ());
+      uint32_t end = std::min (i.ReadNtohU32 (), p->GetSize ());
+      tags.push_back (ReadTag (i));
+      ranges.push_back (std::make_pair (start, end));
+      bounds.push_back (start);
+      bounds.push_back (end);
+    }
+  std::sort (bounds.begin (), bounds.end ());
+  bounds.erase (std::unique (bounds.begin (), bounds.end ()), bounds.end ());
+  Ptr<Packet> tagged;
+  for (std::size_t b = 0; b + 1 < bounds.size (); b++)
+    {
+      Ptr<Packet> fragment = p->CreateFragment (bounds[b], bounds[b + 1] - bounds[b]);
+      for (std::size_t k = 0; k < tags.size (); k++)
+        {
+          if (ranges[k].first <= bounds[b] && bounds[b + 1] <= ranges[k].second)
+            {
+              fragment->AddByteTag (*tags[k]);
+            }
+        }
+      if (tagged == 0)
+        {
+          tagged = fragment;
+        }
+      else
+        {
+          tagged->AddAtEnd (fragment);
+        }
+    }
+  for (std::size_t k = 0; k < tags.size (); k++)
+    {
+      delete tags[k];
+    }
+  return tagged;
+}
+
+
+/**
+ * Write a double to a buffer, in network order.
+ *
+ * \param i the buffer iterator
+ * \param v the value
+ */
+static void
+WriteDouble (Buffer::Iterator &i, double v)
+{
+  uint64_t bits;
+  std::memcpy (&bits, &v, sizeof (bits));
+  i.WriteHtonU64 (bits);
+}
+
+/**
+ * Read a double written by WriteDouble from a buffer.
+ *
+ * \param i the buffer iterator
+ * \return the value
+ */
+static double
+ReadDouble (Buffer::Iterator &i)
+{
+  uint64_t bits = i.ReadNtohU64 ();
+  double v;
+  std::memcpy (&v, &bits, sizeof (v));
+  return v;
+}
+
+NS_OBJECT_ENSURE_REGISTERED (DistributedSpectrumHeader);
+
+DistributedSpectrumHeader::DistributedSpectrumHeader ()
+  : m_txTime (0),
+    m_duration (0),
+    m_txNode (0),
+    m_txDevice (0),
+    m_txAntenna (0),
+    m_codec (NO_CODEC),
+    m_spectrumModelUid (0)
+{
+}
+
+DistributedSpectrumHeader::~DistributedSpectrumHeader ()
+{
+}
+
+TypeId
+DistributedSpectrumHeader::GetTypeId (void)
+{
+  static TypeId tid = TypeId ("ns3::DistributedSpectrumHeader")
+    .SetParent<Header> ()
+    .SetGroupName ("Spectrum")
+    .AddConstructor<DistributedSpectrumHeader> ()
+  ;
+  return tid;
+}
+
+TypeId
+DistributedSpectrumHeader::GetInstanceTypeId (void) const
+{
+  return GetTypeId ();
+}
+
+void
+DistributedSpectrumHeader::Print (std::ostream &os) const
+{
+  os << "txTime=" << GetTxTime ()
+     << " duration=" << GetDuration ()
+     << " txNode=" << m_txNode
+     << " txDevice=" << m_txDevice
+     << " txAntenna=" << (uint16_t) m_txAntenna
+     << " codec=" << m_codec
+     << " spectrumModelUid=" << m_spectrumModelUid
+     << " bands=" << m_bands.size ();
+}
+
+uint32_t
+DistributedSpectrumHeader::GetSerializedSize (void) const
+{
+  return 8 + 8 + 4 + 4 + 1 + 4 + 4 + 4 + m_bands.size () * 4 * 8;
+}
+
+void
+DistributedSpectrumHeader::Serialize (Buffer::Iterator start) const
+{
+  NS_ASSERT (m_bands.size () == m_psdValues.size ());
+  Buffer::Iterator i = start;
+  i.WriteHtonU64 (m_txTime);
+  i.WriteHtonU64 (m_duration);
+  i.WriteHtonU32 (m_txNode);
+  i.WriteHtonU32 (m_txDevice);
+  i.WriteU8 (m_txAntenna);
+  i.WriteHtonU32 (m_codec);
+  i.WriteHtonU32 (m_spectrumModelUid);
+  i.WriteHtonU32 (m_bands.size ());
+  for (std::size_t k = 0; k < m_bands.size (); k++)
+    {
+      WriteDouble (i, m_bands[k].fl);
+      WriteDouble (i, m_bands[k].fc);
+      WriteDouble (i, m_bands[k].fh);
+      WriteDouble (i, m_psdValues[k]);
+    }
+}
+
+uint32_t
+DistributedSpectrumHeader::Deserialize (Buffer::Iterator start)
+{
+  Buffer::Iterator i = start;
+  m_txTime = i.ReadNtohU64 ();
+  m_duration = i.ReadNtohU64 ();
+  m_txNode = i.ReadNtohU32 ();
+  m_txDevice = i.ReadNtohU32 ();
+  m_txAntenna = i.ReadU8 ();
+  m_codec = i.ReadNtohU32 ();
+  m_spectrumModelUid = i.ReadNtohU32 ();
+  uint32_t n = i.ReadNtohU32 ();
+  m_bands.resize (n);
+  m_psdValues.resize (n);
+  for (uint32_t k = 0; k < n; k++)
+    {
+      m_bands[k].fl = ReadDouble (i);
+      m_bands[k].fc = ReadDouble (i);
+      m_bands[k].fh = ReadDouble (i);
+      m_psdValues[k] = ReadDouble (i);
+    }
+  return GetSerializedSize ();
+}
+
+void
+DistributedSpectrumHeader::SetTxTime (Time txTime)
+{
+  m_txTime = txTime.GetTimeStep ();
+}
+
+Time
+DistributedSpectrumHeader::GetTxTime (void) const
+{
+  return TimeStep (m_txTime);
+}
+
+void
+DistributedSpectrumHeader::SetDuration (Time duration)
+{
+  m_duration = duration.GetTimeStep ();
+}
+
+Time
+DistributedSpectrumHeader::GetDuration (void) const
+{
+  return TimeStep (m_duration);
+}
+
+void
+DistributedSpectrumHeader::SetTxDevice (uint32_t node, uint32_t device)
+{
+  m_txNode = node;
+  m_txDevice = device;
+}
+
+uint32_t
+DistributedSpectrumHeader::GetTxNode (void) const
+{
+  return m_txNode;
+}
+
+uint32_t
+DistributedSpectrumHeader::GetTxDevice (void) const
+{
+  return m_txDevice;
+}
+
+void
+DistributedSpectrumHeader::SetTxAntenna (bool txAntenna)
+{
+  m_txAntenna = txAntenna ? 1 : 0;
+}
+
+bool
+DistributedSpectrumHeader::HasTxAntenna (void) const
+{
+  return m_txAntenna != 0;
+}
+
+void
+DistributedSpectrumHeader::SetCodec (uint32_t codec)
+{
+  m_codec = codec;
+}
+
+uint32_t
+DistributedSpectrumHeader::GetCodec (void) const
+{
+  return m_codec;
+}
+
+void
+DistributedSpectrumHeader::SetPsd (Ptr<const SpectrumValue> psd)
+{
+  Ptr<const SpectrumModel> model = psd->GetSpectrumModel ();
+  m_spectrumModelUid = model->GetUid ();
+  m_bands.assign (model->Begin (), model->End ());
+  m_psdValues.assign (psd->ConstValuesBegin (), psd->ConstValuesEnd ());
+}
+
+SpectrumModelUid_t
+DistributedSpectrumHeader::GetSpectrumModelUid (void) const
+{
+  return m_spectrumModelUid;
+}
+
+const Bands &
+DistributedSpectrumHeader::GetBands (void) const
+{
+  return m_bands;
+}
+
+const std::vector<double> &
+DistributedSpectrumHeader::GetPsdValues (void) const
+{
+  return m_psdValues;
+}
+
+std::vector<std::pair<uint32_t, Ptr<DistributedSpectrumSignalCodec> > > &
+DistributedSpectrumSignalCodec::GetCodecs (void)
+{
+  static std::vector<std::pair<uint32_t, Ptr<DistributedSpectrumSignalCodec> > > codecs
+    (1, std::make_pair (Hash32 ("ns3::HalfDuplexIdealPhySignalParameters"),
+                        Ptr<DistributedSpectrumSignalCodec> (Create<HalfDuplexIdealPhySignalCodec> ())));
+  return codecs;
+}
+
+void
+DistributedSpectrumSignalCodec::Add (std::string name, Ptr<DistributedSpectrumSignalCodec> codec)
+{
+  NS_LOG_FUNCTION (name << codec);
+  uint32_t id = Hash32 (name);
+  NS_ABORT_MSG_IF (id == DistributedSpectrumHeader::NO_CODEC, "Invalid signal codec name " << name);
+  std::vector<std::pair<uint32_t, Ptr<DistributedSpectrumSignalCodec> > > &codecs = GetCodecs ();
+  for (auto it = codecs.begin (); it != codecs.end (); ++it)
+    {
+      if (it->first == id)
+        {
+          it->second = codec;
+          return;
+        }
+    }
+  codecs.push_back (std::make_pair (id, codec));
+}
+
+} // namespace ns3
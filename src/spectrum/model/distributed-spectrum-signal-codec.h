@@ -0,0 +1,219 @@
+/* -*-  Mode: C++; c-file-style: "gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef DISTRIBUTED_SPECTRUM_SIGNAL_CODEC_H
+#define DISTRIBUTED_SPECTRUM_SIGNAL_CODEC_H
+
+#include <ns3/spectrum-signal-parameters.h>
+#include <ns3/spectrum-value.h>
+#include <ns3/header.h>
+#include <ns3/buffer.h>
+#include <ns3/packet.h>
+#include <ns3/nstime.h>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace ns3 {
+
+/**
+ * \ingroup spectrum
+ *
+ * Serializer of the members that a SpectrumSignalParameters subclass
+ * adds to the base ones, so that DistributedSpectrumChannel can send
+ * the signals of this subclass to the other systems.  The signals of a
+ * subclass without a codec are received by the other systems as plain
+ * SpectrumSignalParameters, that is, as interference.
+ *
+ * The codecs are added with DistributedSpectrumSignalCodec::Add, and
+ * each one should only accept the subclasses it decodes.  They are kept
+ * in the spectrum module, which does not depend on MPI, so that the
+ * modules of the signals can add them without depending on the
+ * distributed-spectrum module.
+ */
+class DistributedSpectrumSignalCodec : public SimpleRefCount<DistributedSpectrumSignalCodec>
+{
+public:
+  virtual ~DistributedSpectrumSignalCodec ();
+
+  /**
+   * \param params the signal parameters
+   * \return true if params is an instance of the subclass of this codec
+   */
+  virtual bool CanEncode (Ptr<const SpectrumSignalParameters> params) const = 0;
+
+  /**
+   * \param params the signal parameters, accepted by CanEncode
+   * \return a packet holding the members of the subclass
+   */
+  virtual Ptr<Packet> Encode (Ptr<const SpectrumSignalParameters> params) const = 0;
+
+  /**
+   * \param p the packet returned by Encode
+   * \return an instance of the subclass, with its own members set from
+   * the packet
+   */
+  virtual Ptr<SpectrumSignalParameters> Decode (Ptr<Packet> p) const = 0;
+
+  /**
+   * \param p a packet
+   * \return the size of the packet written by SerializePacket
+   */
+  static uint32_t GetPacketSerializedSize (Ptr<const Packet> p);
+
+  /**
+   * Write a packet with its packet tags and byte tags, which
+   * Packet::Serialize leaves out.  The tags must have a constructor
+   * registered in their TypeId.
+   *
+   * \param i the buffer iterator
+   * \param p the packet
+   */
+  static void SerializePacket (Buffer::Iterator &i, Ptr<const Packet> p);
+
+  /**
+   * \param i the buffer iterator
+   * \return the packet written by SerializePacket, with its tags
+   */
+  static Ptr<Packet> DeserializePacket (Buffer::Iterator &i);
+
+  /**
+   * Add a codec for SpectrumSignalParameters subclasses.  The codecs are
+   * identified by the hash of their name in the messages, so they must be
+   * added in all the systems, in any order, before the simulation starts.
+   * Adding a codec with the name of another one replaces it.  The codecs
+   * of HalfDuplexIdealPhySignalParameters, of the LTE signals and of the
+   * Wi-Fi signals are added when their modules are loaded.
+   *
+   * \param name the unique name of the codec
+   * \param codec the codec
+   */
+  static void Add (std::string name, Ptr<DistributedSpectrumSignalCodec> codec);
+
+  /**
+   * \return the codecs added so far, with the hashes of their names
+   */
+  static std::vector<std::pair<uint32_t, Ptr<DistributedSpectrumSignalCodec> > > & GetCodecs (void);
+};
+
+/**
+ * \ingroup spectrum
+ *
+ * Header of the signals that DistributedSpectrumChannel sends to the
+ * other systems: the base members of SpectrumSignalParameters, the
+ * transmitting device, and the PSD with the bands of its SpectrumModel,
+ * since the uids of the SpectrumModels may differ between systems.  The members of the subclass, if
+ * any, follow the header.
+ */
+class DistributedSpectrumHeader : public Header
+{
+public:
+  /** The codec id of the signals sent without a codec. */
+  static const uint32_t NO_CODEC = 0;
+
+  DistributedSpectrumHeader ();
+  virtual ~DistributedSpectrumHeader ();
+
+  /**
+   * \brief Get the type ID.
+   * \return the object TypeId
+   */
+  static TypeId GetTypeId (void);
+
+  // inherited from Header
+  virtual TypeId GetInstanceTypeId (void) const;
+  virtual void Print (std::ostream &os) const;
+  virtual uint32_t GetSerializedSize (void) const;
+  virtual void Serialize (Buffer::Iterator start) const;
+  virtual uint32_t Deserialize (Buffer::Iterator start);
+
+  /**
+   * \param txTime the start time of the transmission
+   */
+  void SetTxTime (Time txTime);
+  /**
+   * \return the start time of the transmission
+   */
+  Time GetTxTime (void) const;
+  /**
+   * \param duration the duration of the signal
+   */
+  void SetDuration (Time duration);
+  /**
+   * \return the duration of the signal
+   */
+  Time GetDuration (void) const;
+  /**
+   * \param node the id of the transmitting node
+   * \param device the index of the transmitting device in its node
+   */
+  void SetTxDevice (uint32_t node, uint32_t device);
+  /**
+   * \return the id of the transmitting node
+   */
+  uint32_t GetTxNode (void) const;
+  /**
+   * \return the index of the transmitting device in its node
+   */
+  uint32_t GetTxDevice (void) const;
+  /**
+   * \param txAntenna true if the signal was transmitted with an antenna
+   */
+  void SetTxAntenna (bool txAntenna);
+  /**
+   * \return true if the signal was transmitted with an antenna
+   */
+  bool HasTxAntenna (void) const;
+  /**
+   * \param codec the id of the codec of the signal, or NO_CODEC
+   */
+  void SetCodec (uint32_t codec);
+  /**
+   * \return the id of the codec of the signal, or NO_CODEC
+   */
+  uint32_t GetCodec (void) const;
+  /**
+   * \param psd the PSD of the signal
+   */
+  void SetPsd (Ptr<const SpectrumValue> psd);
+  /**
+   * \return the uid of the SpectrumModel of the PSD in the sending system
+   */
+  SpectrumModelUid_t GetSpectrumModelUid (void) const;
+  /**
+   * \return the bands of the SpectrumModel of the PSD
+   */
+  const Bands & GetBands (void) const;
+  /**
+   * \return the values of the PSD
+   */
+  const std::vector<double> & GetPsdValues (void) const;
+
+private:
+  int64_t m_txTime;                 //!< start time of the transmission, in time steps
+  int64_t m_duration;               //!< duration of the signal, in time steps
+  uint32_t m_txNode;                //!< id of the transmitting node
+  uint32_t m_txDevice;              //!< index of the transmitting device
+  uint8_t m_txAntenna;              //!< 1 if the signal was transmitted with an antenna
+  uint32_t m_codec;                 //!< id of the codec, or NO_CODEC
+  SpectrumModelUid_t m_spectrumModelUid; //!< uid of the SpectrumModel of the PSD
+  Bands m_bands;                    //!< bands of the SpectrumModel of the PSD
+  std::vector<double> m_psdValues;  //!< values of the PSD
+};
+
+} // namespace ns3
+
+#endif /* DISTRIBUTED_SPECTRUM_SIGNAL_CODEC_H */
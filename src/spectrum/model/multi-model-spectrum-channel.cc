@@ -29,6 +29,8 @@
 #include <ns3/net-device.h>
 #include <ns3/node.h>
 #include <ns3/double.h>
+#include <ns3/boolean.h>
+#include <ns3/uinteger.h>
 #include <ns3/mobility-model.h>
 #include <ns3/spectrum-phy.h>
 #include <ns3/spectrum-converter.h>
@@ -79,7 +81,9 @@ RxSpectrumModelInfo::RxSpectrumModelInfo (Ptr<const SpectrumModel> rxSpectrumMod
 }
 
 MultiModelSpectrumChannel::MultiModelSpectrumChannel ()
-  : m_numDevices {0}
+  : m_numDevices {0},
+    m_maxRange {0},
+    m_pathLossCacheEnabled {false}
 {
   NS_LOG_FUNCTION (this);
 }
@@ -90,6 +94,11 @@ MultiModelSpectrumChannel::DoDispose ()
   NS_LOG_FUNCTION (this);
   m_txSpectrumModelInfoMap.clear ();
   m_rxSpectrumModelInfoMap.clear ();
+  m_rxPhysInRange.clear ();
+  if (m_pathLossCache)
+    {
+      m_pathLossCache->Clear ();
+    }
   SpectrumChannel::DoDispose ();
 }
 
@@ -100,7 +109,42 @@ MultiModelSpectrumChannel::GetTypeId (void)
     .SetParent<SpectrumChannel> ()
     .SetGroupName ("Spectrum")
     .AddConstructor<MultiModelSpectrumChannel> ()
-
+    .AddAttribute ("MaxRange",
+                   "If positive, the maximum distance in meters between "
+                   "a transmitter and a receiver for which transmissions "
+                   "are passed to the receiving PHY. The receivers are "
+                   "then kept in a spatial index, and the receivers beyond "
+                   "this range are skipped without evaluating the "
+                   "propagation loss models nor scheduling any event. "
+                   "The default value disables the spatial index, i.e., "
+                   "all the receivers are considered. "
+                   "Tune this value with care.",
+                   DoubleValue (0.0),
+                   MakeDoubleAccessor (&MultiModelSpectrumChannel::m_maxRange),
+                   MakeDoubleChecker<double> ())
+    .AddAttribute ("PathLossCache",
+                   "If true, the gain computed by the propagation loss "
+                   "models for a pair of stationary phys is cached, and "
+                   "only computed again after the mobility model of one "
+                   "of them notifies a course change. Only enable it "
+                   "with propagation loss models that return the same "
+                   "value for the same positions.",
+                   BooleanValue (false),
+                   MakeBooleanAccessor (&MultiModelSpectrumChannel::m_pathLossCacheEnabled),
+                   MakeBooleanChecker ())
+    .AddAttribute ("PathLossCacheHits",
+                   "The number of propagation gains found in the path loss cache.",
+                   TypeId::ATTR_GET,
+                   UintegerValue (0), // this value is ignored because there is no setter
+                   MakeUintegerAccessor (&MultiModelSpectrumChannel::GetPathLossCacheHits),
+                   MakeUintegerChecker<uint64_t> ())
+    .AddAttribute ("PathLossCacheMisses",
+                   "The number of propagation gains computed while the path "
+                   "loss cache is enabled.",
+                   TypeId::ATTR_GET,
+                   UintegerValue (0), // this value is ignored because there is no setter
+                   MakeUintegerAccessor (&MultiModelSpectrumChannel::GetPathLossCacheMisses),
+                   MakeUintegerChecker<uint64_t> ())
   ;
   return tid;
 }
@@ -128,6 +172,10 @@ MultiModelSpectrumChannel::AddRx (Ptr<SpectrumPhy> phy)
       if (phyIt != rxInfoIterator->second.m_rxPhys.end ())
         {
           rxInfoIterator->second.m_rxPhys.erase (phyIt);
+          if (rxInfoIterator->second.m_rxPhyIndex)
+            {
+              rxInfoIterator->second.m_rxPhyIndex->Remove (phy);
+            }
           --m_numDevices;
           break; // there should be at most one entry
         }       
@@ -168,6 +216,10 @@ MultiModelSpectrumChannel::AddRx (Ptr<SpectrumPhy> phy)
     {
       // spectrum model is already known, just add the device to the corresponding list
       rxInfoIterator->second.m_rxPhys.push_back (phy);
+      if (rxInfoIterator->second.m_rxPhyIndex)
+        {
+          rxInfoIterator->second.m_rxPhyIndex->Add (phy);
+        }
     }
 }
 
@@ -223,6 +275,14 @@ MultiModelSpectrumChannel::StartTx (Ptr<SpectrumSignalParameters> txParams)
   Ptr<SpectrumSignalParameters> txParamsTrace = txParams->Copy (); // copy it since traced value cannot be const (because of potential underlying DynamicCasts)
   m_txSigParamsTrace (txParamsTrace);
 
+  DoStartTx (txParams, Seconds (0));
+}
+
+void
+MultiModelSpectrumChannel::DoStartTx (Ptr<SpectrumSignalParameters> txParams, Time elapsed)
+{
+  NS_LOG_FUNCTION (this << txParams << elapsed);
+
   Ptr<MobilityModel> txMobility = txParams->txPhy->GetMobility ();
   SpectrumModelUid_t txSpectrumModelUid = txParams->psd->GetSpectrumModelUid ();
   NS_LOG_LOGIC ("txSpectrumModelUid " << txSpectrumModelUid);
@@ -235,7 +295,12 @@ MultiModelSpectrumChannel::StartTx (Ptr<SpectrumSignalParameters> txParams)
   NS_LOG_LOGIC ("converter map size: " << txInfoIteratorerator->second.m_spectrumConverterMap.size ());
   NS_LOG_LOGIC ("converter map first element: " << txInfoIteratorerator->second.m_spectrumConverterMap.begin ()->first);
 
-  for (RxSpectrumModelInfoMap_t::const_iterator rxInfoIterator = m_rxSpectrumModelInfoMap.begin ();
+  if (m_pathLossCacheEnabled && !m_pathLossCache)
+    {
+      m_pathLossCache = Create<SpectrumPathLossCache> ();
+    }
+
+  for (RxSpectrumModelInfoMap_t::iterator rxInfoIterator = m_rxSpectrumModelInfoMap.begin ();
        rxInfoIterator != m_rxSpectrumModelInfoMap.end ();
        ++rxInfoIterator)
     {
@@ -260,8 +325,25 @@ MultiModelSpectrumChannel::StartTx (Ptr<SpectrumSignalParameters> txParams)
           convertedTxPowerSpectrum = rxConverterIterator->second.Convert (txParams->psd);
         }
 
-      for (auto rxPhyIterator = rxInfoIterator->second.m_rxPhys.begin ();
-           rxPhyIterator != rxInfoIterator->second.m_rxPhys.end ();
+      const std::vector<Ptr<SpectrumPhy> > *rxPhys = &(rxInfoIterator->second.m_rxPhys);
+      if (m_maxRange > 0 && txMobility)
+        {
+          Ptr<SpectrumPhyGridIndex> &index = rxInfoIterator->second.m_rxPhyIndex;
+          if (index == 0 || index->GetCellSize () != m_maxRange)
+            {
+              NS_LOG_LOGIC ("building spatial index for rxSpectrumModelUid " << rxSpectrumModelUid);
+              index = Create<SpectrumPhyGridIndex> (m_maxRange);
+              for (const auto &phy : rxInfoIterator->second.m_rxPhys)
+                {
+                  index->Add (phy);
+                }
+            }
+          index->GetPhysInRange (txMobility->GetPosition (), m_maxRange, m_rxPhysInRange);
+          rxPhys = &m_rxPhysInRange;
+        }
+
+      for (auto rxPhyIterator = rxPhys->begin ();
+           rxPhyIterator != rxPhys->end ();
            ++rxPhyIterator)
         {
           NS_ASSERT_MSG ((*rxPhyIterator)->GetRxSpectrumModel ()->GetUid () == rxSpectrumModelUid,
@@ -269,83 +351,107 @@ MultiModelSpectrumChannel::StartTx (Ptr<SpectrumSignalParameters> txParams)
 
           if ((*rxPhyIterator) != txParams->txPhy)
             {
-              NS_LOG_LOGIC ("copying signal parameters " << txParams);
-              Ptr<SpectrumSignalParameters> rxParams = txParams->Copy ();
-              rxParams->psd = Copy<SpectrumValue> (convertedTxPowerSpectrum);
-              Time delay = MicroSeconds (0);
+              StartTxToReceiver (txParams, convertedTxPowerSpectrum, txMobility, *rxPhyIterator, elapsed);
+            }
+        }
+      m_rxPhysInRange.clear ();
+    }
 
-              Ptr<MobilityModel> receiverMobility = (*rxPhyIterator)->GetMobility ();
+}
 
-              if (txMobility && receiverMobility)
-                {
-                  double txAntennaGain = 0;
-                  double rxAntennaGain = 0;
-                  double propagationGainDb = 0;
-                  double pathLossDb = 0;
-                  if (rxParams->txAntenna != 0)
-                    {
-                      Angles txAngles (receiverMobility->GetPosition (), txMobility->GetPosition ());
-                      txAntennaGain = rxParams->txAntenna->GetGainDb (txAngles);
-                      NS_LOG_LOGIC ("txAntennaGain = " << txAntennaGain << " dB");
-                      pathLossDb -= txAntennaGain;
-                    }
-                  Ptr<AntennaModel> rxAntenna = (*rxPhyIterator)->GetRxAntenna ();
-                  if (rxAntenna != 0)
-                    {
-                      Angles rxAngles (txMobility->GetPosition (), receiverMobility->GetPosition ());
-                      rxAntennaGain = rxAntenna->GetGainDb (rxAngles);
-                      NS_LOG_LOGIC ("rxAntennaGain = " << rxAntennaGain << " dB");
-                      pathLossDb -= rxAntennaGain;
-                    }
-                  if (m_propagationLoss)
-                    {
-                      propagationGainDb = m_propagationLoss->CalcRxPower (0, txMobility, receiverMobility);
-                      NS_LOG_LOGIC ("propagationGainDb = " << propagationGainDb << " dB");
-                      pathLossDb -= propagationGainDb;
-                    }                    
-                  NS_LOG_LOGIC ("total pathLoss = " << pathLossDb << " dB");
-                  // Gain trace
-                  m_gainTrace (txMobility, receiverMobility, txAntennaGain, rxAntennaGain, propagationGainDb, pathLossDb);
-                  // Pathloss trace
-                  m_pathLossTrace (txParams->txPhy, *rxPhyIterator, pathLossDb);
-                  if (pathLossDb > m_maxLossDb)
-                    {
-                      // beyond range
-                      continue;
-                    }
-                  double pathGainLinear = std::pow (10.0, (-pathLossDb) / 10.0);
-                  *(rxParams->psd) *= pathGainLinear;              
-
-                  if (m_spectrumPropagationLoss)
-                    {
-                      rxParams->psd = m_spectrumPropagationLoss->CalcRxPowerSpectralDensity (rxParams->psd, txMobility, receiverMobility);
-                    }
-
-                  if (m_propagationDelay)
-                    {
-                      delay = m_propagationDelay->GetDelay (txMobility, receiverMobility);
-                    }
-                }
+void
+MultiModelSpectrumChannel::StartTxToReceiver (Ptr<SpectrumSignalParameters> txParams, Ptr<const SpectrumValue> txPowerSpectrum,
+                                              Ptr<MobilityModel> txMobility, Ptr<SpectrumPhy> receiver, Time elapsed)
+{
+  NS_LOG_FUNCTION (this << txParams << receiver << elapsed);
+  Time delay = MicroSeconds (0);
+  double pathGainLinear = 1.0;
 
-              Ptr<NetDevice> netDev = (*rxPhyIterator)->GetDevice ();
-              if (netDev)
-                {
-                  // the receiver has a NetDevice, so we expect that it is attached to a Node
-                  uint32_t dstNode =  netDev->GetNode ()->GetId ();
-                  Simulator::ScheduleWithContext (dstNode, delay, &MultiModelSpectrumChannel::StartRx, this,
-                                                  rxParams, *rxPhyIterator);
-                }
-              else
+  Ptr<MobilityModel> receiverMobility = receiver->GetMobility ();
+
+  if (txMobility && receiverMobility)
+    {
+      double txAntennaGain = 0;
+      double rxAntennaGain = 0;
+      double propagationGainDb = 0;
+      double pathLossDb = 0;
+      if (txParams->txAntenna != 0)
+        {
+          Angles txAngles (receiverMobility->GetPosition (), txMobility->GetPosition ());
+          txAntennaGain = txParams->txAntenna->GetGainDb (txAngles);
+          NS_LOG_LOGIC ("txAntennaGain = " << txAntennaGain << " dB");
+          pathLossDb -= txAntennaGain;
+        }
+      Ptr<AntennaModel> rxAntenna = receiver->GetRxAntenna ();
+      if (rxAntenna != 0)
+        {
+          Angles rxAngles (txMobility->GetPosition (), receiverMobility->GetPosition ());
+          rxAntennaGain = rxAntenna->GetGainDb (rxAngles);
+          NS_LOG_LOGIC ("rxAntennaGain = " << rxAntennaGain << " dB");
+          pathLossDb -= rxAntennaGain;
+        }
+      if (m_propagationLoss)
+        {
+          if (!m_pathLossCacheEnabled
+              || !m_pathLossCache->Lookup (txParams->txPhy, receiver, txMobility, receiverMobility, propagationGainDb))
+            {
+              propagationGainDb = m_propagationLoss->CalcRxPower (0, txMobility, receiverMobility);
+              if (m_pathLossCacheEnabled)
                 {
-                  // the receiver is not attached to a NetDevice, so we cannot assume that it is attached to a node
-                  Simulator::Schedule (delay, &MultiModelSpectrumChannel::StartRx, this,
-                                       rxParams, *rxPhyIterator);
+                  m_pathLossCache->Insert (txParams->txPhy, receiver, txMobility, receiverMobility, propagationGainDb);
                 }
             }
+          NS_LOG_LOGIC ("propagationGainDb = " << propagationGainDb << " dB");
+          pathLossDb -= propagationGainDb;
+        }
+      NS_LOG_LOGIC ("total pathLoss = " << pathLossDb << " dB");
+      // Gain trace
+      m_gainTrace (txMobility, receiverMobility, txAntennaGain, rxAntennaGain, propagationGainDb, pathLossDb);
+      // Pathloss trace
+      m_pathLossTrace (txParams->txPhy, receiver, pathLossDb);
+      if (pathLossDb > m_maxLossDb)
+        {
+          // beyond range, no need to copy the signal parameters
+          return;
+        }
+      pathGainLinear = std::pow (10.0, (-pathLossDb) / 10.0);
+    }
+
+  NS_LOG_LOGIC ("copying signal parameters " << txParams);
+  Ptr<SpectrumSignalParameters> rxParams = txParams->Copy ();
+  rxParams->psd = Copy<SpectrumValue> (txPowerSpectrum);
+
+  if (txMobility && receiverMobility)
+    {
+      *(rxParams->psd) *= pathGainLinear;
+
+      if (m_spectrumPropagationLoss)
+        {
+          rxParams->psd = m_spectrumPropagationLoss->CalcRxPowerSpectralDensity (rxParams->psd, txMobility, receiverMobility);
         }
 
+      if (m_propagationDelay)
+        {
+          delay = m_propagationDelay->GetDelay (txMobility, receiverMobility);
+        }
     }
+  // a receiver without mobility gets the signal as soon as it arrives
+  delay = delay > elapsed ? delay - elapsed : Seconds (0);
 
+  Ptr<NetDevice> netDev = receiver->GetDevice ();
+  if (netDev)
+    {
+      // the receiver has a NetDevice, so we expect that it is attached to a Node
+      uint32_t dstNode =  netDev->GetNode ()->GetId ();
+      Simulator::ScheduleWithContext (dstNode, delay, &MultiModelSpectrumChannel::StartRx, this,
+                                      rxParams, receiver);
+    }
+  else
+    {
+      // the receiver is not attached to a NetDevice, so we cannot assume that it is attached to a node
+      Simulator::Schedule (delay, &MultiModelSpectrumChannel::StartRx, this,
+                           rxParams, receiver);
+    }
 }
 
 void
@@ -355,6 +461,24 @@ MultiModelSpectrumChannel::StartRx (Ptr<SpectrumSignalParameters> params, Ptr<Sp
   receiver->StartRx (params);
 }
 
+double
+MultiModelSpectrumChannel::GetMaxRange (void) const
+{
+  return m_maxRange;
+}
+
+uint64_t
+MultiModelSpectrumChannel::GetPathLossCacheHits (void) const
+{
+  return m_pathLossCache ? m_pathLossCache->GetHits () : 0;
+}
+
+uint64_t
+MultiModelSpectrumChannel::GetPathLossCacheMisses (void) const
+{
+  return m_pathLossCache ? m_pathLossCache->GetMisses () : 0;
+}
+
 std::size_t
 MultiModelSpectrumChannel::GetNDevices (void) const
 {
@@ -27,6 +27,8 @@
 #include <ns3/spectrum-channel.h>
 #include <ns3/spectrum-propagation-loss-model.h>
 #include <ns3/propagation-delay-model.h>
+#include <ns3/spectrum-phy-grid-index.h>
+#include <ns3/spectrum-path-loss-cache.h>
 #include <map>
 #include <set>
 
@@ -81,6 +83,7 @@ public:
 
   Ptr<const SpectrumModel> m_rxSpectrumModel;  //!< Rx Spectrum model.
   std::vector<Ptr<SpectrumPhy> > m_rxPhys;     //!< Container of the Rx Spectrum phy objects.
+  Ptr<SpectrumPhyGridIndex> m_rxPhyIndex;      //!< Spatial index of m_rxPhys, only built if MaxRange is set.
 };
 
 /**
@@ -102,6 +105,18 @@ typedef std::map<SpectrumModelUid_t, RxSpectrumModelInfo> RxSpectrumModelInfoMap
  * for this to work is that, after the SpectrumPhy switched its
  * SpectrumModel,  MultiModelSpectrumChannel::AddRx () is
  * called again passing the pointer to that SpectrumPhy.
+ *
+ * \note If the MaxRange attribute is set, the receivers are kept in a
+ * SpectrumPhyGridIndex and a transmission is only delivered to the
+ * receivers within MaxRange of the transmitter, which are the only ones
+ * for which the PathLoss and Gain traces are fired. Receivers without a
+ * MobilityModel are always considered to be in range.
+ *
+ * \note If the PathLossCache attribute is set, the gain computed by the
+ * PropagationLossModel for a pair of stationary phys is kept in a
+ * SpectrumPathLossCache, and only computed again after one of them has
+ * notified a course change. The antenna gains and the
+ * SpectrumPropagationLossModel are evaluated at every transmission.
  */
 class MultiModelSpectrumChannel : public SpectrumChannel
 {
@@ -124,10 +139,37 @@ public:
   virtual std::size_t GetNDevices (void) const;
   virtual Ptr<NetDevice> GetDevice (std::size_t i) const;
 
+  /**
+   * \return the number of propagation gains found in the path loss cache
+   */
+  uint64_t GetPathLossCacheHits (void) const;
+
+  /**
+   * \return the number of propagation gains not found in the path loss
+   * cache while it is enabled
+   */
+  uint64_t GetPathLossCacheMisses (void) const;
+
 
 protected:
   void DoDispose ();
 
+  /**
+   * Deliver a signal to the receivers, as StartTx does once it has fired
+   * the TxSigParams trace.
+   *
+   * \param txParams The signal parameters.
+   * \param elapsed The time elapsed since the start of the transmission,
+   *   subtracted from the propagation delay to each receiver.
+   */
+  void DoStartTx (Ptr<SpectrumSignalParameters> txParams, Time elapsed);
+
+  /**
+   * \return the maximum distance [m] between a transmitter and a receiver,
+   * or a non-positive value if the receivers are not culled by distance
+   */
+  double GetMaxRange (void) const;
+
 private:
   /**
    * This method checks if m_rxSpectrumModelInfoMap contains an entry
@@ -149,6 +191,19 @@ private:
    */
   virtual void StartRx (Ptr<SpectrumSignalParameters> params, Ptr<SpectrumPhy> receiver);
 
+  /**
+   * Compute the loss between the transmitter and one receiver, and
+   * schedule the reception of the signal if the receiver is in range.
+   *
+   * \param txParams The signal parameters.
+   * \param txPowerSpectrum The transmitted PSD, converted to the receiver SpectrumModel.
+   * \param txMobility The mobility model of the transmitter, if any.
+   * \param receiver A pointer to the receiver SpectrumPhy.
+   * \param elapsed The time elapsed since the start of the transmission.
+   */
+  void StartTxToReceiver (Ptr<SpectrumSignalParameters> txParams, Ptr<const SpectrumValue> txPowerSpectrum,
+                          Ptr<MobilityModel> txMobility, Ptr<SpectrumPhy> receiver, Time elapsed);
+
   /**
    * Data structure holding, for each TX SpectrumModel,  all the
    * converters to any RX SpectrumModel, and all the corresponding
@@ -169,6 +224,29 @@ private:
    */
   std::size_t m_numDevices;
 
+  /**
+   * Maximum distance [m] between a transmitter and a receiver for the
+   * signal to be propagated. A non-positive value disables the
+   * spatial culling of the receivers.
+   */
+  double m_maxRange;
+
+  /**
+   * Buffer of the receivers in range of the current transmission,
+   * kept to avoid allocating it at each StartTx call.
+   */
+  std::vector<Ptr<SpectrumPhy> > m_rxPhysInRange;
+
+  /**
+   * True if the propagation gains of the stationary phys are cached.
+   */
+  bool m_pathLossCacheEnabled;
+
+  /**
+   * Cache of the propagation gains, only created if m_pathLossCacheEnabled.
+   */
+  Ptr<SpectrumPathLossCache> m_pathLossCache;
+
 };
 
 
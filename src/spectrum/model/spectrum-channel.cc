@@ -142,6 +142,13 @@ SpectrumChannel::SetPropagationDelayModel (Ptr<PropagationDelayModel> delay)
   m_propagationDelay = delay;
 }
 
+Ptr<PropagationLossModel>
+SpectrumChannel::GetPropagationLossModel (void)
+{
+  NS_LOG_FUNCTION (this);
+  return m_propagationLoss;
+}
+
 Ptr<SpectrumPropagationLossModel>
 SpectrumChannel::GetSpectrumPropagationLossModel (void)
 {
@@ -0,0 +1,191 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include <algorithm>
+#include <ns3/log.h>
+#include <ns3/callback.h>
+#include "spectrum-path-loss-cache.h"
+
+namespace ns3 {
+
+NS_LOG_COMPONENT_DEFINE ("SpectrumPathLossCache");
+
+/// Initial number of slots of the hash table, a power of two
+static const std::size_t INITIAL_SLOTS = 64;
+
+SpectrumPathLossCache::SpectrumPathLossCache ()
+  : m_n (0),
+    m_hits (0),
+    m_misses (0)
+{
+  NS_LOG_FUNCTION (this);
+}
+
+SpectrumPathLossCache::~SpectrumPathLossCache ()
+{
+  NS_LOG_FUNCTION (this);
+  // disconnect from the mobility models, which may outlive the cache
+  Clear ();
+}
+
+bool
+SpectrumPathLossCache::Lookup (Ptr<const SpectrumPhy> txPhy, Ptr<const SpectrumPhy> rxPhy,
+                               Ptr<MobilityModel> txMobility, Ptr<MobilityModel> rxMobility, double &gainDb)
+{
+  if (m_n > 0)
+    {
+      const Entry &entry = m_slots[FindSlot (PeekPointer (txPhy), PeekPointer (rxPhy))];
+      if (entry.txPhy && IsValid (entry, PeekPointer (txMobility), PeekPointer (rxMobility)))
+        {
+          ++m_hits;
+          gainDb = entry.gainDb;
+          return true;
+        }
+    }
+  ++m_misses;
+  return false;
+}
+
+void
+SpectrumPathLossCache::Insert (Ptr<const SpectrumPhy> txPhy, Ptr<const SpectrumPhy> rxPhy,
+                               Ptr<MobilityModel> txMobility, Ptr<MobilityModel> rxMobility, double gainDb)
+{
+  NS_LOG_FUNCTION (this << txPhy << rxPhy << gainDb);
+  NS_ASSERT (txPhy && rxPhy && txMobility && rxMobility);
+
+  if (txMobility->GetVelocity ().GetLength () != 0 || rxMobility->GetVelocity ().GetLength () != 0)
+    {
+      NS_LOG_LOGIC ("not caching the gain of a moving phy");
+      return;
+    }
+  if (2 * (m_n + 1) > m_slots.size ())
+    {
+      Grow ();
+    }
+  Entry &entry = m_slots[FindSlot (PeekPointer (txPhy), PeekPointer (rxPhy))];
+  if (!entry.txPhy)
+    {
+      entry.txPhy = txPhy;
+      entry.rxPhy = rxPhy;
+      ++m_n;
+    }
+  entry.txMobility = GetMobilityIndex (txMobility);
+  entry.rxMobility = GetMobilityIndex (rxMobility);
+  entry.txVersion = m_mobilities[entry.txMobility].version;
+  entry.rxVersion = m_mobilities[entry.rxMobility].version;
+  entry.gainDb = gainDb;
+}
+
+void
+SpectrumPathLossCache::Clear (void)
+{
+  NS_LOG_FUNCTION (this);
+  for (auto &info : m_mobilities)
+    {
+      info.mobility->TraceDisconnectWithoutContext ("CourseChange", MakeCallback (&SpectrumPathLossCache::CourseChanged, this));
+    }
+  m_mobilities.clear ();
+  m_mobilityIndex.clear ();
+  m_slots.clear ();
+  m_n = 0;
+}
+
+std::size_t
+SpectrumPathLossCache::GetN (void) const
+{
+  return m_n;
+}
+
+uint64_t
+SpectrumPathLossCache::GetHits (void) const
+{
+  return m_hits;
+}
+
+uint64_t
+SpectrumPathLossCache::GetMisses (void) const
+{
+  return m_misses;
+}
+
+std::size_t
+SpectrumPathLossCache::FindSlot (const SpectrumPhy *txPhy, const SpectrumPhy *rxPhy) const
+{
+  // multiplicative hashing of the two addresses
+  uint64_t hash = reinterpret_cast<uintptr_t> (txPhy) * 0x9e3779b97f4a7c15ULL
+    ^ reinterpret_cast<uintptr_t> (rxPhy) * 0xc2b2ae3d27d4eb4fULL;
+  hash ^= hash >> 29;
+  std::size_t mask = m_slots.size () - 1;
+  std::size_t slot = static_cast<std::size_t> (hash) & mask;
+  while (m_slots[slot].txPhy
+         && (PeekPointer (m_slots[slot].txPhy) != txPhy || PeekPointer (m_slots[slot].rxPhy) != rxPhy))
+    {
+      slot = (slot + 1) & mask;
+    }
+  return slot;
+}
+
+bool
+SpectrumPathLossCache::IsValid (const Entry &entry, const MobilityModel *txMobility, const MobilityModel *rxMobility) const
+{
+  const MobilityInfo &txInfo = m_mobilities[entry.txMobility];
+  const MobilityInfo &rxInfo = m_mobilities[entry.rxMobility];
+  return PeekPointer (txInfo.mobility) == txMobility && txInfo.version == entry.txVersion
+         && PeekPointer (rxInfo.mobility) == rxMobility && rxInfo.version == entry.rxVersion;
+}
+
+uint32_t
+SpectrumPathLossCache::GetMobilityIndex (Ptr<MobilityModel> mobility)
+{
+  auto it = m_mobilityIndex.find (PeekPointer (mobility));
+  if (it != m_mobilityIndex.end ())
+    {
+      return it->second;
+    }
+  uint32_t index = m_mobilities.size ();
+  m_mobilities.push_back (MobilityInfo {mobility, 0});
+  m_mobilityIndex[PeekPointer (mobility)] = index;
+  mobility->TraceConnectWithoutContext ("CourseChange", MakeCallback (&SpectrumPathLossCache::CourseChanged, this));
+  return index;
+}
+
+void
+SpectrumPathLossCache::Grow (void)
+{
+  NS_LOG_FUNCTION (this << m_slots.size ());
+  std::vector<Entry> slots (std::max (INITIAL_SLOTS, 2 * m_slots.size ()));
+  slots.swap (m_slots);
+  for (auto &entry : slots)
+    {
+      if (entry.txPhy)
+        {
+          Entry &moved = m_slots[FindSlot (PeekPointer (entry.txPhy), PeekPointer (entry.rxPhy))];
+          moved = entry;
+        }
+    }
+}
+
+void
+SpectrumPathLossCache::CourseChanged (Ptr<const MobilityModel> mobility)
+{
+  auto it = m_mobilityIndex.find (PeekPointer (mobility));
+  if (it != m_mobilityIndex.end ())
+    {
+      ++m_mobilities[it->second].version;
+    }
+}
+
+} // namespace ns3
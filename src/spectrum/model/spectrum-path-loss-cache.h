@@ -0,0 +1,175 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef SPECTRUM_PATH_LOSS_CACHE_H
+#define SPECTRUM_PATH_LOSS_CACHE_H
+
+#include <ns3/simple-ref-count.h>
+#include <ns3/ptr.h>
+#include <ns3/spectrum-phy.h>
+#include <ns3/mobility-model.h>
+#include <unordered_map>
+#include <vector>
+
+namespace ns3 {
+
+/**
+ * \ingroup spectrum
+ *
+ * Cache of the propagation gain computed by a spectrum channel for each
+ * (transmitter, receiver) pair of SpectrumPhy instances, so that the
+ * PropagationLossModel chain is only evaluated again when one of the two
+ * phys has moved.
+ *
+ * The entries are stored in an open-addressing hash table with linear
+ * probing, keyed by the two phys. Each entry records a version number of
+ * the MobilityModels of the two phys, which is incremented when the
+ * MobilityModel fires its CourseChange trace; an entry whose versions are
+ * outdated is ignored and overwritten at the next Insert. Only the pairs
+ * whose MobilityModels report a zero velocity are cached, since models
+ * such as ConstantVelocityMobilityModel update their position without
+ * notifying a course change.
+ *
+ * The cached gain is only valid if the propagation loss models are
+ * deterministic for a given pair of positions: models drawing a random
+ * value at each call (e.g., NakagamiPropagationLossModel) must not be
+ * used with the cache.
+ */
+class SpectrumPathLossCache : public SimpleRefCount<SpectrumPathLossCache>
+{
+public:
+  SpectrumPathLossCache ();
+  ~SpectrumPathLossCache ();
+
+  /**
+   * Look up the propagation gain of a pair of phys
+   *
+   * \param txPhy the transmitter
+   * \param rxPhy the receiver
+   * \param txMobility the mobility model of the transmitter
+   * \param rxMobility the mobility model of the receiver
+   * \param [out] gainDb the cached propagation gain, in dB, if found
+   * \return true if a valid entry was found
+   */
+  bool Lookup (Ptr<const SpectrumPhy> txPhy, Ptr<const SpectrumPhy> rxPhy,
+               Ptr<MobilityModel> txMobility, Ptr<MobilityModel> rxMobility, double &gainDb);
+
+  /**
+   * Store the propagation gain of a pair of phys, if both are stationary
+   *
+   * \param txPhy the transmitter
+   * \param rxPhy the receiver
+   * \param txMobility the mobility model of the transmitter
+   * \param rxMobility the mobility model of the receiver
+   * \param gainDb the propagation gain, in dB
+   */
+  void Insert (Ptr<const SpectrumPhy> txPhy, Ptr<const SpectrumPhy> rxPhy,
+               Ptr<MobilityModel> txMobility, Ptr<MobilityModel> rxMobility, double gainDb);
+
+  /**
+   * Remove all the entries, and disconnect from the mobility models. The
+   * hit and miss counters are kept.
+   */
+  void Clear (void);
+
+  /**
+   * \return the number of entries, including the outdated ones
+   */
+  std::size_t GetN (void) const;
+
+  /**
+   * \return the number of lookups that found a valid entry
+   */
+  uint64_t GetHits (void) const;
+
+  /**
+   * \return the number of lookups that did not find a valid entry
+   */
+  uint64_t GetMisses (void) const;
+
+private:
+  /// An entry of the hash table, empty if txPhy is null
+  struct Entry
+  {
+    Ptr<const SpectrumPhy> txPhy;  //!< the transmitter
+    Ptr<const SpectrumPhy> rxPhy;  //!< the receiver
+    uint32_t txMobility;           //!< index of the mobility model of the transmitter in m_mobilities
+    uint32_t rxMobility;           //!< index of the mobility model of the receiver in m_mobilities
+    uint32_t txVersion;            //!< version of the mobility model of the transmitter
+    uint32_t rxVersion;            //!< version of the mobility model of the receiver
+    double gainDb;                 //!< the propagation gain [dB]
+  };
+
+  /// A mobility model the cache is connected to
+  struct MobilityInfo
+  {
+    Ptr<MobilityModel> mobility;   //!< the mobility model
+    uint32_t version;              //!< number of course changes notified
+  };
+
+  /**
+   * Find the slot of a pair of phys, i.e., either the slot of its entry
+   * or the empty slot where it would be inserted
+   *
+   * \param txPhy the transmitter
+   * \param rxPhy the receiver
+   * \return the index of the slot in m_slots, which must not be empty
+   */
+  std::size_t FindSlot (const SpectrumPhy *txPhy, const SpectrumPhy *rxPhy) const;
+
+  /**
+   * Check whether an entry refers to the current versions of the given
+   * mobility models
+   *
+   * \param entry the entry
+   * \param txMobility the mobility model of the transmitter
+   * \param rxMobility the mobility model of the receiver
+   * \return true if the entry is valid
+   */
+  bool IsValid (const Entry &entry, const MobilityModel *txMobility, const MobilityModel *rxMobility) const;
+
+  /**
+   * Get the index of a mobility model in m_mobilities, connecting to its
+   * CourseChange trace the first time it is seen
+   *
+   * \param mobility the mobility model
+   * \return the index
+   */
+  uint32_t GetMobilityIndex (Ptr<MobilityModel> mobility);
+
+  /**
+   * Double the capacity of the hash table
+   */
+  void Grow (void);
+
+  /**
+   * Sink of the CourseChange trace of the mobility models
+   *
+   * \param mobility the MobilityModel that notified the change
+   */
+  void CourseChanged (Ptr<const MobilityModel> mobility);
+
+  std::vector<Entry> m_slots;                       //!< the hash table, whose size is a power of two
+  std::size_t m_n;                                  //!< number of non-empty slots
+  std::vector<MobilityInfo> m_mobilities;           //!< the mobility models of the cached phys
+  std::unordered_map<const MobilityModel *, uint32_t> m_mobilityIndex; //!< index in m_mobilities, by mobility model
+  uint64_t m_hits;                                  //!< number of lookups that found a valid entry
+  uint64_t m_misses;                                //!< number of lookups that did not find a valid entry
+};
+
+} // namespace ns3
+
+#endif /* SPECTRUM_PATH_LOSS_CACHE_H */
@@ -0,0 +1,253 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <ns3/log.h>
+#include <ns3/callback.h>
+#include "spectrum-phy-grid-index.h"
+
+namespace ns3 {
+
+NS_LOG_COMPONENT_DEFINE ("SpectrumPhyGridIndex");
+
+SpectrumPhyGridIndex::SpectrumPhyGridIndex (double cellSize)
+  : m_cellSize (cellSize),
+    m_nextId (0)
+{
+  NS_LOG_FUNCTION (this << cellSize);
+  NS_ASSERT_MSG (cellSize > 0, "The cell size of the grid must be positive");
+}
+
+SpectrumPhyGridIndex::~SpectrumPhyGridIndex ()
+{
+  NS_LOG_FUNCTION (this);
+  // disconnect from the mobility models, which may outlive the index
+  for (std::map<uint64_t, Entry>::iterator it = m_entries.begin (); it != m_entries.end (); ++it)
+    {
+      if (it->second.mobility)
+        {
+          std::map<const MobilityModel *, std::vector<uint64_t> >::iterator mIt = m_idsByMobility.find (PeekPointer (it->second.mobility));
+          if (mIt != m_idsByMobility.end ())
+            {
+              it->second.mobility->TraceDisconnectWithoutContext ("CourseChange", MakeCallback (&SpectrumPhyGridIndex::CourseChanged, this));
+              m_idsByMobility.erase (mIt);
+            }
+        }
+    }
+}
+
+double
+SpectrumPhyGridIndex::GetCellSize (void) const
+{
+  return m_cellSize;
+}
+
+std::size_t
+SpectrumPhyGridIndex::GetN (void) const
+{
+  return m_entries.size ();
+}
+
+SpectrumPhyGridIndex::CellKey_t
+SpectrumPhyGridIndex::MakeCellKey (int64_t x, int64_t y)
+{
+  return (static_cast<uint64_t> (static_cast<uint32_t> (x)) << 32) | static_cast<uint32_t> (y);
+}
+
+int64_t
+SpectrumPhyGridIndex::GetCellCoordinate (double value) const
+{
+  return static_cast<int64_t> (std::floor (value / m_cellSize));
+}
+
+void
+SpectrumPhyGridIndex::Add (Ptr<SpectrumPhy> phy)
+{
+  NS_LOG_FUNCTION (this << phy);
+  Remove (phy);
+
+  uint64_t id = m_nextId++;
+  Entry entry;
+  entry.phy = phy;
+  entry.mobility = phy->GetMobility ();
+  entry.binned = false;
+  entry.cell = 0;
+
+  if (entry.mobility)
+    {
+      std::vector<uint64_t> &ids = m_idsByMobility[PeekPointer (entry.mobility)];
+      if (ids.empty ())
+        {
+          entry.mobility->TraceConnectWithoutContext ("CourseChange", MakeCallback (&SpectrumPhyGridIndex::CourseChanged, this));
+        }
+      ids.push_back (id);
+    }
+
+  std::pair<std::map<uint64_t, Entry>::iterator, bool> ret = m_entries.insert (std::make_pair (id, entry));
+  NS_ASSERT (ret.second);
+  m_idByPhy[phy] = id;
+  Bin (id, ret.first->second);
+}
+
+void
+SpectrumPhyGridIndex::Remove (Ptr<SpectrumPhy> phy)
+{
+  NS_LOG_FUNCTION (this << phy);
+  std::map<Ptr<SpectrumPhy>, uint64_t>::iterator phyIt = m_idByPhy.find (phy);
+  if (phyIt == m_idByPhy.end ())
+    {
+      return;
+    }
+  uint64_t id = phyIt->second;
+  m_idByPhy.erase (phyIt);
+
+  std::map<uint64_t, Entry>::iterator it = m_entries.find (id);
+  NS_ASSERT (it != m_entries.end ());
+  Unbin (id, it->second);
+
+  if (it->second.mobility)
+    {
+      const MobilityModel *mobility = PeekPointer (it->second.mobility);
+      std::vector<uint64_t> &ids = m_idsByMobility[mobility];
+      ids.erase (std::remove (ids.begin (), ids.end (), id), ids.end ());
+      if (ids.empty ())
+        {
+          it->second.mobility->TraceDisconnectWithoutContext ("CourseChange", MakeCallback (&SpectrumPhyGridIndex::CourseChanged, this));
+          m_idsByMobility.erase (mobility);
+          m_changedMobility.erase (mobility);
+        }
+    }
+  m_entries.erase (it);
+}
+
+void
+SpectrumPhyGridIndex::Bin (uint64_t id, Entry &entry)
+{
+  if (entry.mobility && entry.mobility->GetVelocity ().GetLength () == 0)
+    {
+      Vector position = entry.mobility->GetPosition ();
+      entry.cell = MakeCellKey (GetCellCoordinate (position.x), GetCellCoordinate (position.y));
+      entry.binned = true;
+      m_cells[entry.cell].push_back (id);
+    }
+  else
+    {
+      entry.binned = false;
+      m_unbinned.insert (id);
+    }
+}
+
+void
+SpectrumPhyGridIndex::Unbin (uint64_t id, Entry &entry)
+{
+  if (entry.binned)
+    {
+      std::unordered_map<CellKey_t, std::vector<uint64_t> >::iterator cellIt = m_cells.find (entry.cell);
+      NS_ASSERT (cellIt != m_cells.end ());
+      std::vector<uint64_t> &ids = cellIt->second;
+      ids.erase (std::remove (ids.begin (), ids.end (), id), ids.end ());
+      if (ids.empty ())
+        {
+          m_cells.erase (cellIt);
+        }
+      entry.binned = false;
+    }
+  else
+    {
+      m_unbinned.erase (id);
+    }
+}
+
+void
+SpectrumPhyGridIndex::CourseChanged (Ptr<const MobilityModel> mobility)
+{
+  m_changedMobility.insert (PeekPointer (mobility));
+}
+
+void
+SpectrumPhyGridIndex::UpdateChangedEntries (void)
+{
+  for (std::set<const MobilityModel *>::const_iterator mIt = m_changedMobility.begin ();
+       mIt != m_changedMobility.end ();
+       ++mIt)
+    {
+      std::map<const MobilityModel *, std::vector<uint64_t> >::const_iterator idsIt = m_idsByMobility.find (*mIt);
+      if (idsIt == m_idsByMobility.end ())
+        {
+          continue;
+        }
+      for (std::vector<uint64_t>::const_iterator idIt = idsIt->second.begin (); idIt != idsIt->second.end (); ++idIt)
+        {
+          Entry &entry = m_entries.find (*idIt)->second;
+          Unbin (*idIt, entry);
+          Bin (*idIt, entry);
+        }
+    }
+  m_changedMobility.clear ();
+}
+
+void
+SpectrumPhyGridIndex::GetPhysInRange (const Vector &position, double range, std::vector<Ptr<SpectrumPhy> > &phys)
+{
+  NS_LOG_FUNCTION (this << position << range);
+  UpdateChangedEntries ();
+
+  std::vector<uint64_t> candidates (m_unbinned.begin (), m_unbinned.end ());
+  int64_t xMin = GetCellCoordinate (position.x - range);
+  int64_t xMax = GetCellCoordinate (position.x + range);
+  int64_t yMin = GetCellCoordinate (position.y - range);
+  int64_t yMax = GetCellCoordinate (position.y + range);
+  double nCells = (static_cast<double> (xMax - xMin) + 1) * (static_cast<double> (yMax - yMin) + 1);
+  if (nCells > m_cells.size ())
+    {
+      // the search area covers more cells than the populated ones
+      for (std::unordered_map<CellKey_t, std::vector<uint64_t> >::const_iterator cellIt = m_cells.begin ();
+           cellIt != m_cells.end ();
+           ++cellIt)
+        {
+          candidates.insert (candidates.end (), cellIt->second.begin (), cellIt->second.end ());
+        }
+    }
+  else
+    {
+      for (int64_t x = xMin; x <= xMax; ++x)
+        {
+          for (int64_t y = yMin; y <= yMax; ++y)
+            {
+              std::unordered_map<CellKey_t, std::vector<uint64_t> >::const_iterator cellIt = m_cells.find (MakeCellKey (x, y));
+              if (cellIt != m_cells.end ())
+                {
+                  candidates.insert (candidates.end (), cellIt->second.begin (), cellIt->second.end ());
+                }
+            }
+        }
+    }
+  std::sort (candidates.begin (), candidates.end ());
+
+  phys.clear ();
+  for (std::vector<uint64_t>::const_iterator idIt = candidates.begin (); idIt != candidates.end (); ++idIt)
+    {
+      const Entry &entry = m_entries.find (*idIt)->second;
+      if (entry.mobility == 0 || CalculateDistance (position, entry.mobility->GetPosition ()) <= range)
+        {
+          phys.push_back (entry.phy);
+        }
+    }
+  NS_LOG_LOGIC ("found " << phys.size () << " phys in range out of " << m_entries.size ());
+}
+
+} // namespace ns3
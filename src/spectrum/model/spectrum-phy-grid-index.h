@@ -0,0 +1,169 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef SPECTRUM_PHY_GRID_INDEX_H
+#define SPECTRUM_PHY_GRID_INDEX_H
+
+#include <ns3/simple-ref-count.h>
+#include <ns3/ptr.h>
+#include <ns3/vector.h>
+#include <ns3/spectrum-phy.h>
+#include <ns3/mobility-model.h>
+#include <map>
+#include <set>
+#include <unordered_map>
+#include <vector>
+
+namespace ns3 {
+
+/**
+ * \ingroup spectrum
+ *
+ * Uniform 2D grid over the positions of a set of SpectrumPhy instances,
+ * used by the spectrum channels to find the receivers that lie within a
+ * given range of a transmitter without visiting every attached phy.
+ *
+ * A phy whose MobilityModel reports a zero velocity is stored in the
+ * grid cell of its current position. The cell is only recomputed after
+ * the MobilityModel fires its CourseChange trace, i.e., the index is
+ * updated lazily at the next query. Phys that are moving are kept
+ * outside of the grid and are tested against the exact distance at every
+ * query, so that models which update their position continuously
+ * without notifying a course change (e.g., ConstantVelocityMobilityModel)
+ * are handled correctly. Phys without a MobilityModel are always
+ * returned.
+ *
+ * The phys returned by GetPhysInRange are sorted in the order in which
+ * they were added to the index, so that a channel iterating over them
+ * schedules events in the same order as when iterating over all its
+ * receivers.
+ */
+class SpectrumPhyGridIndex : public SimpleRefCount<SpectrumPhyGridIndex>
+{
+public:
+  /**
+   * Create an index
+   *
+   * \param cellSize the side of a grid cell, in meters
+   */
+  SpectrumPhyGridIndex (double cellSize);
+  ~SpectrumPhyGridIndex ();
+
+  /**
+   * \return the side of a grid cell, in meters
+   */
+  double GetCellSize (void) const;
+
+  /**
+   * Add a phy to the index. The phy is considered to be the most recently
+   * added one, even if it was already present in the index.
+   *
+   * \param phy the phy to be added
+   */
+  void Add (Ptr<SpectrumPhy> phy);
+
+  /**
+   * Remove a phy from the index, if present
+   *
+   * \param phy the phy to be removed
+   */
+  void Remove (Ptr<SpectrumPhy> phy);
+
+  /**
+   * \return the number of phys in the index
+   */
+  std::size_t GetN (void) const;
+
+  /**
+   * Find all the phys whose distance from a given position is not larger
+   * than the given range. Phys without a MobilityModel are always
+   * included.
+   *
+   * \param position the center of the search
+   * \param range the search radius, in meters
+   * \param phys the vector where the phys are stored, in insertion order
+   */
+  void GetPhysInRange (const Vector &position, double range, std::vector<Ptr<SpectrumPhy> > &phys);
+
+private:
+  /// Grid cell key, packing the two signed cell coordinates
+  typedef uint64_t CellKey_t;
+
+  /// Information kept for each phy of the index
+  struct Entry
+  {
+    Ptr<SpectrumPhy> phy;         //!< the phy
+    Ptr<MobilityModel> mobility;  //!< the mobility model of the phy, if any
+    bool binned;                  //!< true if the phy is stored in a grid cell
+    CellKey_t cell;               //!< the grid cell of the phy, if binned
+  };
+
+  /**
+   * \param x the cell coordinate along the x axis
+   * \param y the cell coordinate along the y axis
+   * \return the key of the cell
+   */
+  static CellKey_t MakeCellKey (int64_t x, int64_t y);
+
+  /**
+   * \param value a coordinate, in meters
+   * \return the grid coordinate of the cell containing it
+   */
+  int64_t GetCellCoordinate (double value) const;
+
+  /**
+   * Store an entry in the grid cell of its current position, or among
+   * the unbinned entries if it is moving or has no MobilityModel
+   *
+   * \param id the identifier of the entry
+   * \param entry the entry
+   */
+  void Bin (uint64_t id, Entry &entry);
+
+  /**
+   * Remove an entry from its grid cell or from the unbinned entries
+   *
+   * \param id the identifier of the entry
+   * \param entry the entry
+   */
+  void Unbin (uint64_t id, Entry &entry);
+
+  /**
+   * Recompute the cells of the entries whose MobilityModel notified a
+   * course change since the last query
+   */
+  void UpdateChangedEntries (void);
+
+  /**
+   * Sink of the CourseChange trace of the MobilityModels of the phys
+   *
+   * \param mobility the MobilityModel that notified the change
+   */
+  void CourseChanged (Ptr<const MobilityModel> mobility);
+
+  double m_cellSize;                                             //!< side of a grid cell [m]
+  uint64_t m_nextId;                                             //!< identifier of the next added entry
+  std::map<uint64_t, Entry> m_entries;                           //!< entries, by identifier
+  std::map<Ptr<SpectrumPhy>, uint64_t> m_idByPhy;                //!< identifier of each phy
+  std::unordered_map<CellKey_t, std::vector<uint64_t> > m_cells; //!< entry identifiers, by grid cell
+  std::set<uint64_t> m_unbinned;                                 //!< entries which are not in a grid cell
+  std::map<const MobilityModel *, std::vector<uint64_t> > m_idsByMobility; //!< entry identifiers, by MobilityModel
+  std::set<const MobilityModel *> m_changedMobility;             //!< MobilityModels that changed course since last query
+};
+
+} // namespace ns3
+
+#endif /* SPECTRUM_PHY_GRID_INDEX_H */
@@ -22,11 +22,328 @@
 #include <ns3/spectrum-value.h>
 #include <ns3/math.h>
 #include <ns3/log.h>
+#include <new>
+
+#if defined (__AVX__) || defined (__SSE2__)
+#include <immintrin.h>
+#endif
 
 namespace ns3 {
 
 NS_LOG_COMPONENT_DEFINE ("SpectrumValue");
 
+namespace {
+
+/// A free block of the SpectrumValuePool
+struct FreeBlock
+{
+  FreeBlock *next; //!< the next free block of the same size
+};
+
+/// Number of block sizes recycled by the SpectrumValuePool
+const std::size_t POOL_SIZES = SpectrumValuePool::MAX_POOLED_BYTES / sizeof (double) + 1;
+
+// The free lists are trivially destructible, so that they can still be
+// accessed by the SpectrumValue instances destroyed after the
+// PoolReleaser of the same thread.
+thread_local FreeBlock *g_freeBlocks[POOL_SIZES];   //!< free blocks, by size in doubles
+thread_local uint32_t g_nFreeBlocks[POOL_SIZES];    //!< number of free blocks, by size in doubles
+thread_local bool g_poolReleased = false;           //!< true after the thread pool has been released
+
+/**
+ * Return the free blocks of a thread to the heap when the thread exits
+ */
+struct PoolReleaser
+{
+  ~PoolReleaser ()
+  {
+    for (std::size_t i = 0; i < POOL_SIZES; ++i)
+      {
+        while (g_freeBlocks[i] != 0)
+          {
+            FreeBlock *block = g_freeBlocks[i];
+            g_freeBlocks[i] = block->next;
+            ::operator delete (block);
+          }
+        g_nFreeBlocks[i] = 0;
+      }
+    g_poolReleased = true;
+  }
+};
+
+thread_local PoolReleaser g_poolReleaser; //!< releases the pool of the thread
+
+/**
+ * \param bytes the size of a block
+ * \return the index of the free list of the block, or 0 if it is not pooled
+ */
+inline std::size_t
+GetPoolIndex (std::size_t bytes)
+{
+  if (bytes < sizeof (FreeBlock) || bytes > SpectrumValuePool::MAX_POOLED_BYTES || bytes % sizeof (double) != 0)
+    {
+      return 0;
+    }
+  return bytes / sizeof (double);
+}
+
+} // unnamed namespace
+
+void*
+SpectrumValuePool::Allocate (std::size_t bytes)
+{
+  std::size_t index = GetPoolIndex (bytes);
+  if (index != 0 && g_freeBlocks[index] != 0)
+    {
+      FreeBlock *block = g_freeBlocks[index];
+      g_freeBlocks[index] = block->next;
+      --g_nFreeBlocks[index];
+      return block;
+    }
+  return ::operator new (bytes);
+}
+
+void
+SpectrumValuePool::Deallocate (void *p, std::size_t bytes)
+{
+  std::size_t index = GetPoolIndex (bytes);
+  if (index != 0 && !g_poolReleased && g_nFreeBlocks[index] < MAX_FREE_BLOCKS)
+    {
+      // make sure that the pool is released when the thread exits
+      static_cast<void> (&g_poolReleaser);
+      FreeBlock *block = static_cast<FreeBlock *> (p);
+      block->next = g_freeBlocks[index];
+      g_freeBlocks[index] = block;
+      ++g_nFreeBlocks[index];
+      return;
+    }
+  ::operator delete (p);
+}
+
+namespace {
+
+/*
+ * Element-wise kernels used by the SpectrumValue arithmetic.
+ *
+ * The kernels are vectorized with AVX or SSE2 when the compiler targets
+ * them, and fall back to a scalar loop otherwise and for the remainder
+ * of the values. Only additions, subtractions, multiplications and
+ * divisions are used, without fused multiply-add, so that the result is
+ * bit by bit identical to the scalar evaluation of the same expression.
+ */
+
+/// x + y
+struct AddOp
+{
+  static double Apply (double x, double y)
+  {
+    return x + y;
+  }
+#if defined (__AVX__)
+  static __m256d Apply (__m256d x, __m256d y)
+  {
+    return _mm256_add_pd (x, y);
+  }
+#endif
+#if defined (__SSE2__)
+  static __m128d Apply (__m128d x, __m128d y)
+  {
+    return _mm_add_pd (x, y);
+  }
+#endif
+};
+
+/// x - y
+struct SubOp
+{
+  static double Apply (double x, double y)
+  {
+    return x - y;
+  }
+#if defined (__AVX__)
+  static __m256d Apply (__m256d x, __m256d y)
+  {
+    return _mm256_sub_pd (x, y);
+  }
+#endif
+#if defined (__SSE2__)
+  static __m128d Apply (__m128d x, __m128d y)
+  {
+    return _mm_sub_pd (x, y);
+  }
+#endif
+};
+
+/// x * y
+struct MulOp
+{
+  static double Apply (double x, double y)
+  {
+    return x * y;
+  }
+#if defined (__AVX__)
+  static __m256d Apply (__m256d x, __m256d y)
+  {
+    return _mm256_mul_pd (x, y);
+  }
+#endif
+#if defined (__SSE2__)
+  static __m128d Apply (__m128d x, __m128d y)
+  {
+    return _mm_mul_pd (x, y);
+  }
+#endif
+};
+
+/// x / y
+struct DivOp
+{
+  static double Apply (double x, double y)
+  {
+    return x / y;
+  }
+#if defined (__AVX__)
+  static __m256d Apply (__m256d x, __m256d y)
+  {
+    return _mm256_div_pd (x, y);
+  }
+#endif
+#if defined (__SSE2__)
+  static __m128d Apply (__m128d x, __m128d y)
+  {
+    return _mm_div_pd (x, y);
+  }
+#endif
+};
+
+/**
+ * out[i] = Op (a[i], b[i])
+ * \param out the result, which may alias a or b
+ * \param a the first operand
+ * \param b the second operand
+ * \param n the number of values
+ */
+template <class Op>
+void
+ApplyKernel (double *out, const double *a, const double *b, std::size_t n)
+{
+  std::size_t i = 0;
+#if defined (__AVX__)
+  for (; i + 4 <= n; i += 4)
+    {
+      _mm256_storeu_pd (out + i, Op::Apply (_mm256_loadu_pd (a + i), _mm256_loadu_pd (b + i)));
+    }
+#elif defined (__SSE2__)
+  for (; i + 2 <= n; i += 2)
+    {
+      _mm_storeu_pd (out + i, Op::Apply (_mm_loadu_pd (a + i), _mm_loadu_pd (b + i)));
+    }
+#endif
+  for (; i < n; ++i)
+    {
+      out[i] = Op::Apply (a[i], b[i]);
+    }
+}
+
+/**
+ * out[i] = Op (a[i], s)
+ * \param out the result, which may alias a
+ * \param a the first operand
+ * \param s the flat second operand
+ * \param n the number of values
+ */
+template <class Op>
+void
+ApplyKernel (double *out, const double *a, double s, std::size_t n)
+{
+  std::size_t i = 0;
+#if defined (__AVX__)
+  __m256d s4 = _mm256_set1_pd (s);
+  for (; i + 4 <= n; i += 4)
+    {
+      _mm256_storeu_pd (out + i, Op::Apply (_mm256_loadu_pd (a + i), s4));
+    }
+#elif defined (__SSE2__)
+  __m128d s2 = _mm_set1_pd (s);
+  for (; i + 2 <= n; i += 2)
+    {
+      _mm_storeu_pd (out + i, Op::Apply (_mm_loadu_pd (a + i), s2));
+    }
+#endif
+  for (; i < n; ++i)
+    {
+      out[i] = Op::Apply (a[i], s);
+    }
+}
+
+/**
+ * out[i] = Op2 (Op1 (a[i], b[i]), c[i])
+ * \param out the result, which may alias any operand
+ * \param a the first operand
+ * \param b the second operand
+ * \param c the third operand
+ * \param n the number of values
+ */
+template <class Op1, class Op2>
+void
+ApplyKernel (double *out, const double *a, const double *b, const double *c, std::size_t n)
+{
+  std::size_t i = 0;
+#if defined (__AVX__)
+  for (; i + 4 <= n; i += 4)
+    {
+      __m256d t = Op1::Apply (_mm256_loadu_pd (a + i), _mm256_loadu_pd (b + i));
+      _mm256_storeu_pd (out + i, Op2::Apply (t, _mm256_loadu_pd (c + i)));
+    }
+#elif defined (__SSE2__)
+  for (; i + 2 <= n; i += 2)
+    {
+      __m128d t = Op1::Apply (_mm_loadu_pd (a + i), _mm_loadu_pd (b + i));
+      _mm_storeu_pd (out + i, Op2::Apply (t, _mm_loadu_pd (c + i)));
+    }
+#endif
+  for (; i < n; ++i)
+    {
+      double t = Op1::Apply (a[i], b[i]);
+      out[i] = Op2::Apply (t, c[i]);
+    }
+}
+
+/**
+ * out[i] = Op2 (c[i], Op1 (a[i], b[i]))
+ * \param out the result, which may alias any operand
+ * \param c the first operand of Op2
+ * \param a the first operand of Op1
+ * \param b the second operand of Op1
+ * \param n the number of values
+ */
+template <class Op1, class Op2>
+void
+ApplyKernelRight (double *out, const double *c, const double *a, const double *b, std::size_t n)
+{
+  std::size_t i = 0;
+#if defined (__AVX__)
+  for (; i + 4 <= n; i += 4)
+    {
+      __m256d t = Op1::Apply (_mm256_loadu_pd (a + i), _mm256_loadu_pd (b + i));
+      _mm256_storeu_pd (out + i, Op2::Apply (_mm256_loadu_pd (c + i), t));
+    }
+#elif defined (__SSE2__)
+  for (; i + 2 <= n; i += 2)
+    {
+      __m128d t = Op1::Apply (_mm_loadu_pd (a + i), _mm_loadu_pd (b + i));
+      _mm_storeu_pd (out + i, Op2::Apply (_mm_loadu_pd (c + i), t));
+    }
+#endif
+  for (; i < n; ++i)
+    {
+      double t = Op1::Apply (a[i], b[i]);
+      out[i] = Op2::Apply (c[i], t);
+    }
+}
+
+} // unnamed namespace
+
 SpectrumValue::SpectrumValue ()
 {
 }
@@ -106,31 +423,16 @@ SpectrumValue::ConstBandsEnd () const
 void
 SpectrumValue::Add (const SpectrumValue& x)
 {
-  Values::iterator it1 = m_values.begin ();
-  Values::const_iterator it2 = x.m_values.begin ();
-
   NS_ASSERT (m_spectrumModel == x.m_spectrumModel);
-
-  while (it1 != m_values.end ())
-    {
-      NS_ASSERT ( it2 != x.m_values.end ());
-      *it1 += *it2;
-      ++it1;
-      ++it2;
-    }
+  NS_ASSERT (m_values.size () == x.m_values.size ());
+  ApplyKernel<AddOp> (m_values.data (), m_values.data (), x.m_values.data (), m_values.size ());
 }
 
 
 void
 SpectrumValue::Add (double s)
 {
-  Values::iterator it1 = m_values.begin ();
-
-  while (it1 != m_values.end ())
-    {
-      *it1 += s;
-      ++it1;
-    }
+  ApplyKernel<AddOp> (m_values.data (), m_values.data (), s, m_values.size ());
 }
 
 
@@ -138,18 +440,9 @@ SpectrumValue::Add (double s)
 void
 SpectrumValue::Subtract (const SpectrumValue& x)
 {
-  Values::iterator it1 = m_values.begin ();
-  Values::const_iterator it2 = x.m_values.begin ();
-
   NS_ASSERT (m_spectrumModel == x.m_spectrumModel);
-
-  while (it1 != m_values.end ())
-    {
-      NS_ASSERT ( it2 != x.m_values.end ());
-      *it1 -= *it2;
-      ++it1;
-      ++it2;
-    }
+  NS_ASSERT (m_values.size () == x.m_values.size ());
+  ApplyKernel<SubOp> (m_values.data (), m_values.data (), x.m_values.data (), m_values.size ());
 }
 
 
@@ -164,31 +457,16 @@ SpectrumValue::Subtract (double s)
 void
 SpectrumValue::Multiply (const SpectrumValue& x)
 {
-  Values::iterator it1 = m_values.begin ();
-  Values::const_iterator it2 = x.m_values.begin ();
-
   NS_ASSERT (m_spectrumModel == x.m_spectrumModel);
-
-  while (it1 != m_values.end ())
-    {
-      NS_ASSERT ( it2 != x.m_values.end ());
-      *it1 *= *it2;
-      ++it1;
-      ++it2;
-    }
+  NS_ASSERT (m_values.size () == x.m_values.size ());
+  ApplyKernel<MulOp> (m_values.data (), m_values.data (), x.m_values.data (), m_values.size ());
 }
 
 
 void
 SpectrumValue::Multiply (double s)
 {
-  Values::iterator it1 = m_values.begin ();
-
-  while (it1 != m_values.end ())
-    {
-      *it1 *= s;
-      ++it1;
-    }
+  ApplyKernel<MulOp> (m_values.data (), m_values.data (), s, m_values.size ());
 }
 
 
@@ -197,18 +475,9 @@ SpectrumValue::Multiply (double s)
 void
 SpectrumValue::Divide (const SpectrumValue& x)
 {
-  Values::iterator it1 = m_values.begin ();
-  Values::const_iterator it2 = x.m_values.begin ();
-
   NS_ASSERT (m_spectrumModel == x.m_spectrumModel);
-
-  while (it1 != m_values.end ())
-    {
-      NS_ASSERT ( it2 != x.m_values.end ());
-      *it1 /= *it2;
-      ++it1;
-      ++it2;
-    }
+  NS_ASSERT (m_values.size () == x.m_values.size ());
+  ApplyKernel<DivOp> (m_values.data (), m_values.data (), x.m_values.data (), m_values.size ());
 }
 
 
@@ -216,13 +485,7 @@ void
 SpectrumValue::Divide (double s)
 {
   NS_LOG_FUNCTION (this << s);
-  Values::iterator it1 = m_values.begin ();
-
-  while (it1 != m_values.end ())
-    {
-      *it1 /= s;
-      ++it1;
-    }
+  ApplyKernel<DivOp> (m_values.data (), m_values.data (), s, m_values.size ());
 }
 
 
@@ -674,6 +937,78 @@ SpectrumValue::operator= (double rhs)
   return *this;
 }
 
+SpectrumValue&
+SpectrumValue::AddProduct (const SpectrumValue& x, const SpectrumValue& y)
+{
+  NS_ASSERT (m_spectrumModel == x.m_spectrumModel);
+  NS_ASSERT (m_spectrumModel == y.m_spectrumModel);
+  ApplyKernelRight<MulOp, AddOp> (m_values.data (), m_values.data (), x.m_values.data (), y.m_values.data (), m_values.size ());
+  return *this;
+}
+
+SpectrumValue&
+SpectrumValue::AddScaled (const SpectrumValue& x, double s)
+{
+  NS_ASSERT (m_spectrumModel == x.m_spectrumModel);
+  double *out = m_values.data ();
+  const double *a = x.m_values.data ();
+  std::size_t n = m_values.size ();
+  std::size_t i = 0;
+#if defined (__AVX__)
+  __m256d s4 = _mm256_set1_pd (s);
+  for (; i + 4 <= n; i += 4)
+    {
+      __m256d t = _mm256_mul_pd (_mm256_loadu_pd (a + i), s4);
+      _mm256_storeu_pd (out + i, _mm256_add_pd (_mm256_loadu_pd (out + i), t));
+    }
+#elif defined (__SSE2__)
+  __m128d s2 = _mm_set1_pd (s);
+  for (; i + 2 <= n; i += 2)
+    {
+      __m128d t = _mm_mul_pd (_mm_loadu_pd (a + i), s2);
+      _mm_storeu_pd (out + i, _mm_add_pd (_mm_loadu_pd (out + i), t));
+    }
+#endif
+  for (; i < n; ++i)
+    {
+      double t = a[i] * s;
+      out[i] += t;
+    }
+  return *this;
+}
+
+SpectrumValue&
+SpectrumValue::SetInterferencePlusNoise (const SpectrumValue& total, const SpectrumValue& signal, const SpectrumValue& noise)
+{
+  NS_ASSERT (total.m_spectrumModel == signal.m_spectrumModel);
+  NS_ASSERT (total.m_spectrumModel == noise.m_spectrumModel);
+  m_spectrumModel = total.m_spectrumModel;
+  m_values.resize (total.m_values.size ());
+  ApplyKernel<SubOp, AddOp> (m_values.data (), total.m_values.data (), signal.m_values.data (), noise.m_values.data (), m_values.size ());
+  return *this;
+}
+
+SpectrumValue&
+SpectrumValue::SetSinr (const SpectrumValue& signal, const SpectrumValue& interferencePlusNoise)
+{
+  NS_ASSERT (signal.m_spectrumModel == interferencePlusNoise.m_spectrumModel);
+  m_spectrumModel = signal.m_spectrumModel;
+  m_values.resize (signal.m_values.size ());
+  ApplyKernel<DivOp> (m_values.data (), signal.m_values.data (), interferencePlusNoise.m_values.data (), m_values.size ());
+  return *this;
+}
+
+SpectrumValue&
+SpectrumValue::SetSinr (const SpectrumValue& signal, const SpectrumValue& interference, const SpectrumValue& noise)
+{
+  NS_ASSERT (signal.m_spectrumModel == interference.m_spectrumModel);
+  NS_ASSERT (signal.m_spectrumModel == noise.m_spectrumModel);
+  m_spectrumModel = signal.m_spectrumModel;
+  m_values.resize (signal.m_values.size ());
+  ApplyKernelRight<AddOp, DivOp> (m_values.data (), signal.m_values.data (), interference.m_values.data (), noise.m_values.data (), m_values.size ());
+  return *this;
+}
+
 
 
 SpectrumValue
@@ -26,12 +26,104 @@
 #include <ns3/spectrum-model.h>
 #include <ostream>
 #include <vector>
+#include <cstddef>
 
 namespace ns3 {
 
+/**
+ * \ingroup spectrum
+ *
+ * Per-thread pool of the memory blocks used to store the values of
+ * SpectrumValue instances.
+ *
+ * Blocks of up to MAX_POOLED_BYTES are not returned to the heap when
+ * released, but kept in a free list indexed by their size and handed
+ * out again to the next SpectrumValue of the same size. Since all the
+ * SpectrumValue instances of a simulation share a small number of
+ * SpectrumModel sizes (e.g., 25 to 100 RBs in LTE), the temporaries
+ * created by the arithmetic operators do not reach the heap once the
+ * pool is warm.
+ */
+class SpectrumValuePool
+{
+public:
+  /// Largest block size, in bytes, which is recycled by the pool
+  static const std::size_t MAX_POOLED_BYTES = 512 * sizeof (double);
+  /// Maximum number of free blocks kept for each block size
+  static const uint32_t MAX_FREE_BLOCKS = 4096;
+
+  /**
+   * \param bytes the size of the block
+   * \return a block of the given size
+   */
+  static void* Allocate (std::size_t bytes);
+  /**
+   * \param p a block returned by Allocate
+   * \param bytes the size of the block
+   */
+  static void Deallocate (void *p, std::size_t bytes);
+};
+
+/**
+ * \ingroup spectrum
+ *
+ * Standard allocator drawing its memory from the SpectrumValuePool.
+ */
+template <class T>
+class SpectrumValueAllocator
+{
+public:
+  typedef T value_type; //!< the type of the allocated elements
+
+  SpectrumValueAllocator () = default;
+  /**
+   * Rebinding constructor
+   * \param other an allocator of another type
+   */
+  template <class U>
+  SpectrumValueAllocator (const SpectrumValueAllocator<U> &other)
+  {
+  }
+
+  /**
+   * \param n the number of elements
+   * \return the storage for n elements
+   */
+  T* allocate (std::size_t n)
+  {
+    return static_cast<T*> (SpectrumValuePool::Allocate (n * sizeof (T)));
+  }
+
+  /**
+   * \param p the storage returned by allocate
+   * \param n the number of elements
+   */
+  void deallocate (T *p, std::size_t n)
+  {
+    SpectrumValuePool::Deallocate (p, n * sizeof (T));
+  }
+};
+
+/**
+ * \return true, since all the SpectrumValueAllocator instances share the same pool
+ */
+template <class T, class U>
+bool operator== (const SpectrumValueAllocator<T> &, const SpectrumValueAllocator<U> &)
+{
+  return true;
+}
+
+/**
+ * \return false, since all the SpectrumValueAllocator instances share the same pool
+ */
+template <class T, class U>
+bool operator!= (const SpectrumValueAllocator<T> &, const SpectrumValueAllocator<U> &)
+{
+  return false;
+}
 
 /// Container for element values
-typedef std::vector<double> Values;
+typedef std::vector<double, SpectrumValueAllocator<double> > Values;
 
 /**
  * \ingroup spectrum
@@ -420,6 +512,75 @@ public:
    */
   SpectrumValue& operator= (double rhs);
 
+  /**
+   * Add the element by element product of two SpectrumValue to *this,
+   * i.e., *this += x * y, without creating any temporary
+   *
+   * @param x the first factor
+   * @param y the second factor
+   *
+   * @return a reference to *this
+   */
+  SpectrumValue& AddProduct (const SpectrumValue& x, const SpectrumValue& y);
+
+  /**
+   * Add a SpectrumValue scaled by a flat value to *this,
+   * i.e., *this += x * s, without creating any temporary
+   *
+   * @param x the SpectrumValue
+   * @param s the scaling factor
+   *
+   * @return a reference to *this
+   */
+  SpectrumValue& AddScaled (const SpectrumValue& x, double s);
+
+  /**
+   * Add all the SpectrumValue instances pointed by a range of
+   * iterators (e.g., over a container of Ptr<SpectrumValue>) to *this
+   *
+   * @param first the beginning of the range
+   * @param last the end of the range
+   *
+   * @return a reference to *this
+   */
+  template <class InputIterator>
+  SpectrumValue& Accumulate (InputIterator first, InputIterator last);
+
+  /**
+   * Set *this to the interference plus noise seen by a signal,
+   * i.e., *this = total - signal + noise, without creating any temporary
+   *
+   * @param total the power of all the signals, including the one of interest
+   * @param signal the power of the signal of interest
+   * @param noise the noise power
+   *
+   * @return a reference to *this
+   */
+  SpectrumValue& SetInterferencePlusNoise (const SpectrumValue& total, const SpectrumValue& signal, const SpectrumValue& noise);
+
+  /**
+   * Set *this to the SINR of a signal, i.e., *this = signal / interferencePlusNoise,
+   * without creating any temporary
+   *
+   * @param signal the power of the signal
+   * @param interferencePlusNoise the power of the interference plus noise
+   *
+   * @return a reference to *this
+   */
+  SpectrumValue& SetSinr (const SpectrumValue& signal, const SpectrumValue& interferencePlusNoise);
+
+  /**
+   * Set *this to the SINR of a signal, i.e., *this = signal / (interference + noise),
+   * without creating any temporary
+   *
+   * @param signal the power of the signal
+   * @param interference the power of the interference
+   * @param noise the noise power
+   *
+   * @return a reference to *this
+   */
+  SpectrumValue& SetSinr (const SpectrumValue& signal, const SpectrumValue& interference, const SpectrumValue& noise);
+
 
 
   /**
@@ -632,6 +793,18 @@ SpectrumValue Log (const SpectrumValue& arg);
 double Integral (const SpectrumValue& arg);
 
 
+template <class InputIterator>
+SpectrumValue&
+SpectrumValue::Accumulate (InputIterator first, InputIterator last)
+{
+  for (; first != last; ++first)
+    {
+      Add (**first);
+    }
+  return *this;
+}
+
+
 } // namespace ns3
 
 #endif /* SPECTRUM_VALUE_H */
@@ -0,0 +1,185 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include <ns3/object.h>
+#include <ns3/test.h>
+#include <ns3/packet.h>
+#include <ns3/flow-id-tag.h>
+#include <ns3/socket.h>
+#include <ns3/nstime.h>
+#include <ns3/distributed-spectrum-signal-codec.h>
+
+using namespace ns3;
+
+/**
+ * \ingroup spectrum-test
+ *
+ * Test that DistributedSpectrumHeader gets the signal back from the
+ * message sent to the other systems.
+ */
+class DistributedSpectrumHeaderTestCase : public TestCase
+{
+public:
+  DistributedSpectrumHeaderTestCase ();
+  virtual ~DistributedSpectrumHeaderTestCase ();
+
+private:
+  virtual void DoRun (void);
+};
+
+DistributedSpectrumHeaderTestCase::DistributedSpectrumHeaderTestCase ()
+  : TestCase ("Check the serialization of DistributedSpectrumHeader")
+{
+}
+
+DistributedSpectrumHeaderTestCase::~DistributedSpectrumHeaderTestCase ()
+{
+}
+
+void
+DistributedSpectrumHeaderTestCase::DoRun (void)
+{
+  Bands bands;
+  for (uint32_t i = 0; i < 3; i++)
+    {
+      BandInfo band;
+      band.fl = 2.4e9 + i * 1e6;
+      band.fc = band.fl + 0.5e6;
+      band.fh = band.fl + 1e6;
+      bands.push_back (band);
+    }
+  Ptr<SpectrumModel> model = Create<SpectrumModel> (bands);
+  Ptr<SpectrumValue> psd = Create<SpectrumValue> (model);
+  (*psd)[0] = 1.5e-19;
+  (*psd)[1] = 0;
+  (*psd)[2] = 3.25e-21;
+
+  DistributedSpectrumHeader sent;
+  sent.SetTxTime (NanoSeconds (123456789));
+  sent.SetDuration (MicroSeconds (250));
+  sent.SetTxDevice (7, 2);
+  sent.SetTxAntenna (true);
+  sent.SetCodec (0x89abcdef);
+  sent.SetPsd (psd);
+  Ptr<Packet> p = Create<Packet> (10);
+  p->AddHeader (sent);
+  NS_TEST_ASSERT_MSG_EQ (p->GetSize (), 10 + sent.GetSerializedSize (), "unexpected message size");
+
+  DistributedSpectrumHeader received;
+  p->RemoveHeader (received);
+  NS_TEST_ASSERT_MSG_EQ (p->GetSize (), 10u, "payload not left in the message");
+  NS_TEST_ASSERT_MSG_EQ (received.GetTxTime (), NanoSeconds (123456789), "wrong tx time");
+  NS_TEST_ASSERT_MSG_EQ (received.GetDuration (), MicroSeconds (250), "wrong duration");
+  NS_TEST_ASSERT_MSG_EQ (received.GetTxNode (), 7u, "wrong tx node");
+  NS_TEST_ASSERT_MSG_EQ (received.GetTxDevice (), 2u, "wrong tx device");
+  NS_TEST_ASSERT_MSG_EQ (received.HasTxAntenna (), true, "wrong tx antenna");
+  NS_TEST_ASSERT_MSG_EQ (received.GetCodec (), 0x89abcdef, "wrong codec");
+  NS_TEST_ASSERT_MSG_EQ (received.GetSpectrumModelUid (), model->GetUid (), "wrong SpectrumModel uid");
+  NS_TEST_ASSERT_MSG_EQ (received.GetBands ().size (), 3u, "wrong number of bands");
+  for (uint32_t i = 0; i < 3; i++)
+    {
+      NS_TEST_EXPECT_MSG_EQ (received.GetBands ()[i].fl, bands[i].fl, "wrong band " << i);
+      NS_TEST_EXPECT_MSG_EQ (received.GetBands ()[i].fc, bands[i].fc, "wrong band " << i);
+      NS_TEST_EXPECT_MSG_EQ (received.GetBands ()[i].fh, bands[i].fh, "wrong band " << i);
+      NS_TEST_EXPECT_MSG_EQ (received.GetPsdValues ()[i], (*psd)[i], "wrong PSD value " << i);
+    }
+}
+
+/**
+ * \ingroup spectrum-test
+ *
+ * Test that DistributedSpectrumSignalCodec writes the packets with their
+ * packet tags and byte tags.
+ */
+class DistributedSpectrumPacketTestCase : public TestCase
+{
+public:
+  DistributedSpectrumPacketTestCase ();
+  virtual ~DistributedSpectrumPacketTestCase ();
+
+private:
+  virtual void DoRun (void);
+};
+
+DistributedSpectrumPacketTestCase::DistributedSpectrumPacketTestCase ()
+  : TestCase ("Check the serialization of packets with tags")
+{
+}
+
+DistributedSpectrumPacketTestCase::~DistributedSpectrumPacketTestCase ()
+{
+}
+
+void
+DistributedSpectrumPacketTestCase::DoRun (void)
+{
+  Ptr<Packet> sent = Create<Packet> (8);
+  Ptr<Packet> tagged = Create<Packet> (12);
+  tagged->AddByteTag (FlowIdTag (5));
+  sent->AddAtEnd (tagged);
+  sent->AddAtEnd (Create<Packet> (4));
+  SocketIpTtlTag ttl;
+  ttl.SetTtl (42);
+  sent->AddPacketTag (ttl);
+
+  uint32_t size = DistributedSpectrumSignalCodec::GetPacketSerializedSize (sent);
+  Buffer buffer;
+  buffer.AddAtStart (size);
+  Buffer::Iterator i = buffer.Begin ();
+  DistributedSpectrumSignalCodec::SerializePacket (i, sent);
+  NS_TEST_ASSERT_MSG_EQ (i.IsEnd (), true, "wrong serialized size");
+
+  i = buffer.Begin ();
+  Ptr<Packet> received = DistributedSpectrumSignalCodec::DeserializePacket (i);
+  NS_TEST_ASSERT_MSG_EQ (i.IsEnd (), true, "packet not read whole");
+  NS_TEST_ASSERT_MSG_EQ (received->GetSize (), sent->GetSize (), "wrong packet size");
+  NS_TEST_ASSERT_MSG_EQ (received->GetUid (), sent->GetUid (), "wrong packet uid");
+
+  SocketIpTtlTag receivedTtl;
+  NS_TEST_ASSERT_MSG_EQ (received->PeekPacketTag (receivedTtl), true, "packet tag lost");
+  NS_TEST_EXPECT_MSG_EQ ((uint16_t) receivedTtl.GetTtl (), 42, "wrong packet tag");
+
+  ByteTagIterator byteTags = received->GetByteTagIterator ();
+  NS_TEST_ASSERT_MSG_EQ (byteTags.HasNext (), true, "byte tag lost");
+  ByteTagIterator::Item item = byteTags.Next ();
+  FlowIdTag flowId;
+  item.GetTag (flowId);
+  NS_TEST_EXPECT_MSG_EQ (flowId.GetFlowId (), 5u, "wrong byte tag");
+  NS_TEST_EXPECT_MSG_EQ (item.GetStart (), 8u, "wrong byte tag start");
+  NS_TEST_EXPECT_MSG_EQ (item.GetEnd (), 20u, "wrong byte tag end");
+  NS_TEST_EXPECT_MSG_EQ (byteTags.HasNext (), false, "unexpected byte tag");
+}
+
+/**
+ * \ingroup spectrum-test
+ *
+ * Test suite of the messages sent by DistributedSpectrumChannel to the
+ * other systems.
+ */
+class DistributedSpectrumSignalCodecTestSuite : public TestSuite
+{
+public:
+  DistributedSpectrumSignalCodecTestSuite ();
+};
+
+DistributedSpectrumSignalCodecTestSuite::DistributedSpectrumSignalCodecTestSuite ()
+  : TestSuite ("distributed-spectrum-signal-codec", UNIT)
+{
+  AddTestCase (new DistributedSpectrumHeaderTestCase, TestCase::QUICK);
+  AddTestCase (new DistributedSpectrumPacketTestCase, TestCase::QUICK);
+}
+
+static DistributedSpectrumSignalCodecTestSuite g_distributedSpectrumSignalCodecTestSuite; ///< the test suite
@@ -0,0 +1,213 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include <ns3/object.h>
+#include <ns3/log.h>
+#include <ns3/test.h>
+#include <ns3/simulator.h>
+#include <ns3/half-duplex-ideal-phy.h>
+#include <ns3/constant-position-mobility-model.h>
+#include <ns3/constant-velocity-mobility-model.h>
+#include <ns3/propagation-loss-model.h>
+#include <ns3/multi-model-spectrum-channel.h>
+#include <ns3/spectrum-signal-parameters.h>
+#include <ns3/wifi-spectrum-value-helper.h>
+#include <ns3/boolean.h>
+#include <ns3/uinteger.h>
+
+using namespace ns3;
+
+/**
+ * \ingroup spectrum-test
+ *
+ * Propagation loss model counting its evaluations, whose gain is the
+ * opposite of the distance
+ */
+class CountingPropagationLossModel : public PropagationLossModel
+{
+public:
+  CountingPropagationLossModel ();
+
+  uint32_t m_calls; ///< number of evaluations
+
+private:
+  virtual double DoCalcRxPower (double txPowerDbm, Ptr<MobilityModel> a, Ptr<MobilityModel> b) const;
+  virtual int64_t DoAssignStreams (int64_t stream);
+};
+
+CountingPropagationLossModel::CountingPropagationLossModel ()
+  : m_calls (0)
+{
+}
+
+double
+CountingPropagationLossModel::DoCalcRxPower (double txPowerDbm, Ptr<MobilityModel> a, Ptr<MobilityModel> b) const
+{
+  const_cast<CountingPropagationLossModel *> (this)->m_calls++;
+  return txPowerDbm - a->GetDistanceFrom (b);
+}
+
+int64_t
+CountingPropagationLossModel::DoAssignStreams (int64_t stream)
+{
+  return 0;
+}
+
+/**
+ * \ingroup spectrum-test
+ *
+ * Test that MultiModelSpectrumChannel only evaluates the propagation loss
+ * model again for the pairs of phys which have moved, and reports the
+ * same loss as without the cache.
+ */
+class SpectrumPathLossCacheTestCase : public TestCase
+{
+public:
+  SpectrumPathLossCacheTestCase ();
+  virtual ~SpectrumPathLossCacheTestCase ();
+
+private:
+  virtual void DoRun (void);
+  /**
+   * PathLoss trace sink
+   * \param txPhy the transmitter
+   * \param rxPhy the receiver
+   * \param lossDb the loss
+   */
+  void PathLoss (Ptr<const SpectrumPhy> txPhy, Ptr<const SpectrumPhy> rxPhy, double lossDb);
+  /**
+   * Transmit from a phy, and check the number of evaluations of the
+   * propagation loss model and the losses reported
+   * \param txPhy the transmitter
+   * \param expectedCalls the expected number of evaluations
+   * \param msg the message in case of failure
+   */
+  void Transmit (Ptr<HalfDuplexIdealPhy> txPhy, uint32_t expectedCalls, std::string msg);
+
+  Ptr<MultiModelSpectrumChannel> m_channel;     ///< the channel
+  Ptr<CountingPropagationLossModel> m_loss;     ///< the propagation loss model
+  Ptr<SpectrumValue> m_txPsd;                   ///< the transmitted PSD
+};
+
+SpectrumPathLossCacheTestCase::SpectrumPathLossCacheTestCase ()
+  : TestCase ("Check the propagation gains cached by MultiModelSpectrumChannel")
+{
+}
+
+SpectrumPathLossCacheTestCase::~SpectrumPathLossCacheTestCase ()
+{
+}
+
+void
+SpectrumPathLossCacheTestCase::PathLoss (Ptr<const SpectrumPhy> txPhy, Ptr<const SpectrumPhy> rxPhy, double lossDb)
+{
+  double distance = ConstCast<SpectrumPhy> (txPhy)->GetMobility ()->GetDistanceFrom (ConstCast<SpectrumPhy> (rxPhy)->GetMobility ());
+  NS_TEST_EXPECT_MSG_EQ_TOL (lossDb, distance, 1e-9, "unexpected loss");
+}
+
+void
+SpectrumPathLossCacheTestCase::Transmit (Ptr<HalfDuplexIdealPhy> txPhy, uint32_t expectedCalls, std::string msg)
+{
+  Ptr<SpectrumSignalParameters> params = Create<SpectrumSignalParameters> ();
+  params->duration = MilliSeconds (1);
+  params->psd = m_txPsd;
+  params->txPhy = txPhy;
+  m_loss->m_calls = 0;
+  m_channel->StartTx (params);
+  NS_TEST_ASSERT_MSG_EQ (m_loss->m_calls, expectedCalls, msg << ": unexpected number of evaluations");
+}
+
+void
+SpectrumPathLossCacheTestCase::DoRun (void)
+{
+  m_channel = CreateObject<MultiModelSpectrumChannel> ();
+  m_channel->SetAttribute ("PathLossCache", BooleanValue (true));
+  m_channel->TraceConnectWithoutContext ("PathLoss", MakeCallback (&SpectrumPathLossCacheTestCase::PathLoss, this));
+  m_loss = CreateObject<CountingPropagationLossModel> ();
+  m_channel->AddPropagationLossModel (m_loss);
+
+  WifiSpectrumValue5MhzFactory sf;
+  m_txPsd = sf.CreateTxPowerSpectralDensity (0.1, 1);
+
+  std::vector<Ptr<HalfDuplexIdealPhy> > phys;
+  for (uint32_t i = 0; i < 4; i++)
+    {
+      Ptr<ConstantPositionMobilityModel> mobility = CreateObject<ConstantPositionMobilityModel> ();
+      mobility->SetPosition (Vector (10 * i, 0, 0));
+      Ptr<HalfDuplexIdealPhy> phy = CreateObject<HalfDuplexIdealPhy> ();
+      phy->SetMobility (mobility);
+      phy->SetTxPowerSpectralDensity (m_txPsd);
+      phy->SetChannel (m_channel);
+      m_channel->AddRx (phy);
+      phys.push_back (phy);
+    }
+  Ptr<ConstantVelocityMobilityModel> moving = CreateObject<ConstantVelocityMobilityModel> ();
+  moving->SetPosition (Vector (0, 10, 0));
+  moving->SetVelocity (Vector (1, 0, 0));
+  Ptr<HalfDuplexIdealPhy> movingPhy = CreateObject<HalfDuplexIdealPhy> ();
+  movingPhy->SetMobility (moving);
+  movingPhy->SetTxPowerSpectralDensity (m_txPsd);
+  movingPhy->SetChannel (m_channel);
+  m_channel->AddRx (movingPhy);
+
+  Transmit (phys[0], 4, "first transmission");
+  Transmit (phys[0], 1, "second transmission");
+  Transmit (phys[1], 4, "other transmitter");
+  Transmit (phys[1], 1, "other transmitter again");
+
+  // a static phy relocated through SetPosition invalidates its pairs
+  phys[2]->GetMobility ()->SetPosition (Vector (50, 50, 0));
+  Transmit (phys[0], 2, "after course change of a receiver");
+  Transmit (phys[2], 4, "after course change of the transmitter");
+  Transmit (phys[2], 1, "after course change of the transmitter again");
+
+  // a phy that stops moving is cached after its course change
+  moving->SetVelocity (Vector (0, 0, 0));
+  Transmit (phys[0], 1, "after the moving phy stopped");
+  Transmit (phys[0], 0, "all pairs cached");
+
+  UintegerValue hits;
+  UintegerValue misses;
+  m_channel->GetAttribute ("PathLossCacheHits", hits);
+  m_channel->GetAttribute ("PathLossCacheMisses", misses);
+  NS_TEST_ASSERT_MSG_EQ (hits.Get (), 18, "unexpected number of hits");
+  NS_TEST_ASSERT_MSG_EQ (misses.Get (), 18, "unexpected number of misses");
+
+  Simulator::Destroy ();
+  m_channel->Dispose ();
+  m_channel = 0;
+  m_loss = 0;
+}
+
+
+/**
+ * \ingroup spectrum-test
+ *
+ * Test suite for the path loss cache of MultiModelSpectrumChannel
+ */
+class SpectrumPathLossCacheTestSuite : public TestSuite
+{
+public:
+  SpectrumPathLossCacheTestSuite ();
+};
+
+SpectrumPathLossCacheTestSuite::SpectrumPathLossCacheTestSuite ()
+  : TestSuite ("spectrum-path-loss-cache", UNIT)
+{
+  AddTestCase (new SpectrumPathLossCacheTestCase, TestCase::QUICK);
+}
+
+static SpectrumPathLossCacheTestSuite g_spectrumPathLossCacheTestSuite;
@@ -0,0 +1,257 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include <ns3/object.h>
+#include <ns3/log.h>
+#include <ns3/test.h>
+#include <ns3/simulator.h>
+#include <ns3/half-duplex-ideal-phy.h>
+#include <ns3/constant-position-mobility-model.h>
+#include <ns3/constant-velocity-mobility-model.h>
+#include <ns3/spectrum-phy-grid-index.h>
+#include <ns3/multi-model-spectrum-channel.h>
+#include <ns3/spectrum-signal-parameters.h>
+#include <ns3/wifi-spectrum-value-helper.h>
+#include <ns3/double.h>
+
+using namespace ns3;
+
+/**
+ * \ingroup spectrum-test
+ *
+ * Test that SpectrumPhyGridIndex returns exactly the phys within range,
+ * in insertion order, and follows the position changes of the phys.
+ */
+class SpectrumPhyGridIndexTestCase : public TestCase
+{
+public:
+  SpectrumPhyGridIndexTestCase ();
+  virtual ~SpectrumPhyGridIndexTestCase ();
+
+private:
+  virtual void DoRun (void);
+  /**
+   * Create a phy with the given mobility model
+   * \param mobility the mobility model, or 0
+   * \return the phy
+   */
+  Ptr<SpectrumPhy> CreatePhy (Ptr<MobilityModel> mobility);
+  /**
+   * Check the result of a query
+   * \param index the index
+   * \param position the center of the query
+   * \param range the range of the query
+   * \param expected the expected phys
+   * \param msg the message in case of failure
+   */
+  void CheckQuery (Ptr<SpectrumPhyGridIndex> index, Vector position, double range,
+                   std::vector<Ptr<SpectrumPhy> > expected, std::string msg);
+};
+
+SpectrumPhyGridIndexTestCase::SpectrumPhyGridIndexTestCase ()
+  : TestCase ("Check the receivers returned by SpectrumPhyGridIndex")
+{
+}
+
+SpectrumPhyGridIndexTestCase::~SpectrumPhyGridIndexTestCase ()
+{
+}
+
+Ptr<SpectrumPhy>
+SpectrumPhyGridIndexTestCase::CreatePhy (Ptr<MobilityModel> mobility)
+{
+  Ptr<HalfDuplexIdealPhy> phy = CreateObject<HalfDuplexIdealPhy> ();
+  phy->SetMobility (mobility);
+  return phy;
+}
+
+void
+SpectrumPhyGridIndexTestCase::CheckQuery (Ptr<SpectrumPhyGridIndex> index, Vector position, double range,
+                                          std::vector<Ptr<SpectrumPhy> > expected, std::string msg)
+{
+  std::vector<Ptr<SpectrumPhy> > phys;
+  index->GetPhysInRange (position, range, phys);
+  NS_TEST_ASSERT_MSG_EQ (phys.size (), expected.size (), msg << ": unexpected number of phys");
+  for (std::size_t i = 0; i < std::min (phys.size (), expected.size ()); ++i)
+    {
+      NS_TEST_ASSERT_MSG_EQ (phys.at (i), expected.at (i), msg << ": unexpected phy at position " << i);
+    }
+}
+
+void
+SpectrumPhyGridIndexTestCase::DoRun (void)
+{
+  Ptr<ConstantPositionMobilityModel> m0 = CreateObject<ConstantPositionMobilityModel> ();
+  m0->SetPosition (Vector (0, 0, 0));
+  Ptr<ConstantPositionMobilityModel> m1 = CreateObject<ConstantPositionMobilityModel> ();
+  m1->SetPosition (Vector (-90, 30, 1.5));
+  Ptr<ConstantPositionMobilityModel> m2 = CreateObject<ConstantPositionMobilityModel> ();
+  m2->SetPosition (Vector (1000, 0, 0));
+  Ptr<ConstantVelocityMobilityModel> m3 = CreateObject<ConstantVelocityMobilityModel> ();
+  m3->SetPosition (Vector (0, 500, 0));
+  m3->SetVelocity (Vector (0, -100, 0));
+
+  Ptr<SpectrumPhy> p0 = CreatePhy (m0);
+  Ptr<SpectrumPhy> p1 = CreatePhy (m1);
+  Ptr<SpectrumPhy> p2 = CreatePhy (m2);
+  Ptr<SpectrumPhy> p3 = CreatePhy (m3);
+  Ptr<SpectrumPhy> p4 = CreatePhy (0);
+
+  Ptr<SpectrumPhyGridIndex> index = Create<SpectrumPhyGridIndex> (100.0);
+  index->Add (p4);
+  index->Add (p0);
+  index->Add (p1);
+  index->Add (p2);
+  index->Add (p3);
+  NS_TEST_ASSERT_MSG_EQ (index->GetN (), 5, "unexpected number of phys in the index");
+
+  CheckQuery (index, Vector (0, 0, 0), 100, {p4, p0, p1}, "initial positions");
+  CheckQuery (index, Vector (0, 0, 0), 1e6, {p4, p0, p1, p2, p3}, "infinite range");
+  CheckQuery (index, Vector (950, 0, 0), 100, {p4, p2}, "far query");
+
+  // static phy relocated through SetPosition
+  m2->SetPosition (Vector (50, 0, 0));
+  CheckQuery (index, Vector (0, 0, 0), 100, {p4, p0, p1, p2}, "after course change");
+
+  // moving phy reaches the query area without any course change
+  Simulator::Schedule (Seconds (4.5), &SpectrumPhyGridIndexTestCase::CheckQuery, this,
+                       index, Vector (0, 0, 0), 100, std::vector<Ptr<SpectrumPhy> > {p4, p0, p1, p2, p3}, "moving phy");
+  Simulator::Run ();
+
+  // removal and re-insertion moves the phy to the end of the order
+  index->Remove (p0);
+  CheckQuery (index, Vector (0, 0, 0), 100, {p4, p1, p2, p3}, "after removal");
+  index->Add (p0);
+  CheckQuery (index, Vector (0, 0, 0), 100, {p4, p1, p2, p3, p0}, "after re-insertion");
+  index->Add (p0);
+  NS_TEST_ASSERT_MSG_EQ (index->GetN (), 5, "a phy added twice must be stored once");
+  Simulator::Destroy ();
+}
+
+
+/**
+ * \ingroup spectrum-test
+ *
+ * Test that MultiModelSpectrumChannel only evaluates the loss towards
+ * the receivers within MaxRange of the transmitter.
+ */
+class SpectrumChannelMaxRangeTestCase : public TestCase
+{
+public:
+  /**
+   * Constructor
+   * \param maxRange the MaxRange attribute of the channel
+   * \param expectedRx the expected number of receivers
+   */
+  SpectrumChannelMaxRangeTestCase (double maxRange, uint32_t expectedRx);
+  virtual ~SpectrumChannelMaxRangeTestCase ();
+
+private:
+  virtual void DoRun (void);
+  /**
+   * PathLoss trace sink
+   * \param txPhy the transmitter
+   * \param rxPhy the receiver
+   * \param lossDb the loss
+   */
+  void PathLoss (Ptr<const SpectrumPhy> txPhy, Ptr<const SpectrumPhy> rxPhy, double lossDb);
+
+  double m_maxRange;     ///< the MaxRange attribute of the channel
+  uint32_t m_expectedRx; ///< the expected number of receivers
+  uint32_t m_rx;         ///< the number of receivers for which the loss was computed
+};
+
+SpectrumChannelMaxRangeTestCase::SpectrumChannelMaxRangeTestCase (double maxRange, uint32_t expectedRx)
+  : TestCase ("Check the receivers reached with MaxRange = " + std::to_string (static_cast<int> (maxRange)) + " m"),
+    m_maxRange (maxRange),
+    m_expectedRx (expectedRx),
+    m_rx (0)
+{
+}
+
+SpectrumChannelMaxRangeTestCase::~SpectrumChannelMaxRangeTestCase ()
+{
+}
+
+void
+SpectrumChannelMaxRangeTestCase::PathLoss (Ptr<const SpectrumPhy> txPhy, Ptr<const SpectrumPhy> rxPhy, double lossDb)
+{
+  ++m_rx;
+}
+
+void
+SpectrumChannelMaxRangeTestCase::DoRun (void)
+{
+  Ptr<MultiModelSpectrumChannel> channel = CreateObject<MultiModelSpectrumChannel> ();
+  channel->SetAttribute ("MaxRange", DoubleValue (m_maxRange));
+  channel->TraceConnectWithoutContext ("PathLoss", MakeCallback (&SpectrumChannelMaxRangeTestCase::PathLoss, this));
+
+  WifiSpectrumValue5MhzFactory sf;
+  Ptr<SpectrumValue> txPsd = sf.CreateTxPowerSpectralDensity (0.1, 1);
+
+  std::vector<Ptr<HalfDuplexIdealPhy> > phys;
+  double distances[] = {0, 10, 150, 1000, 5000};
+  for (double distance : distances)
+    {
+      Ptr<ConstantPositionMobilityModel> mobility = CreateObject<ConstantPositionMobilityModel> ();
+      mobility->SetPosition (Vector (distance, 0, 0));
+      Ptr<HalfDuplexIdealPhy> phy = CreateObject<HalfDuplexIdealPhy> ();
+      phy->SetMobility (mobility);
+      phy->SetTxPowerSpectralDensity (txPsd);
+      phy->SetChannel (channel);
+      channel->AddRx (phy);
+      phys.push_back (phy);
+    }
+
+  Ptr<SpectrumSignalParameters> params = Create<SpectrumSignalParameters> ();
+  params->duration = MilliSeconds (1);
+  params->psd = txPsd;
+  params->txPhy = phys.front ();
+  channel->StartTx (params);
+  NS_TEST_ASSERT_MSG_EQ (m_rx, m_expectedRx, "unexpected number of receivers");
+
+  // a receiver moving in range must be reached
+  phys.back ()->GetMobility ()->SetPosition (Vector (0, 5, 0));
+  m_rx = 0;
+  channel->StartTx (params);
+  NS_TEST_ASSERT_MSG_EQ (m_rx, m_expectedRx + (m_maxRange > 0 ? 1 : 0), "unexpected number of receivers after move");
+
+  Simulator::Destroy ();
+  channel->Dispose ();
+}
+
+
+/**
+ * \ingroup spectrum-test
+ *
+ * Test suite for SpectrumPhyGridIndex
+ */
+class SpectrumPhyGridIndexTestSuite : public TestSuite
+{
+public:
+  SpectrumPhyGridIndexTestSuite ();
+};
+
+SpectrumPhyGridIndexTestSuite::SpectrumPhyGridIndexTestSuite ()
+  : TestSuite ("spectrum-phy-grid-index", UNIT)
+{
+  AddTestCase (new SpectrumPhyGridIndexTestCase, TestCase::QUICK);
+  AddTestCase (new SpectrumChannelMaxRangeTestCase (0, 4), TestCase::QUICK);
+  AddTestCase (new SpectrumChannelMaxRangeTestCase (200, 2), TestCase::QUICK);
+  AddTestCase (new SpectrumChannelMaxRangeTestCase (2000, 3), TestCase::QUICK);
+}
+
+static SpectrumPhyGridIndexTestSuite g_spectrumPhyGridIndexTestSuite;
@@ -242,6 +242,30 @@ SpectrumValueTestSuite::SpectrumValueTestSuite ()
   AddTestCase (new SpectrumValueTestCase (tv1rs3, v1rs3, "tv1rs3 = v1 >> 3"), TestCase::QUICK);
 
 
+  SpectrumValue tv11 (f), tv12 (f), tv13 (f), tv14 (f), tv15 (f), tv16;
+  tv11 = v3;
+  tv11.AddProduct (v1, v2);
+  AddTestCase (new SpectrumValueTestCase (tv11, v3 + v1 * v2, "tv11 = v3 + v1 * v2"), TestCase::QUICK);
+  tv12 = v3;
+  tv12.AddScaled (v1, doubleValue);
+  AddTestCase (new SpectrumValueTestCase (tv12, v3 + v1 * doubleValue, "tv12 = v3 + v1 * doubleValue"), TestCase::QUICK);
+  tv13.SetInterferencePlusNoise (v3, v1, v10);
+  AddTestCase (new SpectrumValueTestCase (tv13, v3 - v1 + v10, "tv13 = v3 - v1 + v10"), TestCase::QUICK);
+  tv14.SetSinr (v1, v2);
+  AddTestCase (new SpectrumValueTestCase (tv14, v6, "tv14 = v1 div v2"), TestCase::QUICK);
+  tv15.SetSinr (v1, v2, v7);
+  AddTestCase (new SpectrumValueTestCase (tv15, v1 / (v2 + v7), "tv15 = v1 div (v2 + v7)"), TestCase::QUICK);
+  // the result takes the SpectrumModel of the operands
+  tv16.SetSinr (v1, v2);
+  AddTestCase (new SpectrumValueTestCase (tv16, v6, "tv16 = v1 div v2"), TestCase::QUICK);
+  std::vector<Ptr<SpectrumValue> > signals;
+  signals.push_back (Create<SpectrumValue> (v1));
+  signals.push_back (Create<SpectrumValue> (v2));
+  SpectrumValue tv17 (f);
+  tv17.Accumulate (signals.begin (), signals.end ());
+  AddTestCase (new SpectrumValueTestCase (tv17, v3, "tv17 = sum (v1, v2)"), TestCase::QUICK);
+
+
 }
 
 
@@ -26,6 +26,7 @@
 #include "wifi-phy.h"
 #include "error-rate-model.h"
 #include "wifi-utils.h"
+#include <algorithm>
 
 namespace ns3 {
 
@@ -122,6 +123,7 @@ InterferenceHelper::NiChange::GetEvent (void) const
 InterferenceHelper::InterferenceHelper ()
   : m_errorRateModel (0),
     m_numRxAntennas (1),
+    m_niChangesPeakSize (0),
     m_firstPower (0),
     m_rxing (false)
 {
@@ -199,6 +201,7 @@ void
 InterferenceHelper::AppendEvent (Ptr<Event> event)
 {
   NS_LOG_FUNCTION (this);
+  PruneNiChanges ();
   double previousPowerStart = 0;
   double previousPowerEnd = 0;
   previousPowerStart = GetPreviousPosition (event->GetStartTime ())->second.GetPower ();
@@ -207,15 +210,45 @@ InterferenceHelper::AppendEvent (Ptr<Event> event)
   if (!m_rxing)
     {
       m_firstPower = previousPowerStart;
-      // Always leave the first zero power noise event in the list
-      m_niChanges.erase (++(m_niChanges.begin ()),
-                         GetNextPosition (event->GetStartTime ()));
+      // Always leave the first NiChange in the list, before the event start
+      m_niChanges.erase (m_niChanges.cbegin () + 1, GetNextPosition (event->GetStartTime ()));
     }
-  auto first = AddNiChangeEvent (event->GetStartTime (), NiChange (previousPowerStart, event));
-  auto last = AddNiChangeEvent (event->GetEndTime (), NiChange (previousPowerEnd, event));
-  for (auto i = first; i != last; ++i)
+  std::size_t first = AddNiChangeEvent (event->GetStartTime (), NiChange (previousPowerStart, event));
+  std::size_t last = AddNiChangeEvent (event->GetEndTime (), NiChange (previousPowerEnd, event));
+  for (std::size_t i = first; i != last; ++i)
     {
-      i->second.AddPower (event->GetRxPowerW ());
+      m_niChanges[i].second.AddPower (event->GetRxPowerW ());
+    }
+  m_niChangesPeakSize = std::max (m_niChangesPeakSize, m_niChanges.size ());
+}
+
+void
+InterferenceHelper::PruneNiChanges (void)
+{
+  NS_LOG_FUNCTION (this);
+  Time now = Simulator::Now ();
+  // Find the oldest NiChange of an event still on the air, or from now on
+  auto it = m_niChanges.cbegin ();
+  for (; it != m_niChanges.cend (); ++it)
+    {
+      if (it->first >= now
+          || (it->second.GetEvent () != 0 && it->second.GetEvent ()->GetEndTime () >= now))
+        {
+          break;
+        }
+    }
+  if (it == m_niChanges.cend ())
+    {
+      return;
+    }
+  // Keep the last NiChange before it, which holds the power at that time
+  Time oldest = std::min (now, it->first);
+  auto keep = std::lower_bound (m_niChanges.cbegin (), m_niChanges.cend (), oldest,
+                                [] (const NiChanges::value_type &change, Time t)
+                                { return change.first < t; });
+  if (keep - m_niChanges.cbegin () > 1)
+    {
+      m_niChanges.erase (m_niChanges.begin (), m_niChanges.begin () + (keep - m_niChanges.cbegin () - 1));
     }
 }
 
@@ -235,22 +268,20 @@ InterferenceHelper::CalculateSnr (double signal, double noiseInterference, uint1
 }
 
 double
-InterferenceHelper::CalculateNoiseInterferenceW (Ptr<Event> event, NiChanges *ni) const
+InterferenceHelper::CalculateNoiseInterferenceW (Ptr<Event> event, NiChangesView *ni) const
 {
   double noiseInterferenceW = m_firstPower;
-  auto it = m_niChanges.find (event->GetStartTime ());
+  auto it = Find (event->GetStartTime ());
   for (; it != m_niChanges.end () && it->first < Simulator::Now (); ++it)
     {
       noiseInterferenceW = it->second.GetPower () - event->GetRxPowerW ();
     }
-  it = m_niChanges.find (event->GetStartTime ());
+  it = Find (event->GetStartTime ());
   for (; it != m_niChanges.end () && it->second.GetEvent () != event; ++it);
-  ni->emplace (event->GetStartTime (), NiChange (0, event));
-  while (++it != m_niChanges.end () && it->second.GetEvent () != event)
-    {
-      ni->insert (*it);
-    }
-  ni->emplace (event->GetEndTime (), NiChange (0, event));
+  ni->first = it;
+  while (++it != m_niChanges.end () && it->second.GetEvent () != event);
+  NS_ASSERT_MSG (it != m_niChanges.end (), "No NiChange at the end of the event");
+  ni->second = ++it;
   NS_ASSERT_MSG (noiseInterferenceW >= 0, "CalculateNoiseInterferenceW returns negative value " << noiseInterferenceW);
   return noiseInterferenceW;
 }
@@ -278,12 +309,12 @@ InterferenceHelper::CalculateChunkSuccessRate (double snir, Time duration, WifiM
 }
 
 double
-InterferenceHelper::CalculatePayloadPer (Ptr<const Event> event, NiChanges *ni, std::pair<Time, Time> window) const
+InterferenceHelper::CalculatePayloadPer (Ptr<const Event> event, const NiChangesView &ni, std::pair<Time, Time> window) const
 {
   NS_LOG_FUNCTION (this << window.first << window.second);
   const WifiTxVector txVector = event->GetTxVector ();
   double psr = 1.0; /* Packet Success Rate */
-  auto j = ni->begin ();
+  auto j = ni.first;
   Time previous = j->first;
   WifiMode payloadMode = event->GetPayloadMode ();
   WifiPreamble preamble = txVector.GetPreambleType ();
@@ -295,7 +326,7 @@ InterferenceHelper::CalculatePayloadPer (Ptr<const Event> event, NiChanges *ni,
   Time windowEnd = plcpPayloadStart + window.second;
   double noiseInterferenceW = m_firstPower;
   double powerW = event->GetRxPowerW ();
-  while (++j != ni->end ())
+  while (++j != ni.second)
     {
       Time current = j->first;
       NS_LOG_DEBUG ("previous= " << previous << ", current=" << current);
@@ -334,12 +365,12 @@ InterferenceHelper::CalculatePayloadPer (Ptr<const Event> event, NiChanges *ni,
 }
 
 double
-InterferenceHelper::CalculateLegacyPhyHeaderPer (Ptr<const Event> event, NiChanges *ni) const
+InterferenceHelper::CalculateLegacyPhyHeaderPer (Ptr<const Event> event, const NiChangesView &ni) const
 {
   NS_LOG_FUNCTION (this);
   const WifiTxVector txVector = event->GetTxVector ();
   double psr = 1.0; /* Packet Success Rate */
-  auto j = ni->begin ();
+  auto j = ni.first;
   Time previous = j->first;
   WifiPreamble preamble = txVector.GetPreambleType ();
   WifiMode headerMode = WifiPhy::GetPlcpHeaderMode (txVector);
@@ -349,7 +380,7 @@ InterferenceHelper::CalculateLegacyPhyHeaderPer (Ptr<const Event> event, NiChang
   Time plcpPayloadStart = plcpTrainingSymbolsStart + WifiPhy::GetPlcpTrainingSymbolDuration (txVector) + WifiPhy::GetPlcpSigBDuration (preamble); //packet start time + preamble + L-SIG + HT-SIG or SIG-A + Training + SIG-B
   double noiseInterferenceW = m_firstPower;
   double powerW = event->GetRxPowerW ();
-  while (++j != ni->end ())
+  while (++j != ni.second)
     {
       Time current = j->first;
       NS_LOG_DEBUG ("previous= " << previous << ", current=" << current);
@@ -478,12 +509,12 @@ InterferenceHelper::CalculateLegacyPhyHeaderPer (Ptr<const Event> event, NiChang
 }
 
 double
-InterferenceHelper::CalculateNonLegacyPhyHeaderPer (Ptr<const Event> event, NiChanges *ni) const
+InterferenceHelper::CalculateNonLegacyPhyHeaderPer (Ptr<const Event> event, const NiChangesView &ni) const
 {
   NS_LOG_FUNCTION (this);
   const WifiTxVector txVector = event->GetTxVector ();
   double psr = 1.0; /* Packet Success Rate */
-  auto j = ni->begin ();
+  auto j = ni.first;
   Time previous = j->first;
   WifiPreamble preamble = txVector.GetPreambleType ();
   WifiMode mcsHeaderMode;
@@ -509,7 +540,7 @@ InterferenceHelper::CalculateNonLegacyPhyHeaderPer (Ptr<const Event> event, NiCh
   Time plcpPayloadStart = plcpTrainingSymbolsStart + WifiPhy::GetPlcpTrainingSymbolDuration (txVector) + WifiPhy::GetPlcpSigBDuration (preamble); //packet start time + preamble + L-SIG + HT-SIG or SIG-A + Training + SIG-B
   double noiseInterferenceW = m_firstPower;
   double powerW = event->GetRxPowerW ();
-  while (++j != ni->end ())
+  while (++j != ni.second)
     {
       Time current = j->first;
       NS_LOG_DEBUG ("previous= " << previous << ", current=" << current);
@@ -849,7 +880,7 @@ InterferenceHelper::CalculateNonLegacyPhyHeaderPer (Ptr<const Event> event, NiCh
 struct InterferenceHelper::SnrPer
 InterferenceHelper::CalculatePayloadSnrPer (Ptr<Event> event, std::pair<Time, Time> relativeMpduStartStop) const
 {
-  NiChanges ni;
+  NiChangesView ni;
   double noiseInterferenceW = CalculateNoiseInterferenceW (event, &ni);
   double snr = CalculateSnr (event->GetRxPowerW (),
                              noiseInterferenceW,
@@ -858,7 +889,7 @@ InterferenceHelper::CalculatePayloadSnrPer (Ptr<Event> event, std::pair<Time, Ti
   /* calculate the SNIR at the start of the MPDU (located through windowing) and accumulate
    * all SNIR changes in the snir vector.
    */
-  double per = CalculatePayloadPer (event, &ni, relativeMpduStartStop);
+  double per = CalculatePayloadPer (event, ni, relativeMpduStartStop);
 
   struct SnrPer snrPer;
   snrPer.snr = snr;
@@ -869,7 +900,7 @@ InterferenceHelper::CalculatePayloadSnrPer (Ptr<Event> event, std::pair<Time, Ti
 double
 InterferenceHelper::CalculateSnr (Ptr<Event> event) const
 {
-  NiChanges ni;
+  NiChangesView ni;
   double noiseInterferenceW = CalculateNoiseInterferenceW (event, &ni);
   double snr = CalculateSnr (event->GetRxPowerW (),
                              noiseInterferenceW,
@@ -880,7 +911,7 @@ InterferenceHelper::CalculateSnr (Ptr<Event> event) const
 struct InterferenceHelper::SnrPer
 InterferenceHelper::CalculateLegacyPhyHeaderSnrPer (Ptr<Event> event) const
 {
-  NiChanges ni;
+  NiChangesView ni;
   double noiseInterferenceW = CalculateNoiseInterferenceW (event, &ni);
   double snr = CalculateSnr (event->GetRxPowerW (),
                              noiseInterferenceW,
@@ -889,7 +920,7 @@ InterferenceHelper::CalculateLegacyPhyHeaderSnrPer (Ptr<Event> event) const
   /* calculate the SNIR at the start of the plcp header and accumulate
    * all SNIR changes in the snir vector.
    */
-  double per = CalculateLegacyPhyHeaderPer (event, &ni);
+  double per = CalculateLegacyPhyHeaderPer (event, ni);
 
   struct SnrPer snrPer;
   snrPer.snr = snr;
@@ -900,7 +931,7 @@ InterferenceHelper::CalculateLegacyPhyHeaderSnrPer (Ptr<Event> event) const
 struct InterferenceHelper::SnrPer
 InterferenceHelper::CalculateNonLegacyPhyHeaderSnrPer (Ptr<Event> event) const
 {
-  NiChanges ni;
+  NiChangesView ni;
   double noiseInterferenceW = CalculateNoiseInterferenceW (event, &ni);
   double snr = CalculateSnr (event->GetRxPowerW (),
                              noiseInterferenceW,
@@ -909,7 +940,7 @@ InterferenceHelper::CalculateNonLegacyPhyHeaderSnrPer (Ptr<Event> event) const
   /* calculate the SNIR at the start of the plcp header and accumulate
    * all SNIR changes in the snir vector.
    */
-  double per = CalculateNonLegacyPhyHeaderPer (event, &ni);
+  double per = CalculateNonLegacyPhyHeaderPer (event, ni);
   
   struct SnrPer snrPer;
   snrPer.snr = snr;
@@ -921,16 +952,43 @@ void
 InterferenceHelper::EraseEvents (void)
 {
   m_niChanges.clear ();
+  m_niChangesPeakSize = 0;
   // Always have a zero power noise event in the list
   AddNiChangeEvent (Time (0), NiChange (0.0, 0));
   m_rxing = false;
   m_firstPower = 0;
 }
 
+struct InterferenceHelper::NiChangesStats
+InterferenceHelper::GetNiChangesStats (void) const
+{
+  struct NiChangesStats stats;
+  stats.size = m_niChanges.size ();
+  stats.peakSize = m_niChangesPeakSize;
+  stats.capacity = m_niChanges.capacity ();
+  stats.bytes = m_niChanges.capacity () * sizeof (NiChanges::value_type);
+  return stats;
+}
+
 InterferenceHelper::NiChanges::const_iterator
 InterferenceHelper::GetNextPosition (Time moment) const
 {
-  return m_niChanges.upper_bound (moment);
+  return std::upper_bound (m_niChanges.begin (), m_niChanges.end (), moment,
+                           [] (Time t, const NiChanges::value_type &change)
+                           { return t < change.first; });
+}
+
+InterferenceHelper::NiChanges::const_iterator
+InterferenceHelper::Find (Time moment) const
+{
+  auto it = std::lower_bound (m_niChanges.begin (), m_niChanges.end (), moment,
+                              [] (const NiChanges::value_type &change, Time t)
+                              { return change.first < t; });
+  if (it != m_niChanges.end () && it->first != moment)
+    {
+      return m_niChanges.end ();
+    }
+  return it;
 }
 
 InterferenceHelper::NiChanges::const_iterator
@@ -943,10 +1001,12 @@ InterferenceHelper::GetPreviousPosition (Time moment) const
   return it;
 }
 
-InterferenceHelper::NiChanges::iterator
+std::size_t
 InterferenceHelper::AddNiChangeEvent (Time moment, NiChange change)
 {
-  return m_niChanges.insert (GetNextPosition (moment), std::make_pair (moment, change));
+  std::size_t index = GetNextPosition (moment) - m_niChanges.begin ();
+  m_niChanges.insert (m_niChanges.begin () + index, std::make_pair (moment, change));
+  return index;
 }
 
 void
@@ -962,7 +1022,7 @@ InterferenceHelper::NotifyRxEnd ()
   NS_LOG_FUNCTION (this);
   m_rxing = false;
   //Update m_firstPower for frame capture
-  auto it = m_niChanges.find (Simulator::Now ());
+  auto it = Find (Simulator::Now ());
   it--;
   m_firstPower = it->second.GetPower ();
 }
@@ -23,7 +23,7 @@
 
 #include "ns3/nstime.h"
 #include "wifi-tx-vector.h"
-#include <map>
+#include <vector>
 
 namespace ns3 {
 
@@ -114,6 +114,17 @@ public:
     double per; ///< PER
   };
 
+  /**
+   * A struct for the memory usage of the NI changes
+   */
+  struct NiChangesStats
+  {
+    std::size_t size; ///< number of NI changes currently stored
+    std::size_t peakSize; ///< largest number of NI changes stored so far
+    std::size_t capacity; ///< number of NI changes the storage can hold without reallocating
+    std::size_t bytes; ///< memory allocated for the storage, in bytes
+  };
+
   InterferenceHelper ();
   ~InterferenceHelper ();
 
@@ -223,6 +234,13 @@ public:
    * Erase all events.
    */
   void EraseEvents (void);
+  /**
+   * Return the memory usage of the NI changes, which are kept as a
+   * time-ordered array pruned from the oldest signal still on the air.
+   *
+   * \return the memory usage of the NI changes
+   */
+  struct InterferenceHelper::NiChangesStats GetNiChangesStats (void) const;
 
 
 private:
@@ -265,9 +283,17 @@ private:
   };
 
   /**
-   * typedef for a multimap of NiChanges
+   * typedef for a time-ordered vector of NiChanges. NiChanges at the same
+   * time are kept in insertion order and the power of each NiChange is the
+   * total power from its time on, so that the power at any time is read from
+   * the last NiChange before it.
    */
-  typedef std::multimap<Time, NiChange> NiChanges;
+  typedef std::vector<std::pair<Time, NiChange> > NiChanges;
+  /**
+   * typedef for a [begin, end) range of NiChanges, from the NiChange of
+   * the start of an event to the NiChange of its end
+   */
+  typedef std::pair<NiChanges::const_iterator, NiChanges::const_iterator> NiChangesView;
 
   /**
    * Append the given Event.
@@ -275,15 +301,21 @@ private:
    * \param event
    */
   void AppendEvent (Ptr<Event> event);
+  /**
+   * Remove the NiChanges that are no longer needed, i.e., those before the
+   * last NiChange preceding both the current time and the start of the
+   * oldest event that has not ended yet.
+   */
+  void PruneNiChanges (void);
   /**
    * Calculate noise and interference power in W.
    *
    * \param event
-   * \param ni
+   * \param ni the NiChanges of the event, from its start to its end
    *
    * \return noise and interference power
    */
-  double CalculateNoiseInterferenceW (Ptr<Event> event, NiChanges *ni) const;
+  double CalculateNoiseInterferenceW (Ptr<Event> event, NiChangesView *ni) const;
   /**
    * Calculate SNR (linear ratio) from the given signal power and noise+interference power.
    *
@@ -317,7 +349,7 @@ private:
    *
    * \return the error rate of the payload
    */
-  double CalculatePayloadPer (Ptr<const Event> event, NiChanges *ni, std::pair<Time, Time> window) const;
+  double CalculatePayloadPer (Ptr<const Event> event, const NiChangesView &ni, std::pair<Time, Time> window) const;
   /**
    * Calculate the error rate of the legacy PHY header. The legacy PHY header
    * can be divided into multiple chunks (e.g. due to interference from other transmissions).
@@ -327,7 +359,7 @@ private:
    *
    * \return the error rate of the legacy PHY header
    */
-  double CalculateLegacyPhyHeaderPer (Ptr<const Event> event, NiChanges *ni) const;
+  double CalculateLegacyPhyHeaderPer (Ptr<const Event> event, const NiChangesView &ni) const;
   /**
    * Calculate the error rate of the non-legacy PHY header. The non-legacy PHY header
    * can be divided into multiple chunks (e.g. due to interference from other transmissions).
@@ -337,13 +369,14 @@ private:
    *
    * \return the error rate of the non-legacy PHY header
    */
-  double CalculateNonLegacyPhyHeaderPer (Ptr<const Event> event, NiChanges *ni) const;
+  double CalculateNonLegacyPhyHeaderPer (Ptr<const Event> event, const NiChangesView &ni) const;
 
   double m_noiseFigure; /**< noise figure (linear) */
   Ptr<ErrorRateModel> m_errorRateModel; ///< error rate model
   uint8_t m_numRxAntennas; /**< the number of RX antennas in the corresponding receiver */
   /// Experimental: needed for energy duration calculation
   NiChanges m_niChanges;
+  std::size_t m_niChangesPeakSize; ///< largest number of NiChanges stored so far
   double m_firstPower; ///< first power
   bool m_rxing; ///< flag whether it is in receiving state
 
@@ -355,12 +388,13 @@ private:
    */
   NiChanges::const_iterator GetNextPosition (Time moment) const;
   /**
-   * Returns an iterator to the first nichange that is later than moment
+   * Returns an iterator to the first nichange that is at moment, or to the
+   * end of the list if there is none
    *
-   * \param moment time to check from
+   * \param moment time to look for
    * \returns an iterator to the list of NiChanges
    */
-  //NiChanges::iterator GetNextPosition (Time moment);
+  NiChanges::const_iterator Find (Time moment) const;
   /**
    * Returns an iterator to the last nichange that is before than moment
    *
@@ -371,13 +405,13 @@ private:
 
   /**
    * Add NiChange to the list at the appropriate position and
-   * return the iterator of the new event.
+   * return the index of the new event.
    *
    * \param moment
    * \param change
-   * \returns the iterator of the new event
+   * \returns the index of the new event
    */
-  NiChanges::iterator AddNiChangeEvent (Time moment, NiChange change);
+  std::size_t AddNiChangeEvent (Time moment, NiChange change);
 };
 
 } //namespace ns3
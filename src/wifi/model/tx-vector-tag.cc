@@ -41,6 +41,8 @@ HighLatencyDataTxVectorTag::GetDataTxVector (void) const
   return m_dataTxVector;
 }
 
+NS_OBJECT_ENSURE_REGISTERED (HighLatencyDataTxVectorTag);
+
 TypeId
 HighLatencyDataTxVectorTag::GetTypeId (void)
 {
@@ -97,6 +99,8 @@ HighLatencyRtsTxVectorTag::GetRtsTxVector (void) const
   return m_rtsTxVector;
 }
 
+NS_OBJECT_ENSURE_REGISTERED (HighLatencyRtsTxVectorTag);
+
 TypeId
 HighLatencyRtsTxVectorTag::GetTypeId (void)
 {
@@ -153,6 +157,8 @@ HighLatencyCtsToSelfTxVectorTag::GetCtsToSelfTxVector (void) const
   return m_ctsToSelfTxVector;
 }
 
+NS_OBJECT_ENSURE_REGISTERED (HighLatencyCtsToSelfTxVectorTag);
+
 TypeId
 HighLatencyCtsToSelfTxVectorTag::GetTypeId (void)
 {
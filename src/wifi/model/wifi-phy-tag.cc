@@ -22,11 +22,15 @@
 
 namespace ns3 {
 
+NS_OBJECT_ENSURE_REGISTERED (WifiPhyTag);
+
 TypeId
 WifiPhyTag::GetTypeId (void)
 {
   static TypeId tid = TypeId ("ns3::WifiPhyTag")
     .SetParent<Tag> ()
+    .SetGroupName ("Wifi")
+    .AddConstructor<WifiPhyTag> ()
   ;
   return tid;
 }
@@ -0,0 +1,78 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "ns3/log.h"
+#include "ns3/packet.h"
+#include "wifi-spectrum-signal-parameters.h"
+#include "wifi-spectrum-signal-codec.h"
+
+namespace ns3 {
+
+NS_LOG_COMPONENT_DEFINE ("WifiSpectrumSignalCodec");
+
+bool
+WifiSpectrumSignalCodec::CanEncode (Ptr<const SpectrumSignalParameters> params) const
+{
+  return DynamicCast<const WifiSpectrumSignalParameters> (params) != 0;
+}
+
+Ptr<Packet>
+WifiSpectrumSignalCodec::Encode (Ptr<const SpectrumSignalParameters> params) const
+{
+  NS_LOG_FUNCTION (this << params);
+  Ptr<const Packet> packet = DynamicCast<const WifiSpectrumSignalParameters> (params)->packet;
+  uint32_t size = GetPacketSerializedSize (packet);
+  Buffer buffer;
+  buffer.AddAtStart (size);
+  Buffer::Iterator i = buffer.Begin ();
+  SerializePacket (i, packet);
+  return Create<Packet> (buffer.PeekData (), size);
+}
+
+Ptr<SpectrumSignalParameters>
+WifiSpectrumSignalCodec::Decode (Ptr<Packet> p) const
+{
+  NS_LOG_FUNCTION (this << p);
+  Buffer buffer;
+  buffer.AddAtStart (p->GetSize ());
+  Buffer::Iterator i = buffer.Begin ();
+  std::vector<uint8_t> data (p->GetSize ());
+  p->CopyData (data.data (), data.size ());
+  i.Write (data.data (), data.size ());
+  i = buffer.Begin ();
+
+  Ptr<WifiSpectrumSignalParameters> params = Create<WifiSpectrumSignalParameters> ();
+  params->packet = DeserializePacket (i);
+  return params;
+}
+
+/**
+ * \ingroup wifi
+ *
+ * Add the WifiSpectrumSignalCodec to the DistributedSpectrumChannel codecs when
+ * the wifi module is loaded.
+ */
+static class WifiSpectrumSignalCodecRegistration
+{
+public:
+  WifiSpectrumSignalCodecRegistration ()
+  {
+    DistributedSpectrumSignalCodec::Add ("ns3::WifiSpectrumSignalParameters",
+                                         Create<WifiSpectrumSignalCodec> ());
+  }
+} g_wifiSpectrumSignalCodecRegistration; ///< the codec registration
+
+} // namespace ns3
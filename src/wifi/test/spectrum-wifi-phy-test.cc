@@ -26,6 +26,7 @@
 #include "ns3/wifi-mac-trailer.h"
 #include "ns3/wifi-phy-tag.h"
 #include "ns3/wifi-spectrum-signal-parameters.h"
+#include "ns3/wifi-spectrum-signal-codec.h"
 #include "ns3/wifi-phy-listener.h"
 #include "ns3/log.h"
 #include "ns3/wifi-phy-header.h"
@@ -313,6 +314,52 @@ SpectrumWifiPhyListenerTest::DoRun (void)
   delete m_listener;
 }
 
+/**
+ * \ingroup wifi-test
+ * \ingroup tests
+ *
+ * \brief Test that WifiSpectrumSignalCodec sends the packet of the signal
+ * with its WifiPhyTag
+ */
+class WifiSpectrumSignalCodecTest : public TestCase
+{
+public:
+  WifiSpectrumSignalCodecTest ();
+  virtual ~WifiSpectrumSignalCodecTest ();
+
+private:
+  virtual void DoRun (void);
+};
+
+WifiSpectrumSignalCodecTest::WifiSpectrumSignalCodecTest ()
+  : TestCase ("WifiSpectrumSignalCodec test encoding of the signals")
+{
+}
+
+WifiSpectrumSignalCodecTest::~WifiSpectrumSignalCodecTest ()
+{
+}
+
+void
+WifiSpectrumSignalCodecTest::DoRun (void)
+{
+  Ptr<WifiSpectrumSignalParameters> sent = Create<WifiSpectrumSignalParameters> ();
+  sent->packet = Create<Packet> (1000);
+  sent->packet->AddPacketTag (WifiPhyTag (WIFI_PREAMBLE_LONG, WIFI_MOD_CLASS_OFDM, 1));
+
+  WifiSpectrumSignalCodec codec;
+  NS_TEST_ASSERT_MSG_EQ (codec.CanEncode (sent), true, "Wifi signal not supported");
+  Ptr<WifiSpectrumSignalParameters> received =
+    DynamicCast<WifiSpectrumSignalParameters> (codec.Decode (codec.Encode (sent)));
+  NS_TEST_ASSERT_MSG_NE (received, 0, "Wrong signal type");
+  NS_TEST_ASSERT_MSG_EQ (received->packet->GetSize (), 1000, "Wrong packet size");
+  WifiPhyTag tag;
+  NS_TEST_ASSERT_MSG_EQ (received->packet->PeekPacketTag (tag), true, "WifiPhyTag lost");
+  NS_TEST_ASSERT_MSG_EQ (tag.GetPreambleType (), WIFI_PREAMBLE_LONG, "Wrong preamble");
+  NS_TEST_ASSERT_MSG_EQ (tag.GetModulation (), WIFI_MOD_CLASS_OFDM, "Wrong modulation");
+  NS_TEST_ASSERT_MSG_EQ ((uint16_t) tag.GetFrameComplete (), 1, "Wrong frame complete");
+}
+
 /**
  * \ingroup wifi-test
  * \ingroup tests
@@ -330,6 +377,7 @@ SpectrumWifiPhyTestSuite::SpectrumWifiPhyTestSuite ()
 {
   AddTestCase (new SpectrumWifiPhyBasicTest, TestCase::QUICK);
   AddTestCase (new SpectrumWifiPhyListenerTest, TestCase::QUICK);
+  AddTestCase (new WifiSpectrumSignalCodecTest, TestCase::QUICK);
 }
 
 static SpectrumWifiPhyTestSuite spectrumWifiPhyTestSuite; ///< the test suite
@@ -46,6 +46,8 @@
 #include "ns3/mgt-headers.h"
 #include "ns3/ht-configuration.h"
 #include "ns3/wifi-phy-header.h"
+#include "ns3/interference-helper.h"
+#include "ns3/wifi-utils.h"
 
 using namespace ns3;
 
@@ -2174,6 +2176,91 @@ Bug2470TestCase::DoRun (void)
   // but before it does not enter RESET state. More tests should be written to verify all possible scenarios.
 }
 
+//-----------------------------------------------------------------------------
+/**
+ * Make sure that the InterferenceHelper prunes the NI changes of the signals
+ * that have left the air while the PHY stays in the receiving state.
+ *
+ * A new signal starts every 200 microseconds and lasts 100 microseconds,
+ * and a foreign signal interferes with it from 10 to 30 microseconds after
+ * its start. The SNR of each signal is checked during the interference,
+ * and the number of NI changes must not grow with the number of signals.
+ */
+
+class InterferenceHelperPruningTest : public TestCase
+{
+public:
+  InterferenceHelperPruningTest ();
+  virtual void DoRun (void);
+
+private:
+  /**
+   * Add a signal and schedule its interferer and the check of its SNR
+   */
+  void AddSignal (void);
+  /**
+   * Check the SNR of a signal during the interference
+   * \param event the event of the signal
+   */
+  void CheckSnr (Ptr<Event> event);
+
+  InterferenceHelper m_interference; ///< the interference helper
+  double m_signalW; ///< the power of the signals in W
+  double m_interferenceW; ///< the power of the interferers in W
+  double m_noiseFloorW; ///< the noise floor in W
+  uint32_t m_checkedSignals; ///< number of signals whose SNR was checked
+};
+
+InterferenceHelperPruningTest::InterferenceHelperPruningTest ()
+  : TestCase ("InterferenceHelper NI changes pruning"),
+    m_signalW (1e-9),
+    m_interferenceW (1e-10),
+    m_checkedSignals (0)
+{
+}
+
+void
+InterferenceHelperPruningTest::AddSignal (void)
+{
+  WifiTxVector txVector;
+  txVector.SetChannelWidth (20);
+  Ptr<Event> event = m_interference.Add (0, txVector, MicroSeconds (100), m_signalW);
+  Simulator::Schedule (MicroSeconds (10), &InterferenceHelper::AddForeignSignal,
+                       &m_interference, MicroSeconds (20), m_interferenceW);
+  Simulator::Schedule (MicroSeconds (15), &InterferenceHelperPruningTest::CheckSnr, this, event);
+}
+
+void
+InterferenceHelperPruningTest::CheckSnr (Ptr<Event> event)
+{
+  double snr = m_interference.CalculateSnr (event);
+  NS_TEST_ASSERT_MSG_EQ_TOL (snr, m_signalW / (m_noiseFloorW + m_interferenceW), 1e-6 * snr, "Wrong SNR during the interference");
+  m_checkedSignals++;
+}
+
+void
+InterferenceHelperPruningTest::DoRun (void)
+{
+  double noiseFigure = DbToRatio (7);
+  m_noiseFloorW = noiseFigure * 1.3803e-23 * 290 * 20e6;
+  m_interference.SetNoiseFigure (noiseFigure);
+  m_interference.NotifyRxStart ();
+
+  uint32_t nSignals = 1000;
+  for (uint32_t i = 0; i < nSignals; i++)
+    {
+      Simulator::Schedule (MicroSeconds (200 * i), &InterferenceHelperPruningTest::AddSignal, this);
+    }
+  Simulator::Run ();
+  Simulator::Destroy ();
+
+  NS_TEST_ASSERT_MSG_EQ (m_checkedSignals, nSignals, "Wrong number of checked signals");
+  InterferenceHelper::NiChangesStats stats = m_interference.GetNiChangesStats ();
+  NS_TEST_ASSERT_MSG_LT (stats.peakSize, 10, "NI changes not pruned while receiving");
+  NS_TEST_ASSERT_MSG_LT_OR_EQ (stats.size, stats.peakSize, "Inconsistent NI changes stats");
+  NS_TEST_ASSERT_MSG_GT_OR_EQ (stats.capacity, stats.peakSize, "Inconsistent NI changes stats");
+}
+
 /**
  * \ingroup wifi-test
  * \ingroup tests
@@ -2192,6 +2279,7 @@ WifiTestSuite::WifiTestSuite ()
   AddTestCase (new WifiTest, TestCase::QUICK);
   AddTestCase (new QosUtilsIsOldPacketTest, TestCase::QUICK);
   AddTestCase (new InterferenceHelperSequenceTest, TestCase::QUICK); //Bug 991
+  AddTestCase (new InterferenceHelperPruningTest, TestCase::QUICK);
   AddTestCase (new DcfImmediateAccessBroadcastTestCase, TestCase::QUICK);
   AddTestCase (new Bug730TestCase, TestCase::QUICK); //Bug 730
   AddTestCase (new QosFragmentationTestCase, TestCase::QUICK);
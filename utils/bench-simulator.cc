@@ -205,6 +205,7 @@ int main (int argc, char *argv[])
 
   bool schedCal  = false;
   bool schedHeap = false;
+  bool schedHeap4 = false;
   bool schedList = false;
   bool schedMap  = true;
 
@@ -224,6 +225,7 @@ int main (int argc, char *argv[])
              "to be ascii, giving the relative event times in ns.");
   cmd.AddValue ("cal",   "use CalendarSheduler",          schedCal);
   cmd.AddValue ("heap",  "use HeapScheduler",             schedHeap);
+  cmd.AddValue ("heap4", "use FourAryHeapScheduler",      schedHeap4);
   cmd.AddValue ("list",  "use ListSheduler",              schedList);
   cmd.AddValue ("map",   "use MapScheduler (default)",    schedMap);
   cmd.AddValue ("debug", "enable debugging output",       g_debug);
@@ -245,6 +247,10 @@ int main (int argc, char *argv[])
     {
       factory.SetTypeId ("ns3::HeapScheduler");
     }
+  if (schedHeap4)
+    {
+      factory.SetTypeId ("ns3::FourAryHeapScheduler");
+    }
   if (schedList)
     {
       factory.SetTypeId ("ns3::ListScheduler");